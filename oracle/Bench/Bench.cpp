@@ -0,0 +1,322 @@
+#include "Libra/Deps.h"
+#include "Libra/Document.h"
+#include "Libra/JsonEmitter.h"
+#include "Libra/Pass.h"
+#include "Libra/Serializer.h"
+#include "Libra/Stats.h"
+
+#include <llvm/IRReader/IRReader.h>
+#include <llvm/Support/InitLLVM.h>
+#include <llvm/Support/Path.h>
+#include <llvm/Support/SourceMgr.h>
+
+using namespace libra;
+
+namespace {
+
+cl::list<std::string> OptInputs(cl::Positional, cl::OneOrMore,
+                                cl::desc("<input modules>"));
+
+cl::opt<std::string>
+    OptResult("bench-result",
+              cl::desc("Write the results to the given file, in JSON"));
+
+cl::opt<unsigned>
+    OptRepeat("bench-repeat", cl::init(3),
+              cl::desc("Number of runs per module and mode, the fastest of "
+                       "which is reported"));
+
+cl::list<std::string> OptModes("bench-mode", cl::CommaSeparated,
+                               cl::desc("Output modes to run (default: all)"));
+
+/// One way of producing the output, as a combination of pass options
+struct Mode {
+  const char *name;
+  OutputFormat format;
+  bool compact;
+  bool columnar;
+  bool side_tables;
+};
+
+constexpr Mode MODES[] = {
+    {"json", OutputFormat::Json, false, false, false},
+    {"json-compact", OutputFormat::Json, true, false, false},
+    {"json-formatv", OutputFormat::JsonFormatv, false, false, false},
+    {"json-formatv-compact", OutputFormat::JsonFormatv, true, false, false},
+    {"cbor", OutputFormat::Cbor, false, false, false},
+    {"columnar", OutputFormat::Cbor, false, true, false},
+    {"census", OutputFormat::Census, true, false, false},
+    {"digest", OutputFormat::Digest, false, false, false},
+    {"full", OutputFormat::Cbor, false, false, true},
+};
+
+/// Set the pass options of a mode, options not covered by any mode are left
+/// to the command line
+void configure(const Mode &mode, StringRef output) {
+  OptOutput = output.str();
+  OptFormat = mode.format;
+  OptCompact = mode.compact;
+  OptColumnar = mode.columnar;
+  for (auto *opt :
+       {&OptDominance, &OptLoops, &OptMemorySSA, &OptCallGraph, &OptSummaries,
+        &OptLayout, &OptGepOffsets, &OptDefUse, &OptValueFacts, &OptEscape,
+        &OptFrequency, &OptDebugLocs, &OptAliasMetadata}) {
+    *opt = mode.side_tables;
+  }
+}
+
+/// Start a new measurement of peak memory, false if only the peak of the
+/// whole process is available
+bool reset_peak_rss() {
+#if defined(__linux__)
+  std::error_code ec;
+  raw_fd_ostream stm("/proc/self/clear_refs", ec,
+                     sys::fs::CreationDisposition::CD_OpenExisting);
+  if (ec) {
+    return false;
+  }
+  // resets the high water mark of the resident set size
+  stm << "5";
+  stm.close();
+  if (stm.has_error()) {
+    stm.clear_error();
+    return false;
+  }
+  return true;
+#else
+  return false;
+#endif
+}
+
+/// Peak memory since the last reset, in bytes
+std::optional<uint64_t> read_peak_rss() {
+#if defined(__linux__)
+  auto buffer = MemoryBuffer::getFileAsStream("/proc/self/status");
+  if (!buffer) {
+    return std::nullopt;
+  }
+  SmallVector<StringRef, 64> lines;
+  (*buffer)->getBuffer().split(lines, '\n');
+  for (auto line : lines) {
+    if (!line.consume_front("VmHWM:")) {
+      continue;
+    }
+    // e.g., "VmHWM:     1234 kB"
+    line = line.trim();
+    uint64_t size = 0;
+    if (line.consume_back("kB") && !line.trim().getAsInteger(10, size)) {
+      return size * 1024;
+    }
+  }
+  return std::nullopt;
+#else
+  return peak_rss();
+#endif
+}
+
+/// Measurements of one run of the pass
+struct Sample {
+  double seconds;
+  uint64_t output_bytes;
+  std::optional<uint64_t> peak_rss;
+};
+
+/// Measurements of one module in one mode, over all runs
+struct Result {
+  std::string module;
+  const Mode *mode;
+  uint64_t input_bytes;
+  uint64_t functions;
+  std::vector<Sample> samples;
+};
+
+std::unique_ptr<Module> load_module(StringRef path, LLVMContext &context) {
+  SMDiagnostic diag;
+  auto module = parseIRFile(path, diag, context);
+  if (module == nullptr) {
+    diag.print("LibraBench", errs());
+    exit(1);
+  }
+  return module;
+}
+
+/// Run the pass in-process on a freshly parsed module, parsing excluded
+Sample run_once(StringRef path, const Mode &mode, StringRef output,
+                bool &per_run_peak) {
+  LLVMContext context;
+  auto module = load_module(path, context);
+
+  configure(mode, output);
+  sys::fs::remove(output);
+
+  // the analyses available to the pass, as set up by opt
+  LoopAnalysisManager lam;
+  FunctionAnalysisManager fam;
+  CGSCCAnalysisManager cgam;
+  ModuleAnalysisManager mam;
+  PassBuilder builder;
+  fam.registerPass([&] { return builder.buildDefaultAAPipeline(); });
+  builder.registerModuleAnalyses(mam);
+  builder.registerCGSCCAnalyses(cgam);
+  builder.registerFunctionAnalyses(fam);
+  builder.registerLoopAnalyses(lam);
+  builder.crossRegisterProxies(lam, fam, cgam, mam);
+
+  ModulePassManager mpm;
+  mpm.addPass(LibraPass());
+
+  per_run_peak = reset_peak_rss();
+  const auto start = std::chrono::steady_clock::now();
+  mpm.run(*module, mam);
+
+  Sample sample{};
+  sample.seconds = seconds_since(start);
+  if (auto ec = sys::fs::file_size(output, sample.output_bytes)) {
+    errs() << formatv("unable to stat output {0}: {1}\n", output,
+                      ec.message());
+    exit(1);
+  }
+  sample.peak_rss = per_run_peak ? read_peak_rss() : peak_rss();
+  return sample;
+}
+
+Result run_module(StringRef path, const Mode &mode, StringRef output,
+                  bool &per_run_peak) {
+  Result result;
+  result.module = sys::path::filename(path).str();
+  result.mode = &mode;
+  if (auto ec = sys::fs::file_size(path, result.input_bytes)) {
+    errs() << formatv("unable to stat input {0}: {1}\n", path, ec.message());
+    exit(1);
+  }
+  {
+    LLVMContext context;
+    auto module = load_module(path, context);
+    result.functions = count_if(module->functions(), [](const Function &f) {
+      return !f.isDeclaration();
+    });
+  }
+
+  for (unsigned i = 0; i < std::max(OptRepeat.getValue(), 1u); i++) {
+    result.samples.push_back(run_once(path, mode, output, per_run_peak));
+  }
+  llvm::sort(result.samples, [](const Sample &lhs, const Sample &rhs) {
+    return lhs.seconds < rhs.seconds;
+  });
+  return result;
+}
+
+/// Throughput in units per second, zero for runs below the timer resolution
+double per_second(double units, double seconds) {
+  return seconds > 0 ? units / seconds : 0;
+}
+
+DocObject serialize_result(const Result &result) {
+  const auto &best = result.samples.front();
+  const auto &median = result.samples[result.samples.size() / 2];
+  std::optional<uint64_t> peak;
+  for (const auto &sample : result.samples) {
+    if (sample.peak_rss) {
+      peak = std::max(peak.value_or(0), *sample.peak_rss);
+    }
+  }
+
+  DocObject item;
+  item["module"] = result.module;
+  item["mode"] = result.mode->name;
+  item["input_bytes"] = result.input_bytes;
+  item["functions"] = result.functions;
+  item["output_bytes"] = best.output_bytes;
+  item["seconds"] = best.seconds;
+  item["seconds_median"] = median.seconds;
+  item["mb_per_s"] = per_second(result.input_bytes / 1e6, best.seconds);
+  item["output_mb_per_s"] = per_second(best.output_bytes / 1e6, best.seconds);
+  item["functions_per_s"] = per_second(result.functions, best.seconds);
+  if (peak) {
+    item["peak_rss"] = *peak;
+  } else {
+    item["peak_rss"] = DocValue(nullptr);
+  }
+  return item;
+}
+
+void save_results(StringRef path, const std::vector<Result> &results,
+                  bool per_run_peak) {
+  DocArena arena;
+  DocArray items;
+  for (const auto &result : results) {
+    items.push_back(serialize_result(result));
+  }
+
+  DocObject doc;
+  doc["llvm_version"] = LLVM_VERSION_STRING;
+  doc["repeat"] = std::max(OptRepeat.getValue(), 1u);
+  doc["per_run_peak_rss"] = per_run_peak;
+  doc["results"] = std::move(items);
+
+  std::error_code ec;
+  raw_fd_ostream stm(path, ec);
+  if (ec) {
+    errs() << formatv("unable to write results {0}: {1}\n", path,
+                      ec.message());
+    exit(1);
+  }
+  JsonEmitter emitter(stm, 2);
+  emitter.value(doc);
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  InitLLVM init(argc, argv);
+  cl::ParseCommandLineOptions(argc, argv,
+                              "End-to-end benchmark of the serializer\n");
+
+  std::vector<const Mode *> modes;
+  for (const auto &mode : MODES) {
+    if (OptModes.empty() || is_contained(OptModes, mode.name)) {
+      modes.push_back(&mode);
+    }
+  }
+  for (const auto &name : OptModes) {
+    if (none_of(MODES, [&](const Mode &mode) { return name == mode.name; })) {
+      errs() << formatv("unknown mode: {0}\n", name);
+      return 1;
+    }
+  }
+
+  SmallString<128> output;
+  if (auto ec = sys::fs::createTemporaryFile("libra-bench", "out", output)) {
+    errs() << formatv("unable to create output file: {0}\n", ec.message());
+    return 1;
+  }
+
+  outs() << formatv("{0,-24} {1,-14} {2,10} {3,12} {4,12} {5,10}\n",
+                    "module", "mode", "MB/s", "functions/s", "bytes",
+                    "peak MiB");
+  std::vector<Result> results;
+  bool per_run_peak = true;
+  for (const auto &path : OptInputs) {
+    for (const auto *mode : modes) {
+      bool resettable = false;
+      auto result = run_module(path, *mode, output, resettable);
+      per_run_peak &= resettable;
+
+      const auto &best = result.samples.front();
+      const auto peak = best.peak_rss.value_or(0) / (1024.0 * 1024.0);
+      outs() << formatv(
+          "{0,-24} {1,-14} {2,10:f2} {3,12:f1} {4,12} {5,10:f1}\n",
+          result.module, mode->name,
+          per_second(result.input_bytes / 1e6, best.seconds),
+          per_second(result.functions, best.seconds), best.output_bytes,
+          peak);
+      results.push_back(std::move(result));
+    }
+  }
+  sys::fs::remove(output);
+
+  if (!OptResult.empty()) {
+    save_results(OptResult, results, per_run_peak);
+  }
+  return 0;
+}
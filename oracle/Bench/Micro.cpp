@@ -0,0 +1,553 @@
+#include "Libra/Deps.h"
+#include "Libra/Document.h"
+#include "Libra/JsonEmitter.h"
+#include "Libra/Logger.h"
+#include "Libra/Serializer.h"
+
+#include <llvm/AsmParser/Parser.h>
+#include <llvm/Support/InitLLVM.h>
+#include <llvm/Support/SourceMgr.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+using namespace libra;
+
+//-----------------------------------------------------------------------------
+// Allocation Counting
+//-----------------------------------------------------------------------------
+
+namespace {
+
+/// Number of heap allocations made by the process so far
+std::atomic<uint64_t> HEAP_ALLOCATIONS{0};
+
+void *counted_alloc(size_t size) {
+  HEAP_ALLOCATIONS.fetch_add(1, std::memory_order_relaxed);
+  if (void *ptr = std::malloc(size == 0 ? 1 : size)) {
+    return ptr;
+  }
+  report_bad_alloc_error("heap allocation failed");
+}
+
+} // namespace
+
+void *operator new(size_t size) { return counted_alloc(size); }
+void *operator new[](size_t size) { return counted_alloc(size); }
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+void operator delete[](void *ptr) noexcept { std::free(ptr); }
+void operator delete(void *ptr, size_t) noexcept { std::free(ptr); }
+void operator delete[](void *ptr, size_t) noexcept { std::free(ptr); }
+
+namespace {
+
+cl::opt<std::string>
+    OptResult("bench-result",
+              cl::desc("Write the results to the given file, in JSON"));
+
+cl::opt<double>
+    OptMinTime("bench-min-time", cl::init(0.1),
+               cl::desc("Minimum time (in seconds) to measure each kernel"));
+
+cl::opt<std::string>
+    OptFilter("bench-filter",
+              cl::desc("Only run kernels whose name contains the string"));
+
+/// Synthetic IR covering each kernel, one function per instruction kind, in
+/// which the first instruction of the named opcode is the one measured
+constexpr const char *SYNTHETIC_IR = R"IR(
+%struct.node = type { i32, ptr, [4 x i8] }
+
+@global = global i32 0
+@str = private constant [6 x i8] c"hello\00"
+@ptrs = global [2 x ptr] [ptr @global, ptr null]
+@node = global %struct.node { i32 1, ptr @global, [4 x i8] c"abcd" }
+@vec = global <4 x i32> <i32 1, i32 undef, i32 3, i32 4>
+@expr = global ptr getelementptr (i8, ptr @str, i64 2)
+
+declare void @callee(i32)
+declare i32 @llvm.smax.i32(i32, i32)
+declare i32 @__gxx_personality_v0(...)
+
+define void @alloca() {
+  %x = alloca i32, align 4
+  ret void
+}
+
+define i32 @load(ptr %p) {
+  %v = load i32, ptr %p, align 4
+  ret i32 %v
+}
+
+define void @store(ptr %p, i32 %v) {
+  store i32 %v, ptr %p, align 4
+  ret void
+}
+
+define i32 @va_arg(ptr %ap) {
+  %v = va_arg ptr %ap, i32
+  ret i32 %v
+}
+
+define void @call_asm() {
+  call void asm sideeffect "nop", ""()
+  ret void
+}
+
+define void @call_direct(i32 %x) {
+  call void @callee(i32 %x)
+  ret void
+}
+
+define void @call_indirect(ptr %f, i32 %x) {
+  call void %f(i32 %x)
+  ret void
+}
+
+define i32 @call_intrinsic(i32 %a, i32 %b) {
+  %m = call i32 @llvm.smax.i32(i32 %a, i32 %b)
+  ret i32 %m
+}
+
+define float @unary_operator(float %x) {
+  %n = fneg float %x
+  ret float %n
+}
+
+define i32 @binary_operator(i32 %a, i32 %b) {
+  %s = add nsw i32 %a, %b
+  %t = mul i32 %s, 3
+  ret i32 %t
+}
+
+define i1 @compare(i32 %a, i32 %b) {
+  %c = icmp slt i32 %a, %b
+  ret i1 %c
+}
+
+define i64 @cast(i32 %a) {
+  %w = sext i32 %a to i64
+  ret i64 %w
+}
+
+define i32 @freeze(i32 %a) {
+  %f = freeze i32 %a
+  ret i32 %f
+}
+
+define ptr @gep(ptr %p, i64 %i) {
+  %q = getelementptr inbounds %struct.node, ptr %p, i64 %i, i32 2, i64 1
+  ret ptr %q
+}
+
+define i32 @phi(i1 %c, i32 %a, i32 %b) {
+entry:
+  br i1 %c, label %left, label %right
+
+left:
+  br label %join
+
+right:
+  br label %join
+
+join:
+  %x = phi i32 [ %a, %left ], [ %b, %right ]
+  ret i32 %x
+}
+
+define i32 @ite(i1 %c, i32 %a, i32 %b) {
+  %x = select i1 %c, i32 %a, i32 %b
+  ret i32 %x
+}
+
+define i32 @get_value({ i32, ptr } %agg) {
+  %x = extractvalue { i32, ptr } %agg, 0
+  ret i32 %x
+}
+
+define { i32, ptr } @set_value({ i32, ptr } %agg, i32 %x) {
+  %r = insertvalue { i32, ptr } %agg, i32 %x, 0
+  ret { i32, ptr } %r
+}
+
+define float @get_element(<4 x float> %v, i32 %i) {
+  %x = extractelement <4 x float> %v, i32 %i
+  ret float %x
+}
+
+define <4 x float> @set_element(<4 x float> %v, float %x) {
+  %r = insertelement <4 x float> %v, float %x, i32 1
+  ret <4 x float> %r
+}
+
+define <4 x float> @shuffle_vector(<4 x float> %a, <4 x float> %b) {
+  %r = shufflevector <4 x float> %a, <4 x float> %b, <4 x i32> <i32 0, i32 4, i32 1, i32 5>
+  ret <4 x float> %r
+}
+
+define void @fence() {
+  fence seq_cst
+  ret void
+}
+
+define void @atomic_cmpxchg(ptr %p, i32 %a, i32 %b) {
+  %r = cmpxchg ptr %p, i32 %a, i32 %b acq_rel monotonic, align 4
+  ret void
+}
+
+define void @atomic_rmw(ptr %p, i32 %a) {
+  %r = atomicrmw add ptr %p, i32 %a seq_cst, align 4
+  ret void
+}
+
+define void @invoke_direct() personality ptr @__gxx_personality_v0 {
+entry:
+  invoke void @callee(i32 0)
+          to label %ok unwind label %lpad
+
+ok:
+  ret void
+
+lpad:
+  %l = landingpad { ptr, i32 }
+          catch ptr @global
+  resume { ptr, i32 } %l
+}
+
+define void @invoke_asm() personality ptr @__gxx_personality_v0 {
+entry:
+  invoke void asm sideeffect "nop", ""()
+          to label %ok unwind label %lpad
+
+ok:
+  ret void
+
+lpad:
+  %l = landingpad { ptr, i32 }
+          cleanup
+  resume { ptr, i32 } %l
+}
+
+define void @invoke_indirect(ptr %f) personality ptr @__gxx_personality_v0 {
+entry:
+  invoke void %f(i32 0)
+          to label %ok unwind label %lpad
+
+ok:
+  ret void
+
+lpad:
+  %l = landingpad { ptr, i32 }
+          cleanup
+  resume { ptr, i32 } %l
+}
+
+define i32 @return(i32 %x) {
+  ret i32 %x
+}
+
+define void @branch(i1 %c) {
+entry:
+  br i1 %c, label %left, label %right
+
+left:
+  ret void
+
+right:
+  ret void
+}
+
+define void @jump_indirect(ptr %addr) {
+entry:
+  indirectbr ptr %addr, [label %left, label %right]
+
+left:
+  ret void
+
+right:
+  ret void
+}
+
+define void @switch(i32 %x) {
+entry:
+  switch i32 %x, label %other [
+    i32 0, label %left
+    i32 1, label %right
+  ]
+
+left:
+  ret void
+
+right:
+  ret void
+
+other:
+  ret void
+}
+)IR";
+
+/// An instruction kernel: the function holding it, and its opcode
+struct InstKernel {
+  const char *name;
+  const char *func;
+  unsigned opcode;
+};
+
+constexpr InstKernel INST_KERNELS[] = {
+    {"alloca", "alloca", Instruction::Alloca},
+    {"load", "load", Instruction::Load},
+    {"store", "store", Instruction::Store},
+    {"va_arg", "va_arg", Instruction::VAArg},
+    {"call_asm", "call_asm", Instruction::Call},
+    {"call_direct", "call_direct", Instruction::Call},
+    {"call_indirect", "call_indirect", Instruction::Call},
+    {"call_intrinsic", "call_intrinsic", Instruction::Call},
+    {"unary_operator", "unary_operator", Instruction::FNeg},
+    {"binary_operator", "binary_operator", Instruction::Add},
+    {"compare", "compare", Instruction::ICmp},
+    {"cast", "cast", Instruction::SExt},
+    {"freeze", "freeze", Instruction::Freeze},
+    {"gep", "gep", Instruction::GetElementPtr},
+    {"phi", "phi", Instruction::PHI},
+    {"ite", "ite", Instruction::Select},
+    {"get_value", "get_value", Instruction::ExtractValue},
+    {"set_value", "set_value", Instruction::InsertValue},
+    {"get_element", "get_element", Instruction::ExtractElement},
+    {"set_element", "set_element", Instruction::InsertElement},
+    {"shuffle_vector", "shuffle_vector", Instruction::ShuffleVector},
+    {"fence", "fence", Instruction::Fence},
+    {"atomic_cmpxchg", "atomic_cmpxchg", Instruction::AtomicCmpXchg},
+    {"atomic_rmw", "atomic_rmw", Instruction::AtomicRMW},
+    {"landing_pad", "invoke_direct", Instruction::LandingPad},
+    {"return", "return", Instruction::Ret},
+    {"branch", "branch", Instruction::Br},
+    {"jump_indirect", "jump_indirect", Instruction::IndirectBr},
+    {"switch", "switch", Instruction::Switch},
+    {"invoke_asm", "invoke_asm", Instruction::Invoke},
+    {"invoke_direct", "invoke_direct", Instruction::Invoke},
+    {"invoke_indirect", "invoke_indirect", Instruction::Invoke},
+    {"resume", "invoke_direct", Instruction::Resume},
+};
+
+/// Cost of one kernel, per call
+struct Measurement {
+  std::string name;
+  uint64_t ops;
+  double ns_per_op;
+  double allocs_per_op;
+  double arena_bytes_per_op;
+};
+
+/// Keeps the results observable, so that calls are not optimized away
+volatile size_t RESULT_SINK = 0;
+
+size_t observe(const DocObject &obj) { return obj.size(); }
+size_t observe(const DocValue &val) { return static_cast<size_t>(val.kind()); }
+
+/// Call the kernel in batches until the minimum time is reached, with the
+/// arena released between batches and outside of the timed region
+template <typename Fn> Measurement measure(StringRef name, Fn &&kernel) {
+  constexpr uint64_t BATCH = 256;
+
+  Measurement result{name.str(), 0, 0, 0, 0};
+  DocArena arena;
+  double seconds = 0;
+  uint64_t allocs = 0;
+  uint64_t arena_bytes = 0;
+
+  // warm up caches and any lazily created state
+  for (uint64_t i = 0; i < BATCH; i++) {
+    RESULT_SINK = RESULT_SINK + observe(kernel());
+  }
+
+  do {
+    arena.reset();
+    const auto allocs_before = HEAP_ALLOCATIONS.load();
+    const auto start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0; i < BATCH; i++) {
+      RESULT_SINK = RESULT_SINK + observe(kernel());
+    }
+    seconds += seconds_since(start);
+    allocs += HEAP_ALLOCATIONS.load() - allocs_before;
+    arena_bytes += arena.bytes_allocated();
+    result.ops += BATCH;
+  } while (seconds < OptMinTime);
+
+  const auto ops = static_cast<double>(result.ops);
+  result.ns_per_op = seconds * 1e9 / ops;
+  result.allocs_per_op = allocs / ops;
+  result.arena_bytes_per_op = arena_bytes / ops;
+  return result;
+}
+
+bool selected(StringRef name) {
+  return OptFilter.empty() || name.contains(OptFilter);
+}
+
+const Instruction &find_instruction(const Module &module,
+                                    const InstKernel &kernel) {
+  const auto *func = module.getFunction(kernel.func);
+  assert(func != nullptr);
+  for (const auto &inst : instructions(*func)) {
+    if (inst.getOpcode() == kernel.opcode) {
+      return inst;
+    }
+  }
+  LOG->fatal("no {0} instruction in function {1}", kernel.name, kernel.func);
+}
+
+const Constant &initializer(const Module &module, StringRef name) {
+  const auto *gvar = module.getGlobalVariable(name, true);
+  assert(gvar != nullptr && gvar->hasInitializer());
+  return *gvar->getInitializer();
+}
+
+std::vector<Measurement> run_kernels(const Module &module) {
+  auto &ctx = module.getContext();
+  std::vector<Measurement> results;
+  const auto run = [&](StringRef name, auto &&kernel) {
+    if (selected(name)) {
+      results.push_back(measure(name, kernel));
+      const auto &item = results.back();
+      outs() << formatv("{0,-36} {1,10:f1} {2,12:f2} {3,12:f1}\n", item.name,
+                        item.ns_per_op, item.allocs_per_op,
+                        item.arena_bytes_per_op);
+    }
+  };
+
+  // types
+  const auto *node = StructType::getTypeByName(ctx, "struct.node");
+  const std::pair<const char *, const Type *> types[] = {
+      {"int", Type::getInt32Ty(ctx)},
+      {"float", Type::getDoubleTy(ctx)},
+      {"pointer", PointerType::getUnqual(ctx)},
+      {"array", ArrayType::get(Type::getInt32Ty(ctx), 16)},
+      {"vector", FixedVectorType::get(Type::getFloatTy(ctx), 4)},
+      {"struct_named", node},
+      {"struct_literal",
+       StructType::get(Type::getInt32Ty(ctx), PointerType::getUnqual(ctx))},
+      {"function", module.getFunction("callee")->getFunctionType()},
+  };
+  for (const auto &entry : types) {
+    const auto &type = *entry.second;
+    run((Twine("serialize_type/") + entry.first).str(),
+        [&] { return serialize_type(type); });
+  }
+
+  // constants
+  const std::pair<const char *, const Constant *> constants[] = {
+      {"int", ConstantInt::get(Type::getInt32Ty(ctx), 42)},
+      {"float", ConstantFP::get(Type::getDoubleTy(ctx), 1.5)},
+      {"null", ConstantPointerNull::get(PointerType::getUnqual(ctx))},
+      {"undef", UndefValue::get(Type::getInt32Ty(ctx))},
+      {"data_array", &initializer(module, "str")},
+      {"pack_array", &initializer(module, "ptrs")},
+      {"pack_struct", &initializer(module, "node")},
+      {"pack_vector", &initializer(module, "vec")},
+      {"ref_global_variable", module.getGlobalVariable("global")},
+      {"ref_function", module.getFunction("callee")},
+      {"const_expr", &initializer(module, "expr")},
+  };
+  for (const auto &entry : constants) {
+    const auto &constant = *entry.second;
+    run((Twine("serialize_constant/") + entry.first).str(),
+        [&] { return serialize_constant(constant); });
+  }
+
+  // operands, in the context of the function using them
+  const auto &binary = *module.getFunction("binary_operator");
+  const auto &branch = *module.getFunction("branch");
+  const auto &sum = *binary.getEntryBlock().begin();
+  const std::tuple<const char *, const Function *, const Value *> values[] = {
+      {"argument", &binary, binary.getArg(0)},
+      {"constant", &binary, ConstantInt::get(Type::getInt32Ty(ctx), 3)},
+      {"instruction", &binary, &sum},
+      {"label", &branch, &*std::next(branch.begin())},
+  };
+  for (const auto &entry : values) {
+    const auto &ctxt = contexts.find(std::get<1>(entry))->second;
+    const auto &val = *std::get<2>(entry);
+    run((Twine("serialize_value/") + std::get<0>(entry)).str(),
+        [&] { return ctxt.serialize_value(val); });
+  }
+
+  // instructions, through the opcode dispatch
+  for (const auto &kernel : INST_KERNELS) {
+    const auto &inst = find_instruction(module, kernel);
+    const auto &ctxt = contexts.find(inst.getFunction())->second;
+    run((Twine("serialize_inst/") + kernel.name).str(),
+        [&] { return ctxt.serialize_inst(inst); });
+  }
+
+  return results;
+}
+
+void save_results(StringRef path, const std::vector<Measurement> &results) {
+  DocArena arena;
+  DocArray items;
+  for (const auto &item : results) {
+    DocObject entry;
+    entry["name"] = item.name;
+    entry["ops"] = item.ops;
+    entry["ns_per_op"] = item.ns_per_op;
+    entry["allocs_per_op"] = item.allocs_per_op;
+    entry["arena_bytes_per_op"] = item.arena_bytes_per_op;
+    items.push_back(std::move(entry));
+  }
+
+  DocObject doc;
+  doc["llvm_version"] = LLVM_VERSION_STRING;
+  doc["min_time"] = OptMinTime.getValue();
+  doc["results"] = std::move(items);
+
+  std::error_code ec;
+  raw_fd_ostream stm(path, ec);
+  if (ec) {
+    LOG->fatal("unable to write results {0}: {1}", path, ec.message());
+  }
+  JsonEmitter emitter(stm, 2);
+  emitter.value(doc);
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  InitLLVM init(argc, argv);
+  cl::ParseCommandLineOptions(argc, argv,
+                              "Microbenchmarks of the serializer kernels\n");
+
+  // same setup as the pass, so that options such as -libra-intern-names
+  // apply to the kernels as well
+  init_default_logger(OptVerbose ? Logger::Level::Debug : Logger::Level::Info,
+                      OptVerbose);
+  init_dictionary();
+  init_string_table();
+  init_metadata_table();
+
+  LLVMContext context;
+  SMDiagnostic diag;
+  auto module = parseAssemblyString(SYNTHETIC_IR, diag, context);
+  if (module == nullptr) {
+    diag.print("LibraMicro", errs());
+    return 1;
+  }
+  if (verifyModule(*module, &errs())) {
+    LOG->fatal("invalid synthetic module");
+  }
+  prepare_for_serialization(*module);
+
+  outs() << formatv("{0,-36} {1,10} {2,12} {3,12}\n", "kernel", "ns/op",
+                    "allocs/op", "arena B/op");
+  const auto results = run_kernels(*module);
+  if (!OptResult.empty()) {
+    save_results(OptResult, results);
+  }
+
+  contexts.clear();
+  destroy_metadata_table();
+  destroy_string_table();
+  destroy_dictionary();
+  destroy_default_logger();
+  return 0;
+}
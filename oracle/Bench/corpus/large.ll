@@ -0,0 +1,18027 @@
+; A large module of generated kernels with loops, calls between kernels,
+; debug locations and TBAA metadata, where per-function work dominates.
+
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-unknown-linux-gnu"
+
+%struct.rec = type { i32, i64, double, ptr }
+%struct.grid = type { i32, i32, [16 x %struct.rec], ptr }
+
+@g0 = internal global [16 x i32] [i32 -727, i32 491, i32 148, i32 54, i32 359, i32 394, i32 -160, i32 121, i32 -393, i32 -91, i32 -644, i32 -799, i32 448, i32 201, i32 952, i32 738], align 16
+@g1 = global %struct.rec { i32 1, i64 509066856312, double 543.0e+00, ptr null }, align 8
+@g2 = private unnamed_addr constant [14 x i8] c"kernel 2 done\00", align 1
+@g3 = global i64 0, align 8
+@g4 = internal global [16 x i32] [i32 -449, i32 -892, i32 -660, i32 488, i32 562, i32 662, i32 285, i32 525, i32 567, i32 297, i32 317, i32 343, i32 -875, i32 406, i32 -994, i32 524], align 16
+@g5 = global %struct.rec { i32 5, i64 788006652958, double 577.0e+00, ptr null }, align 8
+@g6 = private unnamed_addr constant [14 x i8] c"kernel 6 done\00", align 1
+@g7 = global i64 0, align 8
+@g8 = internal global [16 x i32] [i32 -161, i32 360, i32 313, i32 950, i32 297, i32 -264, i32 212, i32 -193, i32 -45, i32 -754, i32 -118, i32 303, i32 -139, i32 -289, i32 -877, i32 25], align 16
+@g9 = global %struct.rec { i32 9, i64 509400053138, double 677.0e+00, ptr null }, align 8
+@g10 = private unnamed_addr constant [15 x i8] c"kernel 10 done\00", align 1
+@g11 = global i64 0, align 8
+@g12 = internal global [16 x i32] [i32 444, i32 -943, i32 -28, i32 -543, i32 138, i32 43, i32 -358, i32 882, i32 554, i32 -698, i32 565, i32 -719, i32 -484, i32 579, i32 755, i32 65], align 16
+@g13 = global %struct.rec { i32 13, i64 328733941228, double 806.0e+00, ptr null }, align 8
+@g14 = private unnamed_addr constant [15 x i8] c"kernel 14 done\00", align 1
+@g15 = global i64 0, align 8
+@g16 = internal global [16 x i32] [i32 -809, i32 818, i32 625, i32 557, i32 682, i32 -176, i32 -86, i32 -29, i32 -841, i32 -417, i32 941, i32 -720, i32 765, i32 -751, i32 -675, i32 561], align 16
+@g17 = global %struct.rec { i32 17, i64 1022676960883, double 354.0e+00, ptr null }, align 8
+@g18 = private unnamed_addr constant [15 x i8] c"kernel 18 done\00", align 1
+@g19 = global i64 0, align 8
+@g20 = internal global [16 x i32] [i32 224, i32 239, i32 284, i32 -890, i32 808, i32 -865, i32 -338, i32 -813, i32 -285, i32 -872, i32 125, i32 981, i32 758, i32 -866, i32 -210, i32 463], align 16
+@g21 = global %struct.rec { i32 21, i64 283221778715, double 418.0e+00, ptr null }, align 8
+@g22 = private unnamed_addr constant [15 x i8] c"kernel 22 done\00", align 1
+@g23 = global i64 0, align 8
+@g24 = internal global [16 x i32] [i32 897, i32 38, i32 -764, i32 454, i32 -622, i32 -366, i32 262, i32 -492, i32 -351, i32 -337, i32 -99, i32 -871, i32 -744, i32 46, i32 505, i32 686], align 16
+@g25 = global %struct.rec { i32 25, i64 968932783692, double 624.0e+00, ptr null }, align 8
+@g26 = private unnamed_addr constant [15 x i8] c"kernel 26 done\00", align 1
+@g27 = global i64 0, align 8
+@g28 = internal global [16 x i32] [i32 -328, i32 -575, i32 678, i32 -31, i32 873, i32 327, i32 840, i32 -948, i32 -78, i32 0, i32 813, i32 -870, i32 -193, i32 617, i32 -115, i32 -918], align 16
+@g29 = global %struct.rec { i32 29, i64 682849756068, double 708.0e+00, ptr null }, align 8
+@g30 = private unnamed_addr constant [15 x i8] c"kernel 30 done\00", align 1
+@g31 = global i64 0, align 8
+@g32 = internal global [16 x i32] [i32 960, i32 343, i32 -144, i32 875, i32 -828, i32 -22, i32 518, i32 906, i32 934, i32 -174, i32 -173, i32 989, i32 94, i32 323, i32 82, i32 -360], align 16
+@g33 = global %struct.rec { i32 33, i64 532685506436, double 210.0e+00, ptr null }, align 8
+@g34 = private unnamed_addr constant [15 x i8] c"kernel 34 done\00", align 1
+@g35 = global i64 0, align 8
+@g36 = internal global [16 x i32] [i32 724, i32 -244, i32 999, i32 624, i32 -283, i32 -997, i32 -954, i32 -164, i32 -874, i32 943, i32 767, i32 -564, i32 79, i32 411, i32 -510, i32 193], align 16
+@g37 = global %struct.rec { i32 37, i64 954273236887, double 679.0e+00, ptr null }, align 8
+@g38 = private unnamed_addr constant [15 x i8] c"kernel 38 done\00", align 1
+@g39 = global i64 0, align 8
+@g40 = internal global [16 x i32] [i32 -382, i32 919, i32 846, i32 -592, i32 -12, i32 -833, i32 332, i32 414, i32 846, i32 -600, i32 -787, i32 -970, i32 461, i32 -473, i32 408, i32 -625], align 16
+@g41 = global %struct.rec { i32 41, i64 974581726036, double 911.0e+00, ptr null }, align 8
+@g42 = private unnamed_addr constant [15 x i8] c"kernel 42 done\00", align 1
+@g43 = global i64 0, align 8
+@g44 = internal global [16 x i32] [i32 -865, i32 607, i32 246, i32 -949, i32 -717, i32 528, i32 894, i32 987, i32 692, i32 -316, i32 449, i32 792, i32 765, i32 -237, i32 -575, i32 115], align 16
+@g45 = global %struct.rec { i32 45, i64 110202956699, double 681.0e+00, ptr null }, align 8
+@g46 = private unnamed_addr constant [15 x i8] c"kernel 46 done\00", align 1
+@g47 = global i64 0, align 8
+@g48 = internal global [16 x i32] [i32 886, i32 613, i32 -994, i32 337, i32 -720, i32 -639, i32 633, i32 -646, i32 587, i32 -462, i32 -172, i32 -249, i32 859, i32 146, i32 693, i32 -234], align 16
+@g49 = global %struct.rec { i32 49, i64 679661867599, double 832.0e+00, ptr null }, align 8
+@g50 = private unnamed_addr constant [15 x i8] c"kernel 50 done\00", align 1
+@g51 = global i64 0, align 8
+@g52 = internal global [16 x i32] [i32 -37, i32 261, i32 259, i32 81, i32 -485, i32 -203, i32 306, i32 468, i32 880, i32 -736, i32 -148, i32 531, i32 -702, i32 187, i32 -954, i32 -208], align 16
+@g53 = global %struct.rec { i32 53, i64 573349968994, double 471.0e+00, ptr null }, align 8
+@g54 = private unnamed_addr constant [15 x i8] c"kernel 54 done\00", align 1
+@g55 = global i64 0, align 8
+@g56 = internal global [16 x i32] [i32 422, i32 -793, i32 -252, i32 37, i32 975, i32 15, i32 -129, i32 -757, i32 208, i32 256, i32 -387, i32 4, i32 855, i32 -802, i32 -924, i32 723], align 16
+@g57 = global %struct.rec { i32 57, i64 356206025197, double 399.0e+00, ptr null }, align 8
+@g58 = private unnamed_addr constant [15 x i8] c"kernel 58 done\00", align 1
+@g59 = global i64 0, align 8
+@g60 = internal global [16 x i32] [i32 -778, i32 905, i32 -997, i32 278, i32 645, i32 722, i32 337, i32 -928, i32 -849, i32 -941, i32 956, i32 336, i32 442, i32 -644, i32 576, i32 -413], align 16
+@g61 = global %struct.rec { i32 61, i64 272591414865, double 237.0e+00, ptr null }, align 8
+@g62 = private unnamed_addr constant [15 x i8] c"kernel 62 done\00", align 1
+@g63 = global i64 0, align 8
+
+declare i32 @printf(ptr noundef, ...)
+declare double @llvm.fmuladd.f64(double, double, double)
+declare i32 @llvm.umin.i32(i32, i32)
+declare void @llvm.lifetime.start.p0(i64 immarg, ptr nocapture)
+declare void @llvm.lifetime.end.p0(i64 immarg, ptr nocapture)
+
+define i64 @kernel_0(ptr noalias %recs, i32 %n) !dbg !27 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !28
+  %nw2 = zext i32 %n to i64, !dbg !29
+  br i1 %c1, label %loop, label %exit, !dbg !30
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !31
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !32
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !33
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !34
+  %c7 = icmp slt i32 %a4, 52, !dbg !35
+  br i1 %c7, label %then, label %else, !dbg !36
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !37
+  %y9 = xor i64 %x8, %b6, !dbg !38
+  br label %latch, !dbg !39
+
+else:
+  %z10 = add nsw i64 %b6, 30, !dbg !40
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !41
+  br label %latch, !dbg !42
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !43
+  %i.next = add nuw nsw i64 %i, 1, !dbg !44
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !45
+  br i1 %d12, label %exit, label %loop, !dbg !46, !llvm.loop !47
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !48
+}
+
+define void @kernel_1(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !49 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !50
+  br i1 %c1, label %outer, label %exit, !dbg !51
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !52
+  br label %inner, !dbg !53
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !54
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !55
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !56
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !57
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !58
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !59
+  %j.next = add nuw nsw i64 %j, 1, !dbg !60
+  %d8 = icmp eq i64 %j.next, %n, !dbg !61
+  br i1 %d8, label %outer.latch, label %inner, !dbg !62
+
+outer.latch:
+  %sc9 = fmul double %s.next, 4.500000e+00, !dbg !63
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !64
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !65
+  %i.next = add nuw nsw i64 %i, 1, !dbg !66
+  %d11 = icmp eq i64 %i.next, %n, !dbg !67
+  br i1 %d11, label %exit, label %outer, !dbg !68
+
+exit:
+  ret void, !dbg !69
+}
+
+define i32 @kernel_2(i32 %op, i32 %x) !dbg !70 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+    i32 3, label %case3
+  ], !dbg !71
+
+case0:
+  %r1 = lshr i32 %x, 2, !dbg !72
+  br label %join, !dbg !73
+
+case1:
+  %r2 = mul i32 %x, 11, !dbg !74
+  br label %join, !dbg !75
+
+case2:
+  %r3 = or i32 %x, 4, !dbg !76
+  br label %join, !dbg !77
+
+case3:
+  %r4 = add nsw i32 %x, 8, !dbg !78
+  br label %join, !dbg !79
+
+default:
+  %p5 = getelementptr inbounds [16 x i32], ptr @g44, i64 0, i64 15, !dbg !80
+  %l6 = load i32, ptr %p5, align 4, !tbaa !19, !dbg !81
+  %u7 = call i32 @llvm.umin.i32(i32 %l6, i32 %x), !dbg !82
+  br label %join, !dbg !83
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %r4, %case3 ], [ %u7, %default ]
+  ret i32 %res, !dbg !84
+}
+
+define <4 x i32> @kernel_3(<4 x i32> %v, i32 %s) !dbg !85 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !86
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !87
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !88
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !89
+  %w3 = and <4 x i32> %v, %bc2, !dbg !90
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !91
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !92
+  %w6 = xor <4 x i32> %w3, %bc5, !dbg !93
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !94
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !95
+  %w9 = or <4 x i32> %w6, %bc8, !dbg !96
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !97
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !98
+  %w12 = mul <4 x i32> %w9, %bc11, !dbg !99
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !100
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !101
+  %w15 = add <4 x i32> %w12, %bc14, !dbg !102
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !103
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !104
+  %w18 = or <4 x i32> %w15, %bc17, !dbg !105
+  %sp19 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !106
+  %bc20 = shufflevector <4 x i32> %sp19, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !107
+  %w21 = add <4 x i32> %w18, %bc20, !dbg !108
+  %sp22 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !109
+  %bc23 = shufflevector <4 x i32> %sp22, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !110
+  %w24 = xor <4 x i32> %w21, %bc23, !dbg !111
+  %sp25 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !112
+  %bc26 = shufflevector <4 x i32> %sp25, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !113
+  %w27 = xor <4 x i32> %w24, %bc26, !dbg !114
+  %sp28 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !115
+  %bc29 = shufflevector <4 x i32> %sp28, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !116
+  %w30 = xor <4 x i32> %w27, %bc29, !dbg !117
+  store <4 x i32> %w30, ptr %buf, align 16, !tbaa !19, !dbg !118
+  %e31 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 2, !dbg !119
+  %l32 = load i32, ptr %e31, align 4, !tbaa !19, !dbg !120
+  %r33 = insertelement <4 x i32> %w30, i32 %l32, i64 3, !dbg !121
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !122
+  ret <4 x i32> %r33, !dbg !123
+}
+
+define i64 @kernel_4(ptr %grid) !dbg !124 {
+entry:
+  br label %walk, !dbg !125
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !126
+  br i1 %c1, label %done, label %body, !dbg !127
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !128
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !129
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !130
+  %r5 = call i64 @kernel_0(ptr %pr2, i32 %n4), !dbg !131
+  %a6 = add i64 %tot, %r5, !dbg !132
+  store i64 %a6, ptr @g7, align 8, !tbaa !20, !dbg !133
+  %tot.next = add i64 %a6, 1, !dbg !134
+  %pp7 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !135
+  %nextg = load ptr, ptr %pp7, align 8, !tbaa !22, !dbg !136
+  br label %walk, !dbg !137
+
+done:
+  %pc8 = call i32 (ptr, ...) @printf(ptr @g46), !dbg !138
+  ret i64 %tot, !dbg !139
+}
+
+define i64 @kernel_5(ptr noalias %recs, i32 %n) !dbg !140 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !141
+  %nw2 = zext i32 %n to i64, !dbg !142
+  br i1 %c1, label %loop, label %exit, !dbg !143
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !144
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !145
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !146
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !147
+  %c7 = icmp slt i32 %a4, 17, !dbg !148
+  br i1 %c7, label %then, label %else, !dbg !149
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !150
+  %y9 = mul i64 %x8, %b6, !dbg !151
+  br label %latch, !dbg !152
+
+else:
+  %z10 = or i64 %b6, 18, !dbg !153
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !154
+  br label %latch, !dbg !155
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !156
+  %i.next = add nuw nsw i64 %i, 1, !dbg !157
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !158
+  br i1 %d12, label %exit, label %loop, !dbg !159, !llvm.loop !160
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !161
+}
+
+define void @kernel_6(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !162 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !163
+  br i1 %c1, label %outer, label %exit, !dbg !164
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !165
+  br label %inner, !dbg !166
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !167
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !168
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !169
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !170
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !171
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !172
+  %j.next = add nuw nsw i64 %j, 1, !dbg !173
+  %d8 = icmp eq i64 %j.next, %n, !dbg !174
+  br i1 %d8, label %outer.latch, label %inner, !dbg !175
+
+outer.latch:
+  %sc9 = fmul double %s.next, 7.500000e+00, !dbg !176
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !177
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !178
+  %i.next = add nuw nsw i64 %i, 1, !dbg !179
+  %d11 = icmp eq i64 %i.next, %n, !dbg !180
+  br i1 %d11, label %exit, label %outer, !dbg !181
+
+exit:
+  ret void, !dbg !182
+}
+
+define i32 @kernel_7(i32 %op, i32 %x) !dbg !183 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+  ], !dbg !184
+
+case0:
+  %r1 = shl i32 %x, 8, !dbg !185
+  br label %join, !dbg !186
+
+case1:
+  %r2 = mul i32 %x, 3, !dbg !187
+  br label %join, !dbg !188
+
+case2:
+  %r3 = shl i32 %x, 5, !dbg !189
+  br label %join, !dbg !190
+
+default:
+  %p4 = getelementptr inbounds [16 x i32], ptr @g4, i64 0, i64 7, !dbg !191
+  %l5 = load i32, ptr %p4, align 4, !tbaa !19, !dbg !192
+  %u6 = call i32 @llvm.umin.i32(i32 %l5, i32 %x), !dbg !193
+  br label %join, !dbg !194
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %u6, %default ]
+  ret i32 %res, !dbg !195
+}
+
+define <4 x i32> @kernel_8(<4 x i32> %v, i32 %s) !dbg !196 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !197
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !198
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !199
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !200
+  %w3 = add <4 x i32> %v, %bc2, !dbg !201
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !202
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !203
+  %w6 = or <4 x i32> %w3, %bc5, !dbg !204
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !205
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !206
+  %w9 = or <4 x i32> %w6, %bc8, !dbg !207
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !208
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !209
+  %w12 = and <4 x i32> %w9, %bc11, !dbg !210
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !211
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !212
+  %w15 = and <4 x i32> %w12, %bc14, !dbg !213
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !214
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !215
+  %w18 = mul <4 x i32> %w15, %bc17, !dbg !216
+  %sp19 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !217
+  %bc20 = shufflevector <4 x i32> %sp19, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !218
+  %w21 = add <4 x i32> %w18, %bc20, !dbg !219
+  %sp22 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !220
+  %bc23 = shufflevector <4 x i32> %sp22, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !221
+  %w24 = or <4 x i32> %w21, %bc23, !dbg !222
+  %sp25 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !223
+  %bc26 = shufflevector <4 x i32> %sp25, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !224
+  %w27 = xor <4 x i32> %w24, %bc26, !dbg !225
+  %sp28 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !226
+  %bc29 = shufflevector <4 x i32> %sp28, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !227
+  %w30 = xor <4 x i32> %w27, %bc29, !dbg !228
+  %sp31 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !229
+  %bc32 = shufflevector <4 x i32> %sp31, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !230
+  %w33 = mul <4 x i32> %w30, %bc32, !dbg !231
+  %sp34 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !232
+  %bc35 = shufflevector <4 x i32> %sp34, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !233
+  %w36 = xor <4 x i32> %w33, %bc35, !dbg !234
+  %sp37 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !235
+  %bc38 = shufflevector <4 x i32> %sp37, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !236
+  %w39 = and <4 x i32> %w36, %bc38, !dbg !237
+  %sp40 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !238
+  %bc41 = shufflevector <4 x i32> %sp40, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !239
+  %w42 = xor <4 x i32> %w39, %bc41, !dbg !240
+  store <4 x i32> %w42, ptr %buf, align 16, !tbaa !19, !dbg !241
+  %e43 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 3, !dbg !242
+  %l44 = load i32, ptr %e43, align 4, !tbaa !19, !dbg !243
+  %r45 = insertelement <4 x i32> %w42, i32 %l44, i64 3, !dbg !244
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !245
+  ret <4 x i32> %r45, !dbg !246
+}
+
+define i64 @kernel_9(ptr %grid) !dbg !247 {
+entry:
+  br label %walk, !dbg !248
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !249
+  br i1 %c1, label %done, label %body, !dbg !250
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !251
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !252
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !253
+  %r5 = call i64 @kernel_5(ptr %pr2, i32 %n4), !dbg !254
+  %a6 = add i64 %tot, %r5, !dbg !255
+  %r7 = call i64 @kernel_0(ptr %pr2, i32 %n4), !dbg !256
+  %a8 = add i64 %a6, %r7, !dbg !257
+  store i64 %a8, ptr @g35, align 8, !tbaa !20, !dbg !258
+  %tot.next = add i64 %a8, 1, !dbg !259
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !260
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !261
+  br label %walk, !dbg !262
+
+done:
+  ret i64 %tot, !dbg !263
+}
+
+define i64 @kernel_10(ptr noalias %recs, i32 %n) !dbg !264 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !265
+  %nw2 = zext i32 %n to i64, !dbg !266
+  br i1 %c1, label %loop, label %exit, !dbg !267
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !268
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !269
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !270
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !271
+  %c7 = icmp slt i32 %a4, 16, !dbg !272
+  br i1 %c7, label %then, label %else, !dbg !273
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !274
+  %y9 = add nsw i64 %x8, %b6, !dbg !275
+  br label %latch, !dbg !276
+
+else:
+  %z10 = sub i64 %b6, 22, !dbg !277
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !278
+  br label %latch, !dbg !279
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !280
+  %i.next = add nuw nsw i64 %i, 1, !dbg !281
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !282
+  br i1 %d12, label %exit, label %loop, !dbg !283, !llvm.loop !284
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !285
+}
+
+define void @kernel_11(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !286 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !287
+  br i1 %c1, label %outer, label %exit, !dbg !288
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !289
+  br label %inner, !dbg !290
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !291
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !292
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !293
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !294
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !295
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !296
+  %j.next = add nuw nsw i64 %j, 1, !dbg !297
+  %d8 = icmp eq i64 %j.next, %n, !dbg !298
+  br i1 %d8, label %outer.latch, label %inner, !dbg !299
+
+outer.latch:
+  %sc9 = fmul double %s.next, 3.500000e+00, !dbg !300
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !301
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !302
+  %i.next = add nuw nsw i64 %i, 1, !dbg !303
+  %d11 = icmp eq i64 %i.next, %n, !dbg !304
+  br i1 %d11, label %exit, label %outer, !dbg !305
+
+exit:
+  ret void, !dbg !306
+}
+
+define i32 @kernel_12(i32 %op, i32 %x) !dbg !307 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+    i32 3, label %case3
+    i32 4, label %case4
+    i32 5, label %case5
+  ], !dbg !308
+
+case0:
+  %r1 = call i32 @kernel_2(i32 0, i32 %x), !dbg !309
+  br label %join, !dbg !310
+
+case1:
+  %r2 = shl i32 %x, 14, !dbg !311
+  br label %join, !dbg !312
+
+case2:
+  %r3 = xor i32 %x, 9, !dbg !313
+  br label %join, !dbg !314
+
+case3:
+  %r4 = lshr i32 %x, 15, !dbg !315
+  br label %join, !dbg !316
+
+case4:
+  %r5 = call i32 @kernel_2(i32 4, i32 %x), !dbg !317
+  br label %join, !dbg !318
+
+case5:
+  %r6 = call i32 @kernel_2(i32 5, i32 %x), !dbg !319
+  br label %join, !dbg !320
+
+default:
+  %p7 = getelementptr inbounds [16 x i32], ptr @g48, i64 0, i64 4, !dbg !321
+  %l8 = load i32, ptr %p7, align 4, !tbaa !19, !dbg !322
+  %u9 = call i32 @llvm.umin.i32(i32 %l8, i32 %x), !dbg !323
+  br label %join, !dbg !324
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %r4, %case3 ], [ %r5, %case4 ], [ %r6, %case5 ], [ %u9, %default ]
+  ret i32 %res, !dbg !325
+}
+
+define <4 x i32> @kernel_13(<4 x i32> %v, i32 %s) !dbg !326 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !327
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !328
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !329
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !330
+  %w3 = add <4 x i32> %v, %bc2, !dbg !331
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !332
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !333
+  %w6 = mul <4 x i32> %w3, %bc5, !dbg !334
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !335
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !336
+  %w9 = add <4 x i32> %w6, %bc8, !dbg !337
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !338
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !339
+  %w12 = or <4 x i32> %w9, %bc11, !dbg !340
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !341
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !342
+  %w15 = or <4 x i32> %w12, %bc14, !dbg !343
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !344
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !345
+  %w18 = mul <4 x i32> %w15, %bc17, !dbg !346
+  %sp19 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !347
+  %bc20 = shufflevector <4 x i32> %sp19, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !348
+  %w21 = mul <4 x i32> %w18, %bc20, !dbg !349
+  %sp22 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !350
+  %bc23 = shufflevector <4 x i32> %sp22, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !351
+  %w24 = add <4 x i32> %w21, %bc23, !dbg !352
+  %sp25 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !353
+  %bc26 = shufflevector <4 x i32> %sp25, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !354
+  %w27 = mul <4 x i32> %w24, %bc26, !dbg !355
+  %sp28 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !356
+  %bc29 = shufflevector <4 x i32> %sp28, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !357
+  %w30 = xor <4 x i32> %w27, %bc29, !dbg !358
+  %sp31 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !359
+  %bc32 = shufflevector <4 x i32> %sp31, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !360
+  %w33 = xor <4 x i32> %w30, %bc32, !dbg !361
+  %sp34 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !362
+  %bc35 = shufflevector <4 x i32> %sp34, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !363
+  %w36 = xor <4 x i32> %w33, %bc35, !dbg !364
+  %sp37 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !365
+  %bc38 = shufflevector <4 x i32> %sp37, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !366
+  %w39 = add <4 x i32> %w36, %bc38, !dbg !367
+  store <4 x i32> %w39, ptr %buf, align 16, !tbaa !19, !dbg !368
+  %e40 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 1, !dbg !369
+  %l41 = load i32, ptr %e40, align 4, !tbaa !19, !dbg !370
+  %r42 = insertelement <4 x i32> %w39, i32 %l41, i64 3, !dbg !371
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !372
+  ret <4 x i32> %r42, !dbg !373
+}
+
+define i64 @kernel_14(ptr %grid) !dbg !374 {
+entry:
+  br label %walk, !dbg !375
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !376
+  br i1 %c1, label %done, label %body, !dbg !377
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !378
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !379
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !380
+  %r5 = call i64 @kernel_10(ptr %pr2, i32 %n4), !dbg !381
+  %a6 = add i64 %tot, %r5, !dbg !382
+  %r7 = call i64 @kernel_5(ptr %pr2, i32 %n4), !dbg !383
+  %a8 = add i64 %a6, %r7, !dbg !384
+  store i64 %a8, ptr @g43, align 8, !tbaa !20, !dbg !385
+  %tot.next = add i64 %a8, 1, !dbg !386
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !387
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !388
+  br label %walk, !dbg !389
+
+done:
+  %pc10 = call i32 (ptr, ...) @printf(ptr @g10), !dbg !390
+  ret i64 %tot, !dbg !391
+}
+
+define i64 @kernel_15(ptr noalias %recs, i32 %n) !dbg !392 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !393
+  %nw2 = zext i32 %n to i64, !dbg !394
+  br i1 %c1, label %loop, label %exit, !dbg !395
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !396
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !397
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !398
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !399
+  %c7 = icmp slt i32 %a4, 41, !dbg !400
+  br i1 %c7, label %then, label %else, !dbg !401
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !402
+  %y9 = add nsw i64 %x8, %b6, !dbg !403
+  br label %latch, !dbg !404
+
+else:
+  %z10 = and i64 %b6, 3, !dbg !405
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !406
+  br label %latch, !dbg !407
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !408
+  %i.next = add nuw nsw i64 %i, 1, !dbg !409
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !410
+  br i1 %d12, label %exit, label %loop, !dbg !411, !llvm.loop !412
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !413
+}
+
+define void @kernel_16(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !414 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !415
+  br i1 %c1, label %outer, label %exit, !dbg !416
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !417
+  br label %inner, !dbg !418
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !419
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !420
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !421
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !422
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !423
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !424
+  %j.next = add nuw nsw i64 %j, 1, !dbg !425
+  %d8 = icmp eq i64 %j.next, %n, !dbg !426
+  br i1 %d8, label %outer.latch, label %inner, !dbg !427
+
+outer.latch:
+  %sc9 = fmul double %s.next, 2.500000e+00, !dbg !428
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !429
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !430
+  %i.next = add nuw nsw i64 %i, 1, !dbg !431
+  %d11 = icmp eq i64 %i.next, %n, !dbg !432
+  br i1 %d11, label %exit, label %outer, !dbg !433
+
+exit:
+  ret void, !dbg !434
+}
+
+define i32 @kernel_17(i32 %op, i32 %x) !dbg !435 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+    i32 3, label %case3
+    i32 4, label %case4
+    i32 5, label %case5
+    i32 6, label %case6
+  ], !dbg !436
+
+case0:
+  %r1 = call i32 @kernel_7(i32 0, i32 %x), !dbg !437
+  br label %join, !dbg !438
+
+case1:
+  %r2 = lshr i32 %x, 9, !dbg !439
+  br label %join, !dbg !440
+
+case2:
+  %r3 = lshr i32 %x, 2, !dbg !441
+  br label %join, !dbg !442
+
+case3:
+  %r4 = call i32 @kernel_12(i32 3, i32 %x), !dbg !443
+  br label %join, !dbg !444
+
+case4:
+  %r5 = call i32 @kernel_12(i32 4, i32 %x), !dbg !445
+  br label %join, !dbg !446
+
+case5:
+  %r6 = call i32 @kernel_7(i32 5, i32 %x), !dbg !447
+  br label %join, !dbg !448
+
+case6:
+  %r7 = lshr i32 %x, 9, !dbg !449
+  br label %join, !dbg !450
+
+default:
+  %p8 = getelementptr inbounds [16 x i32], ptr @g24, i64 0, i64 1, !dbg !451
+  %l9 = load i32, ptr %p8, align 4, !tbaa !19, !dbg !452
+  %u10 = call i32 @llvm.umin.i32(i32 %l9, i32 %x), !dbg !453
+  br label %join, !dbg !454
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %r4, %case3 ], [ %r5, %case4 ], [ %r6, %case5 ], [ %r7, %case6 ], [ %u10, %default ]
+  ret i32 %res, !dbg !455
+}
+
+define <4 x i32> @kernel_18(<4 x i32> %v, i32 %s) !dbg !456 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !457
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !458
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !459
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !460
+  %w3 = or <4 x i32> %v, %bc2, !dbg !461
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !462
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !463
+  %w6 = add <4 x i32> %w3, %bc5, !dbg !464
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !465
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !466
+  %w9 = add <4 x i32> %w6, %bc8, !dbg !467
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !468
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !469
+  %w12 = or <4 x i32> %w9, %bc11, !dbg !470
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !471
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !472
+  %w15 = and <4 x i32> %w12, %bc14, !dbg !473
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !474
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !475
+  %w18 = and <4 x i32> %w15, %bc17, !dbg !476
+  store <4 x i32> %w18, ptr %buf, align 16, !tbaa !19, !dbg !477
+  %e19 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 1, !dbg !478
+  %l20 = load i32, ptr %e19, align 4, !tbaa !19, !dbg !479
+  %r21 = insertelement <4 x i32> %w18, i32 %l20, i64 3, !dbg !480
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !481
+  ret <4 x i32> %r21, !dbg !482
+}
+
+define i64 @kernel_19(ptr %grid) !dbg !483 {
+entry:
+  br label %walk, !dbg !484
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !485
+  br i1 %c1, label %done, label %body, !dbg !486
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !487
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !488
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !489
+  %r5 = call i64 @kernel_10(ptr %pr2, i32 %n4), !dbg !490
+  %a6 = add i64 %tot, %r5, !dbg !491
+  %r7 = call i64 @kernel_15(ptr %pr2, i32 %n4), !dbg !492
+  %a8 = add i64 %a6, %r7, !dbg !493
+  store i64 %a8, ptr @g23, align 8, !tbaa !20, !dbg !494
+  %tot.next = add i64 %a8, 1, !dbg !495
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !496
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !497
+  br label %walk, !dbg !498
+
+done:
+  ret i64 %tot, !dbg !499
+}
+
+define i64 @kernel_20(ptr noalias %recs, i32 %n) !dbg !500 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !501
+  %nw2 = zext i32 %n to i64, !dbg !502
+  br i1 %c1, label %loop, label %exit, !dbg !503
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !504
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !505
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !506
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !507
+  %c7 = icmp slt i32 %a4, 59, !dbg !508
+  br i1 %c7, label %then, label %else, !dbg !509
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !510
+  %y9 = xor i64 %x8, %b6, !dbg !511
+  br label %latch, !dbg !512
+
+else:
+  %z10 = xor i64 %b6, 17, !dbg !513
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !514
+  br label %latch, !dbg !515
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !516
+  %i.next = add nuw nsw i64 %i, 1, !dbg !517
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !518
+  br i1 %d12, label %exit, label %loop, !dbg !519, !llvm.loop !520
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !521
+}
+
+define void @kernel_21(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !522 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !523
+  br i1 %c1, label %outer, label %exit, !dbg !524
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !525
+  br label %inner, !dbg !526
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !527
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !528
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !529
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !530
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !531
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !532
+  %j.next = add nuw nsw i64 %j, 1, !dbg !533
+  %d8 = icmp eq i64 %j.next, %n, !dbg !534
+  br i1 %d8, label %outer.latch, label %inner, !dbg !535
+
+outer.latch:
+  %sc9 = fmul double %s.next, 8.500000e+00, !dbg !536
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !537
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !538
+  %i.next = add nuw nsw i64 %i, 1, !dbg !539
+  %d11 = icmp eq i64 %i.next, %n, !dbg !540
+  br i1 %d11, label %exit, label %outer, !dbg !541
+
+exit:
+  ret void, !dbg !542
+}
+
+define i32 @kernel_22(i32 %op, i32 %x) !dbg !543 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+    i32 3, label %case3
+    i32 4, label %case4
+    i32 5, label %case5
+  ], !dbg !544
+
+case0:
+  %r1 = call i32 @kernel_17(i32 0, i32 %x), !dbg !545
+  br label %join, !dbg !546
+
+case1:
+  %r2 = call i32 @kernel_12(i32 1, i32 %x), !dbg !547
+  br label %join, !dbg !548
+
+case2:
+  %r3 = sub i32 %x, 1, !dbg !549
+  br label %join, !dbg !550
+
+case3:
+  %r4 = xor i32 %x, 11, !dbg !551
+  br label %join, !dbg !552
+
+case4:
+  %r5 = and i32 %x, 14, !dbg !553
+  br label %join, !dbg !554
+
+case5:
+  %r6 = call i32 @kernel_17(i32 5, i32 %x), !dbg !555
+  br label %join, !dbg !556
+
+default:
+  %p7 = getelementptr inbounds [16 x i32], ptr @g32, i64 0, i64 7, !dbg !557
+  %l8 = load i32, ptr %p7, align 4, !tbaa !19, !dbg !558
+  %u9 = call i32 @llvm.umin.i32(i32 %l8, i32 %x), !dbg !559
+  br label %join, !dbg !560
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %r4, %case3 ], [ %r5, %case4 ], [ %r6, %case5 ], [ %u9, %default ]
+  ret i32 %res, !dbg !561
+}
+
+define <4 x i32> @kernel_23(<4 x i32> %v, i32 %s) !dbg !562 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !563
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !564
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !565
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !566
+  %w3 = xor <4 x i32> %v, %bc2, !dbg !567
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !568
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !569
+  %w6 = and <4 x i32> %w3, %bc5, !dbg !570
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !571
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !572
+  %w9 = add <4 x i32> %w6, %bc8, !dbg !573
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !574
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !575
+  %w12 = xor <4 x i32> %w9, %bc11, !dbg !576
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !577
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !578
+  %w15 = xor <4 x i32> %w12, %bc14, !dbg !579
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !580
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !581
+  %w18 = mul <4 x i32> %w15, %bc17, !dbg !582
+  %sp19 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !583
+  %bc20 = shufflevector <4 x i32> %sp19, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !584
+  %w21 = and <4 x i32> %w18, %bc20, !dbg !585
+  store <4 x i32> %w21, ptr %buf, align 16, !tbaa !19, !dbg !586
+  %e22 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 0, !dbg !587
+  %l23 = load i32, ptr %e22, align 4, !tbaa !19, !dbg !588
+  %r24 = insertelement <4 x i32> %w21, i32 %l23, i64 3, !dbg !589
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !590
+  ret <4 x i32> %r24, !dbg !591
+}
+
+define i64 @kernel_24(ptr %grid) !dbg !592 {
+entry:
+  br label %walk, !dbg !593
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !594
+  br i1 %c1, label %done, label %body, !dbg !595
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !596
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !597
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !598
+  %r5 = call i64 @kernel_15(ptr %pr2, i32 %n4), !dbg !599
+  %a6 = add i64 %tot, %r5, !dbg !600
+  %r7 = call i64 @kernel_20(ptr %pr2, i32 %n4), !dbg !601
+  %a8 = add i64 %a6, %r7, !dbg !602
+  store i64 %a8, ptr @g43, align 8, !tbaa !20, !dbg !603
+  %tot.next = add i64 %a8, 1, !dbg !604
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !605
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !606
+  br label %walk, !dbg !607
+
+done:
+  %pc10 = call i32 (ptr, ...) @printf(ptr @g14), !dbg !608
+  ret i64 %tot, !dbg !609
+}
+
+define i64 @kernel_25(ptr noalias %recs, i32 %n) !dbg !610 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !611
+  %nw2 = zext i32 %n to i64, !dbg !612
+  br i1 %c1, label %loop, label %exit, !dbg !613
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !614
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !615
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !616
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !617
+  %c7 = icmp slt i32 %a4, 10, !dbg !618
+  br i1 %c7, label %then, label %else, !dbg !619
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !620
+  %y9 = add nsw i64 %x8, %b6, !dbg !621
+  br label %latch, !dbg !622
+
+else:
+  %z10 = add nsw i64 %b6, 31, !dbg !623
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !624
+  br label %latch, !dbg !625
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !626
+  %i.next = add nuw nsw i64 %i, 1, !dbg !627
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !628
+  br i1 %d12, label %exit, label %loop, !dbg !629, !llvm.loop !630
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !631
+}
+
+define void @kernel_26(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !632 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !633
+  br i1 %c1, label %outer, label %exit, !dbg !634
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !635
+  br label %inner, !dbg !636
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !637
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !638
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !639
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !640
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !641
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !642
+  %j.next = add nuw nsw i64 %j, 1, !dbg !643
+  %d8 = icmp eq i64 %j.next, %n, !dbg !644
+  br i1 %d8, label %outer.latch, label %inner, !dbg !645
+
+outer.latch:
+  %sc9 = fmul double %s.next, 9.500000e+00, !dbg !646
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !647
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !648
+  %i.next = add nuw nsw i64 %i, 1, !dbg !649
+  %d11 = icmp eq i64 %i.next, %n, !dbg !650
+  br i1 %d11, label %exit, label %outer, !dbg !651
+
+exit:
+  ret void, !dbg !652
+}
+
+define i32 @kernel_27(i32 %op, i32 %x) !dbg !653 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+    i32 3, label %case3
+    i32 4, label %case4
+    i32 5, label %case5
+  ], !dbg !654
+
+case0:
+  %r1 = call i32 @kernel_22(i32 0, i32 %x), !dbg !655
+  br label %join, !dbg !656
+
+case1:
+  %r2 = and i32 %x, 8, !dbg !657
+  br label %join, !dbg !658
+
+case2:
+  %r3 = call i32 @kernel_17(i32 2, i32 %x), !dbg !659
+  br label %join, !dbg !660
+
+case3:
+  %r4 = lshr i32 %x, 6, !dbg !661
+  br label %join, !dbg !662
+
+case4:
+  %r5 = lshr i32 %x, 4, !dbg !663
+  br label %join, !dbg !664
+
+case5:
+  %r6 = sub i32 %x, 8, !dbg !665
+  br label %join, !dbg !666
+
+default:
+  %p7 = getelementptr inbounds [16 x i32], ptr @g20, i64 0, i64 6, !dbg !667
+  %l8 = load i32, ptr %p7, align 4, !tbaa !19, !dbg !668
+  %u9 = call i32 @llvm.umin.i32(i32 %l8, i32 %x), !dbg !669
+  br label %join, !dbg !670
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %r4, %case3 ], [ %r5, %case4 ], [ %r6, %case5 ], [ %u9, %default ]
+  ret i32 %res, !dbg !671
+}
+
+define <4 x i32> @kernel_28(<4 x i32> %v, i32 %s) !dbg !672 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !673
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !674
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !675
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !676
+  %w3 = and <4 x i32> %v, %bc2, !dbg !677
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !678
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !679
+  %w6 = xor <4 x i32> %w3, %bc5, !dbg !680
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !681
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !682
+  %w9 = add <4 x i32> %w6, %bc8, !dbg !683
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !684
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !685
+  %w12 = mul <4 x i32> %w9, %bc11, !dbg !686
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !687
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !688
+  %w15 = or <4 x i32> %w12, %bc14, !dbg !689
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !690
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !691
+  %w18 = add <4 x i32> %w15, %bc17, !dbg !692
+  %sp19 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !693
+  %bc20 = shufflevector <4 x i32> %sp19, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !694
+  %w21 = add <4 x i32> %w18, %bc20, !dbg !695
+  %sp22 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !696
+  %bc23 = shufflevector <4 x i32> %sp22, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !697
+  %w24 = add <4 x i32> %w21, %bc23, !dbg !698
+  store <4 x i32> %w24, ptr %buf, align 16, !tbaa !19, !dbg !699
+  %e25 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 1, !dbg !700
+  %l26 = load i32, ptr %e25, align 4, !tbaa !19, !dbg !701
+  %r27 = insertelement <4 x i32> %w24, i32 %l26, i64 3, !dbg !702
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !703
+  ret <4 x i32> %r27, !dbg !704
+}
+
+define i64 @kernel_29(ptr %grid) !dbg !705 {
+entry:
+  br label %walk, !dbg !706
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !707
+  br i1 %c1, label %done, label %body, !dbg !708
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !709
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !710
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !711
+  %r5 = call i64 @kernel_25(ptr %pr2, i32 %n4), !dbg !712
+  %a6 = add i64 %tot, %r5, !dbg !713
+  %r7 = call i64 @kernel_20(ptr %pr2, i32 %n4), !dbg !714
+  %a8 = add i64 %a6, %r7, !dbg !715
+  store i64 %a8, ptr @g7, align 8, !tbaa !20, !dbg !716
+  %tot.next = add i64 %a8, 1, !dbg !717
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !718
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !719
+  br label %walk, !dbg !720
+
+done:
+  ret i64 %tot, !dbg !721
+}
+
+define i64 @kernel_30(ptr noalias %recs, i32 %n) !dbg !722 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !723
+  %nw2 = zext i32 %n to i64, !dbg !724
+  br i1 %c1, label %loop, label %exit, !dbg !725
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !726
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !727
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !728
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !729
+  %c7 = icmp slt i32 %a4, 52, !dbg !730
+  br i1 %c7, label %then, label %else, !dbg !731
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !732
+  %y9 = and i64 %x8, %b6, !dbg !733
+  br label %latch, !dbg !734
+
+else:
+  %z10 = or i64 %b6, 10, !dbg !735
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !736
+  br label %latch, !dbg !737
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !738
+  %i.next = add nuw nsw i64 %i, 1, !dbg !739
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !740
+  br i1 %d12, label %exit, label %loop, !dbg !741, !llvm.loop !742
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !743
+}
+
+define void @kernel_31(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !744 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !745
+  br i1 %c1, label %outer, label %exit, !dbg !746
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !747
+  br label %inner, !dbg !748
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !749
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !750
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !751
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !752
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !753
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !754
+  %j.next = add nuw nsw i64 %j, 1, !dbg !755
+  %d8 = icmp eq i64 %j.next, %n, !dbg !756
+  br i1 %d8, label %outer.latch, label %inner, !dbg !757
+
+outer.latch:
+  %sc9 = fmul double %s.next, 6.500000e+00, !dbg !758
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !759
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !760
+  %i.next = add nuw nsw i64 %i, 1, !dbg !761
+  %d11 = icmp eq i64 %i.next, %n, !dbg !762
+  br i1 %d11, label %exit, label %outer, !dbg !763
+
+exit:
+  ret void, !dbg !764
+}
+
+define i32 @kernel_32(i32 %op, i32 %x) !dbg !765 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+    i32 3, label %case3
+    i32 4, label %case4
+    i32 5, label %case5
+  ], !dbg !766
+
+case0:
+  %r1 = call i32 @kernel_27(i32 0, i32 %x), !dbg !767
+  br label %join, !dbg !768
+
+case1:
+  %r2 = xor i32 %x, 9, !dbg !769
+  br label %join, !dbg !770
+
+case2:
+  %r3 = call i32 @kernel_22(i32 2, i32 %x), !dbg !771
+  br label %join, !dbg !772
+
+case3:
+  %r4 = call i32 @kernel_22(i32 3, i32 %x), !dbg !773
+  br label %join, !dbg !774
+
+case4:
+  %r5 = mul i32 %x, 5, !dbg !775
+  br label %join, !dbg !776
+
+case5:
+  %r6 = call i32 @kernel_27(i32 5, i32 %x), !dbg !777
+  br label %join, !dbg !778
+
+default:
+  %p7 = getelementptr inbounds [16 x i32], ptr @g40, i64 0, i64 6, !dbg !779
+  %l8 = load i32, ptr %p7, align 4, !tbaa !19, !dbg !780
+  %u9 = call i32 @llvm.umin.i32(i32 %l8, i32 %x), !dbg !781
+  br label %join, !dbg !782
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %r4, %case3 ], [ %r5, %case4 ], [ %r6, %case5 ], [ %u9, %default ]
+  ret i32 %res, !dbg !783
+}
+
+define <4 x i32> @kernel_33(<4 x i32> %v, i32 %s) !dbg !784 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !785
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !786
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !787
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !788
+  %w3 = mul <4 x i32> %v, %bc2, !dbg !789
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !790
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !791
+  %w6 = xor <4 x i32> %w3, %bc5, !dbg !792
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !793
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !794
+  %w9 = or <4 x i32> %w6, %bc8, !dbg !795
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !796
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !797
+  %w12 = xor <4 x i32> %w9, %bc11, !dbg !798
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !799
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !800
+  %w15 = add <4 x i32> %w12, %bc14, !dbg !801
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !802
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !803
+  %w18 = mul <4 x i32> %w15, %bc17, !dbg !804
+  store <4 x i32> %w18, ptr %buf, align 16, !tbaa !19, !dbg !805
+  %e19 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 3, !dbg !806
+  %l20 = load i32, ptr %e19, align 4, !tbaa !19, !dbg !807
+  %r21 = insertelement <4 x i32> %w18, i32 %l20, i64 3, !dbg !808
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !809
+  ret <4 x i32> %r21, !dbg !810
+}
+
+define i64 @kernel_34(ptr %grid) !dbg !811 {
+entry:
+  br label %walk, !dbg !812
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !813
+  br i1 %c1, label %done, label %body, !dbg !814
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !815
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !816
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !817
+  %r5 = call i64 @kernel_25(ptr %pr2, i32 %n4), !dbg !818
+  %a6 = add i64 %tot, %r5, !dbg !819
+  %r7 = call i64 @kernel_30(ptr %pr2, i32 %n4), !dbg !820
+  %a8 = add i64 %a6, %r7, !dbg !821
+  store i64 %a8, ptr @g23, align 8, !tbaa !20, !dbg !822
+  %tot.next = add i64 %a8, 1, !dbg !823
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !824
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !825
+  br label %walk, !dbg !826
+
+done:
+  %pc10 = call i32 (ptr, ...) @printf(ptr @g14), !dbg !827
+  ret i64 %tot, !dbg !828
+}
+
+define i64 @kernel_35(ptr noalias %recs, i32 %n) !dbg !829 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !830
+  %nw2 = zext i32 %n to i64, !dbg !831
+  br i1 %c1, label %loop, label %exit, !dbg !832
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !833
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !834
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !835
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !836
+  %c7 = icmp slt i32 %a4, 61, !dbg !837
+  br i1 %c7, label %then, label %else, !dbg !838
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !839
+  %y9 = add nsw i64 %x8, %b6, !dbg !840
+  br label %latch, !dbg !841
+
+else:
+  %z10 = xor i64 %b6, 11, !dbg !842
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !843
+  br label %latch, !dbg !844
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !845
+  %i.next = add nuw nsw i64 %i, 1, !dbg !846
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !847
+  br i1 %d12, label %exit, label %loop, !dbg !848, !llvm.loop !849
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !850
+}
+
+define void @kernel_36(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !851 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !852
+  br i1 %c1, label %outer, label %exit, !dbg !853
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !854
+  br label %inner, !dbg !855
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !856
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !857
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !858
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !859
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !860
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !861
+  %j.next = add nuw nsw i64 %j, 1, !dbg !862
+  %d8 = icmp eq i64 %j.next, %n, !dbg !863
+  br i1 %d8, label %outer.latch, label %inner, !dbg !864
+
+outer.latch:
+  %sc9 = fmul double %s.next, 2.500000e+00, !dbg !865
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !866
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !867
+  %i.next = add nuw nsw i64 %i, 1, !dbg !868
+  %d11 = icmp eq i64 %i.next, %n, !dbg !869
+  br i1 %d11, label %exit, label %outer, !dbg !870
+
+exit:
+  ret void, !dbg !871
+}
+
+define i32 @kernel_37(i32 %op, i32 %x) !dbg !872 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+    i32 3, label %case3
+    i32 4, label %case4
+    i32 5, label %case5
+  ], !dbg !873
+
+case0:
+  %r1 = call i32 @kernel_27(i32 0, i32 %x), !dbg !874
+  br label %join, !dbg !875
+
+case1:
+  %r2 = call i32 @kernel_32(i32 1, i32 %x), !dbg !876
+  br label %join, !dbg !877
+
+case2:
+  %r3 = call i32 @kernel_32(i32 2, i32 %x), !dbg !878
+  br label %join, !dbg !879
+
+case3:
+  %r4 = call i32 @kernel_32(i32 3, i32 %x), !dbg !880
+  br label %join, !dbg !881
+
+case4:
+  %r5 = call i32 @kernel_32(i32 4, i32 %x), !dbg !882
+  br label %join, !dbg !883
+
+case5:
+  %r6 = call i32 @kernel_32(i32 5, i32 %x), !dbg !884
+  br label %join, !dbg !885
+
+default:
+  %p7 = getelementptr inbounds [16 x i32], ptr @g24, i64 0, i64 4, !dbg !886
+  %l8 = load i32, ptr %p7, align 4, !tbaa !19, !dbg !887
+  %u9 = call i32 @llvm.umin.i32(i32 %l8, i32 %x), !dbg !888
+  br label %join, !dbg !889
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %r4, %case3 ], [ %r5, %case4 ], [ %r6, %case5 ], [ %u9, %default ]
+  ret i32 %res, !dbg !890
+}
+
+define <4 x i32> @kernel_38(<4 x i32> %v, i32 %s) !dbg !891 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !892
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !893
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !894
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !895
+  %w3 = and <4 x i32> %v, %bc2, !dbg !896
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !897
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !898
+  %w6 = or <4 x i32> %w3, %bc5, !dbg !899
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !900
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !901
+  %w9 = or <4 x i32> %w6, %bc8, !dbg !902
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !903
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !904
+  %w12 = xor <4 x i32> %w9, %bc11, !dbg !905
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !906
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !907
+  %w15 = or <4 x i32> %w12, %bc14, !dbg !908
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !909
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !910
+  %w18 = add <4 x i32> %w15, %bc17, !dbg !911
+  %sp19 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !912
+  %bc20 = shufflevector <4 x i32> %sp19, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !913
+  %w21 = or <4 x i32> %w18, %bc20, !dbg !914
+  %sp22 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !915
+  %bc23 = shufflevector <4 x i32> %sp22, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !916
+  %w24 = xor <4 x i32> %w21, %bc23, !dbg !917
+  %sp25 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !918
+  %bc26 = shufflevector <4 x i32> %sp25, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !919
+  %w27 = xor <4 x i32> %w24, %bc26, !dbg !920
+  %sp28 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !921
+  %bc29 = shufflevector <4 x i32> %sp28, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !922
+  %w30 = or <4 x i32> %w27, %bc29, !dbg !923
+  %sp31 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !924
+  %bc32 = shufflevector <4 x i32> %sp31, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !925
+  %w33 = xor <4 x i32> %w30, %bc32, !dbg !926
+  %sp34 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !927
+  %bc35 = shufflevector <4 x i32> %sp34, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !928
+  %w36 = mul <4 x i32> %w33, %bc35, !dbg !929
+  store <4 x i32> %w36, ptr %buf, align 16, !tbaa !19, !dbg !930
+  %e37 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 1, !dbg !931
+  %l38 = load i32, ptr %e37, align 4, !tbaa !19, !dbg !932
+  %r39 = insertelement <4 x i32> %w36, i32 %l38, i64 3, !dbg !933
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !934
+  ret <4 x i32> %r39, !dbg !935
+}
+
+define i64 @kernel_39(ptr %grid) !dbg !936 {
+entry:
+  br label %walk, !dbg !937
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !938
+  br i1 %c1, label %done, label %body, !dbg !939
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !940
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !941
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !942
+  %r5 = call i64 @kernel_35(ptr %pr2, i32 %n4), !dbg !943
+  %a6 = add i64 %tot, %r5, !dbg !944
+  %r7 = call i64 @kernel_30(ptr %pr2, i32 %n4), !dbg !945
+  %a8 = add i64 %a6, %r7, !dbg !946
+  store i64 %a8, ptr @g15, align 8, !tbaa !20, !dbg !947
+  %tot.next = add i64 %a8, 1, !dbg !948
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !949
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !950
+  br label %walk, !dbg !951
+
+done:
+  ret i64 %tot, !dbg !952
+}
+
+define i64 @kernel_40(ptr noalias %recs, i32 %n) !dbg !953 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !954
+  %nw2 = zext i32 %n to i64, !dbg !955
+  br i1 %c1, label %loop, label %exit, !dbg !956
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !957
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !958
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !959
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !960
+  %c7 = icmp slt i32 %a4, 54, !dbg !961
+  br i1 %c7, label %then, label %else, !dbg !962
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !963
+  %y9 = mul i64 %x8, %b6, !dbg !964
+  br label %latch, !dbg !965
+
+else:
+  %z10 = sub i64 %b6, 9, !dbg !966
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !967
+  br label %latch, !dbg !968
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !969
+  %i.next = add nuw nsw i64 %i, 1, !dbg !970
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !971
+  br i1 %d12, label %exit, label %loop, !dbg !972, !llvm.loop !973
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !974
+}
+
+define void @kernel_41(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !975 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !976
+  br i1 %c1, label %outer, label %exit, !dbg !977
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !978
+  br label %inner, !dbg !979
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !980
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !981
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !982
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !983
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !984
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !985
+  %j.next = add nuw nsw i64 %j, 1, !dbg !986
+  %d8 = icmp eq i64 %j.next, %n, !dbg !987
+  br i1 %d8, label %outer.latch, label %inner, !dbg !988
+
+outer.latch:
+  %sc9 = fmul double %s.next, 5.500000e+00, !dbg !989
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !990
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !991
+  %i.next = add nuw nsw i64 %i, 1, !dbg !992
+  %d11 = icmp eq i64 %i.next, %n, !dbg !993
+  br i1 %d11, label %exit, label %outer, !dbg !994
+
+exit:
+  ret void, !dbg !995
+}
+
+define i32 @kernel_42(i32 %op, i32 %x) !dbg !996 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+    i32 3, label %case3
+    i32 4, label %case4
+  ], !dbg !997
+
+case0:
+  %r1 = call i32 @kernel_32(i32 0, i32 %x), !dbg !998
+  br label %join, !dbg !999
+
+case1:
+  %r2 = call i32 @kernel_37(i32 1, i32 %x), !dbg !1000
+  br label %join, !dbg !1001
+
+case2:
+  %r3 = add nsw i32 %x, 12, !dbg !1002
+  br label %join, !dbg !1003
+
+case3:
+  %r4 = call i32 @kernel_32(i32 3, i32 %x), !dbg !1004
+  br label %join, !dbg !1005
+
+case4:
+  %r5 = add nsw i32 %x, 12, !dbg !1006
+  br label %join, !dbg !1007
+
+default:
+  %p6 = getelementptr inbounds [16 x i32], ptr @g40, i64 0, i64 12, !dbg !1008
+  %l7 = load i32, ptr %p6, align 4, !tbaa !19, !dbg !1009
+  %u8 = call i32 @llvm.umin.i32(i32 %l7, i32 %x), !dbg !1010
+  br label %join, !dbg !1011
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %r4, %case3 ], [ %r5, %case4 ], [ %u8, %default ]
+  ret i32 %res, !dbg !1012
+}
+
+define <4 x i32> @kernel_43(<4 x i32> %v, i32 %s) !dbg !1013 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !1014
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !1015
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1016
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1017
+  %w3 = and <4 x i32> %v, %bc2, !dbg !1018
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1019
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1020
+  %w6 = mul <4 x i32> %w3, %bc5, !dbg !1021
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1022
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1023
+  %w9 = mul <4 x i32> %w6, %bc8, !dbg !1024
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1025
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1026
+  %w12 = mul <4 x i32> %w9, %bc11, !dbg !1027
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1028
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1029
+  %w15 = or <4 x i32> %w12, %bc14, !dbg !1030
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1031
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1032
+  %w18 = mul <4 x i32> %w15, %bc17, !dbg !1033
+  %sp19 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1034
+  %bc20 = shufflevector <4 x i32> %sp19, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1035
+  %w21 = xor <4 x i32> %w18, %bc20, !dbg !1036
+  store <4 x i32> %w21, ptr %buf, align 16, !tbaa !19, !dbg !1037
+  %e22 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 2, !dbg !1038
+  %l23 = load i32, ptr %e22, align 4, !tbaa !19, !dbg !1039
+  %r24 = insertelement <4 x i32> %w21, i32 %l23, i64 3, !dbg !1040
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !1041
+  ret <4 x i32> %r24, !dbg !1042
+}
+
+define i64 @kernel_44(ptr %grid) !dbg !1043 {
+entry:
+  br label %walk, !dbg !1044
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !1045
+  br i1 %c1, label %done, label %body, !dbg !1046
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !1047
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !1048
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !1049
+  %r5 = call i64 @kernel_40(ptr %pr2, i32 %n4), !dbg !1050
+  %a6 = add i64 %tot, %r5, !dbg !1051
+  %r7 = call i64 @kernel_35(ptr %pr2, i32 %n4), !dbg !1052
+  %a8 = add i64 %a6, %r7, !dbg !1053
+  store i64 %a8, ptr @g63, align 8, !tbaa !20, !dbg !1054
+  %tot.next = add i64 %a8, 1, !dbg !1055
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !1056
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !1057
+  br label %walk, !dbg !1058
+
+done:
+  %pc10 = call i32 (ptr, ...) @printf(ptr @g30), !dbg !1059
+  ret i64 %tot, !dbg !1060
+}
+
+define i64 @kernel_45(ptr noalias %recs, i32 %n) !dbg !1061 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !1062
+  %nw2 = zext i32 %n to i64, !dbg !1063
+  br i1 %c1, label %loop, label %exit, !dbg !1064
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !1065
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !1066
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !1067
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !1068
+  %c7 = icmp slt i32 %a4, 22, !dbg !1069
+  br i1 %c7, label %then, label %else, !dbg !1070
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !1071
+  %y9 = add nsw i64 %x8, %b6, !dbg !1072
+  br label %latch, !dbg !1073
+
+else:
+  %z10 = mul i64 %b6, 29, !dbg !1074
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !1075
+  br label %latch, !dbg !1076
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !1077
+  %i.next = add nuw nsw i64 %i, 1, !dbg !1078
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !1079
+  br i1 %d12, label %exit, label %loop, !dbg !1080, !llvm.loop !1081
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !1082
+}
+
+define void @kernel_46(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !1083 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !1084
+  br i1 %c1, label %outer, label %exit, !dbg !1085
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !1086
+  br label %inner, !dbg !1087
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !1088
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !1089
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !1090
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !1091
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !1092
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !1093
+  %j.next = add nuw nsw i64 %j, 1, !dbg !1094
+  %d8 = icmp eq i64 %j.next, %n, !dbg !1095
+  br i1 %d8, label %outer.latch, label %inner, !dbg !1096
+
+outer.latch:
+  %sc9 = fmul double %s.next, 9.500000e+00, !dbg !1097
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !1098
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !1099
+  %i.next = add nuw nsw i64 %i, 1, !dbg !1100
+  %d11 = icmp eq i64 %i.next, %n, !dbg !1101
+  br i1 %d11, label %exit, label %outer, !dbg !1102
+
+exit:
+  ret void, !dbg !1103
+}
+
+define i32 @kernel_47(i32 %op, i32 %x) !dbg !1104 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+    i32 3, label %case3
+    i32 4, label %case4
+  ], !dbg !1105
+
+case0:
+  %r1 = call i32 @kernel_37(i32 0, i32 %x), !dbg !1106
+  br label %join, !dbg !1107
+
+case1:
+  %r2 = sub i32 %x, 8, !dbg !1108
+  br label %join, !dbg !1109
+
+case2:
+  %r3 = shl i32 %x, 4, !dbg !1110
+  br label %join, !dbg !1111
+
+case3:
+  %r4 = call i32 @kernel_42(i32 3, i32 %x), !dbg !1112
+  br label %join, !dbg !1113
+
+case4:
+  %r5 = call i32 @kernel_37(i32 4, i32 %x), !dbg !1114
+  br label %join, !dbg !1115
+
+default:
+  %p6 = getelementptr inbounds [16 x i32], ptr @g24, i64 0, i64 9, !dbg !1116
+  %l7 = load i32, ptr %p6, align 4, !tbaa !19, !dbg !1117
+  %u8 = call i32 @llvm.umin.i32(i32 %l7, i32 %x), !dbg !1118
+  br label %join, !dbg !1119
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %r4, %case3 ], [ %r5, %case4 ], [ %u8, %default ]
+  ret i32 %res, !dbg !1120
+}
+
+define <4 x i32> @kernel_48(<4 x i32> %v, i32 %s) !dbg !1121 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !1122
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !1123
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1124
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1125
+  %w3 = add <4 x i32> %v, %bc2, !dbg !1126
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1127
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1128
+  %w6 = add <4 x i32> %w3, %bc5, !dbg !1129
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1130
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1131
+  %w9 = or <4 x i32> %w6, %bc8, !dbg !1132
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1133
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1134
+  %w12 = mul <4 x i32> %w9, %bc11, !dbg !1135
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1136
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1137
+  %w15 = mul <4 x i32> %w12, %bc14, !dbg !1138
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1139
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1140
+  %w18 = xor <4 x i32> %w15, %bc17, !dbg !1141
+  %sp19 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1142
+  %bc20 = shufflevector <4 x i32> %sp19, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1143
+  %w21 = xor <4 x i32> %w18, %bc20, !dbg !1144
+  %sp22 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1145
+  %bc23 = shufflevector <4 x i32> %sp22, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1146
+  %w24 = and <4 x i32> %w21, %bc23, !dbg !1147
+  %sp25 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1148
+  %bc26 = shufflevector <4 x i32> %sp25, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1149
+  %w27 = or <4 x i32> %w24, %bc26, !dbg !1150
+  %sp28 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1151
+  %bc29 = shufflevector <4 x i32> %sp28, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1152
+  %w30 = add <4 x i32> %w27, %bc29, !dbg !1153
+  %sp31 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1154
+  %bc32 = shufflevector <4 x i32> %sp31, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1155
+  %w33 = xor <4 x i32> %w30, %bc32, !dbg !1156
+  %sp34 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1157
+  %bc35 = shufflevector <4 x i32> %sp34, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1158
+  %w36 = xor <4 x i32> %w33, %bc35, !dbg !1159
+  store <4 x i32> %w36, ptr %buf, align 16, !tbaa !19, !dbg !1160
+  %e37 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 1, !dbg !1161
+  %l38 = load i32, ptr %e37, align 4, !tbaa !19, !dbg !1162
+  %r39 = insertelement <4 x i32> %w36, i32 %l38, i64 3, !dbg !1163
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !1164
+  ret <4 x i32> %r39, !dbg !1165
+}
+
+define i64 @kernel_49(ptr %grid) !dbg !1166 {
+entry:
+  br label %walk, !dbg !1167
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !1168
+  br i1 %c1, label %done, label %body, !dbg !1169
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !1170
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !1171
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !1172
+  %r5 = call i64 @kernel_45(ptr %pr2, i32 %n4), !dbg !1173
+  %a6 = add i64 %tot, %r5, !dbg !1174
+  %r7 = call i64 @kernel_40(ptr %pr2, i32 %n4), !dbg !1175
+  %a8 = add i64 %a6, %r7, !dbg !1176
+  store i64 %a8, ptr @g11, align 8, !tbaa !20, !dbg !1177
+  %tot.next = add i64 %a8, 1, !dbg !1178
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !1179
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !1180
+  br label %walk, !dbg !1181
+
+done:
+  ret i64 %tot, !dbg !1182
+}
+
+define i64 @kernel_50(ptr noalias %recs, i32 %n) !dbg !1183 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !1184
+  %nw2 = zext i32 %n to i64, !dbg !1185
+  br i1 %c1, label %loop, label %exit, !dbg !1186
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !1187
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !1188
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !1189
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !1190
+  %c7 = icmp slt i32 %a4, 51, !dbg !1191
+  br i1 %c7, label %then, label %else, !dbg !1192
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !1193
+  %y9 = and i64 %x8, %b6, !dbg !1194
+  br label %latch, !dbg !1195
+
+else:
+  %z10 = xor i64 %b6, 2, !dbg !1196
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !1197
+  br label %latch, !dbg !1198
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !1199
+  %i.next = add nuw nsw i64 %i, 1, !dbg !1200
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !1201
+  br i1 %d12, label %exit, label %loop, !dbg !1202, !llvm.loop !1203
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !1204
+}
+
+define void @kernel_51(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !1205 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !1206
+  br i1 %c1, label %outer, label %exit, !dbg !1207
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !1208
+  br label %inner, !dbg !1209
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !1210
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !1211
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !1212
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !1213
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !1214
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !1215
+  %j.next = add nuw nsw i64 %j, 1, !dbg !1216
+  %d8 = icmp eq i64 %j.next, %n, !dbg !1217
+  br i1 %d8, label %outer.latch, label %inner, !dbg !1218
+
+outer.latch:
+  %sc9 = fmul double %s.next, 3.500000e+00, !dbg !1219
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !1220
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !1221
+  %i.next = add nuw nsw i64 %i, 1, !dbg !1222
+  %d11 = icmp eq i64 %i.next, %n, !dbg !1223
+  br i1 %d11, label %exit, label %outer, !dbg !1224
+
+exit:
+  ret void, !dbg !1225
+}
+
+define i32 @kernel_52(i32 %op, i32 %x) !dbg !1226 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+    i32 3, label %case3
+    i32 4, label %case4
+    i32 5, label %case5
+    i32 6, label %case6
+  ], !dbg !1227
+
+case0:
+  %r1 = call i32 @kernel_47(i32 0, i32 %x), !dbg !1228
+  br label %join, !dbg !1229
+
+case1:
+  %r2 = lshr i32 %x, 9, !dbg !1230
+  br label %join, !dbg !1231
+
+case2:
+  %r3 = xor i32 %x, 8, !dbg !1232
+  br label %join, !dbg !1233
+
+case3:
+  %r4 = call i32 @kernel_42(i32 3, i32 %x), !dbg !1234
+  br label %join, !dbg !1235
+
+case4:
+  %r5 = call i32 @kernel_42(i32 4, i32 %x), !dbg !1236
+  br label %join, !dbg !1237
+
+case5:
+  %r6 = call i32 @kernel_42(i32 5, i32 %x), !dbg !1238
+  br label %join, !dbg !1239
+
+case6:
+  %r7 = call i32 @kernel_42(i32 6, i32 %x), !dbg !1240
+  br label %join, !dbg !1241
+
+default:
+  %p8 = getelementptr inbounds [16 x i32], ptr @g56, i64 0, i64 10, !dbg !1242
+  %l9 = load i32, ptr %p8, align 4, !tbaa !19, !dbg !1243
+  %u10 = call i32 @llvm.umin.i32(i32 %l9, i32 %x), !dbg !1244
+  br label %join, !dbg !1245
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %r4, %case3 ], [ %r5, %case4 ], [ %r6, %case5 ], [ %r7, %case6 ], [ %u10, %default ]
+  ret i32 %res, !dbg !1246
+}
+
+define <4 x i32> @kernel_53(<4 x i32> %v, i32 %s) !dbg !1247 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !1248
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !1249
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1250
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1251
+  %w3 = or <4 x i32> %v, %bc2, !dbg !1252
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1253
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1254
+  %w6 = and <4 x i32> %w3, %bc5, !dbg !1255
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1256
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1257
+  %w9 = add <4 x i32> %w6, %bc8, !dbg !1258
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1259
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1260
+  %w12 = xor <4 x i32> %w9, %bc11, !dbg !1261
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1262
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1263
+  %w15 = add <4 x i32> %w12, %bc14, !dbg !1264
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1265
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1266
+  %w18 = add <4 x i32> %w15, %bc17, !dbg !1267
+  %sp19 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1268
+  %bc20 = shufflevector <4 x i32> %sp19, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1269
+  %w21 = and <4 x i32> %w18, %bc20, !dbg !1270
+  store <4 x i32> %w21, ptr %buf, align 16, !tbaa !19, !dbg !1271
+  %e22 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 0, !dbg !1272
+  %l23 = load i32, ptr %e22, align 4, !tbaa !19, !dbg !1273
+  %r24 = insertelement <4 x i32> %w21, i32 %l23, i64 3, !dbg !1274
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !1275
+  ret <4 x i32> %r24, !dbg !1276
+}
+
+define i64 @kernel_54(ptr %grid) !dbg !1277 {
+entry:
+  br label %walk, !dbg !1278
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !1279
+  br i1 %c1, label %done, label %body, !dbg !1280
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !1281
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !1282
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !1283
+  %r5 = call i64 @kernel_50(ptr %pr2, i32 %n4), !dbg !1284
+  %a6 = add i64 %tot, %r5, !dbg !1285
+  %r7 = call i64 @kernel_45(ptr %pr2, i32 %n4), !dbg !1286
+  %a8 = add i64 %a6, %r7, !dbg !1287
+  store i64 %a8, ptr @g23, align 8, !tbaa !20, !dbg !1288
+  %tot.next = add i64 %a8, 1, !dbg !1289
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !1290
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !1291
+  br label %walk, !dbg !1292
+
+done:
+  %pc10 = call i32 (ptr, ...) @printf(ptr @g54), !dbg !1293
+  ret i64 %tot, !dbg !1294
+}
+
+define i64 @kernel_55(ptr noalias %recs, i32 %n) !dbg !1295 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !1296
+  %nw2 = zext i32 %n to i64, !dbg !1297
+  br i1 %c1, label %loop, label %exit, !dbg !1298
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !1299
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !1300
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !1301
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !1302
+  %c7 = icmp slt i32 %a4, 34, !dbg !1303
+  br i1 %c7, label %then, label %else, !dbg !1304
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !1305
+  %y9 = xor i64 %x8, %b6, !dbg !1306
+  br label %latch, !dbg !1307
+
+else:
+  %z10 = or i64 %b6, 26, !dbg !1308
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !1309
+  br label %latch, !dbg !1310
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !1311
+  %i.next = add nuw nsw i64 %i, 1, !dbg !1312
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !1313
+  br i1 %d12, label %exit, label %loop, !dbg !1314, !llvm.loop !1315
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !1316
+}
+
+define void @kernel_56(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !1317 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !1318
+  br i1 %c1, label %outer, label %exit, !dbg !1319
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !1320
+  br label %inner, !dbg !1321
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !1322
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !1323
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !1324
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !1325
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !1326
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !1327
+  %j.next = add nuw nsw i64 %j, 1, !dbg !1328
+  %d8 = icmp eq i64 %j.next, %n, !dbg !1329
+  br i1 %d8, label %outer.latch, label %inner, !dbg !1330
+
+outer.latch:
+  %sc9 = fmul double %s.next, 9.500000e+00, !dbg !1331
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !1332
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !1333
+  %i.next = add nuw nsw i64 %i, 1, !dbg !1334
+  %d11 = icmp eq i64 %i.next, %n, !dbg !1335
+  br i1 %d11, label %exit, label %outer, !dbg !1336
+
+exit:
+  ret void, !dbg !1337
+}
+
+define i32 @kernel_57(i32 %op, i32 %x) !dbg !1338 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+    i32 3, label %case3
+    i32 4, label %case4
+    i32 5, label %case5
+    i32 6, label %case6
+  ], !dbg !1339
+
+case0:
+  %r1 = mul i32 %x, 8, !dbg !1340
+  br label %join, !dbg !1341
+
+case1:
+  %r2 = call i32 @kernel_52(i32 1, i32 %x), !dbg !1342
+  br label %join, !dbg !1343
+
+case2:
+  %r3 = shl i32 %x, 13, !dbg !1344
+  br label %join, !dbg !1345
+
+case3:
+  %r4 = call i32 @kernel_47(i32 3, i32 %x), !dbg !1346
+  br label %join, !dbg !1347
+
+case4:
+  %r5 = lshr i32 %x, 14, !dbg !1348
+  br label %join, !dbg !1349
+
+case5:
+  %r6 = lshr i32 %x, 6, !dbg !1350
+  br label %join, !dbg !1351
+
+case6:
+  %r7 = ashr i32 %x, 7, !dbg !1352
+  br label %join, !dbg !1353
+
+default:
+  %p8 = getelementptr inbounds [16 x i32], ptr @g48, i64 0, i64 6, !dbg !1354
+  %l9 = load i32, ptr %p8, align 4, !tbaa !19, !dbg !1355
+  %u10 = call i32 @llvm.umin.i32(i32 %l9, i32 %x), !dbg !1356
+  br label %join, !dbg !1357
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %r4, %case3 ], [ %r5, %case4 ], [ %r6, %case5 ], [ %r7, %case6 ], [ %u10, %default ]
+  ret i32 %res, !dbg !1358
+}
+
+define <4 x i32> @kernel_58(<4 x i32> %v, i32 %s) !dbg !1359 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !1360
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !1361
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1362
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1363
+  %w3 = mul <4 x i32> %v, %bc2, !dbg !1364
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1365
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1366
+  %w6 = add <4 x i32> %w3, %bc5, !dbg !1367
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1368
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1369
+  %w9 = xor <4 x i32> %w6, %bc8, !dbg !1370
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1371
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1372
+  %w12 = and <4 x i32> %w9, %bc11, !dbg !1373
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1374
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1375
+  %w15 = mul <4 x i32> %w12, %bc14, !dbg !1376
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1377
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1378
+  %w18 = add <4 x i32> %w15, %bc17, !dbg !1379
+  %sp19 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1380
+  %bc20 = shufflevector <4 x i32> %sp19, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1381
+  %w21 = add <4 x i32> %w18, %bc20, !dbg !1382
+  %sp22 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1383
+  %bc23 = shufflevector <4 x i32> %sp22, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1384
+  %w24 = mul <4 x i32> %w21, %bc23, !dbg !1385
+  %sp25 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1386
+  %bc26 = shufflevector <4 x i32> %sp25, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1387
+  %w27 = xor <4 x i32> %w24, %bc26, !dbg !1388
+  store <4 x i32> %w27, ptr %buf, align 16, !tbaa !19, !dbg !1389
+  %e28 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 2, !dbg !1390
+  %l29 = load i32, ptr %e28, align 4, !tbaa !19, !dbg !1391
+  %r30 = insertelement <4 x i32> %w27, i32 %l29, i64 3, !dbg !1392
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !1393
+  ret <4 x i32> %r30, !dbg !1394
+}
+
+define i64 @kernel_59(ptr %grid) !dbg !1395 {
+entry:
+  br label %walk, !dbg !1396
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !1397
+  br i1 %c1, label %done, label %body, !dbg !1398
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !1399
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !1400
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !1401
+  %r5 = call i64 @kernel_55(ptr %pr2, i32 %n4), !dbg !1402
+  %a6 = add i64 %tot, %r5, !dbg !1403
+  %r7 = call i64 @kernel_50(ptr %pr2, i32 %n4), !dbg !1404
+  %a8 = add i64 %a6, %r7, !dbg !1405
+  store i64 %a8, ptr @g19, align 8, !tbaa !20, !dbg !1406
+  %tot.next = add i64 %a8, 1, !dbg !1407
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !1408
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !1409
+  br label %walk, !dbg !1410
+
+done:
+  ret i64 %tot, !dbg !1411
+}
+
+define i64 @kernel_60(ptr noalias %recs, i32 %n) !dbg !1412 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !1413
+  %nw2 = zext i32 %n to i64, !dbg !1414
+  br i1 %c1, label %loop, label %exit, !dbg !1415
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !1416
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !1417
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !1418
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !1419
+  %c7 = icmp slt i32 %a4, 45, !dbg !1420
+  br i1 %c7, label %then, label %else, !dbg !1421
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !1422
+  %y9 = xor i64 %x8, %b6, !dbg !1423
+  br label %latch, !dbg !1424
+
+else:
+  %z10 = add nsw i64 %b6, 15, !dbg !1425
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !1426
+  br label %latch, !dbg !1427
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !1428
+  %i.next = add nuw nsw i64 %i, 1, !dbg !1429
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !1430
+  br i1 %d12, label %exit, label %loop, !dbg !1431, !llvm.loop !1432
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !1433
+}
+
+define void @kernel_61(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !1434 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !1435
+  br i1 %c1, label %outer, label %exit, !dbg !1436
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !1437
+  br label %inner, !dbg !1438
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !1439
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !1440
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !1441
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !1442
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !1443
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !1444
+  %j.next = add nuw nsw i64 %j, 1, !dbg !1445
+  %d8 = icmp eq i64 %j.next, %n, !dbg !1446
+  br i1 %d8, label %outer.latch, label %inner, !dbg !1447
+
+outer.latch:
+  %sc9 = fmul double %s.next, 6.500000e+00, !dbg !1448
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !1449
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !1450
+  %i.next = add nuw nsw i64 %i, 1, !dbg !1451
+  %d11 = icmp eq i64 %i.next, %n, !dbg !1452
+  br i1 %d11, label %exit, label %outer, !dbg !1453
+
+exit:
+  ret void, !dbg !1454
+}
+
+define i32 @kernel_62(i32 %op, i32 %x) !dbg !1455 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+    i32 3, label %case3
+    i32 4, label %case4
+    i32 5, label %case5
+  ], !dbg !1456
+
+case0:
+  %r1 = call i32 @kernel_52(i32 0, i32 %x), !dbg !1457
+  br label %join, !dbg !1458
+
+case1:
+  %r2 = call i32 @kernel_52(i32 1, i32 %x), !dbg !1459
+  br label %join, !dbg !1460
+
+case2:
+  %r3 = call i32 @kernel_57(i32 2, i32 %x), !dbg !1461
+  br label %join, !dbg !1462
+
+case3:
+  %r4 = call i32 @kernel_57(i32 3, i32 %x), !dbg !1463
+  br label %join, !dbg !1464
+
+case4:
+  %r5 = call i32 @kernel_57(i32 4, i32 %x), !dbg !1465
+  br label %join, !dbg !1466
+
+case5:
+  %r6 = call i32 @kernel_52(i32 5, i32 %x), !dbg !1467
+  br label %join, !dbg !1468
+
+default:
+  %p7 = getelementptr inbounds [16 x i32], ptr @g52, i64 0, i64 8, !dbg !1469
+  %l8 = load i32, ptr %p7, align 4, !tbaa !19, !dbg !1470
+  %u9 = call i32 @llvm.umin.i32(i32 %l8, i32 %x), !dbg !1471
+  br label %join, !dbg !1472
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %r4, %case3 ], [ %r5, %case4 ], [ %r6, %case5 ], [ %u9, %default ]
+  ret i32 %res, !dbg !1473
+}
+
+define <4 x i32> @kernel_63(<4 x i32> %v, i32 %s) !dbg !1474 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !1475
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !1476
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1477
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1478
+  %w3 = xor <4 x i32> %v, %bc2, !dbg !1479
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1480
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1481
+  %w6 = or <4 x i32> %w3, %bc5, !dbg !1482
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1483
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1484
+  %w9 = add <4 x i32> %w6, %bc8, !dbg !1485
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1486
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1487
+  %w12 = or <4 x i32> %w9, %bc11, !dbg !1488
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1489
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1490
+  %w15 = or <4 x i32> %w12, %bc14, !dbg !1491
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1492
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1493
+  %w18 = and <4 x i32> %w15, %bc17, !dbg !1494
+  %sp19 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1495
+  %bc20 = shufflevector <4 x i32> %sp19, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1496
+  %w21 = and <4 x i32> %w18, %bc20, !dbg !1497
+  store <4 x i32> %w21, ptr %buf, align 16, !tbaa !19, !dbg !1498
+  %e22 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 0, !dbg !1499
+  %l23 = load i32, ptr %e22, align 4, !tbaa !19, !dbg !1500
+  %r24 = insertelement <4 x i32> %w21, i32 %l23, i64 3, !dbg !1501
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !1502
+  ret <4 x i32> %r24, !dbg !1503
+}
+
+define i64 @kernel_64(ptr %grid) !dbg !1504 {
+entry:
+  br label %walk, !dbg !1505
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !1506
+  br i1 %c1, label %done, label %body, !dbg !1507
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !1508
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !1509
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !1510
+  %r5 = call i64 @kernel_60(ptr %pr2, i32 %n4), !dbg !1511
+  %a6 = add i64 %tot, %r5, !dbg !1512
+  %r7 = call i64 @kernel_55(ptr %pr2, i32 %n4), !dbg !1513
+  %a8 = add i64 %a6, %r7, !dbg !1514
+  store i64 %a8, ptr @g47, align 8, !tbaa !20, !dbg !1515
+  %tot.next = add i64 %a8, 1, !dbg !1516
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !1517
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !1518
+  br label %walk, !dbg !1519
+
+done:
+  %pc10 = call i32 (ptr, ...) @printf(ptr @g22), !dbg !1520
+  ret i64 %tot, !dbg !1521
+}
+
+define i64 @kernel_65(ptr noalias %recs, i32 %n) !dbg !1522 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !1523
+  %nw2 = zext i32 %n to i64, !dbg !1524
+  br i1 %c1, label %loop, label %exit, !dbg !1525
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !1526
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !1527
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !1528
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !1529
+  %c7 = icmp slt i32 %a4, 13, !dbg !1530
+  br i1 %c7, label %then, label %else, !dbg !1531
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !1532
+  %y9 = and i64 %x8, %b6, !dbg !1533
+  br label %latch, !dbg !1534
+
+else:
+  %z10 = and i64 %b6, 2, !dbg !1535
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !1536
+  br label %latch, !dbg !1537
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !1538
+  %i.next = add nuw nsw i64 %i, 1, !dbg !1539
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !1540
+  br i1 %d12, label %exit, label %loop, !dbg !1541, !llvm.loop !1542
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !1543
+}
+
+define void @kernel_66(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !1544 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !1545
+  br i1 %c1, label %outer, label %exit, !dbg !1546
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !1547
+  br label %inner, !dbg !1548
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !1549
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !1550
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !1551
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !1552
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !1553
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !1554
+  %j.next = add nuw nsw i64 %j, 1, !dbg !1555
+  %d8 = icmp eq i64 %j.next, %n, !dbg !1556
+  br i1 %d8, label %outer.latch, label %inner, !dbg !1557
+
+outer.latch:
+  %sc9 = fmul double %s.next, 6.500000e+00, !dbg !1558
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !1559
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !1560
+  %i.next = add nuw nsw i64 %i, 1, !dbg !1561
+  %d11 = icmp eq i64 %i.next, %n, !dbg !1562
+  br i1 %d11, label %exit, label %outer, !dbg !1563
+
+exit:
+  ret void, !dbg !1564
+}
+
+define i32 @kernel_67(i32 %op, i32 %x) !dbg !1565 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+    i32 3, label %case3
+    i32 4, label %case4
+  ], !dbg !1566
+
+case0:
+  %r1 = call i32 @kernel_57(i32 0, i32 %x), !dbg !1567
+  br label %join, !dbg !1568
+
+case1:
+  %r2 = call i32 @kernel_57(i32 1, i32 %x), !dbg !1569
+  br label %join, !dbg !1570
+
+case2:
+  %r3 = sub i32 %x, 10, !dbg !1571
+  br label %join, !dbg !1572
+
+case3:
+  %r4 = mul i32 %x, 6, !dbg !1573
+  br label %join, !dbg !1574
+
+case4:
+  %r5 = sub i32 %x, 4, !dbg !1575
+  br label %join, !dbg !1576
+
+default:
+  %p6 = getelementptr inbounds [16 x i32], ptr @g44, i64 0, i64 4, !dbg !1577
+  %l7 = load i32, ptr %p6, align 4, !tbaa !19, !dbg !1578
+  %u8 = call i32 @llvm.umin.i32(i32 %l7, i32 %x), !dbg !1579
+  br label %join, !dbg !1580
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %r4, %case3 ], [ %r5, %case4 ], [ %u8, %default ]
+  ret i32 %res, !dbg !1581
+}
+
+define <4 x i32> @kernel_68(<4 x i32> %v, i32 %s) !dbg !1582 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !1583
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !1584
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1585
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1586
+  %w3 = or <4 x i32> %v, %bc2, !dbg !1587
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1588
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1589
+  %w6 = add <4 x i32> %w3, %bc5, !dbg !1590
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1591
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1592
+  %w9 = add <4 x i32> %w6, %bc8, !dbg !1593
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1594
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1595
+  %w12 = xor <4 x i32> %w9, %bc11, !dbg !1596
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1597
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1598
+  %w15 = and <4 x i32> %w12, %bc14, !dbg !1599
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1600
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1601
+  %w18 = add <4 x i32> %w15, %bc17, !dbg !1602
+  %sp19 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1603
+  %bc20 = shufflevector <4 x i32> %sp19, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1604
+  %w21 = or <4 x i32> %w18, %bc20, !dbg !1605
+  %sp22 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1606
+  %bc23 = shufflevector <4 x i32> %sp22, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1607
+  %w24 = xor <4 x i32> %w21, %bc23, !dbg !1608
+  store <4 x i32> %w24, ptr %buf, align 16, !tbaa !19, !dbg !1609
+  %e25 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 1, !dbg !1610
+  %l26 = load i32, ptr %e25, align 4, !tbaa !19, !dbg !1611
+  %r27 = insertelement <4 x i32> %w24, i32 %l26, i64 3, !dbg !1612
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !1613
+  ret <4 x i32> %r27, !dbg !1614
+}
+
+define i64 @kernel_69(ptr %grid) !dbg !1615 {
+entry:
+  br label %walk, !dbg !1616
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !1617
+  br i1 %c1, label %done, label %body, !dbg !1618
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !1619
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !1620
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !1621
+  %r5 = call i64 @kernel_60(ptr %pr2, i32 %n4), !dbg !1622
+  %a6 = add i64 %tot, %r5, !dbg !1623
+  %r7 = call i64 @kernel_65(ptr %pr2, i32 %n4), !dbg !1624
+  %a8 = add i64 %a6, %r7, !dbg !1625
+  store i64 %a8, ptr @g35, align 8, !tbaa !20, !dbg !1626
+  %tot.next = add i64 %a8, 1, !dbg !1627
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !1628
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !1629
+  br label %walk, !dbg !1630
+
+done:
+  ret i64 %tot, !dbg !1631
+}
+
+define i64 @kernel_70(ptr noalias %recs, i32 %n) !dbg !1632 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !1633
+  %nw2 = zext i32 %n to i64, !dbg !1634
+  br i1 %c1, label %loop, label %exit, !dbg !1635
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !1636
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !1637
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !1638
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !1639
+  %c7 = icmp slt i32 %a4, 3, !dbg !1640
+  br i1 %c7, label %then, label %else, !dbg !1641
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !1642
+  %y9 = sub i64 %x8, %b6, !dbg !1643
+  br label %latch, !dbg !1644
+
+else:
+  %z10 = sub i64 %b6, 4, !dbg !1645
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !1646
+  br label %latch, !dbg !1647
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !1648
+  %i.next = add nuw nsw i64 %i, 1, !dbg !1649
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !1650
+  br i1 %d12, label %exit, label %loop, !dbg !1651, !llvm.loop !1652
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !1653
+}
+
+define void @kernel_71(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !1654 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !1655
+  br i1 %c1, label %outer, label %exit, !dbg !1656
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !1657
+  br label %inner, !dbg !1658
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !1659
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !1660
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !1661
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !1662
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !1663
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !1664
+  %j.next = add nuw nsw i64 %j, 1, !dbg !1665
+  %d8 = icmp eq i64 %j.next, %n, !dbg !1666
+  br i1 %d8, label %outer.latch, label %inner, !dbg !1667
+
+outer.latch:
+  %sc9 = fmul double %s.next, 4.500000e+00, !dbg !1668
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !1669
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !1670
+  %i.next = add nuw nsw i64 %i, 1, !dbg !1671
+  %d11 = icmp eq i64 %i.next, %n, !dbg !1672
+  br i1 %d11, label %exit, label %outer, !dbg !1673
+
+exit:
+  ret void, !dbg !1674
+}
+
+define i32 @kernel_72(i32 %op, i32 %x) !dbg !1675 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+    i32 3, label %case3
+    i32 4, label %case4
+  ], !dbg !1676
+
+case0:
+  %r1 = add nsw i32 %x, 8, !dbg !1677
+  br label %join, !dbg !1678
+
+case1:
+  %r2 = call i32 @kernel_62(i32 1, i32 %x), !dbg !1679
+  br label %join, !dbg !1680
+
+case2:
+  %r3 = call i32 @kernel_67(i32 2, i32 %x), !dbg !1681
+  br label %join, !dbg !1682
+
+case3:
+  %r4 = call i32 @kernel_67(i32 3, i32 %x), !dbg !1683
+  br label %join, !dbg !1684
+
+case4:
+  %r5 = sub i32 %x, 8, !dbg !1685
+  br label %join, !dbg !1686
+
+default:
+  %p6 = getelementptr inbounds [16 x i32], ptr @g28, i64 0, i64 13, !dbg !1687
+  %l7 = load i32, ptr %p6, align 4, !tbaa !19, !dbg !1688
+  %u8 = call i32 @llvm.umin.i32(i32 %l7, i32 %x), !dbg !1689
+  br label %join, !dbg !1690
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %r4, %case3 ], [ %r5, %case4 ], [ %u8, %default ]
+  ret i32 %res, !dbg !1691
+}
+
+define <4 x i32> @kernel_73(<4 x i32> %v, i32 %s) !dbg !1692 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !1693
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !1694
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1695
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1696
+  %w3 = xor <4 x i32> %v, %bc2, !dbg !1697
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1698
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1699
+  %w6 = and <4 x i32> %w3, %bc5, !dbg !1700
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1701
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1702
+  %w9 = or <4 x i32> %w6, %bc8, !dbg !1703
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1704
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1705
+  %w12 = and <4 x i32> %w9, %bc11, !dbg !1706
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1707
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1708
+  %w15 = xor <4 x i32> %w12, %bc14, !dbg !1709
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1710
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1711
+  %w18 = add <4 x i32> %w15, %bc17, !dbg !1712
+  %sp19 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1713
+  %bc20 = shufflevector <4 x i32> %sp19, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1714
+  %w21 = add <4 x i32> %w18, %bc20, !dbg !1715
+  %sp22 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1716
+  %bc23 = shufflevector <4 x i32> %sp22, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1717
+  %w24 = or <4 x i32> %w21, %bc23, !dbg !1718
+  %sp25 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1719
+  %bc26 = shufflevector <4 x i32> %sp25, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1720
+  %w27 = add <4 x i32> %w24, %bc26, !dbg !1721
+  %sp28 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1722
+  %bc29 = shufflevector <4 x i32> %sp28, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1723
+  %w30 = and <4 x i32> %w27, %bc29, !dbg !1724
+  %sp31 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1725
+  %bc32 = shufflevector <4 x i32> %sp31, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1726
+  %w33 = or <4 x i32> %w30, %bc32, !dbg !1727
+  %sp34 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1728
+  %bc35 = shufflevector <4 x i32> %sp34, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1729
+  %w36 = or <4 x i32> %w33, %bc35, !dbg !1730
+  store <4 x i32> %w36, ptr %buf, align 16, !tbaa !19, !dbg !1731
+  %e37 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 1, !dbg !1732
+  %l38 = load i32, ptr %e37, align 4, !tbaa !19, !dbg !1733
+  %r39 = insertelement <4 x i32> %w36, i32 %l38, i64 3, !dbg !1734
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !1735
+  ret <4 x i32> %r39, !dbg !1736
+}
+
+define i64 @kernel_74(ptr %grid) !dbg !1737 {
+entry:
+  br label %walk, !dbg !1738
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !1739
+  br i1 %c1, label %done, label %body, !dbg !1740
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !1741
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !1742
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !1743
+  %r5 = call i64 @kernel_65(ptr %pr2, i32 %n4), !dbg !1744
+  %a6 = add i64 %tot, %r5, !dbg !1745
+  %r7 = call i64 @kernel_70(ptr %pr2, i32 %n4), !dbg !1746
+  %a8 = add i64 %a6, %r7, !dbg !1747
+  store i64 %a8, ptr @g11, align 8, !tbaa !20, !dbg !1748
+  %tot.next = add i64 %a8, 1, !dbg !1749
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !1750
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !1751
+  br label %walk, !dbg !1752
+
+done:
+  %pc10 = call i32 (ptr, ...) @printf(ptr @g18), !dbg !1753
+  ret i64 %tot, !dbg !1754
+}
+
+define i64 @kernel_75(ptr noalias %recs, i32 %n) !dbg !1755 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !1756
+  %nw2 = zext i32 %n to i64, !dbg !1757
+  br i1 %c1, label %loop, label %exit, !dbg !1758
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !1759
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !1760
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !1761
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !1762
+  %c7 = icmp slt i32 %a4, 41, !dbg !1763
+  br i1 %c7, label %then, label %else, !dbg !1764
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !1765
+  %y9 = sub i64 %x8, %b6, !dbg !1766
+  br label %latch, !dbg !1767
+
+else:
+  %z10 = add nsw i64 %b6, 26, !dbg !1768
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !1769
+  br label %latch, !dbg !1770
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !1771
+  %i.next = add nuw nsw i64 %i, 1, !dbg !1772
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !1773
+  br i1 %d12, label %exit, label %loop, !dbg !1774, !llvm.loop !1775
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !1776
+}
+
+define void @kernel_76(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !1777 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !1778
+  br i1 %c1, label %outer, label %exit, !dbg !1779
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !1780
+  br label %inner, !dbg !1781
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !1782
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !1783
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !1784
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !1785
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !1786
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !1787
+  %j.next = add nuw nsw i64 %j, 1, !dbg !1788
+  %d8 = icmp eq i64 %j.next, %n, !dbg !1789
+  br i1 %d8, label %outer.latch, label %inner, !dbg !1790
+
+outer.latch:
+  %sc9 = fmul double %s.next, 8.500000e+00, !dbg !1791
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !1792
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !1793
+  %i.next = add nuw nsw i64 %i, 1, !dbg !1794
+  %d11 = icmp eq i64 %i.next, %n, !dbg !1795
+  br i1 %d11, label %exit, label %outer, !dbg !1796
+
+exit:
+  ret void, !dbg !1797
+}
+
+define i32 @kernel_77(i32 %op, i32 %x) !dbg !1798 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+    i32 3, label %case3
+  ], !dbg !1799
+
+case0:
+  %r1 = mul i32 %x, 6, !dbg !1800
+  br label %join, !dbg !1801
+
+case1:
+  %r2 = call i32 @kernel_72(i32 1, i32 %x), !dbg !1802
+  br label %join, !dbg !1803
+
+case2:
+  %r3 = call i32 @kernel_72(i32 2, i32 %x), !dbg !1804
+  br label %join, !dbg !1805
+
+case3:
+  %r4 = or i32 %x, 8, !dbg !1806
+  br label %join, !dbg !1807
+
+default:
+  %p5 = getelementptr inbounds [16 x i32], ptr @g8, i64 0, i64 0, !dbg !1808
+  %l6 = load i32, ptr %p5, align 4, !tbaa !19, !dbg !1809
+  %u7 = call i32 @llvm.umin.i32(i32 %l6, i32 %x), !dbg !1810
+  br label %join, !dbg !1811
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %r4, %case3 ], [ %u7, %default ]
+  ret i32 %res, !dbg !1812
+}
+
+define <4 x i32> @kernel_78(<4 x i32> %v, i32 %s) !dbg !1813 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !1814
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !1815
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1816
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1817
+  %w3 = or <4 x i32> %v, %bc2, !dbg !1818
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1819
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1820
+  %w6 = mul <4 x i32> %w3, %bc5, !dbg !1821
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1822
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1823
+  %w9 = or <4 x i32> %w6, %bc8, !dbg !1824
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1825
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1826
+  %w12 = mul <4 x i32> %w9, %bc11, !dbg !1827
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1828
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1829
+  %w15 = and <4 x i32> %w12, %bc14, !dbg !1830
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1831
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1832
+  %w18 = mul <4 x i32> %w15, %bc17, !dbg !1833
+  %sp19 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1834
+  %bc20 = shufflevector <4 x i32> %sp19, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1835
+  %w21 = or <4 x i32> %w18, %bc20, !dbg !1836
+  %sp22 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1837
+  %bc23 = shufflevector <4 x i32> %sp22, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1838
+  %w24 = add <4 x i32> %w21, %bc23, !dbg !1839
+  %sp25 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1840
+  %bc26 = shufflevector <4 x i32> %sp25, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1841
+  %w27 = xor <4 x i32> %w24, %bc26, !dbg !1842
+  %sp28 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1843
+  %bc29 = shufflevector <4 x i32> %sp28, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1844
+  %w30 = and <4 x i32> %w27, %bc29, !dbg !1845
+  store <4 x i32> %w30, ptr %buf, align 16, !tbaa !19, !dbg !1846
+  %e31 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 2, !dbg !1847
+  %l32 = load i32, ptr %e31, align 4, !tbaa !19, !dbg !1848
+  %r33 = insertelement <4 x i32> %w30, i32 %l32, i64 3, !dbg !1849
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !1850
+  ret <4 x i32> %r33, !dbg !1851
+}
+
+define i64 @kernel_79(ptr %grid) !dbg !1852 {
+entry:
+  br label %walk, !dbg !1853
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !1854
+  br i1 %c1, label %done, label %body, !dbg !1855
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !1856
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !1857
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !1858
+  %r5 = call i64 @kernel_70(ptr %pr2, i32 %n4), !dbg !1859
+  %a6 = add i64 %tot, %r5, !dbg !1860
+  %r7 = call i64 @kernel_75(ptr %pr2, i32 %n4), !dbg !1861
+  %a8 = add i64 %a6, %r7, !dbg !1862
+  store i64 %a8, ptr @g7, align 8, !tbaa !20, !dbg !1863
+  %tot.next = add i64 %a8, 1, !dbg !1864
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !1865
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !1866
+  br label %walk, !dbg !1867
+
+done:
+  ret i64 %tot, !dbg !1868
+}
+
+define i64 @kernel_80(ptr noalias %recs, i32 %n) !dbg !1869 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !1870
+  %nw2 = zext i32 %n to i64, !dbg !1871
+  br i1 %c1, label %loop, label %exit, !dbg !1872
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !1873
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !1874
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !1875
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !1876
+  %c7 = icmp slt i32 %a4, 5, !dbg !1877
+  br i1 %c7, label %then, label %else, !dbg !1878
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !1879
+  %y9 = and i64 %x8, %b6, !dbg !1880
+  br label %latch, !dbg !1881
+
+else:
+  %z10 = add nsw i64 %b6, 11, !dbg !1882
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !1883
+  br label %latch, !dbg !1884
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !1885
+  %i.next = add nuw nsw i64 %i, 1, !dbg !1886
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !1887
+  br i1 %d12, label %exit, label %loop, !dbg !1888, !llvm.loop !1889
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !1890
+}
+
+define void @kernel_81(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !1891 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !1892
+  br i1 %c1, label %outer, label %exit, !dbg !1893
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !1894
+  br label %inner, !dbg !1895
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !1896
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !1897
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !1898
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !1899
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !1900
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !1901
+  %j.next = add nuw nsw i64 %j, 1, !dbg !1902
+  %d8 = icmp eq i64 %j.next, %n, !dbg !1903
+  br i1 %d8, label %outer.latch, label %inner, !dbg !1904
+
+outer.latch:
+  %sc9 = fmul double %s.next, 4.500000e+00, !dbg !1905
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !1906
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !1907
+  %i.next = add nuw nsw i64 %i, 1, !dbg !1908
+  %d11 = icmp eq i64 %i.next, %n, !dbg !1909
+  br i1 %d11, label %exit, label %outer, !dbg !1910
+
+exit:
+  ret void, !dbg !1911
+}
+
+define i32 @kernel_82(i32 %op, i32 %x) !dbg !1912 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+    i32 3, label %case3
+    i32 4, label %case4
+  ], !dbg !1913
+
+case0:
+  %r1 = call i32 @kernel_72(i32 0, i32 %x), !dbg !1914
+  br label %join, !dbg !1915
+
+case1:
+  %r2 = call i32 @kernel_72(i32 1, i32 %x), !dbg !1916
+  br label %join, !dbg !1917
+
+case2:
+  %r3 = call i32 @kernel_77(i32 2, i32 %x), !dbg !1918
+  br label %join, !dbg !1919
+
+case3:
+  %r4 = call i32 @kernel_72(i32 3, i32 %x), !dbg !1920
+  br label %join, !dbg !1921
+
+case4:
+  %r5 = call i32 @kernel_77(i32 4, i32 %x), !dbg !1922
+  br label %join, !dbg !1923
+
+default:
+  %p6 = getelementptr inbounds [16 x i32], ptr @g4, i64 0, i64 4, !dbg !1924
+  %l7 = load i32, ptr %p6, align 4, !tbaa !19, !dbg !1925
+  %u8 = call i32 @llvm.umin.i32(i32 %l7, i32 %x), !dbg !1926
+  br label %join, !dbg !1927
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %r4, %case3 ], [ %r5, %case4 ], [ %u8, %default ]
+  ret i32 %res, !dbg !1928
+}
+
+define <4 x i32> @kernel_83(<4 x i32> %v, i32 %s) !dbg !1929 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !1930
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !1931
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1932
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1933
+  %w3 = mul <4 x i32> %v, %bc2, !dbg !1934
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1935
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1936
+  %w6 = xor <4 x i32> %w3, %bc5, !dbg !1937
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1938
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1939
+  %w9 = mul <4 x i32> %w6, %bc8, !dbg !1940
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1941
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1942
+  %w12 = xor <4 x i32> %w9, %bc11, !dbg !1943
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1944
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1945
+  %w15 = mul <4 x i32> %w12, %bc14, !dbg !1946
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1947
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1948
+  %w18 = mul <4 x i32> %w15, %bc17, !dbg !1949
+  %sp19 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1950
+  %bc20 = shufflevector <4 x i32> %sp19, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1951
+  %w21 = add <4 x i32> %w18, %bc20, !dbg !1952
+  %sp22 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1953
+  %bc23 = shufflevector <4 x i32> %sp22, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1954
+  %w24 = or <4 x i32> %w21, %bc23, !dbg !1955
+  %sp25 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1956
+  %bc26 = shufflevector <4 x i32> %sp25, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1957
+  %w27 = add <4 x i32> %w24, %bc26, !dbg !1958
+  %sp28 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1959
+  %bc29 = shufflevector <4 x i32> %sp28, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1960
+  %w30 = and <4 x i32> %w27, %bc29, !dbg !1961
+  %sp31 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1962
+  %bc32 = shufflevector <4 x i32> %sp31, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1963
+  %w33 = or <4 x i32> %w30, %bc32, !dbg !1964
+  %sp34 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1965
+  %bc35 = shufflevector <4 x i32> %sp34, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1966
+  %w36 = mul <4 x i32> %w33, %bc35, !dbg !1967
+  %sp37 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1968
+  %bc38 = shufflevector <4 x i32> %sp37, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1969
+  %w39 = add <4 x i32> %w36, %bc38, !dbg !1970
+  %sp40 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !1971
+  %bc41 = shufflevector <4 x i32> %sp40, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !1972
+  %w42 = or <4 x i32> %w39, %bc41, !dbg !1973
+  store <4 x i32> %w42, ptr %buf, align 16, !tbaa !19, !dbg !1974
+  %e43 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 1, !dbg !1975
+  %l44 = load i32, ptr %e43, align 4, !tbaa !19, !dbg !1976
+  %r45 = insertelement <4 x i32> %w42, i32 %l44, i64 3, !dbg !1977
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !1978
+  ret <4 x i32> %r45, !dbg !1979
+}
+
+define i64 @kernel_84(ptr %grid) !dbg !1980 {
+entry:
+  br label %walk, !dbg !1981
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !1982
+  br i1 %c1, label %done, label %body, !dbg !1983
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !1984
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !1985
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !1986
+  %r5 = call i64 @kernel_80(ptr %pr2, i32 %n4), !dbg !1987
+  %a6 = add i64 %tot, %r5, !dbg !1988
+  %r7 = call i64 @kernel_75(ptr %pr2, i32 %n4), !dbg !1989
+  %a8 = add i64 %a6, %r7, !dbg !1990
+  store i64 %a8, ptr @g51, align 8, !tbaa !20, !dbg !1991
+  %tot.next = add i64 %a8, 1, !dbg !1992
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !1993
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !1994
+  br label %walk, !dbg !1995
+
+done:
+  %pc10 = call i32 (ptr, ...) @printf(ptr @g38), !dbg !1996
+  ret i64 %tot, !dbg !1997
+}
+
+define i64 @kernel_85(ptr noalias %recs, i32 %n) !dbg !1998 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !1999
+  %nw2 = zext i32 %n to i64, !dbg !2000
+  br i1 %c1, label %loop, label %exit, !dbg !2001
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !2002
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !2003
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !2004
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !2005
+  %c7 = icmp slt i32 %a4, 31, !dbg !2006
+  br i1 %c7, label %then, label %else, !dbg !2007
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !2008
+  %y9 = mul i64 %x8, %b6, !dbg !2009
+  br label %latch, !dbg !2010
+
+else:
+  %z10 = or i64 %b6, 27, !dbg !2011
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !2012
+  br label %latch, !dbg !2013
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !2014
+  %i.next = add nuw nsw i64 %i, 1, !dbg !2015
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !2016
+  br i1 %d12, label %exit, label %loop, !dbg !2017, !llvm.loop !2018
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !2019
+}
+
+define void @kernel_86(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !2020 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !2021
+  br i1 %c1, label %outer, label %exit, !dbg !2022
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !2023
+  br label %inner, !dbg !2024
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !2025
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !2026
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !2027
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !2028
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !2029
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !2030
+  %j.next = add nuw nsw i64 %j, 1, !dbg !2031
+  %d8 = icmp eq i64 %j.next, %n, !dbg !2032
+  br i1 %d8, label %outer.latch, label %inner, !dbg !2033
+
+outer.latch:
+  %sc9 = fmul double %s.next, 6.500000e+00, !dbg !2034
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !2035
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !2036
+  %i.next = add nuw nsw i64 %i, 1, !dbg !2037
+  %d11 = icmp eq i64 %i.next, %n, !dbg !2038
+  br i1 %d11, label %exit, label %outer, !dbg !2039
+
+exit:
+  ret void, !dbg !2040
+}
+
+define i32 @kernel_87(i32 %op, i32 %x) !dbg !2041 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+    i32 3, label %case3
+  ], !dbg !2042
+
+case0:
+  %r1 = call i32 @kernel_77(i32 0, i32 %x), !dbg !2043
+  br label %join, !dbg !2044
+
+case1:
+  %r2 = call i32 @kernel_82(i32 1, i32 %x), !dbg !2045
+  br label %join, !dbg !2046
+
+case2:
+  %r3 = ashr i32 %x, 7, !dbg !2047
+  br label %join, !dbg !2048
+
+case3:
+  %r4 = ashr i32 %x, 14, !dbg !2049
+  br label %join, !dbg !2050
+
+default:
+  %p5 = getelementptr inbounds [16 x i32], ptr @g16, i64 0, i64 11, !dbg !2051
+  %l6 = load i32, ptr %p5, align 4, !tbaa !19, !dbg !2052
+  %u7 = call i32 @llvm.umin.i32(i32 %l6, i32 %x), !dbg !2053
+  br label %join, !dbg !2054
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %r4, %case3 ], [ %u7, %default ]
+  ret i32 %res, !dbg !2055
+}
+
+define <4 x i32> @kernel_88(<4 x i32> %v, i32 %s) !dbg !2056 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !2057
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !2058
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2059
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2060
+  %w3 = add <4 x i32> %v, %bc2, !dbg !2061
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2062
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2063
+  %w6 = mul <4 x i32> %w3, %bc5, !dbg !2064
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2065
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2066
+  %w9 = or <4 x i32> %w6, %bc8, !dbg !2067
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2068
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2069
+  %w12 = add <4 x i32> %w9, %bc11, !dbg !2070
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2071
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2072
+  %w15 = xor <4 x i32> %w12, %bc14, !dbg !2073
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2074
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2075
+  %w18 = xor <4 x i32> %w15, %bc17, !dbg !2076
+  store <4 x i32> %w18, ptr %buf, align 16, !tbaa !19, !dbg !2077
+  %e19 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 2, !dbg !2078
+  %l20 = load i32, ptr %e19, align 4, !tbaa !19, !dbg !2079
+  %r21 = insertelement <4 x i32> %w18, i32 %l20, i64 3, !dbg !2080
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !2081
+  ret <4 x i32> %r21, !dbg !2082
+}
+
+define i64 @kernel_89(ptr %grid) !dbg !2083 {
+entry:
+  br label %walk, !dbg !2084
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !2085
+  br i1 %c1, label %done, label %body, !dbg !2086
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !2087
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !2088
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !2089
+  %r5 = call i64 @kernel_85(ptr %pr2, i32 %n4), !dbg !2090
+  %a6 = add i64 %tot, %r5, !dbg !2091
+  %r7 = call i64 @kernel_80(ptr %pr2, i32 %n4), !dbg !2092
+  %a8 = add i64 %a6, %r7, !dbg !2093
+  store i64 %a8, ptr @g15, align 8, !tbaa !20, !dbg !2094
+  %tot.next = add i64 %a8, 1, !dbg !2095
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !2096
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !2097
+  br label %walk, !dbg !2098
+
+done:
+  ret i64 %tot, !dbg !2099
+}
+
+define i64 @kernel_90(ptr noalias %recs, i32 %n) !dbg !2100 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !2101
+  %nw2 = zext i32 %n to i64, !dbg !2102
+  br i1 %c1, label %loop, label %exit, !dbg !2103
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !2104
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !2105
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !2106
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !2107
+  %c7 = icmp slt i32 %a4, 53, !dbg !2108
+  br i1 %c7, label %then, label %else, !dbg !2109
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !2110
+  %y9 = and i64 %x8, %b6, !dbg !2111
+  br label %latch, !dbg !2112
+
+else:
+  %z10 = sub i64 %b6, 2, !dbg !2113
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !2114
+  br label %latch, !dbg !2115
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !2116
+  %i.next = add nuw nsw i64 %i, 1, !dbg !2117
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !2118
+  br i1 %d12, label %exit, label %loop, !dbg !2119, !llvm.loop !2120
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !2121
+}
+
+define void @kernel_91(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !2122 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !2123
+  br i1 %c1, label %outer, label %exit, !dbg !2124
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !2125
+  br label %inner, !dbg !2126
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !2127
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !2128
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !2129
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !2130
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !2131
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !2132
+  %j.next = add nuw nsw i64 %j, 1, !dbg !2133
+  %d8 = icmp eq i64 %j.next, %n, !dbg !2134
+  br i1 %d8, label %outer.latch, label %inner, !dbg !2135
+
+outer.latch:
+  %sc9 = fmul double %s.next, 3.500000e+00, !dbg !2136
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !2137
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !2138
+  %i.next = add nuw nsw i64 %i, 1, !dbg !2139
+  %d11 = icmp eq i64 %i.next, %n, !dbg !2140
+  br i1 %d11, label %exit, label %outer, !dbg !2141
+
+exit:
+  ret void, !dbg !2142
+}
+
+define i32 @kernel_92(i32 %op, i32 %x) !dbg !2143 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+  ], !dbg !2144
+
+case0:
+  %r1 = call i32 @kernel_87(i32 0, i32 %x), !dbg !2145
+  br label %join, !dbg !2146
+
+case1:
+  %r2 = call i32 @kernel_82(i32 1, i32 %x), !dbg !2147
+  br label %join, !dbg !2148
+
+case2:
+  %r3 = call i32 @kernel_82(i32 2, i32 %x), !dbg !2149
+  br label %join, !dbg !2150
+
+default:
+  %p4 = getelementptr inbounds [16 x i32], ptr @g40, i64 0, i64 13, !dbg !2151
+  %l5 = load i32, ptr %p4, align 4, !tbaa !19, !dbg !2152
+  %u6 = call i32 @llvm.umin.i32(i32 %l5, i32 %x), !dbg !2153
+  br label %join, !dbg !2154
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %u6, %default ]
+  ret i32 %res, !dbg !2155
+}
+
+define <4 x i32> @kernel_93(<4 x i32> %v, i32 %s) !dbg !2156 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !2157
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !2158
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2159
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2160
+  %w3 = or <4 x i32> %v, %bc2, !dbg !2161
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2162
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2163
+  %w6 = or <4 x i32> %w3, %bc5, !dbg !2164
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2165
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2166
+  %w9 = or <4 x i32> %w6, %bc8, !dbg !2167
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2168
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2169
+  %w12 = mul <4 x i32> %w9, %bc11, !dbg !2170
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2171
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2172
+  %w15 = and <4 x i32> %w12, %bc14, !dbg !2173
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2174
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2175
+  %w18 = or <4 x i32> %w15, %bc17, !dbg !2176
+  %sp19 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2177
+  %bc20 = shufflevector <4 x i32> %sp19, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2178
+  %w21 = add <4 x i32> %w18, %bc20, !dbg !2179
+  %sp22 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2180
+  %bc23 = shufflevector <4 x i32> %sp22, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2181
+  %w24 = or <4 x i32> %w21, %bc23, !dbg !2182
+  store <4 x i32> %w24, ptr %buf, align 16, !tbaa !19, !dbg !2183
+  %e25 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 1, !dbg !2184
+  %l26 = load i32, ptr %e25, align 4, !tbaa !19, !dbg !2185
+  %r27 = insertelement <4 x i32> %w24, i32 %l26, i64 3, !dbg !2186
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !2187
+  ret <4 x i32> %r27, !dbg !2188
+}
+
+define i64 @kernel_94(ptr %grid) !dbg !2189 {
+entry:
+  br label %walk, !dbg !2190
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !2191
+  br i1 %c1, label %done, label %body, !dbg !2192
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !2193
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !2194
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !2195
+  %r5 = call i64 @kernel_85(ptr %pr2, i32 %n4), !dbg !2196
+  %a6 = add i64 %tot, %r5, !dbg !2197
+  %r7 = call i64 @kernel_90(ptr %pr2, i32 %n4), !dbg !2198
+  %a8 = add i64 %a6, %r7, !dbg !2199
+  store i64 %a8, ptr @g47, align 8, !tbaa !20, !dbg !2200
+  %tot.next = add i64 %a8, 1, !dbg !2201
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !2202
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !2203
+  br label %walk, !dbg !2204
+
+done:
+  %pc10 = call i32 (ptr, ...) @printf(ptr @g22), !dbg !2205
+  ret i64 %tot, !dbg !2206
+}
+
+define i64 @kernel_95(ptr noalias %recs, i32 %n) !dbg !2207 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !2208
+  %nw2 = zext i32 %n to i64, !dbg !2209
+  br i1 %c1, label %loop, label %exit, !dbg !2210
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !2211
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !2212
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !2213
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !2214
+  %c7 = icmp slt i32 %a4, 57, !dbg !2215
+  br i1 %c7, label %then, label %else, !dbg !2216
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !2217
+  %y9 = and i64 %x8, %b6, !dbg !2218
+  br label %latch, !dbg !2219
+
+else:
+  %z10 = sub i64 %b6, 7, !dbg !2220
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !2221
+  br label %latch, !dbg !2222
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !2223
+  %i.next = add nuw nsw i64 %i, 1, !dbg !2224
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !2225
+  br i1 %d12, label %exit, label %loop, !dbg !2226, !llvm.loop !2227
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !2228
+}
+
+define void @kernel_96(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !2229 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !2230
+  br i1 %c1, label %outer, label %exit, !dbg !2231
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !2232
+  br label %inner, !dbg !2233
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !2234
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !2235
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !2236
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !2237
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !2238
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !2239
+  %j.next = add nuw nsw i64 %j, 1, !dbg !2240
+  %d8 = icmp eq i64 %j.next, %n, !dbg !2241
+  br i1 %d8, label %outer.latch, label %inner, !dbg !2242
+
+outer.latch:
+  %sc9 = fmul double %s.next, 5.500000e+00, !dbg !2243
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !2244
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !2245
+  %i.next = add nuw nsw i64 %i, 1, !dbg !2246
+  %d11 = icmp eq i64 %i.next, %n, !dbg !2247
+  br i1 %d11, label %exit, label %outer, !dbg !2248
+
+exit:
+  ret void, !dbg !2249
+}
+
+define i32 @kernel_97(i32 %op, i32 %x) !dbg !2250 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+    i32 3, label %case3
+    i32 4, label %case4
+    i32 5, label %case5
+  ], !dbg !2251
+
+case0:
+  %r1 = xor i32 %x, 14, !dbg !2252
+  br label %join, !dbg !2253
+
+case1:
+  %r2 = sub i32 %x, 15, !dbg !2254
+  br label %join, !dbg !2255
+
+case2:
+  %r3 = call i32 @kernel_87(i32 2, i32 %x), !dbg !2256
+  br label %join, !dbg !2257
+
+case3:
+  %r4 = call i32 @kernel_87(i32 3, i32 %x), !dbg !2258
+  br label %join, !dbg !2259
+
+case4:
+  %r5 = call i32 @kernel_87(i32 4, i32 %x), !dbg !2260
+  br label %join, !dbg !2261
+
+case5:
+  %r6 = call i32 @kernel_92(i32 5, i32 %x), !dbg !2262
+  br label %join, !dbg !2263
+
+default:
+  %p7 = getelementptr inbounds [16 x i32], ptr @g52, i64 0, i64 13, !dbg !2264
+  %l8 = load i32, ptr %p7, align 4, !tbaa !19, !dbg !2265
+  %u9 = call i32 @llvm.umin.i32(i32 %l8, i32 %x), !dbg !2266
+  br label %join, !dbg !2267
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %r4, %case3 ], [ %r5, %case4 ], [ %r6, %case5 ], [ %u9, %default ]
+  ret i32 %res, !dbg !2268
+}
+
+define <4 x i32> @kernel_98(<4 x i32> %v, i32 %s) !dbg !2269 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !2270
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !2271
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2272
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2273
+  %w3 = and <4 x i32> %v, %bc2, !dbg !2274
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2275
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2276
+  %w6 = or <4 x i32> %w3, %bc5, !dbg !2277
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2278
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2279
+  %w9 = xor <4 x i32> %w6, %bc8, !dbg !2280
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2281
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2282
+  %w12 = xor <4 x i32> %w9, %bc11, !dbg !2283
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2284
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2285
+  %w15 = and <4 x i32> %w12, %bc14, !dbg !2286
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2287
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2288
+  %w18 = xor <4 x i32> %w15, %bc17, !dbg !2289
+  %sp19 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2290
+  %bc20 = shufflevector <4 x i32> %sp19, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2291
+  %w21 = or <4 x i32> %w18, %bc20, !dbg !2292
+  %sp22 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2293
+  %bc23 = shufflevector <4 x i32> %sp22, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2294
+  %w24 = or <4 x i32> %w21, %bc23, !dbg !2295
+  %sp25 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2296
+  %bc26 = shufflevector <4 x i32> %sp25, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2297
+  %w27 = xor <4 x i32> %w24, %bc26, !dbg !2298
+  %sp28 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2299
+  %bc29 = shufflevector <4 x i32> %sp28, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2300
+  %w30 = xor <4 x i32> %w27, %bc29, !dbg !2301
+  %sp31 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2302
+  %bc32 = shufflevector <4 x i32> %sp31, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2303
+  %w33 = mul <4 x i32> %w30, %bc32, !dbg !2304
+  %sp34 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2305
+  %bc35 = shufflevector <4 x i32> %sp34, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2306
+  %w36 = or <4 x i32> %w33, %bc35, !dbg !2307
+  %sp37 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2308
+  %bc38 = shufflevector <4 x i32> %sp37, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2309
+  %w39 = or <4 x i32> %w36, %bc38, !dbg !2310
+  store <4 x i32> %w39, ptr %buf, align 16, !tbaa !19, !dbg !2311
+  %e40 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 3, !dbg !2312
+  %l41 = load i32, ptr %e40, align 4, !tbaa !19, !dbg !2313
+  %r42 = insertelement <4 x i32> %w39, i32 %l41, i64 3, !dbg !2314
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !2315
+  ret <4 x i32> %r42, !dbg !2316
+}
+
+define i64 @kernel_99(ptr %grid) !dbg !2317 {
+entry:
+  br label %walk, !dbg !2318
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !2319
+  br i1 %c1, label %done, label %body, !dbg !2320
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !2321
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !2322
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !2323
+  %r5 = call i64 @kernel_95(ptr %pr2, i32 %n4), !dbg !2324
+  %a6 = add i64 %tot, %r5, !dbg !2325
+  %r7 = call i64 @kernel_90(ptr %pr2, i32 %n4), !dbg !2326
+  %a8 = add i64 %a6, %r7, !dbg !2327
+  store i64 %a8, ptr @g63, align 8, !tbaa !20, !dbg !2328
+  %tot.next = add i64 %a8, 1, !dbg !2329
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !2330
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !2331
+  br label %walk, !dbg !2332
+
+done:
+  ret i64 %tot, !dbg !2333
+}
+
+define i64 @kernel_100(ptr noalias %recs, i32 %n) !dbg !2334 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !2335
+  %nw2 = zext i32 %n to i64, !dbg !2336
+  br i1 %c1, label %loop, label %exit, !dbg !2337
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !2338
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !2339
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !2340
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !2341
+  %c7 = icmp slt i32 %a4, 27, !dbg !2342
+  br i1 %c7, label %then, label %else, !dbg !2343
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !2344
+  %y9 = xor i64 %x8, %b6, !dbg !2345
+  br label %latch, !dbg !2346
+
+else:
+  %z10 = or i64 %b6, 10, !dbg !2347
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !2348
+  br label %latch, !dbg !2349
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !2350
+  %i.next = add nuw nsw i64 %i, 1, !dbg !2351
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !2352
+  br i1 %d12, label %exit, label %loop, !dbg !2353, !llvm.loop !2354
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !2355
+}
+
+define void @kernel_101(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !2356 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !2357
+  br i1 %c1, label %outer, label %exit, !dbg !2358
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !2359
+  br label %inner, !dbg !2360
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !2361
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !2362
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !2363
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !2364
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !2365
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !2366
+  %j.next = add nuw nsw i64 %j, 1, !dbg !2367
+  %d8 = icmp eq i64 %j.next, %n, !dbg !2368
+  br i1 %d8, label %outer.latch, label %inner, !dbg !2369
+
+outer.latch:
+  %sc9 = fmul double %s.next, 8.500000e+00, !dbg !2370
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !2371
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !2372
+  %i.next = add nuw nsw i64 %i, 1, !dbg !2373
+  %d11 = icmp eq i64 %i.next, %n, !dbg !2374
+  br i1 %d11, label %exit, label %outer, !dbg !2375
+
+exit:
+  ret void, !dbg !2376
+}
+
+define i32 @kernel_102(i32 %op, i32 %x) !dbg !2377 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+    i32 3, label %case3
+    i32 4, label %case4
+    i32 5, label %case5
+  ], !dbg !2378
+
+case0:
+  %r1 = shl i32 %x, 9, !dbg !2379
+  br label %join, !dbg !2380
+
+case1:
+  %r2 = ashr i32 %x, 10, !dbg !2381
+  br label %join, !dbg !2382
+
+case2:
+  %r3 = and i32 %x, 2, !dbg !2383
+  br label %join, !dbg !2384
+
+case3:
+  %r4 = shl i32 %x, 9, !dbg !2385
+  br label %join, !dbg !2386
+
+case4:
+  %r5 = call i32 @kernel_92(i32 4, i32 %x), !dbg !2387
+  br label %join, !dbg !2388
+
+case5:
+  %r6 = or i32 %x, 3, !dbg !2389
+  br label %join, !dbg !2390
+
+default:
+  %p7 = getelementptr inbounds [16 x i32], ptr @g24, i64 0, i64 3, !dbg !2391
+  %l8 = load i32, ptr %p7, align 4, !tbaa !19, !dbg !2392
+  %u9 = call i32 @llvm.umin.i32(i32 %l8, i32 %x), !dbg !2393
+  br label %join, !dbg !2394
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %r4, %case3 ], [ %r5, %case4 ], [ %r6, %case5 ], [ %u9, %default ]
+  ret i32 %res, !dbg !2395
+}
+
+define <4 x i32> @kernel_103(<4 x i32> %v, i32 %s) !dbg !2396 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !2397
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !2398
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2399
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2400
+  %w3 = and <4 x i32> %v, %bc2, !dbg !2401
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2402
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2403
+  %w6 = or <4 x i32> %w3, %bc5, !dbg !2404
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2405
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2406
+  %w9 = add <4 x i32> %w6, %bc8, !dbg !2407
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2408
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2409
+  %w12 = or <4 x i32> %w9, %bc11, !dbg !2410
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2411
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2412
+  %w15 = and <4 x i32> %w12, %bc14, !dbg !2413
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2414
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2415
+  %w18 = or <4 x i32> %w15, %bc17, !dbg !2416
+  %sp19 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2417
+  %bc20 = shufflevector <4 x i32> %sp19, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2418
+  %w21 = xor <4 x i32> %w18, %bc20, !dbg !2419
+  %sp22 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2420
+  %bc23 = shufflevector <4 x i32> %sp22, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2421
+  %w24 = add <4 x i32> %w21, %bc23, !dbg !2422
+  %sp25 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2423
+  %bc26 = shufflevector <4 x i32> %sp25, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2424
+  %w27 = add <4 x i32> %w24, %bc26, !dbg !2425
+  store <4 x i32> %w27, ptr %buf, align 16, !tbaa !19, !dbg !2426
+  %e28 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 3, !dbg !2427
+  %l29 = load i32, ptr %e28, align 4, !tbaa !19, !dbg !2428
+  %r30 = insertelement <4 x i32> %w27, i32 %l29, i64 3, !dbg !2429
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !2430
+  ret <4 x i32> %r30, !dbg !2431
+}
+
+define i64 @kernel_104(ptr %grid) !dbg !2432 {
+entry:
+  br label %walk, !dbg !2433
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !2434
+  br i1 %c1, label %done, label %body, !dbg !2435
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !2436
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !2437
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !2438
+  %r5 = call i64 @kernel_100(ptr %pr2, i32 %n4), !dbg !2439
+  %a6 = add i64 %tot, %r5, !dbg !2440
+  %r7 = call i64 @kernel_95(ptr %pr2, i32 %n4), !dbg !2441
+  %a8 = add i64 %a6, %r7, !dbg !2442
+  store i64 %a8, ptr @g39, align 8, !tbaa !20, !dbg !2443
+  %tot.next = add i64 %a8, 1, !dbg !2444
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !2445
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !2446
+  br label %walk, !dbg !2447
+
+done:
+  %pc10 = call i32 (ptr, ...) @printf(ptr @g6), !dbg !2448
+  ret i64 %tot, !dbg !2449
+}
+
+define i64 @kernel_105(ptr noalias %recs, i32 %n) !dbg !2450 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !2451
+  %nw2 = zext i32 %n to i64, !dbg !2452
+  br i1 %c1, label %loop, label %exit, !dbg !2453
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !2454
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !2455
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !2456
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !2457
+  %c7 = icmp slt i32 %a4, 38, !dbg !2458
+  br i1 %c7, label %then, label %else, !dbg !2459
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !2460
+  %y9 = xor i64 %x8, %b6, !dbg !2461
+  br label %latch, !dbg !2462
+
+else:
+  %z10 = mul i64 %b6, 9, !dbg !2463
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !2464
+  br label %latch, !dbg !2465
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !2466
+  %i.next = add nuw nsw i64 %i, 1, !dbg !2467
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !2468
+  br i1 %d12, label %exit, label %loop, !dbg !2469, !llvm.loop !2470
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !2471
+}
+
+define void @kernel_106(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !2472 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !2473
+  br i1 %c1, label %outer, label %exit, !dbg !2474
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !2475
+  br label %inner, !dbg !2476
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !2477
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !2478
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !2479
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !2480
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !2481
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !2482
+  %j.next = add nuw nsw i64 %j, 1, !dbg !2483
+  %d8 = icmp eq i64 %j.next, %n, !dbg !2484
+  br i1 %d8, label %outer.latch, label %inner, !dbg !2485
+
+outer.latch:
+  %sc9 = fmul double %s.next, 3.500000e+00, !dbg !2486
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !2487
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !2488
+  %i.next = add nuw nsw i64 %i, 1, !dbg !2489
+  %d11 = icmp eq i64 %i.next, %n, !dbg !2490
+  br i1 %d11, label %exit, label %outer, !dbg !2491
+
+exit:
+  ret void, !dbg !2492
+}
+
+define i32 @kernel_107(i32 %op, i32 %x) !dbg !2493 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+    i32 3, label %case3
+    i32 4, label %case4
+    i32 5, label %case5
+    i32 6, label %case6
+  ], !dbg !2494
+
+case0:
+  %r1 = call i32 @kernel_102(i32 0, i32 %x), !dbg !2495
+  br label %join, !dbg !2496
+
+case1:
+  %r2 = call i32 @kernel_97(i32 1, i32 %x), !dbg !2497
+  br label %join, !dbg !2498
+
+case2:
+  %r3 = call i32 @kernel_102(i32 2, i32 %x), !dbg !2499
+  br label %join, !dbg !2500
+
+case3:
+  %r4 = call i32 @kernel_102(i32 3, i32 %x), !dbg !2501
+  br label %join, !dbg !2502
+
+case4:
+  %r5 = call i32 @kernel_97(i32 4, i32 %x), !dbg !2503
+  br label %join, !dbg !2504
+
+case5:
+  %r6 = call i32 @kernel_97(i32 5, i32 %x), !dbg !2505
+  br label %join, !dbg !2506
+
+case6:
+  %r7 = call i32 @kernel_97(i32 6, i32 %x), !dbg !2507
+  br label %join, !dbg !2508
+
+default:
+  %p8 = getelementptr inbounds [16 x i32], ptr @g48, i64 0, i64 15, !dbg !2509
+  %l9 = load i32, ptr %p8, align 4, !tbaa !19, !dbg !2510
+  %u10 = call i32 @llvm.umin.i32(i32 %l9, i32 %x), !dbg !2511
+  br label %join, !dbg !2512
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %r4, %case3 ], [ %r5, %case4 ], [ %r6, %case5 ], [ %r7, %case6 ], [ %u10, %default ]
+  ret i32 %res, !dbg !2513
+}
+
+define <4 x i32> @kernel_108(<4 x i32> %v, i32 %s) !dbg !2514 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !2515
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !2516
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2517
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2518
+  %w3 = xor <4 x i32> %v, %bc2, !dbg !2519
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2520
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2521
+  %w6 = mul <4 x i32> %w3, %bc5, !dbg !2522
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2523
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2524
+  %w9 = add <4 x i32> %w6, %bc8, !dbg !2525
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2526
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2527
+  %w12 = or <4 x i32> %w9, %bc11, !dbg !2528
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2529
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2530
+  %w15 = or <4 x i32> %w12, %bc14, !dbg !2531
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2532
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2533
+  %w18 = add <4 x i32> %w15, %bc17, !dbg !2534
+  store <4 x i32> %w18, ptr %buf, align 16, !tbaa !19, !dbg !2535
+  %e19 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 0, !dbg !2536
+  %l20 = load i32, ptr %e19, align 4, !tbaa !19, !dbg !2537
+  %r21 = insertelement <4 x i32> %w18, i32 %l20, i64 3, !dbg !2538
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !2539
+  ret <4 x i32> %r21, !dbg !2540
+}
+
+define i64 @kernel_109(ptr %grid) !dbg !2541 {
+entry:
+  br label %walk, !dbg !2542
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !2543
+  br i1 %c1, label %done, label %body, !dbg !2544
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !2545
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !2546
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !2547
+  %r5 = call i64 @kernel_100(ptr %pr2, i32 %n4), !dbg !2548
+  %a6 = add i64 %tot, %r5, !dbg !2549
+  %r7 = call i64 @kernel_105(ptr %pr2, i32 %n4), !dbg !2550
+  %a8 = add i64 %a6, %r7, !dbg !2551
+  store i64 %a8, ptr @g23, align 8, !tbaa !20, !dbg !2552
+  %tot.next = add i64 %a8, 1, !dbg !2553
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !2554
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !2555
+  br label %walk, !dbg !2556
+
+done:
+  ret i64 %tot, !dbg !2557
+}
+
+define i64 @kernel_110(ptr noalias %recs, i32 %n) !dbg !2558 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !2559
+  %nw2 = zext i32 %n to i64, !dbg !2560
+  br i1 %c1, label %loop, label %exit, !dbg !2561
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !2562
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !2563
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !2564
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !2565
+  %c7 = icmp slt i32 %a4, 34, !dbg !2566
+  br i1 %c7, label %then, label %else, !dbg !2567
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !2568
+  %y9 = xor i64 %x8, %b6, !dbg !2569
+  br label %latch, !dbg !2570
+
+else:
+  %z10 = mul i64 %b6, 23, !dbg !2571
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !2572
+  br label %latch, !dbg !2573
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !2574
+  %i.next = add nuw nsw i64 %i, 1, !dbg !2575
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !2576
+  br i1 %d12, label %exit, label %loop, !dbg !2577, !llvm.loop !2578
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !2579
+}
+
+define void @kernel_111(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !2580 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !2581
+  br i1 %c1, label %outer, label %exit, !dbg !2582
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !2583
+  br label %inner, !dbg !2584
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !2585
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !2586
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !2587
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !2588
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !2589
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !2590
+  %j.next = add nuw nsw i64 %j, 1, !dbg !2591
+  %d8 = icmp eq i64 %j.next, %n, !dbg !2592
+  br i1 %d8, label %outer.latch, label %inner, !dbg !2593
+
+outer.latch:
+  %sc9 = fmul double %s.next, 6.500000e+00, !dbg !2594
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !2595
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !2596
+  %i.next = add nuw nsw i64 %i, 1, !dbg !2597
+  %d11 = icmp eq i64 %i.next, %n, !dbg !2598
+  br i1 %d11, label %exit, label %outer, !dbg !2599
+
+exit:
+  ret void, !dbg !2600
+}
+
+define i32 @kernel_112(i32 %op, i32 %x) !dbg !2601 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+  ], !dbg !2602
+
+case0:
+  %r1 = or i32 %x, 7, !dbg !2603
+  br label %join, !dbg !2604
+
+case1:
+  %r2 = add nsw i32 %x, 9, !dbg !2605
+  br label %join, !dbg !2606
+
+case2:
+  %r3 = call i32 @kernel_102(i32 2, i32 %x), !dbg !2607
+  br label %join, !dbg !2608
+
+default:
+  %p4 = getelementptr inbounds [16 x i32], ptr @g52, i64 0, i64 6, !dbg !2609
+  %l5 = load i32, ptr %p4, align 4, !tbaa !19, !dbg !2610
+  %u6 = call i32 @llvm.umin.i32(i32 %l5, i32 %x), !dbg !2611
+  br label %join, !dbg !2612
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %u6, %default ]
+  ret i32 %res, !dbg !2613
+}
+
+define <4 x i32> @kernel_113(<4 x i32> %v, i32 %s) !dbg !2614 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !2615
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !2616
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2617
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2618
+  %w3 = add <4 x i32> %v, %bc2, !dbg !2619
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2620
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2621
+  %w6 = xor <4 x i32> %w3, %bc5, !dbg !2622
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2623
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2624
+  %w9 = add <4 x i32> %w6, %bc8, !dbg !2625
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2626
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2627
+  %w12 = mul <4 x i32> %w9, %bc11, !dbg !2628
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2629
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2630
+  %w15 = or <4 x i32> %w12, %bc14, !dbg !2631
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2632
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2633
+  %w18 = add <4 x i32> %w15, %bc17, !dbg !2634
+  store <4 x i32> %w18, ptr %buf, align 16, !tbaa !19, !dbg !2635
+  %e19 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 2, !dbg !2636
+  %l20 = load i32, ptr %e19, align 4, !tbaa !19, !dbg !2637
+  %r21 = insertelement <4 x i32> %w18, i32 %l20, i64 3, !dbg !2638
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !2639
+  ret <4 x i32> %r21, !dbg !2640
+}
+
+define i64 @kernel_114(ptr %grid) !dbg !2641 {
+entry:
+  br label %walk, !dbg !2642
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !2643
+  br i1 %c1, label %done, label %body, !dbg !2644
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !2645
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !2646
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !2647
+  %r5 = call i64 @kernel_105(ptr %pr2, i32 %n4), !dbg !2648
+  %a6 = add i64 %tot, %r5, !dbg !2649
+  %r7 = call i64 @kernel_110(ptr %pr2, i32 %n4), !dbg !2650
+  %a8 = add i64 %a6, %r7, !dbg !2651
+  store i64 %a8, ptr @g3, align 8, !tbaa !20, !dbg !2652
+  %tot.next = add i64 %a8, 1, !dbg !2653
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !2654
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !2655
+  br label %walk, !dbg !2656
+
+done:
+  %pc10 = call i32 (ptr, ...) @printf(ptr @g42), !dbg !2657
+  ret i64 %tot, !dbg !2658
+}
+
+define i64 @kernel_115(ptr noalias %recs, i32 %n) !dbg !2659 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !2660
+  %nw2 = zext i32 %n to i64, !dbg !2661
+  br i1 %c1, label %loop, label %exit, !dbg !2662
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !2663
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !2664
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !2665
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !2666
+  %c7 = icmp slt i32 %a4, 59, !dbg !2667
+  br i1 %c7, label %then, label %else, !dbg !2668
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !2669
+  %y9 = add nsw i64 %x8, %b6, !dbg !2670
+  br label %latch, !dbg !2671
+
+else:
+  %z10 = add nsw i64 %b6, 11, !dbg !2672
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !2673
+  br label %latch, !dbg !2674
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !2675
+  %i.next = add nuw nsw i64 %i, 1, !dbg !2676
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !2677
+  br i1 %d12, label %exit, label %loop, !dbg !2678, !llvm.loop !2679
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !2680
+}
+
+define void @kernel_116(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !2681 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !2682
+  br i1 %c1, label %outer, label %exit, !dbg !2683
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !2684
+  br label %inner, !dbg !2685
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !2686
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !2687
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !2688
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !2689
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !2690
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !2691
+  %j.next = add nuw nsw i64 %j, 1, !dbg !2692
+  %d8 = icmp eq i64 %j.next, %n, !dbg !2693
+  br i1 %d8, label %outer.latch, label %inner, !dbg !2694
+
+outer.latch:
+  %sc9 = fmul double %s.next, 3.500000e+00, !dbg !2695
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !2696
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !2697
+  %i.next = add nuw nsw i64 %i, 1, !dbg !2698
+  %d11 = icmp eq i64 %i.next, %n, !dbg !2699
+  br i1 %d11, label %exit, label %outer, !dbg !2700
+
+exit:
+  ret void, !dbg !2701
+}
+
+define i32 @kernel_117(i32 %op, i32 %x) !dbg !2702 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+    i32 3, label %case3
+    i32 4, label %case4
+  ], !dbg !2703
+
+case0:
+  %r1 = call i32 @kernel_112(i32 0, i32 %x), !dbg !2704
+  br label %join, !dbg !2705
+
+case1:
+  %r2 = call i32 @kernel_112(i32 1, i32 %x), !dbg !2706
+  br label %join, !dbg !2707
+
+case2:
+  %r3 = lshr i32 %x, 1, !dbg !2708
+  br label %join, !dbg !2709
+
+case3:
+  %r4 = lshr i32 %x, 12, !dbg !2710
+  br label %join, !dbg !2711
+
+case4:
+  %r5 = and i32 %x, 11, !dbg !2712
+  br label %join, !dbg !2713
+
+default:
+  %p6 = getelementptr inbounds [16 x i32], ptr @g28, i64 0, i64 14, !dbg !2714
+  %l7 = load i32, ptr %p6, align 4, !tbaa !19, !dbg !2715
+  %u8 = call i32 @llvm.umin.i32(i32 %l7, i32 %x), !dbg !2716
+  br label %join, !dbg !2717
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %r4, %case3 ], [ %r5, %case4 ], [ %u8, %default ]
+  ret i32 %res, !dbg !2718
+}
+
+define <4 x i32> @kernel_118(<4 x i32> %v, i32 %s) !dbg !2719 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !2720
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !2721
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2722
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2723
+  %w3 = or <4 x i32> %v, %bc2, !dbg !2724
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2725
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2726
+  %w6 = or <4 x i32> %w3, %bc5, !dbg !2727
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2728
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2729
+  %w9 = add <4 x i32> %w6, %bc8, !dbg !2730
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2731
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2732
+  %w12 = add <4 x i32> %w9, %bc11, !dbg !2733
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2734
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2735
+  %w15 = mul <4 x i32> %w12, %bc14, !dbg !2736
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2737
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2738
+  %w18 = mul <4 x i32> %w15, %bc17, !dbg !2739
+  %sp19 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2740
+  %bc20 = shufflevector <4 x i32> %sp19, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2741
+  %w21 = add <4 x i32> %w18, %bc20, !dbg !2742
+  %sp22 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2743
+  %bc23 = shufflevector <4 x i32> %sp22, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2744
+  %w24 = and <4 x i32> %w21, %bc23, !dbg !2745
+  %sp25 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2746
+  %bc26 = shufflevector <4 x i32> %sp25, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2747
+  %w27 = mul <4 x i32> %w24, %bc26, !dbg !2748
+  %sp28 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2749
+  %bc29 = shufflevector <4 x i32> %sp28, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2750
+  %w30 = xor <4 x i32> %w27, %bc29, !dbg !2751
+  %sp31 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2752
+  %bc32 = shufflevector <4 x i32> %sp31, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2753
+  %w33 = mul <4 x i32> %w30, %bc32, !dbg !2754
+  %sp34 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2755
+  %bc35 = shufflevector <4 x i32> %sp34, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2756
+  %w36 = mul <4 x i32> %w33, %bc35, !dbg !2757
+  %sp37 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2758
+  %bc38 = shufflevector <4 x i32> %sp37, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2759
+  %w39 = or <4 x i32> %w36, %bc38, !dbg !2760
+  %sp40 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2761
+  %bc41 = shufflevector <4 x i32> %sp40, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2762
+  %w42 = or <4 x i32> %w39, %bc41, !dbg !2763
+  store <4 x i32> %w42, ptr %buf, align 16, !tbaa !19, !dbg !2764
+  %e43 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 3, !dbg !2765
+  %l44 = load i32, ptr %e43, align 4, !tbaa !19, !dbg !2766
+  %r45 = insertelement <4 x i32> %w42, i32 %l44, i64 3, !dbg !2767
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !2768
+  ret <4 x i32> %r45, !dbg !2769
+}
+
+define i64 @kernel_119(ptr %grid) !dbg !2770 {
+entry:
+  br label %walk, !dbg !2771
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !2772
+  br i1 %c1, label %done, label %body, !dbg !2773
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !2774
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !2775
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !2776
+  %r5 = call i64 @kernel_110(ptr %pr2, i32 %n4), !dbg !2777
+  %a6 = add i64 %tot, %r5, !dbg !2778
+  %r7 = call i64 @kernel_115(ptr %pr2, i32 %n4), !dbg !2779
+  %a8 = add i64 %a6, %r7, !dbg !2780
+  store i64 %a8, ptr @g59, align 8, !tbaa !20, !dbg !2781
+  %tot.next = add i64 %a8, 1, !dbg !2782
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !2783
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !2784
+  br label %walk, !dbg !2785
+
+done:
+  ret i64 %tot, !dbg !2786
+}
+
+define i64 @kernel_120(ptr noalias %recs, i32 %n) !dbg !2787 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !2788
+  %nw2 = zext i32 %n to i64, !dbg !2789
+  br i1 %c1, label %loop, label %exit, !dbg !2790
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !2791
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !2792
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !2793
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !2794
+  %c7 = icmp slt i32 %a4, 25, !dbg !2795
+  br i1 %c7, label %then, label %else, !dbg !2796
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !2797
+  %y9 = and i64 %x8, %b6, !dbg !2798
+  br label %latch, !dbg !2799
+
+else:
+  %z10 = xor i64 %b6, 5, !dbg !2800
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !2801
+  br label %latch, !dbg !2802
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !2803
+  %i.next = add nuw nsw i64 %i, 1, !dbg !2804
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !2805
+  br i1 %d12, label %exit, label %loop, !dbg !2806, !llvm.loop !2807
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !2808
+}
+
+define void @kernel_121(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !2809 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !2810
+  br i1 %c1, label %outer, label %exit, !dbg !2811
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !2812
+  br label %inner, !dbg !2813
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !2814
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !2815
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !2816
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !2817
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !2818
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !2819
+  %j.next = add nuw nsw i64 %j, 1, !dbg !2820
+  %d8 = icmp eq i64 %j.next, %n, !dbg !2821
+  br i1 %d8, label %outer.latch, label %inner, !dbg !2822
+
+outer.latch:
+  %sc9 = fmul double %s.next, 4.500000e+00, !dbg !2823
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !2824
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !2825
+  %i.next = add nuw nsw i64 %i, 1, !dbg !2826
+  %d11 = icmp eq i64 %i.next, %n, !dbg !2827
+  br i1 %d11, label %exit, label %outer, !dbg !2828
+
+exit:
+  ret void, !dbg !2829
+}
+
+define i32 @kernel_122(i32 %op, i32 %x) !dbg !2830 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+    i32 3, label %case3
+    i32 4, label %case4
+    i32 5, label %case5
+    i32 6, label %case6
+  ], !dbg !2831
+
+case0:
+  %r1 = lshr i32 %x, 6, !dbg !2832
+  br label %join, !dbg !2833
+
+case1:
+  %r2 = ashr i32 %x, 6, !dbg !2834
+  br label %join, !dbg !2835
+
+case2:
+  %r3 = sub i32 %x, 6, !dbg !2836
+  br label %join, !dbg !2837
+
+case3:
+  %r4 = call i32 @kernel_117(i32 3, i32 %x), !dbg !2838
+  br label %join, !dbg !2839
+
+case4:
+  %r5 = sub i32 %x, 3, !dbg !2840
+  br label %join, !dbg !2841
+
+case5:
+  %r6 = call i32 @kernel_112(i32 5, i32 %x), !dbg !2842
+  br label %join, !dbg !2843
+
+case6:
+  %r7 = and i32 %x, 11, !dbg !2844
+  br label %join, !dbg !2845
+
+default:
+  %p8 = getelementptr inbounds [16 x i32], ptr @g8, i64 0, i64 12, !dbg !2846
+  %l9 = load i32, ptr %p8, align 4, !tbaa !19, !dbg !2847
+  %u10 = call i32 @llvm.umin.i32(i32 %l9, i32 %x), !dbg !2848
+  br label %join, !dbg !2849
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %r4, %case3 ], [ %r5, %case4 ], [ %r6, %case5 ], [ %r7, %case6 ], [ %u10, %default ]
+  ret i32 %res, !dbg !2850
+}
+
+define <4 x i32> @kernel_123(<4 x i32> %v, i32 %s) !dbg !2851 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !2852
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !2853
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2854
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2855
+  %w3 = xor <4 x i32> %v, %bc2, !dbg !2856
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2857
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2858
+  %w6 = and <4 x i32> %w3, %bc5, !dbg !2859
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2860
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2861
+  %w9 = and <4 x i32> %w6, %bc8, !dbg !2862
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2863
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2864
+  %w12 = mul <4 x i32> %w9, %bc11, !dbg !2865
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2866
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2867
+  %w15 = xor <4 x i32> %w12, %bc14, !dbg !2868
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2869
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2870
+  %w18 = and <4 x i32> %w15, %bc17, !dbg !2871
+  %sp19 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2872
+  %bc20 = shufflevector <4 x i32> %sp19, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2873
+  %w21 = or <4 x i32> %w18, %bc20, !dbg !2874
+  %sp22 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2875
+  %bc23 = shufflevector <4 x i32> %sp22, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2876
+  %w24 = and <4 x i32> %w21, %bc23, !dbg !2877
+  %sp25 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2878
+  %bc26 = shufflevector <4 x i32> %sp25, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2879
+  %w27 = add <4 x i32> %w24, %bc26, !dbg !2880
+  store <4 x i32> %w27, ptr %buf, align 16, !tbaa !19, !dbg !2881
+  %e28 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 0, !dbg !2882
+  %l29 = load i32, ptr %e28, align 4, !tbaa !19, !dbg !2883
+  %r30 = insertelement <4 x i32> %w27, i32 %l29, i64 3, !dbg !2884
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !2885
+  ret <4 x i32> %r30, !dbg !2886
+}
+
+define i64 @kernel_124(ptr %grid) !dbg !2887 {
+entry:
+  br label %walk, !dbg !2888
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !2889
+  br i1 %c1, label %done, label %body, !dbg !2890
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !2891
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !2892
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !2893
+  %r5 = call i64 @kernel_120(ptr %pr2, i32 %n4), !dbg !2894
+  %a6 = add i64 %tot, %r5, !dbg !2895
+  %r7 = call i64 @kernel_115(ptr %pr2, i32 %n4), !dbg !2896
+  %a8 = add i64 %a6, %r7, !dbg !2897
+  store i64 %a8, ptr @g59, align 8, !tbaa !20, !dbg !2898
+  %tot.next = add i64 %a8, 1, !dbg !2899
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !2900
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !2901
+  br label %walk, !dbg !2902
+
+done:
+  %pc10 = call i32 (ptr, ...) @printf(ptr @g54), !dbg !2903
+  ret i64 %tot, !dbg !2904
+}
+
+define i64 @kernel_125(ptr noalias %recs, i32 %n) !dbg !2905 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !2906
+  %nw2 = zext i32 %n to i64, !dbg !2907
+  br i1 %c1, label %loop, label %exit, !dbg !2908
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !2909
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !2910
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !2911
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !2912
+  %c7 = icmp slt i32 %a4, 55, !dbg !2913
+  br i1 %c7, label %then, label %else, !dbg !2914
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !2915
+  %y9 = add nsw i64 %x8, %b6, !dbg !2916
+  br label %latch, !dbg !2917
+
+else:
+  %z10 = xor i64 %b6, 11, !dbg !2918
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !2919
+  br label %latch, !dbg !2920
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !2921
+  %i.next = add nuw nsw i64 %i, 1, !dbg !2922
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !2923
+  br i1 %d12, label %exit, label %loop, !dbg !2924, !llvm.loop !2925
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !2926
+}
+
+define void @kernel_126(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !2927 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !2928
+  br i1 %c1, label %outer, label %exit, !dbg !2929
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !2930
+  br label %inner, !dbg !2931
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !2932
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !2933
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !2934
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !2935
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !2936
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !2937
+  %j.next = add nuw nsw i64 %j, 1, !dbg !2938
+  %d8 = icmp eq i64 %j.next, %n, !dbg !2939
+  br i1 %d8, label %outer.latch, label %inner, !dbg !2940
+
+outer.latch:
+  %sc9 = fmul double %s.next, 5.500000e+00, !dbg !2941
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !2942
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !2943
+  %i.next = add nuw nsw i64 %i, 1, !dbg !2944
+  %d11 = icmp eq i64 %i.next, %n, !dbg !2945
+  br i1 %d11, label %exit, label %outer, !dbg !2946
+
+exit:
+  ret void, !dbg !2947
+}
+
+define i32 @kernel_127(i32 %op, i32 %x) !dbg !2948 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+    i32 3, label %case3
+    i32 4, label %case4
+    i32 5, label %case5
+    i32 6, label %case6
+  ], !dbg !2949
+
+case0:
+  %r1 = ashr i32 %x, 3, !dbg !2950
+  br label %join, !dbg !2951
+
+case1:
+  %r2 = ashr i32 %x, 5, !dbg !2952
+  br label %join, !dbg !2953
+
+case2:
+  %r3 = call i32 @kernel_117(i32 2, i32 %x), !dbg !2954
+  br label %join, !dbg !2955
+
+case3:
+  %r4 = call i32 @kernel_122(i32 3, i32 %x), !dbg !2956
+  br label %join, !dbg !2957
+
+case4:
+  %r5 = shl i32 %x, 6, !dbg !2958
+  br label %join, !dbg !2959
+
+case5:
+  %r6 = call i32 @kernel_122(i32 5, i32 %x), !dbg !2960
+  br label %join, !dbg !2961
+
+case6:
+  %r7 = call i32 @kernel_117(i32 6, i32 %x), !dbg !2962
+  br label %join, !dbg !2963
+
+default:
+  %p8 = getelementptr inbounds [16 x i32], ptr @g28, i64 0, i64 11, !dbg !2964
+  %l9 = load i32, ptr %p8, align 4, !tbaa !19, !dbg !2965
+  %u10 = call i32 @llvm.umin.i32(i32 %l9, i32 %x), !dbg !2966
+  br label %join, !dbg !2967
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %r4, %case3 ], [ %r5, %case4 ], [ %r6, %case5 ], [ %r7, %case6 ], [ %u10, %default ]
+  ret i32 %res, !dbg !2968
+}
+
+define <4 x i32> @kernel_128(<4 x i32> %v, i32 %s) !dbg !2969 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !2970
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !2971
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2972
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2973
+  %w3 = add <4 x i32> %v, %bc2, !dbg !2974
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2975
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2976
+  %w6 = or <4 x i32> %w3, %bc5, !dbg !2977
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2978
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2979
+  %w9 = and <4 x i32> %w6, %bc8, !dbg !2980
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2981
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2982
+  %w12 = add <4 x i32> %w9, %bc11, !dbg !2983
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2984
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2985
+  %w15 = and <4 x i32> %w12, %bc14, !dbg !2986
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2987
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2988
+  %w18 = xor <4 x i32> %w15, %bc17, !dbg !2989
+  %sp19 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2990
+  %bc20 = shufflevector <4 x i32> %sp19, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2991
+  %w21 = mul <4 x i32> %w18, %bc20, !dbg !2992
+  %sp22 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2993
+  %bc23 = shufflevector <4 x i32> %sp22, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2994
+  %w24 = and <4 x i32> %w21, %bc23, !dbg !2995
+  %sp25 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2996
+  %bc26 = shufflevector <4 x i32> %sp25, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !2997
+  %w27 = mul <4 x i32> %w24, %bc26, !dbg !2998
+  %sp28 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !2999
+  %bc29 = shufflevector <4 x i32> %sp28, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3000
+  %w30 = mul <4 x i32> %w27, %bc29, !dbg !3001
+  %sp31 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3002
+  %bc32 = shufflevector <4 x i32> %sp31, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3003
+  %w33 = xor <4 x i32> %w30, %bc32, !dbg !3004
+  store <4 x i32> %w33, ptr %buf, align 16, !tbaa !19, !dbg !3005
+  %e34 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 2, !dbg !3006
+  %l35 = load i32, ptr %e34, align 4, !tbaa !19, !dbg !3007
+  %r36 = insertelement <4 x i32> %w33, i32 %l35, i64 3, !dbg !3008
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !3009
+  ret <4 x i32> %r36, !dbg !3010
+}
+
+define i64 @kernel_129(ptr %grid) !dbg !3011 {
+entry:
+  br label %walk, !dbg !3012
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !3013
+  br i1 %c1, label %done, label %body, !dbg !3014
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !3015
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !3016
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !3017
+  %r5 = call i64 @kernel_120(ptr %pr2, i32 %n4), !dbg !3018
+  %a6 = add i64 %tot, %r5, !dbg !3019
+  %r7 = call i64 @kernel_125(ptr %pr2, i32 %n4), !dbg !3020
+  %a8 = add i64 %a6, %r7, !dbg !3021
+  store i64 %a8, ptr @g59, align 8, !tbaa !20, !dbg !3022
+  %tot.next = add i64 %a8, 1, !dbg !3023
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !3024
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !3025
+  br label %walk, !dbg !3026
+
+done:
+  ret i64 %tot, !dbg !3027
+}
+
+define i64 @kernel_130(ptr noalias %recs, i32 %n) !dbg !3028 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !3029
+  %nw2 = zext i32 %n to i64, !dbg !3030
+  br i1 %c1, label %loop, label %exit, !dbg !3031
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !3032
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !3033
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !3034
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !3035
+  %c7 = icmp slt i32 %a4, 12, !dbg !3036
+  br i1 %c7, label %then, label %else, !dbg !3037
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !3038
+  %y9 = and i64 %x8, %b6, !dbg !3039
+  br label %latch, !dbg !3040
+
+else:
+  %z10 = mul i64 %b6, 31, !dbg !3041
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !3042
+  br label %latch, !dbg !3043
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !3044
+  %i.next = add nuw nsw i64 %i, 1, !dbg !3045
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !3046
+  br i1 %d12, label %exit, label %loop, !dbg !3047, !llvm.loop !3048
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !3049
+}
+
+define void @kernel_131(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !3050 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !3051
+  br i1 %c1, label %outer, label %exit, !dbg !3052
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !3053
+  br label %inner, !dbg !3054
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !3055
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !3056
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !3057
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !3058
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !3059
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !3060
+  %j.next = add nuw nsw i64 %j, 1, !dbg !3061
+  %d8 = icmp eq i64 %j.next, %n, !dbg !3062
+  br i1 %d8, label %outer.latch, label %inner, !dbg !3063
+
+outer.latch:
+  %sc9 = fmul double %s.next, 5.500000e+00, !dbg !3064
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !3065
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !3066
+  %i.next = add nuw nsw i64 %i, 1, !dbg !3067
+  %d11 = icmp eq i64 %i.next, %n, !dbg !3068
+  br i1 %d11, label %exit, label %outer, !dbg !3069
+
+exit:
+  ret void, !dbg !3070
+}
+
+define i32 @kernel_132(i32 %op, i32 %x) !dbg !3071 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+  ], !dbg !3072
+
+case0:
+  %r1 = call i32 @kernel_122(i32 0, i32 %x), !dbg !3073
+  br label %join, !dbg !3074
+
+case1:
+  %r2 = call i32 @kernel_122(i32 1, i32 %x), !dbg !3075
+  br label %join, !dbg !3076
+
+case2:
+  %r3 = call i32 @kernel_122(i32 2, i32 %x), !dbg !3077
+  br label %join, !dbg !3078
+
+default:
+  %p4 = getelementptr inbounds [16 x i32], ptr @g40, i64 0, i64 9, !dbg !3079
+  %l5 = load i32, ptr %p4, align 4, !tbaa !19, !dbg !3080
+  %u6 = call i32 @llvm.umin.i32(i32 %l5, i32 %x), !dbg !3081
+  br label %join, !dbg !3082
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %u6, %default ]
+  ret i32 %res, !dbg !3083
+}
+
+define <4 x i32> @kernel_133(<4 x i32> %v, i32 %s) !dbg !3084 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !3085
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !3086
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3087
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3088
+  %w3 = add <4 x i32> %v, %bc2, !dbg !3089
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3090
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3091
+  %w6 = add <4 x i32> %w3, %bc5, !dbg !3092
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3093
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3094
+  %w9 = add <4 x i32> %w6, %bc8, !dbg !3095
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3096
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3097
+  %w12 = or <4 x i32> %w9, %bc11, !dbg !3098
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3099
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3100
+  %w15 = mul <4 x i32> %w12, %bc14, !dbg !3101
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3102
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3103
+  %w18 = mul <4 x i32> %w15, %bc17, !dbg !3104
+  store <4 x i32> %w18, ptr %buf, align 16, !tbaa !19, !dbg !3105
+  %e19 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 3, !dbg !3106
+  %l20 = load i32, ptr %e19, align 4, !tbaa !19, !dbg !3107
+  %r21 = insertelement <4 x i32> %w18, i32 %l20, i64 3, !dbg !3108
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !3109
+  ret <4 x i32> %r21, !dbg !3110
+}
+
+define i64 @kernel_134(ptr %grid) !dbg !3111 {
+entry:
+  br label %walk, !dbg !3112
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !3113
+  br i1 %c1, label %done, label %body, !dbg !3114
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !3115
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !3116
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !3117
+  %r5 = call i64 @kernel_125(ptr %pr2, i32 %n4), !dbg !3118
+  %a6 = add i64 %tot, %r5, !dbg !3119
+  %r7 = call i64 @kernel_130(ptr %pr2, i32 %n4), !dbg !3120
+  %a8 = add i64 %a6, %r7, !dbg !3121
+  store i64 %a8, ptr @g63, align 8, !tbaa !20, !dbg !3122
+  %tot.next = add i64 %a8, 1, !dbg !3123
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !3124
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !3125
+  br label %walk, !dbg !3126
+
+done:
+  %pc10 = call i32 (ptr, ...) @printf(ptr @g14), !dbg !3127
+  ret i64 %tot, !dbg !3128
+}
+
+define i64 @kernel_135(ptr noalias %recs, i32 %n) !dbg !3129 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !3130
+  %nw2 = zext i32 %n to i64, !dbg !3131
+  br i1 %c1, label %loop, label %exit, !dbg !3132
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !3133
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !3134
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !3135
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !3136
+  %c7 = icmp slt i32 %a4, 60, !dbg !3137
+  br i1 %c7, label %then, label %else, !dbg !3138
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !3139
+  %y9 = mul i64 %x8, %b6, !dbg !3140
+  br label %latch, !dbg !3141
+
+else:
+  %z10 = xor i64 %b6, 23, !dbg !3142
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !3143
+  br label %latch, !dbg !3144
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !3145
+  %i.next = add nuw nsw i64 %i, 1, !dbg !3146
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !3147
+  br i1 %d12, label %exit, label %loop, !dbg !3148, !llvm.loop !3149
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !3150
+}
+
+define void @kernel_136(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !3151 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !3152
+  br i1 %c1, label %outer, label %exit, !dbg !3153
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !3154
+  br label %inner, !dbg !3155
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !3156
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !3157
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !3158
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !3159
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !3160
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !3161
+  %j.next = add nuw nsw i64 %j, 1, !dbg !3162
+  %d8 = icmp eq i64 %j.next, %n, !dbg !3163
+  br i1 %d8, label %outer.latch, label %inner, !dbg !3164
+
+outer.latch:
+  %sc9 = fmul double %s.next, 7.500000e+00, !dbg !3165
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !3166
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !3167
+  %i.next = add nuw nsw i64 %i, 1, !dbg !3168
+  %d11 = icmp eq i64 %i.next, %n, !dbg !3169
+  br i1 %d11, label %exit, label %outer, !dbg !3170
+
+exit:
+  ret void, !dbg !3171
+}
+
+define i32 @kernel_137(i32 %op, i32 %x) !dbg !3172 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+    i32 3, label %case3
+  ], !dbg !3173
+
+case0:
+  %r1 = call i32 @kernel_132(i32 0, i32 %x), !dbg !3174
+  br label %join, !dbg !3175
+
+case1:
+  %r2 = shl i32 %x, 7, !dbg !3176
+  br label %join, !dbg !3177
+
+case2:
+  %r3 = call i32 @kernel_127(i32 2, i32 %x), !dbg !3178
+  br label %join, !dbg !3179
+
+case3:
+  %r4 = ashr i32 %x, 14, !dbg !3180
+  br label %join, !dbg !3181
+
+default:
+  %p5 = getelementptr inbounds [16 x i32], ptr @g12, i64 0, i64 7, !dbg !3182
+  %l6 = load i32, ptr %p5, align 4, !tbaa !19, !dbg !3183
+  %u7 = call i32 @llvm.umin.i32(i32 %l6, i32 %x), !dbg !3184
+  br label %join, !dbg !3185
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %r4, %case3 ], [ %u7, %default ]
+  ret i32 %res, !dbg !3186
+}
+
+define <4 x i32> @kernel_138(<4 x i32> %v, i32 %s) !dbg !3187 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !3188
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !3189
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3190
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3191
+  %w3 = and <4 x i32> %v, %bc2, !dbg !3192
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3193
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3194
+  %w6 = add <4 x i32> %w3, %bc5, !dbg !3195
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3196
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3197
+  %w9 = mul <4 x i32> %w6, %bc8, !dbg !3198
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3199
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3200
+  %w12 = xor <4 x i32> %w9, %bc11, !dbg !3201
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3202
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3203
+  %w15 = add <4 x i32> %w12, %bc14, !dbg !3204
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3205
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3206
+  %w18 = or <4 x i32> %w15, %bc17, !dbg !3207
+  %sp19 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3208
+  %bc20 = shufflevector <4 x i32> %sp19, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3209
+  %w21 = mul <4 x i32> %w18, %bc20, !dbg !3210
+  %sp22 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3211
+  %bc23 = shufflevector <4 x i32> %sp22, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3212
+  %w24 = add <4 x i32> %w21, %bc23, !dbg !3213
+  store <4 x i32> %w24, ptr %buf, align 16, !tbaa !19, !dbg !3214
+  %e25 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 2, !dbg !3215
+  %l26 = load i32, ptr %e25, align 4, !tbaa !19, !dbg !3216
+  %r27 = insertelement <4 x i32> %w24, i32 %l26, i64 3, !dbg !3217
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !3218
+  ret <4 x i32> %r27, !dbg !3219
+}
+
+define i64 @kernel_139(ptr %grid) !dbg !3220 {
+entry:
+  br label %walk, !dbg !3221
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !3222
+  br i1 %c1, label %done, label %body, !dbg !3223
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !3224
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !3225
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !3226
+  %r5 = call i64 @kernel_130(ptr %pr2, i32 %n4), !dbg !3227
+  %a6 = add i64 %tot, %r5, !dbg !3228
+  %r7 = call i64 @kernel_135(ptr %pr2, i32 %n4), !dbg !3229
+  %a8 = add i64 %a6, %r7, !dbg !3230
+  store i64 %a8, ptr @g43, align 8, !tbaa !20, !dbg !3231
+  %tot.next = add i64 %a8, 1, !dbg !3232
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !3233
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !3234
+  br label %walk, !dbg !3235
+
+done:
+  ret i64 %tot, !dbg !3236
+}
+
+define i64 @kernel_140(ptr noalias %recs, i32 %n) !dbg !3237 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !3238
+  %nw2 = zext i32 %n to i64, !dbg !3239
+  br i1 %c1, label %loop, label %exit, !dbg !3240
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !3241
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !3242
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !3243
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !3244
+  %c7 = icmp slt i32 %a4, 64, !dbg !3245
+  br i1 %c7, label %then, label %else, !dbg !3246
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !3247
+  %y9 = mul i64 %x8, %b6, !dbg !3248
+  br label %latch, !dbg !3249
+
+else:
+  %z10 = or i64 %b6, 27, !dbg !3250
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !3251
+  br label %latch, !dbg !3252
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !3253
+  %i.next = add nuw nsw i64 %i, 1, !dbg !3254
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !3255
+  br i1 %d12, label %exit, label %loop, !dbg !3256, !llvm.loop !3257
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !3258
+}
+
+define void @kernel_141(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !3259 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !3260
+  br i1 %c1, label %outer, label %exit, !dbg !3261
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !3262
+  br label %inner, !dbg !3263
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !3264
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !3265
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !3266
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !3267
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !3268
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !3269
+  %j.next = add nuw nsw i64 %j, 1, !dbg !3270
+  %d8 = icmp eq i64 %j.next, %n, !dbg !3271
+  br i1 %d8, label %outer.latch, label %inner, !dbg !3272
+
+outer.latch:
+  %sc9 = fmul double %s.next, 6.500000e+00, !dbg !3273
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !3274
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !3275
+  %i.next = add nuw nsw i64 %i, 1, !dbg !3276
+  %d11 = icmp eq i64 %i.next, %n, !dbg !3277
+  br i1 %d11, label %exit, label %outer, !dbg !3278
+
+exit:
+  ret void, !dbg !3279
+}
+
+define i32 @kernel_142(i32 %op, i32 %x) !dbg !3280 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+    i32 3, label %case3
+    i32 4, label %case4
+    i32 5, label %case5
+  ], !dbg !3281
+
+case0:
+  %r1 = shl i32 %x, 12, !dbg !3282
+  br label %join, !dbg !3283
+
+case1:
+  %r2 = call i32 @kernel_137(i32 1, i32 %x), !dbg !3284
+  br label %join, !dbg !3285
+
+case2:
+  %r3 = call i32 @kernel_132(i32 2, i32 %x), !dbg !3286
+  br label %join, !dbg !3287
+
+case3:
+  %r4 = call i32 @kernel_137(i32 3, i32 %x), !dbg !3288
+  br label %join, !dbg !3289
+
+case4:
+  %r5 = call i32 @kernel_132(i32 4, i32 %x), !dbg !3290
+  br label %join, !dbg !3291
+
+case5:
+  %r6 = call i32 @kernel_132(i32 5, i32 %x), !dbg !3292
+  br label %join, !dbg !3293
+
+default:
+  %p7 = getelementptr inbounds [16 x i32], ptr @g32, i64 0, i64 2, !dbg !3294
+  %l8 = load i32, ptr %p7, align 4, !tbaa !19, !dbg !3295
+  %u9 = call i32 @llvm.umin.i32(i32 %l8, i32 %x), !dbg !3296
+  br label %join, !dbg !3297
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %r4, %case3 ], [ %r5, %case4 ], [ %r6, %case5 ], [ %u9, %default ]
+  ret i32 %res, !dbg !3298
+}
+
+define <4 x i32> @kernel_143(<4 x i32> %v, i32 %s) !dbg !3299 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !3300
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !3301
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3302
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3303
+  %w3 = or <4 x i32> %v, %bc2, !dbg !3304
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3305
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3306
+  %w6 = add <4 x i32> %w3, %bc5, !dbg !3307
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3308
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3309
+  %w9 = and <4 x i32> %w6, %bc8, !dbg !3310
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3311
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3312
+  %w12 = xor <4 x i32> %w9, %bc11, !dbg !3313
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3314
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3315
+  %w15 = xor <4 x i32> %w12, %bc14, !dbg !3316
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3317
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3318
+  %w18 = xor <4 x i32> %w15, %bc17, !dbg !3319
+  %sp19 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3320
+  %bc20 = shufflevector <4 x i32> %sp19, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3321
+  %w21 = and <4 x i32> %w18, %bc20, !dbg !3322
+  %sp22 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3323
+  %bc23 = shufflevector <4 x i32> %sp22, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3324
+  %w24 = add <4 x i32> %w21, %bc23, !dbg !3325
+  %sp25 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3326
+  %bc26 = shufflevector <4 x i32> %sp25, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3327
+  %w27 = and <4 x i32> %w24, %bc26, !dbg !3328
+  %sp28 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3329
+  %bc29 = shufflevector <4 x i32> %sp28, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3330
+  %w30 = xor <4 x i32> %w27, %bc29, !dbg !3331
+  %sp31 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3332
+  %bc32 = shufflevector <4 x i32> %sp31, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3333
+  %w33 = mul <4 x i32> %w30, %bc32, !dbg !3334
+  %sp34 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3335
+  %bc35 = shufflevector <4 x i32> %sp34, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3336
+  %w36 = and <4 x i32> %w33, %bc35, !dbg !3337
+  %sp37 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3338
+  %bc38 = shufflevector <4 x i32> %sp37, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3339
+  %w39 = or <4 x i32> %w36, %bc38, !dbg !3340
+  store <4 x i32> %w39, ptr %buf, align 16, !tbaa !19, !dbg !3341
+  %e40 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 3, !dbg !3342
+  %l41 = load i32, ptr %e40, align 4, !tbaa !19, !dbg !3343
+  %r42 = insertelement <4 x i32> %w39, i32 %l41, i64 3, !dbg !3344
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !3345
+  ret <4 x i32> %r42, !dbg !3346
+}
+
+define i64 @kernel_144(ptr %grid) !dbg !3347 {
+entry:
+  br label %walk, !dbg !3348
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !3349
+  br i1 %c1, label %done, label %body, !dbg !3350
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !3351
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !3352
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !3353
+  %r5 = call i64 @kernel_135(ptr %pr2, i32 %n4), !dbg !3354
+  %a6 = add i64 %tot, %r5, !dbg !3355
+  %r7 = call i64 @kernel_140(ptr %pr2, i32 %n4), !dbg !3356
+  %a8 = add i64 %a6, %r7, !dbg !3357
+  store i64 %a8, ptr @g23, align 8, !tbaa !20, !dbg !3358
+  %tot.next = add i64 %a8, 1, !dbg !3359
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !3360
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !3361
+  br label %walk, !dbg !3362
+
+done:
+  %pc10 = call i32 (ptr, ...) @printf(ptr @g26), !dbg !3363
+  ret i64 %tot, !dbg !3364
+}
+
+define i64 @kernel_145(ptr noalias %recs, i32 %n) !dbg !3365 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !3366
+  %nw2 = zext i32 %n to i64, !dbg !3367
+  br i1 %c1, label %loop, label %exit, !dbg !3368
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !3369
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !3370
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !3371
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !3372
+  %c7 = icmp slt i32 %a4, 55, !dbg !3373
+  br i1 %c7, label %then, label %else, !dbg !3374
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !3375
+  %y9 = mul i64 %x8, %b6, !dbg !3376
+  br label %latch, !dbg !3377
+
+else:
+  %z10 = sub i64 %b6, 23, !dbg !3378
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !3379
+  br label %latch, !dbg !3380
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !3381
+  %i.next = add nuw nsw i64 %i, 1, !dbg !3382
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !3383
+  br i1 %d12, label %exit, label %loop, !dbg !3384, !llvm.loop !3385
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !3386
+}
+
+define void @kernel_146(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !3387 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !3388
+  br i1 %c1, label %outer, label %exit, !dbg !3389
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !3390
+  br label %inner, !dbg !3391
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !3392
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !3393
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !3394
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !3395
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !3396
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !3397
+  %j.next = add nuw nsw i64 %j, 1, !dbg !3398
+  %d8 = icmp eq i64 %j.next, %n, !dbg !3399
+  br i1 %d8, label %outer.latch, label %inner, !dbg !3400
+
+outer.latch:
+  %sc9 = fmul double %s.next, 8.500000e+00, !dbg !3401
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !3402
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !3403
+  %i.next = add nuw nsw i64 %i, 1, !dbg !3404
+  %d11 = icmp eq i64 %i.next, %n, !dbg !3405
+  br i1 %d11, label %exit, label %outer, !dbg !3406
+
+exit:
+  ret void, !dbg !3407
+}
+
+define i32 @kernel_147(i32 %op, i32 %x) !dbg !3408 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+    i32 3, label %case3
+    i32 4, label %case4
+  ], !dbg !3409
+
+case0:
+  %r1 = add nsw i32 %x, 11, !dbg !3410
+  br label %join, !dbg !3411
+
+case1:
+  %r2 = call i32 @kernel_142(i32 1, i32 %x), !dbg !3412
+  br label %join, !dbg !3413
+
+case2:
+  %r3 = mul i32 %x, 3, !dbg !3414
+  br label %join, !dbg !3415
+
+case3:
+  %r4 = add nsw i32 %x, 9, !dbg !3416
+  br label %join, !dbg !3417
+
+case4:
+  %r5 = mul i32 %x, 5, !dbg !3418
+  br label %join, !dbg !3419
+
+default:
+  %p6 = getelementptr inbounds [16 x i32], ptr @g16, i64 0, i64 0, !dbg !3420
+  %l7 = load i32, ptr %p6, align 4, !tbaa !19, !dbg !3421
+  %u8 = call i32 @llvm.umin.i32(i32 %l7, i32 %x), !dbg !3422
+  br label %join, !dbg !3423
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %r4, %case3 ], [ %r5, %case4 ], [ %u8, %default ]
+  ret i32 %res, !dbg !3424
+}
+
+define <4 x i32> @kernel_148(<4 x i32> %v, i32 %s) !dbg !3425 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !3426
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !3427
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3428
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3429
+  %w3 = add <4 x i32> %v, %bc2, !dbg !3430
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3431
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3432
+  %w6 = add <4 x i32> %w3, %bc5, !dbg !3433
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3434
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3435
+  %w9 = and <4 x i32> %w6, %bc8, !dbg !3436
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3437
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3438
+  %w12 = xor <4 x i32> %w9, %bc11, !dbg !3439
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3440
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3441
+  %w15 = and <4 x i32> %w12, %bc14, !dbg !3442
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3443
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3444
+  %w18 = mul <4 x i32> %w15, %bc17, !dbg !3445
+  %sp19 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3446
+  %bc20 = shufflevector <4 x i32> %sp19, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3447
+  %w21 = and <4 x i32> %w18, %bc20, !dbg !3448
+  %sp22 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3449
+  %bc23 = shufflevector <4 x i32> %sp22, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3450
+  %w24 = mul <4 x i32> %w21, %bc23, !dbg !3451
+  %sp25 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3452
+  %bc26 = shufflevector <4 x i32> %sp25, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3453
+  %w27 = mul <4 x i32> %w24, %bc26, !dbg !3454
+  %sp28 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3455
+  %bc29 = shufflevector <4 x i32> %sp28, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3456
+  %w30 = or <4 x i32> %w27, %bc29, !dbg !3457
+  %sp31 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3458
+  %bc32 = shufflevector <4 x i32> %sp31, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3459
+  %w33 = and <4 x i32> %w30, %bc32, !dbg !3460
+  %sp34 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3461
+  %bc35 = shufflevector <4 x i32> %sp34, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3462
+  %w36 = and <4 x i32> %w33, %bc35, !dbg !3463
+  store <4 x i32> %w36, ptr %buf, align 16, !tbaa !19, !dbg !3464
+  %e37 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 0, !dbg !3465
+  %l38 = load i32, ptr %e37, align 4, !tbaa !19, !dbg !3466
+  %r39 = insertelement <4 x i32> %w36, i32 %l38, i64 3, !dbg !3467
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !3468
+  ret <4 x i32> %r39, !dbg !3469
+}
+
+define i64 @kernel_149(ptr %grid) !dbg !3470 {
+entry:
+  br label %walk, !dbg !3471
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !3472
+  br i1 %c1, label %done, label %body, !dbg !3473
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !3474
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !3475
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !3476
+  %r5 = call i64 @kernel_145(ptr %pr2, i32 %n4), !dbg !3477
+  %a6 = add i64 %tot, %r5, !dbg !3478
+  %r7 = call i64 @kernel_140(ptr %pr2, i32 %n4), !dbg !3479
+  %a8 = add i64 %a6, %r7, !dbg !3480
+  store i64 %a8, ptr @g23, align 8, !tbaa !20, !dbg !3481
+  %tot.next = add i64 %a8, 1, !dbg !3482
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !3483
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !3484
+  br label %walk, !dbg !3485
+
+done:
+  ret i64 %tot, !dbg !3486
+}
+
+define i64 @kernel_150(ptr noalias %recs, i32 %n) !dbg !3487 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !3488
+  %nw2 = zext i32 %n to i64, !dbg !3489
+  br i1 %c1, label %loop, label %exit, !dbg !3490
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !3491
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !3492
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !3493
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !3494
+  %c7 = icmp slt i32 %a4, 52, !dbg !3495
+  br i1 %c7, label %then, label %else, !dbg !3496
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !3497
+  %y9 = mul i64 %x8, %b6, !dbg !3498
+  br label %latch, !dbg !3499
+
+else:
+  %z10 = add nsw i64 %b6, 29, !dbg !3500
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !3501
+  br label %latch, !dbg !3502
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !3503
+  %i.next = add nuw nsw i64 %i, 1, !dbg !3504
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !3505
+  br i1 %d12, label %exit, label %loop, !dbg !3506, !llvm.loop !3507
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !3508
+}
+
+define void @kernel_151(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !3509 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !3510
+  br i1 %c1, label %outer, label %exit, !dbg !3511
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !3512
+  br label %inner, !dbg !3513
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !3514
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !3515
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !3516
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !3517
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !3518
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !3519
+  %j.next = add nuw nsw i64 %j, 1, !dbg !3520
+  %d8 = icmp eq i64 %j.next, %n, !dbg !3521
+  br i1 %d8, label %outer.latch, label %inner, !dbg !3522
+
+outer.latch:
+  %sc9 = fmul double %s.next, 8.500000e+00, !dbg !3523
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !3524
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !3525
+  %i.next = add nuw nsw i64 %i, 1, !dbg !3526
+  %d11 = icmp eq i64 %i.next, %n, !dbg !3527
+  br i1 %d11, label %exit, label %outer, !dbg !3528
+
+exit:
+  ret void, !dbg !3529
+}
+
+define i32 @kernel_152(i32 %op, i32 %x) !dbg !3530 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+  ], !dbg !3531
+
+case0:
+  %r1 = and i32 %x, 14, !dbg !3532
+  br label %join, !dbg !3533
+
+case1:
+  %r2 = call i32 @kernel_142(i32 1, i32 %x), !dbg !3534
+  br label %join, !dbg !3535
+
+case2:
+  %r3 = call i32 @kernel_147(i32 2, i32 %x), !dbg !3536
+  br label %join, !dbg !3537
+
+default:
+  %p4 = getelementptr inbounds [16 x i32], ptr @g32, i64 0, i64 6, !dbg !3538
+  %l5 = load i32, ptr %p4, align 4, !tbaa !19, !dbg !3539
+  %u6 = call i32 @llvm.umin.i32(i32 %l5, i32 %x), !dbg !3540
+  br label %join, !dbg !3541
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %u6, %default ]
+  ret i32 %res, !dbg !3542
+}
+
+define <4 x i32> @kernel_153(<4 x i32> %v, i32 %s) !dbg !3543 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !3544
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !3545
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3546
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3547
+  %w3 = or <4 x i32> %v, %bc2, !dbg !3548
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3549
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3550
+  %w6 = and <4 x i32> %w3, %bc5, !dbg !3551
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3552
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3553
+  %w9 = xor <4 x i32> %w6, %bc8, !dbg !3554
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3555
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3556
+  %w12 = or <4 x i32> %w9, %bc11, !dbg !3557
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3558
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3559
+  %w15 = xor <4 x i32> %w12, %bc14, !dbg !3560
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3561
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3562
+  %w18 = and <4 x i32> %w15, %bc17, !dbg !3563
+  %sp19 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3564
+  %bc20 = shufflevector <4 x i32> %sp19, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3565
+  %w21 = and <4 x i32> %w18, %bc20, !dbg !3566
+  %sp22 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3567
+  %bc23 = shufflevector <4 x i32> %sp22, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3568
+  %w24 = xor <4 x i32> %w21, %bc23, !dbg !3569
+  %sp25 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3570
+  %bc26 = shufflevector <4 x i32> %sp25, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3571
+  %w27 = mul <4 x i32> %w24, %bc26, !dbg !3572
+  %sp28 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3573
+  %bc29 = shufflevector <4 x i32> %sp28, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3574
+  %w30 = mul <4 x i32> %w27, %bc29, !dbg !3575
+  %sp31 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3576
+  %bc32 = shufflevector <4 x i32> %sp31, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3577
+  %w33 = mul <4 x i32> %w30, %bc32, !dbg !3578
+  %sp34 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3579
+  %bc35 = shufflevector <4 x i32> %sp34, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3580
+  %w36 = and <4 x i32> %w33, %bc35, !dbg !3581
+  store <4 x i32> %w36, ptr %buf, align 16, !tbaa !19, !dbg !3582
+  %e37 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 2, !dbg !3583
+  %l38 = load i32, ptr %e37, align 4, !tbaa !19, !dbg !3584
+  %r39 = insertelement <4 x i32> %w36, i32 %l38, i64 3, !dbg !3585
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !3586
+  ret <4 x i32> %r39, !dbg !3587
+}
+
+define i64 @kernel_154(ptr %grid) !dbg !3588 {
+entry:
+  br label %walk, !dbg !3589
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !3590
+  br i1 %c1, label %done, label %body, !dbg !3591
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !3592
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !3593
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !3594
+  %r5 = call i64 @kernel_150(ptr %pr2, i32 %n4), !dbg !3595
+  %a6 = add i64 %tot, %r5, !dbg !3596
+  %r7 = call i64 @kernel_145(ptr %pr2, i32 %n4), !dbg !3597
+  %a8 = add i64 %a6, %r7, !dbg !3598
+  store i64 %a8, ptr @g19, align 8, !tbaa !20, !dbg !3599
+  %tot.next = add i64 %a8, 1, !dbg !3600
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !3601
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !3602
+  br label %walk, !dbg !3603
+
+done:
+  %pc10 = call i32 (ptr, ...) @printf(ptr @g30), !dbg !3604
+  ret i64 %tot, !dbg !3605
+}
+
+define i64 @kernel_155(ptr noalias %recs, i32 %n) !dbg !3606 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !3607
+  %nw2 = zext i32 %n to i64, !dbg !3608
+  br i1 %c1, label %loop, label %exit, !dbg !3609
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !3610
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !3611
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !3612
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !3613
+  %c7 = icmp slt i32 %a4, 64, !dbg !3614
+  br i1 %c7, label %then, label %else, !dbg !3615
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !3616
+  %y9 = and i64 %x8, %b6, !dbg !3617
+  br label %latch, !dbg !3618
+
+else:
+  %z10 = or i64 %b6, 30, !dbg !3619
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !3620
+  br label %latch, !dbg !3621
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !3622
+  %i.next = add nuw nsw i64 %i, 1, !dbg !3623
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !3624
+  br i1 %d12, label %exit, label %loop, !dbg !3625, !llvm.loop !3626
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !3627
+}
+
+define void @kernel_156(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !3628 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !3629
+  br i1 %c1, label %outer, label %exit, !dbg !3630
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !3631
+  br label %inner, !dbg !3632
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !3633
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !3634
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !3635
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !3636
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !3637
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !3638
+  %j.next = add nuw nsw i64 %j, 1, !dbg !3639
+  %d8 = icmp eq i64 %j.next, %n, !dbg !3640
+  br i1 %d8, label %outer.latch, label %inner, !dbg !3641
+
+outer.latch:
+  %sc9 = fmul double %s.next, 5.500000e+00, !dbg !3642
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !3643
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !3644
+  %i.next = add nuw nsw i64 %i, 1, !dbg !3645
+  %d11 = icmp eq i64 %i.next, %n, !dbg !3646
+  br i1 %d11, label %exit, label %outer, !dbg !3647
+
+exit:
+  ret void, !dbg !3648
+}
+
+define i32 @kernel_157(i32 %op, i32 %x) !dbg !3649 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+    i32 3, label %case3
+  ], !dbg !3650
+
+case0:
+  %r1 = call i32 @kernel_152(i32 0, i32 %x), !dbg !3651
+  br label %join, !dbg !3652
+
+case1:
+  %r2 = call i32 @kernel_152(i32 1, i32 %x), !dbg !3653
+  br label %join, !dbg !3654
+
+case2:
+  %r3 = call i32 @kernel_147(i32 2, i32 %x), !dbg !3655
+  br label %join, !dbg !3656
+
+case3:
+  %r4 = call i32 @kernel_147(i32 3, i32 %x), !dbg !3657
+  br label %join, !dbg !3658
+
+default:
+  %p5 = getelementptr inbounds [16 x i32], ptr @g20, i64 0, i64 11, !dbg !3659
+  %l6 = load i32, ptr %p5, align 4, !tbaa !19, !dbg !3660
+  %u7 = call i32 @llvm.umin.i32(i32 %l6, i32 %x), !dbg !3661
+  br label %join, !dbg !3662
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %r4, %case3 ], [ %u7, %default ]
+  ret i32 %res, !dbg !3663
+}
+
+define <4 x i32> @kernel_158(<4 x i32> %v, i32 %s) !dbg !3664 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !3665
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !3666
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3667
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3668
+  %w3 = and <4 x i32> %v, %bc2, !dbg !3669
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3670
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3671
+  %w6 = xor <4 x i32> %w3, %bc5, !dbg !3672
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3673
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3674
+  %w9 = add <4 x i32> %w6, %bc8, !dbg !3675
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3676
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3677
+  %w12 = and <4 x i32> %w9, %bc11, !dbg !3678
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3679
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3680
+  %w15 = xor <4 x i32> %w12, %bc14, !dbg !3681
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3682
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3683
+  %w18 = mul <4 x i32> %w15, %bc17, !dbg !3684
+  %sp19 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3685
+  %bc20 = shufflevector <4 x i32> %sp19, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3686
+  %w21 = xor <4 x i32> %w18, %bc20, !dbg !3687
+  store <4 x i32> %w21, ptr %buf, align 16, !tbaa !19, !dbg !3688
+  %e22 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 0, !dbg !3689
+  %l23 = load i32, ptr %e22, align 4, !tbaa !19, !dbg !3690
+  %r24 = insertelement <4 x i32> %w21, i32 %l23, i64 3, !dbg !3691
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !3692
+  ret <4 x i32> %r24, !dbg !3693
+}
+
+define i64 @kernel_159(ptr %grid) !dbg !3694 {
+entry:
+  br label %walk, !dbg !3695
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !3696
+  br i1 %c1, label %done, label %body, !dbg !3697
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !3698
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !3699
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !3700
+  %r5 = call i64 @kernel_155(ptr %pr2, i32 %n4), !dbg !3701
+  %a6 = add i64 %tot, %r5, !dbg !3702
+  %r7 = call i64 @kernel_150(ptr %pr2, i32 %n4), !dbg !3703
+  %a8 = add i64 %a6, %r7, !dbg !3704
+  store i64 %a8, ptr @g31, align 8, !tbaa !20, !dbg !3705
+  %tot.next = add i64 %a8, 1, !dbg !3706
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !3707
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !3708
+  br label %walk, !dbg !3709
+
+done:
+  ret i64 %tot, !dbg !3710
+}
+
+define i64 @kernel_160(ptr noalias %recs, i32 %n) !dbg !3711 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !3712
+  %nw2 = zext i32 %n to i64, !dbg !3713
+  br i1 %c1, label %loop, label %exit, !dbg !3714
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !3715
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !3716
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !3717
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !3718
+  %c7 = icmp slt i32 %a4, 55, !dbg !3719
+  br i1 %c7, label %then, label %else, !dbg !3720
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !3721
+  %y9 = mul i64 %x8, %b6, !dbg !3722
+  br label %latch, !dbg !3723
+
+else:
+  %z10 = or i64 %b6, 4, !dbg !3724
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !3725
+  br label %latch, !dbg !3726
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !3727
+  %i.next = add nuw nsw i64 %i, 1, !dbg !3728
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !3729
+  br i1 %d12, label %exit, label %loop, !dbg !3730, !llvm.loop !3731
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !3732
+}
+
+define void @kernel_161(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !3733 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !3734
+  br i1 %c1, label %outer, label %exit, !dbg !3735
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !3736
+  br label %inner, !dbg !3737
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !3738
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !3739
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !3740
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !3741
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !3742
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !3743
+  %j.next = add nuw nsw i64 %j, 1, !dbg !3744
+  %d8 = icmp eq i64 %j.next, %n, !dbg !3745
+  br i1 %d8, label %outer.latch, label %inner, !dbg !3746
+
+outer.latch:
+  %sc9 = fmul double %s.next, 4.500000e+00, !dbg !3747
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !3748
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !3749
+  %i.next = add nuw nsw i64 %i, 1, !dbg !3750
+  %d11 = icmp eq i64 %i.next, %n, !dbg !3751
+  br i1 %d11, label %exit, label %outer, !dbg !3752
+
+exit:
+  ret void, !dbg !3753
+}
+
+define i32 @kernel_162(i32 %op, i32 %x) !dbg !3754 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+  ], !dbg !3755
+
+case0:
+  %r1 = call i32 @kernel_157(i32 0, i32 %x), !dbg !3756
+  br label %join, !dbg !3757
+
+case1:
+  %r2 = call i32 @kernel_152(i32 1, i32 %x), !dbg !3758
+  br label %join, !dbg !3759
+
+case2:
+  %r3 = call i32 @kernel_157(i32 2, i32 %x), !dbg !3760
+  br label %join, !dbg !3761
+
+default:
+  %p4 = getelementptr inbounds [16 x i32], ptr @g56, i64 0, i64 7, !dbg !3762
+  %l5 = load i32, ptr %p4, align 4, !tbaa !19, !dbg !3763
+  %u6 = call i32 @llvm.umin.i32(i32 %l5, i32 %x), !dbg !3764
+  br label %join, !dbg !3765
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %u6, %default ]
+  ret i32 %res, !dbg !3766
+}
+
+define <4 x i32> @kernel_163(<4 x i32> %v, i32 %s) !dbg !3767 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !3768
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !3769
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3770
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3771
+  %w3 = or <4 x i32> %v, %bc2, !dbg !3772
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3773
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3774
+  %w6 = add <4 x i32> %w3, %bc5, !dbg !3775
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3776
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3777
+  %w9 = xor <4 x i32> %w6, %bc8, !dbg !3778
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3779
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3780
+  %w12 = add <4 x i32> %w9, %bc11, !dbg !3781
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3782
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3783
+  %w15 = or <4 x i32> %w12, %bc14, !dbg !3784
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3785
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3786
+  %w18 = add <4 x i32> %w15, %bc17, !dbg !3787
+  %sp19 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3788
+  %bc20 = shufflevector <4 x i32> %sp19, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3789
+  %w21 = xor <4 x i32> %w18, %bc20, !dbg !3790
+  %sp22 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3791
+  %bc23 = shufflevector <4 x i32> %sp22, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3792
+  %w24 = or <4 x i32> %w21, %bc23, !dbg !3793
+  store <4 x i32> %w24, ptr %buf, align 16, !tbaa !19, !dbg !3794
+  %e25 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 0, !dbg !3795
+  %l26 = load i32, ptr %e25, align 4, !tbaa !19, !dbg !3796
+  %r27 = insertelement <4 x i32> %w24, i32 %l26, i64 3, !dbg !3797
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !3798
+  ret <4 x i32> %r27, !dbg !3799
+}
+
+define i64 @kernel_164(ptr %grid) !dbg !3800 {
+entry:
+  br label %walk, !dbg !3801
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !3802
+  br i1 %c1, label %done, label %body, !dbg !3803
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !3804
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !3805
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !3806
+  %r5 = call i64 @kernel_160(ptr %pr2, i32 %n4), !dbg !3807
+  %a6 = add i64 %tot, %r5, !dbg !3808
+  %r7 = call i64 @kernel_155(ptr %pr2, i32 %n4), !dbg !3809
+  %a8 = add i64 %a6, %r7, !dbg !3810
+  store i64 %a8, ptr @g51, align 8, !tbaa !20, !dbg !3811
+  %tot.next = add i64 %a8, 1, !dbg !3812
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !3813
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !3814
+  br label %walk, !dbg !3815
+
+done:
+  %pc10 = call i32 (ptr, ...) @printf(ptr @g10), !dbg !3816
+  ret i64 %tot, !dbg !3817
+}
+
+define i64 @kernel_165(ptr noalias %recs, i32 %n) !dbg !3818 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !3819
+  %nw2 = zext i32 %n to i64, !dbg !3820
+  br i1 %c1, label %loop, label %exit, !dbg !3821
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !3822
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !3823
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !3824
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !3825
+  %c7 = icmp slt i32 %a4, 32, !dbg !3826
+  br i1 %c7, label %then, label %else, !dbg !3827
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !3828
+  %y9 = mul i64 %x8, %b6, !dbg !3829
+  br label %latch, !dbg !3830
+
+else:
+  %z10 = and i64 %b6, 24, !dbg !3831
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !3832
+  br label %latch, !dbg !3833
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !3834
+  %i.next = add nuw nsw i64 %i, 1, !dbg !3835
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !3836
+  br i1 %d12, label %exit, label %loop, !dbg !3837, !llvm.loop !3838
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !3839
+}
+
+define void @kernel_166(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !3840 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !3841
+  br i1 %c1, label %outer, label %exit, !dbg !3842
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !3843
+  br label %inner, !dbg !3844
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !3845
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !3846
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !3847
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !3848
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !3849
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !3850
+  %j.next = add nuw nsw i64 %j, 1, !dbg !3851
+  %d8 = icmp eq i64 %j.next, %n, !dbg !3852
+  br i1 %d8, label %outer.latch, label %inner, !dbg !3853
+
+outer.latch:
+  %sc9 = fmul double %s.next, 3.500000e+00, !dbg !3854
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !3855
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !3856
+  %i.next = add nuw nsw i64 %i, 1, !dbg !3857
+  %d11 = icmp eq i64 %i.next, %n, !dbg !3858
+  br i1 %d11, label %exit, label %outer, !dbg !3859
+
+exit:
+  ret void, !dbg !3860
+}
+
+define i32 @kernel_167(i32 %op, i32 %x) !dbg !3861 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+    i32 3, label %case3
+  ], !dbg !3862
+
+case0:
+  %r1 = call i32 @kernel_157(i32 0, i32 %x), !dbg !3863
+  br label %join, !dbg !3864
+
+case1:
+  %r2 = lshr i32 %x, 4, !dbg !3865
+  br label %join, !dbg !3866
+
+case2:
+  %r3 = call i32 @kernel_162(i32 2, i32 %x), !dbg !3867
+  br label %join, !dbg !3868
+
+case3:
+  %r4 = shl i32 %x, 1, !dbg !3869
+  br label %join, !dbg !3870
+
+default:
+  %p5 = getelementptr inbounds [16 x i32], ptr @g36, i64 0, i64 4, !dbg !3871
+  %l6 = load i32, ptr %p5, align 4, !tbaa !19, !dbg !3872
+  %u7 = call i32 @llvm.umin.i32(i32 %l6, i32 %x), !dbg !3873
+  br label %join, !dbg !3874
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %r4, %case3 ], [ %u7, %default ]
+  ret i32 %res, !dbg !3875
+}
+
+define <4 x i32> @kernel_168(<4 x i32> %v, i32 %s) !dbg !3876 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !3877
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !3878
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3879
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3880
+  %w3 = xor <4 x i32> %v, %bc2, !dbg !3881
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3882
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3883
+  %w6 = and <4 x i32> %w3, %bc5, !dbg !3884
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3885
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3886
+  %w9 = add <4 x i32> %w6, %bc8, !dbg !3887
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3888
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3889
+  %w12 = xor <4 x i32> %w9, %bc11, !dbg !3890
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3891
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3892
+  %w15 = and <4 x i32> %w12, %bc14, !dbg !3893
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3894
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3895
+  %w18 = and <4 x i32> %w15, %bc17, !dbg !3896
+  %sp19 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3897
+  %bc20 = shufflevector <4 x i32> %sp19, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3898
+  %w21 = xor <4 x i32> %w18, %bc20, !dbg !3899
+  %sp22 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3900
+  %bc23 = shufflevector <4 x i32> %sp22, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3901
+  %w24 = xor <4 x i32> %w21, %bc23, !dbg !3902
+  store <4 x i32> %w24, ptr %buf, align 16, !tbaa !19, !dbg !3903
+  %e25 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 0, !dbg !3904
+  %l26 = load i32, ptr %e25, align 4, !tbaa !19, !dbg !3905
+  %r27 = insertelement <4 x i32> %w24, i32 %l26, i64 3, !dbg !3906
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !3907
+  ret <4 x i32> %r27, !dbg !3908
+}
+
+define i64 @kernel_169(ptr %grid) !dbg !3909 {
+entry:
+  br label %walk, !dbg !3910
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !3911
+  br i1 %c1, label %done, label %body, !dbg !3912
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !3913
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !3914
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !3915
+  %r5 = call i64 @kernel_160(ptr %pr2, i32 %n4), !dbg !3916
+  %a6 = add i64 %tot, %r5, !dbg !3917
+  %r7 = call i64 @kernel_165(ptr %pr2, i32 %n4), !dbg !3918
+  %a8 = add i64 %a6, %r7, !dbg !3919
+  store i64 %a8, ptr @g27, align 8, !tbaa !20, !dbg !3920
+  %tot.next = add i64 %a8, 1, !dbg !3921
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !3922
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !3923
+  br label %walk, !dbg !3924
+
+done:
+  ret i64 %tot, !dbg !3925
+}
+
+define i64 @kernel_170(ptr noalias %recs, i32 %n) !dbg !3926 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !3927
+  %nw2 = zext i32 %n to i64, !dbg !3928
+  br i1 %c1, label %loop, label %exit, !dbg !3929
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !3930
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !3931
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !3932
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !3933
+  %c7 = icmp slt i32 %a4, 15, !dbg !3934
+  br i1 %c7, label %then, label %else, !dbg !3935
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !3936
+  %y9 = and i64 %x8, %b6, !dbg !3937
+  br label %latch, !dbg !3938
+
+else:
+  %z10 = sub i64 %b6, 20, !dbg !3939
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !3940
+  br label %latch, !dbg !3941
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !3942
+  %i.next = add nuw nsw i64 %i, 1, !dbg !3943
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !3944
+  br i1 %d12, label %exit, label %loop, !dbg !3945, !llvm.loop !3946
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !3947
+}
+
+define void @kernel_171(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !3948 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !3949
+  br i1 %c1, label %outer, label %exit, !dbg !3950
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !3951
+  br label %inner, !dbg !3952
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !3953
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !3954
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !3955
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !3956
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !3957
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !3958
+  %j.next = add nuw nsw i64 %j, 1, !dbg !3959
+  %d8 = icmp eq i64 %j.next, %n, !dbg !3960
+  br i1 %d8, label %outer.latch, label %inner, !dbg !3961
+
+outer.latch:
+  %sc9 = fmul double %s.next, 3.500000e+00, !dbg !3962
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !3963
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !3964
+  %i.next = add nuw nsw i64 %i, 1, !dbg !3965
+  %d11 = icmp eq i64 %i.next, %n, !dbg !3966
+  br i1 %d11, label %exit, label %outer, !dbg !3967
+
+exit:
+  ret void, !dbg !3968
+}
+
+define i32 @kernel_172(i32 %op, i32 %x) !dbg !3969 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+  ], !dbg !3970
+
+case0:
+  %r1 = lshr i32 %x, 14, !dbg !3971
+  br label %join, !dbg !3972
+
+case1:
+  %r2 = xor i32 %x, 14, !dbg !3973
+  br label %join, !dbg !3974
+
+case2:
+  %r3 = call i32 @kernel_167(i32 2, i32 %x), !dbg !3975
+  br label %join, !dbg !3976
+
+default:
+  %p4 = getelementptr inbounds [16 x i32], ptr @g44, i64 0, i64 1, !dbg !3977
+  %l5 = load i32, ptr %p4, align 4, !tbaa !19, !dbg !3978
+  %u6 = call i32 @llvm.umin.i32(i32 %l5, i32 %x), !dbg !3979
+  br label %join, !dbg !3980
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %u6, %default ]
+  ret i32 %res, !dbg !3981
+}
+
+define <4 x i32> @kernel_173(<4 x i32> %v, i32 %s) !dbg !3982 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !3983
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !3984
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3985
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3986
+  %w3 = mul <4 x i32> %v, %bc2, !dbg !3987
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3988
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3989
+  %w6 = mul <4 x i32> %w3, %bc5, !dbg !3990
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3991
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3992
+  %w9 = xor <4 x i32> %w6, %bc8, !dbg !3993
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3994
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3995
+  %w12 = add <4 x i32> %w9, %bc11, !dbg !3996
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !3997
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !3998
+  %w15 = or <4 x i32> %w12, %bc14, !dbg !3999
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4000
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4001
+  %w18 = xor <4 x i32> %w15, %bc17, !dbg !4002
+  %sp19 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4003
+  %bc20 = shufflevector <4 x i32> %sp19, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4004
+  %w21 = add <4 x i32> %w18, %bc20, !dbg !4005
+  %sp22 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4006
+  %bc23 = shufflevector <4 x i32> %sp22, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4007
+  %w24 = and <4 x i32> %w21, %bc23, !dbg !4008
+  store <4 x i32> %w24, ptr %buf, align 16, !tbaa !19, !dbg !4009
+  %e25 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 0, !dbg !4010
+  %l26 = load i32, ptr %e25, align 4, !tbaa !19, !dbg !4011
+  %r27 = insertelement <4 x i32> %w24, i32 %l26, i64 3, !dbg !4012
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !4013
+  ret <4 x i32> %r27, !dbg !4014
+}
+
+define i64 @kernel_174(ptr %grid) !dbg !4015 {
+entry:
+  br label %walk, !dbg !4016
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !4017
+  br i1 %c1, label %done, label %body, !dbg !4018
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !4019
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !4020
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !4021
+  %r5 = call i64 @kernel_165(ptr %pr2, i32 %n4), !dbg !4022
+  %a6 = add i64 %tot, %r5, !dbg !4023
+  %r7 = call i64 @kernel_170(ptr %pr2, i32 %n4), !dbg !4024
+  %a8 = add i64 %a6, %r7, !dbg !4025
+  store i64 %a8, ptr @g11, align 8, !tbaa !20, !dbg !4026
+  %tot.next = add i64 %a8, 1, !dbg !4027
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !4028
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !4029
+  br label %walk, !dbg !4030
+
+done:
+  %pc10 = call i32 (ptr, ...) @printf(ptr @g10), !dbg !4031
+  ret i64 %tot, !dbg !4032
+}
+
+define i64 @kernel_175(ptr noalias %recs, i32 %n) !dbg !4033 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !4034
+  %nw2 = zext i32 %n to i64, !dbg !4035
+  br i1 %c1, label %loop, label %exit, !dbg !4036
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !4037
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !4038
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !4039
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !4040
+  %c7 = icmp slt i32 %a4, 52, !dbg !4041
+  br i1 %c7, label %then, label %else, !dbg !4042
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !4043
+  %y9 = mul i64 %x8, %b6, !dbg !4044
+  br label %latch, !dbg !4045
+
+else:
+  %z10 = sub i64 %b6, 26, !dbg !4046
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !4047
+  br label %latch, !dbg !4048
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !4049
+  %i.next = add nuw nsw i64 %i, 1, !dbg !4050
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !4051
+  br i1 %d12, label %exit, label %loop, !dbg !4052, !llvm.loop !4053
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !4054
+}
+
+define void @kernel_176(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !4055 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !4056
+  br i1 %c1, label %outer, label %exit, !dbg !4057
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !4058
+  br label %inner, !dbg !4059
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !4060
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !4061
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !4062
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !4063
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !4064
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !4065
+  %j.next = add nuw nsw i64 %j, 1, !dbg !4066
+  %d8 = icmp eq i64 %j.next, %n, !dbg !4067
+  br i1 %d8, label %outer.latch, label %inner, !dbg !4068
+
+outer.latch:
+  %sc9 = fmul double %s.next, 3.500000e+00, !dbg !4069
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !4070
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !4071
+  %i.next = add nuw nsw i64 %i, 1, !dbg !4072
+  %d11 = icmp eq i64 %i.next, %n, !dbg !4073
+  br i1 %d11, label %exit, label %outer, !dbg !4074
+
+exit:
+  ret void, !dbg !4075
+}
+
+define i32 @kernel_177(i32 %op, i32 %x) !dbg !4076 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+    i32 3, label %case3
+    i32 4, label %case4
+  ], !dbg !4077
+
+case0:
+  %r1 = call i32 @kernel_172(i32 0, i32 %x), !dbg !4078
+  br label %join, !dbg !4079
+
+case1:
+  %r2 = and i32 %x, 9, !dbg !4080
+  br label %join, !dbg !4081
+
+case2:
+  %r3 = call i32 @kernel_167(i32 2, i32 %x), !dbg !4082
+  br label %join, !dbg !4083
+
+case3:
+  %r4 = mul i32 %x, 7, !dbg !4084
+  br label %join, !dbg !4085
+
+case4:
+  %r5 = call i32 @kernel_172(i32 4, i32 %x), !dbg !4086
+  br label %join, !dbg !4087
+
+default:
+  %p6 = getelementptr inbounds [16 x i32], ptr @g36, i64 0, i64 10, !dbg !4088
+  %l7 = load i32, ptr %p6, align 4, !tbaa !19, !dbg !4089
+  %u8 = call i32 @llvm.umin.i32(i32 %l7, i32 %x), !dbg !4090
+  br label %join, !dbg !4091
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %r4, %case3 ], [ %r5, %case4 ], [ %u8, %default ]
+  ret i32 %res, !dbg !4092
+}
+
+define <4 x i32> @kernel_178(<4 x i32> %v, i32 %s) !dbg !4093 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !4094
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !4095
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4096
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4097
+  %w3 = mul <4 x i32> %v, %bc2, !dbg !4098
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4099
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4100
+  %w6 = add <4 x i32> %w3, %bc5, !dbg !4101
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4102
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4103
+  %w9 = and <4 x i32> %w6, %bc8, !dbg !4104
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4105
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4106
+  %w12 = or <4 x i32> %w9, %bc11, !dbg !4107
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4108
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4109
+  %w15 = mul <4 x i32> %w12, %bc14, !dbg !4110
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4111
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4112
+  %w18 = mul <4 x i32> %w15, %bc17, !dbg !4113
+  %sp19 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4114
+  %bc20 = shufflevector <4 x i32> %sp19, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4115
+  %w21 = add <4 x i32> %w18, %bc20, !dbg !4116
+  %sp22 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4117
+  %bc23 = shufflevector <4 x i32> %sp22, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4118
+  %w24 = xor <4 x i32> %w21, %bc23, !dbg !4119
+  %sp25 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4120
+  %bc26 = shufflevector <4 x i32> %sp25, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4121
+  %w27 = xor <4 x i32> %w24, %bc26, !dbg !4122
+  %sp28 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4123
+  %bc29 = shufflevector <4 x i32> %sp28, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4124
+  %w30 = add <4 x i32> %w27, %bc29, !dbg !4125
+  %sp31 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4126
+  %bc32 = shufflevector <4 x i32> %sp31, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4127
+  %w33 = xor <4 x i32> %w30, %bc32, !dbg !4128
+  %sp34 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4129
+  %bc35 = shufflevector <4 x i32> %sp34, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4130
+  %w36 = add <4 x i32> %w33, %bc35, !dbg !4131
+  %sp37 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4132
+  %bc38 = shufflevector <4 x i32> %sp37, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4133
+  %w39 = add <4 x i32> %w36, %bc38, !dbg !4134
+  store <4 x i32> %w39, ptr %buf, align 16, !tbaa !19, !dbg !4135
+  %e40 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 2, !dbg !4136
+  %l41 = load i32, ptr %e40, align 4, !tbaa !19, !dbg !4137
+  %r42 = insertelement <4 x i32> %w39, i32 %l41, i64 3, !dbg !4138
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !4139
+  ret <4 x i32> %r42, !dbg !4140
+}
+
+define i64 @kernel_179(ptr %grid) !dbg !4141 {
+entry:
+  br label %walk, !dbg !4142
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !4143
+  br i1 %c1, label %done, label %body, !dbg !4144
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !4145
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !4146
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !4147
+  %r5 = call i64 @kernel_175(ptr %pr2, i32 %n4), !dbg !4148
+  %a6 = add i64 %tot, %r5, !dbg !4149
+  %r7 = call i64 @kernel_170(ptr %pr2, i32 %n4), !dbg !4150
+  %a8 = add i64 %a6, %r7, !dbg !4151
+  store i64 %a8, ptr @g35, align 8, !tbaa !20, !dbg !4152
+  %tot.next = add i64 %a8, 1, !dbg !4153
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !4154
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !4155
+  br label %walk, !dbg !4156
+
+done:
+  ret i64 %tot, !dbg !4157
+}
+
+define i64 @kernel_180(ptr noalias %recs, i32 %n) !dbg !4158 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !4159
+  %nw2 = zext i32 %n to i64, !dbg !4160
+  br i1 %c1, label %loop, label %exit, !dbg !4161
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !4162
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !4163
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !4164
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !4165
+  %c7 = icmp slt i32 %a4, 34, !dbg !4166
+  br i1 %c7, label %then, label %else, !dbg !4167
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !4168
+  %y9 = xor i64 %x8, %b6, !dbg !4169
+  br label %latch, !dbg !4170
+
+else:
+  %z10 = sub i64 %b6, 7, !dbg !4171
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !4172
+  br label %latch, !dbg !4173
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !4174
+  %i.next = add nuw nsw i64 %i, 1, !dbg !4175
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !4176
+  br i1 %d12, label %exit, label %loop, !dbg !4177, !llvm.loop !4178
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !4179
+}
+
+define void @kernel_181(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !4180 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !4181
+  br i1 %c1, label %outer, label %exit, !dbg !4182
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !4183
+  br label %inner, !dbg !4184
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !4185
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !4186
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !4187
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !4188
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !4189
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !4190
+  %j.next = add nuw nsw i64 %j, 1, !dbg !4191
+  %d8 = icmp eq i64 %j.next, %n, !dbg !4192
+  br i1 %d8, label %outer.latch, label %inner, !dbg !4193
+
+outer.latch:
+  %sc9 = fmul double %s.next, 2.500000e+00, !dbg !4194
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !4195
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !4196
+  %i.next = add nuw nsw i64 %i, 1, !dbg !4197
+  %d11 = icmp eq i64 %i.next, %n, !dbg !4198
+  br i1 %d11, label %exit, label %outer, !dbg !4199
+
+exit:
+  ret void, !dbg !4200
+}
+
+define i32 @kernel_182(i32 %op, i32 %x) !dbg !4201 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+    i32 3, label %case3
+    i32 4, label %case4
+    i32 5, label %case5
+    i32 6, label %case6
+  ], !dbg !4202
+
+case0:
+  %r1 = call i32 @kernel_172(i32 0, i32 %x), !dbg !4203
+  br label %join, !dbg !4204
+
+case1:
+  %r2 = call i32 @kernel_177(i32 1, i32 %x), !dbg !4205
+  br label %join, !dbg !4206
+
+case2:
+  %r3 = sub i32 %x, 12, !dbg !4207
+  br label %join, !dbg !4208
+
+case3:
+  %r4 = call i32 @kernel_172(i32 3, i32 %x), !dbg !4209
+  br label %join, !dbg !4210
+
+case4:
+  %r5 = call i32 @kernel_172(i32 4, i32 %x), !dbg !4211
+  br label %join, !dbg !4212
+
+case5:
+  %r6 = or i32 %x, 8, !dbg !4213
+  br label %join, !dbg !4214
+
+case6:
+  %r7 = mul i32 %x, 11, !dbg !4215
+  br label %join, !dbg !4216
+
+default:
+  %p8 = getelementptr inbounds [16 x i32], ptr @g40, i64 0, i64 1, !dbg !4217
+  %l9 = load i32, ptr %p8, align 4, !tbaa !19, !dbg !4218
+  %u10 = call i32 @llvm.umin.i32(i32 %l9, i32 %x), !dbg !4219
+  br label %join, !dbg !4220
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %r4, %case3 ], [ %r5, %case4 ], [ %r6, %case5 ], [ %r7, %case6 ], [ %u10, %default ]
+  ret i32 %res, !dbg !4221
+}
+
+define <4 x i32> @kernel_183(<4 x i32> %v, i32 %s) !dbg !4222 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !4223
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !4224
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4225
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4226
+  %w3 = xor <4 x i32> %v, %bc2, !dbg !4227
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4228
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4229
+  %w6 = or <4 x i32> %w3, %bc5, !dbg !4230
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4231
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4232
+  %w9 = or <4 x i32> %w6, %bc8, !dbg !4233
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4234
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4235
+  %w12 = or <4 x i32> %w9, %bc11, !dbg !4236
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4237
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4238
+  %w15 = or <4 x i32> %w12, %bc14, !dbg !4239
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4240
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4241
+  %w18 = add <4 x i32> %w15, %bc17, !dbg !4242
+  %sp19 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4243
+  %bc20 = shufflevector <4 x i32> %sp19, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4244
+  %w21 = mul <4 x i32> %w18, %bc20, !dbg !4245
+  %sp22 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4246
+  %bc23 = shufflevector <4 x i32> %sp22, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4247
+  %w24 = and <4 x i32> %w21, %bc23, !dbg !4248
+  store <4 x i32> %w24, ptr %buf, align 16, !tbaa !19, !dbg !4249
+  %e25 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 0, !dbg !4250
+  %l26 = load i32, ptr %e25, align 4, !tbaa !19, !dbg !4251
+  %r27 = insertelement <4 x i32> %w24, i32 %l26, i64 3, !dbg !4252
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !4253
+  ret <4 x i32> %r27, !dbg !4254
+}
+
+define i64 @kernel_184(ptr %grid) !dbg !4255 {
+entry:
+  br label %walk, !dbg !4256
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !4257
+  br i1 %c1, label %done, label %body, !dbg !4258
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !4259
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !4260
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !4261
+  %r5 = call i64 @kernel_175(ptr %pr2, i32 %n4), !dbg !4262
+  %a6 = add i64 %tot, %r5, !dbg !4263
+  %r7 = call i64 @kernel_180(ptr %pr2, i32 %n4), !dbg !4264
+  %a8 = add i64 %a6, %r7, !dbg !4265
+  store i64 %a8, ptr @g43, align 8, !tbaa !20, !dbg !4266
+  %tot.next = add i64 %a8, 1, !dbg !4267
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !4268
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !4269
+  br label %walk, !dbg !4270
+
+done:
+  %pc10 = call i32 (ptr, ...) @printf(ptr @g54), !dbg !4271
+  ret i64 %tot, !dbg !4272
+}
+
+define i64 @kernel_185(ptr noalias %recs, i32 %n) !dbg !4273 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !4274
+  %nw2 = zext i32 %n to i64, !dbg !4275
+  br i1 %c1, label %loop, label %exit, !dbg !4276
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !4277
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !4278
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !4279
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !4280
+  %c7 = icmp slt i32 %a4, 46, !dbg !4281
+  br i1 %c7, label %then, label %else, !dbg !4282
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !4283
+  %y9 = add nsw i64 %x8, %b6, !dbg !4284
+  br label %latch, !dbg !4285
+
+else:
+  %z10 = and i64 %b6, 2, !dbg !4286
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !4287
+  br label %latch, !dbg !4288
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !4289
+  %i.next = add nuw nsw i64 %i, 1, !dbg !4290
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !4291
+  br i1 %d12, label %exit, label %loop, !dbg !4292, !llvm.loop !4293
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !4294
+}
+
+define void @kernel_186(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !4295 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !4296
+  br i1 %c1, label %outer, label %exit, !dbg !4297
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !4298
+  br label %inner, !dbg !4299
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !4300
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !4301
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !4302
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !4303
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !4304
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !4305
+  %j.next = add nuw nsw i64 %j, 1, !dbg !4306
+  %d8 = icmp eq i64 %j.next, %n, !dbg !4307
+  br i1 %d8, label %outer.latch, label %inner, !dbg !4308
+
+outer.latch:
+  %sc9 = fmul double %s.next, 9.500000e+00, !dbg !4309
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !4310
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !4311
+  %i.next = add nuw nsw i64 %i, 1, !dbg !4312
+  %d11 = icmp eq i64 %i.next, %n, !dbg !4313
+  br i1 %d11, label %exit, label %outer, !dbg !4314
+
+exit:
+  ret void, !dbg !4315
+}
+
+define i32 @kernel_187(i32 %op, i32 %x) !dbg !4316 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+    i32 3, label %case3
+    i32 4, label %case4
+    i32 5, label %case5
+  ], !dbg !4317
+
+case0:
+  %r1 = call i32 @kernel_177(i32 0, i32 %x), !dbg !4318
+  br label %join, !dbg !4319
+
+case1:
+  %r2 = call i32 @kernel_177(i32 1, i32 %x), !dbg !4320
+  br label %join, !dbg !4321
+
+case2:
+  %r3 = call i32 @kernel_177(i32 2, i32 %x), !dbg !4322
+  br label %join, !dbg !4323
+
+case3:
+  %r4 = and i32 %x, 14, !dbg !4324
+  br label %join, !dbg !4325
+
+case4:
+  %r5 = and i32 %x, 15, !dbg !4326
+  br label %join, !dbg !4327
+
+case5:
+  %r6 = call i32 @kernel_177(i32 5, i32 %x), !dbg !4328
+  br label %join, !dbg !4329
+
+default:
+  %p7 = getelementptr inbounds [16 x i32], ptr @g40, i64 0, i64 14, !dbg !4330
+  %l8 = load i32, ptr %p7, align 4, !tbaa !19, !dbg !4331
+  %u9 = call i32 @llvm.umin.i32(i32 %l8, i32 %x), !dbg !4332
+  br label %join, !dbg !4333
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %r4, %case3 ], [ %r5, %case4 ], [ %r6, %case5 ], [ %u9, %default ]
+  ret i32 %res, !dbg !4334
+}
+
+define <4 x i32> @kernel_188(<4 x i32> %v, i32 %s) !dbg !4335 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !4336
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !4337
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4338
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4339
+  %w3 = or <4 x i32> %v, %bc2, !dbg !4340
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4341
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4342
+  %w6 = mul <4 x i32> %w3, %bc5, !dbg !4343
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4344
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4345
+  %w9 = and <4 x i32> %w6, %bc8, !dbg !4346
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4347
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4348
+  %w12 = or <4 x i32> %w9, %bc11, !dbg !4349
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4350
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4351
+  %w15 = xor <4 x i32> %w12, %bc14, !dbg !4352
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4353
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4354
+  %w18 = mul <4 x i32> %w15, %bc17, !dbg !4355
+  %sp19 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4356
+  %bc20 = shufflevector <4 x i32> %sp19, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4357
+  %w21 = and <4 x i32> %w18, %bc20, !dbg !4358
+  %sp22 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4359
+  %bc23 = shufflevector <4 x i32> %sp22, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4360
+  %w24 = add <4 x i32> %w21, %bc23, !dbg !4361
+  %sp25 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4362
+  %bc26 = shufflevector <4 x i32> %sp25, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4363
+  %w27 = and <4 x i32> %w24, %bc26, !dbg !4364
+  %sp28 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4365
+  %bc29 = shufflevector <4 x i32> %sp28, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4366
+  %w30 = add <4 x i32> %w27, %bc29, !dbg !4367
+  %sp31 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4368
+  %bc32 = shufflevector <4 x i32> %sp31, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4369
+  %w33 = xor <4 x i32> %w30, %bc32, !dbg !4370
+  store <4 x i32> %w33, ptr %buf, align 16, !tbaa !19, !dbg !4371
+  %e34 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 2, !dbg !4372
+  %l35 = load i32, ptr %e34, align 4, !tbaa !19, !dbg !4373
+  %r36 = insertelement <4 x i32> %w33, i32 %l35, i64 3, !dbg !4374
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !4375
+  ret <4 x i32> %r36, !dbg !4376
+}
+
+define i64 @kernel_189(ptr %grid) !dbg !4377 {
+entry:
+  br label %walk, !dbg !4378
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !4379
+  br i1 %c1, label %done, label %body, !dbg !4380
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !4381
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !4382
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !4383
+  %r5 = call i64 @kernel_185(ptr %pr2, i32 %n4), !dbg !4384
+  %a6 = add i64 %tot, %r5, !dbg !4385
+  %r7 = call i64 @kernel_180(ptr %pr2, i32 %n4), !dbg !4386
+  %a8 = add i64 %a6, %r7, !dbg !4387
+  store i64 %a8, ptr @g35, align 8, !tbaa !20, !dbg !4388
+  %tot.next = add i64 %a8, 1, !dbg !4389
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !4390
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !4391
+  br label %walk, !dbg !4392
+
+done:
+  ret i64 %tot, !dbg !4393
+}
+
+define i64 @kernel_190(ptr noalias %recs, i32 %n) !dbg !4394 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !4395
+  %nw2 = zext i32 %n to i64, !dbg !4396
+  br i1 %c1, label %loop, label %exit, !dbg !4397
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !4398
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !4399
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !4400
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !4401
+  %c7 = icmp slt i32 %a4, 11, !dbg !4402
+  br i1 %c7, label %then, label %else, !dbg !4403
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !4404
+  %y9 = xor i64 %x8, %b6, !dbg !4405
+  br label %latch, !dbg !4406
+
+else:
+  %z10 = and i64 %b6, 11, !dbg !4407
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !4408
+  br label %latch, !dbg !4409
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !4410
+  %i.next = add nuw nsw i64 %i, 1, !dbg !4411
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !4412
+  br i1 %d12, label %exit, label %loop, !dbg !4413, !llvm.loop !4414
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !4415
+}
+
+define void @kernel_191(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !4416 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !4417
+  br i1 %c1, label %outer, label %exit, !dbg !4418
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !4419
+  br label %inner, !dbg !4420
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !4421
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !4422
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !4423
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !4424
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !4425
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !4426
+  %j.next = add nuw nsw i64 %j, 1, !dbg !4427
+  %d8 = icmp eq i64 %j.next, %n, !dbg !4428
+  br i1 %d8, label %outer.latch, label %inner, !dbg !4429
+
+outer.latch:
+  %sc9 = fmul double %s.next, 3.500000e+00, !dbg !4430
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !4431
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !4432
+  %i.next = add nuw nsw i64 %i, 1, !dbg !4433
+  %d11 = icmp eq i64 %i.next, %n, !dbg !4434
+  br i1 %d11, label %exit, label %outer, !dbg !4435
+
+exit:
+  ret void, !dbg !4436
+}
+
+define i32 @kernel_192(i32 %op, i32 %x) !dbg !4437 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+  ], !dbg !4438
+
+case0:
+  %r1 = call i32 @kernel_182(i32 0, i32 %x), !dbg !4439
+  br label %join, !dbg !4440
+
+case1:
+  %r2 = lshr i32 %x, 5, !dbg !4441
+  br label %join, !dbg !4442
+
+case2:
+  %r3 = call i32 @kernel_182(i32 2, i32 %x), !dbg !4443
+  br label %join, !dbg !4444
+
+default:
+  %p4 = getelementptr inbounds [16 x i32], ptr @g40, i64 0, i64 13, !dbg !4445
+  %l5 = load i32, ptr %p4, align 4, !tbaa !19, !dbg !4446
+  %u6 = call i32 @llvm.umin.i32(i32 %l5, i32 %x), !dbg !4447
+  br label %join, !dbg !4448
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %u6, %default ]
+  ret i32 %res, !dbg !4449
+}
+
+define <4 x i32> @kernel_193(<4 x i32> %v, i32 %s) !dbg !4450 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !4451
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !4452
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4453
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4454
+  %w3 = and <4 x i32> %v, %bc2, !dbg !4455
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4456
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4457
+  %w6 = mul <4 x i32> %w3, %bc5, !dbg !4458
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4459
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4460
+  %w9 = or <4 x i32> %w6, %bc8, !dbg !4461
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4462
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4463
+  %w12 = or <4 x i32> %w9, %bc11, !dbg !4464
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4465
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4466
+  %w15 = or <4 x i32> %w12, %bc14, !dbg !4467
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4468
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4469
+  %w18 = or <4 x i32> %w15, %bc17, !dbg !4470
+  %sp19 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4471
+  %bc20 = shufflevector <4 x i32> %sp19, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4472
+  %w21 = xor <4 x i32> %w18, %bc20, !dbg !4473
+  %sp22 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4474
+  %bc23 = shufflevector <4 x i32> %sp22, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4475
+  %w24 = mul <4 x i32> %w21, %bc23, !dbg !4476
+  %sp25 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4477
+  %bc26 = shufflevector <4 x i32> %sp25, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4478
+  %w27 = xor <4 x i32> %w24, %bc26, !dbg !4479
+  %sp28 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4480
+  %bc29 = shufflevector <4 x i32> %sp28, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4481
+  %w30 = and <4 x i32> %w27, %bc29, !dbg !4482
+  store <4 x i32> %w30, ptr %buf, align 16, !tbaa !19, !dbg !4483
+  %e31 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 1, !dbg !4484
+  %l32 = load i32, ptr %e31, align 4, !tbaa !19, !dbg !4485
+  %r33 = insertelement <4 x i32> %w30, i32 %l32, i64 3, !dbg !4486
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !4487
+  ret <4 x i32> %r33, !dbg !4488
+}
+
+define i64 @kernel_194(ptr %grid) !dbg !4489 {
+entry:
+  br label %walk, !dbg !4490
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !4491
+  br i1 %c1, label %done, label %body, !dbg !4492
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !4493
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !4494
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !4495
+  %r5 = call i64 @kernel_190(ptr %pr2, i32 %n4), !dbg !4496
+  %a6 = add i64 %tot, %r5, !dbg !4497
+  %r7 = call i64 @kernel_185(ptr %pr2, i32 %n4), !dbg !4498
+  %a8 = add i64 %a6, %r7, !dbg !4499
+  store i64 %a8, ptr @g19, align 8, !tbaa !20, !dbg !4500
+  %tot.next = add i64 %a8, 1, !dbg !4501
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !4502
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !4503
+  br label %walk, !dbg !4504
+
+done:
+  %pc10 = call i32 (ptr, ...) @printf(ptr @g50), !dbg !4505
+  ret i64 %tot, !dbg !4506
+}
+
+define i64 @kernel_195(ptr noalias %recs, i32 %n) !dbg !4507 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !4508
+  %nw2 = zext i32 %n to i64, !dbg !4509
+  br i1 %c1, label %loop, label %exit, !dbg !4510
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !4511
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !4512
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !4513
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !4514
+  %c7 = icmp slt i32 %a4, 47, !dbg !4515
+  br i1 %c7, label %then, label %else, !dbg !4516
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !4517
+  %y9 = mul i64 %x8, %b6, !dbg !4518
+  br label %latch, !dbg !4519
+
+else:
+  %z10 = add nsw i64 %b6, 18, !dbg !4520
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !4521
+  br label %latch, !dbg !4522
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !4523
+  %i.next = add nuw nsw i64 %i, 1, !dbg !4524
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !4525
+  br i1 %d12, label %exit, label %loop, !dbg !4526, !llvm.loop !4527
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !4528
+}
+
+define void @kernel_196(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !4529 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !4530
+  br i1 %c1, label %outer, label %exit, !dbg !4531
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !4532
+  br label %inner, !dbg !4533
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !4534
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !4535
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !4536
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !4537
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !4538
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !4539
+  %j.next = add nuw nsw i64 %j, 1, !dbg !4540
+  %d8 = icmp eq i64 %j.next, %n, !dbg !4541
+  br i1 %d8, label %outer.latch, label %inner, !dbg !4542
+
+outer.latch:
+  %sc9 = fmul double %s.next, 4.500000e+00, !dbg !4543
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !4544
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !4545
+  %i.next = add nuw nsw i64 %i, 1, !dbg !4546
+  %d11 = icmp eq i64 %i.next, %n, !dbg !4547
+  br i1 %d11, label %exit, label %outer, !dbg !4548
+
+exit:
+  ret void, !dbg !4549
+}
+
+define i32 @kernel_197(i32 %op, i32 %x) !dbg !4550 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+  ], !dbg !4551
+
+case0:
+  %r1 = call i32 @kernel_192(i32 0, i32 %x), !dbg !4552
+  br label %join, !dbg !4553
+
+case1:
+  %r2 = mul i32 %x, 10, !dbg !4554
+  br label %join, !dbg !4555
+
+case2:
+  %r3 = call i32 @kernel_187(i32 2, i32 %x), !dbg !4556
+  br label %join, !dbg !4557
+
+default:
+  %p4 = getelementptr inbounds [16 x i32], ptr @g12, i64 0, i64 10, !dbg !4558
+  %l5 = load i32, ptr %p4, align 4, !tbaa !19, !dbg !4559
+  %u6 = call i32 @llvm.umin.i32(i32 %l5, i32 %x), !dbg !4560
+  br label %join, !dbg !4561
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %u6, %default ]
+  ret i32 %res, !dbg !4562
+}
+
+define <4 x i32> @kernel_198(<4 x i32> %v, i32 %s) !dbg !4563 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !4564
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !4565
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4566
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4567
+  %w3 = add <4 x i32> %v, %bc2, !dbg !4568
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4569
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4570
+  %w6 = add <4 x i32> %w3, %bc5, !dbg !4571
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4572
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4573
+  %w9 = xor <4 x i32> %w6, %bc8, !dbg !4574
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4575
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4576
+  %w12 = add <4 x i32> %w9, %bc11, !dbg !4577
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4578
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4579
+  %w15 = or <4 x i32> %w12, %bc14, !dbg !4580
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4581
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4582
+  %w18 = or <4 x i32> %w15, %bc17, !dbg !4583
+  store <4 x i32> %w18, ptr %buf, align 16, !tbaa !19, !dbg !4584
+  %e19 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 3, !dbg !4585
+  %l20 = load i32, ptr %e19, align 4, !tbaa !19, !dbg !4586
+  %r21 = insertelement <4 x i32> %w18, i32 %l20, i64 3, !dbg !4587
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !4588
+  ret <4 x i32> %r21, !dbg !4589
+}
+
+define i64 @kernel_199(ptr %grid) !dbg !4590 {
+entry:
+  br label %walk, !dbg !4591
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !4592
+  br i1 %c1, label %done, label %body, !dbg !4593
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !4594
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !4595
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !4596
+  %r5 = call i64 @kernel_190(ptr %pr2, i32 %n4), !dbg !4597
+  %a6 = add i64 %tot, %r5, !dbg !4598
+  %r7 = call i64 @kernel_195(ptr %pr2, i32 %n4), !dbg !4599
+  %a8 = add i64 %a6, %r7, !dbg !4600
+  store i64 %a8, ptr @g7, align 8, !tbaa !20, !dbg !4601
+  %tot.next = add i64 %a8, 1, !dbg !4602
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !4603
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !4604
+  br label %walk, !dbg !4605
+
+done:
+  ret i64 %tot, !dbg !4606
+}
+
+define i64 @kernel_200(ptr noalias %recs, i32 %n) !dbg !4607 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !4608
+  %nw2 = zext i32 %n to i64, !dbg !4609
+  br i1 %c1, label %loop, label %exit, !dbg !4610
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !4611
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !4612
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !4613
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !4614
+  %c7 = icmp slt i32 %a4, 12, !dbg !4615
+  br i1 %c7, label %then, label %else, !dbg !4616
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !4617
+  %y9 = and i64 %x8, %b6, !dbg !4618
+  br label %latch, !dbg !4619
+
+else:
+  %z10 = mul i64 %b6, 22, !dbg !4620
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !4621
+  br label %latch, !dbg !4622
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !4623
+  %i.next = add nuw nsw i64 %i, 1, !dbg !4624
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !4625
+  br i1 %d12, label %exit, label %loop, !dbg !4626, !llvm.loop !4627
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !4628
+}
+
+define void @kernel_201(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !4629 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !4630
+  br i1 %c1, label %outer, label %exit, !dbg !4631
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !4632
+  br label %inner, !dbg !4633
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !4634
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !4635
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !4636
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !4637
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !4638
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !4639
+  %j.next = add nuw nsw i64 %j, 1, !dbg !4640
+  %d8 = icmp eq i64 %j.next, %n, !dbg !4641
+  br i1 %d8, label %outer.latch, label %inner, !dbg !4642
+
+outer.latch:
+  %sc9 = fmul double %s.next, 9.500000e+00, !dbg !4643
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !4644
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !4645
+  %i.next = add nuw nsw i64 %i, 1, !dbg !4646
+  %d11 = icmp eq i64 %i.next, %n, !dbg !4647
+  br i1 %d11, label %exit, label %outer, !dbg !4648
+
+exit:
+  ret void, !dbg !4649
+}
+
+define i32 @kernel_202(i32 %op, i32 %x) !dbg !4650 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+    i32 3, label %case3
+    i32 4, label %case4
+    i32 5, label %case5
+  ], !dbg !4651
+
+case0:
+  %r1 = call i32 @kernel_192(i32 0, i32 %x), !dbg !4652
+  br label %join, !dbg !4653
+
+case1:
+  %r2 = call i32 @kernel_192(i32 1, i32 %x), !dbg !4654
+  br label %join, !dbg !4655
+
+case2:
+  %r3 = call i32 @kernel_197(i32 2, i32 %x), !dbg !4656
+  br label %join, !dbg !4657
+
+case3:
+  %r4 = mul i32 %x, 2, !dbg !4658
+  br label %join, !dbg !4659
+
+case4:
+  %r5 = or i32 %x, 9, !dbg !4660
+  br label %join, !dbg !4661
+
+case5:
+  %r6 = sub i32 %x, 11, !dbg !4662
+  br label %join, !dbg !4663
+
+default:
+  %p7 = getelementptr inbounds [16 x i32], ptr @g56, i64 0, i64 5, !dbg !4664
+  %l8 = load i32, ptr %p7, align 4, !tbaa !19, !dbg !4665
+  %u9 = call i32 @llvm.umin.i32(i32 %l8, i32 %x), !dbg !4666
+  br label %join, !dbg !4667
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %r4, %case3 ], [ %r5, %case4 ], [ %r6, %case5 ], [ %u9, %default ]
+  ret i32 %res, !dbg !4668
+}
+
+define <4 x i32> @kernel_203(<4 x i32> %v, i32 %s) !dbg !4669 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !4670
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !4671
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4672
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4673
+  %w3 = or <4 x i32> %v, %bc2, !dbg !4674
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4675
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4676
+  %w6 = and <4 x i32> %w3, %bc5, !dbg !4677
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4678
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4679
+  %w9 = xor <4 x i32> %w6, %bc8, !dbg !4680
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4681
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4682
+  %w12 = mul <4 x i32> %w9, %bc11, !dbg !4683
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4684
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4685
+  %w15 = or <4 x i32> %w12, %bc14, !dbg !4686
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4687
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4688
+  %w18 = xor <4 x i32> %w15, %bc17, !dbg !4689
+  %sp19 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4690
+  %bc20 = shufflevector <4 x i32> %sp19, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4691
+  %w21 = add <4 x i32> %w18, %bc20, !dbg !4692
+  %sp22 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4693
+  %bc23 = shufflevector <4 x i32> %sp22, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4694
+  %w24 = or <4 x i32> %w21, %bc23, !dbg !4695
+  %sp25 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4696
+  %bc26 = shufflevector <4 x i32> %sp25, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4697
+  %w27 = add <4 x i32> %w24, %bc26, !dbg !4698
+  %sp28 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4699
+  %bc29 = shufflevector <4 x i32> %sp28, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4700
+  %w30 = add <4 x i32> %w27, %bc29, !dbg !4701
+  %sp31 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4702
+  %bc32 = shufflevector <4 x i32> %sp31, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4703
+  %w33 = add <4 x i32> %w30, %bc32, !dbg !4704
+  store <4 x i32> %w33, ptr %buf, align 16, !tbaa !19, !dbg !4705
+  %e34 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 2, !dbg !4706
+  %l35 = load i32, ptr %e34, align 4, !tbaa !19, !dbg !4707
+  %r36 = insertelement <4 x i32> %w33, i32 %l35, i64 3, !dbg !4708
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !4709
+  ret <4 x i32> %r36, !dbg !4710
+}
+
+define i64 @kernel_204(ptr %grid) !dbg !4711 {
+entry:
+  br label %walk, !dbg !4712
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !4713
+  br i1 %c1, label %done, label %body, !dbg !4714
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !4715
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !4716
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !4717
+  %r5 = call i64 @kernel_200(ptr %pr2, i32 %n4), !dbg !4718
+  %a6 = add i64 %tot, %r5, !dbg !4719
+  %r7 = call i64 @kernel_195(ptr %pr2, i32 %n4), !dbg !4720
+  %a8 = add i64 %a6, %r7, !dbg !4721
+  store i64 %a8, ptr @g11, align 8, !tbaa !20, !dbg !4722
+  %tot.next = add i64 %a8, 1, !dbg !4723
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !4724
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !4725
+  br label %walk, !dbg !4726
+
+done:
+  %pc10 = call i32 (ptr, ...) @printf(ptr @g22), !dbg !4727
+  ret i64 %tot, !dbg !4728
+}
+
+define i64 @kernel_205(ptr noalias %recs, i32 %n) !dbg !4729 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !4730
+  %nw2 = zext i32 %n to i64, !dbg !4731
+  br i1 %c1, label %loop, label %exit, !dbg !4732
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !4733
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !4734
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !4735
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !4736
+  %c7 = icmp slt i32 %a4, 43, !dbg !4737
+  br i1 %c7, label %then, label %else, !dbg !4738
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !4739
+  %y9 = sub i64 %x8, %b6, !dbg !4740
+  br label %latch, !dbg !4741
+
+else:
+  %z10 = xor i64 %b6, 27, !dbg !4742
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !4743
+  br label %latch, !dbg !4744
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !4745
+  %i.next = add nuw nsw i64 %i, 1, !dbg !4746
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !4747
+  br i1 %d12, label %exit, label %loop, !dbg !4748, !llvm.loop !4749
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !4750
+}
+
+define void @kernel_206(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !4751 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !4752
+  br i1 %c1, label %outer, label %exit, !dbg !4753
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !4754
+  br label %inner, !dbg !4755
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !4756
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !4757
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !4758
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !4759
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !4760
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !4761
+  %j.next = add nuw nsw i64 %j, 1, !dbg !4762
+  %d8 = icmp eq i64 %j.next, %n, !dbg !4763
+  br i1 %d8, label %outer.latch, label %inner, !dbg !4764
+
+outer.latch:
+  %sc9 = fmul double %s.next, 2.500000e+00, !dbg !4765
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !4766
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !4767
+  %i.next = add nuw nsw i64 %i, 1, !dbg !4768
+  %d11 = icmp eq i64 %i.next, %n, !dbg !4769
+  br i1 %d11, label %exit, label %outer, !dbg !4770
+
+exit:
+  ret void, !dbg !4771
+}
+
+define i32 @kernel_207(i32 %op, i32 %x) !dbg !4772 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+    i32 3, label %case3
+    i32 4, label %case4
+    i32 5, label %case5
+    i32 6, label %case6
+  ], !dbg !4773
+
+case0:
+  %r1 = call i32 @kernel_197(i32 0, i32 %x), !dbg !4774
+  br label %join, !dbg !4775
+
+case1:
+  %r2 = sub i32 %x, 9, !dbg !4776
+  br label %join, !dbg !4777
+
+case2:
+  %r3 = call i32 @kernel_202(i32 2, i32 %x), !dbg !4778
+  br label %join, !dbg !4779
+
+case3:
+  %r4 = shl i32 %x, 7, !dbg !4780
+  br label %join, !dbg !4781
+
+case4:
+  %r5 = call i32 @kernel_202(i32 4, i32 %x), !dbg !4782
+  br label %join, !dbg !4783
+
+case5:
+  %r6 = call i32 @kernel_202(i32 5, i32 %x), !dbg !4784
+  br label %join, !dbg !4785
+
+case6:
+  %r7 = call i32 @kernel_202(i32 6, i32 %x), !dbg !4786
+  br label %join, !dbg !4787
+
+default:
+  %p8 = getelementptr inbounds [16 x i32], ptr @g60, i64 0, i64 1, !dbg !4788
+  %l9 = load i32, ptr %p8, align 4, !tbaa !19, !dbg !4789
+  %u10 = call i32 @llvm.umin.i32(i32 %l9, i32 %x), !dbg !4790
+  br label %join, !dbg !4791
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %r4, %case3 ], [ %r5, %case4 ], [ %r6, %case5 ], [ %r7, %case6 ], [ %u10, %default ]
+  ret i32 %res, !dbg !4792
+}
+
+define <4 x i32> @kernel_208(<4 x i32> %v, i32 %s) !dbg !4793 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !4794
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !4795
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4796
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4797
+  %w3 = xor <4 x i32> %v, %bc2, !dbg !4798
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4799
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4800
+  %w6 = and <4 x i32> %w3, %bc5, !dbg !4801
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4802
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4803
+  %w9 = and <4 x i32> %w6, %bc8, !dbg !4804
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4805
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4806
+  %w12 = and <4 x i32> %w9, %bc11, !dbg !4807
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4808
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4809
+  %w15 = and <4 x i32> %w12, %bc14, !dbg !4810
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4811
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4812
+  %w18 = or <4 x i32> %w15, %bc17, !dbg !4813
+  store <4 x i32> %w18, ptr %buf, align 16, !tbaa !19, !dbg !4814
+  %e19 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 0, !dbg !4815
+  %l20 = load i32, ptr %e19, align 4, !tbaa !19, !dbg !4816
+  %r21 = insertelement <4 x i32> %w18, i32 %l20, i64 3, !dbg !4817
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !4818
+  ret <4 x i32> %r21, !dbg !4819
+}
+
+define i64 @kernel_209(ptr %grid) !dbg !4820 {
+entry:
+  br label %walk, !dbg !4821
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !4822
+  br i1 %c1, label %done, label %body, !dbg !4823
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !4824
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !4825
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !4826
+  %r5 = call i64 @kernel_200(ptr %pr2, i32 %n4), !dbg !4827
+  %a6 = add i64 %tot, %r5, !dbg !4828
+  %r7 = call i64 @kernel_205(ptr %pr2, i32 %n4), !dbg !4829
+  %a8 = add i64 %a6, %r7, !dbg !4830
+  store i64 %a8, ptr @g7, align 8, !tbaa !20, !dbg !4831
+  %tot.next = add i64 %a8, 1, !dbg !4832
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !4833
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !4834
+  br label %walk, !dbg !4835
+
+done:
+  ret i64 %tot, !dbg !4836
+}
+
+define i64 @kernel_210(ptr noalias %recs, i32 %n) !dbg !4837 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !4838
+  %nw2 = zext i32 %n to i64, !dbg !4839
+  br i1 %c1, label %loop, label %exit, !dbg !4840
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !4841
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !4842
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !4843
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !4844
+  %c7 = icmp slt i32 %a4, 63, !dbg !4845
+  br i1 %c7, label %then, label %else, !dbg !4846
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !4847
+  %y9 = and i64 %x8, %b6, !dbg !4848
+  br label %latch, !dbg !4849
+
+else:
+  %z10 = add nsw i64 %b6, 13, !dbg !4850
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !4851
+  br label %latch, !dbg !4852
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !4853
+  %i.next = add nuw nsw i64 %i, 1, !dbg !4854
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !4855
+  br i1 %d12, label %exit, label %loop, !dbg !4856, !llvm.loop !4857
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !4858
+}
+
+define void @kernel_211(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !4859 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !4860
+  br i1 %c1, label %outer, label %exit, !dbg !4861
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !4862
+  br label %inner, !dbg !4863
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !4864
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !4865
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !4866
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !4867
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !4868
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !4869
+  %j.next = add nuw nsw i64 %j, 1, !dbg !4870
+  %d8 = icmp eq i64 %j.next, %n, !dbg !4871
+  br i1 %d8, label %outer.latch, label %inner, !dbg !4872
+
+outer.latch:
+  %sc9 = fmul double %s.next, 6.500000e+00, !dbg !4873
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !4874
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !4875
+  %i.next = add nuw nsw i64 %i, 1, !dbg !4876
+  %d11 = icmp eq i64 %i.next, %n, !dbg !4877
+  br i1 %d11, label %exit, label %outer, !dbg !4878
+
+exit:
+  ret void, !dbg !4879
+}
+
+define i32 @kernel_212(i32 %op, i32 %x) !dbg !4880 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+    i32 3, label %case3
+    i32 4, label %case4
+  ], !dbg !4881
+
+case0:
+  %r1 = call i32 @kernel_202(i32 0, i32 %x), !dbg !4882
+  br label %join, !dbg !4883
+
+case1:
+  %r2 = call i32 @kernel_202(i32 1, i32 %x), !dbg !4884
+  br label %join, !dbg !4885
+
+case2:
+  %r3 = and i32 %x, 4, !dbg !4886
+  br label %join, !dbg !4887
+
+case3:
+  %r4 = call i32 @kernel_202(i32 3, i32 %x), !dbg !4888
+  br label %join, !dbg !4889
+
+case4:
+  %r5 = call i32 @kernel_207(i32 4, i32 %x), !dbg !4890
+  br label %join, !dbg !4891
+
+default:
+  %p6 = getelementptr inbounds [16 x i32], ptr @g8, i64 0, i64 1, !dbg !4892
+  %l7 = load i32, ptr %p6, align 4, !tbaa !19, !dbg !4893
+  %u8 = call i32 @llvm.umin.i32(i32 %l7, i32 %x), !dbg !4894
+  br label %join, !dbg !4895
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %r4, %case3 ], [ %r5, %case4 ], [ %u8, %default ]
+  ret i32 %res, !dbg !4896
+}
+
+define <4 x i32> @kernel_213(<4 x i32> %v, i32 %s) !dbg !4897 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !4898
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !4899
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4900
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4901
+  %w3 = and <4 x i32> %v, %bc2, !dbg !4902
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4903
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4904
+  %w6 = xor <4 x i32> %w3, %bc5, !dbg !4905
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4906
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4907
+  %w9 = or <4 x i32> %w6, %bc8, !dbg !4908
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4909
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4910
+  %w12 = and <4 x i32> %w9, %bc11, !dbg !4911
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4912
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4913
+  %w15 = add <4 x i32> %w12, %bc14, !dbg !4914
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4915
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4916
+  %w18 = and <4 x i32> %w15, %bc17, !dbg !4917
+  %sp19 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4918
+  %bc20 = shufflevector <4 x i32> %sp19, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4919
+  %w21 = or <4 x i32> %w18, %bc20, !dbg !4920
+  %sp22 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4921
+  %bc23 = shufflevector <4 x i32> %sp22, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4922
+  %w24 = mul <4 x i32> %w21, %bc23, !dbg !4923
+  %sp25 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4924
+  %bc26 = shufflevector <4 x i32> %sp25, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4925
+  %w27 = and <4 x i32> %w24, %bc26, !dbg !4926
+  %sp28 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4927
+  %bc29 = shufflevector <4 x i32> %sp28, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4928
+  %w30 = and <4 x i32> %w27, %bc29, !dbg !4929
+  %sp31 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4930
+  %bc32 = shufflevector <4 x i32> %sp31, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4931
+  %w33 = xor <4 x i32> %w30, %bc32, !dbg !4932
+  %sp34 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !4933
+  %bc35 = shufflevector <4 x i32> %sp34, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !4934
+  %w36 = xor <4 x i32> %w33, %bc35, !dbg !4935
+  store <4 x i32> %w36, ptr %buf, align 16, !tbaa !19, !dbg !4936
+  %e37 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 3, !dbg !4937
+  %l38 = load i32, ptr %e37, align 4, !tbaa !19, !dbg !4938
+  %r39 = insertelement <4 x i32> %w36, i32 %l38, i64 3, !dbg !4939
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !4940
+  ret <4 x i32> %r39, !dbg !4941
+}
+
+define i64 @kernel_214(ptr %grid) !dbg !4942 {
+entry:
+  br label %walk, !dbg !4943
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !4944
+  br i1 %c1, label %done, label %body, !dbg !4945
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !4946
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !4947
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !4948
+  %r5 = call i64 @kernel_205(ptr %pr2, i32 %n4), !dbg !4949
+  %a6 = add i64 %tot, %r5, !dbg !4950
+  %r7 = call i64 @kernel_210(ptr %pr2, i32 %n4), !dbg !4951
+  %a8 = add i64 %a6, %r7, !dbg !4952
+  store i64 %a8, ptr @g35, align 8, !tbaa !20, !dbg !4953
+  %tot.next = add i64 %a8, 1, !dbg !4954
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !4955
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !4956
+  br label %walk, !dbg !4957
+
+done:
+  %pc10 = call i32 (ptr, ...) @printf(ptr @g62), !dbg !4958
+  ret i64 %tot, !dbg !4959
+}
+
+define i64 @kernel_215(ptr noalias %recs, i32 %n) !dbg !4960 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !4961
+  %nw2 = zext i32 %n to i64, !dbg !4962
+  br i1 %c1, label %loop, label %exit, !dbg !4963
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !4964
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !4965
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !4966
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !4967
+  %c7 = icmp slt i32 %a4, 11, !dbg !4968
+  br i1 %c7, label %then, label %else, !dbg !4969
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !4970
+  %y9 = sub i64 %x8, %b6, !dbg !4971
+  br label %latch, !dbg !4972
+
+else:
+  %z10 = xor i64 %b6, 3, !dbg !4973
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !4974
+  br label %latch, !dbg !4975
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !4976
+  %i.next = add nuw nsw i64 %i, 1, !dbg !4977
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !4978
+  br i1 %d12, label %exit, label %loop, !dbg !4979, !llvm.loop !4980
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !4981
+}
+
+define void @kernel_216(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !4982 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !4983
+  br i1 %c1, label %outer, label %exit, !dbg !4984
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !4985
+  br label %inner, !dbg !4986
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !4987
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !4988
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !4989
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !4990
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !4991
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !4992
+  %j.next = add nuw nsw i64 %j, 1, !dbg !4993
+  %d8 = icmp eq i64 %j.next, %n, !dbg !4994
+  br i1 %d8, label %outer.latch, label %inner, !dbg !4995
+
+outer.latch:
+  %sc9 = fmul double %s.next, 7.500000e+00, !dbg !4996
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !4997
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !4998
+  %i.next = add nuw nsw i64 %i, 1, !dbg !4999
+  %d11 = icmp eq i64 %i.next, %n, !dbg !5000
+  br i1 %d11, label %exit, label %outer, !dbg !5001
+
+exit:
+  ret void, !dbg !5002
+}
+
+define i32 @kernel_217(i32 %op, i32 %x) !dbg !5003 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+    i32 3, label %case3
+  ], !dbg !5004
+
+case0:
+  %r1 = ashr i32 %x, 15, !dbg !5005
+  br label %join, !dbg !5006
+
+case1:
+  %r2 = call i32 @kernel_207(i32 1, i32 %x), !dbg !5007
+  br label %join, !dbg !5008
+
+case2:
+  %r3 = lshr i32 %x, 5, !dbg !5009
+  br label %join, !dbg !5010
+
+case3:
+  %r4 = call i32 @kernel_207(i32 3, i32 %x), !dbg !5011
+  br label %join, !dbg !5012
+
+default:
+  %p5 = getelementptr inbounds [16 x i32], ptr @g52, i64 0, i64 7, !dbg !5013
+  %l6 = load i32, ptr %p5, align 4, !tbaa !19, !dbg !5014
+  %u7 = call i32 @llvm.umin.i32(i32 %l6, i32 %x), !dbg !5015
+  br label %join, !dbg !5016
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %r4, %case3 ], [ %u7, %default ]
+  ret i32 %res, !dbg !5017
+}
+
+define <4 x i32> @kernel_218(<4 x i32> %v, i32 %s) !dbg !5018 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !5019
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !5020
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5021
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5022
+  %w3 = and <4 x i32> %v, %bc2, !dbg !5023
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5024
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5025
+  %w6 = add <4 x i32> %w3, %bc5, !dbg !5026
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5027
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5028
+  %w9 = and <4 x i32> %w6, %bc8, !dbg !5029
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5030
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5031
+  %w12 = add <4 x i32> %w9, %bc11, !dbg !5032
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5033
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5034
+  %w15 = add <4 x i32> %w12, %bc14, !dbg !5035
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5036
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5037
+  %w18 = xor <4 x i32> %w15, %bc17, !dbg !5038
+  %sp19 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5039
+  %bc20 = shufflevector <4 x i32> %sp19, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5040
+  %w21 = or <4 x i32> %w18, %bc20, !dbg !5041
+  %sp22 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5042
+  %bc23 = shufflevector <4 x i32> %sp22, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5043
+  %w24 = xor <4 x i32> %w21, %bc23, !dbg !5044
+  %sp25 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5045
+  %bc26 = shufflevector <4 x i32> %sp25, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5046
+  %w27 = mul <4 x i32> %w24, %bc26, !dbg !5047
+  %sp28 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5048
+  %bc29 = shufflevector <4 x i32> %sp28, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5049
+  %w30 = add <4 x i32> %w27, %bc29, !dbg !5050
+  %sp31 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5051
+  %bc32 = shufflevector <4 x i32> %sp31, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5052
+  %w33 = add <4 x i32> %w30, %bc32, !dbg !5053
+  store <4 x i32> %w33, ptr %buf, align 16, !tbaa !19, !dbg !5054
+  %e34 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 2, !dbg !5055
+  %l35 = load i32, ptr %e34, align 4, !tbaa !19, !dbg !5056
+  %r36 = insertelement <4 x i32> %w33, i32 %l35, i64 3, !dbg !5057
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !5058
+  ret <4 x i32> %r36, !dbg !5059
+}
+
+define i64 @kernel_219(ptr %grid) !dbg !5060 {
+entry:
+  br label %walk, !dbg !5061
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !5062
+  br i1 %c1, label %done, label %body, !dbg !5063
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !5064
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !5065
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !5066
+  %r5 = call i64 @kernel_210(ptr %pr2, i32 %n4), !dbg !5067
+  %a6 = add i64 %tot, %r5, !dbg !5068
+  %r7 = call i64 @kernel_215(ptr %pr2, i32 %n4), !dbg !5069
+  %a8 = add i64 %a6, %r7, !dbg !5070
+  store i64 %a8, ptr @g35, align 8, !tbaa !20, !dbg !5071
+  %tot.next = add i64 %a8, 1, !dbg !5072
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !5073
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !5074
+  br label %walk, !dbg !5075
+
+done:
+  ret i64 %tot, !dbg !5076
+}
+
+define i64 @kernel_220(ptr noalias %recs, i32 %n) !dbg !5077 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !5078
+  %nw2 = zext i32 %n to i64, !dbg !5079
+  br i1 %c1, label %loop, label %exit, !dbg !5080
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !5081
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !5082
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !5083
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !5084
+  %c7 = icmp slt i32 %a4, 44, !dbg !5085
+  br i1 %c7, label %then, label %else, !dbg !5086
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !5087
+  %y9 = xor i64 %x8, %b6, !dbg !5088
+  br label %latch, !dbg !5089
+
+else:
+  %z10 = or i64 %b6, 20, !dbg !5090
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !5091
+  br label %latch, !dbg !5092
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !5093
+  %i.next = add nuw nsw i64 %i, 1, !dbg !5094
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !5095
+  br i1 %d12, label %exit, label %loop, !dbg !5096, !llvm.loop !5097
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !5098
+}
+
+define void @kernel_221(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !5099 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !5100
+  br i1 %c1, label %outer, label %exit, !dbg !5101
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !5102
+  br label %inner, !dbg !5103
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !5104
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !5105
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !5106
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !5107
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !5108
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !5109
+  %j.next = add nuw nsw i64 %j, 1, !dbg !5110
+  %d8 = icmp eq i64 %j.next, %n, !dbg !5111
+  br i1 %d8, label %outer.latch, label %inner, !dbg !5112
+
+outer.latch:
+  %sc9 = fmul double %s.next, 3.500000e+00, !dbg !5113
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !5114
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !5115
+  %i.next = add nuw nsw i64 %i, 1, !dbg !5116
+  %d11 = icmp eq i64 %i.next, %n, !dbg !5117
+  br i1 %d11, label %exit, label %outer, !dbg !5118
+
+exit:
+  ret void, !dbg !5119
+}
+
+define i32 @kernel_222(i32 %op, i32 %x) !dbg !5120 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+    i32 3, label %case3
+  ], !dbg !5121
+
+case0:
+  %r1 = call i32 @kernel_212(i32 0, i32 %x), !dbg !5122
+  br label %join, !dbg !5123
+
+case1:
+  %r2 = shl i32 %x, 7, !dbg !5124
+  br label %join, !dbg !5125
+
+case2:
+  %r3 = call i32 @kernel_212(i32 2, i32 %x), !dbg !5126
+  br label %join, !dbg !5127
+
+case3:
+  %r4 = call i32 @kernel_212(i32 3, i32 %x), !dbg !5128
+  br label %join, !dbg !5129
+
+default:
+  %p5 = getelementptr inbounds [16 x i32], ptr @g44, i64 0, i64 13, !dbg !5130
+  %l6 = load i32, ptr %p5, align 4, !tbaa !19, !dbg !5131
+  %u7 = call i32 @llvm.umin.i32(i32 %l6, i32 %x), !dbg !5132
+  br label %join, !dbg !5133
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %r4, %case3 ], [ %u7, %default ]
+  ret i32 %res, !dbg !5134
+}
+
+define <4 x i32> @kernel_223(<4 x i32> %v, i32 %s) !dbg !5135 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !5136
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !5137
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5138
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5139
+  %w3 = add <4 x i32> %v, %bc2, !dbg !5140
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5141
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5142
+  %w6 = add <4 x i32> %w3, %bc5, !dbg !5143
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5144
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5145
+  %w9 = or <4 x i32> %w6, %bc8, !dbg !5146
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5147
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5148
+  %w12 = and <4 x i32> %w9, %bc11, !dbg !5149
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5150
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5151
+  %w15 = or <4 x i32> %w12, %bc14, !dbg !5152
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5153
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5154
+  %w18 = xor <4 x i32> %w15, %bc17, !dbg !5155
+  %sp19 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5156
+  %bc20 = shufflevector <4 x i32> %sp19, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5157
+  %w21 = or <4 x i32> %w18, %bc20, !dbg !5158
+  store <4 x i32> %w21, ptr %buf, align 16, !tbaa !19, !dbg !5159
+  %e22 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 1, !dbg !5160
+  %l23 = load i32, ptr %e22, align 4, !tbaa !19, !dbg !5161
+  %r24 = insertelement <4 x i32> %w21, i32 %l23, i64 3, !dbg !5162
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !5163
+  ret <4 x i32> %r24, !dbg !5164
+}
+
+define i64 @kernel_224(ptr %grid) !dbg !5165 {
+entry:
+  br label %walk, !dbg !5166
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !5167
+  br i1 %c1, label %done, label %body, !dbg !5168
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !5169
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !5170
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !5171
+  %r5 = call i64 @kernel_220(ptr %pr2, i32 %n4), !dbg !5172
+  %a6 = add i64 %tot, %r5, !dbg !5173
+  %r7 = call i64 @kernel_215(ptr %pr2, i32 %n4), !dbg !5174
+  %a8 = add i64 %a6, %r7, !dbg !5175
+  store i64 %a8, ptr @g39, align 8, !tbaa !20, !dbg !5176
+  %tot.next = add i64 %a8, 1, !dbg !5177
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !5178
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !5179
+  br label %walk, !dbg !5180
+
+done:
+  %pc10 = call i32 (ptr, ...) @printf(ptr @g30), !dbg !5181
+  ret i64 %tot, !dbg !5182
+}
+
+define i64 @kernel_225(ptr noalias %recs, i32 %n) !dbg !5183 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !5184
+  %nw2 = zext i32 %n to i64, !dbg !5185
+  br i1 %c1, label %loop, label %exit, !dbg !5186
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !5187
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !5188
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !5189
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !5190
+  %c7 = icmp slt i32 %a4, 13, !dbg !5191
+  br i1 %c7, label %then, label %else, !dbg !5192
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !5193
+  %y9 = add nsw i64 %x8, %b6, !dbg !5194
+  br label %latch, !dbg !5195
+
+else:
+  %z10 = and i64 %b6, 4, !dbg !5196
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !5197
+  br label %latch, !dbg !5198
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !5199
+  %i.next = add nuw nsw i64 %i, 1, !dbg !5200
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !5201
+  br i1 %d12, label %exit, label %loop, !dbg !5202, !llvm.loop !5203
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !5204
+}
+
+define void @kernel_226(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !5205 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !5206
+  br i1 %c1, label %outer, label %exit, !dbg !5207
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !5208
+  br label %inner, !dbg !5209
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !5210
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !5211
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !5212
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !5213
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !5214
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !5215
+  %j.next = add nuw nsw i64 %j, 1, !dbg !5216
+  %d8 = icmp eq i64 %j.next, %n, !dbg !5217
+  br i1 %d8, label %outer.latch, label %inner, !dbg !5218
+
+outer.latch:
+  %sc9 = fmul double %s.next, 7.500000e+00, !dbg !5219
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !5220
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !5221
+  %i.next = add nuw nsw i64 %i, 1, !dbg !5222
+  %d11 = icmp eq i64 %i.next, %n, !dbg !5223
+  br i1 %d11, label %exit, label %outer, !dbg !5224
+
+exit:
+  ret void, !dbg !5225
+}
+
+define i32 @kernel_227(i32 %op, i32 %x) !dbg !5226 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+    i32 3, label %case3
+    i32 4, label %case4
+    i32 5, label %case5
+  ], !dbg !5227
+
+case0:
+  %r1 = call i32 @kernel_217(i32 0, i32 %x), !dbg !5228
+  br label %join, !dbg !5229
+
+case1:
+  %r2 = call i32 @kernel_217(i32 1, i32 %x), !dbg !5230
+  br label %join, !dbg !5231
+
+case2:
+  %r3 = call i32 @kernel_217(i32 2, i32 %x), !dbg !5232
+  br label %join, !dbg !5233
+
+case3:
+  %r4 = shl i32 %x, 10, !dbg !5234
+  br label %join, !dbg !5235
+
+case4:
+  %r5 = call i32 @kernel_222(i32 4, i32 %x), !dbg !5236
+  br label %join, !dbg !5237
+
+case5:
+  %r6 = call i32 @kernel_217(i32 5, i32 %x), !dbg !5238
+  br label %join, !dbg !5239
+
+default:
+  %p7 = getelementptr inbounds [16 x i32], ptr @g8, i64 0, i64 11, !dbg !5240
+  %l8 = load i32, ptr %p7, align 4, !tbaa !19, !dbg !5241
+  %u9 = call i32 @llvm.umin.i32(i32 %l8, i32 %x), !dbg !5242
+  br label %join, !dbg !5243
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %r4, %case3 ], [ %r5, %case4 ], [ %r6, %case5 ], [ %u9, %default ]
+  ret i32 %res, !dbg !5244
+}
+
+define <4 x i32> @kernel_228(<4 x i32> %v, i32 %s) !dbg !5245 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !5246
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !5247
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5248
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5249
+  %w3 = add <4 x i32> %v, %bc2, !dbg !5250
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5251
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5252
+  %w6 = mul <4 x i32> %w3, %bc5, !dbg !5253
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5254
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5255
+  %w9 = and <4 x i32> %w6, %bc8, !dbg !5256
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5257
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5258
+  %w12 = mul <4 x i32> %w9, %bc11, !dbg !5259
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5260
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5261
+  %w15 = and <4 x i32> %w12, %bc14, !dbg !5262
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5263
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5264
+  %w18 = or <4 x i32> %w15, %bc17, !dbg !5265
+  %sp19 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5266
+  %bc20 = shufflevector <4 x i32> %sp19, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5267
+  %w21 = or <4 x i32> %w18, %bc20, !dbg !5268
+  %sp22 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5269
+  %bc23 = shufflevector <4 x i32> %sp22, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5270
+  %w24 = or <4 x i32> %w21, %bc23, !dbg !5271
+  %sp25 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5272
+  %bc26 = shufflevector <4 x i32> %sp25, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5273
+  %w27 = and <4 x i32> %w24, %bc26, !dbg !5274
+  %sp28 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5275
+  %bc29 = shufflevector <4 x i32> %sp28, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5276
+  %w30 = xor <4 x i32> %w27, %bc29, !dbg !5277
+  store <4 x i32> %w30, ptr %buf, align 16, !tbaa !19, !dbg !5278
+  %e31 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 1, !dbg !5279
+  %l32 = load i32, ptr %e31, align 4, !tbaa !19, !dbg !5280
+  %r33 = insertelement <4 x i32> %w30, i32 %l32, i64 3, !dbg !5281
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !5282
+  ret <4 x i32> %r33, !dbg !5283
+}
+
+define i64 @kernel_229(ptr %grid) !dbg !5284 {
+entry:
+  br label %walk, !dbg !5285
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !5286
+  br i1 %c1, label %done, label %body, !dbg !5287
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !5288
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !5289
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !5290
+  %r5 = call i64 @kernel_220(ptr %pr2, i32 %n4), !dbg !5291
+  %a6 = add i64 %tot, %r5, !dbg !5292
+  %r7 = call i64 @kernel_225(ptr %pr2, i32 %n4), !dbg !5293
+  %a8 = add i64 %a6, %r7, !dbg !5294
+  store i64 %a8, ptr @g59, align 8, !tbaa !20, !dbg !5295
+  %tot.next = add i64 %a8, 1, !dbg !5296
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !5297
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !5298
+  br label %walk, !dbg !5299
+
+done:
+  ret i64 %tot, !dbg !5300
+}
+
+define i64 @kernel_230(ptr noalias %recs, i32 %n) !dbg !5301 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !5302
+  %nw2 = zext i32 %n to i64, !dbg !5303
+  br i1 %c1, label %loop, label %exit, !dbg !5304
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !5305
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !5306
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !5307
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !5308
+  %c7 = icmp slt i32 %a4, 48, !dbg !5309
+  br i1 %c7, label %then, label %else, !dbg !5310
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !5311
+  %y9 = xor i64 %x8, %b6, !dbg !5312
+  br label %latch, !dbg !5313
+
+else:
+  %z10 = sub i64 %b6, 17, !dbg !5314
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !5315
+  br label %latch, !dbg !5316
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !5317
+  %i.next = add nuw nsw i64 %i, 1, !dbg !5318
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !5319
+  br i1 %d12, label %exit, label %loop, !dbg !5320, !llvm.loop !5321
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !5322
+}
+
+define void @kernel_231(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !5323 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !5324
+  br i1 %c1, label %outer, label %exit, !dbg !5325
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !5326
+  br label %inner, !dbg !5327
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !5328
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !5329
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !5330
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !5331
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !5332
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !5333
+  %j.next = add nuw nsw i64 %j, 1, !dbg !5334
+  %d8 = icmp eq i64 %j.next, %n, !dbg !5335
+  br i1 %d8, label %outer.latch, label %inner, !dbg !5336
+
+outer.latch:
+  %sc9 = fmul double %s.next, 3.500000e+00, !dbg !5337
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !5338
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !5339
+  %i.next = add nuw nsw i64 %i, 1, !dbg !5340
+  %d11 = icmp eq i64 %i.next, %n, !dbg !5341
+  br i1 %d11, label %exit, label %outer, !dbg !5342
+
+exit:
+  ret void, !dbg !5343
+}
+
+define i32 @kernel_232(i32 %op, i32 %x) !dbg !5344 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+    i32 3, label %case3
+    i32 4, label %case4
+    i32 5, label %case5
+  ], !dbg !5345
+
+case0:
+  %r1 = add nsw i32 %x, 12, !dbg !5346
+  br label %join, !dbg !5347
+
+case1:
+  %r2 = call i32 @kernel_227(i32 1, i32 %x), !dbg !5348
+  br label %join, !dbg !5349
+
+case2:
+  %r3 = lshr i32 %x, 5, !dbg !5350
+  br label %join, !dbg !5351
+
+case3:
+  %r4 = call i32 @kernel_227(i32 3, i32 %x), !dbg !5352
+  br label %join, !dbg !5353
+
+case4:
+  %r5 = call i32 @kernel_222(i32 4, i32 %x), !dbg !5354
+  br label %join, !dbg !5355
+
+case5:
+  %r6 = or i32 %x, 11, !dbg !5356
+  br label %join, !dbg !5357
+
+default:
+  %p7 = getelementptr inbounds [16 x i32], ptr @g28, i64 0, i64 0, !dbg !5358
+  %l8 = load i32, ptr %p7, align 4, !tbaa !19, !dbg !5359
+  %u9 = call i32 @llvm.umin.i32(i32 %l8, i32 %x), !dbg !5360
+  br label %join, !dbg !5361
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %r4, %case3 ], [ %r5, %case4 ], [ %r6, %case5 ], [ %u9, %default ]
+  ret i32 %res, !dbg !5362
+}
+
+define <4 x i32> @kernel_233(<4 x i32> %v, i32 %s) !dbg !5363 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !5364
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !5365
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5366
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5367
+  %w3 = and <4 x i32> %v, %bc2, !dbg !5368
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5369
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5370
+  %w6 = and <4 x i32> %w3, %bc5, !dbg !5371
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5372
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5373
+  %w9 = and <4 x i32> %w6, %bc8, !dbg !5374
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5375
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5376
+  %w12 = or <4 x i32> %w9, %bc11, !dbg !5377
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5378
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5379
+  %w15 = xor <4 x i32> %w12, %bc14, !dbg !5380
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5381
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5382
+  %w18 = and <4 x i32> %w15, %bc17, !dbg !5383
+  %sp19 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5384
+  %bc20 = shufflevector <4 x i32> %sp19, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5385
+  %w21 = mul <4 x i32> %w18, %bc20, !dbg !5386
+  %sp22 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5387
+  %bc23 = shufflevector <4 x i32> %sp22, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5388
+  %w24 = and <4 x i32> %w21, %bc23, !dbg !5389
+  %sp25 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5390
+  %bc26 = shufflevector <4 x i32> %sp25, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5391
+  %w27 = or <4 x i32> %w24, %bc26, !dbg !5392
+  %sp28 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5393
+  %bc29 = shufflevector <4 x i32> %sp28, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5394
+  %w30 = xor <4 x i32> %w27, %bc29, !dbg !5395
+  %sp31 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5396
+  %bc32 = shufflevector <4 x i32> %sp31, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5397
+  %w33 = or <4 x i32> %w30, %bc32, !dbg !5398
+  %sp34 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5399
+  %bc35 = shufflevector <4 x i32> %sp34, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5400
+  %w36 = add <4 x i32> %w33, %bc35, !dbg !5401
+  store <4 x i32> %w36, ptr %buf, align 16, !tbaa !19, !dbg !5402
+  %e37 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 0, !dbg !5403
+  %l38 = load i32, ptr %e37, align 4, !tbaa !19, !dbg !5404
+  %r39 = insertelement <4 x i32> %w36, i32 %l38, i64 3, !dbg !5405
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !5406
+  ret <4 x i32> %r39, !dbg !5407
+}
+
+define i64 @kernel_234(ptr %grid) !dbg !5408 {
+entry:
+  br label %walk, !dbg !5409
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !5410
+  br i1 %c1, label %done, label %body, !dbg !5411
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !5412
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !5413
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !5414
+  %r5 = call i64 @kernel_225(ptr %pr2, i32 %n4), !dbg !5415
+  %a6 = add i64 %tot, %r5, !dbg !5416
+  %r7 = call i64 @kernel_230(ptr %pr2, i32 %n4), !dbg !5417
+  %a8 = add i64 %a6, %r7, !dbg !5418
+  store i64 %a8, ptr @g23, align 8, !tbaa !20, !dbg !5419
+  %tot.next = add i64 %a8, 1, !dbg !5420
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !5421
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !5422
+  br label %walk, !dbg !5423
+
+done:
+  %pc10 = call i32 (ptr, ...) @printf(ptr @g34), !dbg !5424
+  ret i64 %tot, !dbg !5425
+}
+
+define i64 @kernel_235(ptr noalias %recs, i32 %n) !dbg !5426 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !5427
+  %nw2 = zext i32 %n to i64, !dbg !5428
+  br i1 %c1, label %loop, label %exit, !dbg !5429
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !5430
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !5431
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !5432
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !5433
+  %c7 = icmp slt i32 %a4, 35, !dbg !5434
+  br i1 %c7, label %then, label %else, !dbg !5435
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !5436
+  %y9 = add nsw i64 %x8, %b6, !dbg !5437
+  br label %latch, !dbg !5438
+
+else:
+  %z10 = sub i64 %b6, 12, !dbg !5439
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !5440
+  br label %latch, !dbg !5441
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !5442
+  %i.next = add nuw nsw i64 %i, 1, !dbg !5443
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !5444
+  br i1 %d12, label %exit, label %loop, !dbg !5445, !llvm.loop !5446
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !5447
+}
+
+define void @kernel_236(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !5448 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !5449
+  br i1 %c1, label %outer, label %exit, !dbg !5450
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !5451
+  br label %inner, !dbg !5452
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !5453
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !5454
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !5455
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !5456
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !5457
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !5458
+  %j.next = add nuw nsw i64 %j, 1, !dbg !5459
+  %d8 = icmp eq i64 %j.next, %n, !dbg !5460
+  br i1 %d8, label %outer.latch, label %inner, !dbg !5461
+
+outer.latch:
+  %sc9 = fmul double %s.next, 5.500000e+00, !dbg !5462
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !5463
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !5464
+  %i.next = add nuw nsw i64 %i, 1, !dbg !5465
+  %d11 = icmp eq i64 %i.next, %n, !dbg !5466
+  br i1 %d11, label %exit, label %outer, !dbg !5467
+
+exit:
+  ret void, !dbg !5468
+}
+
+define i32 @kernel_237(i32 %op, i32 %x) !dbg !5469 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+  ], !dbg !5470
+
+case0:
+  %r1 = call i32 @kernel_232(i32 0, i32 %x), !dbg !5471
+  br label %join, !dbg !5472
+
+case1:
+  %r2 = call i32 @kernel_232(i32 1, i32 %x), !dbg !5473
+  br label %join, !dbg !5474
+
+case2:
+  %r3 = call i32 @kernel_227(i32 2, i32 %x), !dbg !5475
+  br label %join, !dbg !5476
+
+default:
+  %p4 = getelementptr inbounds [16 x i32], ptr @g8, i64 0, i64 15, !dbg !5477
+  %l5 = load i32, ptr %p4, align 4, !tbaa !19, !dbg !5478
+  %u6 = call i32 @llvm.umin.i32(i32 %l5, i32 %x), !dbg !5479
+  br label %join, !dbg !5480
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %u6, %default ]
+  ret i32 %res, !dbg !5481
+}
+
+define <4 x i32> @kernel_238(<4 x i32> %v, i32 %s) !dbg !5482 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !5483
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !5484
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5485
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5486
+  %w3 = and <4 x i32> %v, %bc2, !dbg !5487
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5488
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5489
+  %w6 = and <4 x i32> %w3, %bc5, !dbg !5490
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5491
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5492
+  %w9 = add <4 x i32> %w6, %bc8, !dbg !5493
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5494
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5495
+  %w12 = mul <4 x i32> %w9, %bc11, !dbg !5496
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5497
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5498
+  %w15 = add <4 x i32> %w12, %bc14, !dbg !5499
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5500
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5501
+  %w18 = or <4 x i32> %w15, %bc17, !dbg !5502
+  %sp19 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5503
+  %bc20 = shufflevector <4 x i32> %sp19, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5504
+  %w21 = or <4 x i32> %w18, %bc20, !dbg !5505
+  %sp22 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5506
+  %bc23 = shufflevector <4 x i32> %sp22, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5507
+  %w24 = and <4 x i32> %w21, %bc23, !dbg !5508
+  %sp25 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5509
+  %bc26 = shufflevector <4 x i32> %sp25, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5510
+  %w27 = mul <4 x i32> %w24, %bc26, !dbg !5511
+  %sp28 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5512
+  %bc29 = shufflevector <4 x i32> %sp28, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5513
+  %w30 = mul <4 x i32> %w27, %bc29, !dbg !5514
+  store <4 x i32> %w30, ptr %buf, align 16, !tbaa !19, !dbg !5515
+  %e31 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 0, !dbg !5516
+  %l32 = load i32, ptr %e31, align 4, !tbaa !19, !dbg !5517
+  %r33 = insertelement <4 x i32> %w30, i32 %l32, i64 3, !dbg !5518
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !5519
+  ret <4 x i32> %r33, !dbg !5520
+}
+
+define i64 @kernel_239(ptr %grid) !dbg !5521 {
+entry:
+  br label %walk, !dbg !5522
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !5523
+  br i1 %c1, label %done, label %body, !dbg !5524
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !5525
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !5526
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !5527
+  %r5 = call i64 @kernel_230(ptr %pr2, i32 %n4), !dbg !5528
+  %a6 = add i64 %tot, %r5, !dbg !5529
+  %r7 = call i64 @kernel_235(ptr %pr2, i32 %n4), !dbg !5530
+  %a8 = add i64 %a6, %r7, !dbg !5531
+  store i64 %a8, ptr @g27, align 8, !tbaa !20, !dbg !5532
+  %tot.next = add i64 %a8, 1, !dbg !5533
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !5534
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !5535
+  br label %walk, !dbg !5536
+
+done:
+  ret i64 %tot, !dbg !5537
+}
+
+define i64 @kernel_240(ptr noalias %recs, i32 %n) !dbg !5538 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !5539
+  %nw2 = zext i32 %n to i64, !dbg !5540
+  br i1 %c1, label %loop, label %exit, !dbg !5541
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !5542
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !5543
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !5544
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !5545
+  %c7 = icmp slt i32 %a4, 18, !dbg !5546
+  br i1 %c7, label %then, label %else, !dbg !5547
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !5548
+  %y9 = mul i64 %x8, %b6, !dbg !5549
+  br label %latch, !dbg !5550
+
+else:
+  %z10 = add nsw i64 %b6, 19, !dbg !5551
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !5552
+  br label %latch, !dbg !5553
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !5554
+  %i.next = add nuw nsw i64 %i, 1, !dbg !5555
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !5556
+  br i1 %d12, label %exit, label %loop, !dbg !5557, !llvm.loop !5558
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !5559
+}
+
+define void @kernel_241(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !5560 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !5561
+  br i1 %c1, label %outer, label %exit, !dbg !5562
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !5563
+  br label %inner, !dbg !5564
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !5565
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !5566
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !5567
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !5568
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !5569
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !5570
+  %j.next = add nuw nsw i64 %j, 1, !dbg !5571
+  %d8 = icmp eq i64 %j.next, %n, !dbg !5572
+  br i1 %d8, label %outer.latch, label %inner, !dbg !5573
+
+outer.latch:
+  %sc9 = fmul double %s.next, 2.500000e+00, !dbg !5574
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !5575
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !5576
+  %i.next = add nuw nsw i64 %i, 1, !dbg !5577
+  %d11 = icmp eq i64 %i.next, %n, !dbg !5578
+  br i1 %d11, label %exit, label %outer, !dbg !5579
+
+exit:
+  ret void, !dbg !5580
+}
+
+define i32 @kernel_242(i32 %op, i32 %x) !dbg !5581 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+    i32 3, label %case3
+    i32 4, label %case4
+    i32 5, label %case5
+  ], !dbg !5582
+
+case0:
+  %r1 = call i32 @kernel_232(i32 0, i32 %x), !dbg !5583
+  br label %join, !dbg !5584
+
+case1:
+  %r2 = call i32 @kernel_232(i32 1, i32 %x), !dbg !5585
+  br label %join, !dbg !5586
+
+case2:
+  %r3 = call i32 @kernel_232(i32 2, i32 %x), !dbg !5587
+  br label %join, !dbg !5588
+
+case3:
+  %r4 = call i32 @kernel_232(i32 3, i32 %x), !dbg !5589
+  br label %join, !dbg !5590
+
+case4:
+  %r5 = or i32 %x, 10, !dbg !5591
+  br label %join, !dbg !5592
+
+case5:
+  %r6 = ashr i32 %x, 5, !dbg !5593
+  br label %join, !dbg !5594
+
+default:
+  %p7 = getelementptr inbounds [16 x i32], ptr @g52, i64 0, i64 4, !dbg !5595
+  %l8 = load i32, ptr %p7, align 4, !tbaa !19, !dbg !5596
+  %u9 = call i32 @llvm.umin.i32(i32 %l8, i32 %x), !dbg !5597
+  br label %join, !dbg !5598
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %r4, %case3 ], [ %r5, %case4 ], [ %r6, %case5 ], [ %u9, %default ]
+  ret i32 %res, !dbg !5599
+}
+
+define <4 x i32> @kernel_243(<4 x i32> %v, i32 %s) !dbg !5600 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !5601
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !5602
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5603
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5604
+  %w3 = xor <4 x i32> %v, %bc2, !dbg !5605
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5606
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5607
+  %w6 = add <4 x i32> %w3, %bc5, !dbg !5608
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5609
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5610
+  %w9 = add <4 x i32> %w6, %bc8, !dbg !5611
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5612
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5613
+  %w12 = and <4 x i32> %w9, %bc11, !dbg !5614
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5615
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5616
+  %w15 = and <4 x i32> %w12, %bc14, !dbg !5617
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5618
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5619
+  %w18 = mul <4 x i32> %w15, %bc17, !dbg !5620
+  %sp19 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5621
+  %bc20 = shufflevector <4 x i32> %sp19, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5622
+  %w21 = xor <4 x i32> %w18, %bc20, !dbg !5623
+  %sp22 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5624
+  %bc23 = shufflevector <4 x i32> %sp22, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5625
+  %w24 = and <4 x i32> %w21, %bc23, !dbg !5626
+  %sp25 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5627
+  %bc26 = shufflevector <4 x i32> %sp25, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5628
+  %w27 = or <4 x i32> %w24, %bc26, !dbg !5629
+  store <4 x i32> %w27, ptr %buf, align 16, !tbaa !19, !dbg !5630
+  %e28 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 0, !dbg !5631
+  %l29 = load i32, ptr %e28, align 4, !tbaa !19, !dbg !5632
+  %r30 = insertelement <4 x i32> %w27, i32 %l29, i64 3, !dbg !5633
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !5634
+  ret <4 x i32> %r30, !dbg !5635
+}
+
+define i64 @kernel_244(ptr %grid) !dbg !5636 {
+entry:
+  br label %walk, !dbg !5637
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !5638
+  br i1 %c1, label %done, label %body, !dbg !5639
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !5640
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !5641
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !5642
+  %r5 = call i64 @kernel_240(ptr %pr2, i32 %n4), !dbg !5643
+  %a6 = add i64 %tot, %r5, !dbg !5644
+  %r7 = call i64 @kernel_235(ptr %pr2, i32 %n4), !dbg !5645
+  %a8 = add i64 %a6, %r7, !dbg !5646
+  store i64 %a8, ptr @g39, align 8, !tbaa !20, !dbg !5647
+  %tot.next = add i64 %a8, 1, !dbg !5648
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !5649
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !5650
+  br label %walk, !dbg !5651
+
+done:
+  %pc10 = call i32 (ptr, ...) @printf(ptr @g14), !dbg !5652
+  ret i64 %tot, !dbg !5653
+}
+
+define i64 @kernel_245(ptr noalias %recs, i32 %n) !dbg !5654 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !5655
+  %nw2 = zext i32 %n to i64, !dbg !5656
+  br i1 %c1, label %loop, label %exit, !dbg !5657
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !5658
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !5659
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !5660
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !5661
+  %c7 = icmp slt i32 %a4, 61, !dbg !5662
+  br i1 %c7, label %then, label %else, !dbg !5663
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !5664
+  %y9 = and i64 %x8, %b6, !dbg !5665
+  br label %latch, !dbg !5666
+
+else:
+  %z10 = sub i64 %b6, 26, !dbg !5667
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !5668
+  br label %latch, !dbg !5669
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !5670
+  %i.next = add nuw nsw i64 %i, 1, !dbg !5671
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !5672
+  br i1 %d12, label %exit, label %loop, !dbg !5673, !llvm.loop !5674
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !5675
+}
+
+define void @kernel_246(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !5676 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !5677
+  br i1 %c1, label %outer, label %exit, !dbg !5678
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !5679
+  br label %inner, !dbg !5680
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !5681
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !5682
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !5683
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !5684
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !5685
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !5686
+  %j.next = add nuw nsw i64 %j, 1, !dbg !5687
+  %d8 = icmp eq i64 %j.next, %n, !dbg !5688
+  br i1 %d8, label %outer.latch, label %inner, !dbg !5689
+
+outer.latch:
+  %sc9 = fmul double %s.next, 4.500000e+00, !dbg !5690
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !5691
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !5692
+  %i.next = add nuw nsw i64 %i, 1, !dbg !5693
+  %d11 = icmp eq i64 %i.next, %n, !dbg !5694
+  br i1 %d11, label %exit, label %outer, !dbg !5695
+
+exit:
+  ret void, !dbg !5696
+}
+
+define i32 @kernel_247(i32 %op, i32 %x) !dbg !5697 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+  ], !dbg !5698
+
+case0:
+  %r1 = or i32 %x, 4, !dbg !5699
+  br label %join, !dbg !5700
+
+case1:
+  %r2 = sub i32 %x, 14, !dbg !5701
+  br label %join, !dbg !5702
+
+case2:
+  %r3 = call i32 @kernel_237(i32 2, i32 %x), !dbg !5703
+  br label %join, !dbg !5704
+
+default:
+  %p4 = getelementptr inbounds [16 x i32], ptr @g44, i64 0, i64 0, !dbg !5705
+  %l5 = load i32, ptr %p4, align 4, !tbaa !19, !dbg !5706
+  %u6 = call i32 @llvm.umin.i32(i32 %l5, i32 %x), !dbg !5707
+  br label %join, !dbg !5708
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %u6, %default ]
+  ret i32 %res, !dbg !5709
+}
+
+define <4 x i32> @kernel_248(<4 x i32> %v, i32 %s) !dbg !5710 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !5711
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !5712
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5713
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5714
+  %w3 = add <4 x i32> %v, %bc2, !dbg !5715
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5716
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5717
+  %w6 = add <4 x i32> %w3, %bc5, !dbg !5718
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5719
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5720
+  %w9 = xor <4 x i32> %w6, %bc8, !dbg !5721
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5722
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5723
+  %w12 = mul <4 x i32> %w9, %bc11, !dbg !5724
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5725
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5726
+  %w15 = mul <4 x i32> %w12, %bc14, !dbg !5727
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5728
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5729
+  %w18 = and <4 x i32> %w15, %bc17, !dbg !5730
+  %sp19 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5731
+  %bc20 = shufflevector <4 x i32> %sp19, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5732
+  %w21 = xor <4 x i32> %w18, %bc20, !dbg !5733
+  %sp22 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5734
+  %bc23 = shufflevector <4 x i32> %sp22, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5735
+  %w24 = mul <4 x i32> %w21, %bc23, !dbg !5736
+  %sp25 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5737
+  %bc26 = shufflevector <4 x i32> %sp25, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5738
+  %w27 = and <4 x i32> %w24, %bc26, !dbg !5739
+  %sp28 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5740
+  %bc29 = shufflevector <4 x i32> %sp28, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5741
+  %w30 = xor <4 x i32> %w27, %bc29, !dbg !5742
+  %sp31 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5743
+  %bc32 = shufflevector <4 x i32> %sp31, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5744
+  %w33 = and <4 x i32> %w30, %bc32, !dbg !5745
+  %sp34 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5746
+  %bc35 = shufflevector <4 x i32> %sp34, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5747
+  %w36 = and <4 x i32> %w33, %bc35, !dbg !5748
+  store <4 x i32> %w36, ptr %buf, align 16, !tbaa !19, !dbg !5749
+  %e37 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 2, !dbg !5750
+  %l38 = load i32, ptr %e37, align 4, !tbaa !19, !dbg !5751
+  %r39 = insertelement <4 x i32> %w36, i32 %l38, i64 3, !dbg !5752
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !5753
+  ret <4 x i32> %r39, !dbg !5754
+}
+
+define i64 @kernel_249(ptr %grid) !dbg !5755 {
+entry:
+  br label %walk, !dbg !5756
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !5757
+  br i1 %c1, label %done, label %body, !dbg !5758
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !5759
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !5760
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !5761
+  %r5 = call i64 @kernel_245(ptr %pr2, i32 %n4), !dbg !5762
+  %a6 = add i64 %tot, %r5, !dbg !5763
+  %r7 = call i64 @kernel_240(ptr %pr2, i32 %n4), !dbg !5764
+  %a8 = add i64 %a6, %r7, !dbg !5765
+  store i64 %a8, ptr @g3, align 8, !tbaa !20, !dbg !5766
+  %tot.next = add i64 %a8, 1, !dbg !5767
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !5768
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !5769
+  br label %walk, !dbg !5770
+
+done:
+  ret i64 %tot, !dbg !5771
+}
+
+define i64 @kernel_250(ptr noalias %recs, i32 %n) !dbg !5772 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !5773
+  %nw2 = zext i32 %n to i64, !dbg !5774
+  br i1 %c1, label %loop, label %exit, !dbg !5775
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !5776
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !5777
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !5778
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !5779
+  %c7 = icmp slt i32 %a4, 5, !dbg !5780
+  br i1 %c7, label %then, label %else, !dbg !5781
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !5782
+  %y9 = and i64 %x8, %b6, !dbg !5783
+  br label %latch, !dbg !5784
+
+else:
+  %z10 = or i64 %b6, 25, !dbg !5785
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !5786
+  br label %latch, !dbg !5787
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !5788
+  %i.next = add nuw nsw i64 %i, 1, !dbg !5789
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !5790
+  br i1 %d12, label %exit, label %loop, !dbg !5791, !llvm.loop !5792
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !5793
+}
+
+define void @kernel_251(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !5794 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !5795
+  br i1 %c1, label %outer, label %exit, !dbg !5796
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !5797
+  br label %inner, !dbg !5798
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !5799
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !5800
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !5801
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !5802
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !5803
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !5804
+  %j.next = add nuw nsw i64 %j, 1, !dbg !5805
+  %d8 = icmp eq i64 %j.next, %n, !dbg !5806
+  br i1 %d8, label %outer.latch, label %inner, !dbg !5807
+
+outer.latch:
+  %sc9 = fmul double %s.next, 7.500000e+00, !dbg !5808
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !5809
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !5810
+  %i.next = add nuw nsw i64 %i, 1, !dbg !5811
+  %d11 = icmp eq i64 %i.next, %n, !dbg !5812
+  br i1 %d11, label %exit, label %outer, !dbg !5813
+
+exit:
+  ret void, !dbg !5814
+}
+
+define i32 @kernel_252(i32 %op, i32 %x) !dbg !5815 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+  ], !dbg !5816
+
+case0:
+  %r1 = call i32 @kernel_242(i32 0, i32 %x), !dbg !5817
+  br label %join, !dbg !5818
+
+case1:
+  %r2 = call i32 @kernel_247(i32 1, i32 %x), !dbg !5819
+  br label %join, !dbg !5820
+
+case2:
+  %r3 = ashr i32 %x, 15, !dbg !5821
+  br label %join, !dbg !5822
+
+default:
+  %p4 = getelementptr inbounds [16 x i32], ptr @g40, i64 0, i64 12, !dbg !5823
+  %l5 = load i32, ptr %p4, align 4, !tbaa !19, !dbg !5824
+  %u6 = call i32 @llvm.umin.i32(i32 %l5, i32 %x), !dbg !5825
+  br label %join, !dbg !5826
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %u6, %default ]
+  ret i32 %res, !dbg !5827
+}
+
+define <4 x i32> @kernel_253(<4 x i32> %v, i32 %s) !dbg !5828 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !5829
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !5830
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5831
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5832
+  %w3 = mul <4 x i32> %v, %bc2, !dbg !5833
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5834
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5835
+  %w6 = xor <4 x i32> %w3, %bc5, !dbg !5836
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5837
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5838
+  %w9 = add <4 x i32> %w6, %bc8, !dbg !5839
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5840
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5841
+  %w12 = or <4 x i32> %w9, %bc11, !dbg !5842
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5843
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5844
+  %w15 = mul <4 x i32> %w12, %bc14, !dbg !5845
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5846
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5847
+  %w18 = xor <4 x i32> %w15, %bc17, !dbg !5848
+  %sp19 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5849
+  %bc20 = shufflevector <4 x i32> %sp19, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5850
+  %w21 = or <4 x i32> %w18, %bc20, !dbg !5851
+  %sp22 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5852
+  %bc23 = shufflevector <4 x i32> %sp22, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5853
+  %w24 = add <4 x i32> %w21, %bc23, !dbg !5854
+  %sp25 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5855
+  %bc26 = shufflevector <4 x i32> %sp25, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5856
+  %w27 = mul <4 x i32> %w24, %bc26, !dbg !5857
+  %sp28 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5858
+  %bc29 = shufflevector <4 x i32> %sp28, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5859
+  %w30 = or <4 x i32> %w27, %bc29, !dbg !5860
+  %sp31 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5861
+  %bc32 = shufflevector <4 x i32> %sp31, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5862
+  %w33 = mul <4 x i32> %w30, %bc32, !dbg !5863
+  %sp34 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5864
+  %bc35 = shufflevector <4 x i32> %sp34, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5865
+  %w36 = and <4 x i32> %w33, %bc35, !dbg !5866
+  store <4 x i32> %w36, ptr %buf, align 16, !tbaa !19, !dbg !5867
+  %e37 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 3, !dbg !5868
+  %l38 = load i32, ptr %e37, align 4, !tbaa !19, !dbg !5869
+  %r39 = insertelement <4 x i32> %w36, i32 %l38, i64 3, !dbg !5870
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !5871
+  ret <4 x i32> %r39, !dbg !5872
+}
+
+define i64 @kernel_254(ptr %grid) !dbg !5873 {
+entry:
+  br label %walk, !dbg !5874
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !5875
+  br i1 %c1, label %done, label %body, !dbg !5876
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !5877
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !5878
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !5879
+  %r5 = call i64 @kernel_250(ptr %pr2, i32 %n4), !dbg !5880
+  %a6 = add i64 %tot, %r5, !dbg !5881
+  %r7 = call i64 @kernel_245(ptr %pr2, i32 %n4), !dbg !5882
+  %a8 = add i64 %a6, %r7, !dbg !5883
+  store i64 %a8, ptr @g11, align 8, !tbaa !20, !dbg !5884
+  %tot.next = add i64 %a8, 1, !dbg !5885
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !5886
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !5887
+  br label %walk, !dbg !5888
+
+done:
+  %pc10 = call i32 (ptr, ...) @printf(ptr @g14), !dbg !5889
+  ret i64 %tot, !dbg !5890
+}
+
+define i64 @kernel_255(ptr noalias %recs, i32 %n) !dbg !5891 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !5892
+  %nw2 = zext i32 %n to i64, !dbg !5893
+  br i1 %c1, label %loop, label %exit, !dbg !5894
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !5895
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !5896
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !5897
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !5898
+  %c7 = icmp slt i32 %a4, 49, !dbg !5899
+  br i1 %c7, label %then, label %else, !dbg !5900
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !5901
+  %y9 = xor i64 %x8, %b6, !dbg !5902
+  br label %latch, !dbg !5903
+
+else:
+  %z10 = or i64 %b6, 15, !dbg !5904
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !5905
+  br label %latch, !dbg !5906
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !5907
+  %i.next = add nuw nsw i64 %i, 1, !dbg !5908
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !5909
+  br i1 %d12, label %exit, label %loop, !dbg !5910, !llvm.loop !5911
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !5912
+}
+
+define void @kernel_256(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !5913 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !5914
+  br i1 %c1, label %outer, label %exit, !dbg !5915
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !5916
+  br label %inner, !dbg !5917
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !5918
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !5919
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !5920
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !5921
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !5922
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !5923
+  %j.next = add nuw nsw i64 %j, 1, !dbg !5924
+  %d8 = icmp eq i64 %j.next, %n, !dbg !5925
+  br i1 %d8, label %outer.latch, label %inner, !dbg !5926
+
+outer.latch:
+  %sc9 = fmul double %s.next, 4.500000e+00, !dbg !5927
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !5928
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !5929
+  %i.next = add nuw nsw i64 %i, 1, !dbg !5930
+  %d11 = icmp eq i64 %i.next, %n, !dbg !5931
+  br i1 %d11, label %exit, label %outer, !dbg !5932
+
+exit:
+  ret void, !dbg !5933
+}
+
+define i32 @kernel_257(i32 %op, i32 %x) !dbg !5934 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+    i32 3, label %case3
+    i32 4, label %case4
+    i32 5, label %case5
+  ], !dbg !5935
+
+case0:
+  %r1 = and i32 %x, 11, !dbg !5936
+  br label %join, !dbg !5937
+
+case1:
+  %r2 = shl i32 %x, 7, !dbg !5938
+  br label %join, !dbg !5939
+
+case2:
+  %r3 = call i32 @kernel_247(i32 2, i32 %x), !dbg !5940
+  br label %join, !dbg !5941
+
+case3:
+  %r4 = or i32 %x, 6, !dbg !5942
+  br label %join, !dbg !5943
+
+case4:
+  %r5 = call i32 @kernel_252(i32 4, i32 %x), !dbg !5944
+  br label %join, !dbg !5945
+
+case5:
+  %r6 = call i32 @kernel_252(i32 5, i32 %x), !dbg !5946
+  br label %join, !dbg !5947
+
+default:
+  %p7 = getelementptr inbounds [16 x i32], ptr @g0, i64 0, i64 2, !dbg !5948
+  %l8 = load i32, ptr %p7, align 4, !tbaa !19, !dbg !5949
+  %u9 = call i32 @llvm.umin.i32(i32 %l8, i32 %x), !dbg !5950
+  br label %join, !dbg !5951
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %r4, %case3 ], [ %r5, %case4 ], [ %r6, %case5 ], [ %u9, %default ]
+  ret i32 %res, !dbg !5952
+}
+
+define <4 x i32> @kernel_258(<4 x i32> %v, i32 %s) !dbg !5953 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !5954
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !5955
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5956
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5957
+  %w3 = xor <4 x i32> %v, %bc2, !dbg !5958
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5959
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5960
+  %w6 = mul <4 x i32> %w3, %bc5, !dbg !5961
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5962
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5963
+  %w9 = xor <4 x i32> %w6, %bc8, !dbg !5964
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5965
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5966
+  %w12 = xor <4 x i32> %w9, %bc11, !dbg !5967
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5968
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5969
+  %w15 = xor <4 x i32> %w12, %bc14, !dbg !5970
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5971
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5972
+  %w18 = or <4 x i32> %w15, %bc17, !dbg !5973
+  %sp19 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5974
+  %bc20 = shufflevector <4 x i32> %sp19, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5975
+  %w21 = xor <4 x i32> %w18, %bc20, !dbg !5976
+  %sp22 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5977
+  %bc23 = shufflevector <4 x i32> %sp22, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5978
+  %w24 = and <4 x i32> %w21, %bc23, !dbg !5979
+  %sp25 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !5980
+  %bc26 = shufflevector <4 x i32> %sp25, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !5981
+  %w27 = xor <4 x i32> %w24, %bc26, !dbg !5982
+  store <4 x i32> %w27, ptr %buf, align 16, !tbaa !19, !dbg !5983
+  %e28 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 2, !dbg !5984
+  %l29 = load i32, ptr %e28, align 4, !tbaa !19, !dbg !5985
+  %r30 = insertelement <4 x i32> %w27, i32 %l29, i64 3, !dbg !5986
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !5987
+  ret <4 x i32> %r30, !dbg !5988
+}
+
+define i64 @kernel_259(ptr %grid) !dbg !5989 {
+entry:
+  br label %walk, !dbg !5990
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !5991
+  br i1 %c1, label %done, label %body, !dbg !5992
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !5993
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !5994
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !5995
+  %r5 = call i64 @kernel_255(ptr %pr2, i32 %n4), !dbg !5996
+  %a6 = add i64 %tot, %r5, !dbg !5997
+  %r7 = call i64 @kernel_250(ptr %pr2, i32 %n4), !dbg !5998
+  %a8 = add i64 %a6, %r7, !dbg !5999
+  store i64 %a8, ptr @g19, align 8, !tbaa !20, !dbg !6000
+  %tot.next = add i64 %a8, 1, !dbg !6001
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !6002
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !6003
+  br label %walk, !dbg !6004
+
+done:
+  ret i64 %tot, !dbg !6005
+}
+
+define i64 @kernel_260(ptr noalias %recs, i32 %n) !dbg !6006 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !6007
+  %nw2 = zext i32 %n to i64, !dbg !6008
+  br i1 %c1, label %loop, label %exit, !dbg !6009
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !6010
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !6011
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !6012
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !6013
+  %c7 = icmp slt i32 %a4, 24, !dbg !6014
+  br i1 %c7, label %then, label %else, !dbg !6015
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !6016
+  %y9 = xor i64 %x8, %b6, !dbg !6017
+  br label %latch, !dbg !6018
+
+else:
+  %z10 = mul i64 %b6, 10, !dbg !6019
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !6020
+  br label %latch, !dbg !6021
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !6022
+  %i.next = add nuw nsw i64 %i, 1, !dbg !6023
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !6024
+  br i1 %d12, label %exit, label %loop, !dbg !6025, !llvm.loop !6026
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !6027
+}
+
+define void @kernel_261(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !6028 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !6029
+  br i1 %c1, label %outer, label %exit, !dbg !6030
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !6031
+  br label %inner, !dbg !6032
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !6033
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !6034
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !6035
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !6036
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !6037
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !6038
+  %j.next = add nuw nsw i64 %j, 1, !dbg !6039
+  %d8 = icmp eq i64 %j.next, %n, !dbg !6040
+  br i1 %d8, label %outer.latch, label %inner, !dbg !6041
+
+outer.latch:
+  %sc9 = fmul double %s.next, 6.500000e+00, !dbg !6042
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !6043
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !6044
+  %i.next = add nuw nsw i64 %i, 1, !dbg !6045
+  %d11 = icmp eq i64 %i.next, %n, !dbg !6046
+  br i1 %d11, label %exit, label %outer, !dbg !6047
+
+exit:
+  ret void, !dbg !6048
+}
+
+define i32 @kernel_262(i32 %op, i32 %x) !dbg !6049 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+    i32 3, label %case3
+    i32 4, label %case4
+  ], !dbg !6050
+
+case0:
+  %r1 = call i32 @kernel_257(i32 0, i32 %x), !dbg !6051
+  br label %join, !dbg !6052
+
+case1:
+  %r2 = and i32 %x, 14, !dbg !6053
+  br label %join, !dbg !6054
+
+case2:
+  %r3 = call i32 @kernel_257(i32 2, i32 %x), !dbg !6055
+  br label %join, !dbg !6056
+
+case3:
+  %r4 = call i32 @kernel_257(i32 3, i32 %x), !dbg !6057
+  br label %join, !dbg !6058
+
+case4:
+  %r5 = ashr i32 %x, 6, !dbg !6059
+  br label %join, !dbg !6060
+
+default:
+  %p6 = getelementptr inbounds [16 x i32], ptr @g44, i64 0, i64 10, !dbg !6061
+  %l7 = load i32, ptr %p6, align 4, !tbaa !19, !dbg !6062
+  %u8 = call i32 @llvm.umin.i32(i32 %l7, i32 %x), !dbg !6063
+  br label %join, !dbg !6064
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %r4, %case3 ], [ %r5, %case4 ], [ %u8, %default ]
+  ret i32 %res, !dbg !6065
+}
+
+define <4 x i32> @kernel_263(<4 x i32> %v, i32 %s) !dbg !6066 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !6067
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !6068
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6069
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6070
+  %w3 = or <4 x i32> %v, %bc2, !dbg !6071
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6072
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6073
+  %w6 = mul <4 x i32> %w3, %bc5, !dbg !6074
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6075
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6076
+  %w9 = mul <4 x i32> %w6, %bc8, !dbg !6077
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6078
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6079
+  %w12 = mul <4 x i32> %w9, %bc11, !dbg !6080
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6081
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6082
+  %w15 = add <4 x i32> %w12, %bc14, !dbg !6083
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6084
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6085
+  %w18 = xor <4 x i32> %w15, %bc17, !dbg !6086
+  %sp19 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6087
+  %bc20 = shufflevector <4 x i32> %sp19, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6088
+  %w21 = mul <4 x i32> %w18, %bc20, !dbg !6089
+  %sp22 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6090
+  %bc23 = shufflevector <4 x i32> %sp22, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6091
+  %w24 = or <4 x i32> %w21, %bc23, !dbg !6092
+  %sp25 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6093
+  %bc26 = shufflevector <4 x i32> %sp25, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6094
+  %w27 = xor <4 x i32> %w24, %bc26, !dbg !6095
+  %sp28 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6096
+  %bc29 = shufflevector <4 x i32> %sp28, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6097
+  %w30 = mul <4 x i32> %w27, %bc29, !dbg !6098
+  store <4 x i32> %w30, ptr %buf, align 16, !tbaa !19, !dbg !6099
+  %e31 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 0, !dbg !6100
+  %l32 = load i32, ptr %e31, align 4, !tbaa !19, !dbg !6101
+  %r33 = insertelement <4 x i32> %w30, i32 %l32, i64 3, !dbg !6102
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !6103
+  ret <4 x i32> %r33, !dbg !6104
+}
+
+define i64 @kernel_264(ptr %grid) !dbg !6105 {
+entry:
+  br label %walk, !dbg !6106
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !6107
+  br i1 %c1, label %done, label %body, !dbg !6108
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !6109
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !6110
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !6111
+  %r5 = call i64 @kernel_255(ptr %pr2, i32 %n4), !dbg !6112
+  %a6 = add i64 %tot, %r5, !dbg !6113
+  %r7 = call i64 @kernel_260(ptr %pr2, i32 %n4), !dbg !6114
+  %a8 = add i64 %a6, %r7, !dbg !6115
+  store i64 %a8, ptr @g47, align 8, !tbaa !20, !dbg !6116
+  %tot.next = add i64 %a8, 1, !dbg !6117
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !6118
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !6119
+  br label %walk, !dbg !6120
+
+done:
+  %pc10 = call i32 (ptr, ...) @printf(ptr @g14), !dbg !6121
+  ret i64 %tot, !dbg !6122
+}
+
+define i64 @kernel_265(ptr noalias %recs, i32 %n) !dbg !6123 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !6124
+  %nw2 = zext i32 %n to i64, !dbg !6125
+  br i1 %c1, label %loop, label %exit, !dbg !6126
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !6127
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !6128
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !6129
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !6130
+  %c7 = icmp slt i32 %a4, 17, !dbg !6131
+  br i1 %c7, label %then, label %else, !dbg !6132
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !6133
+  %y9 = mul i64 %x8, %b6, !dbg !6134
+  br label %latch, !dbg !6135
+
+else:
+  %z10 = sub i64 %b6, 18, !dbg !6136
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !6137
+  br label %latch, !dbg !6138
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !6139
+  %i.next = add nuw nsw i64 %i, 1, !dbg !6140
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !6141
+  br i1 %d12, label %exit, label %loop, !dbg !6142, !llvm.loop !6143
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !6144
+}
+
+define void @kernel_266(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !6145 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !6146
+  br i1 %c1, label %outer, label %exit, !dbg !6147
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !6148
+  br label %inner, !dbg !6149
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !6150
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !6151
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !6152
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !6153
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !6154
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !6155
+  %j.next = add nuw nsw i64 %j, 1, !dbg !6156
+  %d8 = icmp eq i64 %j.next, %n, !dbg !6157
+  br i1 %d8, label %outer.latch, label %inner, !dbg !6158
+
+outer.latch:
+  %sc9 = fmul double %s.next, 7.500000e+00, !dbg !6159
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !6160
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !6161
+  %i.next = add nuw nsw i64 %i, 1, !dbg !6162
+  %d11 = icmp eq i64 %i.next, %n, !dbg !6163
+  br i1 %d11, label %exit, label %outer, !dbg !6164
+
+exit:
+  ret void, !dbg !6165
+}
+
+define i32 @kernel_267(i32 %op, i32 %x) !dbg !6166 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+    i32 3, label %case3
+    i32 4, label %case4
+    i32 5, label %case5
+  ], !dbg !6167
+
+case0:
+  %r1 = call i32 @kernel_257(i32 0, i32 %x), !dbg !6168
+  br label %join, !dbg !6169
+
+case1:
+  %r2 = call i32 @kernel_262(i32 1, i32 %x), !dbg !6170
+  br label %join, !dbg !6171
+
+case2:
+  %r3 = call i32 @kernel_262(i32 2, i32 %x), !dbg !6172
+  br label %join, !dbg !6173
+
+case3:
+  %r4 = add nsw i32 %x, 15, !dbg !6174
+  br label %join, !dbg !6175
+
+case4:
+  %r5 = call i32 @kernel_262(i32 4, i32 %x), !dbg !6176
+  br label %join, !dbg !6177
+
+case5:
+  %r6 = call i32 @kernel_262(i32 5, i32 %x), !dbg !6178
+  br label %join, !dbg !6179
+
+default:
+  %p7 = getelementptr inbounds [16 x i32], ptr @g4, i64 0, i64 15, !dbg !6180
+  %l8 = load i32, ptr %p7, align 4, !tbaa !19, !dbg !6181
+  %u9 = call i32 @llvm.umin.i32(i32 %l8, i32 %x), !dbg !6182
+  br label %join, !dbg !6183
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %r4, %case3 ], [ %r5, %case4 ], [ %r6, %case5 ], [ %u9, %default ]
+  ret i32 %res, !dbg !6184
+}
+
+define <4 x i32> @kernel_268(<4 x i32> %v, i32 %s) !dbg !6185 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !6186
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !6187
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6188
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6189
+  %w3 = mul <4 x i32> %v, %bc2, !dbg !6190
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6191
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6192
+  %w6 = or <4 x i32> %w3, %bc5, !dbg !6193
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6194
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6195
+  %w9 = mul <4 x i32> %w6, %bc8, !dbg !6196
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6197
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6198
+  %w12 = and <4 x i32> %w9, %bc11, !dbg !6199
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6200
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6201
+  %w15 = xor <4 x i32> %w12, %bc14, !dbg !6202
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6203
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6204
+  %w18 = add <4 x i32> %w15, %bc17, !dbg !6205
+  store <4 x i32> %w18, ptr %buf, align 16, !tbaa !19, !dbg !6206
+  %e19 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 1, !dbg !6207
+  %l20 = load i32, ptr %e19, align 4, !tbaa !19, !dbg !6208
+  %r21 = insertelement <4 x i32> %w18, i32 %l20, i64 3, !dbg !6209
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !6210
+  ret <4 x i32> %r21, !dbg !6211
+}
+
+define i64 @kernel_269(ptr %grid) !dbg !6212 {
+entry:
+  br label %walk, !dbg !6213
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !6214
+  br i1 %c1, label %done, label %body, !dbg !6215
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !6216
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !6217
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !6218
+  %r5 = call i64 @kernel_260(ptr %pr2, i32 %n4), !dbg !6219
+  %a6 = add i64 %tot, %r5, !dbg !6220
+  %r7 = call i64 @kernel_265(ptr %pr2, i32 %n4), !dbg !6221
+  %a8 = add i64 %a6, %r7, !dbg !6222
+  store i64 %a8, ptr @g51, align 8, !tbaa !20, !dbg !6223
+  %tot.next = add i64 %a8, 1, !dbg !6224
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !6225
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !6226
+  br label %walk, !dbg !6227
+
+done:
+  ret i64 %tot, !dbg !6228
+}
+
+define i64 @kernel_270(ptr noalias %recs, i32 %n) !dbg !6229 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !6230
+  %nw2 = zext i32 %n to i64, !dbg !6231
+  br i1 %c1, label %loop, label %exit, !dbg !6232
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !6233
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !6234
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !6235
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !6236
+  %c7 = icmp slt i32 %a4, 11, !dbg !6237
+  br i1 %c7, label %then, label %else, !dbg !6238
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !6239
+  %y9 = mul i64 %x8, %b6, !dbg !6240
+  br label %latch, !dbg !6241
+
+else:
+  %z10 = xor i64 %b6, 12, !dbg !6242
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !6243
+  br label %latch, !dbg !6244
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !6245
+  %i.next = add nuw nsw i64 %i, 1, !dbg !6246
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !6247
+  br i1 %d12, label %exit, label %loop, !dbg !6248, !llvm.loop !6249
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !6250
+}
+
+define void @kernel_271(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !6251 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !6252
+  br i1 %c1, label %outer, label %exit, !dbg !6253
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !6254
+  br label %inner, !dbg !6255
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !6256
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !6257
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !6258
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !6259
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !6260
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !6261
+  %j.next = add nuw nsw i64 %j, 1, !dbg !6262
+  %d8 = icmp eq i64 %j.next, %n, !dbg !6263
+  br i1 %d8, label %outer.latch, label %inner, !dbg !6264
+
+outer.latch:
+  %sc9 = fmul double %s.next, 2.500000e+00, !dbg !6265
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !6266
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !6267
+  %i.next = add nuw nsw i64 %i, 1, !dbg !6268
+  %d11 = icmp eq i64 %i.next, %n, !dbg !6269
+  br i1 %d11, label %exit, label %outer, !dbg !6270
+
+exit:
+  ret void, !dbg !6271
+}
+
+define i32 @kernel_272(i32 %op, i32 %x) !dbg !6272 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+    i32 3, label %case3
+    i32 4, label %case4
+    i32 5, label %case5
+    i32 6, label %case6
+  ], !dbg !6273
+
+case0:
+  %r1 = or i32 %x, 7, !dbg !6274
+  br label %join, !dbg !6275
+
+case1:
+  %r2 = call i32 @kernel_267(i32 1, i32 %x), !dbg !6276
+  br label %join, !dbg !6277
+
+case2:
+  %r3 = xor i32 %x, 11, !dbg !6278
+  br label %join, !dbg !6279
+
+case3:
+  %r4 = xor i32 %x, 7, !dbg !6280
+  br label %join, !dbg !6281
+
+case4:
+  %r5 = call i32 @kernel_262(i32 4, i32 %x), !dbg !6282
+  br label %join, !dbg !6283
+
+case5:
+  %r6 = ashr i32 %x, 9, !dbg !6284
+  br label %join, !dbg !6285
+
+case6:
+  %r7 = and i32 %x, 11, !dbg !6286
+  br label %join, !dbg !6287
+
+default:
+  %p8 = getelementptr inbounds [16 x i32], ptr @g24, i64 0, i64 8, !dbg !6288
+  %l9 = load i32, ptr %p8, align 4, !tbaa !19, !dbg !6289
+  %u10 = call i32 @llvm.umin.i32(i32 %l9, i32 %x), !dbg !6290
+  br label %join, !dbg !6291
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %r4, %case3 ], [ %r5, %case4 ], [ %r6, %case5 ], [ %r7, %case6 ], [ %u10, %default ]
+  ret i32 %res, !dbg !6292
+}
+
+define <4 x i32> @kernel_273(<4 x i32> %v, i32 %s) !dbg !6293 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !6294
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !6295
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6296
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6297
+  %w3 = mul <4 x i32> %v, %bc2, !dbg !6298
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6299
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6300
+  %w6 = and <4 x i32> %w3, %bc5, !dbg !6301
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6302
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6303
+  %w9 = xor <4 x i32> %w6, %bc8, !dbg !6304
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6305
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6306
+  %w12 = xor <4 x i32> %w9, %bc11, !dbg !6307
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6308
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6309
+  %w15 = add <4 x i32> %w12, %bc14, !dbg !6310
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6311
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6312
+  %w18 = and <4 x i32> %w15, %bc17, !dbg !6313
+  %sp19 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6314
+  %bc20 = shufflevector <4 x i32> %sp19, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6315
+  %w21 = xor <4 x i32> %w18, %bc20, !dbg !6316
+  store <4 x i32> %w21, ptr %buf, align 16, !tbaa !19, !dbg !6317
+  %e22 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 3, !dbg !6318
+  %l23 = load i32, ptr %e22, align 4, !tbaa !19, !dbg !6319
+  %r24 = insertelement <4 x i32> %w21, i32 %l23, i64 3, !dbg !6320
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !6321
+  ret <4 x i32> %r24, !dbg !6322
+}
+
+define i64 @kernel_274(ptr %grid) !dbg !6323 {
+entry:
+  br label %walk, !dbg !6324
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !6325
+  br i1 %c1, label %done, label %body, !dbg !6326
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !6327
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !6328
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !6329
+  %r5 = call i64 @kernel_265(ptr %pr2, i32 %n4), !dbg !6330
+  %a6 = add i64 %tot, %r5, !dbg !6331
+  %r7 = call i64 @kernel_270(ptr %pr2, i32 %n4), !dbg !6332
+  %a8 = add i64 %a6, %r7, !dbg !6333
+  store i64 %a8, ptr @g23, align 8, !tbaa !20, !dbg !6334
+  %tot.next = add i64 %a8, 1, !dbg !6335
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !6336
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !6337
+  br label %walk, !dbg !6338
+
+done:
+  %pc10 = call i32 (ptr, ...) @printf(ptr @g34), !dbg !6339
+  ret i64 %tot, !dbg !6340
+}
+
+define i64 @kernel_275(ptr noalias %recs, i32 %n) !dbg !6341 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !6342
+  %nw2 = zext i32 %n to i64, !dbg !6343
+  br i1 %c1, label %loop, label %exit, !dbg !6344
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !6345
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !6346
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !6347
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !6348
+  %c7 = icmp slt i32 %a4, 18, !dbg !6349
+  br i1 %c7, label %then, label %else, !dbg !6350
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !6351
+  %y9 = add nsw i64 %x8, %b6, !dbg !6352
+  br label %latch, !dbg !6353
+
+else:
+  %z10 = xor i64 %b6, 29, !dbg !6354
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !6355
+  br label %latch, !dbg !6356
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !6357
+  %i.next = add nuw nsw i64 %i, 1, !dbg !6358
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !6359
+  br i1 %d12, label %exit, label %loop, !dbg !6360, !llvm.loop !6361
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !6362
+}
+
+define void @kernel_276(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !6363 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !6364
+  br i1 %c1, label %outer, label %exit, !dbg !6365
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !6366
+  br label %inner, !dbg !6367
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !6368
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !6369
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !6370
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !6371
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !6372
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !6373
+  %j.next = add nuw nsw i64 %j, 1, !dbg !6374
+  %d8 = icmp eq i64 %j.next, %n, !dbg !6375
+  br i1 %d8, label %outer.latch, label %inner, !dbg !6376
+
+outer.latch:
+  %sc9 = fmul double %s.next, 2.500000e+00, !dbg !6377
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !6378
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !6379
+  %i.next = add nuw nsw i64 %i, 1, !dbg !6380
+  %d11 = icmp eq i64 %i.next, %n, !dbg !6381
+  br i1 %d11, label %exit, label %outer, !dbg !6382
+
+exit:
+  ret void, !dbg !6383
+}
+
+define i32 @kernel_277(i32 %op, i32 %x) !dbg !6384 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+    i32 3, label %case3
+    i32 4, label %case4
+  ], !dbg !6385
+
+case0:
+  %r1 = call i32 @kernel_272(i32 0, i32 %x), !dbg !6386
+  br label %join, !dbg !6387
+
+case1:
+  %r2 = call i32 @kernel_272(i32 1, i32 %x), !dbg !6388
+  br label %join, !dbg !6389
+
+case2:
+  %r3 = call i32 @kernel_267(i32 2, i32 %x), !dbg !6390
+  br label %join, !dbg !6391
+
+case3:
+  %r4 = or i32 %x, 6, !dbg !6392
+  br label %join, !dbg !6393
+
+case4:
+  %r5 = and i32 %x, 13, !dbg !6394
+  br label %join, !dbg !6395
+
+default:
+  %p6 = getelementptr inbounds [16 x i32], ptr @g4, i64 0, i64 12, !dbg !6396
+  %l7 = load i32, ptr %p6, align 4, !tbaa !19, !dbg !6397
+  %u8 = call i32 @llvm.umin.i32(i32 %l7, i32 %x), !dbg !6398
+  br label %join, !dbg !6399
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %r4, %case3 ], [ %r5, %case4 ], [ %u8, %default ]
+  ret i32 %res, !dbg !6400
+}
+
+define <4 x i32> @kernel_278(<4 x i32> %v, i32 %s) !dbg !6401 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !6402
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !6403
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6404
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6405
+  %w3 = and <4 x i32> %v, %bc2, !dbg !6406
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6407
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6408
+  %w6 = or <4 x i32> %w3, %bc5, !dbg !6409
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6410
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6411
+  %w9 = and <4 x i32> %w6, %bc8, !dbg !6412
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6413
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6414
+  %w12 = or <4 x i32> %w9, %bc11, !dbg !6415
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6416
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6417
+  %w15 = or <4 x i32> %w12, %bc14, !dbg !6418
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6419
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6420
+  %w18 = xor <4 x i32> %w15, %bc17, !dbg !6421
+  %sp19 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6422
+  %bc20 = shufflevector <4 x i32> %sp19, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6423
+  %w21 = xor <4 x i32> %w18, %bc20, !dbg !6424
+  %sp22 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6425
+  %bc23 = shufflevector <4 x i32> %sp22, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6426
+  %w24 = xor <4 x i32> %w21, %bc23, !dbg !6427
+  %sp25 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6428
+  %bc26 = shufflevector <4 x i32> %sp25, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6429
+  %w27 = and <4 x i32> %w24, %bc26, !dbg !6430
+  %sp28 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6431
+  %bc29 = shufflevector <4 x i32> %sp28, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6432
+  %w30 = mul <4 x i32> %w27, %bc29, !dbg !6433
+  %sp31 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6434
+  %bc32 = shufflevector <4 x i32> %sp31, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6435
+  %w33 = add <4 x i32> %w30, %bc32, !dbg !6436
+  %sp34 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6437
+  %bc35 = shufflevector <4 x i32> %sp34, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6438
+  %w36 = or <4 x i32> %w33, %bc35, !dbg !6439
+  %sp37 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6440
+  %bc38 = shufflevector <4 x i32> %sp37, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6441
+  %w39 = xor <4 x i32> %w36, %bc38, !dbg !6442
+  store <4 x i32> %w39, ptr %buf, align 16, !tbaa !19, !dbg !6443
+  %e40 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 2, !dbg !6444
+  %l41 = load i32, ptr %e40, align 4, !tbaa !19, !dbg !6445
+  %r42 = insertelement <4 x i32> %w39, i32 %l41, i64 3, !dbg !6446
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !6447
+  ret <4 x i32> %r42, !dbg !6448
+}
+
+define i64 @kernel_279(ptr %grid) !dbg !6449 {
+entry:
+  br label %walk, !dbg !6450
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !6451
+  br i1 %c1, label %done, label %body, !dbg !6452
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !6453
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !6454
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !6455
+  %r5 = call i64 @kernel_275(ptr %pr2, i32 %n4), !dbg !6456
+  %a6 = add i64 %tot, %r5, !dbg !6457
+  %r7 = call i64 @kernel_270(ptr %pr2, i32 %n4), !dbg !6458
+  %a8 = add i64 %a6, %r7, !dbg !6459
+  store i64 %a8, ptr @g23, align 8, !tbaa !20, !dbg !6460
+  %tot.next = add i64 %a8, 1, !dbg !6461
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !6462
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !6463
+  br label %walk, !dbg !6464
+
+done:
+  ret i64 %tot, !dbg !6465
+}
+
+define i64 @kernel_280(ptr noalias %recs, i32 %n) !dbg !6466 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !6467
+  %nw2 = zext i32 %n to i64, !dbg !6468
+  br i1 %c1, label %loop, label %exit, !dbg !6469
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !6470
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !6471
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !6472
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !6473
+  %c7 = icmp slt i32 %a4, 54, !dbg !6474
+  br i1 %c7, label %then, label %else, !dbg !6475
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !6476
+  %y9 = and i64 %x8, %b6, !dbg !6477
+  br label %latch, !dbg !6478
+
+else:
+  %z10 = or i64 %b6, 25, !dbg !6479
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !6480
+  br label %latch, !dbg !6481
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !6482
+  %i.next = add nuw nsw i64 %i, 1, !dbg !6483
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !6484
+  br i1 %d12, label %exit, label %loop, !dbg !6485, !llvm.loop !6486
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !6487
+}
+
+define void @kernel_281(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !6488 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !6489
+  br i1 %c1, label %outer, label %exit, !dbg !6490
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !6491
+  br label %inner, !dbg !6492
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !6493
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !6494
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !6495
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !6496
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !6497
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !6498
+  %j.next = add nuw nsw i64 %j, 1, !dbg !6499
+  %d8 = icmp eq i64 %j.next, %n, !dbg !6500
+  br i1 %d8, label %outer.latch, label %inner, !dbg !6501
+
+outer.latch:
+  %sc9 = fmul double %s.next, 3.500000e+00, !dbg !6502
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !6503
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !6504
+  %i.next = add nuw nsw i64 %i, 1, !dbg !6505
+  %d11 = icmp eq i64 %i.next, %n, !dbg !6506
+  br i1 %d11, label %exit, label %outer, !dbg !6507
+
+exit:
+  ret void, !dbg !6508
+}
+
+define i32 @kernel_282(i32 %op, i32 %x) !dbg !6509 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+    i32 3, label %case3
+    i32 4, label %case4
+    i32 5, label %case5
+  ], !dbg !6510
+
+case0:
+  %r1 = call i32 @kernel_272(i32 0, i32 %x), !dbg !6511
+  br label %join, !dbg !6512
+
+case1:
+  %r2 = call i32 @kernel_277(i32 1, i32 %x), !dbg !6513
+  br label %join, !dbg !6514
+
+case2:
+  %r3 = and i32 %x, 12, !dbg !6515
+  br label %join, !dbg !6516
+
+case3:
+  %r4 = add nsw i32 %x, 6, !dbg !6517
+  br label %join, !dbg !6518
+
+case4:
+  %r5 = call i32 @kernel_272(i32 4, i32 %x), !dbg !6519
+  br label %join, !dbg !6520
+
+case5:
+  %r6 = call i32 @kernel_277(i32 5, i32 %x), !dbg !6521
+  br label %join, !dbg !6522
+
+default:
+  %p7 = getelementptr inbounds [16 x i32], ptr @g8, i64 0, i64 2, !dbg !6523
+  %l8 = load i32, ptr %p7, align 4, !tbaa !19, !dbg !6524
+  %u9 = call i32 @llvm.umin.i32(i32 %l8, i32 %x), !dbg !6525
+  br label %join, !dbg !6526
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %r4, %case3 ], [ %r5, %case4 ], [ %r6, %case5 ], [ %u9, %default ]
+  ret i32 %res, !dbg !6527
+}
+
+define <4 x i32> @kernel_283(<4 x i32> %v, i32 %s) !dbg !6528 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !6529
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !6530
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6531
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6532
+  %w3 = and <4 x i32> %v, %bc2, !dbg !6533
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6534
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6535
+  %w6 = or <4 x i32> %w3, %bc5, !dbg !6536
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6537
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6538
+  %w9 = add <4 x i32> %w6, %bc8, !dbg !6539
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6540
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6541
+  %w12 = mul <4 x i32> %w9, %bc11, !dbg !6542
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6543
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6544
+  %w15 = or <4 x i32> %w12, %bc14, !dbg !6545
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6546
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6547
+  %w18 = xor <4 x i32> %w15, %bc17, !dbg !6548
+  store <4 x i32> %w18, ptr %buf, align 16, !tbaa !19, !dbg !6549
+  %e19 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 2, !dbg !6550
+  %l20 = load i32, ptr %e19, align 4, !tbaa !19, !dbg !6551
+  %r21 = insertelement <4 x i32> %w18, i32 %l20, i64 3, !dbg !6552
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !6553
+  ret <4 x i32> %r21, !dbg !6554
+}
+
+define i64 @kernel_284(ptr %grid) !dbg !6555 {
+entry:
+  br label %walk, !dbg !6556
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !6557
+  br i1 %c1, label %done, label %body, !dbg !6558
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !6559
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !6560
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !6561
+  %r5 = call i64 @kernel_280(ptr %pr2, i32 %n4), !dbg !6562
+  %a6 = add i64 %tot, %r5, !dbg !6563
+  %r7 = call i64 @kernel_275(ptr %pr2, i32 %n4), !dbg !6564
+  %a8 = add i64 %a6, %r7, !dbg !6565
+  store i64 %a8, ptr @g35, align 8, !tbaa !20, !dbg !6566
+  %tot.next = add i64 %a8, 1, !dbg !6567
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !6568
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !6569
+  br label %walk, !dbg !6570
+
+done:
+  %pc10 = call i32 (ptr, ...) @printf(ptr @g2), !dbg !6571
+  ret i64 %tot, !dbg !6572
+}
+
+define i64 @kernel_285(ptr noalias %recs, i32 %n) !dbg !6573 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !6574
+  %nw2 = zext i32 %n to i64, !dbg !6575
+  br i1 %c1, label %loop, label %exit, !dbg !6576
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !6577
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !6578
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !6579
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !6580
+  %c7 = icmp slt i32 %a4, 51, !dbg !6581
+  br i1 %c7, label %then, label %else, !dbg !6582
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !6583
+  %y9 = mul i64 %x8, %b6, !dbg !6584
+  br label %latch, !dbg !6585
+
+else:
+  %z10 = add nsw i64 %b6, 12, !dbg !6586
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !6587
+  br label %latch, !dbg !6588
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !6589
+  %i.next = add nuw nsw i64 %i, 1, !dbg !6590
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !6591
+  br i1 %d12, label %exit, label %loop, !dbg !6592, !llvm.loop !6593
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !6594
+}
+
+define void @kernel_286(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !6595 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !6596
+  br i1 %c1, label %outer, label %exit, !dbg !6597
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !6598
+  br label %inner, !dbg !6599
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !6600
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !6601
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !6602
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !6603
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !6604
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !6605
+  %j.next = add nuw nsw i64 %j, 1, !dbg !6606
+  %d8 = icmp eq i64 %j.next, %n, !dbg !6607
+  br i1 %d8, label %outer.latch, label %inner, !dbg !6608
+
+outer.latch:
+  %sc9 = fmul double %s.next, 8.500000e+00, !dbg !6609
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !6610
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !6611
+  %i.next = add nuw nsw i64 %i, 1, !dbg !6612
+  %d11 = icmp eq i64 %i.next, %n, !dbg !6613
+  br i1 %d11, label %exit, label %outer, !dbg !6614
+
+exit:
+  ret void, !dbg !6615
+}
+
+define i32 @kernel_287(i32 %op, i32 %x) !dbg !6616 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+    i32 3, label %case3
+    i32 4, label %case4
+    i32 5, label %case5
+  ], !dbg !6617
+
+case0:
+  %r1 = call i32 @kernel_282(i32 0, i32 %x), !dbg !6618
+  br label %join, !dbg !6619
+
+case1:
+  %r2 = lshr i32 %x, 5, !dbg !6620
+  br label %join, !dbg !6621
+
+case2:
+  %r3 = sub i32 %x, 4, !dbg !6622
+  br label %join, !dbg !6623
+
+case3:
+  %r4 = xor i32 %x, 3, !dbg !6624
+  br label %join, !dbg !6625
+
+case4:
+  %r5 = and i32 %x, 3, !dbg !6626
+  br label %join, !dbg !6627
+
+case5:
+  %r6 = ashr i32 %x, 13, !dbg !6628
+  br label %join, !dbg !6629
+
+default:
+  %p7 = getelementptr inbounds [16 x i32], ptr @g12, i64 0, i64 8, !dbg !6630
+  %l8 = load i32, ptr %p7, align 4, !tbaa !19, !dbg !6631
+  %u9 = call i32 @llvm.umin.i32(i32 %l8, i32 %x), !dbg !6632
+  br label %join, !dbg !6633
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %r4, %case3 ], [ %r5, %case4 ], [ %r6, %case5 ], [ %u9, %default ]
+  ret i32 %res, !dbg !6634
+}
+
+define <4 x i32> @kernel_288(<4 x i32> %v, i32 %s) !dbg !6635 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !6636
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !6637
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6638
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6639
+  %w3 = and <4 x i32> %v, %bc2, !dbg !6640
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6641
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6642
+  %w6 = xor <4 x i32> %w3, %bc5, !dbg !6643
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6644
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6645
+  %w9 = and <4 x i32> %w6, %bc8, !dbg !6646
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6647
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6648
+  %w12 = mul <4 x i32> %w9, %bc11, !dbg !6649
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6650
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6651
+  %w15 = or <4 x i32> %w12, %bc14, !dbg !6652
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6653
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6654
+  %w18 = and <4 x i32> %w15, %bc17, !dbg !6655
+  %sp19 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6656
+  %bc20 = shufflevector <4 x i32> %sp19, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6657
+  %w21 = mul <4 x i32> %w18, %bc20, !dbg !6658
+  %sp22 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6659
+  %bc23 = shufflevector <4 x i32> %sp22, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6660
+  %w24 = and <4 x i32> %w21, %bc23, !dbg !6661
+  %sp25 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6662
+  %bc26 = shufflevector <4 x i32> %sp25, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6663
+  %w27 = add <4 x i32> %w24, %bc26, !dbg !6664
+  %sp28 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6665
+  %bc29 = shufflevector <4 x i32> %sp28, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6666
+  %w30 = or <4 x i32> %w27, %bc29, !dbg !6667
+  %sp31 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6668
+  %bc32 = shufflevector <4 x i32> %sp31, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6669
+  %w33 = and <4 x i32> %w30, %bc32, !dbg !6670
+  %sp34 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6671
+  %bc35 = shufflevector <4 x i32> %sp34, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6672
+  %w36 = and <4 x i32> %w33, %bc35, !dbg !6673
+  %sp37 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6674
+  %bc38 = shufflevector <4 x i32> %sp37, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6675
+  %w39 = add <4 x i32> %w36, %bc38, !dbg !6676
+  store <4 x i32> %w39, ptr %buf, align 16, !tbaa !19, !dbg !6677
+  %e40 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 3, !dbg !6678
+  %l41 = load i32, ptr %e40, align 4, !tbaa !19, !dbg !6679
+  %r42 = insertelement <4 x i32> %w39, i32 %l41, i64 3, !dbg !6680
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !6681
+  ret <4 x i32> %r42, !dbg !6682
+}
+
+define i64 @kernel_289(ptr %grid) !dbg !6683 {
+entry:
+  br label %walk, !dbg !6684
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !6685
+  br i1 %c1, label %done, label %body, !dbg !6686
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !6687
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !6688
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !6689
+  %r5 = call i64 @kernel_280(ptr %pr2, i32 %n4), !dbg !6690
+  %a6 = add i64 %tot, %r5, !dbg !6691
+  %r7 = call i64 @kernel_285(ptr %pr2, i32 %n4), !dbg !6692
+  %a8 = add i64 %a6, %r7, !dbg !6693
+  store i64 %a8, ptr @g31, align 8, !tbaa !20, !dbg !6694
+  %tot.next = add i64 %a8, 1, !dbg !6695
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !6696
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !6697
+  br label %walk, !dbg !6698
+
+done:
+  ret i64 %tot, !dbg !6699
+}
+
+define i64 @kernel_290(ptr noalias %recs, i32 %n) !dbg !6700 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !6701
+  %nw2 = zext i32 %n to i64, !dbg !6702
+  br i1 %c1, label %loop, label %exit, !dbg !6703
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !6704
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !6705
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !6706
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !6707
+  %c7 = icmp slt i32 %a4, 23, !dbg !6708
+  br i1 %c7, label %then, label %else, !dbg !6709
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !6710
+  %y9 = mul i64 %x8, %b6, !dbg !6711
+  br label %latch, !dbg !6712
+
+else:
+  %z10 = or i64 %b6, 2, !dbg !6713
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !6714
+  br label %latch, !dbg !6715
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !6716
+  %i.next = add nuw nsw i64 %i, 1, !dbg !6717
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !6718
+  br i1 %d12, label %exit, label %loop, !dbg !6719, !llvm.loop !6720
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !6721
+}
+
+define void @kernel_291(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !6722 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !6723
+  br i1 %c1, label %outer, label %exit, !dbg !6724
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !6725
+  br label %inner, !dbg !6726
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !6727
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !6728
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !6729
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !6730
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !6731
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !6732
+  %j.next = add nuw nsw i64 %j, 1, !dbg !6733
+  %d8 = icmp eq i64 %j.next, %n, !dbg !6734
+  br i1 %d8, label %outer.latch, label %inner, !dbg !6735
+
+outer.latch:
+  %sc9 = fmul double %s.next, 2.500000e+00, !dbg !6736
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !6737
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !6738
+  %i.next = add nuw nsw i64 %i, 1, !dbg !6739
+  %d11 = icmp eq i64 %i.next, %n, !dbg !6740
+  br i1 %d11, label %exit, label %outer, !dbg !6741
+
+exit:
+  ret void, !dbg !6742
+}
+
+define i32 @kernel_292(i32 %op, i32 %x) !dbg !6743 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+    i32 3, label %case3
+    i32 4, label %case4
+    i32 5, label %case5
+  ], !dbg !6744
+
+case0:
+  %r1 = call i32 @kernel_287(i32 0, i32 %x), !dbg !6745
+  br label %join, !dbg !6746
+
+case1:
+  %r2 = and i32 %x, 15, !dbg !6747
+  br label %join, !dbg !6748
+
+case2:
+  %r3 = xor i32 %x, 14, !dbg !6749
+  br label %join, !dbg !6750
+
+case3:
+  %r4 = call i32 @kernel_282(i32 3, i32 %x), !dbg !6751
+  br label %join, !dbg !6752
+
+case4:
+  %r5 = or i32 %x, 4, !dbg !6753
+  br label %join, !dbg !6754
+
+case5:
+  %r6 = call i32 @kernel_282(i32 5, i32 %x), !dbg !6755
+  br label %join, !dbg !6756
+
+default:
+  %p7 = getelementptr inbounds [16 x i32], ptr @g28, i64 0, i64 1, !dbg !6757
+  %l8 = load i32, ptr %p7, align 4, !tbaa !19, !dbg !6758
+  %u9 = call i32 @llvm.umin.i32(i32 %l8, i32 %x), !dbg !6759
+  br label %join, !dbg !6760
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %r4, %case3 ], [ %r5, %case4 ], [ %r6, %case5 ], [ %u9, %default ]
+  ret i32 %res, !dbg !6761
+}
+
+define <4 x i32> @kernel_293(<4 x i32> %v, i32 %s) !dbg !6762 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !6763
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !6764
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6765
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6766
+  %w3 = mul <4 x i32> %v, %bc2, !dbg !6767
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6768
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6769
+  %w6 = xor <4 x i32> %w3, %bc5, !dbg !6770
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6771
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6772
+  %w9 = xor <4 x i32> %w6, %bc8, !dbg !6773
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6774
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6775
+  %w12 = add <4 x i32> %w9, %bc11, !dbg !6776
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6777
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6778
+  %w15 = xor <4 x i32> %w12, %bc14, !dbg !6779
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6780
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6781
+  %w18 = and <4 x i32> %w15, %bc17, !dbg !6782
+  %sp19 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6783
+  %bc20 = shufflevector <4 x i32> %sp19, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6784
+  %w21 = and <4 x i32> %w18, %bc20, !dbg !6785
+  %sp22 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6786
+  %bc23 = shufflevector <4 x i32> %sp22, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6787
+  %w24 = mul <4 x i32> %w21, %bc23, !dbg !6788
+  %sp25 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6789
+  %bc26 = shufflevector <4 x i32> %sp25, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6790
+  %w27 = xor <4 x i32> %w24, %bc26, !dbg !6791
+  %sp28 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6792
+  %bc29 = shufflevector <4 x i32> %sp28, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6793
+  %w30 = mul <4 x i32> %w27, %bc29, !dbg !6794
+  %sp31 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6795
+  %bc32 = shufflevector <4 x i32> %sp31, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6796
+  %w33 = mul <4 x i32> %w30, %bc32, !dbg !6797
+  %sp34 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6798
+  %bc35 = shufflevector <4 x i32> %sp34, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6799
+  %w36 = xor <4 x i32> %w33, %bc35, !dbg !6800
+  %sp37 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6801
+  %bc38 = shufflevector <4 x i32> %sp37, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6802
+  %w39 = or <4 x i32> %w36, %bc38, !dbg !6803
+  store <4 x i32> %w39, ptr %buf, align 16, !tbaa !19, !dbg !6804
+  %e40 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 0, !dbg !6805
+  %l41 = load i32, ptr %e40, align 4, !tbaa !19, !dbg !6806
+  %r42 = insertelement <4 x i32> %w39, i32 %l41, i64 3, !dbg !6807
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !6808
+  ret <4 x i32> %r42, !dbg !6809
+}
+
+define i64 @kernel_294(ptr %grid) !dbg !6810 {
+entry:
+  br label %walk, !dbg !6811
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !6812
+  br i1 %c1, label %done, label %body, !dbg !6813
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !6814
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !6815
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !6816
+  %r5 = call i64 @kernel_290(ptr %pr2, i32 %n4), !dbg !6817
+  %a6 = add i64 %tot, %r5, !dbg !6818
+  %r7 = call i64 @kernel_285(ptr %pr2, i32 %n4), !dbg !6819
+  %a8 = add i64 %a6, %r7, !dbg !6820
+  store i64 %a8, ptr @g47, align 8, !tbaa !20, !dbg !6821
+  %tot.next = add i64 %a8, 1, !dbg !6822
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !6823
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !6824
+  br label %walk, !dbg !6825
+
+done:
+  %pc10 = call i32 (ptr, ...) @printf(ptr @g46), !dbg !6826
+  ret i64 %tot, !dbg !6827
+}
+
+define i64 @kernel_295(ptr noalias %recs, i32 %n) !dbg !6828 {
+entry:
+  %c1 = icmp sgt i32 %n, 0, !dbg !6829
+  %nw2 = zext i32 %n to i64, !dbg !6830
+  br i1 %c1, label %loop, label %exit, !dbg !6831
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %latch ]
+  %acc = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  %pa3 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 0, !dbg !6832
+  %a4 = load i32, ptr %pa3, align 8, !tbaa !23, !dbg !6833
+  %pb5 = getelementptr inbounds %struct.rec, ptr %recs, i64 %i, i32 1, !dbg !6834
+  %b6 = load i64, ptr %pb5, align 8, !tbaa !24, !dbg !6835
+  %c7 = icmp slt i32 %a4, 39, !dbg !6836
+  br i1 %c7, label %then, label %else, !dbg !6837
+
+then:
+  %x8 = sext i32 %a4 to i64, !dbg !6838
+  %y9 = sub i64 %x8, %b6, !dbg !6839
+  br label %latch, !dbg !6840
+
+else:
+  %z10 = and i64 %b6, 14, !dbg !6841
+  store i64 %z10, ptr %pb5, align 8, !tbaa !24, !dbg !6842
+  br label %latch, !dbg !6843
+
+latch:
+  %m11 = phi i64 [ %y9, %then ], [ %z10, %else ]
+  %acc.next = add i64 %acc, %m11, !dbg !6844
+  %i.next = add nuw nsw i64 %i, 1, !dbg !6845
+  %d12 = icmp eq i64 %i.next, %nw2, !dbg !6846
+  br i1 %d12, label %exit, label %loop, !dbg !6847, !llvm.loop !6848
+
+exit:
+  %r = phi i64 [ 0, %entry ], [ %acc.next, %latch ]
+  ret i64 %r, !dbg !6849
+}
+
+define void @kernel_296(ptr noalias %out, ptr noalias readonly %a, ptr noalias readonly %b, i64 %n) !dbg !6850 {
+entry:
+  %c1 = icmp sgt i64 %n, 0, !dbg !6851
+  br i1 %c1, label %outer, label %exit, !dbg !6852
+
+outer:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %outer.latch ]
+  %row2 = mul nsw i64 %i, %n, !dbg !6853
+  br label %inner, !dbg !6854
+
+inner:
+  %j = phi i64 [ 0, %outer ], [ %j.next, %inner ]
+  %s = phi double [ 0.0, %outer ], [ %s.next, %inner ]
+  %ia3 = add nsw i64 %row2, %j, !dbg !6855
+  %pa4 = getelementptr inbounds double, ptr %a, i64 %ia3, !dbg !6856
+  %va5 = load double, ptr %pa4, align 8, !tbaa !21, !dbg !6857
+  %pb6 = getelementptr inbounds double, ptr %b, i64 %j, !dbg !6858
+  %vb7 = load double, ptr %pb6, align 8, !tbaa !21, !dbg !6859
+  %s.next = call double @llvm.fmuladd.f64(double %va5, double %vb7, double %s), !dbg !6860
+  %j.next = add nuw nsw i64 %j, 1, !dbg !6861
+  %d8 = icmp eq i64 %j.next, %n, !dbg !6862
+  br i1 %d8, label %outer.latch, label %inner, !dbg !6863
+
+outer.latch:
+  %sc9 = fmul double %s.next, 2.500000e+00, !dbg !6864
+  %po10 = getelementptr inbounds double, ptr %out, i64 %i, !dbg !6865
+  store double %sc9, ptr %po10, align 8, !tbaa !21, !dbg !6866
+  %i.next = add nuw nsw i64 %i, 1, !dbg !6867
+  %d11 = icmp eq i64 %i.next, %n, !dbg !6868
+  br i1 %d11, label %exit, label %outer, !dbg !6869
+
+exit:
+  ret void, !dbg !6870
+}
+
+define i32 @kernel_297(i32 %op, i32 %x) !dbg !6871 {
+entry:
+  switch i32 %op, label %default [
+    i32 0, label %case0
+    i32 1, label %case1
+    i32 2, label %case2
+    i32 3, label %case3
+    i32 4, label %case4
+  ], !dbg !6872
+
+case0:
+  %r1 = call i32 @kernel_292(i32 0, i32 %x), !dbg !6873
+  br label %join, !dbg !6874
+
+case1:
+  %r2 = call i32 @kernel_292(i32 1, i32 %x), !dbg !6875
+  br label %join, !dbg !6876
+
+case2:
+  %r3 = call i32 @kernel_287(i32 2, i32 %x), !dbg !6877
+  br label %join, !dbg !6878
+
+case3:
+  %r4 = xor i32 %x, 9, !dbg !6879
+  br label %join, !dbg !6880
+
+case4:
+  %r5 = call i32 @kernel_287(i32 4, i32 %x), !dbg !6881
+  br label %join, !dbg !6882
+
+default:
+  %p6 = getelementptr inbounds [16 x i32], ptr @g52, i64 0, i64 10, !dbg !6883
+  %l7 = load i32, ptr %p6, align 4, !tbaa !19, !dbg !6884
+  %u8 = call i32 @llvm.umin.i32(i32 %l7, i32 %x), !dbg !6885
+  br label %join, !dbg !6886
+
+join:
+  %res = phi i32 [ %r1, %case0 ], [ %r2, %case1 ], [ %r3, %case2 ], [ %r4, %case3 ], [ %r5, %case4 ], [ %u8, %default ]
+  ret i32 %res, !dbg !6887
+}
+
+define <4 x i32> @kernel_298(<4 x i32> %v, i32 %s) !dbg !6888 {
+entry:
+  %buf = alloca [4 x i32], align 16, !dbg !6889
+  call void @llvm.lifetime.start.p0(i64 16, ptr %buf), !dbg !6890
+  %sp1 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6891
+  %bc2 = shufflevector <4 x i32> %sp1, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6892
+  %w3 = add <4 x i32> %v, %bc2, !dbg !6893
+  %sp4 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6894
+  %bc5 = shufflevector <4 x i32> %sp4, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6895
+  %w6 = add <4 x i32> %w3, %bc5, !dbg !6896
+  %sp7 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6897
+  %bc8 = shufflevector <4 x i32> %sp7, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6898
+  %w9 = mul <4 x i32> %w6, %bc8, !dbg !6899
+  %sp10 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6900
+  %bc11 = shufflevector <4 x i32> %sp10, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6901
+  %w12 = xor <4 x i32> %w9, %bc11, !dbg !6902
+  %sp13 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6903
+  %bc14 = shufflevector <4 x i32> %sp13, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6904
+  %w15 = or <4 x i32> %w12, %bc14, !dbg !6905
+  %sp16 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6906
+  %bc17 = shufflevector <4 x i32> %sp16, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6907
+  %w18 = xor <4 x i32> %w15, %bc17, !dbg !6908
+  %sp19 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6909
+  %bc20 = shufflevector <4 x i32> %sp19, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6910
+  %w21 = xor <4 x i32> %w18, %bc20, !dbg !6911
+  %sp22 = insertelement <4 x i32> poison, i32 %s, i64 0, !dbg !6912
+  %bc23 = shufflevector <4 x i32> %sp22, <4 x i32> poison, <4 x i32> zeroinitializer, !dbg !6913
+  %w24 = and <4 x i32> %w21, %bc23, !dbg !6914
+  store <4 x i32> %w24, ptr %buf, align 16, !tbaa !19, !dbg !6915
+  %e25 = getelementptr inbounds [4 x i32], ptr %buf, i64 0, i64 3, !dbg !6916
+  %l26 = load i32, ptr %e25, align 4, !tbaa !19, !dbg !6917
+  %r27 = insertelement <4 x i32> %w24, i32 %l26, i64 3, !dbg !6918
+  call void @llvm.lifetime.end.p0(i64 16, ptr %buf), !dbg !6919
+  ret <4 x i32> %r27, !dbg !6920
+}
+
+define i64 @kernel_299(ptr %grid) !dbg !6921 {
+entry:
+  br label %walk, !dbg !6922
+
+walk:
+  %g = phi ptr [ %grid, %entry ], [ %nextg, %body ]
+  %tot = phi i64 [ 0, %entry ], [ %tot.next, %body ]
+  %c1 = icmp eq ptr %g, null, !dbg !6923
+  br i1 %c1, label %done, label %body, !dbg !6924
+
+body:
+  %pr2 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 2, i64 0, !dbg !6925
+  %pn3 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 0, !dbg !6926
+  %n4 = load i32, ptr %pn3, align 8, !tbaa !19, !dbg !6927
+  %r5 = call i64 @kernel_295(ptr %pr2, i32 %n4), !dbg !6928
+  %a6 = add i64 %tot, %r5, !dbg !6929
+  %r7 = call i64 @kernel_290(ptr %pr2, i32 %n4), !dbg !6930
+  %a8 = add i64 %a6, %r7, !dbg !6931
+  store i64 %a8, ptr @g7, align 8, !tbaa !20, !dbg !6932
+  %tot.next = add i64 %a8, 1, !dbg !6933
+  %pp9 = getelementptr inbounds %struct.grid, ptr %g, i64 0, i32 3, !dbg !6934
+  %nextg = load ptr, ptr %pp9, align 8, !tbaa !22, !dbg !6935
+  br label %walk, !dbg !6936
+
+done:
+  ret i64 %tot, !dbg !6937
+}
+
+!llvm.dbg.cu = !{!10}
+!llvm.module.flags = !{!0, !1}
+
+!0 = !{i32 7, !"Dwarf Version", i32 5}
+!1 = !{i32 2, !"Debug Info Version", i32 3}
+!2 = !DIFile(filename: "src/kernel_0.c", directory: "/work/corpus")
+!3 = !DIFile(filename: "src/kernel_1.c", directory: "/work/corpus")
+!4 = !DIFile(filename: "src/kernel_2.c", directory: "/work/corpus")
+!5 = !DIFile(filename: "src/kernel_3.c", directory: "/work/corpus")
+!6 = !DIFile(filename: "src/kernel_4.c", directory: "/work/corpus")
+!7 = !DIFile(filename: "src/kernel_5.c", directory: "/work/corpus")
+!8 = !DIFile(filename: "src/kernel_6.c", directory: "/work/corpus")
+!9 = !DIFile(filename: "src/kernel_7.c", directory: "/work/corpus")
+!10 = distinct !DICompileUnit(language: DW_LANG_C11, file: !2, producer: "clang version 17.0.6", isOptimized: true, runtimeVersion: 0, emissionKind: LineTablesOnly, splitDebugInlining: false, nameTableKind: None)
+!11 = !DISubroutineType(types: !{})
+!12 = !{!"Simple C/C++ TBAA"}
+!13 = !{!"omnipotent char", !12, i64 0}
+!14 = !{!"int", !13, i64 0}
+!15 = !{!"long", !13, i64 0}
+!16 = !{!"double", !13, i64 0}
+!17 = !{!"any pointer", !13, i64 0}
+!18 = !{!"rec", !14, i64 0, !15, i64 8, !16, i64 16, !17, i64 24}
+!19 = !{!14, !14, i64 0}
+!20 = !{!15, !15, i64 0}
+!21 = !{!16, !16, i64 0}
+!22 = !{!17, !17, i64 0}
+!23 = !{!18, !14, i64 0}
+!24 = !{!18, !15, i64 8}
+!25 = !{!18, !16, i64 16}
+!26 = !{!"llvm.loop.mustprogress"}
+!27 = distinct !DISubprogram(name: "kernel_0", scope: !2, file: !2, line: 10, type: !11, scopeLine: 10, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!28 = !DILocation(line: 10, column: 29, scope: !27)
+!29 = !DILocation(line: 11, column: 15, scope: !27)
+!30 = !DILocation(line: 12, column: 23, scope: !27)
+!31 = !DILocation(line: 13, column: 28, scope: !27)
+!32 = !DILocation(line: 15, column: 3, scope: !27)
+!33 = !DILocation(line: 16, column: 26, scope: !27)
+!34 = !DILocation(line: 16, column: 37, scope: !27)
+!35 = !DILocation(line: 18, column: 5, scope: !27)
+!36 = !DILocation(line: 18, column: 28, scope: !27)
+!37 = !DILocation(line: 18, column: 30, scope: !27)
+!38 = !DILocation(line: 19, column: 39, scope: !27)
+!39 = !DILocation(line: 19, column: 27, scope: !27)
+!40 = !DILocation(line: 21, column: 26, scope: !27)
+!41 = !DILocation(line: 21, column: 29, scope: !27)
+!42 = !DILocation(line: 23, column: 13, scope: !27)
+!43 = !DILocation(line: 24, column: 33, scope: !27)
+!44 = !DILocation(line: 25, column: 22, scope: !27)
+!45 = !DILocation(line: 26, column: 20, scope: !27)
+!46 = !DILocation(line: 26, column: 14, scope: !27)
+!47 = distinct !{!47, !26}
+!48 = !DILocation(line: 28, column: 30, scope: !27)
+!49 = distinct !DISubprogram(name: "kernel_1", scope: !3, file: !3, line: 50, type: !11, scopeLine: 50, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!50 = !DILocation(line: 51, column: 20, scope: !49)
+!51 = !DILocation(line: 52, column: 16, scope: !49)
+!52 = !DILocation(line: 53, column: 36, scope: !49)
+!53 = !DILocation(line: 54, column: 36, scope: !49)
+!54 = !DILocation(line: 55, column: 28, scope: !49)
+!55 = !DILocation(line: 55, column: 7, scope: !49)
+!56 = !DILocation(line: 56, column: 27, scope: !49)
+!57 = !DILocation(line: 58, column: 13, scope: !49)
+!58 = !DILocation(line: 59, column: 38, scope: !49)
+!59 = !DILocation(line: 61, column: 25, scope: !49)
+!60 = !DILocation(line: 62, column: 27, scope: !49)
+!61 = !DILocation(line: 63, column: 11, scope: !49)
+!62 = !DILocation(line: 63, column: 26, scope: !49)
+!63 = !DILocation(line: 63, column: 22, scope: !49)
+!64 = !DILocation(line: 64, column: 25, scope: !49)
+!65 = !DILocation(line: 64, column: 30, scope: !49)
+!66 = !DILocation(line: 66, column: 12, scope: !49)
+!67 = !DILocation(line: 66, column: 36, scope: !49)
+!68 = !DILocation(line: 67, column: 6, scope: !49)
+!69 = !DILocation(line: 67, column: 30, scope: !49)
+!70 = distinct !DISubprogram(name: "kernel_2", scope: !4, file: !4, line: 90, type: !11, scopeLine: 90, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!71 = !DILocation(line: 90, column: 27, scope: !70)
+!72 = !DILocation(line: 90, column: 20, scope: !70)
+!73 = !DILocation(line: 91, column: 37, scope: !70)
+!74 = !DILocation(line: 92, column: 20, scope: !70)
+!75 = !DILocation(line: 93, column: 16, scope: !70)
+!76 = !DILocation(line: 95, column: 26, scope: !70)
+!77 = !DILocation(line: 97, column: 18, scope: !70)
+!78 = !DILocation(line: 99, column: 5, scope: !70)
+!79 = !DILocation(line: 101, column: 11, scope: !70)
+!80 = !DILocation(line: 103, column: 22, scope: !70)
+!81 = !DILocation(line: 104, column: 6, scope: !70)
+!82 = !DILocation(line: 106, column: 23, scope: !70)
+!83 = !DILocation(line: 108, column: 21, scope: !70)
+!84 = !DILocation(line: 109, column: 18, scope: !70)
+!85 = distinct !DISubprogram(name: "kernel_3", scope: !5, file: !5, line: 130, type: !11, scopeLine: 130, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!86 = !DILocation(line: 132, column: 18, scope: !85)
+!87 = !DILocation(line: 133, column: 19, scope: !85)
+!88 = !DILocation(line: 135, column: 13, scope: !85)
+!89 = !DILocation(line: 135, column: 27, scope: !85)
+!90 = !DILocation(line: 136, column: 36, scope: !85)
+!91 = !DILocation(line: 137, column: 6, scope: !85)
+!92 = !DILocation(line: 137, column: 13, scope: !85)
+!93 = !DILocation(line: 139, column: 19, scope: !85)
+!94 = !DILocation(line: 139, column: 16, scope: !85)
+!95 = !DILocation(line: 141, column: 33, scope: !85)
+!96 = !DILocation(line: 143, column: 38, scope: !85)
+!97 = !DILocation(line: 144, column: 40, scope: !85)
+!98 = !DILocation(line: 145, column: 26, scope: !85)
+!99 = !DILocation(line: 146, column: 39, scope: !85)
+!100 = !DILocation(line: 148, column: 9, scope: !85)
+!101 = !DILocation(line: 149, column: 18, scope: !85)
+!102 = !DILocation(line: 150, column: 35, scope: !85)
+!103 = !DILocation(line: 150, column: 9, scope: !85)
+!104 = !DILocation(line: 151, column: 10, scope: !85)
+!105 = !DILocation(line: 152, column: 32, scope: !85)
+!106 = !DILocation(line: 154, column: 20, scope: !85)
+!107 = !DILocation(line: 155, column: 25, scope: !85)
+!108 = !DILocation(line: 156, column: 36, scope: !85)
+!109 = !DILocation(line: 156, column: 29, scope: !85)
+!110 = !DILocation(line: 156, column: 4, scope: !85)
+!111 = !DILocation(line: 156, column: 16, scope: !85)
+!112 = !DILocation(line: 157, column: 7, scope: !85)
+!113 = !DILocation(line: 158, column: 40, scope: !85)
+!114 = !DILocation(line: 160, column: 10, scope: !85)
+!115 = !DILocation(line: 161, column: 16, scope: !85)
+!116 = !DILocation(line: 162, column: 19, scope: !85)
+!117 = !DILocation(line: 163, column: 26, scope: !85)
+!118 = !DILocation(line: 164, column: 39, scope: !85)
+!119 = !DILocation(line: 165, column: 26, scope: !85)
+!120 = !DILocation(line: 166, column: 10, scope: !85)
+!121 = !DILocation(line: 167, column: 39, scope: !85)
+!122 = !DILocation(line: 168, column: 5, scope: !85)
+!123 = !DILocation(line: 168, column: 30, scope: !85)
+!124 = distinct !DISubprogram(name: "kernel_4", scope: !6, file: !6, line: 170, type: !11, scopeLine: 170, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!125 = !DILocation(line: 171, column: 22, scope: !124)
+!126 = !DILocation(line: 172, column: 11, scope: !124)
+!127 = !DILocation(line: 173, column: 36, scope: !124)
+!128 = !DILocation(line: 173, column: 4, scope: !124)
+!129 = !DILocation(line: 174, column: 30, scope: !124)
+!130 = !DILocation(line: 175, column: 30, scope: !124)
+!131 = !DILocation(line: 175, column: 14, scope: !124)
+!132 = !DILocation(line: 176, column: 34, scope: !124)
+!133 = !DILocation(line: 177, column: 21, scope: !124)
+!134 = !DILocation(line: 178, column: 29, scope: !124)
+!135 = !DILocation(line: 180, column: 36, scope: !124)
+!136 = !DILocation(line: 180, column: 22, scope: !124)
+!137 = !DILocation(line: 182, column: 3, scope: !124)
+!138 = !DILocation(line: 182, column: 26, scope: !124)
+!139 = !DILocation(line: 182, column: 34, scope: !124)
+!140 = distinct !DISubprogram(name: "kernel_5", scope: !7, file: !7, line: 210, type: !11, scopeLine: 210, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!141 = !DILocation(line: 210, column: 18, scope: !140)
+!142 = !DILocation(line: 210, column: 12, scope: !140)
+!143 = !DILocation(line: 210, column: 14, scope: !140)
+!144 = !DILocation(line: 211, column: 8, scope: !140)
+!145 = !DILocation(line: 212, column: 39, scope: !140)
+!146 = !DILocation(line: 213, column: 37, scope: !140)
+!147 = !DILocation(line: 213, column: 34, scope: !140)
+!148 = !DILocation(line: 214, column: 14, scope: !140)
+!149 = !DILocation(line: 216, column: 17, scope: !140)
+!150 = !DILocation(line: 217, column: 19, scope: !140)
+!151 = !DILocation(line: 217, column: 33, scope: !140)
+!152 = !DILocation(line: 219, column: 19, scope: !140)
+!153 = !DILocation(line: 220, column: 33, scope: !140)
+!154 = !DILocation(line: 222, column: 22, scope: !140)
+!155 = !DILocation(line: 223, column: 38, scope: !140)
+!156 = !DILocation(line: 225, column: 31, scope: !140)
+!157 = !DILocation(line: 226, column: 12, scope: !140)
+!158 = !DILocation(line: 226, column: 5, scope: !140)
+!159 = !DILocation(line: 227, column: 32, scope: !140)
+!160 = distinct !{!160, !26}
+!161 = !DILocation(line: 229, column: 35, scope: !140)
+!162 = distinct !DISubprogram(name: "kernel_6", scope: !8, file: !8, line: 250, type: !11, scopeLine: 250, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!163 = !DILocation(line: 252, column: 9, scope: !162)
+!164 = !DILocation(line: 253, column: 22, scope: !162)
+!165 = !DILocation(line: 254, column: 23, scope: !162)
+!166 = !DILocation(line: 255, column: 38, scope: !162)
+!167 = !DILocation(line: 256, column: 40, scope: !162)
+!168 = !DILocation(line: 258, column: 20, scope: !162)
+!169 = !DILocation(line: 260, column: 19, scope: !162)
+!170 = !DILocation(line: 262, column: 29, scope: !162)
+!171 = !DILocation(line: 262, column: 26, scope: !162)
+!172 = !DILocation(line: 263, column: 39, scope: !162)
+!173 = !DILocation(line: 264, column: 9, scope: !162)
+!174 = !DILocation(line: 265, column: 18, scope: !162)
+!175 = !DILocation(line: 267, column: 7, scope: !162)
+!176 = !DILocation(line: 269, column: 32, scope: !162)
+!177 = !DILocation(line: 270, column: 37, scope: !162)
+!178 = !DILocation(line: 271, column: 37, scope: !162)
+!179 = !DILocation(line: 272, column: 17, scope: !162)
+!180 = !DILocation(line: 273, column: 38, scope: !162)
+!181 = !DILocation(line: 273, column: 16, scope: !162)
+!182 = !DILocation(line: 274, column: 10, scope: !162)
+!183 = distinct !DISubprogram(name: "kernel_7", scope: !9, file: !9, line: 290, type: !11, scopeLine: 290, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!184 = !DILocation(line: 291, column: 26, scope: !183)
+!185 = !DILocation(line: 293, column: 22, scope: !183)
+!186 = !DILocation(line: 293, column: 3, scope: !183)
+!187 = !DILocation(line: 293, column: 22, scope: !183)
+!188 = !DILocation(line: 293, column: 35, scope: !183)
+!189 = !DILocation(line: 294, column: 12, scope: !183)
+!190 = !DILocation(line: 294, column: 36, scope: !183)
+!191 = !DILocation(line: 294, column: 22, scope: !183)
+!192 = !DILocation(line: 294, column: 39, scope: !183)
+!193 = !DILocation(line: 295, column: 16, scope: !183)
+!194 = !DILocation(line: 296, column: 36, scope: !183)
+!195 = !DILocation(line: 296, column: 29, scope: !183)
+!196 = distinct !DISubprogram(name: "kernel_8", scope: !2, file: !2, line: 330, type: !11, scopeLine: 330, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!197 = !DILocation(line: 331, column: 16, scope: !196)
+!198 = !DILocation(line: 333, column: 16, scope: !196)
+!199 = !DILocation(line: 333, column: 39, scope: !196)
+!200 = !DILocation(line: 334, column: 9, scope: !196)
+!201 = !DILocation(line: 334, column: 32, scope: !196)
+!202 = !DILocation(line: 335, column: 4, scope: !196)
+!203 = !DILocation(line: 336, column: 13, scope: !196)
+!204 = !DILocation(line: 336, column: 21, scope: !196)
+!205 = !DILocation(line: 337, column: 5, scope: !196)
+!206 = !DILocation(line: 338, column: 39, scope: !196)
+!207 = !DILocation(line: 338, column: 40, scope: !196)
+!208 = !DILocation(line: 340, column: 32, scope: !196)
+!209 = !DILocation(line: 341, column: 29, scope: !196)
+!210 = !DILocation(line: 341, column: 9, scope: !196)
+!211 = !DILocation(line: 343, column: 27, scope: !196)
+!212 = !DILocation(line: 343, column: 30, scope: !196)
+!213 = !DILocation(line: 345, column: 6, scope: !196)
+!214 = !DILocation(line: 345, column: 32, scope: !196)
+!215 = !DILocation(line: 346, column: 24, scope: !196)
+!216 = !DILocation(line: 347, column: 20, scope: !196)
+!217 = !DILocation(line: 347, column: 21, scope: !196)
+!218 = !DILocation(line: 347, column: 32, scope: !196)
+!219 = !DILocation(line: 348, column: 22, scope: !196)
+!220 = !DILocation(line: 349, column: 26, scope: !196)
+!221 = !DILocation(line: 349, column: 18, scope: !196)
+!222 = !DILocation(line: 351, column: 39, scope: !196)
+!223 = !DILocation(line: 351, column: 40, scope: !196)
+!224 = !DILocation(line: 351, column: 4, scope: !196)
+!225 = !DILocation(line: 351, column: 36, scope: !196)
+!226 = !DILocation(line: 352, column: 23, scope: !196)
+!227 = !DILocation(line: 353, column: 36, scope: !196)
+!228 = !DILocation(line: 355, column: 31, scope: !196)
+!229 = !DILocation(line: 356, column: 21, scope: !196)
+!230 = !DILocation(line: 358, column: 23, scope: !196)
+!231 = !DILocation(line: 359, column: 16, scope: !196)
+!232 = !DILocation(line: 361, column: 39, scope: !196)
+!233 = !DILocation(line: 362, column: 13, scope: !196)
+!234 = !DILocation(line: 363, column: 37, scope: !196)
+!235 = !DILocation(line: 365, column: 36, scope: !196)
+!236 = !DILocation(line: 367, column: 28, scope: !196)
+!237 = !DILocation(line: 368, column: 11, scope: !196)
+!238 = !DILocation(line: 369, column: 22, scope: !196)
+!239 = !DILocation(line: 370, column: 8, scope: !196)
+!240 = !DILocation(line: 370, column: 30, scope: !196)
+!241 = !DILocation(line: 371, column: 39, scope: !196)
+!242 = !DILocation(line: 373, column: 4, scope: !196)
+!243 = !DILocation(line: 374, column: 11, scope: !196)
+!244 = !DILocation(line: 375, column: 21, scope: !196)
+!245 = !DILocation(line: 377, column: 32, scope: !196)
+!246 = !DILocation(line: 378, column: 17, scope: !196)
+!247 = distinct !DISubprogram(name: "kernel_9", scope: !3, file: !3, line: 370, type: !11, scopeLine: 370, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!248 = !DILocation(line: 370, column: 20, scope: !247)
+!249 = !DILocation(line: 370, column: 34, scope: !247)
+!250 = !DILocation(line: 371, column: 8, scope: !247)
+!251 = !DILocation(line: 371, column: 30, scope: !247)
+!252 = !DILocation(line: 372, column: 32, scope: !247)
+!253 = !DILocation(line: 373, column: 13, scope: !247)
+!254 = !DILocation(line: 374, column: 16, scope: !247)
+!255 = !DILocation(line: 374, column: 16, scope: !247)
+!256 = !DILocation(line: 374, column: 16, scope: !247)
+!257 = !DILocation(line: 374, column: 8, scope: !247)
+!258 = !DILocation(line: 375, column: 17, scope: !247)
+!259 = !DILocation(line: 375, column: 4, scope: !247)
+!260 = !DILocation(line: 375, column: 9, scope: !247)
+!261 = !DILocation(line: 376, column: 11, scope: !247)
+!262 = !DILocation(line: 378, column: 17, scope: !247)
+!263 = !DILocation(line: 378, column: 40, scope: !247)
+!264 = distinct !DISubprogram(name: "kernel_10", scope: !4, file: !4, line: 410, type: !11, scopeLine: 410, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!265 = !DILocation(line: 412, column: 19, scope: !264)
+!266 = !DILocation(line: 413, column: 35, scope: !264)
+!267 = !DILocation(line: 415, column: 37, scope: !264)
+!268 = !DILocation(line: 416, column: 6, scope: !264)
+!269 = !DILocation(line: 417, column: 8, scope: !264)
+!270 = !DILocation(line: 418, column: 9, scope: !264)
+!271 = !DILocation(line: 418, column: 14, scope: !264)
+!272 = !DILocation(line: 418, column: 4, scope: !264)
+!273 = !DILocation(line: 419, column: 24, scope: !264)
+!274 = !DILocation(line: 420, column: 13, scope: !264)
+!275 = !DILocation(line: 422, column: 35, scope: !264)
+!276 = !DILocation(line: 422, column: 37, scope: !264)
+!277 = !DILocation(line: 424, column: 31, scope: !264)
+!278 = !DILocation(line: 425, column: 34, scope: !264)
+!279 = !DILocation(line: 426, column: 25, scope: !264)
+!280 = !DILocation(line: 427, column: 37, scope: !264)
+!281 = !DILocation(line: 428, column: 3, scope: !264)
+!282 = !DILocation(line: 429, column: 3, scope: !264)
+!283 = !DILocation(line: 429, column: 17, scope: !264)
+!284 = distinct !{!284, !26}
+!285 = !DILocation(line: 430, column: 7, scope: !264)
+!286 = distinct !DISubprogram(name: "kernel_11", scope: !5, file: !5, line: 450, type: !11, scopeLine: 450, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!287 = !DILocation(line: 451, column: 18, scope: !286)
+!288 = !DILocation(line: 452, column: 3, scope: !286)
+!289 = !DILocation(line: 452, column: 30, scope: !286)
+!290 = !DILocation(line: 452, column: 10, scope: !286)
+!291 = !DILocation(line: 453, column: 20, scope: !286)
+!292 = !DILocation(line: 453, column: 32, scope: !286)
+!293 = !DILocation(line: 453, column: 7, scope: !286)
+!294 = !DILocation(line: 455, column: 33, scope: !286)
+!295 = !DILocation(line: 455, column: 29, scope: !286)
+!296 = !DILocation(line: 455, column: 39, scope: !286)
+!297 = !DILocation(line: 456, column: 37, scope: !286)
+!298 = !DILocation(line: 457, column: 23, scope: !286)
+!299 = !DILocation(line: 459, column: 30, scope: !286)
+!300 = !DILocation(line: 460, column: 37, scope: !286)
+!301 = !DILocation(line: 461, column: 17, scope: !286)
+!302 = !DILocation(line: 461, column: 20, scope: !286)
+!303 = !DILocation(line: 462, column: 33, scope: !286)
+!304 = !DILocation(line: 464, column: 8, scope: !286)
+!305 = !DILocation(line: 465, column: 35, scope: !286)
+!306 = !DILocation(line: 466, column: 22, scope: !286)
+!307 = distinct !DISubprogram(name: "kernel_12", scope: !6, file: !6, line: 490, type: !11, scopeLine: 490, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!308 = !DILocation(line: 491, column: 40, scope: !307)
+!309 = !DILocation(line: 491, column: 18, scope: !307)
+!310 = !DILocation(line: 491, column: 33, scope: !307)
+!311 = !DILocation(line: 493, column: 40, scope: !307)
+!312 = !DILocation(line: 494, column: 23, scope: !307)
+!313 = !DILocation(line: 496, column: 5, scope: !307)
+!314 = !DILocation(line: 496, column: 36, scope: !307)
+!315 = !DILocation(line: 498, column: 38, scope: !307)
+!316 = !DILocation(line: 499, column: 6, scope: !307)
+!317 = !DILocation(line: 500, column: 13, scope: !307)
+!318 = !DILocation(line: 500, column: 23, scope: !307)
+!319 = !DILocation(line: 502, column: 36, scope: !307)
+!320 = !DILocation(line: 503, column: 40, scope: !307)
+!321 = !DILocation(line: 504, column: 13, scope: !307)
+!322 = !DILocation(line: 504, column: 19, scope: !307)
+!323 = !DILocation(line: 504, column: 20, scope: !307)
+!324 = !DILocation(line: 505, column: 28, scope: !307)
+!325 = !DILocation(line: 506, column: 13, scope: !307)
+!326 = distinct !DISubprogram(name: "kernel_13", scope: !7, file: !7, line: 530, type: !11, scopeLine: 530, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!327 = !DILocation(line: 531, column: 25, scope: !326)
+!328 = !DILocation(line: 531, column: 17, scope: !326)
+!329 = !DILocation(line: 532, column: 15, scope: !326)
+!330 = !DILocation(line: 533, column: 19, scope: !326)
+!331 = !DILocation(line: 535, column: 26, scope: !326)
+!332 = !DILocation(line: 536, column: 25, scope: !326)
+!333 = !DILocation(line: 538, column: 3, scope: !326)
+!334 = !DILocation(line: 539, column: 4, scope: !326)
+!335 = !DILocation(line: 540, column: 29, scope: !326)
+!336 = !DILocation(line: 540, column: 11, scope: !326)
+!337 = !DILocation(line: 541, column: 24, scope: !326)
+!338 = !DILocation(line: 541, column: 25, scope: !326)
+!339 = !DILocation(line: 542, column: 38, scope: !326)
+!340 = !DILocation(line: 543, column: 3, scope: !326)
+!341 = !DILocation(line: 544, column: 40, scope: !326)
+!342 = !DILocation(line: 545, column: 26, scope: !326)
+!343 = !DILocation(line: 545, column: 22, scope: !326)
+!344 = !DILocation(line: 547, column: 40, scope: !326)
+!345 = !DILocation(line: 548, column: 22, scope: !326)
+!346 = !DILocation(line: 550, column: 11, scope: !326)
+!347 = !DILocation(line: 552, column: 37, scope: !326)
+!348 = !DILocation(line: 553, column: 27, scope: !326)
+!349 = !DILocation(line: 554, column: 34, scope: !326)
+!350 = !DILocation(line: 555, column: 34, scope: !326)
+!351 = !DILocation(line: 557, column: 12, scope: !326)
+!352 = !DILocation(line: 558, column: 4, scope: !326)
+!353 = !DILocation(line: 559, column: 8, scope: !326)
+!354 = !DILocation(line: 560, column: 19, scope: !326)
+!355 = !DILocation(line: 560, column: 3, scope: !326)
+!356 = !DILocation(line: 561, column: 23, scope: !326)
+!357 = !DILocation(line: 562, column: 25, scope: !326)
+!358 = !DILocation(line: 564, column: 7, scope: !326)
+!359 = !DILocation(line: 565, column: 20, scope: !326)
+!360 = !DILocation(line: 565, column: 11, scope: !326)
+!361 = !DILocation(line: 565, column: 32, scope: !326)
+!362 = !DILocation(line: 566, column: 16, scope: !326)
+!363 = !DILocation(line: 566, column: 28, scope: !326)
+!364 = !DILocation(line: 566, column: 22, scope: !326)
+!365 = !DILocation(line: 567, column: 3, scope: !326)
+!366 = !DILocation(line: 568, column: 31, scope: !326)
+!367 = !DILocation(line: 569, column: 8, scope: !326)
+!368 = !DILocation(line: 571, column: 37, scope: !326)
+!369 = !DILocation(line: 572, column: 9, scope: !326)
+!370 = !DILocation(line: 573, column: 22, scope: !326)
+!371 = !DILocation(line: 574, column: 4, scope: !326)
+!372 = !DILocation(line: 574, column: 29, scope: !326)
+!373 = !DILocation(line: 576, column: 16, scope: !326)
+!374 = distinct !DISubprogram(name: "kernel_14", scope: !8, file: !8, line: 570, type: !11, scopeLine: 570, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!375 = !DILocation(line: 572, column: 36, scope: !374)
+!376 = !DILocation(line: 572, column: 27, scope: !374)
+!377 = !DILocation(line: 573, column: 12, scope: !374)
+!378 = !DILocation(line: 574, column: 34, scope: !374)
+!379 = !DILocation(line: 574, column: 27, scope: !374)
+!380 = !DILocation(line: 575, column: 8, scope: !374)
+!381 = !DILocation(line: 575, column: 4, scope: !374)
+!382 = !DILocation(line: 576, column: 6, scope: !374)
+!383 = !DILocation(line: 576, column: 16, scope: !374)
+!384 = !DILocation(line: 577, column: 24, scope: !374)
+!385 = !DILocation(line: 577, column: 13, scope: !374)
+!386 = !DILocation(line: 578, column: 4, scope: !374)
+!387 = !DILocation(line: 580, column: 21, scope: !374)
+!388 = !DILocation(line: 581, column: 19, scope: !374)
+!389 = !DILocation(line: 582, column: 4, scope: !374)
+!390 = !DILocation(line: 584, column: 29, scope: !374)
+!391 = !DILocation(line: 584, column: 11, scope: !374)
+!392 = distinct !DISubprogram(name: "kernel_15", scope: !9, file: !9, line: 610, type: !11, scopeLine: 610, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!393 = !DILocation(line: 611, column: 32, scope: !392)
+!394 = !DILocation(line: 612, column: 4, scope: !392)
+!395 = !DILocation(line: 614, column: 18, scope: !392)
+!396 = !DILocation(line: 616, column: 13, scope: !392)
+!397 = !DILocation(line: 617, column: 21, scope: !392)
+!398 = !DILocation(line: 618, column: 39, scope: !392)
+!399 = !DILocation(line: 620, column: 36, scope: !392)
+!400 = !DILocation(line: 620, column: 31, scope: !392)
+!401 = !DILocation(line: 622, column: 32, scope: !392)
+!402 = !DILocation(line: 623, column: 39, scope: !392)
+!403 = !DILocation(line: 624, column: 35, scope: !392)
+!404 = !DILocation(line: 625, column: 32, scope: !392)
+!405 = !DILocation(line: 626, column: 31, scope: !392)
+!406 = !DILocation(line: 628, column: 27, scope: !392)
+!407 = !DILocation(line: 628, column: 40, scope: !392)
+!408 = !DILocation(line: 629, column: 17, scope: !392)
+!409 = !DILocation(line: 629, column: 39, scope: !392)
+!410 = !DILocation(line: 630, column: 21, scope: !392)
+!411 = !DILocation(line: 631, column: 29, scope: !392)
+!412 = distinct !{!412, !26}
+!413 = !DILocation(line: 632, column: 20, scope: !392)
+!414 = distinct !DISubprogram(name: "kernel_16", scope: !2, file: !2, line: 650, type: !11, scopeLine: 650, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!415 = !DILocation(line: 650, column: 26, scope: !414)
+!416 = !DILocation(line: 651, column: 22, scope: !414)
+!417 = !DILocation(line: 652, column: 3, scope: !414)
+!418 = !DILocation(line: 652, column: 15, scope: !414)
+!419 = !DILocation(line: 653, column: 12, scope: !414)
+!420 = !DILocation(line: 655, column: 3, scope: !414)
+!421 = !DILocation(line: 656, column: 21, scope: !414)
+!422 = !DILocation(line: 658, column: 10, scope: !414)
+!423 = !DILocation(line: 659, column: 35, scope: !414)
+!424 = !DILocation(line: 660, column: 35, scope: !414)
+!425 = !DILocation(line: 660, column: 28, scope: !414)
+!426 = !DILocation(line: 661, column: 20, scope: !414)
+!427 = !DILocation(line: 662, column: 19, scope: !414)
+!428 = !DILocation(line: 663, column: 16, scope: !414)
+!429 = !DILocation(line: 665, column: 19, scope: !414)
+!430 = !DILocation(line: 666, column: 3, scope: !414)
+!431 = !DILocation(line: 667, column: 9, scope: !414)
+!432 = !DILocation(line: 669, column: 8, scope: !414)
+!433 = !DILocation(line: 671, column: 37, scope: !414)
+!434 = !DILocation(line: 672, column: 10, scope: !414)
+!435 = distinct !DISubprogram(name: "kernel_17", scope: !3, file: !3, line: 690, type: !11, scopeLine: 690, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!436 = !DILocation(line: 690, column: 16, scope: !435)
+!437 = !DILocation(line: 692, column: 19, scope: !435)
+!438 = !DILocation(line: 694, column: 7, scope: !435)
+!439 = !DILocation(line: 694, column: 39, scope: !435)
+!440 = !DILocation(line: 695, column: 38, scope: !435)
+!441 = !DILocation(line: 696, column: 7, scope: !435)
+!442 = !DILocation(line: 697, column: 24, scope: !435)
+!443 = !DILocation(line: 698, column: 14, scope: !435)
+!444 = !DILocation(line: 699, column: 35, scope: !435)
+!445 = !DILocation(line: 700, column: 7, scope: !435)
+!446 = !DILocation(line: 700, column: 29, scope: !435)
+!447 = !DILocation(line: 702, column: 8, scope: !435)
+!448 = !DILocation(line: 703, column: 19, scope: !435)
+!449 = !DILocation(line: 704, column: 26, scope: !435)
+!450 = !DILocation(line: 705, column: 5, scope: !435)
+!451 = !DILocation(line: 707, column: 11, scope: !435)
+!452 = !DILocation(line: 708, column: 15, scope: !435)
+!453 = !DILocation(line: 709, column: 37, scope: !435)
+!454 = !DILocation(line: 710, column: 35, scope: !435)
+!455 = !DILocation(line: 711, column: 9, scope: !435)
+!456 = distinct !DISubprogram(name: "kernel_18", scope: !4, file: !4, line: 730, type: !11, scopeLine: 730, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!457 = !DILocation(line: 730, column: 7, scope: !456)
+!458 = !DILocation(line: 731, column: 22, scope: !456)
+!459 = !DILocation(line: 732, column: 38, scope: !456)
+!460 = !DILocation(line: 733, column: 7, scope: !456)
+!461 = !DILocation(line: 733, column: 40, scope: !456)
+!462 = !DILocation(line: 733, column: 37, scope: !456)
+!463 = !DILocation(line: 734, column: 17, scope: !456)
+!464 = !DILocation(line: 735, column: 26, scope: !456)
+!465 = !DILocation(line: 735, column: 5, scope: !456)
+!466 = !DILocation(line: 737, column: 39, scope: !456)
+!467 = !DILocation(line: 738, column: 12, scope: !456)
+!468 = !DILocation(line: 739, column: 21, scope: !456)
+!469 = !DILocation(line: 740, column: 15, scope: !456)
+!470 = !DILocation(line: 741, column: 40, scope: !456)
+!471 = !DILocation(line: 741, column: 36, scope: !456)
+!472 = !DILocation(line: 742, column: 15, scope: !456)
+!473 = !DILocation(line: 744, column: 23, scope: !456)
+!474 = !DILocation(line: 745, column: 10, scope: !456)
+!475 = !DILocation(line: 746, column: 21, scope: !456)
+!476 = !DILocation(line: 747, column: 33, scope: !456)
+!477 = !DILocation(line: 749, column: 4, scope: !456)
+!478 = !DILocation(line: 750, column: 32, scope: !456)
+!479 = !DILocation(line: 751, column: 33, scope: !456)
+!480 = !DILocation(line: 752, column: 6, scope: !456)
+!481 = !DILocation(line: 752, column: 4, scope: !456)
+!482 = !DILocation(line: 753, column: 18, scope: !456)
+!483 = distinct !DISubprogram(name: "kernel_19", scope: !5, file: !5, line: 770, type: !11, scopeLine: 770, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!484 = !DILocation(line: 770, column: 37, scope: !483)
+!485 = !DILocation(line: 770, column: 20, scope: !483)
+!486 = !DILocation(line: 772, column: 18, scope: !483)
+!487 = !DILocation(line: 772, column: 32, scope: !483)
+!488 = !DILocation(line: 772, column: 8, scope: !483)
+!489 = !DILocation(line: 772, column: 29, scope: !483)
+!490 = !DILocation(line: 773, column: 38, scope: !483)
+!491 = !DILocation(line: 773, column: 38, scope: !483)
+!492 = !DILocation(line: 774, column: 7, scope: !483)
+!493 = !DILocation(line: 776, column: 9, scope: !483)
+!494 = !DILocation(line: 777, column: 25, scope: !483)
+!495 = !DILocation(line: 779, column: 28, scope: !483)
+!496 = !DILocation(line: 779, column: 25, scope: !483)
+!497 = !DILocation(line: 781, column: 20, scope: !483)
+!498 = !DILocation(line: 782, column: 9, scope: !483)
+!499 = !DILocation(line: 783, column: 16, scope: !483)
+!500 = distinct !DISubprogram(name: "kernel_20", scope: !6, file: !6, line: 810, type: !11, scopeLine: 810, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!501 = !DILocation(line: 812, column: 24, scope: !500)
+!502 = !DILocation(line: 813, column: 34, scope: !500)
+!503 = !DILocation(line: 814, column: 19, scope: !500)
+!504 = !DILocation(line: 815, column: 19, scope: !500)
+!505 = !DILocation(line: 816, column: 40, scope: !500)
+!506 = !DILocation(line: 817, column: 12, scope: !500)
+!507 = !DILocation(line: 818, column: 37, scope: !500)
+!508 = !DILocation(line: 819, column: 10, scope: !500)
+!509 = !DILocation(line: 819, column: 14, scope: !500)
+!510 = !DILocation(line: 821, column: 8, scope: !500)
+!511 = !DILocation(line: 822, column: 23, scope: !500)
+!512 = !DILocation(line: 823, column: 25, scope: !500)
+!513 = !DILocation(line: 823, column: 4, scope: !500)
+!514 = !DILocation(line: 823, column: 11, scope: !500)
+!515 = !DILocation(line: 825, column: 21, scope: !500)
+!516 = !DILocation(line: 826, column: 23, scope: !500)
+!517 = !DILocation(line: 826, column: 13, scope: !500)
+!518 = !DILocation(line: 827, column: 18, scope: !500)
+!519 = !DILocation(line: 829, column: 31, scope: !500)
+!520 = distinct !{!520, !26}
+!521 = !DILocation(line: 829, column: 8, scope: !500)
+!522 = distinct !DISubprogram(name: "kernel_21", scope: !7, file: !7, line: 850, type: !11, scopeLine: 850, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!523 = !DILocation(line: 851, column: 17, scope: !522)
+!524 = !DILocation(line: 851, column: 15, scope: !522)
+!525 = !DILocation(line: 851, column: 10, scope: !522)
+!526 = !DILocation(line: 852, column: 38, scope: !522)
+!527 = !DILocation(line: 853, column: 32, scope: !522)
+!528 = !DILocation(line: 854, column: 11, scope: !522)
+!529 = !DILocation(line: 854, column: 3, scope: !522)
+!530 = !DILocation(line: 854, column: 27, scope: !522)
+!531 = !DILocation(line: 855, column: 37, scope: !522)
+!532 = !DILocation(line: 855, column: 20, scope: !522)
+!533 = !DILocation(line: 856, column: 4, scope: !522)
+!534 = !DILocation(line: 858, column: 39, scope: !522)
+!535 = !DILocation(line: 859, column: 4, scope: !522)
+!536 = !DILocation(line: 860, column: 37, scope: !522)
+!537 = !DILocation(line: 861, column: 18, scope: !522)
+!538 = !DILocation(line: 863, column: 14, scope: !522)
+!539 = !DILocation(line: 863, column: 39, scope: !522)
+!540 = !DILocation(line: 863, column: 39, scope: !522)
+!541 = !DILocation(line: 865, column: 40, scope: !522)
+!542 = !DILocation(line: 866, column: 16, scope: !522)
+!543 = distinct !DISubprogram(name: "kernel_22", scope: !8, file: !8, line: 890, type: !11, scopeLine: 890, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!544 = !DILocation(line: 891, column: 15, scope: !543)
+!545 = !DILocation(line: 892, column: 38, scope: !543)
+!546 = !DILocation(line: 893, column: 22, scope: !543)
+!547 = !DILocation(line: 894, column: 38, scope: !543)
+!548 = !DILocation(line: 895, column: 3, scope: !543)
+!549 = !DILocation(line: 896, column: 9, scope: !543)
+!550 = !DILocation(line: 897, column: 10, scope: !543)
+!551 = !DILocation(line: 898, column: 34, scope: !543)
+!552 = !DILocation(line: 899, column: 16, scope: !543)
+!553 = !DILocation(line: 900, column: 20, scope: !543)
+!554 = !DILocation(line: 902, column: 31, scope: !543)
+!555 = !DILocation(line: 904, column: 21, scope: !543)
+!556 = !DILocation(line: 905, column: 4, scope: !543)
+!557 = !DILocation(line: 907, column: 9, scope: !543)
+!558 = !DILocation(line: 907, column: 27, scope: !543)
+!559 = !DILocation(line: 907, column: 24, scope: !543)
+!560 = !DILocation(line: 909, column: 23, scope: !543)
+!561 = !DILocation(line: 911, column: 24, scope: !543)
+!562 = distinct !DISubprogram(name: "kernel_23", scope: !9, file: !9, line: 930, type: !11, scopeLine: 930, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!563 = !DILocation(line: 930, column: 11, scope: !562)
+!564 = !DILocation(line: 931, column: 10, scope: !562)
+!565 = !DILocation(line: 932, column: 4, scope: !562)
+!566 = !DILocation(line: 932, column: 9, scope: !562)
+!567 = !DILocation(line: 933, column: 34, scope: !562)
+!568 = !DILocation(line: 934, column: 6, scope: !562)
+!569 = !DILocation(line: 934, column: 33, scope: !562)
+!570 = !DILocation(line: 936, column: 12, scope: !562)
+!571 = !DILocation(line: 937, column: 12, scope: !562)
+!572 = !DILocation(line: 938, column: 28, scope: !562)
+!573 = !DILocation(line: 939, column: 36, scope: !562)
+!574 = !DILocation(line: 940, column: 3, scope: !562)
+!575 = !DILocation(line: 942, column: 24, scope: !562)
+!576 = !DILocation(line: 943, column: 16, scope: !562)
+!577 = !DILocation(line: 944, column: 21, scope: !562)
+!578 = !DILocation(line: 946, column: 12, scope: !562)
+!579 = !DILocation(line: 947, column: 11, scope: !562)
+!580 = !DILocation(line: 947, column: 29, scope: !562)
+!581 = !DILocation(line: 947, column: 20, scope: !562)
+!582 = !DILocation(line: 949, column: 5, scope: !562)
+!583 = !DILocation(line: 950, column: 36, scope: !562)
+!584 = !DILocation(line: 951, column: 34, scope: !562)
+!585 = !DILocation(line: 953, column: 17, scope: !562)
+!586 = !DILocation(line: 954, column: 30, scope: !562)
+!587 = !DILocation(line: 956, column: 3, scope: !562)
+!588 = !DILocation(line: 957, column: 34, scope: !562)
+!589 = !DILocation(line: 958, column: 11, scope: !562)
+!590 = !DILocation(line: 958, column: 19, scope: !562)
+!591 = !DILocation(line: 959, column: 31, scope: !562)
+!592 = distinct !DISubprogram(name: "kernel_24", scope: !2, file: !2, line: 970, type: !11, scopeLine: 970, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!593 = !DILocation(line: 970, column: 3, scope: !592)
+!594 = !DILocation(line: 970, column: 7, scope: !592)
+!595 = !DILocation(line: 971, column: 26, scope: !592)
+!596 = !DILocation(line: 971, column: 4, scope: !592)
+!597 = !DILocation(line: 973, column: 7, scope: !592)
+!598 = !DILocation(line: 974, column: 17, scope: !592)
+!599 = !DILocation(line: 975, column: 17, scope: !592)
+!600 = !DILocation(line: 976, column: 23, scope: !592)
+!601 = !DILocation(line: 977, column: 7, scope: !592)
+!602 = !DILocation(line: 977, column: 31, scope: !592)
+!603 = !DILocation(line: 978, column: 15, scope: !592)
+!604 = !DILocation(line: 979, column: 20, scope: !592)
+!605 = !DILocation(line: 980, column: 22, scope: !592)
+!606 = !DILocation(line: 980, column: 17, scope: !592)
+!607 = !DILocation(line: 980, column: 11, scope: !592)
+!608 = !DILocation(line: 981, column: 21, scope: !592)
+!609 = !DILocation(line: 982, column: 24, scope: !592)
+!610 = distinct !DISubprogram(name: "kernel_25", scope: !3, file: !3, line: 1010, type: !11, scopeLine: 1010, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!611 = !DILocation(line: 1012, column: 37, scope: !610)
+!612 = !DILocation(line: 1013, column: 7, scope: !610)
+!613 = !DILocation(line: 1013, column: 9, scope: !610)
+!614 = !DILocation(line: 1014, column: 18, scope: !610)
+!615 = !DILocation(line: 1014, column: 30, scope: !610)
+!616 = !DILocation(line: 1015, column: 7, scope: !610)
+!617 = !DILocation(line: 1015, column: 38, scope: !610)
+!618 = !DILocation(line: 1015, column: 32, scope: !610)
+!619 = !DILocation(line: 1016, column: 18, scope: !610)
+!620 = !DILocation(line: 1018, column: 14, scope: !610)
+!621 = !DILocation(line: 1019, column: 12, scope: !610)
+!622 = !DILocation(line: 1020, column: 35, scope: !610)
+!623 = !DILocation(line: 1020, column: 39, scope: !610)
+!624 = !DILocation(line: 1020, column: 38, scope: !610)
+!625 = !DILocation(line: 1022, column: 4, scope: !610)
+!626 = !DILocation(line: 1022, column: 25, scope: !610)
+!627 = !DILocation(line: 1024, column: 20, scope: !610)
+!628 = !DILocation(line: 1026, column: 27, scope: !610)
+!629 = !DILocation(line: 1027, column: 39, scope: !610)
+!630 = distinct !{!630, !26}
+!631 = !DILocation(line: 1027, column: 26, scope: !610)
+!632 = distinct !DISubprogram(name: "kernel_26", scope: !4, file: !4, line: 1050, type: !11, scopeLine: 1050, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!633 = !DILocation(line: 1051, column: 23, scope: !632)
+!634 = !DILocation(line: 1052, column: 40, scope: !632)
+!635 = !DILocation(line: 1053, column: 16, scope: !632)
+!636 = !DILocation(line: 1054, column: 22, scope: !632)
+!637 = !DILocation(line: 1055, column: 23, scope: !632)
+!638 = !DILocation(line: 1056, column: 25, scope: !632)
+!639 = !DILocation(line: 1058, column: 16, scope: !632)
+!640 = !DILocation(line: 1059, column: 38, scope: !632)
+!641 = !DILocation(line: 1061, column: 25, scope: !632)
+!642 = !DILocation(line: 1062, column: 11, scope: !632)
+!643 = !DILocation(line: 1064, column: 28, scope: !632)
+!644 = !DILocation(line: 1066, column: 25, scope: !632)
+!645 = !DILocation(line: 1067, column: 40, scope: !632)
+!646 = !DILocation(line: 1068, column: 3, scope: !632)
+!647 = !DILocation(line: 1068, column: 16, scope: !632)
+!648 = !DILocation(line: 1069, column: 9, scope: !632)
+!649 = !DILocation(line: 1070, column: 14, scope: !632)
+!650 = !DILocation(line: 1072, column: 36, scope: !632)
+!651 = !DILocation(line: 1072, column: 3, scope: !632)
+!652 = !DILocation(line: 1072, column: 22, scope: !632)
+!653 = distinct !DISubprogram(name: "kernel_27", scope: !5, file: !5, line: 1090, type: !11, scopeLine: 1090, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!654 = !DILocation(line: 1091, column: 11, scope: !653)
+!655 = !DILocation(line: 1092, column: 4, scope: !653)
+!656 = !DILocation(line: 1093, column: 25, scope: !653)
+!657 = !DILocation(line: 1095, column: 7, scope: !653)
+!658 = !DILocation(line: 1096, column: 5, scope: !653)
+!659 = !DILocation(line: 1097, column: 31, scope: !653)
+!660 = !DILocation(line: 1098, column: 26, scope: !653)
+!661 = !DILocation(line: 1099, column: 10, scope: !653)
+!662 = !DILocation(line: 1100, column: 3, scope: !653)
+!663 = !DILocation(line: 1102, column: 9, scope: !653)
+!664 = !DILocation(line: 1103, column: 30, scope: !653)
+!665 = !DILocation(line: 1105, column: 22, scope: !653)
+!666 = !DILocation(line: 1106, column: 32, scope: !653)
+!667 = !DILocation(line: 1108, column: 24, scope: !653)
+!668 = !DILocation(line: 1109, column: 21, scope: !653)
+!669 = !DILocation(line: 1111, column: 21, scope: !653)
+!670 = !DILocation(line: 1112, column: 39, scope: !653)
+!671 = !DILocation(line: 1113, column: 25, scope: !653)
+!672 = distinct !DISubprogram(name: "kernel_28", scope: !6, file: !6, line: 1130, type: !11, scopeLine: 1130, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!673 = !DILocation(line: 1131, column: 36, scope: !672)
+!674 = !DILocation(line: 1133, column: 12, scope: !672)
+!675 = !DILocation(line: 1133, column: 29, scope: !672)
+!676 = !DILocation(line: 1133, column: 25, scope: !672)
+!677 = !DILocation(line: 1133, column: 5, scope: !672)
+!678 = !DILocation(line: 1134, column: 27, scope: !672)
+!679 = !DILocation(line: 1135, column: 15, scope: !672)
+!680 = !DILocation(line: 1137, column: 28, scope: !672)
+!681 = !DILocation(line: 1138, column: 18, scope: !672)
+!682 = !DILocation(line: 1139, column: 39, scope: !672)
+!683 = !DILocation(line: 1140, column: 5, scope: !672)
+!684 = !DILocation(line: 1142, column: 14, scope: !672)
+!685 = !DILocation(line: 1143, column: 19, scope: !672)
+!686 = !DILocation(line: 1145, column: 38, scope: !672)
+!687 = !DILocation(line: 1146, column: 36, scope: !672)
+!688 = !DILocation(line: 1146, column: 10, scope: !672)
+!689 = !DILocation(line: 1147, column: 4, scope: !672)
+!690 = !DILocation(line: 1148, column: 20, scope: !672)
+!691 = !DILocation(line: 1149, column: 32, scope: !672)
+!692 = !DILocation(line: 1149, column: 37, scope: !672)
+!693 = !DILocation(line: 1151, column: 26, scope: !672)
+!694 = !DILocation(line: 1153, column: 38, scope: !672)
+!695 = !DILocation(line: 1154, column: 19, scope: !672)
+!696 = !DILocation(line: 1156, column: 28, scope: !672)
+!697 = !DILocation(line: 1158, column: 12, scope: !672)
+!698 = !DILocation(line: 1160, column: 37, scope: !672)
+!699 = !DILocation(line: 1162, column: 6, scope: !672)
+!700 = !DILocation(line: 1163, column: 33, scope: !672)
+!701 = !DILocation(line: 1164, column: 34, scope: !672)
+!702 = !DILocation(line: 1165, column: 4, scope: !672)
+!703 = !DILocation(line: 1166, column: 31, scope: !672)
+!704 = !DILocation(line: 1167, column: 39, scope: !672)
+!705 = distinct !DISubprogram(name: "kernel_29", scope: !7, file: !7, line: 1170, type: !11, scopeLine: 1170, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!706 = !DILocation(line: 1171, column: 29, scope: !705)
+!707 = !DILocation(line: 1172, column: 11, scope: !705)
+!708 = !DILocation(line: 1173, column: 21, scope: !705)
+!709 = !DILocation(line: 1174, column: 7, scope: !705)
+!710 = !DILocation(line: 1176, column: 31, scope: !705)
+!711 = !DILocation(line: 1177, column: 4, scope: !705)
+!712 = !DILocation(line: 1177, column: 20, scope: !705)
+!713 = !DILocation(line: 1178, column: 30, scope: !705)
+!714 = !DILocation(line: 1178, column: 15, scope: !705)
+!715 = !DILocation(line: 1180, column: 7, scope: !705)
+!716 = !DILocation(line: 1182, column: 5, scope: !705)
+!717 = !DILocation(line: 1184, column: 15, scope: !705)
+!718 = !DILocation(line: 1184, column: 3, scope: !705)
+!719 = !DILocation(line: 1185, column: 38, scope: !705)
+!720 = !DILocation(line: 1185, column: 35, scope: !705)
+!721 = !DILocation(line: 1187, column: 20, scope: !705)
+!722 = distinct !DISubprogram(name: "kernel_30", scope: !8, file: !8, line: 1210, type: !11, scopeLine: 1210, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!723 = !DILocation(line: 1210, column: 10, scope: !722)
+!724 = !DILocation(line: 1211, column: 3, scope: !722)
+!725 = !DILocation(line: 1211, column: 32, scope: !722)
+!726 = !DILocation(line: 1211, column: 29, scope: !722)
+!727 = !DILocation(line: 1213, column: 22, scope: !722)
+!728 = !DILocation(line: 1214, column: 24, scope: !722)
+!729 = !DILocation(line: 1215, column: 25, scope: !722)
+!730 = !DILocation(line: 1215, column: 25, scope: !722)
+!731 = !DILocation(line: 1216, column: 17, scope: !722)
+!732 = !DILocation(line: 1217, column: 11, scope: !722)
+!733 = !DILocation(line: 1219, column: 37, scope: !722)
+!734 = !DILocation(line: 1221, column: 37, scope: !722)
+!735 = !DILocation(line: 1222, column: 38, scope: !722)
+!736 = !DILocation(line: 1222, column: 38, scope: !722)
+!737 = !DILocation(line: 1223, column: 18, scope: !722)
+!738 = !DILocation(line: 1223, column: 40, scope: !722)
+!739 = !DILocation(line: 1225, column: 33, scope: !722)
+!740 = !DILocation(line: 1226, column: 20, scope: !722)
+!741 = !DILocation(line: 1228, column: 13, scope: !722)
+!742 = distinct !{!742, !26}
+!743 = !DILocation(line: 1229, column: 24, scope: !722)
+!744 = distinct !DISubprogram(name: "kernel_31", scope: !9, file: !9, line: 1250, type: !11, scopeLine: 1250, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!745 = !DILocation(line: 1251, column: 29, scope: !744)
+!746 = !DILocation(line: 1251, column: 37, scope: !744)
+!747 = !DILocation(line: 1251, column: 23, scope: !744)
+!748 = !DILocation(line: 1252, column: 22, scope: !744)
+!749 = !DILocation(line: 1252, column: 8, scope: !744)
+!750 = !DILocation(line: 1253, column: 34, scope: !744)
+!751 = !DILocation(line: 1255, column: 38, scope: !744)
+!752 = !DILocation(line: 1256, column: 30, scope: !744)
+!753 = !DILocation(line: 1257, column: 27, scope: !744)
+!754 = !DILocation(line: 1259, column: 8, scope: !744)
+!755 = !DILocation(line: 1260, column: 4, scope: !744)
+!756 = !DILocation(line: 1262, column: 28, scope: !744)
+!757 = !DILocation(line: 1264, column: 13, scope: !744)
+!758 = !DILocation(line: 1265, column: 9, scope: !744)
+!759 = !DILocation(line: 1266, column: 6, scope: !744)
+!760 = !DILocation(line: 1267, column: 8, scope: !744)
+!761 = !DILocation(line: 1268, column: 31, scope: !744)
+!762 = !DILocation(line: 1268, column: 24, scope: !744)
+!763 = !DILocation(line: 1268, column: 26, scope: !744)
+!764 = !DILocation(line: 1269, column: 38, scope: !744)
+!765 = distinct !DISubprogram(name: "kernel_32", scope: !2, file: !2, line: 1290, type: !11, scopeLine: 1290, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!766 = !DILocation(line: 1291, column: 9, scope: !765)
+!767 = !DILocation(line: 1291, column: 4, scope: !765)
+!768 = !DILocation(line: 1291, column: 19, scope: !765)
+!769 = !DILocation(line: 1293, column: 19, scope: !765)
+!770 = !DILocation(line: 1293, column: 10, scope: !765)
+!771 = !DILocation(line: 1293, column: 33, scope: !765)
+!772 = !DILocation(line: 1293, column: 16, scope: !765)
+!773 = !DILocation(line: 1295, column: 12, scope: !765)
+!774 = !DILocation(line: 1296, column: 30, scope: !765)
+!775 = !DILocation(line: 1296, column: 11, scope: !765)
+!776 = !DILocation(line: 1297, column: 19, scope: !765)
+!777 = !DILocation(line: 1299, column: 22, scope: !765)
+!778 = !DILocation(line: 1301, column: 16, scope: !765)
+!779 = !DILocation(line: 1302, column: 14, scope: !765)
+!780 = !DILocation(line: 1303, column: 5, scope: !765)
+!781 = !DILocation(line: 1305, column: 26, scope: !765)
+!782 = !DILocation(line: 1305, column: 36, scope: !765)
+!783 = !DILocation(line: 1305, column: 20, scope: !765)
+!784 = distinct !DISubprogram(name: "kernel_33", scope: !3, file: !3, line: 1330, type: !11, scopeLine: 1330, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!785 = !DILocation(line: 1330, column: 33, scope: !784)
+!786 = !DILocation(line: 1330, column: 18, scope: !784)
+!787 = !DILocation(line: 1330, column: 35, scope: !784)
+!788 = !DILocation(line: 1331, column: 28, scope: !784)
+!789 = !DILocation(line: 1333, column: 26, scope: !784)
+!790 = !DILocation(line: 1334, column: 5, scope: !784)
+!791 = !DILocation(line: 1336, column: 10, scope: !784)
+!792 = !DILocation(line: 1336, column: 35, scope: !784)
+!793 = !DILocation(line: 1337, column: 21, scope: !784)
+!794 = !DILocation(line: 1339, column: 5, scope: !784)
+!795 = !DILocation(line: 1340, column: 16, scope: !784)
+!796 = !DILocation(line: 1341, column: 34, scope: !784)
+!797 = !DILocation(line: 1343, column: 36, scope: !784)
+!798 = !DILocation(line: 1344, column: 21, scope: !784)
+!799 = !DILocation(line: 1345, column: 31, scope: !784)
+!800 = !DILocation(line: 1345, column: 25, scope: !784)
+!801 = !DILocation(line: 1346, column: 19, scope: !784)
+!802 = !DILocation(line: 1347, column: 4, scope: !784)
+!803 = !DILocation(line: 1347, column: 33, scope: !784)
+!804 = !DILocation(line: 1348, column: 22, scope: !784)
+!805 = !DILocation(line: 1350, column: 37, scope: !784)
+!806 = !DILocation(line: 1350, column: 11, scope: !784)
+!807 = !DILocation(line: 1351, column: 15, scope: !784)
+!808 = !DILocation(line: 1353, column: 25, scope: !784)
+!809 = !DILocation(line: 1355, column: 23, scope: !784)
+!810 = !DILocation(line: 1355, column: 35, scope: !784)
+!811 = distinct !DISubprogram(name: "kernel_34", scope: !4, file: !4, line: 1370, type: !11, scopeLine: 1370, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!812 = !DILocation(line: 1370, column: 29, scope: !811)
+!813 = !DILocation(line: 1371, column: 6, scope: !811)
+!814 = !DILocation(line: 1372, column: 37, scope: !811)
+!815 = !DILocation(line: 1373, column: 24, scope: !811)
+!816 = !DILocation(line: 1374, column: 29, scope: !811)
+!817 = !DILocation(line: 1375, column: 8, scope: !811)
+!818 = !DILocation(line: 1376, column: 38, scope: !811)
+!819 = !DILocation(line: 1378, column: 5, scope: !811)
+!820 = !DILocation(line: 1379, column: 37, scope: !811)
+!821 = !DILocation(line: 1379, column: 40, scope: !811)
+!822 = !DILocation(line: 1380, column: 26, scope: !811)
+!823 = !DILocation(line: 1381, column: 31, scope: !811)
+!824 = !DILocation(line: 1381, column: 20, scope: !811)
+!825 = !DILocation(line: 1382, column: 16, scope: !811)
+!826 = !DILocation(line: 1382, column: 4, scope: !811)
+!827 = !DILocation(line: 1384, column: 35, scope: !811)
+!828 = !DILocation(line: 1385, column: 11, scope: !811)
+!829 = distinct !DISubprogram(name: "kernel_35", scope: !5, file: !5, line: 1410, type: !11, scopeLine: 1410, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!830 = !DILocation(line: 1410, column: 29, scope: !829)
+!831 = !DILocation(line: 1411, column: 30, scope: !829)
+!832 = !DILocation(line: 1411, column: 10, scope: !829)
+!833 = !DILocation(line: 1413, column: 31, scope: !829)
+!834 = !DILocation(line: 1414, column: 25, scope: !829)
+!835 = !DILocation(line: 1414, column: 34, scope: !829)
+!836 = !DILocation(line: 1415, column: 30, scope: !829)
+!837 = !DILocation(line: 1417, column: 13, scope: !829)
+!838 = !DILocation(line: 1418, column: 7, scope: !829)
+!839 = !DILocation(line: 1420, column: 18, scope: !829)
+!840 = !DILocation(line: 1421, column: 24, scope: !829)
+!841 = !DILocation(line: 1422, column: 24, scope: !829)
+!842 = !DILocation(line: 1423, column: 22, scope: !829)
+!843 = !DILocation(line: 1423, column: 24, scope: !829)
+!844 = !DILocation(line: 1424, column: 20, scope: !829)
+!845 = !DILocation(line: 1426, column: 7, scope: !829)
+!846 = !DILocation(line: 1426, column: 22, scope: !829)
+!847 = !DILocation(line: 1428, column: 24, scope: !829)
+!848 = !DILocation(line: 1429, column: 4, scope: !829)
+!849 = distinct !{!849, !26}
+!850 = !DILocation(line: 1429, column: 40, scope: !829)
+!851 = distinct !DISubprogram(name: "kernel_36", scope: !6, file: !6, line: 1450, type: !11, scopeLine: 1450, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!852 = !DILocation(line: 1451, column: 32, scope: !851)
+!853 = !DILocation(line: 1452, column: 35, scope: !851)
+!854 = !DILocation(line: 1454, column: 4, scope: !851)
+!855 = !DILocation(line: 1456, column: 31, scope: !851)
+!856 = !DILocation(line: 1457, column: 19, scope: !851)
+!857 = !DILocation(line: 1457, column: 29, scope: !851)
+!858 = !DILocation(line: 1458, column: 19, scope: !851)
+!859 = !DILocation(line: 1460, column: 39, scope: !851)
+!860 = !DILocation(line: 1461, column: 6, scope: !851)
+!861 = !DILocation(line: 1462, column: 28, scope: !851)
+!862 = !DILocation(line: 1462, column: 28, scope: !851)
+!863 = !DILocation(line: 1464, column: 40, scope: !851)
+!864 = !DILocation(line: 1466, column: 16, scope: !851)
+!865 = !DILocation(line: 1467, column: 8, scope: !851)
+!866 = !DILocation(line: 1469, column: 36, scope: !851)
+!867 = !DILocation(line: 1469, column: 27, scope: !851)
+!868 = !DILocation(line: 1469, column: 32, scope: !851)
+!869 = !DILocation(line: 1471, column: 16, scope: !851)
+!870 = !DILocation(line: 1472, column: 40, scope: !851)
+!871 = !DILocation(line: 1474, column: 21, scope: !851)
+!872 = distinct !DISubprogram(name: "kernel_37", scope: !7, file: !7, line: 1490, type: !11, scopeLine: 1490, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!873 = !DILocation(line: 1490, column: 13, scope: !872)
+!874 = !DILocation(line: 1490, column: 22, scope: !872)
+!875 = !DILocation(line: 1490, column: 31, scope: !872)
+!876 = !DILocation(line: 1491, column: 17, scope: !872)
+!877 = !DILocation(line: 1492, column: 15, scope: !872)
+!878 = !DILocation(line: 1492, column: 36, scope: !872)
+!879 = !DILocation(line: 1493, column: 4, scope: !872)
+!880 = !DILocation(line: 1493, column: 14, scope: !872)
+!881 = !DILocation(line: 1494, column: 37, scope: !872)
+!882 = !DILocation(line: 1494, column: 30, scope: !872)
+!883 = !DILocation(line: 1494, column: 19, scope: !872)
+!884 = !DILocation(line: 1495, column: 7, scope: !872)
+!885 = !DILocation(line: 1495, column: 11, scope: !872)
+!886 = !DILocation(line: 1495, column: 28, scope: !872)
+!887 = !DILocation(line: 1496, column: 35, scope: !872)
+!888 = !DILocation(line: 1498, column: 28, scope: !872)
+!889 = !DILocation(line: 1500, column: 28, scope: !872)
+!890 = !DILocation(line: 1500, column: 9, scope: !872)
+!891 = distinct !DISubprogram(name: "kernel_38", scope: !8, file: !8, line: 1530, type: !11, scopeLine: 1530, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!892 = !DILocation(line: 1531, column: 39, scope: !891)
+!893 = !DILocation(line: 1532, column: 27, scope: !891)
+!894 = !DILocation(line: 1533, column: 35, scope: !891)
+!895 = !DILocation(line: 1533, column: 9, scope: !891)
+!896 = !DILocation(line: 1534, column: 4, scope: !891)
+!897 = !DILocation(line: 1535, column: 23, scope: !891)
+!898 = !DILocation(line: 1536, column: 17, scope: !891)
+!899 = !DILocation(line: 1537, column: 40, scope: !891)
+!900 = !DILocation(line: 1537, column: 24, scope: !891)
+!901 = !DILocation(line: 1537, column: 35, scope: !891)
+!902 = !DILocation(line: 1539, column: 21, scope: !891)
+!903 = !DILocation(line: 1540, column: 30, scope: !891)
+!904 = !DILocation(line: 1541, column: 23, scope: !891)
+!905 = !DILocation(line: 1543, column: 15, scope: !891)
+!906 = !DILocation(line: 1544, column: 8, scope: !891)
+!907 = !DILocation(line: 1545, column: 19, scope: !891)
+!908 = !DILocation(line: 1545, column: 31, scope: !891)
+!909 = !DILocation(line: 1546, column: 13, scope: !891)
+!910 = !DILocation(line: 1547, column: 19, scope: !891)
+!911 = !DILocation(line: 1548, column: 3, scope: !891)
+!912 = !DILocation(line: 1549, column: 9, scope: !891)
+!913 = !DILocation(line: 1549, column: 21, scope: !891)
+!914 = !DILocation(line: 1550, column: 22, scope: !891)
+!915 = !DILocation(line: 1551, column: 35, scope: !891)
+!916 = !DILocation(line: 1552, column: 14, scope: !891)
+!917 = !DILocation(line: 1552, column: 13, scope: !891)
+!918 = !DILocation(line: 1553, column: 26, scope: !891)
+!919 = !DILocation(line: 1554, column: 31, scope: !891)
+!920 = !DILocation(line: 1555, column: 15, scope: !891)
+!921 = !DILocation(line: 1556, column: 15, scope: !891)
+!922 = !DILocation(line: 1557, column: 34, scope: !891)
+!923 = !DILocation(line: 1558, column: 33, scope: !891)
+!924 = !DILocation(line: 1559, column: 20, scope: !891)
+!925 = !DILocation(line: 1559, column: 35, scope: !891)
+!926 = !DILocation(line: 1559, column: 26, scope: !891)
+!927 = !DILocation(line: 1560, column: 19, scope: !891)
+!928 = !DILocation(line: 1561, column: 13, scope: !891)
+!929 = !DILocation(line: 1562, column: 40, scope: !891)
+!930 = !DILocation(line: 1564, column: 7, scope: !891)
+!931 = !DILocation(line: 1564, column: 18, scope: !891)
+!932 = !DILocation(line: 1564, column: 21, scope: !891)
+!933 = !DILocation(line: 1564, column: 9, scope: !891)
+!934 = !DILocation(line: 1566, column: 20, scope: !891)
+!935 = !DILocation(line: 1567, column: 27, scope: !891)
+!936 = distinct !DISubprogram(name: "kernel_39", scope: !9, file: !9, line: 1570, type: !11, scopeLine: 1570, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!937 = !DILocation(line: 1571, column: 31, scope: !936)
+!938 = !DILocation(line: 1572, column: 37, scope: !936)
+!939 = !DILocation(line: 1573, column: 23, scope: !936)
+!940 = !DILocation(line: 1575, column: 17, scope: !936)
+!941 = !DILocation(line: 1576, column: 27, scope: !936)
+!942 = !DILocation(line: 1578, column: 4, scope: !936)
+!943 = !DILocation(line: 1579, column: 34, scope: !936)
+!944 = !DILocation(line: 1581, column: 27, scope: !936)
+!945 = !DILocation(line: 1581, column: 39, scope: !936)
+!946 = !DILocation(line: 1582, column: 35, scope: !936)
+!947 = !DILocation(line: 1583, column: 19, scope: !936)
+!948 = !DILocation(line: 1584, column: 26, scope: !936)
+!949 = !DILocation(line: 1586, column: 30, scope: !936)
+!950 = !DILocation(line: 1586, column: 36, scope: !936)
+!951 = !DILocation(line: 1587, column: 19, scope: !936)
+!952 = !DILocation(line: 1588, column: 4, scope: !936)
+!953 = distinct !DISubprogram(name: "kernel_40", scope: !2, file: !2, line: 1610, type: !11, scopeLine: 1610, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!954 = !DILocation(line: 1612, column: 31, scope: !953)
+!955 = !DILocation(line: 1612, column: 21, scope: !953)
+!956 = !DILocation(line: 1613, column: 11, scope: !953)
+!957 = !DILocation(line: 1614, column: 6, scope: !953)
+!958 = !DILocation(line: 1616, column: 20, scope: !953)
+!959 = !DILocation(line: 1616, column: 32, scope: !953)
+!960 = !DILocation(line: 1617, column: 12, scope: !953)
+!961 = !DILocation(line: 1617, column: 21, scope: !953)
+!962 = !DILocation(line: 1618, column: 13, scope: !953)
+!963 = !DILocation(line: 1620, column: 36, scope: !953)
+!964 = !DILocation(line: 1622, column: 31, scope: !953)
+!965 = !DILocation(line: 1622, column: 3, scope: !953)
+!966 = !DILocation(line: 1624, column: 35, scope: !953)
+!967 = !DILocation(line: 1625, column: 18, scope: !953)
+!968 = !DILocation(line: 1625, column: 31, scope: !953)
+!969 = !DILocation(line: 1626, column: 29, scope: !953)
+!970 = !DILocation(line: 1628, column: 7, scope: !953)
+!971 = !DILocation(line: 1628, column: 11, scope: !953)
+!972 = !DILocation(line: 1628, column: 26, scope: !953)
+!973 = distinct !{!973, !26}
+!974 = !DILocation(line: 1629, column: 10, scope: !953)
+!975 = distinct !DISubprogram(name: "kernel_41", scope: !3, file: !3, line: 1650, type: !11, scopeLine: 1650, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!976 = !DILocation(line: 1650, column: 21, scope: !975)
+!977 = !DILocation(line: 1651, column: 23, scope: !975)
+!978 = !DILocation(line: 1653, column: 10, scope: !975)
+!979 = !DILocation(line: 1655, column: 33, scope: !975)
+!980 = !DILocation(line: 1656, column: 3, scope: !975)
+!981 = !DILocation(line: 1657, column: 32, scope: !975)
+!982 = !DILocation(line: 1658, column: 36, scope: !975)
+!983 = !DILocation(line: 1660, column: 16, scope: !975)
+!984 = !DILocation(line: 1661, column: 26, scope: !975)
+!985 = !DILocation(line: 1661, column: 21, scope: !975)
+!986 = !DILocation(line: 1662, column: 38, scope: !975)
+!987 = !DILocation(line: 1663, column: 20, scope: !975)
+!988 = !DILocation(line: 1664, column: 22, scope: !975)
+!989 = !DILocation(line: 1664, column: 36, scope: !975)
+!990 = !DILocation(line: 1666, column: 16, scope: !975)
+!991 = !DILocation(line: 1667, column: 12, scope: !975)
+!992 = !DILocation(line: 1667, column: 39, scope: !975)
+!993 = !DILocation(line: 1667, column: 34, scope: !975)
+!994 = !DILocation(line: 1667, column: 37, scope: !975)
+!995 = !DILocation(line: 1668, column: 10, scope: !975)
+!996 = distinct !DISubprogram(name: "kernel_42", scope: !4, file: !4, line: 1690, type: !11, scopeLine: 1690, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!997 = !DILocation(line: 1691, column: 23, scope: !996)
+!998 = !DILocation(line: 1692, column: 25, scope: !996)
+!999 = !DILocation(line: 1693, column: 31, scope: !996)
+!1000 = !DILocation(line: 1695, column: 35, scope: !996)
+!1001 = !DILocation(line: 1696, column: 15, scope: !996)
+!1002 = !DILocation(line: 1697, column: 23, scope: !996)
+!1003 = !DILocation(line: 1697, column: 33, scope: !996)
+!1004 = !DILocation(line: 1699, column: 9, scope: !996)
+!1005 = !DILocation(line: 1700, column: 8, scope: !996)
+!1006 = !DILocation(line: 1701, column: 17, scope: !996)
+!1007 = !DILocation(line: 1702, column: 36, scope: !996)
+!1008 = !DILocation(line: 1702, column: 36, scope: !996)
+!1009 = !DILocation(line: 1702, column: 16, scope: !996)
+!1010 = !DILocation(line: 1704, column: 31, scope: !996)
+!1011 = !DILocation(line: 1705, column: 20, scope: !996)
+!1012 = !DILocation(line: 1707, column: 28, scope: !996)
+!1013 = distinct !DISubprogram(name: "kernel_43", scope: !5, file: !5, line: 1730, type: !11, scopeLine: 1730, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!1014 = !DILocation(line: 1732, column: 40, scope: !1013)
+!1015 = !DILocation(line: 1733, column: 32, scope: !1013)
+!1016 = !DILocation(line: 1734, column: 39, scope: !1013)
+!1017 = !DILocation(line: 1736, column: 10, scope: !1013)
+!1018 = !DILocation(line: 1737, column: 29, scope: !1013)
+!1019 = !DILocation(line: 1739, column: 19, scope: !1013)
+!1020 = !DILocation(line: 1740, column: 24, scope: !1013)
+!1021 = !DILocation(line: 1741, column: 35, scope: !1013)
+!1022 = !DILocation(line: 1743, column: 7, scope: !1013)
+!1023 = !DILocation(line: 1744, column: 27, scope: !1013)
+!1024 = !DILocation(line: 1745, column: 28, scope: !1013)
+!1025 = !DILocation(line: 1746, column: 4, scope: !1013)
+!1026 = !DILocation(line: 1747, column: 22, scope: !1013)
+!1027 = !DILocation(line: 1748, column: 20, scope: !1013)
+!1028 = !DILocation(line: 1749, column: 15, scope: !1013)
+!1029 = !DILocation(line: 1750, column: 7, scope: !1013)
+!1030 = !DILocation(line: 1750, column: 31, scope: !1013)
+!1031 = !DILocation(line: 1750, column: 35, scope: !1013)
+!1032 = !DILocation(line: 1750, column: 40, scope: !1013)
+!1033 = !DILocation(line: 1751, column: 39, scope: !1013)
+!1034 = !DILocation(line: 1751, column: 13, scope: !1013)
+!1035 = !DILocation(line: 1753, column: 27, scope: !1013)
+!1036 = !DILocation(line: 1754, column: 18, scope: !1013)
+!1037 = !DILocation(line: 1755, column: 19, scope: !1013)
+!1038 = !DILocation(line: 1756, column: 40, scope: !1013)
+!1039 = !DILocation(line: 1758, column: 37, scope: !1013)
+!1040 = !DILocation(line: 1758, column: 7, scope: !1013)
+!1041 = !DILocation(line: 1759, column: 21, scope: !1013)
+!1042 = !DILocation(line: 1761, column: 3, scope: !1013)
+!1043 = distinct !DISubprogram(name: "kernel_44", scope: !6, file: !6, line: 1770, type: !11, scopeLine: 1770, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!1044 = !DILocation(line: 1770, column: 23, scope: !1043)
+!1045 = !DILocation(line: 1771, column: 27, scope: !1043)
+!1046 = !DILocation(line: 1772, column: 26, scope: !1043)
+!1047 = !DILocation(line: 1773, column: 12, scope: !1043)
+!1048 = !DILocation(line: 1773, column: 6, scope: !1043)
+!1049 = !DILocation(line: 1773, column: 22, scope: !1043)
+!1050 = !DILocation(line: 1774, column: 12, scope: !1043)
+!1051 = !DILocation(line: 1775, column: 7, scope: !1043)
+!1052 = !DILocation(line: 1775, column: 39, scope: !1043)
+!1053 = !DILocation(line: 1777, column: 4, scope: !1043)
+!1054 = !DILocation(line: 1778, column: 35, scope: !1043)
+!1055 = !DILocation(line: 1779, column: 37, scope: !1043)
+!1056 = !DILocation(line: 1779, column: 23, scope: !1043)
+!1057 = !DILocation(line: 1781, column: 40, scope: !1043)
+!1058 = !DILocation(line: 1782, column: 33, scope: !1043)
+!1059 = !DILocation(line: 1784, column: 16, scope: !1043)
+!1060 = !DILocation(line: 1786, column: 20, scope: !1043)
+!1061 = distinct !DISubprogram(name: "kernel_45", scope: !7, file: !7, line: 1810, type: !11, scopeLine: 1810, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!1062 = !DILocation(line: 1812, column: 21, scope: !1061)
+!1063 = !DILocation(line: 1813, column: 36, scope: !1061)
+!1064 = !DILocation(line: 1814, column: 11, scope: !1061)
+!1065 = !DILocation(line: 1815, column: 8, scope: !1061)
+!1066 = !DILocation(line: 1816, column: 12, scope: !1061)
+!1067 = !DILocation(line: 1816, column: 35, scope: !1061)
+!1068 = !DILocation(line: 1816, column: 13, scope: !1061)
+!1069 = !DILocation(line: 1817, column: 28, scope: !1061)
+!1070 = !DILocation(line: 1818, column: 22, scope: !1061)
+!1071 = !DILocation(line: 1819, column: 22, scope: !1061)
+!1072 = !DILocation(line: 1819, column: 12, scope: !1061)
+!1073 = !DILocation(line: 1820, column: 18, scope: !1061)
+!1074 = !DILocation(line: 1821, column: 31, scope: !1061)
+!1075 = !DILocation(line: 1822, column: 26, scope: !1061)
+!1076 = !DILocation(line: 1822, column: 14, scope: !1061)
+!1077 = !DILocation(line: 1824, column: 21, scope: !1061)
+!1078 = !DILocation(line: 1824, column: 22, scope: !1061)
+!1079 = !DILocation(line: 1825, column: 8, scope: !1061)
+!1080 = !DILocation(line: 1826, column: 11, scope: !1061)
+!1081 = distinct !{!1081, !26}
+!1082 = !DILocation(line: 1827, column: 16, scope: !1061)
+!1083 = distinct !DISubprogram(name: "kernel_46", scope: !8, file: !8, line: 1850, type: !11, scopeLine: 1850, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!1084 = !DILocation(line: 1851, column: 8, scope: !1083)
+!1085 = !DILocation(line: 1852, column: 18, scope: !1083)
+!1086 = !DILocation(line: 1853, column: 33, scope: !1083)
+!1087 = !DILocation(line: 1854, column: 32, scope: !1083)
+!1088 = !DILocation(line: 1855, column: 15, scope: !1083)
+!1089 = !DILocation(line: 1856, column: 26, scope: !1083)
+!1090 = !DILocation(line: 1857, column: 6, scope: !1083)
+!1091 = !DILocation(line: 1858, column: 26, scope: !1083)
+!1092 = !DILocation(line: 1858, column: 30, scope: !1083)
+!1093 = !DILocation(line: 1860, column: 22, scope: !1083)
+!1094 = !DILocation(line: 1862, column: 19, scope: !1083)
+!1095 = !DILocation(line: 1864, column: 14, scope: !1083)
+!1096 = !DILocation(line: 1865, column: 20, scope: !1083)
+!1097 = !DILocation(line: 1866, column: 18, scope: !1083)
+!1098 = !DILocation(line: 1868, column: 6, scope: !1083)
+!1099 = !DILocation(line: 1868, column: 14, scope: !1083)
+!1100 = !DILocation(line: 1869, column: 34, scope: !1083)
+!1101 = !DILocation(line: 1871, column: 29, scope: !1083)
+!1102 = !DILocation(line: 1872, column: 19, scope: !1083)
+!1103 = !DILocation(line: 1872, column: 3, scope: !1083)
+!1104 = distinct !DISubprogram(name: "kernel_47", scope: !9, file: !9, line: 1890, type: !11, scopeLine: 1890, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!1105 = !DILocation(line: 1890, column: 27, scope: !1104)
+!1106 = !DILocation(line: 1891, column: 4, scope: !1104)
+!1107 = !DILocation(line: 1891, column: 29, scope: !1104)
+!1108 = !DILocation(line: 1892, column: 32, scope: !1104)
+!1109 = !DILocation(line: 1892, column: 17, scope: !1104)
+!1110 = !DILocation(line: 1893, column: 14, scope: !1104)
+!1111 = !DILocation(line: 1894, column: 36, scope: !1104)
+!1112 = !DILocation(line: 1896, column: 25, scope: !1104)
+!1113 = !DILocation(line: 1897, column: 10, scope: !1104)
+!1114 = !DILocation(line: 1899, column: 9, scope: !1104)
+!1115 = !DILocation(line: 1900, column: 26, scope: !1104)
+!1116 = !DILocation(line: 1901, column: 21, scope: !1104)
+!1117 = !DILocation(line: 1902, column: 37, scope: !1104)
+!1118 = !DILocation(line: 1902, column: 6, scope: !1104)
+!1119 = !DILocation(line: 1903, column: 22, scope: !1104)
+!1120 = !DILocation(line: 1905, column: 32, scope: !1104)
+!1121 = distinct !DISubprogram(name: "kernel_48", scope: !2, file: !2, line: 1930, type: !11, scopeLine: 1930, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!1122 = !DILocation(line: 1931, column: 36, scope: !1121)
+!1123 = !DILocation(line: 1933, column: 19, scope: !1121)
+!1124 = !DILocation(line: 1934, column: 40, scope: !1121)
+!1125 = !DILocation(line: 1935, column: 30, scope: !1121)
+!1126 = !DILocation(line: 1936, column: 20, scope: !1121)
+!1127 = !DILocation(line: 1936, column: 5, scope: !1121)
+!1128 = !DILocation(line: 1936, column: 30, scope: !1121)
+!1129 = !DILocation(line: 1937, column: 11, scope: !1121)
+!1130 = !DILocation(line: 1937, column: 4, scope: !1121)
+!1131 = !DILocation(line: 1938, column: 36, scope: !1121)
+!1132 = !DILocation(line: 1939, column: 29, scope: !1121)
+!1133 = !DILocation(line: 1940, column: 25, scope: !1121)
+!1134 = !DILocation(line: 1941, column: 16, scope: !1121)
+!1135 = !DILocation(line: 1943, column: 4, scope: !1121)
+!1136 = !DILocation(line: 1945, column: 9, scope: !1121)
+!1137 = !DILocation(line: 1946, column: 16, scope: !1121)
+!1138 = !DILocation(line: 1948, column: 3, scope: !1121)
+!1139 = !DILocation(line: 1949, column: 32, scope: !1121)
+!1140 = !DILocation(line: 1950, column: 38, scope: !1121)
+!1141 = !DILocation(line: 1951, column: 27, scope: !1121)
+!1142 = !DILocation(line: 1953, column: 16, scope: !1121)
+!1143 = !DILocation(line: 1954, column: 12, scope: !1121)
+!1144 = !DILocation(line: 1956, column: 12, scope: !1121)
+!1145 = !DILocation(line: 1958, column: 33, scope: !1121)
+!1146 = !DILocation(line: 1958, column: 19, scope: !1121)
+!1147 = !DILocation(line: 1958, column: 13, scope: !1121)
+!1148 = !DILocation(line: 1959, column: 19, scope: !1121)
+!1149 = !DILocation(line: 1961, column: 30, scope: !1121)
+!1150 = !DILocation(line: 1963, column: 14, scope: !1121)
+!1151 = !DILocation(line: 1965, column: 32, scope: !1121)
+!1152 = !DILocation(line: 1965, column: 38, scope: !1121)
+!1153 = !DILocation(line: 1965, column: 23, scope: !1121)
+!1154 = !DILocation(line: 1965, column: 39, scope: !1121)
+!1155 = !DILocation(line: 1967, column: 24, scope: !1121)
+!1156 = !DILocation(line: 1967, column: 14, scope: !1121)
+!1157 = !DILocation(line: 1967, column: 40, scope: !1121)
+!1158 = !DILocation(line: 1968, column: 37, scope: !1121)
+!1159 = !DILocation(line: 1970, column: 18, scope: !1121)
+!1160 = !DILocation(line: 1970, column: 37, scope: !1121)
+!1161 = !DILocation(line: 1971, column: 22, scope: !1121)
+!1162 = !DILocation(line: 1973, column: 31, scope: !1121)
+!1163 = !DILocation(line: 1973, column: 21, scope: !1121)
+!1164 = !DILocation(line: 1974, column: 17, scope: !1121)
+!1165 = !DILocation(line: 1974, column: 5, scope: !1121)
+!1166 = distinct !DISubprogram(name: "kernel_49", scope: !3, file: !3, line: 1970, type: !11, scopeLine: 1970, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!1167 = !DILocation(line: 1972, column: 18, scope: !1166)
+!1168 = !DILocation(line: 1974, column: 26, scope: !1166)
+!1169 = !DILocation(line: 1975, column: 27, scope: !1166)
+!1170 = !DILocation(line: 1977, column: 32, scope: !1166)
+!1171 = !DILocation(line: 1979, column: 19, scope: !1166)
+!1172 = !DILocation(line: 1981, column: 9, scope: !1166)
+!1173 = !DILocation(line: 1982, column: 12, scope: !1166)
+!1174 = !DILocation(line: 1983, column: 30, scope: !1166)
+!1175 = !DILocation(line: 1984, column: 33, scope: !1166)
+!1176 = !DILocation(line: 1984, column: 25, scope: !1166)
+!1177 = !DILocation(line: 1984, column: 24, scope: !1166)
+!1178 = !DILocation(line: 1985, column: 14, scope: !1166)
+!1179 = !DILocation(line: 1986, column: 31, scope: !1166)
+!1180 = !DILocation(line: 1988, column: 13, scope: !1166)
+!1181 = !DILocation(line: 1989, column: 24, scope: !1166)
+!1182 = !DILocation(line: 1990, column: 25, scope: !1166)
+!1183 = distinct !DISubprogram(name: "kernel_50", scope: !4, file: !4, line: 2010, type: !11, scopeLine: 2010, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!1184 = !DILocation(line: 2012, column: 37, scope: !1183)
+!1185 = !DILocation(line: 2014, column: 21, scope: !1183)
+!1186 = !DILocation(line: 2016, column: 21, scope: !1183)
+!1187 = !DILocation(line: 2016, column: 37, scope: !1183)
+!1188 = !DILocation(line: 2018, column: 5, scope: !1183)
+!1189 = !DILocation(line: 2020, column: 3, scope: !1183)
+!1190 = !DILocation(line: 2020, column: 35, scope: !1183)
+!1191 = !DILocation(line: 2021, column: 12, scope: !1183)
+!1192 = !DILocation(line: 2022, column: 32, scope: !1183)
+!1193 = !DILocation(line: 2024, column: 36, scope: !1183)
+!1194 = !DILocation(line: 2025, column: 26, scope: !1183)
+!1195 = !DILocation(line: 2026, column: 40, scope: !1183)
+!1196 = !DILocation(line: 2027, column: 19, scope: !1183)
+!1197 = !DILocation(line: 2028, column: 33, scope: !1183)
+!1198 = !DILocation(line: 2028, column: 33, scope: !1183)
+!1199 = !DILocation(line: 2030, column: 11, scope: !1183)
+!1200 = !DILocation(line: 2032, column: 14, scope: !1183)
+!1201 = !DILocation(line: 2034, column: 19, scope: !1183)
+!1202 = !DILocation(line: 2036, column: 13, scope: !1183)
+!1203 = distinct !{!1203, !26}
+!1204 = !DILocation(line: 2036, column: 20, scope: !1183)
+!1205 = distinct !DISubprogram(name: "kernel_51", scope: !5, file: !5, line: 2050, type: !11, scopeLine: 2050, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!1206 = !DILocation(line: 2051, column: 26, scope: !1205)
+!1207 = !DILocation(line: 2052, column: 11, scope: !1205)
+!1208 = !DILocation(line: 2052, column: 20, scope: !1205)
+!1209 = !DILocation(line: 2054, column: 25, scope: !1205)
+!1210 = !DILocation(line: 2056, column: 29, scope: !1205)
+!1211 = !DILocation(line: 2058, column: 34, scope: !1205)
+!1212 = !DILocation(line: 2059, column: 25, scope: !1205)
+!1213 = !DILocation(line: 2059, column: 24, scope: !1205)
+!1214 = !DILocation(line: 2059, column: 31, scope: !1205)
+!1215 = !DILocation(line: 2059, column: 32, scope: !1205)
+!1216 = !DILocation(line: 2061, column: 34, scope: !1205)
+!1217 = !DILocation(line: 2063, column: 24, scope: !1205)
+!1218 = !DILocation(line: 2064, column: 15, scope: !1205)
+!1219 = !DILocation(line: 2065, column: 12, scope: !1205)
+!1220 = !DILocation(line: 2065, column: 34, scope: !1205)
+!1221 = !DILocation(line: 2065, column: 11, scope: !1205)
+!1222 = !DILocation(line: 2067, column: 29, scope: !1205)
+!1223 = !DILocation(line: 2069, column: 8, scope: !1205)
+!1224 = !DILocation(line: 2070, column: 28, scope: !1205)
+!1225 = !DILocation(line: 2072, column: 29, scope: !1205)
+!1226 = distinct !DISubprogram(name: "kernel_52", scope: !6, file: !6, line: 2090, type: !11, scopeLine: 2090, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!1227 = !DILocation(line: 2091, column: 10, scope: !1226)
+!1228 = !DILocation(line: 2093, column: 15, scope: !1226)
+!1229 = !DILocation(line: 2095, column: 35, scope: !1226)
+!1230 = !DILocation(line: 2096, column: 9, scope: !1226)
+!1231 = !DILocation(line: 2097, column: 40, scope: !1226)
+!1232 = !DILocation(line: 2099, column: 3, scope: !1226)
+!1233 = !DILocation(line: 2100, column: 3, scope: !1226)
+!1234 = !DILocation(line: 2102, column: 9, scope: !1226)
+!1235 = !DILocation(line: 2104, column: 29, scope: !1226)
+!1236 = !DILocation(line: 2105, column: 24, scope: !1226)
+!1237 = !DILocation(line: 2105, column: 13, scope: !1226)
+!1238 = !DILocation(line: 2107, column: 9, scope: !1226)
+!1239 = !DILocation(line: 2108, column: 32, scope: !1226)
+!1240 = !DILocation(line: 2110, column: 5, scope: !1226)
+!1241 = !DILocation(line: 2111, column: 26, scope: !1226)
+!1242 = !DILocation(line: 2111, column: 35, scope: !1226)
+!1243 = !DILocation(line: 2111, column: 36, scope: !1226)
+!1244 = !DILocation(line: 2111, column: 29, scope: !1226)
+!1245 = !DILocation(line: 2113, column: 39, scope: !1226)
+!1246 = !DILocation(line: 2115, column: 21, scope: !1226)
+!1247 = distinct !DISubprogram(name: "kernel_53", scope: !7, file: !7, line: 2130, type: !11, scopeLine: 2130, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!1248 = !DILocation(line: 2132, column: 14, scope: !1247)
+!1249 = !DILocation(line: 2134, column: 28, scope: !1247)
+!1250 = !DILocation(line: 2136, column: 29, scope: !1247)
+!1251 = !DILocation(line: 2137, column: 24, scope: !1247)
+!1252 = !DILocation(line: 2138, column: 37, scope: !1247)
+!1253 = !DILocation(line: 2140, column: 21, scope: !1247)
+!1254 = !DILocation(line: 2141, column: 16, scope: !1247)
+!1255 = !DILocation(line: 2143, column: 27, scope: !1247)
+!1256 = !DILocation(line: 2144, column: 5, scope: !1247)
+!1257 = !DILocation(line: 2146, column: 5, scope: !1247)
+!1258 = !DILocation(line: 2147, column: 20, scope: !1247)
+!1259 = !DILocation(line: 2147, column: 10, scope: !1247)
+!1260 = !DILocation(line: 2149, column: 13, scope: !1247)
+!1261 = !DILocation(line: 2150, column: 36, scope: !1247)
+!1262 = !DILocation(line: 2152, column: 3, scope: !1247)
+!1263 = !DILocation(line: 2153, column: 11, scope: !1247)
+!1264 = !DILocation(line: 2154, column: 16, scope: !1247)
+!1265 = !DILocation(line: 2155, column: 21, scope: !1247)
+!1266 = !DILocation(line: 2156, column: 4, scope: !1247)
+!1267 = !DILocation(line: 2158, column: 3, scope: !1247)
+!1268 = !DILocation(line: 2158, column: 40, scope: !1247)
+!1269 = !DILocation(line: 2159, column: 4, scope: !1247)
+!1270 = !DILocation(line: 2159, column: 15, scope: !1247)
+!1271 = !DILocation(line: 2160, column: 20, scope: !1247)
+!1272 = !DILocation(line: 2161, column: 33, scope: !1247)
+!1273 = !DILocation(line: 2163, column: 17, scope: !1247)
+!1274 = !DILocation(line: 2165, column: 17, scope: !1247)
+!1275 = !DILocation(line: 2166, column: 23, scope: !1247)
+!1276 = !DILocation(line: 2167, column: 12, scope: !1247)
+!1277 = distinct !DISubprogram(name: "kernel_54", scope: !8, file: !8, line: 2170, type: !11, scopeLine: 2170, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!1278 = !DILocation(line: 2171, column: 23, scope: !1277)
+!1279 = !DILocation(line: 2173, column: 25, scope: !1277)
+!1280 = !DILocation(line: 2173, column: 13, scope: !1277)
+!1281 = !DILocation(line: 2173, column: 6, scope: !1277)
+!1282 = !DILocation(line: 2175, column: 24, scope: !1277)
+!1283 = !DILocation(line: 2176, column: 20, scope: !1277)
+!1284 = !DILocation(line: 2177, column: 32, scope: !1277)
+!1285 = !DILocation(line: 2179, column: 17, scope: !1277)
+!1286 = !DILocation(line: 2180, column: 36, scope: !1277)
+!1287 = !DILocation(line: 2181, column: 8, scope: !1277)
+!1288 = !DILocation(line: 2182, column: 19, scope: !1277)
+!1289 = !DILocation(line: 2184, column: 40, scope: !1277)
+!1290 = !DILocation(line: 2185, column: 36, scope: !1277)
+!1291 = !DILocation(line: 2185, column: 36, scope: !1277)
+!1292 = !DILocation(line: 2185, column: 14, scope: !1277)
+!1293 = !DILocation(line: 2186, column: 14, scope: !1277)
+!1294 = !DILocation(line: 2187, column: 22, scope: !1277)
+!1295 = distinct !DISubprogram(name: "kernel_55", scope: !9, file: !9, line: 2210, type: !11, scopeLine: 2210, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!1296 = !DILocation(line: 2211, column: 40, scope: !1295)
+!1297 = !DILocation(line: 2212, column: 31, scope: !1295)
+!1298 = !DILocation(line: 2213, column: 36, scope: !1295)
+!1299 = !DILocation(line: 2214, column: 8, scope: !1295)
+!1300 = !DILocation(line: 2214, column: 33, scope: !1295)
+!1301 = !DILocation(line: 2215, column: 25, scope: !1295)
+!1302 = !DILocation(line: 2217, column: 37, scope: !1295)
+!1303 = !DILocation(line: 2217, column: 37, scope: !1295)
+!1304 = !DILocation(line: 2218, column: 21, scope: !1295)
+!1305 = !DILocation(line: 2220, column: 32, scope: !1295)
+!1306 = !DILocation(line: 2220, column: 22, scope: !1295)
+!1307 = !DILocation(line: 2220, column: 16, scope: !1295)
+!1308 = !DILocation(line: 2222, column: 6, scope: !1295)
+!1309 = !DILocation(line: 2223, column: 27, scope: !1295)
+!1310 = !DILocation(line: 2225, column: 25, scope: !1295)
+!1311 = !DILocation(line: 2227, column: 7, scope: !1295)
+!1312 = !DILocation(line: 2227, column: 7, scope: !1295)
+!1313 = !DILocation(line: 2229, column: 40, scope: !1295)
+!1314 = !DILocation(line: 2230, column: 5, scope: !1295)
+!1315 = distinct !{!1315, !26}
+!1316 = !DILocation(line: 2230, column: 8, scope: !1295)
+!1317 = distinct !DISubprogram(name: "kernel_56", scope: !2, file: !2, line: 2250, type: !11, scopeLine: 2250, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!1318 = !DILocation(line: 2251, column: 24, scope: !1317)
+!1319 = !DILocation(line: 2252, column: 36, scope: !1317)
+!1320 = !DILocation(line: 2253, column: 26, scope: !1317)
+!1321 = !DILocation(line: 2253, column: 36, scope: !1317)
+!1322 = !DILocation(line: 2253, column: 17, scope: !1317)
+!1323 = !DILocation(line: 2253, column: 40, scope: !1317)
+!1324 = !DILocation(line: 2254, column: 7, scope: !1317)
+!1325 = !DILocation(line: 2255, column: 14, scope: !1317)
+!1326 = !DILocation(line: 2255, column: 21, scope: !1317)
+!1327 = !DILocation(line: 2255, column: 20, scope: !1317)
+!1328 = !DILocation(line: 2255, column: 30, scope: !1317)
+!1329 = !DILocation(line: 2257, column: 33, scope: !1317)
+!1330 = !DILocation(line: 2258, column: 40, scope: !1317)
+!1331 = !DILocation(line: 2260, column: 34, scope: !1317)
+!1332 = !DILocation(line: 2261, column: 22, scope: !1317)
+!1333 = !DILocation(line: 2263, column: 25, scope: !1317)
+!1334 = !DILocation(line: 2263, column: 30, scope: !1317)
+!1335 = !DILocation(line: 2264, column: 29, scope: !1317)
+!1336 = !DILocation(line: 2264, column: 9, scope: !1317)
+!1337 = !DILocation(line: 2265, column: 15, scope: !1317)
+!1338 = distinct !DISubprogram(name: "kernel_57", scope: !3, file: !3, line: 2290, type: !11, scopeLine: 2290, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!1339 = !DILocation(line: 2290, column: 6, scope: !1338)
+!1340 = !DILocation(line: 2292, column: 20, scope: !1338)
+!1341 = !DILocation(line: 2293, column: 12, scope: !1338)
+!1342 = !DILocation(line: 2295, column: 13, scope: !1338)
+!1343 = !DILocation(line: 2297, column: 33, scope: !1338)
+!1344 = !DILocation(line: 2298, column: 11, scope: !1338)
+!1345 = !DILocation(line: 2298, column: 17, scope: !1338)
+!1346 = !DILocation(line: 2299, column: 14, scope: !1338)
+!1347 = !DILocation(line: 2300, column: 18, scope: !1338)
+!1348 = !DILocation(line: 2301, column: 29, scope: !1338)
+!1349 = !DILocation(line: 2302, column: 29, scope: !1338)
+!1350 = !DILocation(line: 2303, column: 23, scope: !1338)
+!1351 = !DILocation(line: 2304, column: 13, scope: !1338)
+!1352 = !DILocation(line: 2305, column: 29, scope: !1338)
+!1353 = !DILocation(line: 2306, column: 17, scope: !1338)
+!1354 = !DILocation(line: 2308, column: 11, scope: !1338)
+!1355 = !DILocation(line: 2308, column: 19, scope: !1338)
+!1356 = !DILocation(line: 2309, column: 40, scope: !1338)
+!1357 = !DILocation(line: 2309, column: 34, scope: !1338)
+!1358 = !DILocation(line: 2310, column: 30, scope: !1338)
+!1359 = distinct !DISubprogram(name: "kernel_58", scope: !4, file: !4, line: 2330, type: !11, scopeLine: 2330, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!1360 = !DILocation(line: 2331, column: 22, scope: !1359)
+!1361 = !DILocation(line: 2332, column: 33, scope: !1359)
+!1362 = !DILocation(line: 2333, column: 11, scope: !1359)
+!1363 = !DILocation(line: 2334, column: 25, scope: !1359)
+!1364 = !DILocation(line: 2336, column: 5, scope: !1359)
+!1365 = !DILocation(line: 2337, column: 3, scope: !1359)
+!1366 = !DILocation(line: 2339, column: 17, scope: !1359)
+!1367 = !DILocation(line: 2340, column: 25, scope: !1359)
+!1368 = !DILocation(line: 2342, column: 24, scope: !1359)
+!1369 = !DILocation(line: 2343, column: 35, scope: !1359)
+!1370 = !DILocation(line: 2343, column: 37, scope: !1359)
+!1371 = !DILocation(line: 2344, column: 31, scope: !1359)
+!1372 = !DILocation(line: 2345, column: 40, scope: !1359)
+!1373 = !DILocation(line: 2346, column: 12, scope: !1359)
+!1374 = !DILocation(line: 2348, column: 25, scope: !1359)
+!1375 = !DILocation(line: 2349, column: 12, scope: !1359)
+!1376 = !DILocation(line: 2350, column: 25, scope: !1359)
+!1377 = !DILocation(line: 2352, column: 24, scope: !1359)
+!1378 = !DILocation(line: 2353, column: 17, scope: !1359)
+!1379 = !DILocation(line: 2355, column: 26, scope: !1359)
+!1380 = !DILocation(line: 2356, column: 31, scope: !1359)
+!1381 = !DILocation(line: 2358, column: 37, scope: !1359)
+!1382 = !DILocation(line: 2358, column: 32, scope: !1359)
+!1383 = !DILocation(line: 2359, column: 12, scope: !1359)
+!1384 = !DILocation(line: 2361, column: 35, scope: !1359)
+!1385 = !DILocation(line: 2362, column: 3, scope: !1359)
+!1386 = !DILocation(line: 2363, column: 20, scope: !1359)
+!1387 = !DILocation(line: 2364, column: 39, scope: !1359)
+!1388 = !DILocation(line: 2365, column: 40, scope: !1359)
+!1389 = !DILocation(line: 2366, column: 15, scope: !1359)
+!1390 = !DILocation(line: 2368, column: 38, scope: !1359)
+!1391 = !DILocation(line: 2368, column: 38, scope: !1359)
+!1392 = !DILocation(line: 2368, column: 8, scope: !1359)
+!1393 = !DILocation(line: 2369, column: 38, scope: !1359)
+!1394 = !DILocation(line: 2370, column: 10, scope: !1359)
+!1395 = distinct !DISubprogram(name: "kernel_59", scope: !5, file: !5, line: 2370, type: !11, scopeLine: 2370, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!1396 = !DILocation(line: 2372, column: 14, scope: !1395)
+!1397 = !DILocation(line: 2372, column: 22, scope: !1395)
+!1398 = !DILocation(line: 2373, column: 23, scope: !1395)
+!1399 = !DILocation(line: 2375, column: 26, scope: !1395)
+!1400 = !DILocation(line: 2376, column: 30, scope: !1395)
+!1401 = !DILocation(line: 2376, column: 25, scope: !1395)
+!1402 = !DILocation(line: 2377, column: 17, scope: !1395)
+!1403 = !DILocation(line: 2378, column: 22, scope: !1395)
+!1404 = !DILocation(line: 2379, column: 34, scope: !1395)
+!1405 = !DILocation(line: 2379, column: 7, scope: !1395)
+!1406 = !DILocation(line: 2380, column: 8, scope: !1395)
+!1407 = !DILocation(line: 2382, column: 7, scope: !1395)
+!1408 = !DILocation(line: 2383, column: 4, scope: !1395)
+!1409 = !DILocation(line: 2383, column: 40, scope: !1395)
+!1410 = !DILocation(line: 2384, column: 24, scope: !1395)
+!1411 = !DILocation(line: 2385, column: 7, scope: !1395)
+!1412 = distinct !DISubprogram(name: "kernel_60", scope: !6, file: !6, line: 2410, type: !11, scopeLine: 2410, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!1413 = !DILocation(line: 2410, column: 12, scope: !1412)
+!1414 = !DILocation(line: 2412, column: 9, scope: !1412)
+!1415 = !DILocation(line: 2413, column: 21, scope: !1412)
+!1416 = !DILocation(line: 2415, column: 24, scope: !1412)
+!1417 = !DILocation(line: 2415, column: 17, scope: !1412)
+!1418 = !DILocation(line: 2416, column: 22, scope: !1412)
+!1419 = !DILocation(line: 2417, column: 24, scope: !1412)
+!1420 = !DILocation(line: 2418, column: 13, scope: !1412)
+!1421 = !DILocation(line: 2419, column: 21, scope: !1412)
+!1422 = !DILocation(line: 2419, column: 4, scope: !1412)
+!1423 = !DILocation(line: 2420, column: 28, scope: !1412)
+!1424 = !DILocation(line: 2421, column: 14, scope: !1412)
+!1425 = !DILocation(line: 2422, column: 9, scope: !1412)
+!1426 = !DILocation(line: 2424, column: 25, scope: !1412)
+!1427 = !DILocation(line: 2425, column: 30, scope: !1412)
+!1428 = !DILocation(line: 2427, column: 38, scope: !1412)
+!1429 = !DILocation(line: 2428, column: 4, scope: !1412)
+!1430 = !DILocation(line: 2430, column: 21, scope: !1412)
+!1431 = !DILocation(line: 2432, column: 21, scope: !1412)
+!1432 = distinct !{!1432, !26}
+!1433 = !DILocation(line: 2434, column: 24, scope: !1412)
+!1434 = distinct !DISubprogram(name: "kernel_61", scope: !7, file: !7, line: 2450, type: !11, scopeLine: 2450, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!1435 = !DILocation(line: 2450, column: 25, scope: !1434)
+!1436 = !DILocation(line: 2451, column: 36, scope: !1434)
+!1437 = !DILocation(line: 2453, column: 7, scope: !1434)
+!1438 = !DILocation(line: 2454, column: 15, scope: !1434)
+!1439 = !DILocation(line: 2454, column: 17, scope: !1434)
+!1440 = !DILocation(line: 2454, column: 20, scope: !1434)
+!1441 = !DILocation(line: 2454, column: 30, scope: !1434)
+!1442 = !DILocation(line: 2455, column: 8, scope: !1434)
+!1443 = !DILocation(line: 2455, column: 22, scope: !1434)
+!1444 = !DILocation(line: 2457, column: 21, scope: !1434)
+!1445 = !DILocation(line: 2459, column: 28, scope: !1434)
+!1446 = !DILocation(line: 2461, column: 8, scope: !1434)
+!1447 = !DILocation(line: 2463, column: 34, scope: !1434)
+!1448 = !DILocation(line: 2465, column: 11, scope: !1434)
+!1449 = !DILocation(line: 2465, column: 10, scope: !1434)
+!1450 = !DILocation(line: 2466, column: 5, scope: !1434)
+!1451 = !DILocation(line: 2467, column: 18, scope: !1434)
+!1452 = !DILocation(line: 2468, column: 21, scope: !1434)
+!1453 = !DILocation(line: 2468, column: 26, scope: !1434)
+!1454 = !DILocation(line: 2468, column: 11, scope: !1434)
+!1455 = distinct !DISubprogram(name: "kernel_62", scope: !8, file: !8, line: 2490, type: !11, scopeLine: 2490, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!1456 = !DILocation(line: 2491, column: 4, scope: !1455)
+!1457 = !DILocation(line: 2492, column: 36, scope: !1455)
+!1458 = !DILocation(line: 2494, column: 7, scope: !1455)
+!1459 = !DILocation(line: 2495, column: 22, scope: !1455)
+!1460 = !DILocation(line: 2495, column: 27, scope: !1455)
+!1461 = !DILocation(line: 2496, column: 31, scope: !1455)
+!1462 = !DILocation(line: 2497, column: 20, scope: !1455)
+!1463 = !DILocation(line: 2497, column: 32, scope: !1455)
+!1464 = !DILocation(line: 2499, column: 20, scope: !1455)
+!1465 = !DILocation(line: 2500, column: 4, scope: !1455)
+!1466 = !DILocation(line: 2501, column: 3, scope: !1455)
+!1467 = !DILocation(line: 2502, column: 39, scope: !1455)
+!1468 = !DILocation(line: 2502, column: 21, scope: !1455)
+!1469 = !DILocation(line: 2503, column: 30, scope: !1455)
+!1470 = !DILocation(line: 2504, column: 28, scope: !1455)
+!1471 = !DILocation(line: 2505, column: 8, scope: !1455)
+!1472 = !DILocation(line: 2507, column: 30, scope: !1455)
+!1473 = !DILocation(line: 2508, column: 26, scope: !1455)
+!1474 = distinct !DISubprogram(name: "kernel_63", scope: !9, file: !9, line: 2530, type: !11, scopeLine: 2530, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!1475 = !DILocation(line: 2531, column: 37, scope: !1474)
+!1476 = !DILocation(line: 2531, column: 30, scope: !1474)
+!1477 = !DILocation(line: 2532, column: 28, scope: !1474)
+!1478 = !DILocation(line: 2533, column: 8, scope: !1474)
+!1479 = !DILocation(line: 2535, column: 31, scope: !1474)
+!1480 = !DILocation(line: 2536, column: 17, scope: !1474)
+!1481 = !DILocation(line: 2537, column: 26, scope: !1474)
+!1482 = !DILocation(line: 2537, column: 38, scope: !1474)
+!1483 = !DILocation(line: 2538, column: 19, scope: !1474)
+!1484 = !DILocation(line: 2540, column: 16, scope: !1474)
+!1485 = !DILocation(line: 2540, column: 32, scope: !1474)
+!1486 = !DILocation(line: 2541, column: 5, scope: !1474)
+!1487 = !DILocation(line: 2542, column: 16, scope: !1474)
+!1488 = !DILocation(line: 2544, column: 14, scope: !1474)
+!1489 = !DILocation(line: 2545, column: 18, scope: !1474)
+!1490 = !DILocation(line: 2546, column: 27, scope: !1474)
+!1491 = !DILocation(line: 2547, column: 25, scope: !1474)
+!1492 = !DILocation(line: 2547, column: 25, scope: !1474)
+!1493 = !DILocation(line: 2548, column: 16, scope: !1474)
+!1494 = !DILocation(line: 2549, column: 24, scope: !1474)
+!1495 = !DILocation(line: 2550, column: 38, scope: !1474)
+!1496 = !DILocation(line: 2551, column: 40, scope: !1474)
+!1497 = !DILocation(line: 2552, column: 10, scope: !1474)
+!1498 = !DILocation(line: 2554, column: 4, scope: !1474)
+!1499 = !DILocation(line: 2555, column: 25, scope: !1474)
+!1500 = !DILocation(line: 2555, column: 34, scope: !1474)
+!1501 = !DILocation(line: 2556, column: 11, scope: !1474)
+!1502 = !DILocation(line: 2556, column: 10, scope: !1474)
+!1503 = !DILocation(line: 2556, column: 25, scope: !1474)
+!1504 = distinct !DISubprogram(name: "kernel_64", scope: !2, file: !2, line: 2570, type: !11, scopeLine: 2570, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!1505 = !DILocation(line: 2571, column: 14, scope: !1504)
+!1506 = !DILocation(line: 2573, column: 11, scope: !1504)
+!1507 = !DILocation(line: 2574, column: 29, scope: !1504)
+!1508 = !DILocation(line: 2575, column: 11, scope: !1504)
+!1509 = !DILocation(line: 2577, column: 36, scope: !1504)
+!1510 = !DILocation(line: 2577, column: 15, scope: !1504)
+!1511 = !DILocation(line: 2578, column: 31, scope: !1504)
+!1512 = !DILocation(line: 2580, column: 30, scope: !1504)
+!1513 = !DILocation(line: 2581, column: 34, scope: !1504)
+!1514 = !DILocation(line: 2582, column: 4, scope: !1504)
+!1515 = !DILocation(line: 2584, column: 20, scope: !1504)
+!1516 = !DILocation(line: 2586, column: 36, scope: !1504)
+!1517 = !DILocation(line: 2587, column: 17, scope: !1504)
+!1518 = !DILocation(line: 2588, column: 17, scope: !1504)
+!1519 = !DILocation(line: 2590, column: 35, scope: !1504)
+!1520 = !DILocation(line: 2591, column: 7, scope: !1504)
+!1521 = !DILocation(line: 2592, column: 36, scope: !1504)
+!1522 = distinct !DISubprogram(name: "kernel_65", scope: !3, file: !3, line: 2610, type: !11, scopeLine: 2610, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!1523 = !DILocation(line: 2612, column: 23, scope: !1522)
+!1524 = !DILocation(line: 2613, column: 7, scope: !1522)
+!1525 = !DILocation(line: 2615, column: 27, scope: !1522)
+!1526 = !DILocation(line: 2617, column: 5, scope: !1522)
+!1527 = !DILocation(line: 2618, column: 13, scope: !1522)
+!1528 = !DILocation(line: 2619, column: 33, scope: !1522)
+!1529 = !DILocation(line: 2620, column: 7, scope: !1522)
+!1530 = !DILocation(line: 2621, column: 27, scope: !1522)
+!1531 = !DILocation(line: 2622, column: 26, scope: !1522)
+!1532 = !DILocation(line: 2622, column: 39, scope: !1522)
+!1533 = !DILocation(line: 2622, column: 16, scope: !1522)
+!1534 = !DILocation(line: 2624, column: 39, scope: !1522)
+!1535 = !DILocation(line: 2624, column: 40, scope: !1522)
+!1536 = !DILocation(line: 2624, column: 16, scope: !1522)
+!1537 = !DILocation(line: 2625, column: 12, scope: !1522)
+!1538 = !DILocation(line: 2626, column: 4, scope: !1522)
+!1539 = !DILocation(line: 2627, column: 18, scope: !1522)
+!1540 = !DILocation(line: 2628, column: 13, scope: !1522)
+!1541 = !DILocation(line: 2628, column: 3, scope: !1522)
+!1542 = distinct !{!1542, !26}
+!1543 = !DILocation(line: 2628, column: 37, scope: !1522)
+!1544 = distinct !DISubprogram(name: "kernel_66", scope: !4, file: !4, line: 2650, type: !11, scopeLine: 2650, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!1545 = !DILocation(line: 2651, column: 5, scope: !1544)
+!1546 = !DILocation(line: 2653, column: 32, scope: !1544)
+!1547 = !DILocation(line: 2653, column: 13, scope: !1544)
+!1548 = !DILocation(line: 2654, column: 40, scope: !1544)
+!1549 = !DILocation(line: 2656, column: 25, scope: !1544)
+!1550 = !DILocation(line: 2656, column: 27, scope: !1544)
+!1551 = !DILocation(line: 2658, column: 11, scope: !1544)
+!1552 = !DILocation(line: 2660, column: 40, scope: !1544)
+!1553 = !DILocation(line: 2662, column: 11, scope: !1544)
+!1554 = !DILocation(line: 2662, column: 30, scope: !1544)
+!1555 = !DILocation(line: 2662, column: 6, scope: !1544)
+!1556 = !DILocation(line: 2664, column: 38, scope: !1544)
+!1557 = !DILocation(line: 2665, column: 33, scope: !1544)
+!1558 = !DILocation(line: 2665, column: 25, scope: !1544)
+!1559 = !DILocation(line: 2665, column: 7, scope: !1544)
+!1560 = !DILocation(line: 2665, column: 36, scope: !1544)
+!1561 = !DILocation(line: 2666, column: 25, scope: !1544)
+!1562 = !DILocation(line: 2667, column: 20, scope: !1544)
+!1563 = !DILocation(line: 2667, column: 14, scope: !1544)
+!1564 = !DILocation(line: 2667, column: 39, scope: !1544)
+!1565 = distinct !DISubprogram(name: "kernel_67", scope: !5, file: !5, line: 2690, type: !11, scopeLine: 2690, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!1566 = !DILocation(line: 2691, column: 6, scope: !1565)
+!1567 = !DILocation(line: 2691, column: 30, scope: !1565)
+!1568 = !DILocation(line: 2692, column: 40, scope: !1565)
+!1569 = !DILocation(line: 2694, column: 6, scope: !1565)
+!1570 = !DILocation(line: 2695, column: 38, scope: !1565)
+!1571 = !DILocation(line: 2697, column: 29, scope: !1565)
+!1572 = !DILocation(line: 2698, column: 26, scope: !1565)
+!1573 = !DILocation(line: 2699, column: 22, scope: !1565)
+!1574 = !DILocation(line: 2700, column: 38, scope: !1565)
+!1575 = !DILocation(line: 2701, column: 38, scope: !1565)
+!1576 = !DILocation(line: 2702, column: 28, scope: !1565)
+!1577 = !DILocation(line: 2702, column: 39, scope: !1565)
+!1578 = !DILocation(line: 2702, column: 15, scope: !1565)
+!1579 = !DILocation(line: 2703, column: 15, scope: !1565)
+!1580 = !DILocation(line: 2704, column: 38, scope: !1565)
+!1581 = !DILocation(line: 2706, column: 19, scope: !1565)
+!1582 = distinct !DISubprogram(name: "kernel_68", scope: !6, file: !6, line: 2730, type: !11, scopeLine: 2730, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!1583 = !DILocation(line: 2730, column: 19, scope: !1582)
+!1584 = !DILocation(line: 2730, column: 9, scope: !1582)
+!1585 = !DILocation(line: 2731, column: 40, scope: !1582)
+!1586 = !DILocation(line: 2731, column: 8, scope: !1582)
+!1587 = !DILocation(line: 2732, column: 16, scope: !1582)
+!1588 = !DILocation(line: 2734, column: 31, scope: !1582)
+!1589 = !DILocation(line: 2734, column: 33, scope: !1582)
+!1590 = !DILocation(line: 2735, column: 27, scope: !1582)
+!1591 = !DILocation(line: 2736, column: 39, scope: !1582)
+!1592 = !DILocation(line: 2737, column: 17, scope: !1582)
+!1593 = !DILocation(line: 2739, column: 18, scope: !1582)
+!1594 = !DILocation(line: 2739, column: 8, scope: !1582)
+!1595 = !DILocation(line: 2739, column: 29, scope: !1582)
+!1596 = !DILocation(line: 2739, column: 17, scope: !1582)
+!1597 = !DILocation(line: 2739, column: 25, scope: !1582)
+!1598 = !DILocation(line: 2741, column: 31, scope: !1582)
+!1599 = !DILocation(line: 2742, column: 9, scope: !1582)
+!1600 = !DILocation(line: 2742, column: 17, scope: !1582)
+!1601 = !DILocation(line: 2742, column: 3, scope: !1582)
+!1602 = !DILocation(line: 2743, column: 38, scope: !1582)
+!1603 = !DILocation(line: 2743, column: 39, scope: !1582)
+!1604 = !DILocation(line: 2744, column: 37, scope: !1582)
+!1605 = !DILocation(line: 2746, column: 33, scope: !1582)
+!1606 = !DILocation(line: 2747, column: 28, scope: !1582)
+!1607 = !DILocation(line: 2747, column: 11, scope: !1582)
+!1608 = !DILocation(line: 2749, column: 40, scope: !1582)
+!1609 = !DILocation(line: 2751, column: 10, scope: !1582)
+!1610 = !DILocation(line: 2752, column: 7, scope: !1582)
+!1611 = !DILocation(line: 2754, column: 38, scope: !1582)
+!1612 = !DILocation(line: 2756, column: 28, scope: !1582)
+!1613 = !DILocation(line: 2757, column: 37, scope: !1582)
+!1614 = !DILocation(line: 2757, column: 25, scope: !1582)
+!1615 = distinct !DISubprogram(name: "kernel_69", scope: !7, file: !7, line: 2770, type: !11, scopeLine: 2770, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!1616 = !DILocation(line: 2772, column: 10, scope: !1615)
+!1617 = !DILocation(line: 2773, column: 25, scope: !1615)
+!1618 = !DILocation(line: 2774, column: 8, scope: !1615)
+!1619 = !DILocation(line: 2774, column: 35, scope: !1615)
+!1620 = !DILocation(line: 2776, column: 35, scope: !1615)
+!1621 = !DILocation(line: 2777, column: 20, scope: !1615)
+!1622 = !DILocation(line: 2778, column: 36, scope: !1615)
+!1623 = !DILocation(line: 2778, column: 28, scope: !1615)
+!1624 = !DILocation(line: 2780, column: 13, scope: !1615)
+!1625 = !DILocation(line: 2782, column: 37, scope: !1615)
+!1626 = !DILocation(line: 2783, column: 11, scope: !1615)
+!1627 = !DILocation(line: 2785, column: 37, scope: !1615)
+!1628 = !DILocation(line: 2785, column: 9, scope: !1615)
+!1629 = !DILocation(line: 2785, column: 27, scope: !1615)
+!1630 = !DILocation(line: 2787, column: 36, scope: !1615)
+!1631 = !DILocation(line: 2789, column: 5, scope: !1615)
+!1632 = distinct !DISubprogram(name: "kernel_70", scope: !8, file: !8, line: 2810, type: !11, scopeLine: 2810, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!1633 = !DILocation(line: 2812, column: 5, scope: !1632)
+!1634 = !DILocation(line: 2812, column: 17, scope: !1632)
+!1635 = !DILocation(line: 2813, column: 12, scope: !1632)
+!1636 = !DILocation(line: 2814, column: 35, scope: !1632)
+!1637 = !DILocation(line: 2816, column: 6, scope: !1632)
+!1638 = !DILocation(line: 2817, column: 35, scope: !1632)
+!1639 = !DILocation(line: 2819, column: 29, scope: !1632)
+!1640 = !DILocation(line: 2821, column: 15, scope: !1632)
+!1641 = !DILocation(line: 2823, column: 25, scope: !1632)
+!1642 = !DILocation(line: 2824, column: 28, scope: !1632)
+!1643 = !DILocation(line: 2826, column: 20, scope: !1632)
+!1644 = !DILocation(line: 2828, column: 26, scope: !1632)
+!1645 = !DILocation(line: 2828, column: 40, scope: !1632)
+!1646 = !DILocation(line: 2830, column: 26, scope: !1632)
+!1647 = !DILocation(line: 2831, column: 5, scope: !1632)
+!1648 = !DILocation(line: 2832, column: 4, scope: !1632)
+!1649 = !DILocation(line: 2834, column: 29, scope: !1632)
+!1650 = !DILocation(line: 2835, column: 6, scope: !1632)
+!1651 = !DILocation(line: 2836, column: 11, scope: !1632)
+!1652 = distinct !{!1652, !26}
+!1653 = !DILocation(line: 2837, column: 25, scope: !1632)
+!1654 = distinct !DISubprogram(name: "kernel_71", scope: !9, file: !9, line: 2850, type: !11, scopeLine: 2850, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!1655 = !DILocation(line: 2851, column: 35, scope: !1654)
+!1656 = !DILocation(line: 2852, column: 7, scope: !1654)
+!1657 = !DILocation(line: 2853, column: 40, scope: !1654)
+!1658 = !DILocation(line: 2854, column: 3, scope: !1654)
+!1659 = !DILocation(line: 2856, column: 25, scope: !1654)
+!1660 = !DILocation(line: 2856, column: 22, scope: !1654)
+!1661 = !DILocation(line: 2858, column: 18, scope: !1654)
+!1662 = !DILocation(line: 2860, column: 38, scope: !1654)
+!1663 = !DILocation(line: 2861, column: 20, scope: !1654)
+!1664 = !DILocation(line: 2862, column: 10, scope: !1654)
+!1665 = !DILocation(line: 2864, column: 9, scope: !1654)
+!1666 = !DILocation(line: 2866, column: 22, scope: !1654)
+!1667 = !DILocation(line: 2867, column: 35, scope: !1654)
+!1668 = !DILocation(line: 2868, column: 22, scope: !1654)
+!1669 = !DILocation(line: 2869, column: 18, scope: !1654)
+!1670 = !DILocation(line: 2870, column: 23, scope: !1654)
+!1671 = !DILocation(line: 2870, column: 7, scope: !1654)
+!1672 = !DILocation(line: 2872, column: 14, scope: !1654)
+!1673 = !DILocation(line: 2873, column: 11, scope: !1654)
+!1674 = !DILocation(line: 2874, column: 9, scope: !1654)
+!1675 = distinct !DISubprogram(name: "kernel_72", scope: !2, file: !2, line: 2890, type: !11, scopeLine: 2890, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!1676 = !DILocation(line: 2890, column: 28, scope: !1675)
+!1677 = !DILocation(line: 2890, column: 24, scope: !1675)
+!1678 = !DILocation(line: 2891, column: 12, scope: !1675)
+!1679 = !DILocation(line: 2892, column: 23, scope: !1675)
+!1680 = !DILocation(line: 2893, column: 16, scope: !1675)
+!1681 = !DILocation(line: 2894, column: 35, scope: !1675)
+!1682 = !DILocation(line: 2896, column: 16, scope: !1675)
+!1683 = !DILocation(line: 2896, column: 14, scope: !1675)
+!1684 = !DILocation(line: 2897, column: 40, scope: !1675)
+!1685 = !DILocation(line: 2899, column: 9, scope: !1675)
+!1686 = !DILocation(line: 2901, column: 30, scope: !1675)
+!1687 = !DILocation(line: 2903, column: 39, scope: !1675)
+!1688 = !DILocation(line: 2903, column: 21, scope: !1675)
+!1689 = !DILocation(line: 2903, column: 20, scope: !1675)
+!1690 = !DILocation(line: 2904, column: 38, scope: !1675)
+!1691 = !DILocation(line: 2906, column: 10, scope: !1675)
+!1692 = distinct !DISubprogram(name: "kernel_73", scope: !3, file: !3, line: 2930, type: !11, scopeLine: 2930, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!1693 = !DILocation(line: 2931, column: 39, scope: !1692)
+!1694 = !DILocation(line: 2932, column: 24, scope: !1692)
+!1695 = !DILocation(line: 2933, column: 13, scope: !1692)
+!1696 = !DILocation(line: 2934, column: 19, scope: !1692)
+!1697 = !DILocation(line: 2934, column: 9, scope: !1692)
+!1698 = !DILocation(line: 2936, column: 7, scope: !1692)
+!1699 = !DILocation(line: 2937, column: 37, scope: !1692)
+!1700 = !DILocation(line: 2938, column: 5, scope: !1692)
+!1701 = !DILocation(line: 2940, column: 16, scope: !1692)
+!1702 = !DILocation(line: 2941, column: 8, scope: !1692)
+!1703 = !DILocation(line: 2943, column: 11, scope: !1692)
+!1704 = !DILocation(line: 2944, column: 12, scope: !1692)
+!1705 = !DILocation(line: 2946, column: 32, scope: !1692)
+!1706 = !DILocation(line: 2948, column: 11, scope: !1692)
+!1707 = !DILocation(line: 2950, column: 28, scope: !1692)
+!1708 = !DILocation(line: 2951, column: 12, scope: !1692)
+!1709 = !DILocation(line: 2952, column: 17, scope: !1692)
+!1710 = !DILocation(line: 2952, column: 28, scope: !1692)
+!1711 = !DILocation(line: 2953, column: 35, scope: !1692)
+!1712 = !DILocation(line: 2955, column: 37, scope: !1692)
+!1713 = !DILocation(line: 2957, column: 15, scope: !1692)
+!1714 = !DILocation(line: 2957, column: 32, scope: !1692)
+!1715 = !DILocation(line: 2959, column: 21, scope: !1692)
+!1716 = !DILocation(line: 2959, column: 40, scope: !1692)
+!1717 = !DILocation(line: 2960, column: 9, scope: !1692)
+!1718 = !DILocation(line: 2960, column: 8, scope: !1692)
+!1719 = !DILocation(line: 2960, column: 13, scope: !1692)
+!1720 = !DILocation(line: 2961, column: 17, scope: !1692)
+!1721 = !DILocation(line: 2961, column: 31, scope: !1692)
+!1722 = !DILocation(line: 2962, column: 18, scope: !1692)
+!1723 = !DILocation(line: 2962, column: 15, scope: !1692)
+!1724 = !DILocation(line: 2964, column: 35, scope: !1692)
+!1725 = !DILocation(line: 2965, column: 35, scope: !1692)
+!1726 = !DILocation(line: 2966, column: 25, scope: !1692)
+!1727 = !DILocation(line: 2967, column: 32, scope: !1692)
+!1728 = !DILocation(line: 2967, column: 15, scope: !1692)
+!1729 = !DILocation(line: 2967, column: 15, scope: !1692)
+!1730 = !DILocation(line: 2968, column: 3, scope: !1692)
+!1731 = !DILocation(line: 2969, column: 39, scope: !1692)
+!1732 = !DILocation(line: 2970, column: 22, scope: !1692)
+!1733 = !DILocation(line: 2971, column: 13, scope: !1692)
+!1734 = !DILocation(line: 2971, column: 11, scope: !1692)
+!1735 = !DILocation(line: 2971, column: 39, scope: !1692)
+!1736 = !DILocation(line: 2972, column: 3, scope: !1692)
+!1737 = distinct !DISubprogram(name: "kernel_74", scope: !4, file: !4, line: 2970, type: !11, scopeLine: 2970, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!1738 = !DILocation(line: 2972, column: 5, scope: !1737)
+!1739 = !DILocation(line: 2974, column: 16, scope: !1737)
+!1740 = !DILocation(line: 2974, column: 4, scope: !1737)
+!1741 = !DILocation(line: 2976, column: 4, scope: !1737)
+!1742 = !DILocation(line: 2978, column: 15, scope: !1737)
+!1743 = !DILocation(line: 2979, column: 14, scope: !1737)
+!1744 = !DILocation(line: 2981, column: 34, scope: !1737)
+!1745 = !DILocation(line: 2981, column: 39, scope: !1737)
+!1746 = !DILocation(line: 2983, column: 9, scope: !1737)
+!1747 = !DILocation(line: 2984, column: 4, scope: !1737)
+!1748 = !DILocation(line: 2984, column: 38, scope: !1737)
+!1749 = !DILocation(line: 2985, column: 40, scope: !1737)
+!1750 = !DILocation(line: 2986, column: 3, scope: !1737)
+!1751 = !DILocation(line: 2987, column: 39, scope: !1737)
+!1752 = !DILocation(line: 2988, column: 7, scope: !1737)
+!1753 = !DILocation(line: 2990, column: 18, scope: !1737)
+!1754 = !DILocation(line: 2991, column: 12, scope: !1737)
+!1755 = distinct !DISubprogram(name: "kernel_75", scope: !5, file: !5, line: 3010, type: !11, scopeLine: 3010, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!1756 = !DILocation(line: 3011, column: 23, scope: !1755)
+!1757 = !DILocation(line: 3012, column: 32, scope: !1755)
+!1758 = !DILocation(line: 3014, column: 16, scope: !1755)
+!1759 = !DILocation(line: 3014, column: 39, scope: !1755)
+!1760 = !DILocation(line: 3015, column: 28, scope: !1755)
+!1761 = !DILocation(line: 3016, column: 30, scope: !1755)
+!1762 = !DILocation(line: 3017, column: 13, scope: !1755)
+!1763 = !DILocation(line: 3019, column: 34, scope: !1755)
+!1764 = !DILocation(line: 3020, column: 11, scope: !1755)
+!1765 = !DILocation(line: 3020, column: 5, scope: !1755)
+!1766 = !DILocation(line: 3022, column: 24, scope: !1755)
+!1767 = !DILocation(line: 3022, column: 31, scope: !1755)
+!1768 = !DILocation(line: 3022, column: 4, scope: !1755)
+!1769 = !DILocation(line: 3023, column: 22, scope: !1755)
+!1770 = !DILocation(line: 3025, column: 12, scope: !1755)
+!1771 = !DILocation(line: 3027, column: 12, scope: !1755)
+!1772 = !DILocation(line: 3028, column: 34, scope: !1755)
+!1773 = !DILocation(line: 3029, column: 12, scope: !1755)
+!1774 = !DILocation(line: 3029, column: 22, scope: !1755)
+!1775 = distinct !{!1775, !26}
+!1776 = !DILocation(line: 3029, column: 12, scope: !1755)
+!1777 = distinct !DISubprogram(name: "kernel_76", scope: !6, file: !6, line: 3050, type: !11, scopeLine: 3050, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!1778 = !DILocation(line: 3052, column: 38, scope: !1777)
+!1779 = !DILocation(line: 3053, column: 16, scope: !1777)
+!1780 = !DILocation(line: 3055, column: 31, scope: !1777)
+!1781 = !DILocation(line: 3056, column: 20, scope: !1777)
+!1782 = !DILocation(line: 3057, column: 24, scope: !1777)
+!1783 = !DILocation(line: 3059, column: 9, scope: !1777)
+!1784 = !DILocation(line: 3059, column: 11, scope: !1777)
+!1785 = !DILocation(line: 3059, column: 10, scope: !1777)
+!1786 = !DILocation(line: 3061, column: 34, scope: !1777)
+!1787 = !DILocation(line: 3062, column: 32, scope: !1777)
+!1788 = !DILocation(line: 3063, column: 37, scope: !1777)
+!1789 = !DILocation(line: 3063, column: 33, scope: !1777)
+!1790 = !DILocation(line: 3065, column: 10, scope: !1777)
+!1791 = !DILocation(line: 3066, column: 13, scope: !1777)
+!1792 = !DILocation(line: 3066, column: 25, scope: !1777)
+!1793 = !DILocation(line: 3067, column: 34, scope: !1777)
+!1794 = !DILocation(line: 3069, column: 19, scope: !1777)
+!1795 = !DILocation(line: 3071, column: 38, scope: !1777)
+!1796 = !DILocation(line: 3071, column: 15, scope: !1777)
+!1797 = !DILocation(line: 3072, column: 36, scope: !1777)
+!1798 = distinct !DISubprogram(name: "kernel_77", scope: !7, file: !7, line: 3090, type: !11, scopeLine: 3090, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!1799 = !DILocation(line: 3091, column: 39, scope: !1798)
+!1800 = !DILocation(line: 3092, column: 14, scope: !1798)
+!1801 = !DILocation(line: 3093, column: 38, scope: !1798)
+!1802 = !DILocation(line: 3093, column: 16, scope: !1798)
+!1803 = !DILocation(line: 3093, column: 30, scope: !1798)
+!1804 = !DILocation(line: 3094, column: 37, scope: !1798)
+!1805 = !DILocation(line: 3095, column: 34, scope: !1798)
+!1806 = !DILocation(line: 3097, column: 21, scope: !1798)
+!1807 = !DILocation(line: 3099, column: 26, scope: !1798)
+!1808 = !DILocation(line: 3101, column: 40, scope: !1798)
+!1809 = !DILocation(line: 3102, column: 33, scope: !1798)
+!1810 = !DILocation(line: 3102, column: 32, scope: !1798)
+!1811 = !DILocation(line: 3102, column: 8, scope: !1798)
+!1812 = !DILocation(line: 3104, column: 38, scope: !1798)
+!1813 = distinct !DISubprogram(name: "kernel_78", scope: !8, file: !8, line: 3130, type: !11, scopeLine: 3130, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!1814 = !DILocation(line: 3130, column: 17, scope: !1813)
+!1815 = !DILocation(line: 3131, column: 9, scope: !1813)
+!1816 = !DILocation(line: 3131, column: 18, scope: !1813)
+!1817 = !DILocation(line: 3133, column: 34, scope: !1813)
+!1818 = !DILocation(line: 3133, column: 8, scope: !1813)
+!1819 = !DILocation(line: 3133, column: 9, scope: !1813)
+!1820 = !DILocation(line: 3134, column: 40, scope: !1813)
+!1821 = !DILocation(line: 3135, column: 9, scope: !1813)
+!1822 = !DILocation(line: 3135, column: 5, scope: !1813)
+!1823 = !DILocation(line: 3136, column: 18, scope: !1813)
+!1824 = !DILocation(line: 3138, column: 26, scope: !1813)
+!1825 = !DILocation(line: 3139, column: 7, scope: !1813)
+!1826 = !DILocation(line: 3141, column: 40, scope: !1813)
+!1827 = !DILocation(line: 3142, column: 26, scope: !1813)
+!1828 = !DILocation(line: 3143, column: 35, scope: !1813)
+!1829 = !DILocation(line: 3144, column: 22, scope: !1813)
+!1830 = !DILocation(line: 3144, column: 15, scope: !1813)
+!1831 = !DILocation(line: 3145, column: 10, scope: !1813)
+!1832 = !DILocation(line: 3145, column: 3, scope: !1813)
+!1833 = !DILocation(line: 3147, column: 26, scope: !1813)
+!1834 = !DILocation(line: 3148, column: 5, scope: !1813)
+!1835 = !DILocation(line: 3149, column: 4, scope: !1813)
+!1836 = !DILocation(line: 3151, column: 35, scope: !1813)
+!1837 = !DILocation(line: 3152, column: 12, scope: !1813)
+!1838 = !DILocation(line: 3152, column: 39, scope: !1813)
+!1839 = !DILocation(line: 3154, column: 22, scope: !1813)
+!1840 = !DILocation(line: 3154, column: 3, scope: !1813)
+!1841 = !DILocation(line: 3156, column: 10, scope: !1813)
+!1842 = !DILocation(line: 3156, column: 10, scope: !1813)
+!1843 = !DILocation(line: 3157, column: 21, scope: !1813)
+!1844 = !DILocation(line: 3158, column: 8, scope: !1813)
+!1845 = !DILocation(line: 3158, column: 3, scope: !1813)
+!1846 = !DILocation(line: 3158, column: 31, scope: !1813)
+!1847 = !DILocation(line: 3160, column: 10, scope: !1813)
+!1848 = !DILocation(line: 3161, column: 36, scope: !1813)
+!1849 = !DILocation(line: 3161, column: 3, scope: !1813)
+!1850 = !DILocation(line: 3161, column: 38, scope: !1813)
+!1851 = !DILocation(line: 3161, column: 40, scope: !1813)
+!1852 = distinct !DISubprogram(name: "kernel_79", scope: !9, file: !9, line: 3170, type: !11, scopeLine: 3170, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!1853 = !DILocation(line: 3171, column: 23, scope: !1852)
+!1854 = !DILocation(line: 3171, column: 3, scope: !1852)
+!1855 = !DILocation(line: 3171, column: 35, scope: !1852)
+!1856 = !DILocation(line: 3172, column: 12, scope: !1852)
+!1857 = !DILocation(line: 3173, column: 29, scope: !1852)
+!1858 = !DILocation(line: 3175, column: 15, scope: !1852)
+!1859 = !DILocation(line: 3176, column: 17, scope: !1852)
+!1860 = !DILocation(line: 3177, column: 20, scope: !1852)
+!1861 = !DILocation(line: 3179, column: 4, scope: !1852)
+!1862 = !DILocation(line: 3179, column: 28, scope: !1852)
+!1863 = !DILocation(line: 3180, column: 16, scope: !1852)
+!1864 = !DILocation(line: 3181, column: 6, scope: !1852)
+!1865 = !DILocation(line: 3182, column: 13, scope: !1852)
+!1866 = !DILocation(line: 3184, column: 10, scope: !1852)
+!1867 = !DILocation(line: 3185, column: 9, scope: !1852)
+!1868 = !DILocation(line: 3186, column: 31, scope: !1852)
+!1869 = distinct !DISubprogram(name: "kernel_80", scope: !2, file: !2, line: 3210, type: !11, scopeLine: 3210, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!1870 = !DILocation(line: 3212, column: 40, scope: !1869)
+!1871 = !DILocation(line: 3212, column: 40, scope: !1869)
+!1872 = !DILocation(line: 3214, column: 36, scope: !1869)
+!1873 = !DILocation(line: 3216, column: 8, scope: !1869)
+!1874 = !DILocation(line: 3218, column: 36, scope: !1869)
+!1875 = !DILocation(line: 3220, column: 23, scope: !1869)
+!1876 = !DILocation(line: 3222, column: 9, scope: !1869)
+!1877 = !DILocation(line: 3222, column: 36, scope: !1869)
+!1878 = !DILocation(line: 3223, column: 25, scope: !1869)
+!1879 = !DILocation(line: 3223, column: 17, scope: !1869)
+!1880 = !DILocation(line: 3225, column: 9, scope: !1869)
+!1881 = !DILocation(line: 3227, column: 8, scope: !1869)
+!1882 = !DILocation(line: 3227, column: 32, scope: !1869)
+!1883 = !DILocation(line: 3227, column: 21, scope: !1869)
+!1884 = !DILocation(line: 3228, column: 22, scope: !1869)
+!1885 = !DILocation(line: 3229, column: 21, scope: !1869)
+!1886 = !DILocation(line: 3230, column: 27, scope: !1869)
+!1887 = !DILocation(line: 3231, column: 5, scope: !1869)
+!1888 = !DILocation(line: 3231, column: 40, scope: !1869)
+!1889 = distinct !{!1889, !26}
+!1890 = !DILocation(line: 3232, column: 39, scope: !1869)
+!1891 = distinct !DISubprogram(name: "kernel_81", scope: !3, file: !3, line: 3250, type: !11, scopeLine: 3250, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!1892 = !DILocation(line: 3250, column: 17, scope: !1891)
+!1893 = !DILocation(line: 3251, column: 7, scope: !1891)
+!1894 = !DILocation(line: 3253, column: 29, scope: !1891)
+!1895 = !DILocation(line: 3254, column: 27, scope: !1891)
+!1896 = !DILocation(line: 3256, column: 25, scope: !1891)
+!1897 = !DILocation(line: 3257, column: 8, scope: !1891)
+!1898 = !DILocation(line: 3259, column: 12, scope: !1891)
+!1899 = !DILocation(line: 3260, column: 13, scope: !1891)
+!1900 = !DILocation(line: 3261, column: 11, scope: !1891)
+!1901 = !DILocation(line: 3262, column: 5, scope: !1891)
+!1902 = !DILocation(line: 3263, column: 13, scope: !1891)
+!1903 = !DILocation(line: 3265, column: 12, scope: !1891)
+!1904 = !DILocation(line: 3267, column: 40, scope: !1891)
+!1905 = !DILocation(line: 3268, column: 27, scope: !1891)
+!1906 = !DILocation(line: 3268, column: 8, scope: !1891)
+!1907 = !DILocation(line: 3270, column: 31, scope: !1891)
+!1908 = !DILocation(line: 3271, column: 24, scope: !1891)
+!1909 = !DILocation(line: 3271, column: 15, scope: !1891)
+!1910 = !DILocation(line: 3271, column: 12, scope: !1891)
+!1911 = !DILocation(line: 3272, column: 18, scope: !1891)
+!1912 = distinct !DISubprogram(name: "kernel_82", scope: !4, file: !4, line: 3290, type: !11, scopeLine: 3290, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!1913 = !DILocation(line: 3291, column: 11, scope: !1912)
+!1914 = !DILocation(line: 3292, column: 35, scope: !1912)
+!1915 = !DILocation(line: 3292, column: 35, scope: !1912)
+!1916 = !DILocation(line: 3293, column: 20, scope: !1912)
+!1917 = !DILocation(line: 3295, column: 29, scope: !1912)
+!1918 = !DILocation(line: 3296, column: 14, scope: !1912)
+!1919 = !DILocation(line: 3297, column: 26, scope: !1912)
+!1920 = !DILocation(line: 3299, column: 33, scope: !1912)
+!1921 = !DILocation(line: 3301, column: 4, scope: !1912)
+!1922 = !DILocation(line: 3302, column: 34, scope: !1912)
+!1923 = !DILocation(line: 3303, column: 33, scope: !1912)
+!1924 = !DILocation(line: 3304, column: 21, scope: !1912)
+!1925 = !DILocation(line: 3305, column: 14, scope: !1912)
+!1926 = !DILocation(line: 3305, column: 8, scope: !1912)
+!1927 = !DILocation(line: 3306, column: 8, scope: !1912)
+!1928 = !DILocation(line: 3308, column: 7, scope: !1912)
+!1929 = distinct !DISubprogram(name: "kernel_83", scope: !5, file: !5, line: 3330, type: !11, scopeLine: 3330, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!1930 = !DILocation(line: 3332, column: 13, scope: !1929)
+!1931 = !DILocation(line: 3334, column: 6, scope: !1929)
+!1932 = !DILocation(line: 3335, column: 26, scope: !1929)
+!1933 = !DILocation(line: 3336, column: 5, scope: !1929)
+!1934 = !DILocation(line: 3338, column: 39, scope: !1929)
+!1935 = !DILocation(line: 3340, column: 21, scope: !1929)
+!1936 = !DILocation(line: 3340, column: 15, scope: !1929)
+!1937 = !DILocation(line: 3340, column: 19, scope: !1929)
+!1938 = !DILocation(line: 3340, column: 40, scope: !1929)
+!1939 = !DILocation(line: 3341, column: 12, scope: !1929)
+!1940 = !DILocation(line: 3342, column: 10, scope: !1929)
+!1941 = !DILocation(line: 3343, column: 27, scope: !1929)
+!1942 = !DILocation(line: 3343, column: 18, scope: !1929)
+!1943 = !DILocation(line: 3344, column: 3, scope: !1929)
+!1944 = !DILocation(line: 3346, column: 23, scope: !1929)
+!1945 = !DILocation(line: 3346, column: 28, scope: !1929)
+!1946 = !DILocation(line: 3347, column: 27, scope: !1929)
+!1947 = !DILocation(line: 3348, column: 7, scope: !1929)
+!1948 = !DILocation(line: 3348, column: 12, scope: !1929)
+!1949 = !DILocation(line: 3350, column: 6, scope: !1929)
+!1950 = !DILocation(line: 3350, column: 37, scope: !1929)
+!1951 = !DILocation(line: 3351, column: 11, scope: !1929)
+!1952 = !DILocation(line: 3353, column: 4, scope: !1929)
+!1953 = !DILocation(line: 3354, column: 4, scope: !1929)
+!1954 = !DILocation(line: 3355, column: 11, scope: !1929)
+!1955 = !DILocation(line: 3357, column: 24, scope: !1929)
+!1956 = !DILocation(line: 3358, column: 29, scope: !1929)
+!1957 = !DILocation(line: 3359, column: 30, scope: !1929)
+!1958 = !DILocation(line: 3359, column: 3, scope: !1929)
+!1959 = !DILocation(line: 3360, column: 16, scope: !1929)
+!1960 = !DILocation(line: 3360, column: 31, scope: !1929)
+!1961 = !DILocation(line: 3361, column: 34, scope: !1929)
+!1962 = !DILocation(line: 3363, column: 31, scope: !1929)
+!1963 = !DILocation(line: 3364, column: 32, scope: !1929)
+!1964 = !DILocation(line: 3364, column: 39, scope: !1929)
+!1965 = !DILocation(line: 3365, column: 29, scope: !1929)
+!1966 = !DILocation(line: 3366, column: 36, scope: !1929)
+!1967 = !DILocation(line: 3367, column: 20, scope: !1929)
+!1968 = !DILocation(line: 3367, column: 5, scope: !1929)
+!1969 = !DILocation(line: 3368, column: 18, scope: !1929)
+!1970 = !DILocation(line: 3369, column: 39, scope: !1929)
+!1971 = !DILocation(line: 3370, column: 9, scope: !1929)
+!1972 = !DILocation(line: 3371, column: 38, scope: !1929)
+!1973 = !DILocation(line: 3372, column: 25, scope: !1929)
+!1974 = !DILocation(line: 3373, column: 10, scope: !1929)
+!1975 = !DILocation(line: 3374, column: 33, scope: !1929)
+!1976 = !DILocation(line: 3376, column: 19, scope: !1929)
+!1977 = !DILocation(line: 3376, column: 9, scope: !1929)
+!1978 = !DILocation(line: 3378, column: 38, scope: !1929)
+!1979 = !DILocation(line: 3380, column: 7, scope: !1929)
+!1980 = distinct !DISubprogram(name: "kernel_84", scope: !6, file: !6, line: 3370, type: !11, scopeLine: 3370, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!1981 = !DILocation(line: 3372, column: 20, scope: !1980)
+!1982 = !DILocation(line: 3373, column: 26, scope: !1980)
+!1983 = !DILocation(line: 3374, column: 31, scope: !1980)
+!1984 = !DILocation(line: 3376, column: 11, scope: !1980)
+!1985 = !DILocation(line: 3377, column: 9, scope: !1980)
+!1986 = !DILocation(line: 3378, column: 30, scope: !1980)
+!1987 = !DILocation(line: 3379, column: 6, scope: !1980)
+!1988 = !DILocation(line: 3380, column: 40, scope: !1980)
+!1989 = !DILocation(line: 3381, column: 37, scope: !1980)
+!1990 = !DILocation(line: 3382, column: 26, scope: !1980)
+!1991 = !DILocation(line: 3383, column: 7, scope: !1980)
+!1992 = !DILocation(line: 3383, column: 35, scope: !1980)
+!1993 = !DILocation(line: 3384, column: 29, scope: !1980)
+!1994 = !DILocation(line: 3386, column: 15, scope: !1980)
+!1995 = !DILocation(line: 3387, column: 37, scope: !1980)
+!1996 = !DILocation(line: 3388, column: 13, scope: !1980)
+!1997 = !DILocation(line: 3390, column: 19, scope: !1980)
+!1998 = distinct !DISubprogram(name: "kernel_85", scope: !7, file: !7, line: 3410, type: !11, scopeLine: 3410, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!1999 = !DILocation(line: 3410, column: 37, scope: !1998)
+!2000 = !DILocation(line: 3410, column: 32, scope: !1998)
+!2001 = !DILocation(line: 3411, column: 38, scope: !1998)
+!2002 = !DILocation(line: 3412, column: 37, scope: !1998)
+!2003 = !DILocation(line: 3413, column: 3, scope: !1998)
+!2004 = !DILocation(line: 3414, column: 28, scope: !1998)
+!2005 = !DILocation(line: 3414, column: 23, scope: !1998)
+!2006 = !DILocation(line: 3415, column: 35, scope: !1998)
+!2007 = !DILocation(line: 3417, column: 23, scope: !1998)
+!2008 = !DILocation(line: 3417, column: 30, scope: !1998)
+!2009 = !DILocation(line: 3418, column: 27, scope: !1998)
+!2010 = !DILocation(line: 3420, column: 29, scope: !1998)
+!2011 = !DILocation(line: 3421, column: 7, scope: !1998)
+!2012 = !DILocation(line: 3423, column: 39, scope: !1998)
+!2013 = !DILocation(line: 3424, column: 17, scope: !1998)
+!2014 = !DILocation(line: 3426, column: 28, scope: !1998)
+!2015 = !DILocation(line: 3427, column: 3, scope: !1998)
+!2016 = !DILocation(line: 3428, column: 37, scope: !1998)
+!2017 = !DILocation(line: 3428, column: 38, scope: !1998)
+!2018 = distinct !{!2018, !26}
+!2019 = !DILocation(line: 3430, column: 32, scope: !1998)
+!2020 = distinct !DISubprogram(name: "kernel_86", scope: !8, file: !8, line: 3450, type: !11, scopeLine: 3450, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!2021 = !DILocation(line: 3450, column: 32, scope: !2020)
+!2022 = !DILocation(line: 3452, column: 11, scope: !2020)
+!2023 = !DILocation(line: 3453, column: 33, scope: !2020)
+!2024 = !DILocation(line: 3454, column: 9, scope: !2020)
+!2025 = !DILocation(line: 3456, column: 10, scope: !2020)
+!2026 = !DILocation(line: 3457, column: 14, scope: !2020)
+!2027 = !DILocation(line: 3458, column: 20, scope: !2020)
+!2028 = !DILocation(line: 3459, column: 3, scope: !2020)
+!2029 = !DILocation(line: 3460, column: 30, scope: !2020)
+!2030 = !DILocation(line: 3461, column: 40, scope: !2020)
+!2031 = !DILocation(line: 3462, column: 17, scope: !2020)
+!2032 = !DILocation(line: 3463, column: 30, scope: !2020)
+!2033 = !DILocation(line: 3463, column: 5, scope: !2020)
+!2034 = !DILocation(line: 3464, column: 6, scope: !2020)
+!2035 = !DILocation(line: 3466, column: 14, scope: !2020)
+!2036 = !DILocation(line: 3467, column: 15, scope: !2020)
+!2037 = !DILocation(line: 3469, column: 9, scope: !2020)
+!2038 = !DILocation(line: 3469, column: 37, scope: !2020)
+!2039 = !DILocation(line: 3470, column: 29, scope: !2020)
+!2040 = !DILocation(line: 3470, column: 40, scope: !2020)
+!2041 = distinct !DISubprogram(name: "kernel_87", scope: !9, file: !9, line: 3490, type: !11, scopeLine: 3490, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!2042 = !DILocation(line: 3492, column: 22, scope: !2041)
+!2043 = !DILocation(line: 3493, column: 4, scope: !2041)
+!2044 = !DILocation(line: 3495, column: 28, scope: !2041)
+!2045 = !DILocation(line: 3496, column: 7, scope: !2041)
+!2046 = !DILocation(line: 3497, column: 4, scope: !2041)
+!2047 = !DILocation(line: 3498, column: 15, scope: !2041)
+!2048 = !DILocation(line: 3498, column: 18, scope: !2041)
+!2049 = !DILocation(line: 3498, column: 5, scope: !2041)
+!2050 = !DILocation(line: 3498, column: 13, scope: !2041)
+!2051 = !DILocation(line: 3499, column: 28, scope: !2041)
+!2052 = !DILocation(line: 3500, column: 32, scope: !2041)
+!2053 = !DILocation(line: 3501, column: 20, scope: !2041)
+!2054 = !DILocation(line: 3503, column: 20, scope: !2041)
+!2055 = !DILocation(line: 3505, column: 32, scope: !2041)
+!2056 = distinct !DISubprogram(name: "kernel_88", scope: !2, file: !2, line: 3530, type: !11, scopeLine: 3530, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!2057 = !DILocation(line: 3532, column: 6, scope: !2056)
+!2058 = !DILocation(line: 3532, column: 26, scope: !2056)
+!2059 = !DILocation(line: 3534, column: 5, scope: !2056)
+!2060 = !DILocation(line: 3535, column: 37, scope: !2056)
+!2061 = !DILocation(line: 3537, column: 20, scope: !2056)
+!2062 = !DILocation(line: 3538, column: 35, scope: !2056)
+!2063 = !DILocation(line: 3539, column: 7, scope: !2056)
+!2064 = !DILocation(line: 3541, column: 13, scope: !2056)
+!2065 = !DILocation(line: 3541, column: 8, scope: !2056)
+!2066 = !DILocation(line: 3541, column: 7, scope: !2056)
+!2067 = !DILocation(line: 3542, column: 5, scope: !2056)
+!2068 = !DILocation(line: 3543, column: 14, scope: !2056)
+!2069 = !DILocation(line: 3545, column: 20, scope: !2056)
+!2070 = !DILocation(line: 3545, column: 17, scope: !2056)
+!2071 = !DILocation(line: 3547, column: 27, scope: !2056)
+!2072 = !DILocation(line: 3547, column: 35, scope: !2056)
+!2073 = !DILocation(line: 3549, column: 26, scope: !2056)
+!2074 = !DILocation(line: 3550, column: 4, scope: !2056)
+!2075 = !DILocation(line: 3551, column: 5, scope: !2056)
+!2076 = !DILocation(line: 3552, column: 19, scope: !2056)
+!2077 = !DILocation(line: 3553, column: 18, scope: !2056)
+!2078 = !DILocation(line: 3553, column: 9, scope: !2056)
+!2079 = !DILocation(line: 3555, column: 10, scope: !2056)
+!2080 = !DILocation(line: 3556, column: 38, scope: !2056)
+!2081 = !DILocation(line: 3558, column: 23, scope: !2056)
+!2082 = !DILocation(line: 3560, column: 15, scope: !2056)
+!2083 = distinct !DISubprogram(name: "kernel_89", scope: !3, file: !3, line: 3570, type: !11, scopeLine: 3570, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!2084 = !DILocation(line: 3571, column: 16, scope: !2083)
+!2085 = !DILocation(line: 3573, column: 8, scope: !2083)
+!2086 = !DILocation(line: 3574, column: 35, scope: !2083)
+!2087 = !DILocation(line: 3575, column: 3, scope: !2083)
+!2088 = !DILocation(line: 3576, column: 28, scope: !2083)
+!2089 = !DILocation(line: 3577, column: 12, scope: !2083)
+!2090 = !DILocation(line: 3577, column: 37, scope: !2083)
+!2091 = !DILocation(line: 3578, column: 8, scope: !2083)
+!2092 = !DILocation(line: 3578, column: 7, scope: !2083)
+!2093 = !DILocation(line: 3579, column: 24, scope: !2083)
+!2094 = !DILocation(line: 3580, column: 36, scope: !2083)
+!2095 = !DILocation(line: 3582, column: 26, scope: !2083)
+!2096 = !DILocation(line: 3583, column: 13, scope: !2083)
+!2097 = !DILocation(line: 3585, column: 14, scope: !2083)
+!2098 = !DILocation(line: 3585, column: 34, scope: !2083)
+!2099 = !DILocation(line: 3585, column: 34, scope: !2083)
+!2100 = distinct !DISubprogram(name: "kernel_90", scope: !4, file: !4, line: 3610, type: !11, scopeLine: 3610, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!2101 = !DILocation(line: 3611, column: 12, scope: !2100)
+!2102 = !DILocation(line: 3611, column: 34, scope: !2100)
+!2103 = !DILocation(line: 3612, column: 26, scope: !2100)
+!2104 = !DILocation(line: 3613, column: 23, scope: !2100)
+!2105 = !DILocation(line: 3614, column: 28, scope: !2100)
+!2106 = !DILocation(line: 3614, column: 12, scope: !2100)
+!2107 = !DILocation(line: 3615, column: 32, scope: !2100)
+!2108 = !DILocation(line: 3616, column: 10, scope: !2100)
+!2109 = !DILocation(line: 3616, column: 35, scope: !2100)
+!2110 = !DILocation(line: 3616, column: 35, scope: !2100)
+!2111 = !DILocation(line: 3617, column: 4, scope: !2100)
+!2112 = !DILocation(line: 3618, column: 17, scope: !2100)
+!2113 = !DILocation(line: 3620, column: 14, scope: !2100)
+!2114 = !DILocation(line: 3621, column: 33, scope: !2100)
+!2115 = !DILocation(line: 3622, column: 16, scope: !2100)
+!2116 = !DILocation(line: 3624, column: 29, scope: !2100)
+!2117 = !DILocation(line: 3625, column: 36, scope: !2100)
+!2118 = !DILocation(line: 3625, column: 23, scope: !2100)
+!2119 = !DILocation(line: 3626, column: 18, scope: !2100)
+!2120 = distinct !{!2120, !26}
+!2121 = !DILocation(line: 3627, column: 20, scope: !2100)
+!2122 = distinct !DISubprogram(name: "kernel_91", scope: !5, file: !5, line: 3650, type: !11, scopeLine: 3650, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!2123 = !DILocation(line: 3650, column: 26, scope: !2122)
+!2124 = !DILocation(line: 3652, column: 5, scope: !2122)
+!2125 = !DILocation(line: 3654, column: 31, scope: !2122)
+!2126 = !DILocation(line: 3654, column: 40, scope: !2122)
+!2127 = !DILocation(line: 3655, column: 13, scope: !2122)
+!2128 = !DILocation(line: 3657, column: 36, scope: !2122)
+!2129 = !DILocation(line: 3657, column: 5, scope: !2122)
+!2130 = !DILocation(line: 3659, column: 3, scope: !2122)
+!2131 = !DILocation(line: 3660, column: 31, scope: !2122)
+!2132 = !DILocation(line: 3661, column: 3, scope: !2122)
+!2133 = !DILocation(line: 3662, column: 5, scope: !2122)
+!2134 = !DILocation(line: 3664, column: 26, scope: !2122)
+!2135 = !DILocation(line: 3664, column: 26, scope: !2122)
+!2136 = !DILocation(line: 3665, column: 11, scope: !2122)
+!2137 = !DILocation(line: 3666, column: 31, scope: !2122)
+!2138 = !DILocation(line: 3667, column: 8, scope: !2122)
+!2139 = !DILocation(line: 3669, column: 25, scope: !2122)
+!2140 = !DILocation(line: 3671, column: 4, scope: !2122)
+!2141 = !DILocation(line: 3671, column: 15, scope: !2122)
+!2142 = !DILocation(line: 3673, column: 36, scope: !2122)
+!2143 = distinct !DISubprogram(name: "kernel_92", scope: !6, file: !6, line: 3690, type: !11, scopeLine: 3690, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!2144 = !DILocation(line: 3691, column: 23, scope: !2143)
+!2145 = !DILocation(line: 3693, column: 18, scope: !2143)
+!2146 = !DILocation(line: 3694, column: 33, scope: !2143)
+!2147 = !DILocation(line: 3695, column: 28, scope: !2143)
+!2148 = !DILocation(line: 3696, column: 31, scope: !2143)
+!2149 = !DILocation(line: 3697, column: 5, scope: !2143)
+!2150 = !DILocation(line: 3697, column: 13, scope: !2143)
+!2151 = !DILocation(line: 3698, column: 33, scope: !2143)
+!2152 = !DILocation(line: 3700, column: 38, scope: !2143)
+!2153 = !DILocation(line: 3700, column: 23, scope: !2143)
+!2154 = !DILocation(line: 3701, column: 8, scope: !2143)
+!2155 = !DILocation(line: 3702, column: 23, scope: !2143)
+!2156 = distinct !DISubprogram(name: "kernel_93", scope: !7, file: !7, line: 3730, type: !11, scopeLine: 3730, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!2157 = !DILocation(line: 3732, column: 22, scope: !2156)
+!2158 = !DILocation(line: 3733, column: 10, scope: !2156)
+!2159 = !DILocation(line: 3734, column: 8, scope: !2156)
+!2160 = !DILocation(line: 3735, column: 20, scope: !2156)
+!2161 = !DILocation(line: 3736, column: 36, scope: !2156)
+!2162 = !DILocation(line: 3737, column: 39, scope: !2156)
+!2163 = !DILocation(line: 3738, column: 29, scope: !2156)
+!2164 = !DILocation(line: 3740, column: 28, scope: !2156)
+!2165 = !DILocation(line: 3740, column: 37, scope: !2156)
+!2166 = !DILocation(line: 3742, column: 30, scope: !2156)
+!2167 = !DILocation(line: 3742, column: 30, scope: !2156)
+!2168 = !DILocation(line: 3743, column: 32, scope: !2156)
+!2169 = !DILocation(line: 3744, column: 33, scope: !2156)
+!2170 = !DILocation(line: 3745, column: 39, scope: !2156)
+!2171 = !DILocation(line: 3747, column: 32, scope: !2156)
+!2172 = !DILocation(line: 3749, column: 25, scope: !2156)
+!2173 = !DILocation(line: 3749, column: 17, scope: !2156)
+!2174 = !DILocation(line: 3750, column: 15, scope: !2156)
+!2175 = !DILocation(line: 3750, column: 39, scope: !2156)
+!2176 = !DILocation(line: 3751, column: 26, scope: !2156)
+!2177 = !DILocation(line: 3751, column: 11, scope: !2156)
+!2178 = !DILocation(line: 3752, column: 22, scope: !2156)
+!2179 = !DILocation(line: 3753, column: 25, scope: !2156)
+!2180 = !DILocation(line: 3755, column: 16, scope: !2156)
+!2181 = !DILocation(line: 3756, column: 18, scope: !2156)
+!2182 = !DILocation(line: 3756, column: 34, scope: !2156)
+!2183 = !DILocation(line: 3756, column: 32, scope: !2156)
+!2184 = !DILocation(line: 3758, column: 8, scope: !2156)
+!2185 = !DILocation(line: 3759, column: 30, scope: !2156)
+!2186 = !DILocation(line: 3761, column: 7, scope: !2156)
+!2187 = !DILocation(line: 3763, column: 27, scope: !2156)
+!2188 = !DILocation(line: 3764, column: 10, scope: !2156)
+!2189 = distinct !DISubprogram(name: "kernel_94", scope: !8, file: !8, line: 3770, type: !11, scopeLine: 3770, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!2190 = !DILocation(line: 3771, column: 12, scope: !2189)
+!2191 = !DILocation(line: 3772, column: 40, scope: !2189)
+!2192 = !DILocation(line: 3774, column: 29, scope: !2189)
+!2193 = !DILocation(line: 3776, column: 20, scope: !2189)
+!2194 = !DILocation(line: 3777, column: 3, scope: !2189)
+!2195 = !DILocation(line: 3779, column: 26, scope: !2189)
+!2196 = !DILocation(line: 3780, column: 32, scope: !2189)
+!2197 = !DILocation(line: 3781, column: 40, scope: !2189)
+!2198 = !DILocation(line: 3781, column: 20, scope: !2189)
+!2199 = !DILocation(line: 3783, column: 14, scope: !2189)
+!2200 = !DILocation(line: 3784, column: 3, scope: !2189)
+!2201 = !DILocation(line: 3785, column: 15, scope: !2189)
+!2202 = !DILocation(line: 3786, column: 8, scope: !2189)
+!2203 = !DILocation(line: 3787, column: 33, scope: !2189)
+!2204 = !DILocation(line: 3789, column: 19, scope: !2189)
+!2205 = !DILocation(line: 3790, column: 37, scope: !2189)
+!2206 = !DILocation(line: 3792, column: 19, scope: !2189)
+!2207 = distinct !DISubprogram(name: "kernel_95", scope: !9, file: !9, line: 3810, type: !11, scopeLine: 3810, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!2208 = !DILocation(line: 3810, column: 20, scope: !2207)
+!2209 = !DILocation(line: 3811, column: 19, scope: !2207)
+!2210 = !DILocation(line: 3811, column: 30, scope: !2207)
+!2211 = !DILocation(line: 3811, column: 38, scope: !2207)
+!2212 = !DILocation(line: 3811, column: 39, scope: !2207)
+!2213 = !DILocation(line: 3812, column: 24, scope: !2207)
+!2214 = !DILocation(line: 3812, column: 7, scope: !2207)
+!2215 = !DILocation(line: 3812, column: 28, scope: !2207)
+!2216 = !DILocation(line: 3812, column: 17, scope: !2207)
+!2217 = !DILocation(line: 3814, column: 13, scope: !2207)
+!2218 = !DILocation(line: 3814, column: 16, scope: !2207)
+!2219 = !DILocation(line: 3814, column: 30, scope: !2207)
+!2220 = !DILocation(line: 3815, column: 27, scope: !2207)
+!2221 = !DILocation(line: 3816, column: 8, scope: !2207)
+!2222 = !DILocation(line: 3817, column: 32, scope: !2207)
+!2223 = !DILocation(line: 3817, column: 16, scope: !2207)
+!2224 = !DILocation(line: 3819, column: 26, scope: !2207)
+!2225 = !DILocation(line: 3820, column: 27, scope: !2207)
+!2226 = !DILocation(line: 3820, column: 3, scope: !2207)
+!2227 = distinct !{!2227, !26}
+!2228 = !DILocation(line: 3822, column: 31, scope: !2207)
+!2229 = distinct !DISubprogram(name: "kernel_96", scope: !2, file: !2, line: 3850, type: !11, scopeLine: 3850, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!2230 = !DILocation(line: 3852, column: 8, scope: !2229)
+!2231 = !DILocation(line: 3853, column: 33, scope: !2229)
+!2232 = !DILocation(line: 3853, column: 32, scope: !2229)
+!2233 = !DILocation(line: 3854, column: 32, scope: !2229)
+!2234 = !DILocation(line: 3854, column: 38, scope: !2229)
+!2235 = !DILocation(line: 3856, column: 24, scope: !2229)
+!2236 = !DILocation(line: 3857, column: 11, scope: !2229)
+!2237 = !DILocation(line: 3857, column: 8, scope: !2229)
+!2238 = !DILocation(line: 3859, column: 14, scope: !2229)
+!2239 = !DILocation(line: 3859, column: 40, scope: !2229)
+!2240 = !DILocation(line: 3861, column: 15, scope: !2229)
+!2241 = !DILocation(line: 3862, column: 11, scope: !2229)
+!2242 = !DILocation(line: 3863, column: 24, scope: !2229)
+!2243 = !DILocation(line: 3865, column: 33, scope: !2229)
+!2244 = !DILocation(line: 3867, column: 26, scope: !2229)
+!2245 = !DILocation(line: 3868, column: 29, scope: !2229)
+!2246 = !DILocation(line: 3868, column: 13, scope: !2229)
+!2247 = !DILocation(line: 3868, column: 24, scope: !2229)
+!2248 = !DILocation(line: 3868, column: 37, scope: !2229)
+!2249 = !DILocation(line: 3868, column: 23, scope: !2229)
+!2250 = distinct !DISubprogram(name: "kernel_97", scope: !3, file: !3, line: 3890, type: !11, scopeLine: 3890, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!2251 = !DILocation(line: 3890, column: 30, scope: !2250)
+!2252 = !DILocation(line: 3890, column: 25, scope: !2250)
+!2253 = !DILocation(line: 3891, column: 13, scope: !2250)
+!2254 = !DILocation(line: 3892, column: 38, scope: !2250)
+!2255 = !DILocation(line: 3893, column: 6, scope: !2250)
+!2256 = !DILocation(line: 3894, column: 38, scope: !2250)
+!2257 = !DILocation(line: 3896, column: 3, scope: !2250)
+!2258 = !DILocation(line: 3896, column: 7, scope: !2250)
+!2259 = !DILocation(line: 3898, column: 4, scope: !2250)
+!2260 = !DILocation(line: 3899, column: 10, scope: !2250)
+!2261 = !DILocation(line: 3900, column: 7, scope: !2250)
+!2262 = !DILocation(line: 3901, column: 39, scope: !2250)
+!2263 = !DILocation(line: 3902, column: 32, scope: !2250)
+!2264 = !DILocation(line: 3902, column: 34, scope: !2250)
+!2265 = !DILocation(line: 3904, column: 26, scope: !2250)
+!2266 = !DILocation(line: 3905, column: 30, scope: !2250)
+!2267 = !DILocation(line: 3906, column: 10, scope: !2250)
+!2268 = !DILocation(line: 3906, column: 17, scope: !2250)
+!2269 = distinct !DISubprogram(name: "kernel_98", scope: !4, file: !4, line: 3930, type: !11, scopeLine: 3930, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!2270 = !DILocation(line: 3932, column: 12, scope: !2269)
+!2271 = !DILocation(line: 3933, column: 7, scope: !2269)
+!2272 = !DILocation(line: 3934, column: 33, scope: !2269)
+!2273 = !DILocation(line: 3934, column: 17, scope: !2269)
+!2274 = !DILocation(line: 3936, column: 22, scope: !2269)
+!2275 = !DILocation(line: 3936, column: 32, scope: !2269)
+!2276 = !DILocation(line: 3937, column: 16, scope: !2269)
+!2277 = !DILocation(line: 3939, column: 24, scope: !2269)
+!2278 = !DILocation(line: 3941, column: 24, scope: !2269)
+!2279 = !DILocation(line: 3943, column: 18, scope: !2269)
+!2280 = !DILocation(line: 3945, column: 14, scope: !2269)
+!2281 = !DILocation(line: 3946, column: 7, scope: !2269)
+!2282 = !DILocation(line: 3948, column: 8, scope: !2269)
+!2283 = !DILocation(line: 3950, column: 23, scope: !2269)
+!2284 = !DILocation(line: 3950, column: 4, scope: !2269)
+!2285 = !DILocation(line: 3952, column: 19, scope: !2269)
+!2286 = !DILocation(line: 3953, column: 38, scope: !2269)
+!2287 = !DILocation(line: 3953, column: 33, scope: !2269)
+!2288 = !DILocation(line: 3954, column: 36, scope: !2269)
+!2289 = !DILocation(line: 3955, column: 22, scope: !2269)
+!2290 = !DILocation(line: 3955, column: 18, scope: !2269)
+!2291 = !DILocation(line: 3957, column: 35, scope: !2269)
+!2292 = !DILocation(line: 3958, column: 40, scope: !2269)
+!2293 = !DILocation(line: 3959, column: 20, scope: !2269)
+!2294 = !DILocation(line: 3961, column: 37, scope: !2269)
+!2295 = !DILocation(line: 3961, column: 13, scope: !2269)
+!2296 = !DILocation(line: 3962, column: 22, scope: !2269)
+!2297 = !DILocation(line: 3962, column: 5, scope: !2269)
+!2298 = !DILocation(line: 3962, column: 28, scope: !2269)
+!2299 = !DILocation(line: 3963, column: 19, scope: !2269)
+!2300 = !DILocation(line: 3963, column: 5, scope: !2269)
+!2301 = !DILocation(line: 3964, column: 4, scope: !2269)
+!2302 = !DILocation(line: 3965, column: 20, scope: !2269)
+!2303 = !DILocation(line: 3965, column: 36, scope: !2269)
+!2304 = !DILocation(line: 3966, column: 19, scope: !2269)
+!2305 = !DILocation(line: 3966, column: 37, scope: !2269)
+!2306 = !DILocation(line: 3968, column: 4, scope: !2269)
+!2307 = !DILocation(line: 3968, column: 16, scope: !2269)
+!2308 = !DILocation(line: 3968, column: 15, scope: !2269)
+!2309 = !DILocation(line: 3968, column: 24, scope: !2269)
+!2310 = !DILocation(line: 3968, column: 32, scope: !2269)
+!2311 = !DILocation(line: 3969, column: 7, scope: !2269)
+!2312 = !DILocation(line: 3970, column: 8, scope: !2269)
+!2313 = !DILocation(line: 3971, column: 25, scope: !2269)
+!2314 = !DILocation(line: 3972, column: 21, scope: !2269)
+!2315 = !DILocation(line: 3973, column: 3, scope: !2269)
+!2316 = !DILocation(line: 3974, column: 28, scope: !2269)
+!2317 = distinct !DISubprogram(name: "kernel_99", scope: !5, file: !5, line: 3970, type: !11, scopeLine: 3970, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!2318 = !DILocation(line: 3971, column: 36, scope: !2317)
+!2319 = !DILocation(line: 3971, column: 8, scope: !2317)
+!2320 = !DILocation(line: 3972, column: 21, scope: !2317)
+!2321 = !DILocation(line: 3973, column: 16, scope: !2317)
+!2322 = !DILocation(line: 3974, column: 19, scope: !2317)
+!2323 = !DILocation(line: 3975, column: 12, scope: !2317)
+!2324 = !DILocation(line: 3976, column: 3, scope: !2317)
+!2325 = !DILocation(line: 3976, column: 16, scope: !2317)
+!2326 = !DILocation(line: 3978, column: 33, scope: !2317)
+!2327 = !DILocation(line: 3979, column: 28, scope: !2317)
+!2328 = !DILocation(line: 3980, column: 35, scope: !2317)
+!2329 = !DILocation(line: 3982, column: 30, scope: !2317)
+!2330 = !DILocation(line: 3983, column: 29, scope: !2317)
+!2331 = !DILocation(line: 3983, column: 11, scope: !2317)
+!2332 = !DILocation(line: 3983, column: 7, scope: !2317)
+!2333 = !DILocation(line: 3984, column: 7, scope: !2317)
+!2334 = distinct !DISubprogram(name: "kernel_100", scope: !6, file: !6, line: 4010, type: !11, scopeLine: 4010, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!2335 = !DILocation(line: 4010, column: 29, scope: !2334)
+!2336 = !DILocation(line: 4011, column: 7, scope: !2334)
+!2337 = !DILocation(line: 4012, column: 4, scope: !2334)
+!2338 = !DILocation(line: 4013, column: 16, scope: !2334)
+!2339 = !DILocation(line: 4013, column: 19, scope: !2334)
+!2340 = !DILocation(line: 4015, column: 31, scope: !2334)
+!2341 = !DILocation(line: 4015, column: 22, scope: !2334)
+!2342 = !DILocation(line: 4017, column: 3, scope: !2334)
+!2343 = !DILocation(line: 4018, column: 38, scope: !2334)
+!2344 = !DILocation(line: 4019, column: 4, scope: !2334)
+!2345 = !DILocation(line: 4020, column: 28, scope: !2334)
+!2346 = !DILocation(line: 4021, column: 26, scope: !2334)
+!2347 = !DILocation(line: 4021, column: 6, scope: !2334)
+!2348 = !DILocation(line: 4023, column: 37, scope: !2334)
+!2349 = !DILocation(line: 4025, column: 33, scope: !2334)
+!2350 = !DILocation(line: 4027, column: 12, scope: !2334)
+!2351 = !DILocation(line: 4029, column: 10, scope: !2334)
+!2352 = !DILocation(line: 4029, column: 26, scope: !2334)
+!2353 = !DILocation(line: 4030, column: 23, scope: !2334)
+!2354 = distinct !{!2354, !26}
+!2355 = !DILocation(line: 4031, column: 5, scope: !2334)
+!2356 = distinct !DISubprogram(name: "kernel_101", scope: !7, file: !7, line: 4050, type: !11, scopeLine: 4050, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!2357 = !DILocation(line: 4051, column: 8, scope: !2356)
+!2358 = !DILocation(line: 4053, column: 34, scope: !2356)
+!2359 = !DILocation(line: 4054, column: 16, scope: !2356)
+!2360 = !DILocation(line: 4055, column: 3, scope: !2356)
+!2361 = !DILocation(line: 4056, column: 29, scope: !2356)
+!2362 = !DILocation(line: 4057, column: 28, scope: !2356)
+!2363 = !DILocation(line: 4058, column: 17, scope: !2356)
+!2364 = !DILocation(line: 4058, column: 13, scope: !2356)
+!2365 = !DILocation(line: 4059, column: 20, scope: !2356)
+!2366 = !DILocation(line: 4061, column: 3, scope: !2356)
+!2367 = !DILocation(line: 4062, column: 16, scope: !2356)
+!2368 = !DILocation(line: 4062, column: 36, scope: !2356)
+!2369 = !DILocation(line: 4063, column: 28, scope: !2356)
+!2370 = !DILocation(line: 4064, column: 4, scope: !2356)
+!2371 = !DILocation(line: 4064, column: 40, scope: !2356)
+!2372 = !DILocation(line: 4065, column: 32, scope: !2356)
+!2373 = !DILocation(line: 4066, column: 13, scope: !2356)
+!2374 = !DILocation(line: 4067, column: 13, scope: !2356)
+!2375 = !DILocation(line: 4068, column: 15, scope: !2356)
+!2376 = !DILocation(line: 4069, column: 40, scope: !2356)
+!2377 = distinct !DISubprogram(name: "kernel_102", scope: !8, file: !8, line: 4090, type: !11, scopeLine: 4090, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!2378 = !DILocation(line: 4091, column: 38, scope: !2377)
+!2379 = !DILocation(line: 4092, column: 8, scope: !2377)
+!2380 = !DILocation(line: 4093, column: 8, scope: !2377)
+!2381 = !DILocation(line: 4094, column: 10, scope: !2377)
+!2382 = !DILocation(line: 4095, column: 13, scope: !2377)
+!2383 = !DILocation(line: 4095, column: 38, scope: !2377)
+!2384 = !DILocation(line: 4097, column: 39, scope: !2377)
+!2385 = !DILocation(line: 4098, column: 14, scope: !2377)
+!2386 = !DILocation(line: 4099, column: 27, scope: !2377)
+!2387 = !DILocation(line: 4100, column: 25, scope: !2377)
+!2388 = !DILocation(line: 4100, column: 30, scope: !2377)
+!2389 = !DILocation(line: 4102, column: 9, scope: !2377)
+!2390 = !DILocation(line: 4103, column: 28, scope: !2377)
+!2391 = !DILocation(line: 4105, column: 21, scope: !2377)
+!2392 = !DILocation(line: 4106, column: 28, scope: !2377)
+!2393 = !DILocation(line: 4106, column: 11, scope: !2377)
+!2394 = !DILocation(line: 4107, column: 36, scope: !2377)
+!2395 = !DILocation(line: 4109, column: 39, scope: !2377)
+!2396 = distinct !DISubprogram(name: "kernel_103", scope: !9, file: !9, line: 4130, type: !11, scopeLine: 4130, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!2397 = !DILocation(line: 4131, column: 16, scope: !2396)
+!2398 = !DILocation(line: 4132, column: 20, scope: !2396)
+!2399 = !DILocation(line: 4132, column: 12, scope: !2396)
+!2400 = !DILocation(line: 4133, column: 6, scope: !2396)
+!2401 = !DILocation(line: 4135, column: 11, scope: !2396)
+!2402 = !DILocation(line: 4136, column: 25, scope: !2396)
+!2403 = !DILocation(line: 4137, column: 9, scope: !2396)
+!2404 = !DILocation(line: 4137, column: 12, scope: !2396)
+!2405 = !DILocation(line: 4137, column: 21, scope: !2396)
+!2406 = !DILocation(line: 4137, column: 22, scope: !2396)
+!2407 = !DILocation(line: 4139, column: 5, scope: !2396)
+!2408 = !DILocation(line: 4141, column: 3, scope: !2396)
+!2409 = !DILocation(line: 4143, column: 24, scope: !2396)
+!2410 = !DILocation(line: 4144, column: 24, scope: !2396)
+!2411 = !DILocation(line: 4144, column: 32, scope: !2396)
+!2412 = !DILocation(line: 4145, column: 28, scope: !2396)
+!2413 = !DILocation(line: 4145, column: 5, scope: !2396)
+!2414 = !DILocation(line: 4146, column: 10, scope: !2396)
+!2415 = !DILocation(line: 4147, column: 20, scope: !2396)
+!2416 = !DILocation(line: 4147, column: 19, scope: !2396)
+!2417 = !DILocation(line: 4147, column: 40, scope: !2396)
+!2418 = !DILocation(line: 4147, column: 40, scope: !2396)
+!2419 = !DILocation(line: 4149, column: 13, scope: !2396)
+!2420 = !DILocation(line: 4151, column: 5, scope: !2396)
+!2421 = !DILocation(line: 4151, column: 23, scope: !2396)
+!2422 = !DILocation(line: 4152, column: 18, scope: !2396)
+!2423 = !DILocation(line: 4154, column: 40, scope: !2396)
+!2424 = !DILocation(line: 4155, column: 24, scope: !2396)
+!2425 = !DILocation(line: 4156, column: 9, scope: !2396)
+!2426 = !DILocation(line: 4158, column: 26, scope: !2396)
+!2427 = !DILocation(line: 4160, column: 22, scope: !2396)
+!2428 = !DILocation(line: 4162, column: 4, scope: !2396)
+!2429 = !DILocation(line: 4163, column: 40, scope: !2396)
+!2430 = !DILocation(line: 4164, column: 28, scope: !2396)
+!2431 = !DILocation(line: 4165, column: 30, scope: !2396)
+!2432 = distinct !DISubprogram(name: "kernel_104", scope: !2, file: !2, line: 4170, type: !11, scopeLine: 4170, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!2433 = !DILocation(line: 4172, column: 23, scope: !2432)
+!2434 = !DILocation(line: 4173, column: 37, scope: !2432)
+!2435 = !DILocation(line: 4175, column: 38, scope: !2432)
+!2436 = !DILocation(line: 4177, column: 20, scope: !2432)
+!2437 = !DILocation(line: 4178, column: 4, scope: !2432)
+!2438 = !DILocation(line: 4179, column: 35, scope: !2432)
+!2439 = !DILocation(line: 4180, column: 19, scope: !2432)
+!2440 = !DILocation(line: 4182, column: 30, scope: !2432)
+!2441 = !DILocation(line: 4182, column: 19, scope: !2432)
+!2442 = !DILocation(line: 4182, column: 24, scope: !2432)
+!2443 = !DILocation(line: 4183, column: 9, scope: !2432)
+!2444 = !DILocation(line: 4184, column: 6, scope: !2432)
+!2445 = !DILocation(line: 4184, column: 22, scope: !2432)
+!2446 = !DILocation(line: 4185, column: 40, scope: !2432)
+!2447 = !DILocation(line: 4186, column: 38, scope: !2432)
+!2448 = !DILocation(line: 4186, column: 25, scope: !2432)
+!2449 = !DILocation(line: 4187, column: 9, scope: !2432)
+!2450 = distinct !DISubprogram(name: "kernel_105", scope: !3, file: !3, line: 4210, type: !11, scopeLine: 4210, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!2451 = !DILocation(line: 4211, column: 35, scope: !2450)
+!2452 = !DILocation(line: 4212, column: 23, scope: !2450)
+!2453 = !DILocation(line: 4214, column: 15, scope: !2450)
+!2454 = !DILocation(line: 4214, column: 15, scope: !2450)
+!2455 = !DILocation(line: 4215, column: 7, scope: !2450)
+!2456 = !DILocation(line: 4216, column: 31, scope: !2450)
+!2457 = !DILocation(line: 4217, column: 27, scope: !2450)
+!2458 = !DILocation(line: 4219, column: 10, scope: !2450)
+!2459 = !DILocation(line: 4219, column: 18, scope: !2450)
+!2460 = !DILocation(line: 4219, column: 18, scope: !2450)
+!2461 = !DILocation(line: 4219, column: 18, scope: !2450)
+!2462 = !DILocation(line: 4220, column: 33, scope: !2450)
+!2463 = !DILocation(line: 4220, column: 19, scope: !2450)
+!2464 = !DILocation(line: 4221, column: 29, scope: !2450)
+!2465 = !DILocation(line: 4223, column: 21, scope: !2450)
+!2466 = !DILocation(line: 4224, column: 26, scope: !2450)
+!2467 = !DILocation(line: 4225, column: 30, scope: !2450)
+!2468 = !DILocation(line: 4226, column: 4, scope: !2450)
+!2469 = !DILocation(line: 4227, column: 24, scope: !2450)
+!2470 = distinct !{!2470, !26}
+!2471 = !DILocation(line: 4228, column: 13, scope: !2450)
+!2472 = distinct !DISubprogram(name: "kernel_106", scope: !4, file: !4, line: 4250, type: !11, scopeLine: 4250, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!2473 = !DILocation(line: 4251, column: 37, scope: !2472)
+!2474 = !DILocation(line: 4252, column: 17, scope: !2472)
+!2475 = !DILocation(line: 4254, column: 24, scope: !2472)
+!2476 = !DILocation(line: 4255, column: 21, scope: !2472)
+!2477 = !DILocation(line: 4256, column: 13, scope: !2472)
+!2478 = !DILocation(line: 4258, column: 25, scope: !2472)
+!2479 = !DILocation(line: 4258, column: 15, scope: !2472)
+!2480 = !DILocation(line: 4260, column: 10, scope: !2472)
+!2481 = !DILocation(line: 4262, column: 31, scope: !2472)
+!2482 = !DILocation(line: 4263, column: 11, scope: !2472)
+!2483 = !DILocation(line: 4264, column: 32, scope: !2472)
+!2484 = !DILocation(line: 4264, column: 40, scope: !2472)
+!2485 = !DILocation(line: 4264, column: 25, scope: !2472)
+!2486 = !DILocation(line: 4266, column: 28, scope: !2472)
+!2487 = !DILocation(line: 4268, column: 18, scope: !2472)
+!2488 = !DILocation(line: 4269, column: 4, scope: !2472)
+!2489 = !DILocation(line: 4270, column: 22, scope: !2472)
+!2490 = !DILocation(line: 4272, column: 7, scope: !2472)
+!2491 = !DILocation(line: 4272, column: 9, scope: !2472)
+!2492 = !DILocation(line: 4273, column: 18, scope: !2472)
+!2493 = distinct !DISubprogram(name: "kernel_107", scope: !5, file: !5, line: 4290, type: !11, scopeLine: 4290, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!2494 = !DILocation(line: 4291, column: 25, scope: !2493)
+!2495 = !DILocation(line: 4291, column: 22, scope: !2493)
+!2496 = !DILocation(line: 4291, column: 12, scope: !2493)
+!2497 = !DILocation(line: 4291, column: 17, scope: !2493)
+!2498 = !DILocation(line: 4293, column: 4, scope: !2493)
+!2499 = !DILocation(line: 4294, column: 23, scope: !2493)
+!2500 = !DILocation(line: 4295, column: 34, scope: !2493)
+!2501 = !DILocation(line: 4295, column: 26, scope: !2493)
+!2502 = !DILocation(line: 4297, column: 30, scope: !2493)
+!2503 = !DILocation(line: 4298, column: 32, scope: !2493)
+!2504 = !DILocation(line: 4298, column: 25, scope: !2493)
+!2505 = !DILocation(line: 4299, column: 33, scope: !2493)
+!2506 = !DILocation(line: 4301, column: 24, scope: !2493)
+!2507 = !DILocation(line: 4302, column: 3, scope: !2493)
+!2508 = !DILocation(line: 4304, column: 9, scope: !2493)
+!2509 = !DILocation(line: 4305, column: 27, scope: !2493)
+!2510 = !DILocation(line: 4307, column: 30, scope: !2493)
+!2511 = !DILocation(line: 4307, column: 34, scope: !2493)
+!2512 = !DILocation(line: 4308, column: 35, scope: !2493)
+!2513 = !DILocation(line: 4308, column: 36, scope: !2493)
+!2514 = distinct !DISubprogram(name: "kernel_108", scope: !6, file: !6, line: 4330, type: !11, scopeLine: 4330, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!2515 = !DILocation(line: 4332, column: 19, scope: !2514)
+!2516 = !DILocation(line: 4332, column: 11, scope: !2514)
+!2517 = !DILocation(line: 4333, column: 22, scope: !2514)
+!2518 = !DILocation(line: 4333, column: 35, scope: !2514)
+!2519 = !DILocation(line: 4334, column: 16, scope: !2514)
+!2520 = !DILocation(line: 4334, column: 20, scope: !2514)
+!2521 = !DILocation(line: 4335, column: 5, scope: !2514)
+!2522 = !DILocation(line: 4336, column: 12, scope: !2514)
+!2523 = !DILocation(line: 4337, column: 5, scope: !2514)
+!2524 = !DILocation(line: 4338, column: 25, scope: !2514)
+!2525 = !DILocation(line: 4340, column: 4, scope: !2514)
+!2526 = !DILocation(line: 4341, column: 13, scope: !2514)
+!2527 = !DILocation(line: 4341, column: 10, scope: !2514)
+!2528 = !DILocation(line: 4342, column: 31, scope: !2514)
+!2529 = !DILocation(line: 4343, column: 32, scope: !2514)
+!2530 = !DILocation(line: 4345, column: 4, scope: !2514)
+!2531 = !DILocation(line: 4346, column: 17, scope: !2514)
+!2532 = !DILocation(line: 4348, column: 20, scope: !2514)
+!2533 = !DILocation(line: 4348, column: 20, scope: !2514)
+!2534 = !DILocation(line: 4350, column: 38, scope: !2514)
+!2535 = !DILocation(line: 4351, column: 11, scope: !2514)
+!2536 = !DILocation(line: 4352, column: 13, scope: !2514)
+!2537 = !DILocation(line: 4353, column: 34, scope: !2514)
+!2538 = !DILocation(line: 4354, column: 6, scope: !2514)
+!2539 = !DILocation(line: 4354, column: 12, scope: !2514)
+!2540 = !DILocation(line: 4355, column: 37, scope: !2514)
+!2541 = distinct !DISubprogram(name: "kernel_109", scope: !7, file: !7, line: 4370, type: !11, scopeLine: 4370, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!2542 = !DILocation(line: 4370, column: 34, scope: !2541)
+!2543 = !DILocation(line: 4371, column: 33, scope: !2541)
+!2544 = !DILocation(line: 4373, column: 25, scope: !2541)
+!2545 = !DILocation(line: 4373, column: 6, scope: !2541)
+!2546 = !DILocation(line: 4373, column: 36, scope: !2541)
+!2547 = !DILocation(line: 4375, column: 13, scope: !2541)
+!2548 = !DILocation(line: 4376, column: 14, scope: !2541)
+!2549 = !DILocation(line: 4377, column: 20, scope: !2541)
+!2550 = !DILocation(line: 4378, column: 8, scope: !2541)
+!2551 = !DILocation(line: 4379, column: 39, scope: !2541)
+!2552 = !DILocation(line: 4379, column: 29, scope: !2541)
+!2553 = !DILocation(line: 4380, column: 3, scope: !2541)
+!2554 = !DILocation(line: 4381, column: 28, scope: !2541)
+!2555 = !DILocation(line: 4381, column: 39, scope: !2541)
+!2556 = !DILocation(line: 4381, column: 31, scope: !2541)
+!2557 = !DILocation(line: 4382, column: 12, scope: !2541)
+!2558 = distinct !DISubprogram(name: "kernel_110", scope: !8, file: !8, line: 4410, type: !11, scopeLine: 4410, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!2559 = !DILocation(line: 4412, column: 8, scope: !2558)
+!2560 = !DILocation(line: 4414, column: 11, scope: !2558)
+!2561 = !DILocation(line: 4416, column: 14, scope: !2558)
+!2562 = !DILocation(line: 4417, column: 29, scope: !2558)
+!2563 = !DILocation(line: 4418, column: 31, scope: !2558)
+!2564 = !DILocation(line: 4420, column: 40, scope: !2558)
+!2565 = !DILocation(line: 4421, column: 9, scope: !2558)
+!2566 = !DILocation(line: 4421, column: 22, scope: !2558)
+!2567 = !DILocation(line: 4422, column: 40, scope: !2558)
+!2568 = !DILocation(line: 4424, column: 7, scope: !2558)
+!2569 = !DILocation(line: 4424, column: 16, scope: !2558)
+!2570 = !DILocation(line: 4424, column: 7, scope: !2558)
+!2571 = !DILocation(line: 4425, column: 21, scope: !2558)
+!2572 = !DILocation(line: 4426, column: 3, scope: !2558)
+!2573 = !DILocation(line: 4427, column: 6, scope: !2558)
+!2574 = !DILocation(line: 4428, column: 29, scope: !2558)
+!2575 = !DILocation(line: 4428, column: 4, scope: !2558)
+!2576 = !DILocation(line: 4428, column: 31, scope: !2558)
+!2577 = !DILocation(line: 4429, column: 40, scope: !2558)
+!2578 = distinct !{!2578, !26}
+!2579 = !DILocation(line: 4429, column: 16, scope: !2558)
+!2580 = distinct !DISubprogram(name: "kernel_111", scope: !9, file: !9, line: 4450, type: !11, scopeLine: 4450, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!2581 = !DILocation(line: 4452, column: 23, scope: !2580)
+!2582 = !DILocation(line: 4452, column: 4, scope: !2580)
+!2583 = !DILocation(line: 4454, column: 22, scope: !2580)
+!2584 = !DILocation(line: 4455, column: 31, scope: !2580)
+!2585 = !DILocation(line: 4456, column: 29, scope: !2580)
+!2586 = !DILocation(line: 4457, column: 39, scope: !2580)
+!2587 = !DILocation(line: 4457, column: 31, scope: !2580)
+!2588 = !DILocation(line: 4458, column: 32, scope: !2580)
+!2589 = !DILocation(line: 4460, column: 29, scope: !2580)
+!2590 = !DILocation(line: 4462, column: 3, scope: !2580)
+!2591 = !DILocation(line: 4462, column: 10, scope: !2580)
+!2592 = !DILocation(line: 4462, column: 15, scope: !2580)
+!2593 = !DILocation(line: 4463, column: 21, scope: !2580)
+!2594 = !DILocation(line: 4464, column: 15, scope: !2580)
+!2595 = !DILocation(line: 4465, column: 38, scope: !2580)
+!2596 = !DILocation(line: 4465, column: 40, scope: !2580)
+!2597 = !DILocation(line: 4465, column: 29, scope: !2580)
+!2598 = !DILocation(line: 4465, column: 33, scope: !2580)
+!2599 = !DILocation(line: 4465, column: 12, scope: !2580)
+!2600 = !DILocation(line: 4466, column: 14, scope: !2580)
+!2601 = distinct !DISubprogram(name: "kernel_112", scope: !2, file: !2, line: 4490, type: !11, scopeLine: 4490, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!2602 = !DILocation(line: 4491, column: 9, scope: !2601)
+!2603 = !DILocation(line: 4492, column: 26, scope: !2601)
+!2604 = !DILocation(line: 4494, column: 40, scope: !2601)
+!2605 = !DILocation(line: 4495, column: 26, scope: !2601)
+!2606 = !DILocation(line: 4496, column: 29, scope: !2601)
+!2607 = !DILocation(line: 4497, column: 26, scope: !2601)
+!2608 = !DILocation(line: 4499, column: 22, scope: !2601)
+!2609 = !DILocation(line: 4500, column: 24, scope: !2601)
+!2610 = !DILocation(line: 4500, column: 26, scope: !2601)
+!2611 = !DILocation(line: 4501, column: 6, scope: !2601)
+!2612 = !DILocation(line: 4502, column: 28, scope: !2601)
+!2613 = !DILocation(line: 4503, column: 34, scope: !2601)
+!2614 = distinct !DISubprogram(name: "kernel_113", scope: !3, file: !3, line: 4530, type: !11, scopeLine: 4530, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!2615 = !DILocation(line: 4531, column: 25, scope: !2614)
+!2616 = !DILocation(line: 4532, column: 20, scope: !2614)
+!2617 = !DILocation(line: 4533, column: 30, scope: !2614)
+!2618 = !DILocation(line: 4534, column: 20, scope: !2614)
+!2619 = !DILocation(line: 4535, column: 6, scope: !2614)
+!2620 = !DILocation(line: 4536, column: 32, scope: !2614)
+!2621 = !DILocation(line: 4538, column: 16, scope: !2614)
+!2622 = !DILocation(line: 4540, column: 12, scope: !2614)
+!2623 = !DILocation(line: 4542, column: 3, scope: !2614)
+!2624 = !DILocation(line: 4544, column: 21, scope: !2614)
+!2625 = !DILocation(line: 4544, column: 10, scope: !2614)
+!2626 = !DILocation(line: 4545, column: 11, scope: !2614)
+!2627 = !DILocation(line: 4545, column: 12, scope: !2614)
+!2628 = !DILocation(line: 4546, column: 18, scope: !2614)
+!2629 = !DILocation(line: 4548, column: 24, scope: !2614)
+!2630 = !DILocation(line: 4549, column: 22, scope: !2614)
+!2631 = !DILocation(line: 4550, column: 9, scope: !2614)
+!2632 = !DILocation(line: 4552, column: 8, scope: !2614)
+!2633 = !DILocation(line: 4553, column: 29, scope: !2614)
+!2634 = !DILocation(line: 4555, column: 3, scope: !2614)
+!2635 = !DILocation(line: 4557, column: 19, scope: !2614)
+!2636 = !DILocation(line: 4557, column: 3, scope: !2614)
+!2637 = !DILocation(line: 4559, column: 32, scope: !2614)
+!2638 = !DILocation(line: 4561, column: 10, scope: !2614)
+!2639 = !DILocation(line: 4563, column: 28, scope: !2614)
+!2640 = !DILocation(line: 4563, column: 14, scope: !2614)
+!2641 = distinct !DISubprogram(name: "kernel_114", scope: !4, file: !4, line: 4570, type: !11, scopeLine: 4570, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!2642 = !DILocation(line: 4572, column: 31, scope: !2641)
+!2643 = !DILocation(line: 4573, column: 9, scope: !2641)
+!2644 = !DILocation(line: 4575, column: 31, scope: !2641)
+!2645 = !DILocation(line: 4577, column: 37, scope: !2641)
+!2646 = !DILocation(line: 4579, column: 20, scope: !2641)
+!2647 = !DILocation(line: 4581, column: 7, scope: !2641)
+!2648 = !DILocation(line: 4582, column: 8, scope: !2641)
+!2649 = !DILocation(line: 4583, column: 21, scope: !2641)
+!2650 = !DILocation(line: 4584, column: 33, scope: !2641)
+!2651 = !DILocation(line: 4585, column: 36, scope: !2641)
+!2652 = !DILocation(line: 4585, column: 23, scope: !2641)
+!2653 = !DILocation(line: 4587, column: 10, scope: !2641)
+!2654 = !DILocation(line: 4589, column: 23, scope: !2641)
+!2655 = !DILocation(line: 4589, column: 16, scope: !2641)
+!2656 = !DILocation(line: 4590, column: 29, scope: !2641)
+!2657 = !DILocation(line: 4591, column: 19, scope: !2641)
+!2658 = !DILocation(line: 4592, column: 12, scope: !2641)
+!2659 = distinct !DISubprogram(name: "kernel_115", scope: !5, file: !5, line: 4610, type: !11, scopeLine: 4610, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!2660 = !DILocation(line: 4612, column: 3, scope: !2659)
+!2661 = !DILocation(line: 4613, column: 32, scope: !2659)
+!2662 = !DILocation(line: 4614, column: 34, scope: !2659)
+!2663 = !DILocation(line: 4614, column: 36, scope: !2659)
+!2664 = !DILocation(line: 4615, column: 9, scope: !2659)
+!2665 = !DILocation(line: 4616, column: 31, scope: !2659)
+!2666 = !DILocation(line: 4616, column: 36, scope: !2659)
+!2667 = !DILocation(line: 4618, column: 22, scope: !2659)
+!2668 = !DILocation(line: 4620, column: 15, scope: !2659)
+!2669 = !DILocation(line: 4622, column: 7, scope: !2659)
+!2670 = !DILocation(line: 4623, column: 29, scope: !2659)
+!2671 = !DILocation(line: 4625, column: 12, scope: !2659)
+!2672 = !DILocation(line: 4625, column: 4, scope: !2659)
+!2673 = !DILocation(line: 4626, column: 4, scope: !2659)
+!2674 = !DILocation(line: 4628, column: 30, scope: !2659)
+!2675 = !DILocation(line: 4628, column: 27, scope: !2659)
+!2676 = !DILocation(line: 4629, column: 32, scope: !2659)
+!2677 = !DILocation(line: 4630, column: 32, scope: !2659)
+!2678 = !DILocation(line: 4632, column: 14, scope: !2659)
+!2679 = distinct !{!2679, !26}
+!2680 = !DILocation(line: 4632, column: 20, scope: !2659)
+!2681 = distinct !DISubprogram(name: "kernel_116", scope: !6, file: !6, line: 4650, type: !11, scopeLine: 4650, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!2682 = !DILocation(line: 4652, column: 37, scope: !2681)
+!2683 = !DILocation(line: 4652, column: 36, scope: !2681)
+!2684 = !DILocation(line: 4653, column: 5, scope: !2681)
+!2685 = !DILocation(line: 4654, column: 33, scope: !2681)
+!2686 = !DILocation(line: 4655, column: 20, scope: !2681)
+!2687 = !DILocation(line: 4656, column: 36, scope: !2681)
+!2688 = !DILocation(line: 4658, column: 37, scope: !2681)
+!2689 = !DILocation(line: 4659, column: 35, scope: !2681)
+!2690 = !DILocation(line: 4659, column: 30, scope: !2681)
+!2691 = !DILocation(line: 4661, column: 40, scope: !2681)
+!2692 = !DILocation(line: 4663, column: 21, scope: !2681)
+!2693 = !DILocation(line: 4664, column: 21, scope: !2681)
+!2694 = !DILocation(line: 4665, column: 31, scope: !2681)
+!2695 = !DILocation(line: 4666, column: 11, scope: !2681)
+!2696 = !DILocation(line: 4667, column: 13, scope: !2681)
+!2697 = !DILocation(line: 4668, column: 11, scope: !2681)
+!2698 = !DILocation(line: 4669, column: 22, scope: !2681)
+!2699 = !DILocation(line: 4671, column: 37, scope: !2681)
+!2700 = !DILocation(line: 4672, column: 35, scope: !2681)
+!2701 = !DILocation(line: 4673, column: 36, scope: !2681)
+!2702 = distinct !DISubprogram(name: "kernel_117", scope: !7, file: !7, line: 4690, type: !11, scopeLine: 4690, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!2703 = !DILocation(line: 4690, column: 35, scope: !2702)
+!2704 = !DILocation(line: 4691, column: 4, scope: !2702)
+!2705 = !DILocation(line: 4691, column: 23, scope: !2702)
+!2706 = !DILocation(line: 4693, column: 30, scope: !2702)
+!2707 = !DILocation(line: 4693, column: 3, scope: !2702)
+!2708 = !DILocation(line: 4693, column: 3, scope: !2702)
+!2709 = !DILocation(line: 4694, column: 13, scope: !2702)
+!2710 = !DILocation(line: 4694, column: 16, scope: !2702)
+!2711 = !DILocation(line: 4695, column: 22, scope: !2702)
+!2712 = !DILocation(line: 4696, column: 38, scope: !2702)
+!2713 = !DILocation(line: 4697, column: 26, scope: !2702)
+!2714 = !DILocation(line: 4698, column: 11, scope: !2702)
+!2715 = !DILocation(line: 4700, column: 21, scope: !2702)
+!2716 = !DILocation(line: 4702, column: 6, scope: !2702)
+!2717 = !DILocation(line: 4704, column: 36, scope: !2702)
+!2718 = !DILocation(line: 4706, column: 16, scope: !2702)
+!2719 = distinct !DISubprogram(name: "kernel_118", scope: !8, file: !8, line: 4730, type: !11, scopeLine: 4730, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!2720 = !DILocation(line: 4731, column: 19, scope: !2719)
+!2721 = !DILocation(line: 4732, column: 36, scope: !2719)
+!2722 = !DILocation(line: 4734, column: 27, scope: !2719)
+!2723 = !DILocation(line: 4735, column: 10, scope: !2719)
+!2724 = !DILocation(line: 4736, column: 33, scope: !2719)
+!2725 = !DILocation(line: 4737, column: 16, scope: !2719)
+!2726 = !DILocation(line: 4737, column: 21, scope: !2719)
+!2727 = !DILocation(line: 4739, column: 26, scope: !2719)
+!2728 = !DILocation(line: 4740, column: 3, scope: !2719)
+!2729 = !DILocation(line: 4741, column: 11, scope: !2719)
+!2730 = !DILocation(line: 4741, column: 7, scope: !2719)
+!2731 = !DILocation(line: 4742, column: 29, scope: !2719)
+!2732 = !DILocation(line: 4744, column: 38, scope: !2719)
+!2733 = !DILocation(line: 4744, column: 29, scope: !2719)
+!2734 = !DILocation(line: 4746, column: 21, scope: !2719)
+!2735 = !DILocation(line: 4747, column: 24, scope: !2719)
+!2736 = !DILocation(line: 4749, column: 16, scope: !2719)
+!2737 = !DILocation(line: 4749, column: 30, scope: !2719)
+!2738 = !DILocation(line: 4751, column: 18, scope: !2719)
+!2739 = !DILocation(line: 4752, column: 34, scope: !2719)
+!2740 = !DILocation(line: 4752, column: 14, scope: !2719)
+!2741 = !DILocation(line: 4753, column: 22, scope: !2719)
+!2742 = !DILocation(line: 4754, column: 7, scope: !2719)
+!2743 = !DILocation(line: 4756, column: 6, scope: !2719)
+!2744 = !DILocation(line: 4757, column: 34, scope: !2719)
+!2745 = !DILocation(line: 4757, column: 14, scope: !2719)
+!2746 = !DILocation(line: 4759, column: 31, scope: !2719)
+!2747 = !DILocation(line: 4760, column: 27, scope: !2719)
+!2748 = !DILocation(line: 4761, column: 34, scope: !2719)
+!2749 = !DILocation(line: 4763, column: 29, scope: !2719)
+!2750 = !DILocation(line: 4765, column: 39, scope: !2719)
+!2751 = !DILocation(line: 4767, column: 3, scope: !2719)
+!2752 = !DILocation(line: 4768, column: 39, scope: !2719)
+!2753 = !DILocation(line: 4769, column: 37, scope: !2719)
+!2754 = !DILocation(line: 4769, column: 3, scope: !2719)
+!2755 = !DILocation(line: 4770, column: 38, scope: !2719)
+!2756 = !DILocation(line: 4771, column: 9, scope: !2719)
+!2757 = !DILocation(line: 4771, column: 11, scope: !2719)
+!2758 = !DILocation(line: 4773, column: 32, scope: !2719)
+!2759 = !DILocation(line: 4775, column: 33, scope: !2719)
+!2760 = !DILocation(line: 4777, column: 30, scope: !2719)
+!2761 = !DILocation(line: 4777, column: 28, scope: !2719)
+!2762 = !DILocation(line: 4777, column: 15, scope: !2719)
+!2763 = !DILocation(line: 4779, column: 28, scope: !2719)
+!2764 = !DILocation(line: 4780, column: 32, scope: !2719)
+!2765 = !DILocation(line: 4780, column: 16, scope: !2719)
+!2766 = !DILocation(line: 4781, column: 23, scope: !2719)
+!2767 = !DILocation(line: 4781, column: 21, scope: !2719)
+!2768 = !DILocation(line: 4783, column: 13, scope: !2719)
+!2769 = !DILocation(line: 4783, column: 11, scope: !2719)
+!2770 = distinct !DISubprogram(name: "kernel_119", scope: !9, file: !9, line: 4770, type: !11, scopeLine: 4770, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!2771 = !DILocation(line: 4771, column: 26, scope: !2770)
+!2772 = !DILocation(line: 4773, column: 19, scope: !2770)
+!2773 = !DILocation(line: 4774, column: 22, scope: !2770)
+!2774 = !DILocation(line: 4776, column: 17, scope: !2770)
+!2775 = !DILocation(line: 4777, column: 19, scope: !2770)
+!2776 = !DILocation(line: 4779, column: 20, scope: !2770)
+!2777 = !DILocation(line: 4780, column: 12, scope: !2770)
+!2778 = !DILocation(line: 4781, column: 36, scope: !2770)
+!2779 = !DILocation(line: 4782, column: 17, scope: !2770)
+!2780 = !DILocation(line: 4784, column: 26, scope: !2770)
+!2781 = !DILocation(line: 4785, column: 4, scope: !2770)
+!2782 = !DILocation(line: 4787, column: 36, scope: !2770)
+!2783 = !DILocation(line: 4787, column: 14, scope: !2770)
+!2784 = !DILocation(line: 4788, column: 27, scope: !2770)
+!2785 = !DILocation(line: 4790, column: 3, scope: !2770)
+!2786 = !DILocation(line: 4791, column: 11, scope: !2770)
+!2787 = distinct !DISubprogram(name: "kernel_120", scope: !2, file: !2, line: 4810, type: !11, scopeLine: 4810, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!2788 = !DILocation(line: 4811, column: 23, scope: !2787)
+!2789 = !DILocation(line: 4812, column: 28, scope: !2787)
+!2790 = !DILocation(line: 4813, column: 29, scope: !2787)
+!2791 = !DILocation(line: 4813, column: 23, scope: !2787)
+!2792 = !DILocation(line: 4815, column: 33, scope: !2787)
+!2793 = !DILocation(line: 4815, column: 32, scope: !2787)
+!2794 = !DILocation(line: 4817, column: 35, scope: !2787)
+!2795 = !DILocation(line: 4819, column: 12, scope: !2787)
+!2796 = !DILocation(line: 4820, column: 21, scope: !2787)
+!2797 = !DILocation(line: 4821, column: 10, scope: !2787)
+!2798 = !DILocation(line: 4823, column: 30, scope: !2787)
+!2799 = !DILocation(line: 4825, column: 12, scope: !2787)
+!2800 = !DILocation(line: 4827, column: 5, scope: !2787)
+!2801 = !DILocation(line: 4829, column: 33, scope: !2787)
+!2802 = !DILocation(line: 4831, column: 12, scope: !2787)
+!2803 = !DILocation(line: 4832, column: 26, scope: !2787)
+!2804 = !DILocation(line: 4834, column: 23, scope: !2787)
+!2805 = !DILocation(line: 4835, column: 4, scope: !2787)
+!2806 = !DILocation(line: 4837, column: 3, scope: !2787)
+!2807 = distinct !{!2807, !26}
+!2808 = !DILocation(line: 4838, column: 25, scope: !2787)
+!2809 = distinct !DISubprogram(name: "kernel_121", scope: !3, file: !3, line: 4850, type: !11, scopeLine: 4850, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!2810 = !DILocation(line: 4852, column: 30, scope: !2809)
+!2811 = !DILocation(line: 4852, column: 37, scope: !2809)
+!2812 = !DILocation(line: 4853, column: 29, scope: !2809)
+!2813 = !DILocation(line: 4855, column: 19, scope: !2809)
+!2814 = !DILocation(line: 4856, column: 23, scope: !2809)
+!2815 = !DILocation(line: 4856, column: 37, scope: !2809)
+!2816 = !DILocation(line: 4857, column: 23, scope: !2809)
+!2817 = !DILocation(line: 4859, column: 30, scope: !2809)
+!2818 = !DILocation(line: 4860, column: 38, scope: !2809)
+!2819 = !DILocation(line: 4861, column: 4, scope: !2809)
+!2820 = !DILocation(line: 4862, column: 38, scope: !2809)
+!2821 = !DILocation(line: 4863, column: 32, scope: !2809)
+!2822 = !DILocation(line: 4864, column: 11, scope: !2809)
+!2823 = !DILocation(line: 4864, column: 11, scope: !2809)
+!2824 = !DILocation(line: 4866, column: 26, scope: !2809)
+!2825 = !DILocation(line: 4866, column: 17, scope: !2809)
+!2826 = !DILocation(line: 4867, column: 14, scope: !2809)
+!2827 = !DILocation(line: 4867, column: 17, scope: !2809)
+!2828 = !DILocation(line: 4869, column: 35, scope: !2809)
+!2829 = !DILocation(line: 4871, column: 26, scope: !2809)
+!2830 = distinct !DISubprogram(name: "kernel_122", scope: !4, file: !4, line: 4890, type: !11, scopeLine: 4890, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!2831 = !DILocation(line: 4890, column: 6, scope: !2830)
+!2832 = !DILocation(line: 4890, column: 33, scope: !2830)
+!2833 = !DILocation(line: 4890, column: 20, scope: !2830)
+!2834 = !DILocation(line: 4892, column: 8, scope: !2830)
+!2835 = !DILocation(line: 4894, column: 8, scope: !2830)
+!2836 = !DILocation(line: 4895, column: 5, scope: !2830)
+!2837 = !DILocation(line: 4896, column: 35, scope: !2830)
+!2838 = !DILocation(line: 4898, column: 19, scope: !2830)
+!2839 = !DILocation(line: 4898, column: 6, scope: !2830)
+!2840 = !DILocation(line: 4898, column: 26, scope: !2830)
+!2841 = !DILocation(line: 4900, column: 21, scope: !2830)
+!2842 = !DILocation(line: 4901, column: 14, scope: !2830)
+!2843 = !DILocation(line: 4902, column: 9, scope: !2830)
+!2844 = !DILocation(line: 4904, column: 20, scope: !2830)
+!2845 = !DILocation(line: 4905, column: 29, scope: !2830)
+!2846 = !DILocation(line: 4906, column: 40, scope: !2830)
+!2847 = !DILocation(line: 4907, column: 21, scope: !2830)
+!2848 = !DILocation(line: 4908, column: 4, scope: !2830)
+!2849 = !DILocation(line: 4910, column: 8, scope: !2830)
+!2850 = !DILocation(line: 4911, column: 10, scope: !2830)
+!2851 = distinct !DISubprogram(name: "kernel_123", scope: !5, file: !5, line: 4930, type: !11, scopeLine: 4930, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!2852 = !DILocation(line: 4930, column: 37, scope: !2851)
+!2853 = !DILocation(line: 4931, column: 19, scope: !2851)
+!2854 = !DILocation(line: 4932, column: 7, scope: !2851)
+!2855 = !DILocation(line: 4932, column: 40, scope: !2851)
+!2856 = !DILocation(line: 4934, column: 34, scope: !2851)
+!2857 = !DILocation(line: 4934, column: 38, scope: !2851)
+!2858 = !DILocation(line: 4934, column: 9, scope: !2851)
+!2859 = !DILocation(line: 4935, column: 23, scope: !2851)
+!2860 = !DILocation(line: 4937, column: 13, scope: !2851)
+!2861 = !DILocation(line: 4937, column: 40, scope: !2851)
+!2862 = !DILocation(line: 4938, column: 33, scope: !2851)
+!2863 = !DILocation(line: 4939, column: 33, scope: !2851)
+!2864 = !DILocation(line: 4940, column: 30, scope: !2851)
+!2865 = !DILocation(line: 4941, column: 20, scope: !2851)
+!2866 = !DILocation(line: 4941, column: 40, scope: !2851)
+!2867 = !DILocation(line: 4943, column: 22, scope: !2851)
+!2868 = !DILocation(line: 4944, column: 39, scope: !2851)
+!2869 = !DILocation(line: 4944, column: 6, scope: !2851)
+!2870 = !DILocation(line: 4944, column: 23, scope: !2851)
+!2871 = !DILocation(line: 4945, column: 4, scope: !2851)
+!2872 = !DILocation(line: 4946, column: 10, scope: !2851)
+!2873 = !DILocation(line: 4947, column: 8, scope: !2851)
+!2874 = !DILocation(line: 4948, column: 7, scope: !2851)
+!2875 = !DILocation(line: 4949, column: 28, scope: !2851)
+!2876 = !DILocation(line: 4950, column: 25, scope: !2851)
+!2877 = !DILocation(line: 4950, column: 11, scope: !2851)
+!2878 = !DILocation(line: 4952, column: 16, scope: !2851)
+!2879 = !DILocation(line: 4954, column: 29, scope: !2851)
+!2880 = !DILocation(line: 4956, column: 11, scope: !2851)
+!2881 = !DILocation(line: 4956, column: 27, scope: !2851)
+!2882 = !DILocation(line: 4957, column: 40, scope: !2851)
+!2883 = !DILocation(line: 4957, column: 20, scope: !2851)
+!2884 = !DILocation(line: 4957, column: 40, scope: !2851)
+!2885 = !DILocation(line: 4959, column: 36, scope: !2851)
+!2886 = !DILocation(line: 4960, column: 8, scope: !2851)
+!2887 = distinct !DISubprogram(name: "kernel_124", scope: !6, file: !6, line: 4970, type: !11, scopeLine: 4970, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!2888 = !DILocation(line: 4970, column: 8, scope: !2887)
+!2889 = !DILocation(line: 4972, column: 25, scope: !2887)
+!2890 = !DILocation(line: 4973, column: 6, scope: !2887)
+!2891 = !DILocation(line: 4973, column: 7, scope: !2887)
+!2892 = !DILocation(line: 4973, column: 6, scope: !2887)
+!2893 = !DILocation(line: 4973, column: 14, scope: !2887)
+!2894 = !DILocation(line: 4975, column: 31, scope: !2887)
+!2895 = !DILocation(line: 4975, column: 10, scope: !2887)
+!2896 = !DILocation(line: 4975, column: 6, scope: !2887)
+!2897 = !DILocation(line: 4976, column: 39, scope: !2887)
+!2898 = !DILocation(line: 4977, column: 6, scope: !2887)
+!2899 = !DILocation(line: 4977, column: 40, scope: !2887)
+!2900 = !DILocation(line: 4978, column: 24, scope: !2887)
+!2901 = !DILocation(line: 4979, column: 38, scope: !2887)
+!2902 = !DILocation(line: 4980, column: 35, scope: !2887)
+!2903 = !DILocation(line: 4980, column: 38, scope: !2887)
+!2904 = !DILocation(line: 4982, column: 29, scope: !2887)
+!2905 = distinct !DISubprogram(name: "kernel_125", scope: !7, file: !7, line: 5010, type: !11, scopeLine: 5010, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!2906 = !DILocation(line: 5011, column: 4, scope: !2905)
+!2907 = !DILocation(line: 5012, column: 24, scope: !2905)
+!2908 = !DILocation(line: 5014, column: 24, scope: !2905)
+!2909 = !DILocation(line: 5014, column: 30, scope: !2905)
+!2910 = !DILocation(line: 5016, column: 13, scope: !2905)
+!2911 = !DILocation(line: 5016, column: 39, scope: !2905)
+!2912 = !DILocation(line: 5018, column: 4, scope: !2905)
+!2913 = !DILocation(line: 5018, column: 38, scope: !2905)
+!2914 = !DILocation(line: 5019, column: 39, scope: !2905)
+!2915 = !DILocation(line: 5021, column: 33, scope: !2905)
+!2916 = !DILocation(line: 5021, column: 17, scope: !2905)
+!2917 = !DILocation(line: 5022, column: 18, scope: !2905)
+!2918 = !DILocation(line: 5023, column: 29, scope: !2905)
+!2919 = !DILocation(line: 5024, column: 31, scope: !2905)
+!2920 = !DILocation(line: 5025, column: 19, scope: !2905)
+!2921 = !DILocation(line: 5025, column: 23, scope: !2905)
+!2922 = !DILocation(line: 5026, column: 14, scope: !2905)
+!2923 = !DILocation(line: 5027, column: 16, scope: !2905)
+!2924 = !DILocation(line: 5027, column: 36, scope: !2905)
+!2925 = distinct !{!2925, !26}
+!2926 = !DILocation(line: 5028, column: 11, scope: !2905)
+!2927 = distinct !DISubprogram(name: "kernel_126", scope: !8, file: !8, line: 5050, type: !11, scopeLine: 5050, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!2928 = !DILocation(line: 5050, column: 22, scope: !2927)
+!2929 = !DILocation(line: 5052, column: 39, scope: !2927)
+!2930 = !DILocation(line: 5052, column: 29, scope: !2927)
+!2931 = !DILocation(line: 5054, column: 12, scope: !2927)
+!2932 = !DILocation(line: 5055, column: 4, scope: !2927)
+!2933 = !DILocation(line: 5056, column: 8, scope: !2927)
+!2934 = !DILocation(line: 5058, column: 3, scope: !2927)
+!2935 = !DILocation(line: 5060, column: 39, scope: !2927)
+!2936 = !DILocation(line: 5061, column: 33, scope: !2927)
+!2937 = !DILocation(line: 5061, column: 7, scope: !2927)
+!2938 = !DILocation(line: 5063, column: 25, scope: !2927)
+!2939 = !DILocation(line: 5065, column: 17, scope: !2927)
+!2940 = !DILocation(line: 5065, column: 6, scope: !2927)
+!2941 = !DILocation(line: 5066, column: 6, scope: !2927)
+!2942 = !DILocation(line: 5067, column: 38, scope: !2927)
+!2943 = !DILocation(line: 5068, column: 33, scope: !2927)
+!2944 = !DILocation(line: 5069, column: 40, scope: !2927)
+!2945 = !DILocation(line: 5070, column: 5, scope: !2927)
+!2946 = !DILocation(line: 5070, column: 20, scope: !2927)
+!2947 = !DILocation(line: 5070, column: 19, scope: !2927)
+!2948 = distinct !DISubprogram(name: "kernel_127", scope: !9, file: !9, line: 5090, type: !11, scopeLine: 5090, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!2949 = !DILocation(line: 5091, column: 18, scope: !2948)
+!2950 = !DILocation(line: 5092, column: 35, scope: !2948)
+!2951 = !DILocation(line: 5093, column: 37, scope: !2948)
+!2952 = !DILocation(line: 5095, column: 22, scope: !2948)
+!2953 = !DILocation(line: 5097, column: 22, scope: !2948)
+!2954 = !DILocation(line: 5097, column: 11, scope: !2948)
+!2955 = !DILocation(line: 5098, column: 8, scope: !2948)
+!2956 = !DILocation(line: 5098, column: 34, scope: !2948)
+!2957 = !DILocation(line: 5100, column: 30, scope: !2948)
+!2958 = !DILocation(line: 5100, column: 32, scope: !2948)
+!2959 = !DILocation(line: 5102, column: 3, scope: !2948)
+!2960 = !DILocation(line: 5104, column: 40, scope: !2948)
+!2961 = !DILocation(line: 5104, column: 36, scope: !2948)
+!2962 = !DILocation(line: 5105, column: 23, scope: !2948)
+!2963 = !DILocation(line: 5105, column: 11, scope: !2948)
+!2964 = !DILocation(line: 5106, column: 26, scope: !2948)
+!2965 = !DILocation(line: 5106, column: 24, scope: !2948)
+!2966 = !DILocation(line: 5106, column: 39, scope: !2948)
+!2967 = !DILocation(line: 5106, column: 34, scope: !2948)
+!2968 = !DILocation(line: 5108, column: 40, scope: !2948)
+!2969 = distinct !DISubprogram(name: "kernel_128", scope: !2, file: !2, line: 5130, type: !11, scopeLine: 5130, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!2970 = !DILocation(line: 5132, column: 25, scope: !2969)
+!2971 = !DILocation(line: 5134, column: 6, scope: !2969)
+!2972 = !DILocation(line: 5136, column: 13, scope: !2969)
+!2973 = !DILocation(line: 5137, column: 11, scope: !2969)
+!2974 = !DILocation(line: 5137, column: 28, scope: !2969)
+!2975 = !DILocation(line: 5138, column: 25, scope: !2969)
+!2976 = !DILocation(line: 5138, column: 13, scope: !2969)
+!2977 = !DILocation(line: 5140, column: 15, scope: !2969)
+!2978 = !DILocation(line: 5141, column: 15, scope: !2969)
+!2979 = !DILocation(line: 5141, column: 8, scope: !2969)
+!2980 = !DILocation(line: 5141, column: 13, scope: !2969)
+!2981 = !DILocation(line: 5141, column: 9, scope: !2969)
+!2982 = !DILocation(line: 5143, column: 24, scope: !2969)
+!2983 = !DILocation(line: 5145, column: 18, scope: !2969)
+!2984 = !DILocation(line: 5145, column: 28, scope: !2969)
+!2985 = !DILocation(line: 5147, column: 29, scope: !2969)
+!2986 = !DILocation(line: 5148, column: 3, scope: !2969)
+!2987 = !DILocation(line: 5148, column: 30, scope: !2969)
+!2988 = !DILocation(line: 5149, column: 27, scope: !2969)
+!2989 = !DILocation(line: 5149, column: 4, scope: !2969)
+!2990 = !DILocation(line: 5151, column: 16, scope: !2969)
+!2991 = !DILocation(line: 5152, column: 25, scope: !2969)
+!2992 = !DILocation(line: 5154, column: 36, scope: !2969)
+!2993 = !DILocation(line: 5156, column: 9, scope: !2969)
+!2994 = !DILocation(line: 5158, column: 35, scope: !2969)
+!2995 = !DILocation(line: 5158, column: 37, scope: !2969)
+!2996 = !DILocation(line: 5159, column: 26, scope: !2969)
+!2997 = !DILocation(line: 5161, column: 40, scope: !2969)
+!2998 = !DILocation(line: 5162, column: 28, scope: !2969)
+!2999 = !DILocation(line: 5162, column: 32, scope: !2969)
+!3000 = !DILocation(line: 5162, column: 32, scope: !2969)
+!3001 = !DILocation(line: 5162, column: 8, scope: !2969)
+!3002 = !DILocation(line: 5163, column: 8, scope: !2969)
+!3003 = !DILocation(line: 5164, column: 11, scope: !2969)
+!3004 = !DILocation(line: 5165, column: 36, scope: !2969)
+!3005 = !DILocation(line: 5165, column: 14, scope: !2969)
+!3006 = !DILocation(line: 5166, column: 34, scope: !2969)
+!3007 = !DILocation(line: 5166, column: 27, scope: !2969)
+!3008 = !DILocation(line: 5166, column: 11, scope: !2969)
+!3009 = !DILocation(line: 5167, column: 30, scope: !2969)
+!3010 = !DILocation(line: 5168, column: 30, scope: !2969)
+!3011 = distinct !DISubprogram(name: "kernel_129", scope: !3, file: !3, line: 5170, type: !11, scopeLine: 5170, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!3012 = !DILocation(line: 5171, column: 8, scope: !3011)
+!3013 = !DILocation(line: 5172, column: 22, scope: !3011)
+!3014 = !DILocation(line: 5172, column: 30, scope: !3011)
+!3015 = !DILocation(line: 5172, column: 7, scope: !3011)
+!3016 = !DILocation(line: 5173, column: 28, scope: !3011)
+!3017 = !DILocation(line: 5174, column: 7, scope: !3011)
+!3018 = !DILocation(line: 5175, column: 28, scope: !3011)
+!3019 = !DILocation(line: 5176, column: 16, scope: !3011)
+!3020 = !DILocation(line: 5177, column: 17, scope: !3011)
+!3021 = !DILocation(line: 5178, column: 6, scope: !3011)
+!3022 = !DILocation(line: 5180, column: 30, scope: !3011)
+!3023 = !DILocation(line: 5182, column: 8, scope: !3011)
+!3024 = !DILocation(line: 5183, column: 11, scope: !3011)
+!3025 = !DILocation(line: 5184, column: 28, scope: !3011)
+!3026 = !DILocation(line: 5185, column: 27, scope: !3011)
+!3027 = !DILocation(line: 5186, column: 40, scope: !3011)
+!3028 = distinct !DISubprogram(name: "kernel_130", scope: !4, file: !4, line: 5210, type: !11, scopeLine: 5210, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!3029 = !DILocation(line: 5212, column: 16, scope: !3028)
+!3030 = !DILocation(line: 5213, column: 7, scope: !3028)
+!3031 = !DILocation(line: 5213, column: 27, scope: !3028)
+!3032 = !DILocation(line: 5214, column: 19, scope: !3028)
+!3033 = !DILocation(line: 5215, column: 7, scope: !3028)
+!3034 = !DILocation(line: 5217, column: 25, scope: !3028)
+!3035 = !DILocation(line: 5218, column: 7, scope: !3028)
+!3036 = !DILocation(line: 5220, column: 6, scope: !3028)
+!3037 = !DILocation(line: 5221, column: 22, scope: !3028)
+!3038 = !DILocation(line: 5222, column: 39, scope: !3028)
+!3039 = !DILocation(line: 5223, column: 8, scope: !3028)
+!3040 = !DILocation(line: 5224, column: 21, scope: !3028)
+!3041 = !DILocation(line: 5224, column: 26, scope: !3028)
+!3042 = !DILocation(line: 5225, column: 5, scope: !3028)
+!3043 = !DILocation(line: 5226, column: 27, scope: !3028)
+!3044 = !DILocation(line: 5227, column: 36, scope: !3028)
+!3045 = !DILocation(line: 5228, column: 18, scope: !3028)
+!3046 = !DILocation(line: 5230, column: 36, scope: !3028)
+!3047 = !DILocation(line: 5232, column: 33, scope: !3028)
+!3048 = distinct !{!3048, !26}
+!3049 = !DILocation(line: 5233, column: 6, scope: !3028)
+!3050 = distinct !DISubprogram(name: "kernel_131", scope: !5, file: !5, line: 5250, type: !11, scopeLine: 5250, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!3051 = !DILocation(line: 5252, column: 31, scope: !3050)
+!3052 = !DILocation(line: 5253, column: 27, scope: !3050)
+!3053 = !DILocation(line: 5254, column: 31, scope: !3050)
+!3054 = !DILocation(line: 5255, column: 12, scope: !3050)
+!3055 = !DILocation(line: 5256, column: 29, scope: !3050)
+!3056 = !DILocation(line: 5256, column: 8, scope: !3050)
+!3057 = !DILocation(line: 5257, column: 29, scope: !3050)
+!3058 = !DILocation(line: 5258, column: 26, scope: !3050)
+!3059 = !DILocation(line: 5259, column: 36, scope: !3050)
+!3060 = !DILocation(line: 5260, column: 20, scope: !3050)
+!3061 = !DILocation(line: 5261, column: 15, scope: !3050)
+!3062 = !DILocation(line: 5261, column: 17, scope: !3050)
+!3063 = !DILocation(line: 5263, column: 27, scope: !3050)
+!3064 = !DILocation(line: 5263, column: 21, scope: !3050)
+!3065 = !DILocation(line: 5263, column: 21, scope: !3050)
+!3066 = !DILocation(line: 5264, column: 9, scope: !3050)
+!3067 = !DILocation(line: 5265, column: 38, scope: !3050)
+!3068 = !DILocation(line: 5266, column: 36, scope: !3050)
+!3069 = !DILocation(line: 5266, column: 37, scope: !3050)
+!3070 = !DILocation(line: 5266, column: 12, scope: !3050)
+!3071 = distinct !DISubprogram(name: "kernel_132", scope: !6, file: !6, line: 5290, type: !11, scopeLine: 5290, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!3072 = !DILocation(line: 5292, column: 40, scope: !3071)
+!3073 = !DILocation(line: 5294, column: 6, scope: !3071)
+!3074 = !DILocation(line: 5294, column: 27, scope: !3071)
+!3075 = !DILocation(line: 5295, column: 36, scope: !3071)
+!3076 = !DILocation(line: 5295, column: 19, scope: !3071)
+!3077 = !DILocation(line: 5295, column: 7, scope: !3071)
+!3078 = !DILocation(line: 5296, column: 4, scope: !3071)
+!3079 = !DILocation(line: 5296, column: 14, scope: !3071)
+!3080 = !DILocation(line: 5297, column: 30, scope: !3071)
+!3081 = !DILocation(line: 5298, column: 33, scope: !3071)
+!3082 = !DILocation(line: 5299, column: 24, scope: !3071)
+!3083 = !DILocation(line: 5300, column: 25, scope: !3071)
+!3084 = distinct !DISubprogram(name: "kernel_133", scope: !7, file: !7, line: 5330, type: !11, scopeLine: 5330, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!3085 = !DILocation(line: 5330, column: 28, scope: !3084)
+!3086 = !DILocation(line: 5331, column: 11, scope: !3084)
+!3087 = !DILocation(line: 5332, column: 24, scope: !3084)
+!3088 = !DILocation(line: 5334, column: 22, scope: !3084)
+!3089 = !DILocation(line: 5335, column: 19, scope: !3084)
+!3090 = !DILocation(line: 5337, column: 30, scope: !3084)
+!3091 = !DILocation(line: 5338, column: 13, scope: !3084)
+!3092 = !DILocation(line: 5339, column: 15, scope: !3084)
+!3093 = !DILocation(line: 5340, column: 10, scope: !3084)
+!3094 = !DILocation(line: 5341, column: 34, scope: !3084)
+!3095 = !DILocation(line: 5342, column: 14, scope: !3084)
+!3096 = !DILocation(line: 5342, column: 8, scope: !3084)
+!3097 = !DILocation(line: 5344, column: 14, scope: !3084)
+!3098 = !DILocation(line: 5346, column: 24, scope: !3084)
+!3099 = !DILocation(line: 5346, column: 5, scope: !3084)
+!3100 = !DILocation(line: 5348, column: 25, scope: !3084)
+!3101 = !DILocation(line: 5350, column: 18, scope: !3084)
+!3102 = !DILocation(line: 5351, column: 6, scope: !3084)
+!3103 = !DILocation(line: 5351, column: 21, scope: !3084)
+!3104 = !DILocation(line: 5351, column: 8, scope: !3084)
+!3105 = !DILocation(line: 5352, column: 18, scope: !3084)
+!3106 = !DILocation(line: 5353, column: 21, scope: !3084)
+!3107 = !DILocation(line: 5353, column: 29, scope: !3084)
+!3108 = !DILocation(line: 5354, column: 22, scope: !3084)
+!3109 = !DILocation(line: 5354, column: 29, scope: !3084)
+!3110 = !DILocation(line: 5355, column: 11, scope: !3084)
+!3111 = distinct !DISubprogram(name: "kernel_134", scope: !8, file: !8, line: 5370, type: !11, scopeLine: 5370, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!3112 = !DILocation(line: 5371, column: 35, scope: !3111)
+!3113 = !DILocation(line: 5372, column: 3, scope: !3111)
+!3114 = !DILocation(line: 5372, column: 36, scope: !3111)
+!3115 = !DILocation(line: 5374, column: 23, scope: !3111)
+!3116 = !DILocation(line: 5375, column: 35, scope: !3111)
+!3117 = !DILocation(line: 5377, column: 4, scope: !3111)
+!3118 = !DILocation(line: 5378, column: 8, scope: !3111)
+!3119 = !DILocation(line: 5379, column: 3, scope: !3111)
+!3120 = !DILocation(line: 5380, column: 37, scope: !3111)
+!3121 = !DILocation(line: 5381, column: 10, scope: !3111)
+!3122 = !DILocation(line: 5383, column: 8, scope: !3111)
+!3123 = !DILocation(line: 5383, column: 24, scope: !3111)
+!3124 = !DILocation(line: 5383, column: 4, scope: !3111)
+!3125 = !DILocation(line: 5384, column: 18, scope: !3111)
+!3126 = !DILocation(line: 5384, column: 5, scope: !3111)
+!3127 = !DILocation(line: 5386, column: 26, scope: !3111)
+!3128 = !DILocation(line: 5386, column: 29, scope: !3111)
+!3129 = distinct !DISubprogram(name: "kernel_135", scope: !9, file: !9, line: 5410, type: !11, scopeLine: 5410, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!3130 = !DILocation(line: 5410, column: 13, scope: !3129)
+!3131 = !DILocation(line: 5410, column: 17, scope: !3129)
+!3132 = !DILocation(line: 5410, column: 32, scope: !3129)
+!3133 = !DILocation(line: 5410, column: 25, scope: !3129)
+!3134 = !DILocation(line: 5411, column: 31, scope: !3129)
+!3135 = !DILocation(line: 5413, column: 33, scope: !3129)
+!3136 = !DILocation(line: 5414, column: 20, scope: !3129)
+!3137 = !DILocation(line: 5415, column: 35, scope: !3129)
+!3138 = !DILocation(line: 5415, column: 37, scope: !3129)
+!3139 = !DILocation(line: 5417, column: 38, scope: !3129)
+!3140 = !DILocation(line: 5418, column: 19, scope: !3129)
+!3141 = !DILocation(line: 5418, column: 29, scope: !3129)
+!3142 = !DILocation(line: 5420, column: 17, scope: !3129)
+!3143 = !DILocation(line: 5421, column: 20, scope: !3129)
+!3144 = !DILocation(line: 5422, column: 31, scope: !3129)
+!3145 = !DILocation(line: 5424, column: 35, scope: !3129)
+!3146 = !DILocation(line: 5426, column: 13, scope: !3129)
+!3147 = !DILocation(line: 5427, column: 32, scope: !3129)
+!3148 = !DILocation(line: 5427, column: 26, scope: !3129)
+!3149 = distinct !{!3149, !26}
+!3150 = !DILocation(line: 5429, column: 16, scope: !3129)
+!3151 = distinct !DISubprogram(name: "kernel_136", scope: !2, file: !2, line: 5450, type: !11, scopeLine: 5450, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!3152 = !DILocation(line: 5450, column: 15, scope: !3151)
+!3153 = !DILocation(line: 5450, column: 37, scope: !3151)
+!3154 = !DILocation(line: 5451, column: 21, scope: !3151)
+!3155 = !DILocation(line: 5452, column: 27, scope: !3151)
+!3156 = !DILocation(line: 5453, column: 3, scope: !3151)
+!3157 = !DILocation(line: 5455, column: 16, scope: !3151)
+!3158 = !DILocation(line: 5457, column: 38, scope: !3151)
+!3159 = !DILocation(line: 5457, column: 18, scope: !3151)
+!3160 = !DILocation(line: 5458, column: 31, scope: !3151)
+!3161 = !DILocation(line: 5459, column: 3, scope: !3151)
+!3162 = !DILocation(line: 5459, column: 28, scope: !3151)
+!3163 = !DILocation(line: 5460, column: 9, scope: !3151)
+!3164 = !DILocation(line: 5460, column: 10, scope: !3151)
+!3165 = !DILocation(line: 5462, column: 35, scope: !3151)
+!3166 = !DILocation(line: 5462, column: 32, scope: !3151)
+!3167 = !DILocation(line: 5462, column: 14, scope: !3151)
+!3168 = !DILocation(line: 5463, column: 31, scope: !3151)
+!3169 = !DILocation(line: 5464, column: 3, scope: !3151)
+!3170 = !DILocation(line: 5464, column: 36, scope: !3151)
+!3171 = !DILocation(line: 5465, column: 7, scope: !3151)
+!3172 = distinct !DISubprogram(name: "kernel_137", scope: !3, file: !3, line: 5490, type: !11, scopeLine: 5490, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!3173 = !DILocation(line: 5491, column: 24, scope: !3172)
+!3174 = !DILocation(line: 5492, column: 17, scope: !3172)
+!3175 = !DILocation(line: 5492, column: 8, scope: !3172)
+!3176 = !DILocation(line: 5493, column: 14, scope: !3172)
+!3177 = !DILocation(line: 5494, column: 23, scope: !3172)
+!3178 = !DILocation(line: 5495, column: 17, scope: !3172)
+!3179 = !DILocation(line: 5497, column: 27, scope: !3172)
+!3180 = !DILocation(line: 5498, column: 10, scope: !3172)
+!3181 = !DILocation(line: 5498, column: 33, scope: !3172)
+!3182 = !DILocation(line: 5499, column: 39, scope: !3172)
+!3183 = !DILocation(line: 5500, column: 20, scope: !3172)
+!3184 = !DILocation(line: 5501, column: 25, scope: !3172)
+!3185 = !DILocation(line: 5502, column: 36, scope: !3172)
+!3186 = !DILocation(line: 5502, column: 33, scope: !3172)
+!3187 = distinct !DISubprogram(name: "kernel_138", scope: !4, file: !4, line: 5530, type: !11, scopeLine: 5530, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!3188 = !DILocation(line: 5532, column: 9, scope: !3187)
+!3189 = !DILocation(line: 5534, column: 12, scope: !3187)
+!3190 = !DILocation(line: 5534, column: 31, scope: !3187)
+!3191 = !DILocation(line: 5534, column: 28, scope: !3187)
+!3192 = !DILocation(line: 5535, column: 10, scope: !3187)
+!3193 = !DILocation(line: 5536, column: 29, scope: !3187)
+!3194 = !DILocation(line: 5537, column: 13, scope: !3187)
+!3195 = !DILocation(line: 5538, column: 17, scope: !3187)
+!3196 = !DILocation(line: 5538, column: 5, scope: !3187)
+!3197 = !DILocation(line: 5539, column: 3, scope: !3187)
+!3198 = !DILocation(line: 5540, column: 16, scope: !3187)
+!3199 = !DILocation(line: 5540, column: 16, scope: !3187)
+!3200 = !DILocation(line: 5542, column: 39, scope: !3187)
+!3201 = !DILocation(line: 5544, column: 4, scope: !3187)
+!3202 = !DILocation(line: 5545, column: 37, scope: !3187)
+!3203 = !DILocation(line: 5547, column: 27, scope: !3187)
+!3204 = !DILocation(line: 5549, column: 9, scope: !3187)
+!3205 = !DILocation(line: 5549, column: 4, scope: !3187)
+!3206 = !DILocation(line: 5550, column: 15, scope: !3187)
+!3207 = !DILocation(line: 5551, column: 26, scope: !3187)
+!3208 = !DILocation(line: 5552, column: 16, scope: !3187)
+!3209 = !DILocation(line: 5553, column: 15, scope: !3187)
+!3210 = !DILocation(line: 5554, column: 23, scope: !3187)
+!3211 = !DILocation(line: 5554, column: 40, scope: !3187)
+!3212 = !DILocation(line: 5554, column: 7, scope: !3187)
+!3213 = !DILocation(line: 5554, column: 10, scope: !3187)
+!3214 = !DILocation(line: 5555, column: 26, scope: !3187)
+!3215 = !DILocation(line: 5557, column: 26, scope: !3187)
+!3216 = !DILocation(line: 5557, column: 6, scope: !3187)
+!3217 = !DILocation(line: 5558, column: 27, scope: !3187)
+!3218 = !DILocation(line: 5558, column: 15, scope: !3187)
+!3219 = !DILocation(line: 5558, column: 26, scope: !3187)
+!3220 = distinct !DISubprogram(name: "kernel_139", scope: !5, file: !5, line: 5570, type: !11, scopeLine: 5570, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!3221 = !DILocation(line: 5571, column: 16, scope: !3220)
+!3222 = !DILocation(line: 5571, column: 18, scope: !3220)
+!3223 = !DILocation(line: 5572, column: 4, scope: !3220)
+!3224 = !DILocation(line: 5572, column: 32, scope: !3220)
+!3225 = !DILocation(line: 5572, column: 12, scope: !3220)
+!3226 = !DILocation(line: 5574, column: 26, scope: !3220)
+!3227 = !DILocation(line: 5576, column: 30, scope: !3220)
+!3228 = !DILocation(line: 5578, column: 35, scope: !3220)
+!3229 = !DILocation(line: 5580, column: 39, scope: !3220)
+!3230 = !DILocation(line: 5582, column: 4, scope: !3220)
+!3231 = !DILocation(line: 5582, column: 36, scope: !3220)
+!3232 = !DILocation(line: 5583, column: 11, scope: !3220)
+!3233 = !DILocation(line: 5584, column: 11, scope: !3220)
+!3234 = !DILocation(line: 5584, column: 16, scope: !3220)
+!3235 = !DILocation(line: 5584, column: 19, scope: !3220)
+!3236 = !DILocation(line: 5585, column: 16, scope: !3220)
+!3237 = distinct !DISubprogram(name: "kernel_140", scope: !6, file: !6, line: 5610, type: !11, scopeLine: 5610, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!3238 = !DILocation(line: 5611, column: 23, scope: !3237)
+!3239 = !DILocation(line: 5612, column: 3, scope: !3237)
+!3240 = !DILocation(line: 5613, column: 15, scope: !3237)
+!3241 = !DILocation(line: 5613, column: 29, scope: !3237)
+!3242 = !DILocation(line: 5613, column: 39, scope: !3237)
+!3243 = !DILocation(line: 5614, column: 33, scope: !3237)
+!3244 = !DILocation(line: 5614, column: 3, scope: !3237)
+!3245 = !DILocation(line: 5615, column: 40, scope: !3237)
+!3246 = !DILocation(line: 5616, column: 30, scope: !3237)
+!3247 = !DILocation(line: 5616, column: 10, scope: !3237)
+!3248 = !DILocation(line: 5618, column: 13, scope: !3237)
+!3249 = !DILocation(line: 5619, column: 36, scope: !3237)
+!3250 = !DILocation(line: 5619, column: 27, scope: !3237)
+!3251 = !DILocation(line: 5620, column: 40, scope: !3237)
+!3252 = !DILocation(line: 5622, column: 32, scope: !3237)
+!3253 = !DILocation(line: 5623, column: 27, scope: !3237)
+!3254 = !DILocation(line: 5625, column: 40, scope: !3237)
+!3255 = !DILocation(line: 5626, column: 22, scope: !3237)
+!3256 = !DILocation(line: 5627, column: 11, scope: !3237)
+!3257 = distinct !{!3257, !26}
+!3258 = !DILocation(line: 5628, column: 8, scope: !3237)
+!3259 = distinct !DISubprogram(name: "kernel_141", scope: !7, file: !7, line: 5650, type: !11, scopeLine: 5650, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!3260 = !DILocation(line: 5650, column: 9, scope: !3259)
+!3261 = !DILocation(line: 5650, column: 30, scope: !3259)
+!3262 = !DILocation(line: 5652, column: 10, scope: !3259)
+!3263 = !DILocation(line: 5653, column: 37, scope: !3259)
+!3264 = !DILocation(line: 5653, column: 5, scope: !3259)
+!3265 = !DILocation(line: 5655, column: 36, scope: !3259)
+!3266 = !DILocation(line: 5656, column: 21, scope: !3259)
+!3267 = !DILocation(line: 5657, column: 24, scope: !3259)
+!3268 = !DILocation(line: 5657, column: 32, scope: !3259)
+!3269 = !DILocation(line: 5658, column: 28, scope: !3259)
+!3270 = !DILocation(line: 5660, column: 34, scope: !3259)
+!3271 = !DILocation(line: 5661, column: 30, scope: !3259)
+!3272 = !DILocation(line: 5662, column: 14, scope: !3259)
+!3273 = !DILocation(line: 5663, column: 31, scope: !3259)
+!3274 = !DILocation(line: 5665, column: 26, scope: !3259)
+!3275 = !DILocation(line: 5665, column: 18, scope: !3259)
+!3276 = !DILocation(line: 5665, column: 6, scope: !3259)
+!3277 = !DILocation(line: 5666, column: 19, scope: !3259)
+!3278 = !DILocation(line: 5668, column: 12, scope: !3259)
+!3279 = !DILocation(line: 5669, column: 40, scope: !3259)
+!3280 = distinct !DISubprogram(name: "kernel_142", scope: !8, file: !8, line: 5690, type: !11, scopeLine: 5690, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!3281 = !DILocation(line: 5691, column: 20, scope: !3280)
+!3282 = !DILocation(line: 5692, column: 39, scope: !3280)
+!3283 = !DILocation(line: 5694, column: 19, scope: !3280)
+!3284 = !DILocation(line: 5696, column: 17, scope: !3280)
+!3285 = !DILocation(line: 5696, column: 6, scope: !3280)
+!3286 = !DILocation(line: 5696, column: 34, scope: !3280)
+!3287 = !DILocation(line: 5698, column: 21, scope: !3280)
+!3288 = !DILocation(line: 5700, column: 11, scope: !3280)
+!3289 = !DILocation(line: 5700, column: 28, scope: !3280)
+!3290 = !DILocation(line: 5701, column: 12, scope: !3280)
+!3291 = !DILocation(line: 5701, column: 4, scope: !3280)
+!3292 = !DILocation(line: 5703, column: 3, scope: !3280)
+!3293 = !DILocation(line: 5704, column: 18, scope: !3280)
+!3294 = !DILocation(line: 5705, column: 38, scope: !3280)
+!3295 = !DILocation(line: 5706, column: 27, scope: !3280)
+!3296 = !DILocation(line: 5707, column: 36, scope: !3280)
+!3297 = !DILocation(line: 5708, column: 20, scope: !3280)
+!3298 = !DILocation(line: 5708, column: 24, scope: !3280)
+!3299 = distinct !DISubprogram(name: "kernel_143", scope: !9, file: !9, line: 5730, type: !11, scopeLine: 5730, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!3300 = !DILocation(line: 5731, column: 18, scope: !3299)
+!3301 = !DILocation(line: 5733, column: 26, scope: !3299)
+!3302 = !DILocation(line: 5735, column: 36, scope: !3299)
+!3303 = !DILocation(line: 5735, column: 9, scope: !3299)
+!3304 = !DILocation(line: 5737, column: 30, scope: !3299)
+!3305 = !DILocation(line: 5738, column: 22, scope: !3299)
+!3306 = !DILocation(line: 5739, column: 23, scope: !3299)
+!3307 = !DILocation(line: 5741, column: 40, scope: !3299)
+!3308 = !DILocation(line: 5742, column: 12, scope: !3299)
+!3309 = !DILocation(line: 5743, column: 28, scope: !3299)
+!3310 = !DILocation(line: 5744, column: 14, scope: !3299)
+!3311 = !DILocation(line: 5746, column: 25, scope: !3299)
+!3312 = !DILocation(line: 5747, column: 25, scope: !3299)
+!3313 = !DILocation(line: 5748, column: 35, scope: !3299)
+!3314 = !DILocation(line: 5749, column: 34, scope: !3299)
+!3315 = !DILocation(line: 5750, column: 18, scope: !3299)
+!3316 = !DILocation(line: 5750, column: 30, scope: !3299)
+!3317 = !DILocation(line: 5751, column: 9, scope: !3299)
+!3318 = !DILocation(line: 5751, column: 34, scope: !3299)
+!3319 = !DILocation(line: 5753, column: 31, scope: !3299)
+!3320 = !DILocation(line: 5754, column: 27, scope: !3299)
+!3321 = !DILocation(line: 5754, column: 25, scope: !3299)
+!3322 = !DILocation(line: 5755, column: 35, scope: !3299)
+!3323 = !DILocation(line: 5756, column: 5, scope: !3299)
+!3324 = !DILocation(line: 5757, column: 27, scope: !3299)
+!3325 = !DILocation(line: 5757, column: 39, scope: !3299)
+!3326 = !DILocation(line: 5759, column: 27, scope: !3299)
+!3327 = !DILocation(line: 5761, column: 19, scope: !3299)
+!3328 = !DILocation(line: 5762, column: 12, scope: !3299)
+!3329 = !DILocation(line: 5764, column: 4, scope: !3299)
+!3330 = !DILocation(line: 5766, column: 13, scope: !3299)
+!3331 = !DILocation(line: 5767, column: 11, scope: !3299)
+!3332 = !DILocation(line: 5767, column: 27, scope: !3299)
+!3333 = !DILocation(line: 5768, column: 7, scope: !3299)
+!3334 = !DILocation(line: 5769, column: 14, scope: !3299)
+!3335 = !DILocation(line: 5769, column: 27, scope: !3299)
+!3336 = !DILocation(line: 5770, column: 37, scope: !3299)
+!3337 = !DILocation(line: 5770, column: 27, scope: !3299)
+!3338 = !DILocation(line: 5772, column: 31, scope: !3299)
+!3339 = !DILocation(line: 5773, column: 23, scope: !3299)
+!3340 = !DILocation(line: 5774, column: 23, scope: !3299)
+!3341 = !DILocation(line: 5776, column: 7, scope: !3299)
+!3342 = !DILocation(line: 5777, column: 14, scope: !3299)
+!3343 = !DILocation(line: 5778, column: 3, scope: !3299)
+!3344 = !DILocation(line: 5780, column: 13, scope: !3299)
+!3345 = !DILocation(line: 5782, column: 28, scope: !3299)
+!3346 = !DILocation(line: 5783, column: 22, scope: !3299)
+!3347 = distinct !DISubprogram(name: "kernel_144", scope: !2, file: !2, line: 5770, type: !11, scopeLine: 5770, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!3348 = !DILocation(line: 5772, column: 10, scope: !3347)
+!3349 = !DILocation(line: 5774, column: 3, scope: !3347)
+!3350 = !DILocation(line: 5775, column: 10, scope: !3347)
+!3351 = !DILocation(line: 5776, column: 9, scope: !3347)
+!3352 = !DILocation(line: 5777, column: 24, scope: !3347)
+!3353 = !DILocation(line: 5777, column: 38, scope: !3347)
+!3354 = !DILocation(line: 5777, column: 32, scope: !3347)
+!3355 = !DILocation(line: 5777, column: 35, scope: !3347)
+!3356 = !DILocation(line: 5778, column: 35, scope: !3347)
+!3357 = !DILocation(line: 5779, column: 38, scope: !3347)
+!3358 = !DILocation(line: 5781, column: 5, scope: !3347)
+!3359 = !DILocation(line: 5781, column: 36, scope: !3347)
+!3360 = !DILocation(line: 5782, column: 37, scope: !3347)
+!3361 = !DILocation(line: 5782, column: 11, scope: !3347)
+!3362 = !DILocation(line: 5782, column: 27, scope: !3347)
+!3363 = !DILocation(line: 5783, column: 16, scope: !3347)
+!3364 = !DILocation(line: 5783, column: 4, scope: !3347)
+!3365 = distinct !DISubprogram(name: "kernel_145", scope: !3, file: !3, line: 5810, type: !11, scopeLine: 5810, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!3366 = !DILocation(line: 5811, column: 30, scope: !3365)
+!3367 = !DILocation(line: 5811, column: 13, scope: !3365)
+!3368 = !DILocation(line: 5813, column: 19, scope: !3365)
+!3369 = !DILocation(line: 5814, column: 16, scope: !3365)
+!3370 = !DILocation(line: 5814, column: 40, scope: !3365)
+!3371 = !DILocation(line: 5816, column: 40, scope: !3365)
+!3372 = !DILocation(line: 5816, column: 20, scope: !3365)
+!3373 = !DILocation(line: 5817, column: 39, scope: !3365)
+!3374 = !DILocation(line: 5818, column: 24, scope: !3365)
+!3375 = !DILocation(line: 5819, column: 21, scope: !3365)
+!3376 = !DILocation(line: 5821, column: 9, scope: !3365)
+!3377 = !DILocation(line: 5823, column: 17, scope: !3365)
+!3378 = !DILocation(line: 5825, column: 4, scope: !3365)
+!3379 = !DILocation(line: 5826, column: 33, scope: !3365)
+!3380 = !DILocation(line: 5827, column: 9, scope: !3365)
+!3381 = !DILocation(line: 5828, column: 38, scope: !3365)
+!3382 = !DILocation(line: 5829, column: 34, scope: !3365)
+!3383 = !DILocation(line: 5830, column: 30, scope: !3365)
+!3384 = !DILocation(line: 5830, column: 27, scope: !3365)
+!3385 = distinct !{!3385, !26}
+!3386 = !DILocation(line: 5830, column: 39, scope: !3365)
+!3387 = distinct !DISubprogram(name: "kernel_146", scope: !4, file: !4, line: 5850, type: !11, scopeLine: 5850, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!3388 = !DILocation(line: 5852, column: 39, scope: !3387)
+!3389 = !DILocation(line: 5854, column: 19, scope: !3387)
+!3390 = !DILocation(line: 5854, column: 34, scope: !3387)
+!3391 = !DILocation(line: 5856, column: 4, scope: !3387)
+!3392 = !DILocation(line: 5856, column: 6, scope: !3387)
+!3393 = !DILocation(line: 5857, column: 21, scope: !3387)
+!3394 = !DILocation(line: 5858, column: 6, scope: !3387)
+!3395 = !DILocation(line: 5860, column: 19, scope: !3387)
+!3396 = !DILocation(line: 5861, column: 14, scope: !3387)
+!3397 = !DILocation(line: 5862, column: 27, scope: !3387)
+!3398 = !DILocation(line: 5864, column: 21, scope: !3387)
+!3399 = !DILocation(line: 5864, column: 13, scope: !3387)
+!3400 = !DILocation(line: 5865, column: 10, scope: !3387)
+!3401 = !DILocation(line: 5866, column: 23, scope: !3387)
+!3402 = !DILocation(line: 5866, column: 18, scope: !3387)
+!3403 = !DILocation(line: 5868, column: 17, scope: !3387)
+!3404 = !DILocation(line: 5869, column: 29, scope: !3387)
+!3405 = !DILocation(line: 5871, column: 26, scope: !3387)
+!3406 = !DILocation(line: 5873, column: 28, scope: !3387)
+!3407 = !DILocation(line: 5873, column: 15, scope: !3387)
+!3408 = distinct !DISubprogram(name: "kernel_147", scope: !5, file: !5, line: 5890, type: !11, scopeLine: 5890, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!3409 = !DILocation(line: 5892, column: 40, scope: !3408)
+!3410 = !DILocation(line: 5893, column: 13, scope: !3408)
+!3411 = !DILocation(line: 5894, column: 36, scope: !3408)
+!3412 = !DILocation(line: 5895, column: 38, scope: !3408)
+!3413 = !DILocation(line: 5896, column: 26, scope: !3408)
+!3414 = !DILocation(line: 5896, column: 11, scope: !3408)
+!3415 = !DILocation(line: 5897, column: 13, scope: !3408)
+!3416 = !DILocation(line: 5897, column: 13, scope: !3408)
+!3417 = !DILocation(line: 5898, column: 25, scope: !3408)
+!3418 = !DILocation(line: 5898, column: 19, scope: !3408)
+!3419 = !DILocation(line: 5900, column: 28, scope: !3408)
+!3420 = !DILocation(line: 5901, column: 34, scope: !3408)
+!3421 = !DILocation(line: 5901, column: 4, scope: !3408)
+!3422 = !DILocation(line: 5902, column: 23, scope: !3408)
+!3423 = !DILocation(line: 5903, column: 7, scope: !3408)
+!3424 = !DILocation(line: 5904, column: 16, scope: !3408)
+!3425 = distinct !DISubprogram(name: "kernel_148", scope: !6, file: !6, line: 5930, type: !11, scopeLine: 5930, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!3426 = !DILocation(line: 5931, column: 6, scope: !3425)
+!3427 = !DILocation(line: 5932, column: 36, scope: !3425)
+!3428 = !DILocation(line: 5933, column: 21, scope: !3425)
+!3429 = !DILocation(line: 5933, column: 26, scope: !3425)
+!3430 = !DILocation(line: 5934, column: 27, scope: !3425)
+!3431 = !DILocation(line: 5935, column: 40, scope: !3425)
+!3432 = !DILocation(line: 5937, column: 25, scope: !3425)
+!3433 = !DILocation(line: 5937, column: 37, scope: !3425)
+!3434 = !DILocation(line: 5938, column: 37, scope: !3425)
+!3435 = !DILocation(line: 5940, column: 33, scope: !3425)
+!3436 = !DILocation(line: 5940, column: 34, scope: !3425)
+!3437 = !DILocation(line: 5940, column: 15, scope: !3425)
+!3438 = !DILocation(line: 5940, column: 13, scope: !3425)
+!3439 = !DILocation(line: 5940, column: 35, scope: !3425)
+!3440 = !DILocation(line: 5941, column: 27, scope: !3425)
+!3441 = !DILocation(line: 5941, column: 32, scope: !3425)
+!3442 = !DILocation(line: 5943, column: 29, scope: !3425)
+!3443 = !DILocation(line: 5945, column: 30, scope: !3425)
+!3444 = !DILocation(line: 5946, column: 16, scope: !3425)
+!3445 = !DILocation(line: 5947, column: 9, scope: !3425)
+!3446 = !DILocation(line: 5948, column: 18, scope: !3425)
+!3447 = !DILocation(line: 5950, column: 12, scope: !3425)
+!3448 = !DILocation(line: 5950, column: 15, scope: !3425)
+!3449 = !DILocation(line: 5951, column: 24, scope: !3425)
+!3450 = !DILocation(line: 5951, column: 20, scope: !3425)
+!3451 = !DILocation(line: 5952, column: 4, scope: !3425)
+!3452 = !DILocation(line: 5954, column: 12, scope: !3425)
+!3453 = !DILocation(line: 5955, column: 24, scope: !3425)
+!3454 = !DILocation(line: 5956, column: 34, scope: !3425)
+!3455 = !DILocation(line: 5958, column: 4, scope: !3425)
+!3456 = !DILocation(line: 5958, column: 16, scope: !3425)
+!3457 = !DILocation(line: 5959, column: 20, scope: !3425)
+!3458 = !DILocation(line: 5959, column: 29, scope: !3425)
+!3459 = !DILocation(line: 5959, column: 7, scope: !3425)
+!3460 = !DILocation(line: 5960, column: 27, scope: !3425)
+!3461 = !DILocation(line: 5961, column: 26, scope: !3425)
+!3462 = !DILocation(line: 5962, column: 29, scope: !3425)
+!3463 = !DILocation(line: 5963, column: 14, scope: !3425)
+!3464 = !DILocation(line: 5964, column: 30, scope: !3425)
+!3465 = !DILocation(line: 5964, column: 4, scope: !3425)
+!3466 = !DILocation(line: 5965, column: 15, scope: !3425)
+!3467 = !DILocation(line: 5966, column: 36, scope: !3425)
+!3468 = !DILocation(line: 5968, column: 14, scope: !3425)
+!3469 = !DILocation(line: 5970, column: 32, scope: !3425)
+!3470 = distinct !DISubprogram(name: "kernel_149", scope: !7, file: !7, line: 5970, type: !11, scopeLine: 5970, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!3471 = !DILocation(line: 5970, column: 16, scope: !3470)
+!3472 = !DILocation(line: 5972, column: 18, scope: !3470)
+!3473 = !DILocation(line: 5973, column: 33, scope: !3470)
+!3474 = !DILocation(line: 5974, column: 18, scope: !3470)
+!3475 = !DILocation(line: 5976, column: 29, scope: !3470)
+!3476 = !DILocation(line: 5978, column: 37, scope: !3470)
+!3477 = !DILocation(line: 5980, column: 15, scope: !3470)
+!3478 = !DILocation(line: 5981, column: 6, scope: !3470)
+!3479 = !DILocation(line: 5983, column: 4, scope: !3470)
+!3480 = !DILocation(line: 5985, column: 14, scope: !3470)
+!3481 = !DILocation(line: 5987, column: 16, scope: !3470)
+!3482 = !DILocation(line: 5988, column: 10, scope: !3470)
+!3483 = !DILocation(line: 5990, column: 38, scope: !3470)
+!3484 = !DILocation(line: 5992, column: 37, scope: !3470)
+!3485 = !DILocation(line: 5993, column: 15, scope: !3470)
+!3486 = !DILocation(line: 5995, column: 8, scope: !3470)
+!3487 = distinct !DISubprogram(name: "kernel_150", scope: !8, file: !8, line: 6010, type: !11, scopeLine: 6010, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!3488 = !DILocation(line: 6012, column: 24, scope: !3487)
+!3489 = !DILocation(line: 6013, column: 7, scope: !3487)
+!3490 = !DILocation(line: 6014, column: 21, scope: !3487)
+!3491 = !DILocation(line: 6014, column: 31, scope: !3487)
+!3492 = !DILocation(line: 6015, column: 33, scope: !3487)
+!3493 = !DILocation(line: 6015, column: 19, scope: !3487)
+!3494 = !DILocation(line: 6016, column: 5, scope: !3487)
+!3495 = !DILocation(line: 6016, column: 20, scope: !3487)
+!3496 = !DILocation(line: 6016, column: 40, scope: !3487)
+!3497 = !DILocation(line: 6018, column: 7, scope: !3487)
+!3498 = !DILocation(line: 6018, column: 36, scope: !3487)
+!3499 = !DILocation(line: 6018, column: 34, scope: !3487)
+!3500 = !DILocation(line: 6020, column: 29, scope: !3487)
+!3501 = !DILocation(line: 6021, column: 27, scope: !3487)
+!3502 = !DILocation(line: 6022, column: 13, scope: !3487)
+!3503 = !DILocation(line: 6024, column: 31, scope: !3487)
+!3504 = !DILocation(line: 6026, column: 9, scope: !3487)
+!3505 = !DILocation(line: 6026, column: 7, scope: !3487)
+!3506 = !DILocation(line: 6027, column: 25, scope: !3487)
+!3507 = distinct !{!3507, !26}
+!3508 = !DILocation(line: 6028, column: 18, scope: !3487)
+!3509 = distinct !DISubprogram(name: "kernel_151", scope: !9, file: !9, line: 6050, type: !11, scopeLine: 6050, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!3510 = !DILocation(line: 6051, column: 40, scope: !3509)
+!3511 = !DILocation(line: 6052, column: 14, scope: !3509)
+!3512 = !DILocation(line: 6052, column: 31, scope: !3509)
+!3513 = !DILocation(line: 6053, column: 24, scope: !3509)
+!3514 = !DILocation(line: 6054, column: 33, scope: !3509)
+!3515 = !DILocation(line: 6055, column: 33, scope: !3509)
+!3516 = !DILocation(line: 6056, column: 40, scope: !3509)
+!3517 = !DILocation(line: 6057, column: 29, scope: !3509)
+!3518 = !DILocation(line: 6059, column: 16, scope: !3509)
+!3519 = !DILocation(line: 6060, column: 26, scope: !3509)
+!3520 = !DILocation(line: 6060, column: 38, scope: !3509)
+!3521 = !DILocation(line: 6060, column: 3, scope: !3509)
+!3522 = !DILocation(line: 6062, column: 3, scope: !3509)
+!3523 = !DILocation(line: 6063, column: 29, scope: !3509)
+!3524 = !DILocation(line: 6065, column: 22, scope: !3509)
+!3525 = !DILocation(line: 6066, column: 16, scope: !3509)
+!3526 = !DILocation(line: 6068, column: 32, scope: !3509)
+!3527 = !DILocation(line: 6068, column: 12, scope: !3509)
+!3528 = !DILocation(line: 6068, column: 12, scope: !3509)
+!3529 = !DILocation(line: 6069, column: 39, scope: !3509)
+!3530 = distinct !DISubprogram(name: "kernel_152", scope: !2, file: !2, line: 6090, type: !11, scopeLine: 6090, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!3531 = !DILocation(line: 6092, column: 27, scope: !3530)
+!3532 = !DILocation(line: 6094, column: 13, scope: !3530)
+!3533 = !DILocation(line: 6096, column: 29, scope: !3530)
+!3534 = !DILocation(line: 6097, column: 3, scope: !3530)
+!3535 = !DILocation(line: 6098, column: 27, scope: !3530)
+!3536 = !DILocation(line: 6098, column: 4, scope: !3530)
+!3537 = !DILocation(line: 6100, column: 27, scope: !3530)
+!3538 = !DILocation(line: 6101, column: 29, scope: !3530)
+!3539 = !DILocation(line: 6102, column: 38, scope: !3530)
+!3540 = !DILocation(line: 6103, column: 4, scope: !3530)
+!3541 = !DILocation(line: 6103, column: 34, scope: !3530)
+!3542 = !DILocation(line: 6105, column: 32, scope: !3530)
+!3543 = distinct !DISubprogram(name: "kernel_153", scope: !3, file: !3, line: 6130, type: !11, scopeLine: 6130, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!3544 = !DILocation(line: 6132, column: 16, scope: !3543)
+!3545 = !DILocation(line: 6133, column: 38, scope: !3543)
+!3546 = !DILocation(line: 6133, column: 34, scope: !3543)
+!3547 = !DILocation(line: 6134, column: 6, scope: !3543)
+!3548 = !DILocation(line: 6135, column: 14, scope: !3543)
+!3549 = !DILocation(line: 6135, column: 32, scope: !3543)
+!3550 = !DILocation(line: 6137, column: 21, scope: !3543)
+!3551 = !DILocation(line: 6139, column: 24, scope: !3543)
+!3552 = !DILocation(line: 6140, column: 12, scope: !3543)
+!3553 = !DILocation(line: 6141, column: 3, scope: !3543)
+!3554 = !DILocation(line: 6143, column: 37, scope: !3543)
+!3555 = !DILocation(line: 6145, column: 7, scope: !3543)
+!3556 = !DILocation(line: 6146, column: 3, scope: !3543)
+!3557 = !DILocation(line: 6148, column: 31, scope: !3543)
+!3558 = !DILocation(line: 6149, column: 4, scope: !3543)
+!3559 = !DILocation(line: 6150, column: 14, scope: !3543)
+!3560 = !DILocation(line: 6152, column: 31, scope: !3543)
+!3561 = !DILocation(line: 6153, column: 33, scope: !3543)
+!3562 = !DILocation(line: 6155, column: 33, scope: !3543)
+!3563 = !DILocation(line: 6156, column: 39, scope: !3543)
+!3564 = !DILocation(line: 6157, column: 36, scope: !3543)
+!3565 = !DILocation(line: 6158, column: 4, scope: !3543)
+!3566 = !DILocation(line: 6159, column: 35, scope: !3543)
+!3567 = !DILocation(line: 6161, column: 15, scope: !3543)
+!3568 = !DILocation(line: 6161, column: 22, scope: !3543)
+!3569 = !DILocation(line: 6162, column: 8, scope: !3543)
+!3570 = !DILocation(line: 6164, column: 9, scope: !3543)
+!3571 = !DILocation(line: 6165, column: 4, scope: !3543)
+!3572 = !DILocation(line: 6166, column: 32, scope: !3543)
+!3573 = !DILocation(line: 6166, column: 31, scope: !3543)
+!3574 = !DILocation(line: 6167, column: 13, scope: !3543)
+!3575 = !DILocation(line: 6168, column: 19, scope: !3543)
+!3576 = !DILocation(line: 6169, column: 26, scope: !3543)
+!3577 = !DILocation(line: 6170, column: 10, scope: !3543)
+!3578 = !DILocation(line: 6172, column: 38, scope: !3543)
+!3579 = !DILocation(line: 6173, column: 18, scope: !3543)
+!3580 = !DILocation(line: 6174, column: 32, scope: !3543)
+!3581 = !DILocation(line: 6175, column: 23, scope: !3543)
+!3582 = !DILocation(line: 6175, column: 29, scope: !3543)
+!3583 = !DILocation(line: 6175, column: 21, scope: !3543)
+!3584 = !DILocation(line: 6176, column: 11, scope: !3543)
+!3585 = !DILocation(line: 6178, column: 19, scope: !3543)
+!3586 = !DILocation(line: 6180, column: 14, scope: !3543)
+!3587 = !DILocation(line: 6181, column: 32, scope: !3543)
+!3588 = distinct !DISubprogram(name: "kernel_154", scope: !4, file: !4, line: 6170, type: !11, scopeLine: 6170, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!3589 = !DILocation(line: 6171, column: 19, scope: !3588)
+!3590 = !DILocation(line: 6172, column: 32, scope: !3588)
+!3591 = !DILocation(line: 6173, column: 36, scope: !3588)
+!3592 = !DILocation(line: 6174, column: 22, scope: !3588)
+!3593 = !DILocation(line: 6175, column: 21, scope: !3588)
+!3594 = !DILocation(line: 6175, column: 10, scope: !3588)
+!3595 = !DILocation(line: 6177, column: 7, scope: !3588)
+!3596 = !DILocation(line: 6178, column: 9, scope: !3588)
+!3597 = !DILocation(line: 6179, column: 25, scope: !3588)
+!3598 = !DILocation(line: 6180, column: 37, scope: !3588)
+!3599 = !DILocation(line: 6180, column: 9, scope: !3588)
+!3600 = !DILocation(line: 6181, column: 3, scope: !3588)
+!3601 = !DILocation(line: 6182, column: 39, scope: !3588)
+!3602 = !DILocation(line: 6184, column: 34, scope: !3588)
+!3603 = !DILocation(line: 6184, column: 24, scope: !3588)
+!3604 = !DILocation(line: 6185, column: 5, scope: !3588)
+!3605 = !DILocation(line: 6186, column: 20, scope: !3588)
+!3606 = distinct !DISubprogram(name: "kernel_155", scope: !5, file: !5, line: 6210, type: !11, scopeLine: 6210, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!3607 = !DILocation(line: 6211, column: 29, scope: !3606)
+!3608 = !DILocation(line: 6212, column: 30, scope: !3606)
+!3609 = !DILocation(line: 6214, column: 26, scope: !3606)
+!3610 = !DILocation(line: 6216, column: 21, scope: !3606)
+!3611 = !DILocation(line: 6218, column: 29, scope: !3606)
+!3612 = !DILocation(line: 6219, column: 30, scope: !3606)
+!3613 = !DILocation(line: 6219, column: 22, scope: !3606)
+!3614 = !DILocation(line: 6220, column: 33, scope: !3606)
+!3615 = !DILocation(line: 6220, column: 18, scope: !3606)
+!3616 = !DILocation(line: 6220, column: 24, scope: !3606)
+!3617 = !DILocation(line: 6221, column: 40, scope: !3606)
+!3618 = !DILocation(line: 6222, column: 16, scope: !3606)
+!3619 = !DILocation(line: 6224, column: 31, scope: !3606)
+!3620 = !DILocation(line: 6224, column: 24, scope: !3606)
+!3621 = !DILocation(line: 6224, column: 22, scope: !3606)
+!3622 = !DILocation(line: 6226, column: 26, scope: !3606)
+!3623 = !DILocation(line: 6226, column: 33, scope: !3606)
+!3624 = !DILocation(line: 6226, column: 39, scope: !3606)
+!3625 = !DILocation(line: 6228, column: 32, scope: !3606)
+!3626 = distinct !{!3626, !26}
+!3627 = !DILocation(line: 6229, column: 21, scope: !3606)
+!3628 = distinct !DISubprogram(name: "kernel_156", scope: !6, file: !6, line: 6250, type: !11, scopeLine: 6250, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!3629 = !DILocation(line: 6251, column: 37, scope: !3628)
+!3630 = !DILocation(line: 6253, column: 21, scope: !3628)
+!3631 = !DILocation(line: 6254, column: 38, scope: !3628)
+!3632 = !DILocation(line: 6254, column: 14, scope: !3628)
+!3633 = !DILocation(line: 6255, column: 22, scope: !3628)
+!3634 = !DILocation(line: 6257, column: 11, scope: !3628)
+!3635 = !DILocation(line: 6259, column: 31, scope: !3628)
+!3636 = !DILocation(line: 6261, column: 39, scope: !3628)
+!3637 = !DILocation(line: 6262, column: 3, scope: !3628)
+!3638 = !DILocation(line: 6263, column: 12, scope: !3628)
+!3639 = !DILocation(line: 6264, column: 16, scope: !3628)
+!3640 = !DILocation(line: 6265, column: 37, scope: !3628)
+!3641 = !DILocation(line: 6267, column: 30, scope: !3628)
+!3642 = !DILocation(line: 6269, column: 21, scope: !3628)
+!3643 = !DILocation(line: 6270, column: 28, scope: !3628)
+!3644 = !DILocation(line: 6271, column: 6, scope: !3628)
+!3645 = !DILocation(line: 6271, column: 20, scope: !3628)
+!3646 = !DILocation(line: 6272, column: 30, scope: !3628)
+!3647 = !DILocation(line: 6274, column: 23, scope: !3628)
+!3648 = !DILocation(line: 6276, column: 13, scope: !3628)
+!3649 = distinct !DISubprogram(name: "kernel_157", scope: !7, file: !7, line: 6290, type: !11, scopeLine: 6290, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!3650 = !DILocation(line: 6291, column: 33, scope: !3649)
+!3651 = !DILocation(line: 6293, column: 7, scope: !3649)
+!3652 = !DILocation(line: 6294, column: 14, scope: !3649)
+!3653 = !DILocation(line: 6295, column: 8, scope: !3649)
+!3654 = !DILocation(line: 6297, column: 12, scope: !3649)
+!3655 = !DILocation(line: 6298, column: 9, scope: !3649)
+!3656 = !DILocation(line: 6300, column: 32, scope: !3649)
+!3657 = !DILocation(line: 6300, column: 24, scope: !3649)
+!3658 = !DILocation(line: 6301, column: 25, scope: !3649)
+!3659 = !DILocation(line: 6302, column: 16, scope: !3649)
+!3660 = !DILocation(line: 6304, column: 26, scope: !3649)
+!3661 = !DILocation(line: 6305, column: 34, scope: !3649)
+!3662 = !DILocation(line: 6305, column: 7, scope: !3649)
+!3663 = !DILocation(line: 6306, column: 5, scope: !3649)
+!3664 = distinct !DISubprogram(name: "kernel_158", scope: !8, file: !8, line: 6330, type: !11, scopeLine: 6330, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!3665 = !DILocation(line: 6330, column: 16, scope: !3664)
+!3666 = !DILocation(line: 6332, column: 13, scope: !3664)
+!3667 = !DILocation(line: 6333, column: 18, scope: !3664)
+!3668 = !DILocation(line: 6333, column: 24, scope: !3664)
+!3669 = !DILocation(line: 6335, column: 26, scope: !3664)
+!3670 = !DILocation(line: 6335, column: 3, scope: !3664)
+!3671 = !DILocation(line: 6336, column: 36, scope: !3664)
+!3672 = !DILocation(line: 6338, column: 15, scope: !3664)
+!3673 = !DILocation(line: 6340, column: 25, scope: !3664)
+!3674 = !DILocation(line: 6342, column: 35, scope: !3664)
+!3675 = !DILocation(line: 6343, column: 3, scope: !3664)
+!3676 = !DILocation(line: 6343, column: 19, scope: !3664)
+!3677 = !DILocation(line: 6343, column: 14, scope: !3664)
+!3678 = !DILocation(line: 6343, column: 12, scope: !3664)
+!3679 = !DILocation(line: 6343, column: 22, scope: !3664)
+!3680 = !DILocation(line: 6344, column: 5, scope: !3664)
+!3681 = !DILocation(line: 6344, column: 16, scope: !3664)
+!3682 = !DILocation(line: 6346, column: 19, scope: !3664)
+!3683 = !DILocation(line: 6347, column: 40, scope: !3664)
+!3684 = !DILocation(line: 6348, column: 14, scope: !3664)
+!3685 = !DILocation(line: 6349, column: 9, scope: !3664)
+!3686 = !DILocation(line: 6350, column: 33, scope: !3664)
+!3687 = !DILocation(line: 6351, column: 12, scope: !3664)
+!3688 = !DILocation(line: 6352, column: 35, scope: !3664)
+!3689 = !DILocation(line: 6352, column: 17, scope: !3664)
+!3690 = !DILocation(line: 6352, column: 10, scope: !3664)
+!3691 = !DILocation(line: 6353, column: 16, scope: !3664)
+!3692 = !DILocation(line: 6354, column: 36, scope: !3664)
+!3693 = !DILocation(line: 6355, column: 16, scope: !3664)
+!3694 = distinct !DISubprogram(name: "kernel_159", scope: !9, file: !9, line: 6370, type: !11, scopeLine: 6370, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!3695 = !DILocation(line: 6370, column: 17, scope: !3694)
+!3696 = !DILocation(line: 6372, column: 3, scope: !3694)
+!3697 = !DILocation(line: 6372, column: 18, scope: !3694)
+!3698 = !DILocation(line: 6373, column: 10, scope: !3694)
+!3699 = !DILocation(line: 6375, column: 32, scope: !3694)
+!3700 = !DILocation(line: 6377, column: 25, scope: !3694)
+!3701 = !DILocation(line: 6379, column: 16, scope: !3694)
+!3702 = !DILocation(line: 6381, column: 32, scope: !3694)
+!3703 = !DILocation(line: 6382, column: 26, scope: !3694)
+!3704 = !DILocation(line: 6383, column: 11, scope: !3694)
+!3705 = !DILocation(line: 6384, column: 13, scope: !3694)
+!3706 = !DILocation(line: 6385, column: 14, scope: !3694)
+!3707 = !DILocation(line: 6386, column: 29, scope: !3694)
+!3708 = !DILocation(line: 6388, column: 32, scope: !3694)
+!3709 = !DILocation(line: 6389, column: 20, scope: !3694)
+!3710 = !DILocation(line: 6390, column: 24, scope: !3694)
+!3711 = distinct !DISubprogram(name: "kernel_160", scope: !2, file: !2, line: 6410, type: !11, scopeLine: 6410, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!3712 = !DILocation(line: 6410, column: 16, scope: !3711)
+!3713 = !DILocation(line: 6411, column: 8, scope: !3711)
+!3714 = !DILocation(line: 6411, column: 31, scope: !3711)
+!3715 = !DILocation(line: 6413, column: 18, scope: !3711)
+!3716 = !DILocation(line: 6413, column: 33, scope: !3711)
+!3717 = !DILocation(line: 6413, column: 8, scope: !3711)
+!3718 = !DILocation(line: 6413, column: 7, scope: !3711)
+!3719 = !DILocation(line: 6414, column: 18, scope: !3711)
+!3720 = !DILocation(line: 6415, column: 5, scope: !3711)
+!3721 = !DILocation(line: 6416, column: 36, scope: !3711)
+!3722 = !DILocation(line: 6418, column: 18, scope: !3711)
+!3723 = !DILocation(line: 6418, column: 33, scope: !3711)
+!3724 = !DILocation(line: 6420, column: 30, scope: !3711)
+!3725 = !DILocation(line: 6420, column: 5, scope: !3711)
+!3726 = !DILocation(line: 6421, column: 4, scope: !3711)
+!3727 = !DILocation(line: 6423, column: 8, scope: !3711)
+!3728 = !DILocation(line: 6424, column: 10, scope: !3711)
+!3729 = !DILocation(line: 6426, column: 39, scope: !3711)
+!3730 = !DILocation(line: 6426, column: 17, scope: !3711)
+!3731 = distinct !{!3731, !26}
+!3732 = !DILocation(line: 6426, column: 32, scope: !3711)
+!3733 = distinct !DISubprogram(name: "kernel_161", scope: !3, file: !3, line: 6450, type: !11, scopeLine: 6450, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!3734 = !DILocation(line: 6452, column: 18, scope: !3733)
+!3735 = !DILocation(line: 6453, column: 8, scope: !3733)
+!3736 = !DILocation(line: 6454, column: 22, scope: !3733)
+!3737 = !DILocation(line: 6456, column: 6, scope: !3733)
+!3738 = !DILocation(line: 6458, column: 17, scope: !3733)
+!3739 = !DILocation(line: 6460, column: 8, scope: !3733)
+!3740 = !DILocation(line: 6460, column: 19, scope: !3733)
+!3741 = !DILocation(line: 6461, column: 34, scope: !3733)
+!3742 = !DILocation(line: 6462, column: 4, scope: !3733)
+!3743 = !DILocation(line: 6463, column: 26, scope: !3733)
+!3744 = !DILocation(line: 6465, column: 5, scope: !3733)
+!3745 = !DILocation(line: 6467, column: 28, scope: !3733)
+!3746 = !DILocation(line: 6467, column: 7, scope: !3733)
+!3747 = !DILocation(line: 6468, column: 31, scope: !3733)
+!3748 = !DILocation(line: 6470, column: 10, scope: !3733)
+!3749 = !DILocation(line: 6471, column: 35, scope: !3733)
+!3750 = !DILocation(line: 6472, column: 37, scope: !3733)
+!3751 = !DILocation(line: 6472, column: 16, scope: !3733)
+!3752 = !DILocation(line: 6472, column: 19, scope: !3733)
+!3753 = !DILocation(line: 6474, column: 3, scope: !3733)
+!3754 = distinct !DISubprogram(name: "kernel_162", scope: !4, file: !4, line: 6490, type: !11, scopeLine: 6490, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!3755 = !DILocation(line: 6490, column: 30, scope: !3754)
+!3756 = !DILocation(line: 6492, column: 26, scope: !3754)
+!3757 = !DILocation(line: 6492, column: 26, scope: !3754)
+!3758 = !DILocation(line: 6494, column: 16, scope: !3754)
+!3759 = !DILocation(line: 6496, column: 14, scope: !3754)
+!3760 = !DILocation(line: 6497, column: 23, scope: !3754)
+!3761 = !DILocation(line: 6499, column: 33, scope: !3754)
+!3762 = !DILocation(line: 6500, column: 21, scope: !3754)
+!3763 = !DILocation(line: 6502, column: 28, scope: !3754)
+!3764 = !DILocation(line: 6503, column: 34, scope: !3754)
+!3765 = !DILocation(line: 6505, column: 14, scope: !3754)
+!3766 = !DILocation(line: 6506, column: 37, scope: !3754)
+!3767 = distinct !DISubprogram(name: "kernel_163", scope: !5, file: !5, line: 6530, type: !11, scopeLine: 6530, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!3768 = !DILocation(line: 6530, column: 5, scope: !3767)
+!3769 = !DILocation(line: 6532, column: 28, scope: !3767)
+!3770 = !DILocation(line: 6532, column: 29, scope: !3767)
+!3771 = !DILocation(line: 6532, column: 9, scope: !3767)
+!3772 = !DILocation(line: 6532, column: 14, scope: !3767)
+!3773 = !DILocation(line: 6533, column: 15, scope: !3767)
+!3774 = !DILocation(line: 6533, column: 14, scope: !3767)
+!3775 = !DILocation(line: 6535, column: 12, scope: !3767)
+!3776 = !DILocation(line: 6537, column: 23, scope: !3767)
+!3777 = !DILocation(line: 6538, column: 26, scope: !3767)
+!3778 = !DILocation(line: 6538, column: 30, scope: !3767)
+!3779 = !DILocation(line: 6540, column: 19, scope: !3767)
+!3780 = !DILocation(line: 6540, column: 27, scope: !3767)
+!3781 = !DILocation(line: 6542, column: 7, scope: !3767)
+!3782 = !DILocation(line: 6543, column: 27, scope: !3767)
+!3783 = !DILocation(line: 6544, column: 19, scope: !3767)
+!3784 = !DILocation(line: 6544, column: 35, scope: !3767)
+!3785 = !DILocation(line: 6544, column: 9, scope: !3767)
+!3786 = !DILocation(line: 6544, column: 7, scope: !3767)
+!3787 = !DILocation(line: 6545, column: 35, scope: !3767)
+!3788 = !DILocation(line: 6545, column: 17, scope: !3767)
+!3789 = !DILocation(line: 6546, column: 32, scope: !3767)
+!3790 = !DILocation(line: 6547, column: 26, scope: !3767)
+!3791 = !DILocation(line: 6548, column: 18, scope: !3767)
+!3792 = !DILocation(line: 6549, column: 20, scope: !3767)
+!3793 = !DILocation(line: 6550, column: 29, scope: !3767)
+!3794 = !DILocation(line: 6550, column: 32, scope: !3767)
+!3795 = !DILocation(line: 6552, column: 23, scope: !3767)
+!3796 = !DILocation(line: 6553, column: 25, scope: !3767)
+!3797 = !DILocation(line: 6554, column: 4, scope: !3767)
+!3798 = !DILocation(line: 6554, column: 18, scope: !3767)
+!3799 = !DILocation(line: 6555, column: 35, scope: !3767)
+!3800 = distinct !DISubprogram(name: "kernel_164", scope: !6, file: !6, line: 6570, type: !11, scopeLine: 6570, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!3801 = !DILocation(line: 6570, column: 28, scope: !3800)
+!3802 = !DILocation(line: 6572, column: 37, scope: !3800)
+!3803 = !DILocation(line: 6574, column: 6, scope: !3800)
+!3804 = !DILocation(line: 6576, column: 37, scope: !3800)
+!3805 = !DILocation(line: 6578, column: 13, scope: !3800)
+!3806 = !DILocation(line: 6580, column: 19, scope: !3800)
+!3807 = !DILocation(line: 6580, column: 11, scope: !3800)
+!3808 = !DILocation(line: 6580, column: 12, scope: !3800)
+!3809 = !DILocation(line: 6582, column: 14, scope: !3800)
+!3810 = !DILocation(line: 6583, column: 23, scope: !3800)
+!3811 = !DILocation(line: 6583, column: 5, scope: !3800)
+!3812 = !DILocation(line: 6583, column: 4, scope: !3800)
+!3813 = !DILocation(line: 6583, column: 17, scope: !3800)
+!3814 = !DILocation(line: 6584, column: 3, scope: !3800)
+!3815 = !DILocation(line: 6585, column: 25, scope: !3800)
+!3816 = !DILocation(line: 6586, column: 38, scope: !3800)
+!3817 = !DILocation(line: 6588, column: 30, scope: !3800)
+!3818 = distinct !DISubprogram(name: "kernel_165", scope: !7, file: !7, line: 6610, type: !11, scopeLine: 6610, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!3819 = !DILocation(line: 6611, column: 16, scope: !3818)
+!3820 = !DILocation(line: 6612, column: 27, scope: !3818)
+!3821 = !DILocation(line: 6613, column: 17, scope: !3818)
+!3822 = !DILocation(line: 6614, column: 17, scope: !3818)
+!3823 = !DILocation(line: 6615, column: 36, scope: !3818)
+!3824 = !DILocation(line: 6616, column: 38, scope: !3818)
+!3825 = !DILocation(line: 6617, column: 12, scope: !3818)
+!3826 = !DILocation(line: 6619, column: 26, scope: !3818)
+!3827 = !DILocation(line: 6620, column: 24, scope: !3818)
+!3828 = !DILocation(line: 6621, column: 17, scope: !3818)
+!3829 = !DILocation(line: 6623, column: 39, scope: !3818)
+!3830 = !DILocation(line: 6624, column: 16, scope: !3818)
+!3831 = !DILocation(line: 6624, column: 18, scope: !3818)
+!3832 = !DILocation(line: 6625, column: 14, scope: !3818)
+!3833 = !DILocation(line: 6627, column: 32, scope: !3818)
+!3834 = !DILocation(line: 6627, column: 40, scope: !3818)
+!3835 = !DILocation(line: 6628, column: 4, scope: !3818)
+!3836 = !DILocation(line: 6630, column: 39, scope: !3818)
+!3837 = !DILocation(line: 6631, column: 18, scope: !3818)
+!3838 = distinct !{!3838, !26}
+!3839 = !DILocation(line: 6632, column: 34, scope: !3818)
+!3840 = distinct !DISubprogram(name: "kernel_166", scope: !8, file: !8, line: 6650, type: !11, scopeLine: 6650, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!3841 = !DILocation(line: 6652, column: 7, scope: !3840)
+!3842 = !DILocation(line: 6653, column: 40, scope: !3840)
+!3843 = !DILocation(line: 6653, column: 22, scope: !3840)
+!3844 = !DILocation(line: 6654, column: 17, scope: !3840)
+!3845 = !DILocation(line: 6654, column: 7, scope: !3840)
+!3846 = !DILocation(line: 6655, column: 31, scope: !3840)
+!3847 = !DILocation(line: 6655, column: 28, scope: !3840)
+!3848 = !DILocation(line: 6656, column: 19, scope: !3840)
+!3849 = !DILocation(line: 6657, column: 33, scope: !3840)
+!3850 = !DILocation(line: 6658, column: 30, scope: !3840)
+!3851 = !DILocation(line: 6660, column: 37, scope: !3840)
+!3852 = !DILocation(line: 6661, column: 24, scope: !3840)
+!3853 = !DILocation(line: 6663, column: 31, scope: !3840)
+!3854 = !DILocation(line: 6665, column: 13, scope: !3840)
+!3855 = !DILocation(line: 6667, column: 30, scope: !3840)
+!3856 = !DILocation(line: 6667, column: 30, scope: !3840)
+!3857 = !DILocation(line: 6667, column: 5, scope: !3840)
+!3858 = !DILocation(line: 6667, column: 17, scope: !3840)
+!3859 = !DILocation(line: 6668, column: 22, scope: !3840)
+!3860 = !DILocation(line: 6669, column: 20, scope: !3840)
+!3861 = distinct !DISubprogram(name: "kernel_167", scope: !9, file: !9, line: 6690, type: !11, scopeLine: 6690, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!3862 = !DILocation(line: 6690, column: 22, scope: !3861)
+!3863 = !DILocation(line: 6690, column: 9, scope: !3861)
+!3864 = !DILocation(line: 6691, column: 32, scope: !3861)
+!3865 = !DILocation(line: 6693, column: 5, scope: !3861)
+!3866 = !DILocation(line: 6694, column: 18, scope: !3861)
+!3867 = !DILocation(line: 6694, column: 38, scope: !3861)
+!3868 = !DILocation(line: 6695, column: 40, scope: !3861)
+!3869 = !DILocation(line: 6697, column: 12, scope: !3861)
+!3870 = !DILocation(line: 6698, column: 29, scope: !3861)
+!3871 = !DILocation(line: 6700, column: 14, scope: !3861)
+!3872 = !DILocation(line: 6700, column: 10, scope: !3861)
+!3873 = !DILocation(line: 6702, column: 8, scope: !3861)
+!3874 = !DILocation(line: 6703, column: 3, scope: !3861)
+!3875 = !DILocation(line: 6704, column: 34, scope: !3861)
+!3876 = distinct !DISubprogram(name: "kernel_168", scope: !2, file: !2, line: 6730, type: !11, scopeLine: 6730, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!3877 = !DILocation(line: 6730, column: 23, scope: !3876)
+!3878 = !DILocation(line: 6732, column: 29, scope: !3876)
+!3879 = !DILocation(line: 6733, column: 30, scope: !3876)
+!3880 = !DILocation(line: 6734, column: 16, scope: !3876)
+!3881 = !DILocation(line: 6735, column: 31, scope: !3876)
+!3882 = !DILocation(line: 6735, column: 25, scope: !3876)
+!3883 = !DILocation(line: 6736, column: 17, scope: !3876)
+!3884 = !DILocation(line: 6737, column: 30, scope: !3876)
+!3885 = !DILocation(line: 6738, column: 8, scope: !3876)
+!3886 = !DILocation(line: 6739, column: 12, scope: !3876)
+!3887 = !DILocation(line: 6740, column: 12, scope: !3876)
+!3888 = !DILocation(line: 6742, column: 5, scope: !3876)
+!3889 = !DILocation(line: 6743, column: 5, scope: !3876)
+!3890 = !DILocation(line: 6745, column: 7, scope: !3876)
+!3891 = !DILocation(line: 6746, column: 7, scope: !3876)
+!3892 = !DILocation(line: 6747, column: 38, scope: !3876)
+!3893 = !DILocation(line: 6747, column: 30, scope: !3876)
+!3894 = !DILocation(line: 6748, column: 19, scope: !3876)
+!3895 = !DILocation(line: 6748, column: 29, scope: !3876)
+!3896 = !DILocation(line: 6749, column: 15, scope: !3876)
+!3897 = !DILocation(line: 6750, column: 27, scope: !3876)
+!3898 = !DILocation(line: 6750, column: 23, scope: !3876)
+!3899 = !DILocation(line: 6750, column: 14, scope: !3876)
+!3900 = !DILocation(line: 6751, column: 36, scope: !3876)
+!3901 = !DILocation(line: 6753, column: 20, scope: !3876)
+!3902 = !DILocation(line: 6754, column: 30, scope: !3876)
+!3903 = !DILocation(line: 6756, column: 25, scope: !3876)
+!3904 = !DILocation(line: 6757, column: 5, scope: !3876)
+!3905 = !DILocation(line: 6758, column: 35, scope: !3876)
+!3906 = !DILocation(line: 6759, column: 30, scope: !3876)
+!3907 = !DILocation(line: 6761, column: 40, scope: !3876)
+!3908 = !DILocation(line: 6763, column: 29, scope: !3876)
+!3909 = distinct !DISubprogram(name: "kernel_169", scope: !3, file: !3, line: 6770, type: !11, scopeLine: 6770, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!3910 = !DILocation(line: 6770, column: 18, scope: !3909)
+!3911 = !DILocation(line: 6772, column: 12, scope: !3909)
+!3912 = !DILocation(line: 6773, column: 14, scope: !3909)
+!3913 = !DILocation(line: 6773, column: 22, scope: !3909)
+!3914 = !DILocation(line: 6774, column: 5, scope: !3909)
+!3915 = !DILocation(line: 6776, column: 18, scope: !3909)
+!3916 = !DILocation(line: 6777, column: 8, scope: !3909)
+!3917 = !DILocation(line: 6778, column: 37, scope: !3909)
+!3918 = !DILocation(line: 6779, column: 40, scope: !3909)
+!3919 = !DILocation(line: 6780, column: 36, scope: !3909)
+!3920 = !DILocation(line: 6780, column: 10, scope: !3909)
+!3921 = !DILocation(line: 6782, column: 26, scope: !3909)
+!3922 = !DILocation(line: 6783, column: 24, scope: !3909)
+!3923 = !DILocation(line: 6784, column: 7, scope: !3909)
+!3924 = !DILocation(line: 6786, column: 4, scope: !3909)
+!3925 = !DILocation(line: 6787, column: 20, scope: !3909)
+!3926 = distinct !DISubprogram(name: "kernel_170", scope: !4, file: !4, line: 6810, type: !11, scopeLine: 6810, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!3927 = !DILocation(line: 6812, column: 34, scope: !3926)
+!3928 = !DILocation(line: 6813, column: 26, scope: !3926)
+!3929 = !DILocation(line: 6813, column: 32, scope: !3926)
+!3930 = !DILocation(line: 6814, column: 33, scope: !3926)
+!3931 = !DILocation(line: 6815, column: 18, scope: !3926)
+!3932 = !DILocation(line: 6816, column: 11, scope: !3926)
+!3933 = !DILocation(line: 6816, column: 17, scope: !3926)
+!3934 = !DILocation(line: 6818, column: 19, scope: !3926)
+!3935 = !DILocation(line: 6818, column: 17, scope: !3926)
+!3936 = !DILocation(line: 6819, column: 40, scope: !3926)
+!3937 = !DILocation(line: 6820, column: 25, scope: !3926)
+!3938 = !DILocation(line: 6821, column: 37, scope: !3926)
+!3939 = !DILocation(line: 6822, column: 11, scope: !3926)
+!3940 = !DILocation(line: 6823, column: 38, scope: !3926)
+!3941 = !DILocation(line: 6825, column: 24, scope: !3926)
+!3942 = !DILocation(line: 6827, column: 3, scope: !3926)
+!3943 = !DILocation(line: 6829, column: 14, scope: !3926)
+!3944 = !DILocation(line: 6830, column: 24, scope: !3926)
+!3945 = !DILocation(line: 6831, column: 31, scope: !3926)
+!3946 = distinct !{!3946, !26}
+!3947 = !DILocation(line: 6833, column: 32, scope: !3926)
+!3948 = distinct !DISubprogram(name: "kernel_171", scope: !5, file: !5, line: 6850, type: !11, scopeLine: 6850, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!3949 = !DILocation(line: 6850, column: 29, scope: !3948)
+!3950 = !DILocation(line: 6852, column: 37, scope: !3948)
+!3951 = !DILocation(line: 6853, column: 33, scope: !3948)
+!3952 = !DILocation(line: 6854, column: 33, scope: !3948)
+!3953 = !DILocation(line: 6854, column: 11, scope: !3948)
+!3954 = !DILocation(line: 6855, column: 23, scope: !3948)
+!3955 = !DILocation(line: 6856, column: 32, scope: !3948)
+!3956 = !DILocation(line: 6857, column: 28, scope: !3948)
+!3957 = !DILocation(line: 6858, column: 24, scope: !3948)
+!3958 = !DILocation(line: 6859, column: 11, scope: !3948)
+!3959 = !DILocation(line: 6859, column: 13, scope: !3948)
+!3960 = !DILocation(line: 6861, column: 18, scope: !3948)
+!3961 = !DILocation(line: 6863, column: 31, scope: !3948)
+!3962 = !DILocation(line: 6865, column: 23, scope: !3948)
+!3963 = !DILocation(line: 6866, column: 4, scope: !3948)
+!3964 = !DILocation(line: 6867, column: 31, scope: !3948)
+!3965 = !DILocation(line: 6868, column: 31, scope: !3948)
+!3966 = !DILocation(line: 6869, column: 6, scope: !3948)
+!3967 = !DILocation(line: 6870, column: 8, scope: !3948)
+!3968 = !DILocation(line: 6871, column: 40, scope: !3948)
+!3969 = distinct !DISubprogram(name: "kernel_172", scope: !6, file: !6, line: 6890, type: !11, scopeLine: 6890, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!3970 = !DILocation(line: 6891, column: 4, scope: !3969)
+!3971 = !DILocation(line: 6892, column: 19, scope: !3969)
+!3972 = !DILocation(line: 6893, column: 31, scope: !3969)
+!3973 = !DILocation(line: 6894, column: 23, scope: !3969)
+!3974 = !DILocation(line: 6895, column: 33, scope: !3969)
+!3975 = !DILocation(line: 6897, column: 20, scope: !3969)
+!3976 = !DILocation(line: 6898, column: 8, scope: !3969)
+!3977 = !DILocation(line: 6899, column: 38, scope: !3969)
+!3978 = !DILocation(line: 6900, column: 30, scope: !3969)
+!3979 = !DILocation(line: 6901, column: 3, scope: !3969)
+!3980 = !DILocation(line: 6902, column: 33, scope: !3969)
+!3981 = !DILocation(line: 6904, column: 27, scope: !3969)
+!3982 = distinct !DISubprogram(name: "kernel_173", scope: !7, file: !7, line: 6930, type: !11, scopeLine: 6930, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!3983 = !DILocation(line: 6930, column: 7, scope: !3982)
+!3984 = !DILocation(line: 6930, column: 6, scope: !3982)
+!3985 = !DILocation(line: 6931, column: 25, scope: !3982)
+!3986 = !DILocation(line: 6931, column: 23, scope: !3982)
+!3987 = !DILocation(line: 6931, column: 3, scope: !3982)
+!3988 = !DILocation(line: 6932, column: 6, scope: !3982)
+!3989 = !DILocation(line: 6934, column: 26, scope: !3982)
+!3990 = !DILocation(line: 6934, column: 16, scope: !3982)
+!3991 = !DILocation(line: 6935, column: 19, scope: !3982)
+!3992 = !DILocation(line: 6936, column: 21, scope: !3982)
+!3993 = !DILocation(line: 6937, column: 13, scope: !3982)
+!3994 = !DILocation(line: 6937, column: 20, scope: !3982)
+!3995 = !DILocation(line: 6937, column: 19, scope: !3982)
+!3996 = !DILocation(line: 6937, column: 7, scope: !3982)
+!3997 = !DILocation(line: 6938, column: 8, scope: !3982)
+!3998 = !DILocation(line: 6939, column: 4, scope: !3982)
+!3999 = !DILocation(line: 6940, column: 7, scope: !3982)
+!4000 = !DILocation(line: 6940, column: 37, scope: !3982)
+!4001 = !DILocation(line: 6940, column: 34, scope: !3982)
+!4002 = !DILocation(line: 6940, column: 15, scope: !3982)
+!4003 = !DILocation(line: 6941, column: 26, scope: !3982)
+!4004 = !DILocation(line: 6943, column: 14, scope: !3982)
+!4005 = !DILocation(line: 6944, column: 39, scope: !3982)
+!4006 = !DILocation(line: 6946, column: 12, scope: !3982)
+!4007 = !DILocation(line: 6947, column: 6, scope: !3982)
+!4008 = !DILocation(line: 6948, column: 29, scope: !3982)
+!4009 = !DILocation(line: 6950, column: 28, scope: !3982)
+!4010 = !DILocation(line: 6951, column: 4, scope: !3982)
+!4011 = !DILocation(line: 6951, column: 3, scope: !3982)
+!4012 = !DILocation(line: 6952, column: 31, scope: !3982)
+!4013 = !DILocation(line: 6952, column: 15, scope: !3982)
+!4014 = !DILocation(line: 6954, column: 35, scope: !3982)
+!4015 = distinct !DISubprogram(name: "kernel_174", scope: !8, file: !8, line: 6970, type: !11, scopeLine: 6970, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!4016 = !DILocation(line: 6971, column: 18, scope: !4015)
+!4017 = !DILocation(line: 6972, column: 23, scope: !4015)
+!4018 = !DILocation(line: 6973, column: 37, scope: !4015)
+!4019 = !DILocation(line: 6974, column: 34, scope: !4015)
+!4020 = !DILocation(line: 6975, column: 30, scope: !4015)
+!4021 = !DILocation(line: 6976, column: 35, scope: !4015)
+!4022 = !DILocation(line: 6977, column: 9, scope: !4015)
+!4023 = !DILocation(line: 6978, column: 28, scope: !4015)
+!4024 = !DILocation(line: 6978, column: 27, scope: !4015)
+!4025 = !DILocation(line: 6979, column: 24, scope: !4015)
+!4026 = !DILocation(line: 6980, column: 32, scope: !4015)
+!4027 = !DILocation(line: 6980, column: 8, scope: !4015)
+!4028 = !DILocation(line: 6981, column: 32, scope: !4015)
+!4029 = !DILocation(line: 6982, column: 34, scope: !4015)
+!4030 = !DILocation(line: 6982, column: 29, scope: !4015)
+!4031 = !DILocation(line: 6982, column: 10, scope: !4015)
+!4032 = !DILocation(line: 6982, column: 19, scope: !4015)
+!4033 = distinct !DISubprogram(name: "kernel_175", scope: !9, file: !9, line: 7010, type: !11, scopeLine: 7010, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!4034 = !DILocation(line: 7011, column: 21, scope: !4033)
+!4035 = !DILocation(line: 7012, column: 26, scope: !4033)
+!4036 = !DILocation(line: 7013, column: 31, scope: !4033)
+!4037 = !DILocation(line: 7014, column: 37, scope: !4033)
+!4038 = !DILocation(line: 7015, column: 21, scope: !4033)
+!4039 = !DILocation(line: 7015, column: 21, scope: !4033)
+!4040 = !DILocation(line: 7016, column: 5, scope: !4033)
+!4041 = !DILocation(line: 7017, column: 40, scope: !4033)
+!4042 = !DILocation(line: 7017, column: 31, scope: !4033)
+!4043 = !DILocation(line: 7017, column: 4, scope: !4033)
+!4044 = !DILocation(line: 7018, column: 7, scope: !4033)
+!4045 = !DILocation(line: 7020, column: 30, scope: !4033)
+!4046 = !DILocation(line: 7020, column: 19, scope: !4033)
+!4047 = !DILocation(line: 7020, column: 21, scope: !4033)
+!4048 = !DILocation(line: 7021, column: 11, scope: !4033)
+!4049 = !DILocation(line: 7023, column: 29, scope: !4033)
+!4050 = !DILocation(line: 7024, column: 30, scope: !4033)
+!4051 = !DILocation(line: 7026, column: 20, scope: !4033)
+!4052 = !DILocation(line: 7027, column: 35, scope: !4033)
+!4053 = distinct !{!4053, !26}
+!4054 = !DILocation(line: 7027, column: 25, scope: !4033)
+!4055 = distinct !DISubprogram(name: "kernel_176", scope: !2, file: !2, line: 7050, type: !11, scopeLine: 7050, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!4056 = !DILocation(line: 7052, column: 17, scope: !4055)
+!4057 = !DILocation(line: 7053, column: 8, scope: !4055)
+!4058 = !DILocation(line: 7054, column: 31, scope: !4055)
+!4059 = !DILocation(line: 7054, column: 14, scope: !4055)
+!4060 = !DILocation(line: 7054, column: 30, scope: !4055)
+!4061 = !DILocation(line: 7055, column: 4, scope: !4055)
+!4062 = !DILocation(line: 7057, column: 34, scope: !4055)
+!4063 = !DILocation(line: 7057, column: 39, scope: !4055)
+!4064 = !DILocation(line: 7057, column: 6, scope: !4055)
+!4065 = !DILocation(line: 7058, column: 21, scope: !4055)
+!4066 = !DILocation(line: 7059, column: 30, scope: !4055)
+!4067 = !DILocation(line: 7059, column: 24, scope: !4055)
+!4068 = !DILocation(line: 7060, column: 38, scope: !4055)
+!4069 = !DILocation(line: 7061, column: 27, scope: !4055)
+!4070 = !DILocation(line: 7063, column: 25, scope: !4055)
+!4071 = !DILocation(line: 7065, column: 26, scope: !4055)
+!4072 = !DILocation(line: 7066, column: 39, scope: !4055)
+!4073 = !DILocation(line: 7067, column: 35, scope: !4055)
+!4074 = !DILocation(line: 7068, column: 3, scope: !4055)
+!4075 = !DILocation(line: 7069, column: 3, scope: !4055)
+!4076 = distinct !DISubprogram(name: "kernel_177", scope: !3, file: !3, line: 7090, type: !11, scopeLine: 7090, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!4077 = !DILocation(line: 7091, column: 40, scope: !4076)
+!4078 = !DILocation(line: 7091, column: 18, scope: !4076)
+!4079 = !DILocation(line: 7092, column: 17, scope: !4076)
+!4080 = !DILocation(line: 7093, column: 16, scope: !4076)
+!4081 = !DILocation(line: 7094, column: 24, scope: !4076)
+!4082 = !DILocation(line: 7095, column: 4, scope: !4076)
+!4083 = !DILocation(line: 7096, column: 31, scope: !4076)
+!4084 = !DILocation(line: 7097, column: 13, scope: !4076)
+!4085 = !DILocation(line: 7099, column: 17, scope: !4076)
+!4086 = !DILocation(line: 7099, column: 29, scope: !4076)
+!4087 = !DILocation(line: 7100, column: 24, scope: !4076)
+!4088 = !DILocation(line: 7101, column: 13, scope: !4076)
+!4089 = !DILocation(line: 7102, column: 14, scope: !4076)
+!4090 = !DILocation(line: 7104, column: 6, scope: !4076)
+!4091 = !DILocation(line: 7105, column: 19, scope: !4076)
+!4092 = !DILocation(line: 7105, column: 21, scope: !4076)
+!4093 = distinct !DISubprogram(name: "kernel_178", scope: !4, file: !4, line: 7130, type: !11, scopeLine: 7130, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!4094 = !DILocation(line: 7130, column: 32, scope: !4093)
+!4095 = !DILocation(line: 7131, column: 7, scope: !4093)
+!4096 = !DILocation(line: 7133, column: 26, scope: !4093)
+!4097 = !DILocation(line: 7135, column: 29, scope: !4093)
+!4098 = !DILocation(line: 7137, column: 4, scope: !4093)
+!4099 = !DILocation(line: 7138, column: 24, scope: !4093)
+!4100 = !DILocation(line: 7138, column: 6, scope: !4093)
+!4101 = !DILocation(line: 7139, column: 36, scope: !4093)
+!4102 = !DILocation(line: 7139, column: 40, scope: !4093)
+!4103 = !DILocation(line: 7140, column: 16, scope: !4093)
+!4104 = !DILocation(line: 7142, column: 37, scope: !4093)
+!4105 = !DILocation(line: 7144, column: 14, scope: !4093)
+!4106 = !DILocation(line: 7144, column: 19, scope: !4093)
+!4107 = !DILocation(line: 7144, column: 39, scope: !4093)
+!4108 = !DILocation(line: 7146, column: 18, scope: !4093)
+!4109 = !DILocation(line: 7146, column: 29, scope: !4093)
+!4110 = !DILocation(line: 7148, column: 28, scope: !4093)
+!4111 = !DILocation(line: 7149, column: 37, scope: !4093)
+!4112 = !DILocation(line: 7149, column: 13, scope: !4093)
+!4113 = !DILocation(line: 7150, column: 12, scope: !4093)
+!4114 = !DILocation(line: 7151, column: 27, scope: !4093)
+!4115 = !DILocation(line: 7153, column: 40, scope: !4093)
+!4116 = !DILocation(line: 7153, column: 19, scope: !4093)
+!4117 = !DILocation(line: 7154, column: 39, scope: !4093)
+!4118 = !DILocation(line: 7154, column: 21, scope: !4093)
+!4119 = !DILocation(line: 7155, column: 5, scope: !4093)
+!4120 = !DILocation(line: 7156, column: 20, scope: !4093)
+!4121 = !DILocation(line: 7156, column: 7, scope: !4093)
+!4122 = !DILocation(line: 7157, column: 10, scope: !4093)
+!4123 = !DILocation(line: 7157, column: 6, scope: !4093)
+!4124 = !DILocation(line: 7158, column: 38, scope: !4093)
+!4125 = !DILocation(line: 7159, column: 17, scope: !4093)
+!4126 = !DILocation(line: 7160, column: 22, scope: !4093)
+!4127 = !DILocation(line: 7161, column: 31, scope: !4093)
+!4128 = !DILocation(line: 7162, column: 6, scope: !4093)
+!4129 = !DILocation(line: 7164, column: 40, scope: !4093)
+!4130 = !DILocation(line: 7166, column: 12, scope: !4093)
+!4131 = !DILocation(line: 7166, column: 27, scope: !4093)
+!4132 = !DILocation(line: 7167, column: 29, scope: !4093)
+!4133 = !DILocation(line: 7169, column: 23, scope: !4093)
+!4134 = !DILocation(line: 7171, column: 37, scope: !4093)
+!4135 = !DILocation(line: 7173, column: 21, scope: !4093)
+!4136 = !DILocation(line: 7175, column: 19, scope: !4093)
+!4137 = !DILocation(line: 7177, column: 35, scope: !4093)
+!4138 = !DILocation(line: 7178, column: 5, scope: !4093)
+!4139 = !DILocation(line: 7179, column: 37, scope: !4093)
+!4140 = !DILocation(line: 7179, column: 26, scope: !4093)
+!4141 = distinct !DISubprogram(name: "kernel_179", scope: !5, file: !5, line: 7170, type: !11, scopeLine: 7170, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!4142 = !DILocation(line: 7171, column: 8, scope: !4141)
+!4143 = !DILocation(line: 7173, column: 30, scope: !4141)
+!4144 = !DILocation(line: 7175, column: 20, scope: !4141)
+!4145 = !DILocation(line: 7176, column: 24, scope: !4141)
+!4146 = !DILocation(line: 7177, column: 17, scope: !4141)
+!4147 = !DILocation(line: 7179, column: 31, scope: !4141)
+!4148 = !DILocation(line: 7179, column: 5, scope: !4141)
+!4149 = !DILocation(line: 7180, column: 35, scope: !4141)
+!4150 = !DILocation(line: 7181, column: 11, scope: !4141)
+!4151 = !DILocation(line: 7183, column: 29, scope: !4141)
+!4152 = !DILocation(line: 7184, column: 30, scope: !4141)
+!4153 = !DILocation(line: 7185, column: 38, scope: !4141)
+!4154 = !DILocation(line: 7185, column: 31, scope: !4141)
+!4155 = !DILocation(line: 7185, column: 16, scope: !4141)
+!4156 = !DILocation(line: 7187, column: 14, scope: !4141)
+!4157 = !DILocation(line: 7188, column: 36, scope: !4141)
+!4158 = distinct !DISubprogram(name: "kernel_180", scope: !6, file: !6, line: 7210, type: !11, scopeLine: 7210, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!4159 = !DILocation(line: 7212, column: 25, scope: !4158)
+!4160 = !DILocation(line: 7212, column: 30, scope: !4158)
+!4161 = !DILocation(line: 7214, column: 10, scope: !4158)
+!4162 = !DILocation(line: 7215, column: 31, scope: !4158)
+!4163 = !DILocation(line: 7216, column: 28, scope: !4158)
+!4164 = !DILocation(line: 7217, column: 32, scope: !4158)
+!4165 = !DILocation(line: 7217, column: 39, scope: !4158)
+!4166 = !DILocation(line: 7218, column: 11, scope: !4158)
+!4167 = !DILocation(line: 7220, column: 27, scope: !4158)
+!4168 = !DILocation(line: 7220, column: 34, scope: !4158)
+!4169 = !DILocation(line: 7221, column: 14, scope: !4158)
+!4170 = !DILocation(line: 7223, column: 19, scope: !4158)
+!4171 = !DILocation(line: 7224, column: 24, scope: !4158)
+!4172 = !DILocation(line: 7224, column: 36, scope: !4158)
+!4173 = !DILocation(line: 7224, column: 37, scope: !4158)
+!4174 = !DILocation(line: 7226, column: 39, scope: !4158)
+!4175 = !DILocation(line: 7227, column: 19, scope: !4158)
+!4176 = !DILocation(line: 7229, column: 40, scope: !4158)
+!4177 = !DILocation(line: 7230, column: 31, scope: !4158)
+!4178 = distinct !{!4178, !26}
+!4179 = !DILocation(line: 7231, column: 25, scope: !4158)
+!4180 = distinct !DISubprogram(name: "kernel_181", scope: !7, file: !7, line: 7250, type: !11, scopeLine: 7250, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!4181 = !DILocation(line: 7250, column: 22, scope: !4180)
+!4182 = !DILocation(line: 7250, column: 35, scope: !4180)
+!4183 = !DILocation(line: 7251, column: 18, scope: !4180)
+!4184 = !DILocation(line: 7253, column: 36, scope: !4180)
+!4185 = !DILocation(line: 7254, column: 17, scope: !4180)
+!4186 = !DILocation(line: 7255, column: 8, scope: !4180)
+!4187 = !DILocation(line: 7256, column: 31, scope: !4180)
+!4188 = !DILocation(line: 7257, column: 39, scope: !4180)
+!4189 = !DILocation(line: 7258, column: 22, scope: !4180)
+!4190 = !DILocation(line: 7259, column: 27, scope: !4180)
+!4191 = !DILocation(line: 7260, column: 6, scope: !4180)
+!4192 = !DILocation(line: 7261, column: 9, scope: !4180)
+!4193 = !DILocation(line: 7262, column: 15, scope: !4180)
+!4194 = !DILocation(line: 7263, column: 17, scope: !4180)
+!4195 = !DILocation(line: 7265, column: 26, scope: !4180)
+!4196 = !DILocation(line: 7266, column: 32, scope: !4180)
+!4197 = !DILocation(line: 7267, column: 36, scope: !4180)
+!4198 = !DILocation(line: 7267, column: 38, scope: !4180)
+!4199 = !DILocation(line: 7268, column: 23, scope: !4180)
+!4200 = !DILocation(line: 7270, column: 5, scope: !4180)
+!4201 = distinct !DISubprogram(name: "kernel_182", scope: !8, file: !8, line: 7290, type: !11, scopeLine: 7290, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!4202 = !DILocation(line: 7290, column: 16, scope: !4201)
+!4203 = !DILocation(line: 7292, column: 38, scope: !4201)
+!4204 = !DILocation(line: 7293, column: 17, scope: !4201)
+!4205 = !DILocation(line: 7294, column: 4, scope: !4201)
+!4206 = !DILocation(line: 7294, column: 16, scope: !4201)
+!4207 = !DILocation(line: 7296, column: 27, scope: !4201)
+!4208 = !DILocation(line: 7297, column: 19, scope: !4201)
+!4209 = !DILocation(line: 7299, column: 7, scope: !4201)
+!4210 = !DILocation(line: 7300, column: 24, scope: !4201)
+!4211 = !DILocation(line: 7302, column: 11, scope: !4201)
+!4212 = !DILocation(line: 7304, column: 4, scope: !4201)
+!4213 = !DILocation(line: 7306, column: 18, scope: !4201)
+!4214 = !DILocation(line: 7307, column: 24, scope: !4201)
+!4215 = !DILocation(line: 7308, column: 25, scope: !4201)
+!4216 = !DILocation(line: 7310, column: 20, scope: !4201)
+!4217 = !DILocation(line: 7312, column: 7, scope: !4201)
+!4218 = !DILocation(line: 7314, column: 28, scope: !4201)
+!4219 = !DILocation(line: 7315, column: 40, scope: !4201)
+!4220 = !DILocation(line: 7317, column: 21, scope: !4201)
+!4221 = !DILocation(line: 7319, column: 40, scope: !4201)
+!4222 = distinct !DISubprogram(name: "kernel_183", scope: !9, file: !9, line: 7330, type: !11, scopeLine: 7330, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!4223 = !DILocation(line: 7331, column: 8, scope: !4222)
+!4224 = !DILocation(line: 7332, column: 10, scope: !4222)
+!4225 = !DILocation(line: 7333, column: 21, scope: !4222)
+!4226 = !DILocation(line: 7334, column: 38, scope: !4222)
+!4227 = !DILocation(line: 7334, column: 27, scope: !4222)
+!4228 = !DILocation(line: 7334, column: 8, scope: !4222)
+!4229 = !DILocation(line: 7335, column: 13, scope: !4222)
+!4230 = !DILocation(line: 7336, column: 8, scope: !4222)
+!4231 = !DILocation(line: 7336, column: 27, scope: !4222)
+!4232 = !DILocation(line: 7337, column: 31, scope: !4222)
+!4233 = !DILocation(line: 7338, column: 26, scope: !4222)
+!4234 = !DILocation(line: 7339, column: 12, scope: !4222)
+!4235 = !DILocation(line: 7341, column: 36, scope: !4222)
+!4236 = !DILocation(line: 7341, column: 32, scope: !4222)
+!4237 = !DILocation(line: 7343, column: 10, scope: !4222)
+!4238 = !DILocation(line: 7345, column: 4, scope: !4222)
+!4239 = !DILocation(line: 7346, column: 25, scope: !4222)
+!4240 = !DILocation(line: 7348, column: 40, scope: !4222)
+!4241 = !DILocation(line: 7348, column: 5, scope: !4222)
+!4242 = !DILocation(line: 7348, column: 8, scope: !4222)
+!4243 = !DILocation(line: 7350, column: 25, scope: !4222)
+!4244 = !DILocation(line: 7351, column: 4, scope: !4222)
+!4245 = !DILocation(line: 7353, column: 28, scope: !4222)
+!4246 = !DILocation(line: 7354, column: 21, scope: !4222)
+!4247 = !DILocation(line: 7355, column: 27, scope: !4222)
+!4248 = !DILocation(line: 7356, column: 40, scope: !4222)
+!4249 = !DILocation(line: 7357, column: 34, scope: !4222)
+!4250 = !DILocation(line: 7358, column: 37, scope: !4222)
+!4251 = !DILocation(line: 7360, column: 39, scope: !4222)
+!4252 = !DILocation(line: 7362, column: 33, scope: !4222)
+!4253 = !DILocation(line: 7364, column: 37, scope: !4222)
+!4254 = !DILocation(line: 7365, column: 14, scope: !4222)
+!4255 = distinct !DISubprogram(name: "kernel_184", scope: !2, file: !2, line: 7370, type: !11, scopeLine: 7370, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!4256 = !DILocation(line: 7372, column: 11, scope: !4255)
+!4257 = !DILocation(line: 7373, column: 38, scope: !4255)
+!4258 = !DILocation(line: 7373, column: 31, scope: !4255)
+!4259 = !DILocation(line: 7374, column: 35, scope: !4255)
+!4260 = !DILocation(line: 7374, column: 22, scope: !4255)
+!4261 = !DILocation(line: 7375, column: 37, scope: !4255)
+!4262 = !DILocation(line: 7376, column: 36, scope: !4255)
+!4263 = !DILocation(line: 7378, column: 18, scope: !4255)
+!4264 = !DILocation(line: 7379, column: 34, scope: !4255)
+!4265 = !DILocation(line: 7380, column: 39, scope: !4255)
+!4266 = !DILocation(line: 7381, column: 30, scope: !4255)
+!4267 = !DILocation(line: 7382, column: 25, scope: !4255)
+!4268 = !DILocation(line: 7383, column: 31, scope: !4255)
+!4269 = !DILocation(line: 7383, column: 14, scope: !4255)
+!4270 = !DILocation(line: 7384, column: 15, scope: !4255)
+!4271 = !DILocation(line: 7384, column: 19, scope: !4255)
+!4272 = !DILocation(line: 7385, column: 27, scope: !4255)
+!4273 = distinct !DISubprogram(name: "kernel_185", scope: !3, file: !3, line: 7410, type: !11, scopeLine: 7410, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!4274 = !DILocation(line: 7411, column: 39, scope: !4273)
+!4275 = !DILocation(line: 7413, column: 16, scope: !4273)
+!4276 = !DILocation(line: 7415, column: 30, scope: !4273)
+!4277 = !DILocation(line: 7417, column: 10, scope: !4273)
+!4278 = !DILocation(line: 7418, column: 35, scope: !4273)
+!4279 = !DILocation(line: 7419, column: 21, scope: !4273)
+!4280 = !DILocation(line: 7419, column: 22, scope: !4273)
+!4281 = !DILocation(line: 7421, column: 35, scope: !4273)
+!4282 = !DILocation(line: 7422, column: 24, scope: !4273)
+!4283 = !DILocation(line: 7423, column: 22, scope: !4273)
+!4284 = !DILocation(line: 7424, column: 3, scope: !4273)
+!4285 = !DILocation(line: 7424, column: 14, scope: !4273)
+!4286 = !DILocation(line: 7424, column: 35, scope: !4273)
+!4287 = !DILocation(line: 7424, column: 13, scope: !4273)
+!4288 = !DILocation(line: 7424, column: 40, scope: !4273)
+!4289 = !DILocation(line: 7424, column: 7, scope: !4273)
+!4290 = !DILocation(line: 7425, column: 38, scope: !4273)
+!4291 = !DILocation(line: 7426, column: 15, scope: !4273)
+!4292 = !DILocation(line: 7427, column: 12, scope: !4273)
+!4293 = distinct !{!4293, !26}
+!4294 = !DILocation(line: 7427, column: 3, scope: !4273)
+!4295 = distinct !DISubprogram(name: "kernel_186", scope: !4, file: !4, line: 7450, type: !11, scopeLine: 7450, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!4296 = !DILocation(line: 7451, column: 25, scope: !4295)
+!4297 = !DILocation(line: 7453, column: 12, scope: !4295)
+!4298 = !DILocation(line: 7453, column: 35, scope: !4295)
+!4299 = !DILocation(line: 7454, column: 21, scope: !4295)
+!4300 = !DILocation(line: 7455, column: 4, scope: !4295)
+!4301 = !DILocation(line: 7456, column: 22, scope: !4295)
+!4302 = !DILocation(line: 7456, column: 16, scope: !4295)
+!4303 = !DILocation(line: 7457, column: 9, scope: !4295)
+!4304 = !DILocation(line: 7457, column: 5, scope: !4295)
+!4305 = !DILocation(line: 7459, column: 38, scope: !4295)
+!4306 = !DILocation(line: 7459, column: 37, scope: !4295)
+!4307 = !DILocation(line: 7460, column: 37, scope: !4295)
+!4308 = !DILocation(line: 7461, column: 27, scope: !4295)
+!4309 = !DILocation(line: 7463, column: 4, scope: !4295)
+!4310 = !DILocation(line: 7463, column: 18, scope: !4295)
+!4311 = !DILocation(line: 7464, column: 36, scope: !4295)
+!4312 = !DILocation(line: 7465, column: 29, scope: !4295)
+!4313 = !DILocation(line: 7466, column: 19, scope: !4295)
+!4314 = !DILocation(line: 7468, column: 4, scope: !4295)
+!4315 = !DILocation(line: 7468, column: 25, scope: !4295)
+!4316 = distinct !DISubprogram(name: "kernel_187", scope: !5, file: !5, line: 7490, type: !11, scopeLine: 7490, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!4317 = !DILocation(line: 7492, column: 28, scope: !4316)
+!4318 = !DILocation(line: 7492, column: 22, scope: !4316)
+!4319 = !DILocation(line: 7493, column: 38, scope: !4316)
+!4320 = !DILocation(line: 7494, column: 14, scope: !4316)
+!4321 = !DILocation(line: 7495, column: 30, scope: !4316)
+!4322 = !DILocation(line: 7495, column: 6, scope: !4316)
+!4323 = !DILocation(line: 7496, column: 37, scope: !4316)
+!4324 = !DILocation(line: 7498, column: 40, scope: !4316)
+!4325 = !DILocation(line: 7499, column: 27, scope: !4316)
+!4326 = !DILocation(line: 7500, column: 13, scope: !4316)
+!4327 = !DILocation(line: 7501, column: 19, scope: !4316)
+!4328 = !DILocation(line: 7503, column: 23, scope: !4316)
+!4329 = !DILocation(line: 7503, column: 6, scope: !4316)
+!4330 = !DILocation(line: 7504, column: 20, scope: !4316)
+!4331 = !DILocation(line: 7504, column: 9, scope: !4316)
+!4332 = !DILocation(line: 7504, column: 26, scope: !4316)
+!4333 = !DILocation(line: 7506, column: 14, scope: !4316)
+!4334 = !DILocation(line: 7507, column: 39, scope: !4316)
+!4335 = distinct !DISubprogram(name: "kernel_188", scope: !6, file: !6, line: 7530, type: !11, scopeLine: 7530, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!4336 = !DILocation(line: 7531, column: 8, scope: !4335)
+!4337 = !DILocation(line: 7532, column: 19, scope: !4335)
+!4338 = !DILocation(line: 7533, column: 18, scope: !4335)
+!4339 = !DILocation(line: 7534, column: 33, scope: !4335)
+!4340 = !DILocation(line: 7534, column: 11, scope: !4335)
+!4341 = !DILocation(line: 7535, column: 17, scope: !4335)
+!4342 = !DILocation(line: 7535, column: 39, scope: !4335)
+!4343 = !DILocation(line: 7536, column: 8, scope: !4335)
+!4344 = !DILocation(line: 7537, column: 8, scope: !4335)
+!4345 = !DILocation(line: 7537, column: 13, scope: !4335)
+!4346 = !DILocation(line: 7538, column: 22, scope: !4335)
+!4347 = !DILocation(line: 7539, column: 9, scope: !4335)
+!4348 = !DILocation(line: 7540, column: 16, scope: !4335)
+!4349 = !DILocation(line: 7542, column: 12, scope: !4335)
+!4350 = !DILocation(line: 7542, column: 6, scope: !4335)
+!4351 = !DILocation(line: 7542, column: 36, scope: !4335)
+!4352 = !DILocation(line: 7543, column: 28, scope: !4335)
+!4353 = !DILocation(line: 7544, column: 10, scope: !4335)
+!4354 = !DILocation(line: 7546, column: 11, scope: !4335)
+!4355 = !DILocation(line: 7547, column: 12, scope: !4335)
+!4356 = !DILocation(line: 7548, column: 39, scope: !4335)
+!4357 = !DILocation(line: 7549, column: 27, scope: !4335)
+!4358 = !DILocation(line: 7550, column: 38, scope: !4335)
+!4359 = !DILocation(line: 7550, column: 14, scope: !4335)
+!4360 = !DILocation(line: 7552, column: 6, scope: !4335)
+!4361 = !DILocation(line: 7554, column: 6, scope: !4335)
+!4362 = !DILocation(line: 7556, column: 14, scope: !4335)
+!4363 = !DILocation(line: 7556, column: 17, scope: !4335)
+!4364 = !DILocation(line: 7558, column: 31, scope: !4335)
+!4365 = !DILocation(line: 7560, column: 36, scope: !4335)
+!4366 = !DILocation(line: 7561, column: 32, scope: !4335)
+!4367 = !DILocation(line: 7562, column: 25, scope: !4335)
+!4368 = !DILocation(line: 7563, column: 21, scope: !4335)
+!4369 = !DILocation(line: 7565, column: 28, scope: !4335)
+!4370 = !DILocation(line: 7565, column: 40, scope: !4335)
+!4371 = !DILocation(line: 7567, column: 28, scope: !4335)
+!4372 = !DILocation(line: 7568, column: 21, scope: !4335)
+!4373 = !DILocation(line: 7569, column: 20, scope: !4335)
+!4374 = !DILocation(line: 7570, column: 23, scope: !4335)
+!4375 = !DILocation(line: 7572, column: 30, scope: !4335)
+!4376 = !DILocation(line: 7573, column: 30, scope: !4335)
+!4377 = distinct !DISubprogram(name: "kernel_189", scope: !7, file: !7, line: 7570, type: !11, scopeLine: 7570, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!4378 = !DILocation(line: 7572, column: 16, scope: !4377)
+!4379 = !DILocation(line: 7573, column: 35, scope: !4377)
+!4380 = !DILocation(line: 7573, column: 32, scope: !4377)
+!4381 = !DILocation(line: 7575, column: 37, scope: !4377)
+!4382 = !DILocation(line: 7576, column: 7, scope: !4377)
+!4383 = !DILocation(line: 7578, column: 31, scope: !4377)
+!4384 = !DILocation(line: 7578, column: 25, scope: !4377)
+!4385 = !DILocation(line: 7578, column: 17, scope: !4377)
+!4386 = !DILocation(line: 7579, column: 35, scope: !4377)
+!4387 = !DILocation(line: 7580, column: 16, scope: !4377)
+!4388 = !DILocation(line: 7580, column: 9, scope: !4377)
+!4389 = !DILocation(line: 7582, column: 32, scope: !4377)
+!4390 = !DILocation(line: 7584, column: 15, scope: !4377)
+!4391 = !DILocation(line: 7585, column: 20, scope: !4377)
+!4392 = !DILocation(line: 7586, column: 16, scope: !4377)
+!4393 = !DILocation(line: 7587, column: 20, scope: !4377)
+!4394 = distinct !DISubprogram(name: "kernel_190", scope: !8, file: !8, line: 7610, type: !11, scopeLine: 7610, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!4395 = !DILocation(line: 7612, column: 22, scope: !4394)
+!4396 = !DILocation(line: 7614, column: 11, scope: !4394)
+!4397 = !DILocation(line: 7616, column: 37, scope: !4394)
+!4398 = !DILocation(line: 7618, column: 8, scope: !4394)
+!4399 = !DILocation(line: 7619, column: 8, scope: !4394)
+!4400 = !DILocation(line: 7619, column: 24, scope: !4394)
+!4401 = !DILocation(line: 7619, column: 14, scope: !4394)
+!4402 = !DILocation(line: 7620, column: 27, scope: !4394)
+!4403 = !DILocation(line: 7620, column: 35, scope: !4394)
+!4404 = !DILocation(line: 7621, column: 32, scope: !4394)
+!4405 = !DILocation(line: 7622, column: 30, scope: !4394)
+!4406 = !DILocation(line: 7622, column: 34, scope: !4394)
+!4407 = !DILocation(line: 7622, column: 13, scope: !4394)
+!4408 = !DILocation(line: 7623, column: 7, scope: !4394)
+!4409 = !DILocation(line: 7624, column: 14, scope: !4394)
+!4410 = !DILocation(line: 7625, column: 5, scope: !4394)
+!4411 = !DILocation(line: 7627, column: 18, scope: !4394)
+!4412 = !DILocation(line: 7627, column: 6, scope: !4394)
+!4413 = !DILocation(line: 7628, column: 10, scope: !4394)
+!4414 = distinct !{!4414, !26}
+!4415 = !DILocation(line: 7630, column: 38, scope: !4394)
+!4416 = distinct !DISubprogram(name: "kernel_191", scope: !9, file: !9, line: 7650, type: !11, scopeLine: 7650, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!4417 = !DILocation(line: 7651, column: 9, scope: !4416)
+!4418 = !DILocation(line: 7652, column: 27, scope: !4416)
+!4419 = !DILocation(line: 7653, column: 35, scope: !4416)
+!4420 = !DILocation(line: 7655, column: 13, scope: !4416)
+!4421 = !DILocation(line: 7656, column: 12, scope: !4416)
+!4422 = !DILocation(line: 7657, column: 29, scope: !4416)
+!4423 = !DILocation(line: 7659, column: 18, scope: !4416)
+!4424 = !DILocation(line: 7660, column: 14, scope: !4416)
+!4425 = !DILocation(line: 7660, column: 5, scope: !4416)
+!4426 = !DILocation(line: 7662, column: 24, scope: !4416)
+!4427 = !DILocation(line: 7663, column: 17, scope: !4416)
+!4428 = !DILocation(line: 7664, column: 24, scope: !4416)
+!4429 = !DILocation(line: 7665, column: 32, scope: !4416)
+!4430 = !DILocation(line: 7666, column: 4, scope: !4416)
+!4431 = !DILocation(line: 7667, column: 33, scope: !4416)
+!4432 = !DILocation(line: 7669, column: 5, scope: !4416)
+!4433 = !DILocation(line: 7670, column: 7, scope: !4416)
+!4434 = !DILocation(line: 7672, column: 11, scope: !4416)
+!4435 = !DILocation(line: 7673, column: 34, scope: !4416)
+!4436 = !DILocation(line: 7673, column: 18, scope: !4416)
+!4437 = distinct !DISubprogram(name: "kernel_192", scope: !2, file: !2, line: 7690, type: !11, scopeLine: 7690, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!4438 = !DILocation(line: 7690, column: 15, scope: !4437)
+!4439 = !DILocation(line: 7690, column: 36, scope: !4437)
+!4440 = !DILocation(line: 7692, column: 33, scope: !4437)
+!4441 = !DILocation(line: 7693, column: 35, scope: !4437)
+!4442 = !DILocation(line: 7695, column: 32, scope: !4437)
+!4443 = !DILocation(line: 7697, column: 34, scope: !4437)
+!4444 = !DILocation(line: 7699, column: 5, scope: !4437)
+!4445 = !DILocation(line: 7699, column: 24, scope: !4437)
+!4446 = !DILocation(line: 7700, column: 30, scope: !4437)
+!4447 = !DILocation(line: 7700, column: 29, scope: !4437)
+!4448 = !DILocation(line: 7700, column: 36, scope: !4437)
+!4449 = !DILocation(line: 7700, column: 9, scope: !4437)
+!4450 = distinct !DISubprogram(name: "kernel_193", scope: !3, file: !3, line: 7730, type: !11, scopeLine: 7730, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!4451 = !DILocation(line: 7731, column: 30, scope: !4450)
+!4452 = !DILocation(line: 7732, column: 31, scope: !4450)
+!4453 = !DILocation(line: 7734, column: 25, scope: !4450)
+!4454 = !DILocation(line: 7736, column: 38, scope: !4450)
+!4455 = !DILocation(line: 7737, column: 14, scope: !4450)
+!4456 = !DILocation(line: 7737, column: 33, scope: !4450)
+!4457 = !DILocation(line: 7738, column: 33, scope: !4450)
+!4458 = !DILocation(line: 7738, column: 34, scope: !4450)
+!4459 = !DILocation(line: 7739, column: 30, scope: !4450)
+!4460 = !DILocation(line: 7741, column: 11, scope: !4450)
+!4461 = !DILocation(line: 7741, column: 22, scope: !4450)
+!4462 = !DILocation(line: 7742, column: 14, scope: !4450)
+!4463 = !DILocation(line: 7742, column: 7, scope: !4450)
+!4464 = !DILocation(line: 7743, column: 7, scope: !4450)
+!4465 = !DILocation(line: 7745, column: 13, scope: !4450)
+!4466 = !DILocation(line: 7747, column: 39, scope: !4450)
+!4467 = !DILocation(line: 7747, column: 21, scope: !4450)
+!4468 = !DILocation(line: 7748, column: 34, scope: !4450)
+!4469 = !DILocation(line: 7749, column: 10, scope: !4450)
+!4470 = !DILocation(line: 7749, column: 13, scope: !4450)
+!4471 = !DILocation(line: 7750, column: 30, scope: !4450)
+!4472 = !DILocation(line: 7751, column: 38, scope: !4450)
+!4473 = !DILocation(line: 7752, column: 20, scope: !4450)
+!4474 = !DILocation(line: 7753, column: 24, scope: !4450)
+!4475 = !DILocation(line: 7754, column: 3, scope: !4450)
+!4476 = !DILocation(line: 7755, column: 30, scope: !4450)
+!4477 = !DILocation(line: 7756, column: 3, scope: !4450)
+!4478 = !DILocation(line: 7756, column: 33, scope: !4450)
+!4479 = !DILocation(line: 7756, column: 16, scope: !4450)
+!4480 = !DILocation(line: 7758, column: 38, scope: !4450)
+!4481 = !DILocation(line: 7758, column: 13, scope: !4450)
+!4482 = !DILocation(line: 7760, column: 9, scope: !4450)
+!4483 = !DILocation(line: 7760, column: 3, scope: !4450)
+!4484 = !DILocation(line: 7762, column: 9, scope: !4450)
+!4485 = !DILocation(line: 7763, column: 18, scope: !4450)
+!4486 = !DILocation(line: 7765, column: 16, scope: !4450)
+!4487 = !DILocation(line: 7766, column: 30, scope: !4450)
+!4488 = !DILocation(line: 7767, column: 10, scope: !4450)
+!4489 = distinct !DISubprogram(name: "kernel_194", scope: !4, file: !4, line: 7770, type: !11, scopeLine: 7770, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!4490 = !DILocation(line: 7770, column: 22, scope: !4489)
+!4491 = !DILocation(line: 7771, column: 13, scope: !4489)
+!4492 = !DILocation(line: 7771, column: 39, scope: !4489)
+!4493 = !DILocation(line: 7771, column: 21, scope: !4489)
+!4494 = !DILocation(line: 7773, column: 22, scope: !4489)
+!4495 = !DILocation(line: 7773, column: 12, scope: !4489)
+!4496 = !DILocation(line: 7774, column: 27, scope: !4489)
+!4497 = !DILocation(line: 7775, column: 14, scope: !4489)
+!4498 = !DILocation(line: 7776, column: 35, scope: !4489)
+!4499 = !DILocation(line: 7777, column: 31, scope: !4489)
+!4500 = !DILocation(line: 7778, column: 18, scope: !4489)
+!4501 = !DILocation(line: 7778, column: 38, scope: !4489)
+!4502 = !DILocation(line: 7779, column: 12, scope: !4489)
+!4503 = !DILocation(line: 7779, column: 28, scope: !4489)
+!4504 = !DILocation(line: 7781, column: 15, scope: !4489)
+!4505 = !DILocation(line: 7783, column: 20, scope: !4489)
+!4506 = !DILocation(line: 7784, column: 27, scope: !4489)
+!4507 = distinct !DISubprogram(name: "kernel_195", scope: !5, file: !5, line: 7810, type: !11, scopeLine: 7810, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!4508 = !DILocation(line: 7811, column: 13, scope: !4507)
+!4509 = !DILocation(line: 7812, column: 25, scope: !4507)
+!4510 = !DILocation(line: 7813, column: 18, scope: !4507)
+!4511 = !DILocation(line: 7814, column: 16, scope: !4507)
+!4512 = !DILocation(line: 7814, column: 5, scope: !4507)
+!4513 = !DILocation(line: 7814, column: 11, scope: !4507)
+!4514 = !DILocation(line: 7816, column: 16, scope: !4507)
+!4515 = !DILocation(line: 7816, column: 6, scope: !4507)
+!4516 = !DILocation(line: 7816, column: 17, scope: !4507)
+!4517 = !DILocation(line: 7816, column: 27, scope: !4507)
+!4518 = !DILocation(line: 7816, column: 8, scope: !4507)
+!4519 = !DILocation(line: 7817, column: 28, scope: !4507)
+!4520 = !DILocation(line: 7818, column: 31, scope: !4507)
+!4521 = !DILocation(line: 7820, column: 21, scope: !4507)
+!4522 = !DILocation(line: 7821, column: 9, scope: !4507)
+!4523 = !DILocation(line: 7822, column: 26, scope: !4507)
+!4524 = !DILocation(line: 7823, column: 9, scope: !4507)
+!4525 = !DILocation(line: 7824, column: 22, scope: !4507)
+!4526 = !DILocation(line: 7825, column: 11, scope: !4507)
+!4527 = distinct !{!4527, !26}
+!4528 = !DILocation(line: 7825, column: 24, scope: !4507)
+!4529 = distinct !DISubprogram(name: "kernel_196", scope: !6, file: !6, line: 7850, type: !11, scopeLine: 7850, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!4530 = !DILocation(line: 7850, column: 30, scope: !4529)
+!4531 = !DILocation(line: 7851, column: 26, scope: !4529)
+!4532 = !DILocation(line: 7852, column: 30, scope: !4529)
+!4533 = !DILocation(line: 7852, column: 3, scope: !4529)
+!4534 = !DILocation(line: 7854, column: 21, scope: !4529)
+!4535 = !DILocation(line: 7856, column: 21, scope: !4529)
+!4536 = !DILocation(line: 7857, column: 14, scope: !4529)
+!4537 = !DILocation(line: 7859, column: 26, scope: !4529)
+!4538 = !DILocation(line: 7860, column: 13, scope: !4529)
+!4539 = !DILocation(line: 7861, column: 23, scope: !4529)
+!4540 = !DILocation(line: 7862, column: 6, scope: !4529)
+!4541 = !DILocation(line: 7864, column: 10, scope: !4529)
+!4542 = !DILocation(line: 7865, column: 27, scope: !4529)
+!4543 = !DILocation(line: 7866, column: 7, scope: !4529)
+!4544 = !DILocation(line: 7866, column: 38, scope: !4529)
+!4545 = !DILocation(line: 7868, column: 28, scope: !4529)
+!4546 = !DILocation(line: 7869, column: 20, scope: !4529)
+!4547 = !DILocation(line: 7869, column: 6, scope: !4529)
+!4548 = !DILocation(line: 7869, column: 25, scope: !4529)
+!4549 = !DILocation(line: 7871, column: 24, scope: !4529)
+!4550 = distinct !DISubprogram(name: "kernel_197", scope: !7, file: !7, line: 7890, type: !11, scopeLine: 7890, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!4551 = !DILocation(line: 7892, column: 38, scope: !4550)
+!4552 = !DILocation(line: 7893, column: 10, scope: !4550)
+!4553 = !DILocation(line: 7895, column: 16, scope: !4550)
+!4554 = !DILocation(line: 7896, column: 21, scope: !4550)
+!4555 = !DILocation(line: 7897, column: 17, scope: !4550)
+!4556 = !DILocation(line: 7899, column: 15, scope: !4550)
+!4557 = !DILocation(line: 7901, column: 12, scope: !4550)
+!4558 = !DILocation(line: 7902, column: 23, scope: !4550)
+!4559 = !DILocation(line: 7903, column: 6, scope: !4550)
+!4560 = !DILocation(line: 7904, column: 3, scope: !4550)
+!4561 = !DILocation(line: 7905, column: 17, scope: !4550)
+!4562 = !DILocation(line: 7907, column: 8, scope: !4550)
+!4563 = distinct !DISubprogram(name: "kernel_198", scope: !8, file: !8, line: 7930, type: !11, scopeLine: 7930, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!4564 = !DILocation(line: 7930, column: 28, scope: !4563)
+!4565 = !DILocation(line: 7931, column: 20, scope: !4563)
+!4566 = !DILocation(line: 7931, column: 37, scope: !4563)
+!4567 = !DILocation(line: 7932, column: 24, scope: !4563)
+!4568 = !DILocation(line: 7933, column: 13, scope: !4563)
+!4569 = !DILocation(line: 7935, column: 34, scope: !4563)
+!4570 = !DILocation(line: 7936, column: 34, scope: !4563)
+!4571 = !DILocation(line: 7938, column: 26, scope: !4563)
+!4572 = !DILocation(line: 7938, column: 6, scope: !4563)
+!4573 = !DILocation(line: 7940, column: 28, scope: !4563)
+!4574 = !DILocation(line: 7942, column: 22, scope: !4563)
+!4575 = !DILocation(line: 7944, column: 9, scope: !4563)
+!4576 = !DILocation(line: 7946, column: 7, scope: !4563)
+!4577 = !DILocation(line: 7948, column: 7, scope: !4563)
+!4578 = !DILocation(line: 7950, column: 38, scope: !4563)
+!4579 = !DILocation(line: 7951, column: 16, scope: !4563)
+!4580 = !DILocation(line: 7952, column: 40, scope: !4563)
+!4581 = !DILocation(line: 7953, column: 10, scope: !4563)
+!4582 = !DILocation(line: 7954, column: 11, scope: !4563)
+!4583 = !DILocation(line: 7955, column: 8, scope: !4563)
+!4584 = !DILocation(line: 7955, column: 37, scope: !4563)
+!4585 = !DILocation(line: 7956, column: 34, scope: !4563)
+!4586 = !DILocation(line: 7957, column: 40, scope: !4563)
+!4587 = !DILocation(line: 7958, column: 18, scope: !4563)
+!4588 = !DILocation(line: 7959, column: 17, scope: !4563)
+!4589 = !DILocation(line: 7960, column: 38, scope: !4563)
+!4590 = distinct !DISubprogram(name: "kernel_199", scope: !9, file: !9, line: 7970, type: !11, scopeLine: 7970, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!4591 = !DILocation(line: 7971, column: 15, scope: !4590)
+!4592 = !DILocation(line: 7972, column: 19, scope: !4590)
+!4593 = !DILocation(line: 7974, column: 20, scope: !4590)
+!4594 = !DILocation(line: 7974, column: 10, scope: !4590)
+!4595 = !DILocation(line: 7974, column: 5, scope: !4590)
+!4596 = !DILocation(line: 7976, column: 13, scope: !4590)
+!4597 = !DILocation(line: 7976, column: 27, scope: !4590)
+!4598 = !DILocation(line: 7977, column: 6, scope: !4590)
+!4599 = !DILocation(line: 7978, column: 7, scope: !4590)
+!4600 = !DILocation(line: 7979, column: 40, scope: !4590)
+!4601 = !DILocation(line: 7979, column: 32, scope: !4590)
+!4602 = !DILocation(line: 7981, column: 24, scope: !4590)
+!4603 = !DILocation(line: 7982, column: 9, scope: !4590)
+!4604 = !DILocation(line: 7982, column: 8, scope: !4590)
+!4605 = !DILocation(line: 7984, column: 38, scope: !4590)
+!4606 = !DILocation(line: 7986, column: 26, scope: !4590)
+!4607 = distinct !DISubprogram(name: "kernel_200", scope: !2, file: !2, line: 8010, type: !11, scopeLine: 8010, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!4608 = !DILocation(line: 8011, column: 25, scope: !4607)
+!4609 = !DILocation(line: 8012, column: 11, scope: !4607)
+!4610 = !DILocation(line: 8012, column: 27, scope: !4607)
+!4611 = !DILocation(line: 8013, column: 31, scope: !4607)
+!4612 = !DILocation(line: 8014, column: 37, scope: !4607)
+!4613 = !DILocation(line: 8014, column: 23, scope: !4607)
+!4614 = !DILocation(line: 8016, column: 25, scope: !4607)
+!4615 = !DILocation(line: 8017, column: 25, scope: !4607)
+!4616 = !DILocation(line: 8017, column: 3, scope: !4607)
+!4617 = !DILocation(line: 8018, column: 36, scope: !4607)
+!4618 = !DILocation(line: 8018, column: 11, scope: !4607)
+!4619 = !DILocation(line: 8019, column: 4, scope: !4607)
+!4620 = !DILocation(line: 8019, column: 20, scope: !4607)
+!4621 = !DILocation(line: 8020, column: 25, scope: !4607)
+!4622 = !DILocation(line: 8021, column: 29, scope: !4607)
+!4623 = !DILocation(line: 8021, column: 18, scope: !4607)
+!4624 = !DILocation(line: 8023, column: 22, scope: !4607)
+!4625 = !DILocation(line: 8025, column: 33, scope: !4607)
+!4626 = !DILocation(line: 8025, column: 4, scope: !4607)
+!4627 = distinct !{!4627, !26}
+!4628 = !DILocation(line: 8025, column: 20, scope: !4607)
+!4629 = distinct !DISubprogram(name: "kernel_201", scope: !3, file: !3, line: 8050, type: !11, scopeLine: 8050, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!4630 = !DILocation(line: 8051, column: 15, scope: !4629)
+!4631 = !DILocation(line: 8051, column: 34, scope: !4629)
+!4632 = !DILocation(line: 8051, column: 36, scope: !4629)
+!4633 = !DILocation(line: 8053, column: 22, scope: !4629)
+!4634 = !DILocation(line: 8053, column: 16, scope: !4629)
+!4635 = !DILocation(line: 8055, column: 3, scope: !4629)
+!4636 = !DILocation(line: 8057, column: 12, scope: !4629)
+!4637 = !DILocation(line: 8058, column: 6, scope: !4629)
+!4638 = !DILocation(line: 8060, column: 26, scope: !4629)
+!4639 = !DILocation(line: 8061, column: 25, scope: !4629)
+!4640 = !DILocation(line: 8062, column: 9, scope: !4629)
+!4641 = !DILocation(line: 8064, column: 26, scope: !4629)
+!4642 = !DILocation(line: 8066, column: 24, scope: !4629)
+!4643 = !DILocation(line: 8067, column: 13, scope: !4629)
+!4644 = !DILocation(line: 8067, column: 27, scope: !4629)
+!4645 = !DILocation(line: 8068, column: 27, scope: !4629)
+!4646 = !DILocation(line: 8069, column: 17, scope: !4629)
+!4647 = !DILocation(line: 8070, column: 7, scope: !4629)
+!4648 = !DILocation(line: 8070, column: 17, scope: !4629)
+!4649 = !DILocation(line: 8071, column: 34, scope: !4629)
+!4650 = distinct !DISubprogram(name: "kernel_202", scope: !4, file: !4, line: 8090, type: !11, scopeLine: 8090, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!4651 = !DILocation(line: 8090, column: 11, scope: !4650)
+!4652 = !DILocation(line: 8092, column: 35, scope: !4650)
+!4653 = !DILocation(line: 8093, column: 34, scope: !4650)
+!4654 = !DILocation(line: 8094, column: 5, scope: !4650)
+!4655 = !DILocation(line: 8095, column: 4, scope: !4650)
+!4656 = !DILocation(line: 8097, column: 32, scope: !4650)
+!4657 = !DILocation(line: 8099, column: 9, scope: !4650)
+!4658 = !DILocation(line: 8100, column: 34, scope: !4650)
+!4659 = !DILocation(line: 8101, column: 31, scope: !4650)
+!4660 = !DILocation(line: 8102, column: 11, scope: !4650)
+!4661 = !DILocation(line: 8103, column: 18, scope: !4650)
+!4662 = !DILocation(line: 8105, column: 12, scope: !4650)
+!4663 = !DILocation(line: 8106, column: 36, scope: !4650)
+!4664 = !DILocation(line: 8108, column: 8, scope: !4650)
+!4665 = !DILocation(line: 8108, column: 34, scope: !4650)
+!4666 = !DILocation(line: 8110, column: 32, scope: !4650)
+!4667 = !DILocation(line: 8111, column: 26, scope: !4650)
+!4668 = !DILocation(line: 8113, column: 15, scope: !4650)
+!4669 = distinct !DISubprogram(name: "kernel_203", scope: !5, file: !5, line: 8130, type: !11, scopeLine: 8130, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!4670 = !DILocation(line: 8131, column: 25, scope: !4669)
+!4671 = !DILocation(line: 8131, column: 21, scope: !4669)
+!4672 = !DILocation(line: 8131, column: 19, scope: !4669)
+!4673 = !DILocation(line: 8131, column: 8, scope: !4669)
+!4674 = !DILocation(line: 8132, column: 12, scope: !4669)
+!4675 = !DILocation(line: 8134, column: 20, scope: !4669)
+!4676 = !DILocation(line: 8135, column: 16, scope: !4669)
+!4677 = !DILocation(line: 8136, column: 34, scope: !4669)
+!4678 = !DILocation(line: 8137, column: 12, scope: !4669)
+!4679 = !DILocation(line: 8139, column: 19, scope: !4669)
+!4680 = !DILocation(line: 8141, column: 22, scope: !4669)
+!4681 = !DILocation(line: 8141, column: 18, scope: !4669)
+!4682 = !DILocation(line: 8142, column: 25, scope: !4669)
+!4683 = !DILocation(line: 8143, column: 7, scope: !4669)
+!4684 = !DILocation(line: 8144, column: 6, scope: !4669)
+!4685 = !DILocation(line: 8145, column: 31, scope: !4669)
+!4686 = !DILocation(line: 8147, column: 37, scope: !4669)
+!4687 = !DILocation(line: 8149, column: 37, scope: !4669)
+!4688 = !DILocation(line: 8149, column: 8, scope: !4669)
+!4689 = !DILocation(line: 8151, column: 6, scope: !4669)
+!4690 = !DILocation(line: 8152, column: 6, scope: !4669)
+!4691 = !DILocation(line: 8153, column: 22, scope: !4669)
+!4692 = !DILocation(line: 8154, column: 12, scope: !4669)
+!4693 = !DILocation(line: 8154, column: 40, scope: !4669)
+!4694 = !DILocation(line: 8155, column: 24, scope: !4669)
+!4695 = !DILocation(line: 8157, column: 24, scope: !4669)
+!4696 = !DILocation(line: 8159, column: 26, scope: !4669)
+!4697 = !DILocation(line: 8159, column: 37, scope: !4669)
+!4698 = !DILocation(line: 8159, column: 7, scope: !4669)
+!4699 = !DILocation(line: 8159, column: 28, scope: !4669)
+!4700 = !DILocation(line: 8161, column: 21, scope: !4669)
+!4701 = !DILocation(line: 8162, column: 36, scope: !4669)
+!4702 = !DILocation(line: 8163, column: 31, scope: !4669)
+!4703 = !DILocation(line: 8163, column: 7, scope: !4669)
+!4704 = !DILocation(line: 8164, column: 34, scope: !4669)
+!4705 = !DILocation(line: 8165, column: 40, scope: !4669)
+!4706 = !DILocation(line: 8166, column: 7, scope: !4669)
+!4707 = !DILocation(line: 8168, column: 25, scope: !4669)
+!4708 = !DILocation(line: 8169, column: 31, scope: !4669)
+!4709 = !DILocation(line: 8171, column: 40, scope: !4669)
+!4710 = !DILocation(line: 8171, column: 16, scope: !4669)
+!4711 = distinct !DISubprogram(name: "kernel_204", scope: !6, file: !6, line: 8170, type: !11, scopeLine: 8170, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!4712 = !DILocation(line: 8171, column: 37, scope: !4711)
+!4713 = !DILocation(line: 8172, column: 35, scope: !4711)
+!4714 = !DILocation(line: 8173, column: 10, scope: !4711)
+!4715 = !DILocation(line: 8173, column: 40, scope: !4711)
+!4716 = !DILocation(line: 8174, column: 3, scope: !4711)
+!4717 = !DILocation(line: 8176, column: 11, scope: !4711)
+!4718 = !DILocation(line: 8178, column: 7, scope: !4711)
+!4719 = !DILocation(line: 8179, column: 40, scope: !4711)
+!4720 = !DILocation(line: 8180, column: 12, scope: !4711)
+!4721 = !DILocation(line: 8181, column: 20, scope: !4711)
+!4722 = !DILocation(line: 8181, column: 19, scope: !4711)
+!4723 = !DILocation(line: 8182, column: 12, scope: !4711)
+!4724 = !DILocation(line: 8182, column: 29, scope: !4711)
+!4725 = !DILocation(line: 8183, column: 38, scope: !4711)
+!4726 = !DILocation(line: 8184, column: 11, scope: !4711)
+!4727 = !DILocation(line: 8184, column: 3, scope: !4711)
+!4728 = !DILocation(line: 8185, column: 24, scope: !4711)
+!4729 = distinct !DISubprogram(name: "kernel_205", scope: !7, file: !7, line: 8210, type: !11, scopeLine: 8210, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!4730 = !DILocation(line: 8211, column: 13, scope: !4729)
+!4731 = !DILocation(line: 8211, column: 7, scope: !4729)
+!4732 = !DILocation(line: 8212, column: 32, scope: !4729)
+!4733 = !DILocation(line: 8212, column: 20, scope: !4729)
+!4734 = !DILocation(line: 8213, column: 3, scope: !4729)
+!4735 = !DILocation(line: 8214, column: 27, scope: !4729)
+!4736 = !DILocation(line: 8215, column: 11, scope: !4729)
+!4737 = !DILocation(line: 8215, column: 32, scope: !4729)
+!4738 = !DILocation(line: 8216, column: 8, scope: !4729)
+!4739 = !DILocation(line: 8217, column: 32, scope: !4729)
+!4740 = !DILocation(line: 8219, column: 11, scope: !4729)
+!4741 = !DILocation(line: 8221, column: 24, scope: !4729)
+!4742 = !DILocation(line: 8222, column: 36, scope: !4729)
+!4743 = !DILocation(line: 8223, column: 40, scope: !4729)
+!4744 = !DILocation(line: 8223, column: 34, scope: !4729)
+!4745 = !DILocation(line: 8223, column: 12, scope: !4729)
+!4746 = !DILocation(line: 8223, column: 39, scope: !4729)
+!4747 = !DILocation(line: 8225, column: 20, scope: !4729)
+!4748 = !DILocation(line: 8226, column: 14, scope: !4729)
+!4749 = distinct !{!4749, !26}
+!4750 = !DILocation(line: 8226, column: 12, scope: !4729)
+!4751 = distinct !DISubprogram(name: "kernel_206", scope: !8, file: !8, line: 8250, type: !11, scopeLine: 8250, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!4752 = !DILocation(line: 8251, column: 40, scope: !4751)
+!4753 = !DILocation(line: 8253, column: 37, scope: !4751)
+!4754 = !DILocation(line: 8255, column: 33, scope: !4751)
+!4755 = !DILocation(line: 8257, column: 20, scope: !4751)
+!4756 = !DILocation(line: 8258, column: 19, scope: !4751)
+!4757 = !DILocation(line: 8259, column: 14, scope: !4751)
+!4758 = !DILocation(line: 8259, column: 31, scope: !4751)
+!4759 = !DILocation(line: 8260, column: 10, scope: !4751)
+!4760 = !DILocation(line: 8260, column: 15, scope: !4751)
+!4761 = !DILocation(line: 8261, column: 28, scope: !4751)
+!4762 = !DILocation(line: 8263, column: 36, scope: !4751)
+!4763 = !DILocation(line: 8265, column: 36, scope: !4751)
+!4764 = !DILocation(line: 8265, column: 7, scope: !4751)
+!4765 = !DILocation(line: 8266, column: 32, scope: !4751)
+!4766 = !DILocation(line: 8268, column: 8, scope: !4751)
+!4767 = !DILocation(line: 8270, column: 20, scope: !4751)
+!4768 = !DILocation(line: 8271, column: 17, scope: !4751)
+!4769 = !DILocation(line: 8272, column: 20, scope: !4751)
+!4770 = !DILocation(line: 8274, column: 19, scope: !4751)
+!4771 = !DILocation(line: 8276, column: 25, scope: !4751)
+!4772 = distinct !DISubprogram(name: "kernel_207", scope: !9, file: !9, line: 8290, type: !11, scopeLine: 8290, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!4773 = !DILocation(line: 8292, column: 9, scope: !4772)
+!4774 = !DILocation(line: 8294, column: 10, scope: !4772)
+!4775 = !DILocation(line: 8295, column: 26, scope: !4772)
+!4776 = !DILocation(line: 8296, column: 24, scope: !4772)
+!4777 = !DILocation(line: 8296, column: 23, scope: !4772)
+!4778 = !DILocation(line: 8296, column: 24, scope: !4772)
+!4779 = !DILocation(line: 8297, column: 35, scope: !4772)
+!4780 = !DILocation(line: 8297, column: 24, scope: !4772)
+!4781 = !DILocation(line: 8297, column: 16, scope: !4772)
+!4782 = !DILocation(line: 8299, column: 20, scope: !4772)
+!4783 = !DILocation(line: 8300, column: 16, scope: !4772)
+!4784 = !DILocation(line: 8301, column: 35, scope: !4772)
+!4785 = !DILocation(line: 8303, column: 10, scope: !4772)
+!4786 = !DILocation(line: 8305, column: 8, scope: !4772)
+!4787 = !DILocation(line: 8305, column: 9, scope: !4772)
+!4788 = !DILocation(line: 8307, column: 22, scope: !4772)
+!4789 = !DILocation(line: 8308, column: 30, scope: !4772)
+!4790 = !DILocation(line: 8308, column: 15, scope: !4772)
+!4791 = !DILocation(line: 8309, column: 10, scope: !4772)
+!4792 = !DILocation(line: 8310, column: 14, scope: !4772)
+!4793 = distinct !DISubprogram(name: "kernel_208", scope: !2, file: !2, line: 8330, type: !11, scopeLine: 8330, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!4794 = !DILocation(line: 8331, column: 21, scope: !4793)
+!4795 = !DILocation(line: 8333, column: 33, scope: !4793)
+!4796 = !DILocation(line: 8335, column: 22, scope: !4793)
+!4797 = !DILocation(line: 8337, column: 13, scope: !4793)
+!4798 = !DILocation(line: 8339, column: 28, scope: !4793)
+!4799 = !DILocation(line: 8340, column: 29, scope: !4793)
+!4800 = !DILocation(line: 8340, column: 14, scope: !4793)
+!4801 = !DILocation(line: 8342, column: 36, scope: !4793)
+!4802 = !DILocation(line: 8344, column: 28, scope: !4793)
+!4803 = !DILocation(line: 8344, column: 19, scope: !4793)
+!4804 = !DILocation(line: 8344, column: 11, scope: !4793)
+!4805 = !DILocation(line: 8345, column: 8, scope: !4793)
+!4806 = !DILocation(line: 8347, column: 23, scope: !4793)
+!4807 = !DILocation(line: 8348, column: 9, scope: !4793)
+!4808 = !DILocation(line: 8348, column: 13, scope: !4793)
+!4809 = !DILocation(line: 8348, column: 34, scope: !4793)
+!4810 = !DILocation(line: 8348, column: 39, scope: !4793)
+!4811 = !DILocation(line: 8350, column: 19, scope: !4793)
+!4812 = !DILocation(line: 8351, column: 10, scope: !4793)
+!4813 = !DILocation(line: 8351, column: 9, scope: !4793)
+!4814 = !DILocation(line: 8353, column: 3, scope: !4793)
+!4815 = !DILocation(line: 8353, column: 3, scope: !4793)
+!4816 = !DILocation(line: 8355, column: 18, scope: !4793)
+!4817 = !DILocation(line: 8356, column: 19, scope: !4793)
+!4818 = !DILocation(line: 8358, column: 15, scope: !4793)
+!4819 = !DILocation(line: 8358, column: 30, scope: !4793)
+!4820 = distinct !DISubprogram(name: "kernel_209", scope: !3, file: !3, line: 8370, type: !11, scopeLine: 8370, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!4821 = !DILocation(line: 8372, column: 10, scope: !4820)
+!4822 = !DILocation(line: 8373, column: 24, scope: !4820)
+!4823 = !DILocation(line: 8375, column: 14, scope: !4820)
+!4824 = !DILocation(line: 8376, column: 22, scope: !4820)
+!4825 = !DILocation(line: 8377, column: 24, scope: !4820)
+!4826 = !DILocation(line: 8377, column: 39, scope: !4820)
+!4827 = !DILocation(line: 8378, column: 36, scope: !4820)
+!4828 = !DILocation(line: 8379, column: 18, scope: !4820)
+!4829 = !DILocation(line: 8381, column: 9, scope: !4820)
+!4830 = !DILocation(line: 8381, column: 12, scope: !4820)
+!4831 = !DILocation(line: 8381, column: 39, scope: !4820)
+!4832 = !DILocation(line: 8382, column: 12, scope: !4820)
+!4833 = !DILocation(line: 8384, column: 5, scope: !4820)
+!4834 = !DILocation(line: 8386, column: 3, scope: !4820)
+!4835 = !DILocation(line: 8386, column: 39, scope: !4820)
+!4836 = !DILocation(line: 8386, column: 35, scope: !4820)
+!4837 = distinct !DISubprogram(name: "kernel_210", scope: !4, file: !4, line: 8410, type: !11, scopeLine: 8410, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!4838 = !DILocation(line: 8411, column: 40, scope: !4837)
+!4839 = !DILocation(line: 8413, column: 16, scope: !4837)
+!4840 = !DILocation(line: 8415, column: 25, scope: !4837)
+!4841 = !DILocation(line: 8416, column: 24, scope: !4837)
+!4842 = !DILocation(line: 8417, column: 22, scope: !4837)
+!4843 = !DILocation(line: 8419, column: 27, scope: !4837)
+!4844 = !DILocation(line: 8420, column: 16, scope: !4837)
+!4845 = !DILocation(line: 8420, column: 37, scope: !4837)
+!4846 = !DILocation(line: 8422, column: 23, scope: !4837)
+!4847 = !DILocation(line: 8423, column: 30, scope: !4837)
+!4848 = !DILocation(line: 8424, column: 16, scope: !4837)
+!4849 = !DILocation(line: 8426, column: 23, scope: !4837)
+!4850 = !DILocation(line: 8428, column: 32, scope: !4837)
+!4851 = !DILocation(line: 8429, column: 20, scope: !4837)
+!4852 = !DILocation(line: 8430, column: 4, scope: !4837)
+!4853 = !DILocation(line: 8430, column: 26, scope: !4837)
+!4854 = !DILocation(line: 8431, column: 39, scope: !4837)
+!4855 = !DILocation(line: 8431, column: 10, scope: !4837)
+!4856 = !DILocation(line: 8431, column: 38, scope: !4837)
+!4857 = distinct !{!4857, !26}
+!4858 = !DILocation(line: 8432, column: 7, scope: !4837)
+!4859 = distinct !DISubprogram(name: "kernel_211", scope: !5, file: !5, line: 8450, type: !11, scopeLine: 8450, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!4860 = !DILocation(line: 8450, column: 33, scope: !4859)
+!4861 = !DILocation(line: 8452, column: 5, scope: !4859)
+!4862 = !DILocation(line: 8452, column: 25, scope: !4859)
+!4863 = !DILocation(line: 8453, column: 8, scope: !4859)
+!4864 = !DILocation(line: 8455, column: 14, scope: !4859)
+!4865 = !DILocation(line: 8457, column: 25, scope: !4859)
+!4866 = !DILocation(line: 8458, column: 12, scope: !4859)
+!4867 = !DILocation(line: 8460, column: 23, scope: !4859)
+!4868 = !DILocation(line: 8461, column: 20, scope: !4859)
+!4869 = !DILocation(line: 8462, column: 13, scope: !4859)
+!4870 = !DILocation(line: 8462, column: 4, scope: !4859)
+!4871 = !DILocation(line: 8462, column: 18, scope: !4859)
+!4872 = !DILocation(line: 8463, column: 25, scope: !4859)
+!4873 = !DILocation(line: 8464, column: 12, scope: !4859)
+!4874 = !DILocation(line: 8464, column: 10, scope: !4859)
+!4875 = !DILocation(line: 8466, column: 34, scope: !4859)
+!4876 = !DILocation(line: 8467, column: 26, scope: !4859)
+!4877 = !DILocation(line: 8469, column: 21, scope: !4859)
+!4878 = !DILocation(line: 8470, column: 24, scope: !4859)
+!4879 = !DILocation(line: 8471, column: 34, scope: !4859)
+!4880 = distinct !DISubprogram(name: "kernel_212", scope: !6, file: !6, line: 8490, type: !11, scopeLine: 8490, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!4881 = !DILocation(line: 8491, column: 15, scope: !4880)
+!4882 = !DILocation(line: 8492, column: 28, scope: !4880)
+!4883 = !DILocation(line: 8493, column: 40, scope: !4880)
+!4884 = !DILocation(line: 8495, column: 10, scope: !4880)
+!4885 = !DILocation(line: 8495, column: 6, scope: !4880)
+!4886 = !DILocation(line: 8497, column: 3, scope: !4880)
+!4887 = !DILocation(line: 8497, column: 24, scope: !4880)
+!4888 = !DILocation(line: 8497, column: 16, scope: !4880)
+!4889 = !DILocation(line: 8499, column: 20, scope: !4880)
+!4890 = !DILocation(line: 8499, column: 26, scope: !4880)
+!4891 = !DILocation(line: 8501, column: 37, scope: !4880)
+!4892 = !DILocation(line: 8503, column: 32, scope: !4880)
+!4893 = !DILocation(line: 8504, column: 20, scope: !4880)
+!4894 = !DILocation(line: 8504, column: 29, scope: !4880)
+!4895 = !DILocation(line: 8505, column: 18, scope: !4880)
+!4896 = !DILocation(line: 8506, column: 16, scope: !4880)
+!4897 = distinct !DISubprogram(name: "kernel_213", scope: !7, file: !7, line: 8530, type: !11, scopeLine: 8530, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!4898 = !DILocation(line: 8532, column: 7, scope: !4897)
+!4899 = !DILocation(line: 8533, column: 27, scope: !4897)
+!4900 = !DILocation(line: 8533, column: 12, scope: !4897)
+!4901 = !DILocation(line: 8535, column: 3, scope: !4897)
+!4902 = !DILocation(line: 8537, column: 24, scope: !4897)
+!4903 = !DILocation(line: 8538, column: 38, scope: !4897)
+!4904 = !DILocation(line: 8538, column: 23, scope: !4897)
+!4905 = !DILocation(line: 8540, column: 29, scope: !4897)
+!4906 = !DILocation(line: 8540, column: 27, scope: !4897)
+!4907 = !DILocation(line: 8542, column: 40, scope: !4897)
+!4908 = !DILocation(line: 8543, column: 29, scope: !4897)
+!4909 = !DILocation(line: 8544, column: 16, scope: !4897)
+!4910 = !DILocation(line: 8545, column: 15, scope: !4897)
+!4911 = !DILocation(line: 8545, column: 10, scope: !4897)
+!4912 = !DILocation(line: 8546, column: 25, scope: !4897)
+!4913 = !DILocation(line: 8546, column: 8, scope: !4897)
+!4914 = !DILocation(line: 8547, column: 18, scope: !4897)
+!4915 = !DILocation(line: 8549, column: 10, scope: !4897)
+!4916 = !DILocation(line: 8549, column: 8, scope: !4897)
+!4917 = !DILocation(line: 8551, column: 21, scope: !4897)
+!4918 = !DILocation(line: 8551, column: 19, scope: !4897)
+!4919 = !DILocation(line: 8552, column: 35, scope: !4897)
+!4920 = !DILocation(line: 8552, column: 11, scope: !4897)
+!4921 = !DILocation(line: 8553, column: 12, scope: !4897)
+!4922 = !DILocation(line: 8554, column: 38, scope: !4897)
+!4923 = !DILocation(line: 8556, column: 11, scope: !4897)
+!4924 = !DILocation(line: 8558, column: 30, scope: !4897)
+!4925 = !DILocation(line: 8559, column: 13, scope: !4897)
+!4926 = !DILocation(line: 8560, column: 20, scope: !4897)
+!4927 = !DILocation(line: 8561, column: 16, scope: !4897)
+!4928 = !DILocation(line: 8563, column: 34, scope: !4897)
+!4929 = !DILocation(line: 8564, column: 22, scope: !4897)
+!4930 = !DILocation(line: 8565, column: 33, scope: !4897)
+!4931 = !DILocation(line: 8566, column: 27, scope: !4897)
+!4932 = !DILocation(line: 8567, column: 26, scope: !4897)
+!4933 = !DILocation(line: 8568, column: 9, scope: !4897)
+!4934 = !DILocation(line: 8568, column: 15, scope: !4897)
+!4935 = !DILocation(line: 8569, column: 33, scope: !4897)
+!4936 = !DILocation(line: 8570, column: 16, scope: !4897)
+!4937 = !DILocation(line: 8572, column: 26, scope: !4897)
+!4938 = !DILocation(line: 8574, column: 31, scope: !4897)
+!4939 = !DILocation(line: 8576, column: 16, scope: !4897)
+!4940 = !DILocation(line: 8577, column: 36, scope: !4897)
+!4941 = !DILocation(line: 8579, column: 9, scope: !4897)
+!4942 = distinct !DISubprogram(name: "kernel_214", scope: !8, file: !8, line: 8570, type: !11, scopeLine: 8570, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!4943 = !DILocation(line: 8571, column: 32, scope: !4942)
+!4944 = !DILocation(line: 8572, column: 29, scope: !4942)
+!4945 = !DILocation(line: 8573, column: 16, scope: !4942)
+!4946 = !DILocation(line: 8573, column: 5, scope: !4942)
+!4947 = !DILocation(line: 8573, column: 23, scope: !4942)
+!4948 = !DILocation(line: 8575, column: 35, scope: !4942)
+!4949 = !DILocation(line: 8575, column: 33, scope: !4942)
+!4950 = !DILocation(line: 8576, column: 29, scope: !4942)
+!4951 = !DILocation(line: 8577, column: 3, scope: !4942)
+!4952 = !DILocation(line: 8578, column: 31, scope: !4942)
+!4953 = !DILocation(line: 8579, column: 4, scope: !4942)
+!4954 = !DILocation(line: 8580, column: 20, scope: !4942)
+!4955 = !DILocation(line: 8581, column: 34, scope: !4942)
+!4956 = !DILocation(line: 8581, column: 3, scope: !4942)
+!4957 = !DILocation(line: 8582, column: 22, scope: !4942)
+!4958 = !DILocation(line: 8583, column: 5, scope: !4942)
+!4959 = !DILocation(line: 8584, column: 22, scope: !4942)
+!4960 = distinct !DISubprogram(name: "kernel_215", scope: !9, file: !9, line: 8610, type: !11, scopeLine: 8610, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!4961 = !DILocation(line: 8611, column: 15, scope: !4960)
+!4962 = !DILocation(line: 8613, column: 37, scope: !4960)
+!4963 = !DILocation(line: 8614, column: 35, scope: !4960)
+!4964 = !DILocation(line: 8614, column: 39, scope: !4960)
+!4965 = !DILocation(line: 8615, column: 18, scope: !4960)
+!4966 = !DILocation(line: 8616, column: 16, scope: !4960)
+!4967 = !DILocation(line: 8616, column: 30, scope: !4960)
+!4968 = !DILocation(line: 8618, column: 13, scope: !4960)
+!4969 = !DILocation(line: 8619, column: 13, scope: !4960)
+!4970 = !DILocation(line: 8621, column: 33, scope: !4960)
+!4971 = !DILocation(line: 8622, column: 30, scope: !4960)
+!4972 = !DILocation(line: 8624, column: 25, scope: !4960)
+!4973 = !DILocation(line: 8626, column: 22, scope: !4960)
+!4974 = !DILocation(line: 8628, column: 28, scope: !4960)
+!4975 = !DILocation(line: 8630, column: 11, scope: !4960)
+!4976 = !DILocation(line: 8632, column: 22, scope: !4960)
+!4977 = !DILocation(line: 8633, column: 3, scope: !4960)
+!4978 = !DILocation(line: 8633, column: 35, scope: !4960)
+!4979 = !DILocation(line: 8635, column: 26, scope: !4960)
+!4980 = distinct !{!4980, !26}
+!4981 = !DILocation(line: 8637, column: 25, scope: !4960)
+!4982 = distinct !DISubprogram(name: "kernel_216", scope: !2, file: !2, line: 8650, type: !11, scopeLine: 8650, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!4983 = !DILocation(line: 8652, column: 7, scope: !4982)
+!4984 = !DILocation(line: 8652, column: 14, scope: !4982)
+!4985 = !DILocation(line: 8653, column: 40, scope: !4982)
+!4986 = !DILocation(line: 8654, column: 16, scope: !4982)
+!4987 = !DILocation(line: 8655, column: 32, scope: !4982)
+!4988 = !DILocation(line: 8656, column: 32, scope: !4982)
+!4989 = !DILocation(line: 8656, column: 34, scope: !4982)
+!4990 = !DILocation(line: 8657, column: 12, scope: !4982)
+!4991 = !DILocation(line: 8658, column: 35, scope: !4982)
+!4992 = !DILocation(line: 8659, column: 12, scope: !4982)
+!4993 = !DILocation(line: 8660, column: 17, scope: !4982)
+!4994 = !DILocation(line: 8661, column: 37, scope: !4982)
+!4995 = !DILocation(line: 8662, column: 26, scope: !4982)
+!4996 = !DILocation(line: 8663, column: 3, scope: !4982)
+!4997 = !DILocation(line: 8665, column: 26, scope: !4982)
+!4998 = !DILocation(line: 8665, column: 17, scope: !4982)
+!4999 = !DILocation(line: 8666, column: 20, scope: !4982)
+!5000 = !DILocation(line: 8668, column: 5, scope: !4982)
+!5001 = !DILocation(line: 8668, column: 28, scope: !4982)
+!5002 = !DILocation(line: 8670, column: 11, scope: !4982)
+!5003 = distinct !DISubprogram(name: "kernel_217", scope: !3, file: !3, line: 8690, type: !11, scopeLine: 8690, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!5004 = !DILocation(line: 8691, column: 20, scope: !5003)
+!5005 = !DILocation(line: 8692, column: 21, scope: !5003)
+!5006 = !DILocation(line: 8692, column: 19, scope: !5003)
+!5007 = !DILocation(line: 8693, column: 34, scope: !5003)
+!5008 = !DILocation(line: 8694, column: 11, scope: !5003)
+!5009 = !DILocation(line: 8694, column: 5, scope: !5003)
+!5010 = !DILocation(line: 8695, column: 4, scope: !5003)
+!5011 = !DILocation(line: 8695, column: 9, scope: !5003)
+!5012 = !DILocation(line: 8697, column: 4, scope: !5003)
+!5013 = !DILocation(line: 8698, column: 26, scope: !5003)
+!5014 = !DILocation(line: 8698, column: 18, scope: !5003)
+!5015 = !DILocation(line: 8699, column: 6, scope: !5003)
+!5016 = !DILocation(line: 8700, column: 38, scope: !5003)
+!5017 = !DILocation(line: 8701, column: 18, scope: !5003)
+!5018 = distinct !DISubprogram(name: "kernel_218", scope: !4, file: !4, line: 8730, type: !11, scopeLine: 8730, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!5019 = !DILocation(line: 8730, column: 6, scope: !5018)
+!5020 = !DILocation(line: 8732, column: 9, scope: !5018)
+!5021 = !DILocation(line: 8733, column: 32, scope: !5018)
+!5022 = !DILocation(line: 8734, column: 36, scope: !5018)
+!5023 = !DILocation(line: 8734, column: 21, scope: !5018)
+!5024 = !DILocation(line: 8735, column: 21, scope: !5018)
+!5025 = !DILocation(line: 8736, column: 17, scope: !5018)
+!5026 = !DILocation(line: 8737, column: 17, scope: !5018)
+!5027 = !DILocation(line: 8738, column: 10, scope: !5018)
+!5028 = !DILocation(line: 8739, column: 17, scope: !5018)
+!5029 = !DILocation(line: 8741, column: 18, scope: !5018)
+!5030 = !DILocation(line: 8742, column: 20, scope: !5018)
+!5031 = !DILocation(line: 8743, column: 15, scope: !5018)
+!5032 = !DILocation(line: 8744, column: 20, scope: !5018)
+!5033 = !DILocation(line: 8745, column: 20, scope: !5018)
+!5034 = !DILocation(line: 8746, column: 7, scope: !5018)
+!5035 = !DILocation(line: 8747, column: 23, scope: !5018)
+!5036 = !DILocation(line: 8749, column: 27, scope: !5018)
+!5037 = !DILocation(line: 8749, column: 15, scope: !5018)
+!5038 = !DILocation(line: 8750, column: 22, scope: !5018)
+!5039 = !DILocation(line: 8750, column: 17, scope: !5018)
+!5040 = !DILocation(line: 8751, column: 32, scope: !5018)
+!5041 = !DILocation(line: 8753, column: 35, scope: !5018)
+!5042 = !DILocation(line: 8755, column: 12, scope: !5018)
+!5043 = !DILocation(line: 8756, column: 32, scope: !5018)
+!5044 = !DILocation(line: 8757, column: 25, scope: !5018)
+!5045 = !DILocation(line: 8758, column: 24, scope: !5018)
+!5046 = !DILocation(line: 8760, column: 25, scope: !5018)
+!5047 = !DILocation(line: 8761, column: 20, scope: !5018)
+!5048 = !DILocation(line: 8762, column: 25, scope: !5018)
+!5049 = !DILocation(line: 8762, column: 22, scope: !5018)
+!5050 = !DILocation(line: 8762, column: 10, scope: !5018)
+!5051 = !DILocation(line: 8762, column: 26, scope: !5018)
+!5052 = !DILocation(line: 8762, column: 26, scope: !5018)
+!5053 = !DILocation(line: 8762, column: 30, scope: !5018)
+!5054 = !DILocation(line: 8763, column: 24, scope: !5018)
+!5055 = !DILocation(line: 8764, column: 17, scope: !5018)
+!5056 = !DILocation(line: 8765, column: 34, scope: !5018)
+!5057 = !DILocation(line: 8767, column: 9, scope: !5018)
+!5058 = !DILocation(line: 8768, column: 13, scope: !5018)
+!5059 = !DILocation(line: 8770, column: 20, scope: !5018)
+!5060 = distinct !DISubprogram(name: "kernel_219", scope: !5, file: !5, line: 8770, type: !11, scopeLine: 8770, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!5061 = !DILocation(line: 8771, column: 31, scope: !5060)
+!5062 = !DILocation(line: 8772, column: 14, scope: !5060)
+!5063 = !DILocation(line: 8774, column: 38, scope: !5060)
+!5064 = !DILocation(line: 8776, column: 13, scope: !5060)
+!5065 = !DILocation(line: 8777, column: 4, scope: !5060)
+!5066 = !DILocation(line: 8777, column: 21, scope: !5060)
+!5067 = !DILocation(line: 8779, column: 36, scope: !5060)
+!5068 = !DILocation(line: 8781, column: 7, scope: !5060)
+!5069 = !DILocation(line: 8781, column: 29, scope: !5060)
+!5070 = !DILocation(line: 8781, column: 6, scope: !5060)
+!5071 = !DILocation(line: 8782, column: 29, scope: !5060)
+!5072 = !DILocation(line: 8782, column: 8, scope: !5060)
+!5073 = !DILocation(line: 8783, column: 26, scope: !5060)
+!5074 = !DILocation(line: 8785, column: 9, scope: !5060)
+!5075 = !DILocation(line: 8785, column: 35, scope: !5060)
+!5076 = !DILocation(line: 8785, column: 17, scope: !5060)
+!5077 = distinct !DISubprogram(name: "kernel_220", scope: !6, file: !6, line: 8810, type: !11, scopeLine: 8810, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!5078 = !DILocation(line: 8811, column: 7, scope: !5077)
+!5079 = !DILocation(line: 8812, column: 35, scope: !5077)
+!5080 = !DILocation(line: 8813, column: 9, scope: !5077)
+!5081 = !DILocation(line: 8814, column: 39, scope: !5077)
+!5082 = !DILocation(line: 8816, column: 5, scope: !5077)
+!5083 = !DILocation(line: 8818, column: 4, scope: !5077)
+!5084 = !DILocation(line: 8820, column: 12, scope: !5077)
+!5085 = !DILocation(line: 8820, column: 39, scope: !5077)
+!5086 = !DILocation(line: 8821, column: 8, scope: !5077)
+!5087 = !DILocation(line: 8822, column: 28, scope: !5077)
+!5088 = !DILocation(line: 8823, column: 40, scope: !5077)
+!5089 = !DILocation(line: 8823, column: 31, scope: !5077)
+!5090 = !DILocation(line: 8825, column: 3, scope: !5077)
+!5091 = !DILocation(line: 8825, column: 4, scope: !5077)
+!5092 = !DILocation(line: 8826, column: 26, scope: !5077)
+!5093 = !DILocation(line: 8826, column: 26, scope: !5077)
+!5094 = !DILocation(line: 8828, column: 11, scope: !5077)
+!5095 = !DILocation(line: 8830, column: 9, scope: !5077)
+!5096 = !DILocation(line: 8832, column: 25, scope: !5077)
+!5097 = distinct !{!5097, !26}
+!5098 = !DILocation(line: 8834, column: 36, scope: !5077)
+!5099 = distinct !DISubprogram(name: "kernel_221", scope: !7, file: !7, line: 8850, type: !11, scopeLine: 8850, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!5100 = !DILocation(line: 8850, column: 34, scope: !5099)
+!5101 = !DILocation(line: 8851, column: 31, scope: !5099)
+!5102 = !DILocation(line: 8853, column: 27, scope: !5099)
+!5103 = !DILocation(line: 8855, column: 11, scope: !5099)
+!5104 = !DILocation(line: 8855, column: 4, scope: !5099)
+!5105 = !DILocation(line: 8856, column: 29, scope: !5099)
+!5106 = !DILocation(line: 8857, column: 3, scope: !5099)
+!5107 = !DILocation(line: 8857, column: 34, scope: !5099)
+!5108 = !DILocation(line: 8858, column: 14, scope: !5099)
+!5109 = !DILocation(line: 8859, column: 10, scope: !5099)
+!5110 = !DILocation(line: 8861, column: 8, scope: !5099)
+!5111 = !DILocation(line: 8862, column: 26, scope: !5099)
+!5112 = !DILocation(line: 8863, column: 3, scope: !5099)
+!5113 = !DILocation(line: 8864, column: 19, scope: !5099)
+!5114 = !DILocation(line: 8865, column: 13, scope: !5099)
+!5115 = !DILocation(line: 8867, column: 17, scope: !5099)
+!5116 = !DILocation(line: 8869, column: 12, scope: !5099)
+!5117 = !DILocation(line: 8869, column: 21, scope: !5099)
+!5118 = !DILocation(line: 8870, column: 30, scope: !5099)
+!5119 = !DILocation(line: 8871, column: 6, scope: !5099)
+!5120 = distinct !DISubprogram(name: "kernel_222", scope: !8, file: !8, line: 8890, type: !11, scopeLine: 8890, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!5121 = !DILocation(line: 8892, column: 7, scope: !5120)
+!5122 = !DILocation(line: 8892, column: 4, scope: !5120)
+!5123 = !DILocation(line: 8893, column: 19, scope: !5120)
+!5124 = !DILocation(line: 8895, column: 17, scope: !5120)
+!5125 = !DILocation(line: 8896, column: 38, scope: !5120)
+!5126 = !DILocation(line: 8897, column: 37, scope: !5120)
+!5127 = !DILocation(line: 8898, column: 8, scope: !5120)
+!5128 = !DILocation(line: 8899, column: 6, scope: !5120)
+!5129 = !DILocation(line: 8901, column: 35, scope: !5120)
+!5130 = !DILocation(line: 8903, column: 11, scope: !5120)
+!5131 = !DILocation(line: 8904, column: 28, scope: !5120)
+!5132 = !DILocation(line: 8904, column: 30, scope: !5120)
+!5133 = !DILocation(line: 8906, column: 12, scope: !5120)
+!5134 = !DILocation(line: 8906, column: 7, scope: !5120)
+!5135 = distinct !DISubprogram(name: "kernel_223", scope: !9, file: !9, line: 8930, type: !11, scopeLine: 8930, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!5136 = !DILocation(line: 8931, column: 35, scope: !5135)
+!5137 = !DILocation(line: 8933, column: 22, scope: !5135)
+!5138 = !DILocation(line: 8934, column: 16, scope: !5135)
+!5139 = !DILocation(line: 8935, column: 17, scope: !5135)
+!5140 = !DILocation(line: 8935, column: 23, scope: !5135)
+!5141 = !DILocation(line: 8936, column: 39, scope: !5135)
+!5142 = !DILocation(line: 8937, column: 32, scope: !5135)
+!5143 = !DILocation(line: 8937, column: 24, scope: !5135)
+!5144 = !DILocation(line: 8937, column: 26, scope: !5135)
+!5145 = !DILocation(line: 8939, column: 16, scope: !5135)
+!5146 = !DILocation(line: 8940, column: 31, scope: !5135)
+!5147 = !DILocation(line: 8942, column: 32, scope: !5135)
+!5148 = !DILocation(line: 8942, column: 17, scope: !5135)
+!5149 = !DILocation(line: 8944, column: 7, scope: !5135)
+!5150 = !DILocation(line: 8946, column: 25, scope: !5135)
+!5151 = !DILocation(line: 8947, column: 32, scope: !5135)
+!5152 = !DILocation(line: 8948, column: 38, scope: !5135)
+!5153 = !DILocation(line: 8949, column: 39, scope: !5135)
+!5154 = !DILocation(line: 8951, column: 33, scope: !5135)
+!5155 = !DILocation(line: 8952, column: 19, scope: !5135)
+!5156 = !DILocation(line: 8954, column: 19, scope: !5135)
+!5157 = !DILocation(line: 8955, column: 9, scope: !5135)
+!5158 = !DILocation(line: 8955, column: 13, scope: !5135)
+!5159 = !DILocation(line: 8955, column: 35, scope: !5135)
+!5160 = !DILocation(line: 8955, column: 27, scope: !5135)
+!5161 = !DILocation(line: 8955, column: 27, scope: !5135)
+!5162 = !DILocation(line: 8956, column: 32, scope: !5135)
+!5163 = !DILocation(line: 8958, column: 16, scope: !5135)
+!5164 = !DILocation(line: 8959, column: 33, scope: !5135)
+!5165 = distinct !DISubprogram(name: "kernel_224", scope: !2, file: !2, line: 8970, type: !11, scopeLine: 8970, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!5166 = !DILocation(line: 8970, column: 10, scope: !5165)
+!5167 = !DILocation(line: 8972, column: 11, scope: !5165)
+!5168 = !DILocation(line: 8974, column: 27, scope: !5165)
+!5169 = !DILocation(line: 8975, column: 5, scope: !5165)
+!5170 = !DILocation(line: 8976, column: 14, scope: !5165)
+!5171 = !DILocation(line: 8976, column: 31, scope: !5165)
+!5172 = !DILocation(line: 8978, column: 5, scope: !5165)
+!5173 = !DILocation(line: 8979, column: 18, scope: !5165)
+!5174 = !DILocation(line: 8979, column: 35, scope: !5165)
+!5175 = !DILocation(line: 8981, column: 22, scope: !5165)
+!5176 = !DILocation(line: 8983, column: 9, scope: !5165)
+!5177 = !DILocation(line: 8985, column: 20, scope: !5165)
+!5178 = !DILocation(line: 8985, column: 14, scope: !5165)
+!5179 = !DILocation(line: 8986, column: 30, scope: !5165)
+!5180 = !DILocation(line: 8987, column: 39, scope: !5165)
+!5181 = !DILocation(line: 8988, column: 25, scope: !5165)
+!5182 = !DILocation(line: 8990, column: 35, scope: !5165)
+!5183 = distinct !DISubprogram(name: "kernel_225", scope: !3, file: !3, line: 9010, type: !11, scopeLine: 9010, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!5184 = !DILocation(line: 9012, column: 17, scope: !5183)
+!5185 = !DILocation(line: 9014, column: 23, scope: !5183)
+!5186 = !DILocation(line: 9014, column: 30, scope: !5183)
+!5187 = !DILocation(line: 9014, column: 16, scope: !5183)
+!5188 = !DILocation(line: 9015, column: 25, scope: !5183)
+!5189 = !DILocation(line: 9016, column: 32, scope: !5183)
+!5190 = !DILocation(line: 9016, column: 7, scope: !5183)
+!5191 = !DILocation(line: 9016, column: 23, scope: !5183)
+!5192 = !DILocation(line: 9018, column: 31, scope: !5183)
+!5193 = !DILocation(line: 9018, column: 37, scope: !5183)
+!5194 = !DILocation(line: 9019, column: 5, scope: !5183)
+!5195 = !DILocation(line: 9019, column: 19, scope: !5183)
+!5196 = !DILocation(line: 9020, column: 8, scope: !5183)
+!5197 = !DILocation(line: 9021, column: 40, scope: !5183)
+!5198 = !DILocation(line: 9022, column: 28, scope: !5183)
+!5199 = !DILocation(line: 9024, column: 39, scope: !5183)
+!5200 = !DILocation(line: 9024, column: 28, scope: !5183)
+!5201 = !DILocation(line: 9025, column: 40, scope: !5183)
+!5202 = !DILocation(line: 9025, column: 7, scope: !5183)
+!5203 = distinct !{!5203, !26}
+!5204 = !DILocation(line: 9026, column: 28, scope: !5183)
+!5205 = distinct !DISubprogram(name: "kernel_226", scope: !4, file: !4, line: 9050, type: !11, scopeLine: 9050, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!5206 = !DILocation(line: 9050, column: 22, scope: !5205)
+!5207 = !DILocation(line: 9051, column: 9, scope: !5205)
+!5208 = !DILocation(line: 9052, column: 11, scope: !5205)
+!5209 = !DILocation(line: 9052, column: 16, scope: !5205)
+!5210 = !DILocation(line: 9053, column: 39, scope: !5205)
+!5211 = !DILocation(line: 9054, column: 12, scope: !5205)
+!5212 = !DILocation(line: 9054, column: 26, scope: !5205)
+!5213 = !DILocation(line: 9055, column: 35, scope: !5205)
+!5214 = !DILocation(line: 9056, column: 3, scope: !5205)
+!5215 = !DILocation(line: 9057, column: 37, scope: !5205)
+!5216 = !DILocation(line: 9059, column: 14, scope: !5205)
+!5217 = !DILocation(line: 9060, column: 27, scope: !5205)
+!5218 = !DILocation(line: 9061, column: 28, scope: !5205)
+!5219 = !DILocation(line: 9061, column: 17, scope: !5205)
+!5220 = !DILocation(line: 9061, column: 4, scope: !5205)
+!5221 = !DILocation(line: 9061, column: 32, scope: !5205)
+!5222 = !DILocation(line: 9062, column: 4, scope: !5205)
+!5223 = !DILocation(line: 9062, column: 9, scope: !5205)
+!5224 = !DILocation(line: 9062, column: 39, scope: !5205)
+!5225 = !DILocation(line: 9064, column: 12, scope: !5205)
+!5226 = distinct !DISubprogram(name: "kernel_227", scope: !5, file: !5, line: 9090, type: !11, scopeLine: 9090, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!5227 = !DILocation(line: 9091, column: 21, scope: !5226)
+!5228 = !DILocation(line: 9093, column: 10, scope: !5226)
+!5229 = !DILocation(line: 9093, column: 22, scope: !5226)
+!5230 = !DILocation(line: 9094, column: 22, scope: !5226)
+!5231 = !DILocation(line: 9096, column: 20, scope: !5226)
+!5232 = !DILocation(line: 9097, column: 35, scope: !5226)
+!5233 = !DILocation(line: 9098, column: 4, scope: !5226)
+!5234 = !DILocation(line: 9099, column: 15, scope: !5226)
+!5235 = !DILocation(line: 9099, column: 18, scope: !5226)
+!5236 = !DILocation(line: 9100, column: 35, scope: !5226)
+!5237 = !DILocation(line: 9102, column: 21, scope: !5226)
+!5238 = !DILocation(line: 9103, column: 34, scope: !5226)
+!5239 = !DILocation(line: 9104, column: 13, scope: !5226)
+!5240 = !DILocation(line: 9105, column: 16, scope: !5226)
+!5241 = !DILocation(line: 9105, column: 32, scope: !5226)
+!5242 = !DILocation(line: 9107, column: 26, scope: !5226)
+!5243 = !DILocation(line: 9109, column: 22, scope: !5226)
+!5244 = !DILocation(line: 9110, column: 4, scope: !5226)
+!5245 = distinct !DISubprogram(name: "kernel_228", scope: !6, file: !6, line: 9130, type: !11, scopeLine: 9130, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!5246 = !DILocation(line: 9130, column: 10, scope: !5245)
+!5247 = !DILocation(line: 9131, column: 40, scope: !5245)
+!5248 = !DILocation(line: 9132, column: 18, scope: !5245)
+!5249 = !DILocation(line: 9132, column: 38, scope: !5245)
+!5250 = !DILocation(line: 9133, column: 17, scope: !5245)
+!5251 = !DILocation(line: 9135, column: 20, scope: !5245)
+!5252 = !DILocation(line: 9136, column: 38, scope: !5245)
+!5253 = !DILocation(line: 9137, column: 27, scope: !5245)
+!5254 = !DILocation(line: 9137, column: 9, scope: !5245)
+!5255 = !DILocation(line: 9138, column: 23, scope: !5245)
+!5256 = !DILocation(line: 9138, column: 33, scope: !5245)
+!5257 = !DILocation(line: 9140, column: 37, scope: !5245)
+!5258 = !DILocation(line: 9140, column: 37, scope: !5245)
+!5259 = !DILocation(line: 9141, column: 26, scope: !5245)
+!5260 = !DILocation(line: 9142, column: 15, scope: !5245)
+!5261 = !DILocation(line: 9143, column: 26, scope: !5245)
+!5262 = !DILocation(line: 9144, column: 26, scope: !5245)
+!5263 = !DILocation(line: 9146, column: 37, scope: !5245)
+!5264 = !DILocation(line: 9147, column: 9, scope: !5245)
+!5265 = !DILocation(line: 9149, column: 30, scope: !5245)
+!5266 = !DILocation(line: 9149, column: 5, scope: !5245)
+!5267 = !DILocation(line: 9150, column: 34, scope: !5245)
+!5268 = !DILocation(line: 9150, column: 22, scope: !5245)
+!5269 = !DILocation(line: 9151, column: 13, scope: !5245)
+!5270 = !DILocation(line: 9152, column: 25, scope: !5245)
+!5271 = !DILocation(line: 9154, column: 30, scope: !5245)
+!5272 = !DILocation(line: 9156, column: 24, scope: !5245)
+!5273 = !DILocation(line: 9157, column: 16, scope: !5245)
+!5274 = !DILocation(line: 9158, column: 32, scope: !5245)
+!5275 = !DILocation(line: 9159, column: 13, scope: !5245)
+!5276 = !DILocation(line: 9160, column: 5, scope: !5245)
+!5277 = !DILocation(line: 9161, column: 33, scope: !5245)
+!5278 = !DILocation(line: 9161, column: 3, scope: !5245)
+!5279 = !DILocation(line: 9162, column: 20, scope: !5245)
+!5280 = !DILocation(line: 9162, column: 38, scope: !5245)
+!5281 = !DILocation(line: 9163, column: 11, scope: !5245)
+!5282 = !DILocation(line: 9164, column: 14, scope: !5245)
+!5283 = !DILocation(line: 9165, column: 16, scope: !5245)
+!5284 = distinct !DISubprogram(name: "kernel_229", scope: !7, file: !7, line: 9170, type: !11, scopeLine: 9170, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!5285 = !DILocation(line: 9170, column: 12, scope: !5284)
+!5286 = !DILocation(line: 9171, column: 39, scope: !5284)
+!5287 = !DILocation(line: 9173, column: 17, scope: !5284)
+!5288 = !DILocation(line: 9174, column: 29, scope: !5284)
+!5289 = !DILocation(line: 9174, column: 6, scope: !5284)
+!5290 = !DILocation(line: 9174, column: 20, scope: !5284)
+!5291 = !DILocation(line: 9174, column: 33, scope: !5284)
+!5292 = !DILocation(line: 9175, column: 13, scope: !5284)
+!5293 = !DILocation(line: 9175, column: 19, scope: !5284)
+!5294 = !DILocation(line: 9176, column: 20, scope: !5284)
+!5295 = !DILocation(line: 9177, column: 19, scope: !5284)
+!5296 = !DILocation(line: 9178, column: 25, scope: !5284)
+!5297 = !DILocation(line: 9179, column: 3, scope: !5284)
+!5298 = !DILocation(line: 9180, column: 23, scope: !5284)
+!5299 = !DILocation(line: 9181, column: 14, scope: !5284)
+!5300 = !DILocation(line: 9182, column: 21, scope: !5284)
+!5301 = distinct !DISubprogram(name: "kernel_230", scope: !8, file: !8, line: 9210, type: !11, scopeLine: 9210, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!5302 = !DILocation(line: 9211, column: 22, scope: !5301)
+!5303 = !DILocation(line: 9212, column: 36, scope: !5301)
+!5304 = !DILocation(line: 9213, column: 37, scope: !5301)
+!5305 = !DILocation(line: 9213, column: 4, scope: !5301)
+!5306 = !DILocation(line: 9214, column: 15, scope: !5301)
+!5307 = !DILocation(line: 9215, column: 16, scope: !5301)
+!5308 = !DILocation(line: 9216, column: 29, scope: !5301)
+!5309 = !DILocation(line: 9218, column: 24, scope: !5301)
+!5310 = !DILocation(line: 9219, column: 7, scope: !5301)
+!5311 = !DILocation(line: 9221, column: 19, scope: !5301)
+!5312 = !DILocation(line: 9222, column: 24, scope: !5301)
+!5313 = !DILocation(line: 9222, column: 36, scope: !5301)
+!5314 = !DILocation(line: 9223, column: 39, scope: !5301)
+!5315 = !DILocation(line: 9224, column: 3, scope: !5301)
+!5316 = !DILocation(line: 9225, column: 27, scope: !5301)
+!5317 = !DILocation(line: 9225, column: 17, scope: !5301)
+!5318 = !DILocation(line: 9225, column: 37, scope: !5301)
+!5319 = !DILocation(line: 9225, column: 9, scope: !5301)
+!5320 = !DILocation(line: 9226, column: 10, scope: !5301)
+!5321 = distinct !{!5321, !26}
+!5322 = !DILocation(line: 9227, column: 21, scope: !5301)
+!5323 = distinct !DISubprogram(name: "kernel_231", scope: !9, file: !9, line: 9250, type: !11, scopeLine: 9250, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!5324 = !DILocation(line: 9252, column: 16, scope: !5323)
+!5325 = !DILocation(line: 9254, column: 35, scope: !5323)
+!5326 = !DILocation(line: 9255, column: 30, scope: !5323)
+!5327 = !DILocation(line: 9256, column: 37, scope: !5323)
+!5328 = !DILocation(line: 9257, column: 14, scope: !5323)
+!5329 = !DILocation(line: 9257, column: 14, scope: !5323)
+!5330 = !DILocation(line: 9258, column: 11, scope: !5323)
+!5331 = !DILocation(line: 9259, column: 36, scope: !5323)
+!5332 = !DILocation(line: 9259, column: 9, scope: !5323)
+!5333 = !DILocation(line: 9261, column: 17, scope: !5323)
+!5334 = !DILocation(line: 9261, column: 5, scope: !5323)
+!5335 = !DILocation(line: 9261, column: 35, scope: !5323)
+!5336 = !DILocation(line: 9261, column: 28, scope: !5323)
+!5337 = !DILocation(line: 9263, column: 36, scope: !5323)
+!5338 = !DILocation(line: 9264, column: 28, scope: !5323)
+!5339 = !DILocation(line: 9265, column: 9, scope: !5323)
+!5340 = !DILocation(line: 9266, column: 22, scope: !5323)
+!5341 = !DILocation(line: 9267, column: 29, scope: !5323)
+!5342 = !DILocation(line: 9267, column: 7, scope: !5323)
+!5343 = !DILocation(line: 9269, column: 15, scope: !5323)
+!5344 = distinct !DISubprogram(name: "kernel_232", scope: !2, file: !2, line: 9290, type: !11, scopeLine: 9290, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!5345 = !DILocation(line: 9290, column: 35, scope: !5344)
+!5346 = !DILocation(line: 9292, column: 17, scope: !5344)
+!5347 = !DILocation(line: 9293, column: 3, scope: !5344)
+!5348 = !DILocation(line: 9294, column: 23, scope: !5344)
+!5349 = !DILocation(line: 9294, column: 13, scope: !5344)
+!5350 = !DILocation(line: 9295, column: 24, scope: !5344)
+!5351 = !DILocation(line: 9295, column: 18, scope: !5344)
+!5352 = !DILocation(line: 9296, column: 29, scope: !5344)
+!5353 = !DILocation(line: 9296, column: 36, scope: !5344)
+!5354 = !DILocation(line: 9297, column: 18, scope: !5344)
+!5355 = !DILocation(line: 9298, column: 11, scope: !5344)
+!5356 = !DILocation(line: 9299, column: 4, scope: !5344)
+!5357 = !DILocation(line: 9301, column: 9, scope: !5344)
+!5358 = !DILocation(line: 9303, column: 15, scope: !5344)
+!5359 = !DILocation(line: 9304, column: 31, scope: !5344)
+!5360 = !DILocation(line: 9305, column: 21, scope: !5344)
+!5361 = !DILocation(line: 9306, column: 30, scope: !5344)
+!5362 = !DILocation(line: 9307, column: 23, scope: !5344)
+!5363 = distinct !DISubprogram(name: "kernel_233", scope: !3, file: !3, line: 9330, type: !11, scopeLine: 9330, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!5364 = !DILocation(line: 9331, column: 37, scope: !5363)
+!5365 = !DILocation(line: 9331, column: 5, scope: !5363)
+!5366 = !DILocation(line: 9332, column: 7, scope: !5363)
+!5367 = !DILocation(line: 9332, column: 6, scope: !5363)
+!5368 = !DILocation(line: 9333, column: 16, scope: !5363)
+!5369 = !DILocation(line: 9333, column: 6, scope: !5363)
+!5370 = !DILocation(line: 9334, column: 40, scope: !5363)
+!5371 = !DILocation(line: 9336, column: 7, scope: !5363)
+!5372 = !DILocation(line: 9337, column: 35, scope: !5363)
+!5373 = !DILocation(line: 9338, column: 28, scope: !5363)
+!5374 = !DILocation(line: 9338, column: 28, scope: !5363)
+!5375 = !DILocation(line: 9339, column: 22, scope: !5363)
+!5376 = !DILocation(line: 9339, column: 20, scope: !5363)
+!5377 = !DILocation(line: 9339, column: 39, scope: !5363)
+!5378 = !DILocation(line: 9340, column: 16, scope: !5363)
+!5379 = !DILocation(line: 9341, column: 4, scope: !5363)
+!5380 = !DILocation(line: 9343, column: 4, scope: !5363)
+!5381 = !DILocation(line: 9344, column: 10, scope: !5363)
+!5382 = !DILocation(line: 9345, column: 35, scope: !5363)
+!5383 = !DILocation(line: 9346, column: 21, scope: !5363)
+!5384 = !DILocation(line: 9348, column: 35, scope: !5363)
+!5385 = !DILocation(line: 9349, column: 17, scope: !5363)
+!5386 = !DILocation(line: 9351, column: 31, scope: !5363)
+!5387 = !DILocation(line: 9352, column: 33, scope: !5363)
+!5388 = !DILocation(line: 9352, column: 38, scope: !5363)
+!5389 = !DILocation(line: 9353, column: 25, scope: !5363)
+!5390 = !DILocation(line: 9353, column: 15, scope: !5363)
+!5391 = !DILocation(line: 9355, column: 14, scope: !5363)
+!5392 = !DILocation(line: 9357, column: 32, scope: !5363)
+!5393 = !DILocation(line: 9358, column: 26, scope: !5363)
+!5394 = !DILocation(line: 9359, column: 22, scope: !5363)
+!5395 = !DILocation(line: 9359, column: 31, scope: !5363)
+!5396 = !DILocation(line: 9361, column: 25, scope: !5363)
+!5397 = !DILocation(line: 9362, column: 6, scope: !5363)
+!5398 = !DILocation(line: 9363, column: 39, scope: !5363)
+!5399 = !DILocation(line: 9364, column: 6, scope: !5363)
+!5400 = !DILocation(line: 9365, column: 30, scope: !5363)
+!5401 = !DILocation(line: 9367, column: 27, scope: !5363)
+!5402 = !DILocation(line: 9367, column: 13, scope: !5363)
+!5403 = !DILocation(line: 9367, column: 11, scope: !5363)
+!5404 = !DILocation(line: 9367, column: 30, scope: !5363)
+!5405 = !DILocation(line: 9368, column: 31, scope: !5363)
+!5406 = !DILocation(line: 9369, column: 29, scope: !5363)
+!5407 = !DILocation(line: 9370, column: 20, scope: !5363)
+!5408 = distinct !DISubprogram(name: "kernel_234", scope: !4, file: !4, line: 9370, type: !11, scopeLine: 9370, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!5409 = !DILocation(line: 9371, column: 38, scope: !5408)
+!5410 = !DILocation(line: 9372, column: 9, scope: !5408)
+!5411 = !DILocation(line: 9374, column: 23, scope: !5408)
+!5412 = !DILocation(line: 9376, column: 21, scope: !5408)
+!5413 = !DILocation(line: 9377, column: 29, scope: !5408)
+!5414 = !DILocation(line: 9377, column: 24, scope: !5408)
+!5415 = !DILocation(line: 9379, column: 34, scope: !5408)
+!5416 = !DILocation(line: 9379, column: 8, scope: !5408)
+!5417 = !DILocation(line: 9380, column: 26, scope: !5408)
+!5418 = !DILocation(line: 9380, column: 39, scope: !5408)
+!5419 = !DILocation(line: 9380, column: 14, scope: !5408)
+!5420 = !DILocation(line: 9380, column: 3, scope: !5408)
+!5421 = !DILocation(line: 9381, column: 24, scope: !5408)
+!5422 = !DILocation(line: 9382, column: 37, scope: !5408)
+!5423 = !DILocation(line: 9384, column: 35, scope: !5408)
+!5424 = !DILocation(line: 9385, column: 36, scope: !5408)
+!5425 = !DILocation(line: 9385, column: 29, scope: !5408)
+!5426 = distinct !DISubprogram(name: "kernel_235", scope: !5, file: !5, line: 9410, type: !11, scopeLine: 9410, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!5427 = !DILocation(line: 9412, column: 13, scope: !5426)
+!5428 = !DILocation(line: 9414, column: 37, scope: !5426)
+!5429 = !DILocation(line: 9415, column: 11, scope: !5426)
+!5430 = !DILocation(line: 9417, column: 27, scope: !5426)
+!5431 = !DILocation(line: 9418, column: 31, scope: !5426)
+!5432 = !DILocation(line: 9418, column: 29, scope: !5426)
+!5433 = !DILocation(line: 9420, column: 37, scope: !5426)
+!5434 = !DILocation(line: 9421, column: 11, scope: !5426)
+!5435 = !DILocation(line: 9422, column: 3, scope: !5426)
+!5436 = !DILocation(line: 9423, column: 14, scope: !5426)
+!5437 = !DILocation(line: 9423, column: 21, scope: !5426)
+!5438 = !DILocation(line: 9423, column: 17, scope: !5426)
+!5439 = !DILocation(line: 9424, column: 29, scope: !5426)
+!5440 = !DILocation(line: 9426, column: 26, scope: !5426)
+!5441 = !DILocation(line: 9427, column: 40, scope: !5426)
+!5442 = !DILocation(line: 9429, column: 9, scope: !5426)
+!5443 = !DILocation(line: 9431, column: 40, scope: !5426)
+!5444 = !DILocation(line: 9432, column: 16, scope: !5426)
+!5445 = !DILocation(line: 9433, column: 18, scope: !5426)
+!5446 = distinct !{!5446, !26}
+!5447 = !DILocation(line: 9434, column: 23, scope: !5426)
+!5448 = distinct !DISubprogram(name: "kernel_236", scope: !6, file: !6, line: 9450, type: !11, scopeLine: 9450, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!5449 = !DILocation(line: 9450, column: 22, scope: !5448)
+!5450 = !DILocation(line: 9451, column: 23, scope: !5448)
+!5451 = !DILocation(line: 9452, column: 27, scope: !5448)
+!5452 = !DILocation(line: 9453, column: 8, scope: !5448)
+!5453 = !DILocation(line: 9454, column: 7, scope: !5448)
+!5454 = !DILocation(line: 9455, column: 27, scope: !5448)
+!5455 = !DILocation(line: 9456, column: 31, scope: !5448)
+!5456 = !DILocation(line: 9456, column: 15, scope: !5448)
+!5457 = !DILocation(line: 9457, column: 11, scope: !5448)
+!5458 = !DILocation(line: 9457, column: 34, scope: !5448)
+!5459 = !DILocation(line: 9457, column: 27, scope: !5448)
+!5460 = !DILocation(line: 9458, column: 30, scope: !5448)
+!5461 = !DILocation(line: 9460, column: 31, scope: !5448)
+!5462 = !DILocation(line: 9461, column: 17, scope: !5448)
+!5463 = !DILocation(line: 9461, column: 32, scope: !5448)
+!5464 = !DILocation(line: 9462, column: 7, scope: !5448)
+!5465 = !DILocation(line: 9463, column: 18, scope: !5448)
+!5466 = !DILocation(line: 9463, column: 31, scope: !5448)
+!5467 = !DILocation(line: 9465, column: 37, scope: !5448)
+!5468 = !DILocation(line: 9467, column: 11, scope: !5448)
+!5469 = distinct !DISubprogram(name: "kernel_237", scope: !7, file: !7, line: 9490, type: !11, scopeLine: 9490, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!5470 = !DILocation(line: 9491, column: 13, scope: !5469)
+!5471 = !DILocation(line: 9492, column: 34, scope: !5469)
+!5472 = !DILocation(line: 9493, column: 14, scope: !5469)
+!5473 = !DILocation(line: 9495, column: 14, scope: !5469)
+!5474 = !DILocation(line: 9495, column: 5, scope: !5469)
+!5475 = !DILocation(line: 9496, column: 33, scope: !5469)
+!5476 = !DILocation(line: 9497, column: 28, scope: !5469)
+!5477 = !DILocation(line: 9498, column: 19, scope: !5469)
+!5478 = !DILocation(line: 9499, column: 15, scope: !5469)
+!5479 = !DILocation(line: 9500, column: 35, scope: !5469)
+!5480 = !DILocation(line: 9501, column: 23, scope: !5469)
+!5481 = !DILocation(line: 9501, column: 14, scope: !5469)
+!5482 = distinct !DISubprogram(name: "kernel_238", scope: !8, file: !8, line: 9530, type: !11, scopeLine: 9530, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!5483 = !DILocation(line: 9532, column: 16, scope: !5482)
+!5484 = !DILocation(line: 9532, column: 25, scope: !5482)
+!5485 = !DILocation(line: 9533, column: 24, scope: !5482)
+!5486 = !DILocation(line: 9535, column: 18, scope: !5482)
+!5487 = !DILocation(line: 9537, column: 27, scope: !5482)
+!5488 = !DILocation(line: 9538, column: 18, scope: !5482)
+!5489 = !DILocation(line: 9538, column: 29, scope: !5482)
+!5490 = !DILocation(line: 9539, column: 13, scope: !5482)
+!5491 = !DILocation(line: 9540, column: 12, scope: !5482)
+!5492 = !DILocation(line: 9542, column: 38, scope: !5482)
+!5493 = !DILocation(line: 9544, column: 6, scope: !5482)
+!5494 = !DILocation(line: 9545, column: 32, scope: !5482)
+!5495 = !DILocation(line: 9546, column: 32, scope: !5482)
+!5496 = !DILocation(line: 9548, column: 33, scope: !5482)
+!5497 = !DILocation(line: 9549, column: 26, scope: !5482)
+!5498 = !DILocation(line: 9551, column: 22, scope: !5482)
+!5499 = !DILocation(line: 9551, column: 34, scope: !5482)
+!5500 = !DILocation(line: 9553, column: 31, scope: !5482)
+!5501 = !DILocation(line: 9555, column: 13, scope: !5482)
+!5502 = !DILocation(line: 9556, column: 17, scope: !5482)
+!5503 = !DILocation(line: 9557, column: 18, scope: !5482)
+!5504 = !DILocation(line: 9558, column: 29, scope: !5482)
+!5505 = !DILocation(line: 9560, column: 27, scope: !5482)
+!5506 = !DILocation(line: 9561, column: 38, scope: !5482)
+!5507 = !DILocation(line: 9562, column: 18, scope: !5482)
+!5508 = !DILocation(line: 9563, column: 24, scope: !5482)
+!5509 = !DILocation(line: 9564, column: 21, scope: !5482)
+!5510 = !DILocation(line: 9564, column: 20, scope: !5482)
+!5511 = !DILocation(line: 9565, column: 31, scope: !5482)
+!5512 = !DILocation(line: 9565, column: 22, scope: !5482)
+!5513 = !DILocation(line: 9566, column: 36, scope: !5482)
+!5514 = !DILocation(line: 9567, column: 25, scope: !5482)
+!5515 = !DILocation(line: 9568, column: 36, scope: !5482)
+!5516 = !DILocation(line: 9568, column: 18, scope: !5482)
+!5517 = !DILocation(line: 9570, column: 39, scope: !5482)
+!5518 = !DILocation(line: 9571, column: 31, scope: !5482)
+!5519 = !DILocation(line: 9573, column: 8, scope: !5482)
+!5520 = !DILocation(line: 9575, column: 25, scope: !5482)
+!5521 = distinct !DISubprogram(name: "kernel_239", scope: !9, file: !9, line: 9570, type: !11, scopeLine: 9570, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!5522 = !DILocation(line: 9572, column: 17, scope: !5521)
+!5523 = !DILocation(line: 9573, column: 26, scope: !5521)
+!5524 = !DILocation(line: 9574, column: 36, scope: !5521)
+!5525 = !DILocation(line: 9575, column: 12, scope: !5521)
+!5526 = !DILocation(line: 9575, column: 22, scope: !5521)
+!5527 = !DILocation(line: 9577, column: 21, scope: !5521)
+!5528 = !DILocation(line: 9578, column: 11, scope: !5521)
+!5529 = !DILocation(line: 9580, column: 8, scope: !5521)
+!5530 = !DILocation(line: 9581, column: 7, scope: !5521)
+!5531 = !DILocation(line: 9582, column: 15, scope: !5521)
+!5532 = !DILocation(line: 9582, column: 5, scope: !5521)
+!5533 = !DILocation(line: 9583, column: 32, scope: !5521)
+!5534 = !DILocation(line: 9584, column: 24, scope: !5521)
+!5535 = !DILocation(line: 9586, column: 26, scope: !5521)
+!5536 = !DILocation(line: 9586, column: 4, scope: !5521)
+!5537 = !DILocation(line: 9588, column: 10, scope: !5521)
+!5538 = distinct !DISubprogram(name: "kernel_240", scope: !2, file: !2, line: 9610, type: !11, scopeLine: 9610, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!5539 = !DILocation(line: 9612, column: 10, scope: !5538)
+!5540 = !DILocation(line: 9612, column: 29, scope: !5538)
+!5541 = !DILocation(line: 9613, column: 36, scope: !5538)
+!5542 = !DILocation(line: 9615, column: 37, scope: !5538)
+!5543 = !DILocation(line: 9617, column: 17, scope: !5538)
+!5544 = !DILocation(line: 9617, column: 29, scope: !5538)
+!5545 = !DILocation(line: 9618, column: 15, scope: !5538)
+!5546 = !DILocation(line: 9619, column: 19, scope: !5538)
+!5547 = !DILocation(line: 9621, column: 7, scope: !5538)
+!5548 = !DILocation(line: 9623, column: 18, scope: !5538)
+!5549 = !DILocation(line: 9624, column: 23, scope: !5538)
+!5550 = !DILocation(line: 9626, column: 33, scope: !5538)
+!5551 = !DILocation(line: 9627, column: 38, scope: !5538)
+!5552 = !DILocation(line: 9627, column: 10, scope: !5538)
+!5553 = !DILocation(line: 9628, column: 22, scope: !5538)
+!5554 = !DILocation(line: 9628, column: 11, scope: !5538)
+!5555 = !DILocation(line: 9628, column: 27, scope: !5538)
+!5556 = !DILocation(line: 9629, column: 11, scope: !5538)
+!5557 = !DILocation(line: 9629, column: 17, scope: !5538)
+!5558 = distinct !{!5558, !26}
+!5559 = !DILocation(line: 9629, column: 3, scope: !5538)
+!5560 = distinct !DISubprogram(name: "kernel_241", scope: !3, file: !3, line: 9650, type: !11, scopeLine: 9650, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!5561 = !DILocation(line: 9651, column: 8, scope: !5560)
+!5562 = !DILocation(line: 9652, column: 20, scope: !5560)
+!5563 = !DILocation(line: 9653, column: 31, scope: !5560)
+!5564 = !DILocation(line: 9655, column: 21, scope: !5560)
+!5565 = !DILocation(line: 9656, column: 22, scope: !5560)
+!5566 = !DILocation(line: 9657, column: 3, scope: !5560)
+!5567 = !DILocation(line: 9659, column: 23, scope: !5560)
+!5568 = !DILocation(line: 9661, column: 29, scope: !5560)
+!5569 = !DILocation(line: 9663, column: 30, scope: !5560)
+!5570 = !DILocation(line: 9665, column: 4, scope: !5560)
+!5571 = !DILocation(line: 9666, column: 23, scope: !5560)
+!5572 = !DILocation(line: 9668, column: 24, scope: !5560)
+!5573 = !DILocation(line: 9669, column: 29, scope: !5560)
+!5574 = !DILocation(line: 9669, column: 38, scope: !5560)
+!5575 = !DILocation(line: 9671, column: 19, scope: !5560)
+!5576 = !DILocation(line: 9673, column: 35, scope: !5560)
+!5577 = !DILocation(line: 9674, column: 21, scope: !5560)
+!5578 = !DILocation(line: 9674, column: 36, scope: !5560)
+!5579 = !DILocation(line: 9675, column: 7, scope: !5560)
+!5580 = !DILocation(line: 9676, column: 21, scope: !5560)
+!5581 = distinct !DISubprogram(name: "kernel_242", scope: !4, file: !4, line: 9690, type: !11, scopeLine: 9690, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!5582 = !DILocation(line: 9691, column: 26, scope: !5581)
+!5583 = !DILocation(line: 9691, column: 11, scope: !5581)
+!5584 = !DILocation(line: 9692, column: 25, scope: !5581)
+!5585 = !DILocation(line: 9693, column: 12, scope: !5581)
+!5586 = !DILocation(line: 9694, column: 16, scope: !5581)
+!5587 = !DILocation(line: 9694, column: 5, scope: !5581)
+!5588 = !DILocation(line: 9694, column: 15, scope: !5581)
+!5589 = !DILocation(line: 9696, column: 30, scope: !5581)
+!5590 = !DILocation(line: 9697, column: 20, scope: !5581)
+!5591 = !DILocation(line: 9698, column: 5, scope: !5581)
+!5592 = !DILocation(line: 9700, column: 18, scope: !5581)
+!5593 = !DILocation(line: 9700, column: 18, scope: !5581)
+!5594 = !DILocation(line: 9701, column: 5, scope: !5581)
+!5595 = !DILocation(line: 9701, column: 4, scope: !5581)
+!5596 = !DILocation(line: 9702, column: 17, scope: !5581)
+!5597 = !DILocation(line: 9703, column: 14, scope: !5581)
+!5598 = !DILocation(line: 9704, column: 12, scope: !5581)
+!5599 = !DILocation(line: 9706, column: 12, scope: !5581)
+!5600 = distinct !DISubprogram(name: "kernel_243", scope: !5, file: !5, line: 9730, type: !11, scopeLine: 9730, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!5601 = !DILocation(line: 9731, column: 9, scope: !5600)
+!5602 = !DILocation(line: 9732, column: 33, scope: !5600)
+!5603 = !DILocation(line: 9732, column: 27, scope: !5600)
+!5604 = !DILocation(line: 9733, column: 37, scope: !5600)
+!5605 = !DILocation(line: 9734, column: 29, scope: !5600)
+!5606 = !DILocation(line: 9734, column: 37, scope: !5600)
+!5607 = !DILocation(line: 9734, column: 13, scope: !5600)
+!5608 = !DILocation(line: 9736, column: 14, scope: !5600)
+!5609 = !DILocation(line: 9737, column: 31, scope: !5600)
+!5610 = !DILocation(line: 9737, column: 10, scope: !5600)
+!5611 = !DILocation(line: 9739, column: 26, scope: !5600)
+!5612 = !DILocation(line: 9740, column: 19, scope: !5600)
+!5613 = !DILocation(line: 9741, column: 30, scope: !5600)
+!5614 = !DILocation(line: 9742, column: 4, scope: !5600)
+!5615 = !DILocation(line: 9742, column: 38, scope: !5600)
+!5616 = !DILocation(line: 9744, column: 28, scope: !5600)
+!5617 = !DILocation(line: 9744, column: 31, scope: !5600)
+!5618 = !DILocation(line: 9745, column: 13, scope: !5600)
+!5619 = !DILocation(line: 9746, column: 23, scope: !5600)
+!5620 = !DILocation(line: 9748, column: 31, scope: !5600)
+!5621 = !DILocation(line: 9748, column: 27, scope: !5600)
+!5622 = !DILocation(line: 9750, column: 17, scope: !5600)
+!5623 = !DILocation(line: 9752, column: 13, scope: !5600)
+!5624 = !DILocation(line: 9753, column: 4, scope: !5600)
+!5625 = !DILocation(line: 9753, column: 32, scope: !5600)
+!5626 = !DILocation(line: 9755, column: 9, scope: !5600)
+!5627 = !DILocation(line: 9757, column: 21, scope: !5600)
+!5628 = !DILocation(line: 9758, column: 15, scope: !5600)
+!5629 = !DILocation(line: 9760, column: 22, scope: !5600)
+!5630 = !DILocation(line: 9760, column: 33, scope: !5600)
+!5631 = !DILocation(line: 9761, column: 12, scope: !5600)
+!5632 = !DILocation(line: 9762, column: 7, scope: !5600)
+!5633 = !DILocation(line: 9763, column: 37, scope: !5600)
+!5634 = !DILocation(line: 9764, column: 26, scope: !5600)
+!5635 = !DILocation(line: 9765, column: 21, scope: !5600)
+!5636 = distinct !DISubprogram(name: "kernel_244", scope: !6, file: !6, line: 9770, type: !11, scopeLine: 9770, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!5637 = !DILocation(line: 9770, column: 33, scope: !5636)
+!5638 = !DILocation(line: 9771, column: 25, scope: !5636)
+!5639 = !DILocation(line: 9771, column: 3, scope: !5636)
+!5640 = !DILocation(line: 9773, column: 38, scope: !5636)
+!5641 = !DILocation(line: 9775, column: 5, scope: !5636)
+!5642 = !DILocation(line: 9776, column: 6, scope: !5636)
+!5643 = !DILocation(line: 9777, column: 14, scope: !5636)
+!5644 = !DILocation(line: 9777, column: 19, scope: !5636)
+!5645 = !DILocation(line: 9779, column: 22, scope: !5636)
+!5646 = !DILocation(line: 9780, column: 21, scope: !5636)
+!5647 = !DILocation(line: 9780, column: 27, scope: !5636)
+!5648 = !DILocation(line: 9782, column: 19, scope: !5636)
+!5649 = !DILocation(line: 9783, column: 39, scope: !5636)
+!5650 = !DILocation(line: 9784, column: 27, scope: !5636)
+!5651 = !DILocation(line: 9786, column: 12, scope: !5636)
+!5652 = !DILocation(line: 9788, column: 4, scope: !5636)
+!5653 = !DILocation(line: 9789, column: 6, scope: !5636)
+!5654 = distinct !DISubprogram(name: "kernel_245", scope: !7, file: !7, line: 9810, type: !11, scopeLine: 9810, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!5655 = !DILocation(line: 9810, column: 13, scope: !5654)
+!5656 = !DILocation(line: 9811, column: 28, scope: !5654)
+!5657 = !DILocation(line: 9812, column: 5, scope: !5654)
+!5658 = !DILocation(line: 9814, column: 18, scope: !5654)
+!5659 = !DILocation(line: 9815, column: 9, scope: !5654)
+!5660 = !DILocation(line: 9816, column: 9, scope: !5654)
+!5661 = !DILocation(line: 9817, column: 35, scope: !5654)
+!5662 = !DILocation(line: 9817, column: 37, scope: !5654)
+!5663 = !DILocation(line: 9818, column: 23, scope: !5654)
+!5664 = !DILocation(line: 9819, column: 29, scope: !5654)
+!5665 = !DILocation(line: 9820, column: 16, scope: !5654)
+!5666 = !DILocation(line: 9821, column: 14, scope: !5654)
+!5667 = !DILocation(line: 9821, column: 25, scope: !5654)
+!5668 = !DILocation(line: 9822, column: 39, scope: !5654)
+!5669 = !DILocation(line: 9823, column: 19, scope: !5654)
+!5670 = !DILocation(line: 9824, column: 23, scope: !5654)
+!5671 = !DILocation(line: 9826, column: 11, scope: !5654)
+!5672 = !DILocation(line: 9826, column: 10, scope: !5654)
+!5673 = !DILocation(line: 9827, column: 6, scope: !5654)
+!5674 = distinct !{!5674, !26}
+!5675 = !DILocation(line: 9828, column: 35, scope: !5654)
+!5676 = distinct !DISubprogram(name: "kernel_246", scope: !8, file: !8, line: 9850, type: !11, scopeLine: 9850, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!5677 = !DILocation(line: 9852, column: 21, scope: !5676)
+!5678 = !DILocation(line: 9853, column: 32, scope: !5676)
+!5679 = !DILocation(line: 9854, column: 12, scope: !5676)
+!5680 = !DILocation(line: 9855, column: 26, scope: !5676)
+!5681 = !DILocation(line: 9857, column: 40, scope: !5676)
+!5682 = !DILocation(line: 9858, column: 11, scope: !5676)
+!5683 = !DILocation(line: 9859, column: 8, scope: !5676)
+!5684 = !DILocation(line: 9859, column: 39, scope: !5676)
+!5685 = !DILocation(line: 9860, column: 35, scope: !5676)
+!5686 = !DILocation(line: 9861, column: 10, scope: !5676)
+!5687 = !DILocation(line: 9861, column: 12, scope: !5676)
+!5688 = !DILocation(line: 9862, column: 22, scope: !5676)
+!5689 = !DILocation(line: 9864, column: 20, scope: !5676)
+!5690 = !DILocation(line: 9864, column: 4, scope: !5676)
+!5691 = !DILocation(line: 9865, column: 29, scope: !5676)
+!5692 = !DILocation(line: 9867, column: 4, scope: !5676)
+!5693 = !DILocation(line: 9867, column: 20, scope: !5676)
+!5694 = !DILocation(line: 9867, column: 5, scope: !5676)
+!5695 = !DILocation(line: 9868, column: 32, scope: !5676)
+!5696 = !DILocation(line: 9868, column: 36, scope: !5676)
+!5697 = distinct !DISubprogram(name: "kernel_247", scope: !9, file: !9, line: 9890, type: !11, scopeLine: 9890, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!5698 = !DILocation(line: 9890, column: 26, scope: !5697)
+!5699 = !DILocation(line: 9892, column: 10, scope: !5697)
+!5700 = !DILocation(line: 9894, column: 5, scope: !5697)
+!5701 = !DILocation(line: 9894, column: 13, scope: !5697)
+!5702 = !DILocation(line: 9895, column: 34, scope: !5697)
+!5703 = !DILocation(line: 9895, column: 25, scope: !5697)
+!5704 = !DILocation(line: 9896, column: 14, scope: !5697)
+!5705 = !DILocation(line: 9897, column: 40, scope: !5697)
+!5706 = !DILocation(line: 9898, column: 35, scope: !5697)
+!5707 = !DILocation(line: 9898, column: 14, scope: !5697)
+!5708 = !DILocation(line: 9899, column: 15, scope: !5697)
+!5709 = !DILocation(line: 9901, column: 26, scope: !5697)
+!5710 = distinct !DISubprogram(name: "kernel_248", scope: !2, file: !2, line: 9930, type: !11, scopeLine: 9930, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!5711 = !DILocation(line: 9930, column: 13, scope: !5710)
+!5712 = !DILocation(line: 9930, column: 22, scope: !5710)
+!5713 = !DILocation(line: 9931, column: 18, scope: !5710)
+!5714 = !DILocation(line: 9932, column: 3, scope: !5710)
+!5715 = !DILocation(line: 9933, column: 34, scope: !5710)
+!5716 = !DILocation(line: 9934, column: 17, scope: !5710)
+!5717 = !DILocation(line: 9936, column: 11, scope: !5710)
+!5718 = !DILocation(line: 9937, column: 11, scope: !5710)
+!5719 = !DILocation(line: 9938, column: 6, scope: !5710)
+!5720 = !DILocation(line: 9939, column: 32, scope: !5710)
+!5721 = !DILocation(line: 9941, column: 21, scope: !5710)
+!5722 = !DILocation(line: 9942, column: 8, scope: !5710)
+!5723 = !DILocation(line: 9944, column: 16, scope: !5710)
+!5724 = !DILocation(line: 9945, column: 20, scope: !5710)
+!5725 = !DILocation(line: 9946, column: 11, scope: !5710)
+!5726 = !DILocation(line: 9947, column: 16, scope: !5710)
+!5727 = !DILocation(line: 9948, column: 15, scope: !5710)
+!5728 = !DILocation(line: 9949, column: 8, scope: !5710)
+!5729 = !DILocation(line: 9951, column: 33, scope: !5710)
+!5730 = !DILocation(line: 9952, column: 34, scope: !5710)
+!5731 = !DILocation(line: 9953, column: 22, scope: !5710)
+!5732 = !DILocation(line: 9954, column: 12, scope: !5710)
+!5733 = !DILocation(line: 9956, column: 9, scope: !5710)
+!5734 = !DILocation(line: 9958, column: 39, scope: !5710)
+!5735 = !DILocation(line: 9959, column: 26, scope: !5710)
+!5736 = !DILocation(line: 9960, column: 8, scope: !5710)
+!5737 = !DILocation(line: 9960, column: 12, scope: !5710)
+!5738 = !DILocation(line: 9960, column: 21, scope: !5710)
+!5739 = !DILocation(line: 9961, column: 17, scope: !5710)
+!5740 = !DILocation(line: 9962, column: 9, scope: !5710)
+!5741 = !DILocation(line: 9963, column: 7, scope: !5710)
+!5742 = !DILocation(line: 9963, column: 28, scope: !5710)
+!5743 = !DILocation(line: 9963, column: 10, scope: !5710)
+!5744 = !DILocation(line: 9964, column: 18, scope: !5710)
+!5745 = !DILocation(line: 9965, column: 38, scope: !5710)
+!5746 = !DILocation(line: 9967, column: 14, scope: !5710)
+!5747 = !DILocation(line: 9969, column: 20, scope: !5710)
+!5748 = !DILocation(line: 9970, column: 37, scope: !5710)
+!5749 = !DILocation(line: 9971, column: 29, scope: !5710)
+!5750 = !DILocation(line: 9972, column: 17, scope: !5710)
+!5751 = !DILocation(line: 9973, column: 4, scope: !5710)
+!5752 = !DILocation(line: 9975, column: 6, scope: !5710)
+!5753 = !DILocation(line: 9976, column: 21, scope: !5710)
+!5754 = !DILocation(line: 9977, column: 16, scope: !5710)
+!5755 = distinct !DISubprogram(name: "kernel_249", scope: !3, file: !3, line: 9970, type: !11, scopeLine: 9970, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!5756 = !DILocation(line: 9972, column: 18, scope: !5755)
+!5757 = !DILocation(line: 9973, column: 10, scope: !5755)
+!5758 = !DILocation(line: 9973, column: 6, scope: !5755)
+!5759 = !DILocation(line: 9974, column: 15, scope: !5755)
+!5760 = !DILocation(line: 9975, column: 15, scope: !5755)
+!5761 = !DILocation(line: 9976, column: 18, scope: !5755)
+!5762 = !DILocation(line: 9976, column: 17, scope: !5755)
+!5763 = !DILocation(line: 9978, column: 7, scope: !5755)
+!5764 = !DILocation(line: 9979, column: 28, scope: !5755)
+!5765 = !DILocation(line: 9980, column: 34, scope: !5755)
+!5766 = !DILocation(line: 9980, column: 39, scope: !5755)
+!5767 = !DILocation(line: 9981, column: 7, scope: !5755)
+!5768 = !DILocation(line: 9982, column: 22, scope: !5755)
+!5769 = !DILocation(line: 9983, column: 34, scope: !5755)
+!5770 = !DILocation(line: 9984, column: 35, scope: !5755)
+!5771 = !DILocation(line: 9985, column: 16, scope: !5755)
+!5772 = distinct !DISubprogram(name: "kernel_250", scope: !4, file: !4, line: 10010, type: !11, scopeLine: 10010, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!5773 = !DILocation(line: 10011, column: 38, scope: !5772)
+!5774 = !DILocation(line: 10011, column: 32, scope: !5772)
+!5775 = !DILocation(line: 10011, column: 21, scope: !5772)
+!5776 = !DILocation(line: 10013, column: 13, scope: !5772)
+!5777 = !DILocation(line: 10013, column: 9, scope: !5772)
+!5778 = !DILocation(line: 10013, column: 8, scope: !5772)
+!5779 = !DILocation(line: 10015, column: 28, scope: !5772)
+!5780 = !DILocation(line: 10015, column: 38, scope: !5772)
+!5781 = !DILocation(line: 10015, column: 37, scope: !5772)
+!5782 = !DILocation(line: 10017, column: 17, scope: !5772)
+!5783 = !DILocation(line: 10018, column: 30, scope: !5772)
+!5784 = !DILocation(line: 10018, column: 25, scope: !5772)
+!5785 = !DILocation(line: 10019, column: 39, scope: !5772)
+!5786 = !DILocation(line: 10020, column: 27, scope: !5772)
+!5787 = !DILocation(line: 10021, column: 5, scope: !5772)
+!5788 = !DILocation(line: 10021, column: 9, scope: !5772)
+!5789 = !DILocation(line: 10022, column: 19, scope: !5772)
+!5790 = !DILocation(line: 10024, column: 28, scope: !5772)
+!5791 = !DILocation(line: 10026, column: 27, scope: !5772)
+!5792 = distinct !{!5792, !26}
+!5793 = !DILocation(line: 10027, column: 17, scope: !5772)
+!5794 = distinct !DISubprogram(name: "kernel_251", scope: !5, file: !5, line: 10050, type: !11, scopeLine: 10050, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!5795 = !DILocation(line: 10051, column: 25, scope: !5794)
+!5796 = !DILocation(line: 10052, column: 23, scope: !5794)
+!5797 = !DILocation(line: 10053, column: 4, scope: !5794)
+!5798 = !DILocation(line: 10054, column: 38, scope: !5794)
+!5799 = !DILocation(line: 10054, column: 22, scope: !5794)
+!5800 = !DILocation(line: 10055, column: 25, scope: !5794)
+!5801 = !DILocation(line: 10055, column: 40, scope: !5794)
+!5802 = !DILocation(line: 10055, column: 18, scope: !5794)
+!5803 = !DILocation(line: 10056, column: 25, scope: !5794)
+!5804 = !DILocation(line: 10056, column: 16, scope: !5794)
+!5805 = !DILocation(line: 10058, column: 36, scope: !5794)
+!5806 = !DILocation(line: 10060, column: 12, scope: !5794)
+!5807 = !DILocation(line: 10062, column: 10, scope: !5794)
+!5808 = !DILocation(line: 10063, column: 9, scope: !5794)
+!5809 = !DILocation(line: 10065, column: 17, scope: !5794)
+!5810 = !DILocation(line: 10066, column: 35, scope: !5794)
+!5811 = !DILocation(line: 10067, column: 7, scope: !5794)
+!5812 = !DILocation(line: 10069, column: 16, scope: !5794)
+!5813 = !DILocation(line: 10070, column: 28, scope: !5794)
+!5814 = !DILocation(line: 10070, column: 27, scope: !5794)
+!5815 = distinct !DISubprogram(name: "kernel_252", scope: !6, file: !6, line: 10090, type: !11, scopeLine: 10090, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!5816 = !DILocation(line: 10091, column: 6, scope: !5815)
+!5817 = !DILocation(line: 10093, column: 25, scope: !5815)
+!5818 = !DILocation(line: 10094, column: 25, scope: !5815)
+!5819 = !DILocation(line: 10095, column: 27, scope: !5815)
+!5820 = !DILocation(line: 10097, column: 4, scope: !5815)
+!5821 = !DILocation(line: 10097, column: 32, scope: !5815)
+!5822 = !DILocation(line: 10099, column: 5, scope: !5815)
+!5823 = !DILocation(line: 10100, column: 36, scope: !5815)
+!5824 = !DILocation(line: 10100, column: 30, scope: !5815)
+!5825 = !DILocation(line: 10102, column: 33, scope: !5815)
+!5826 = !DILocation(line: 10103, column: 12, scope: !5815)
+!5827 = !DILocation(line: 10103, column: 35, scope: !5815)
+!5828 = distinct !DISubprogram(name: "kernel_253", scope: !7, file: !7, line: 10130, type: !11, scopeLine: 10130, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!5829 = !DILocation(line: 10132, column: 11, scope: !5828)
+!5830 = !DILocation(line: 10133, column: 29, scope: !5828)
+!5831 = !DILocation(line: 10134, column: 5, scope: !5828)
+!5832 = !DILocation(line: 10136, column: 20, scope: !5828)
+!5833 = !DILocation(line: 10137, column: 27, scope: !5828)
+!5834 = !DILocation(line: 10138, column: 8, scope: !5828)
+!5835 = !DILocation(line: 10139, column: 23, scope: !5828)
+!5836 = !DILocation(line: 10140, column: 18, scope: !5828)
+!5837 = !DILocation(line: 10141, column: 17, scope: !5828)
+!5838 = !DILocation(line: 10141, column: 28, scope: !5828)
+!5839 = !DILocation(line: 10141, column: 7, scope: !5828)
+!5840 = !DILocation(line: 10142, column: 4, scope: !5828)
+!5841 = !DILocation(line: 10142, column: 37, scope: !5828)
+!5842 = !DILocation(line: 10142, column: 8, scope: !5828)
+!5843 = !DILocation(line: 10142, column: 40, scope: !5828)
+!5844 = !DILocation(line: 10143, column: 21, scope: !5828)
+!5845 = !DILocation(line: 10144, column: 5, scope: !5828)
+!5846 = !DILocation(line: 10145, column: 5, scope: !5828)
+!5847 = !DILocation(line: 10146, column: 24, scope: !5828)
+!5848 = !DILocation(line: 10148, column: 27, scope: !5828)
+!5849 = !DILocation(line: 10148, column: 16, scope: !5828)
+!5850 = !DILocation(line: 10149, column: 39, scope: !5828)
+!5851 = !DILocation(line: 10150, column: 31, scope: !5828)
+!5852 = !DILocation(line: 10151, column: 34, scope: !5828)
+!5853 = !DILocation(line: 10153, column: 10, scope: !5828)
+!5854 = !DILocation(line: 10153, column: 34, scope: !5828)
+!5855 = !DILocation(line: 10153, column: 33, scope: !5828)
+!5856 = !DILocation(line: 10154, column: 4, scope: !5828)
+!5857 = !DILocation(line: 10155, column: 7, scope: !5828)
+!5858 = !DILocation(line: 10157, column: 37, scope: !5828)
+!5859 = !DILocation(line: 10158, column: 12, scope: !5828)
+!5860 = !DILocation(line: 10159, column: 17, scope: !5828)
+!5861 = !DILocation(line: 10160, column: 4, scope: !5828)
+!5862 = !DILocation(line: 10161, column: 36, scope: !5828)
+!5863 = !DILocation(line: 10162, column: 35, scope: !5828)
+!5864 = !DILocation(line: 10162, column: 8, scope: !5828)
+!5865 = !DILocation(line: 10164, column: 35, scope: !5828)
+!5866 = !DILocation(line: 10165, column: 6, scope: !5828)
+!5867 = !DILocation(line: 10165, column: 15, scope: !5828)
+!5868 = !DILocation(line: 10166, column: 6, scope: !5828)
+!5869 = !DILocation(line: 10167, column: 14, scope: !5828)
+!5870 = !DILocation(line: 10168, column: 31, scope: !5828)
+!5871 = !DILocation(line: 10169, column: 11, scope: !5828)
+!5872 = !DILocation(line: 10171, column: 8, scope: !5828)
+!5873 = distinct !DISubprogram(name: "kernel_254", scope: !8, file: !8, line: 10170, type: !11, scopeLine: 10170, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!5874 = !DILocation(line: 10170, column: 9, scope: !5873)
+!5875 = !DILocation(line: 10170, column: 22, scope: !5873)
+!5876 = !DILocation(line: 10171, column: 23, scope: !5873)
+!5877 = !DILocation(line: 10171, column: 17, scope: !5873)
+!5878 = !DILocation(line: 10172, column: 34, scope: !5873)
+!5879 = !DILocation(line: 10173, column: 4, scope: !5873)
+!5880 = !DILocation(line: 10173, column: 40, scope: !5873)
+!5881 = !DILocation(line: 10174, column: 19, scope: !5873)
+!5882 = !DILocation(line: 10174, column: 40, scope: !5873)
+!5883 = !DILocation(line: 10175, column: 5, scope: !5873)
+!5884 = !DILocation(line: 10175, column: 9, scope: !5873)
+!5885 = !DILocation(line: 10177, column: 28, scope: !5873)
+!5886 = !DILocation(line: 10177, column: 25, scope: !5873)
+!5887 = !DILocation(line: 10179, column: 20, scope: !5873)
+!5888 = !DILocation(line: 10179, column: 16, scope: !5873)
+!5889 = !DILocation(line: 10180, column: 20, scope: !5873)
+!5890 = !DILocation(line: 10181, column: 21, scope: !5873)
+!5891 = distinct !DISubprogram(name: "kernel_255", scope: !9, file: !9, line: 10210, type: !11, scopeLine: 10210, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!5892 = !DILocation(line: 10211, column: 17, scope: !5891)
+!5893 = !DILocation(line: 10213, column: 16, scope: !5891)
+!5894 = !DILocation(line: 10215, column: 6, scope: !5891)
+!5895 = !DILocation(line: 10217, column: 33, scope: !5891)
+!5896 = !DILocation(line: 10218, column: 29, scope: !5891)
+!5897 = !DILocation(line: 10219, column: 6, scope: !5891)
+!5898 = !DILocation(line: 10220, column: 28, scope: !5891)
+!5899 = !DILocation(line: 10222, column: 8, scope: !5891)
+!5900 = !DILocation(line: 10223, column: 19, scope: !5891)
+!5901 = !DILocation(line: 10224, column: 14, scope: !5891)
+!5902 = !DILocation(line: 10225, column: 5, scope: !5891)
+!5903 = !DILocation(line: 10225, column: 34, scope: !5891)
+!5904 = !DILocation(line: 10227, column: 15, scope: !5891)
+!5905 = !DILocation(line: 10227, column: 16, scope: !5891)
+!5906 = !DILocation(line: 10229, column: 6, scope: !5891)
+!5907 = !DILocation(line: 10231, column: 39, scope: !5891)
+!5908 = !DILocation(line: 10231, column: 26, scope: !5891)
+!5909 = !DILocation(line: 10231, column: 12, scope: !5891)
+!5910 = !DILocation(line: 10232, column: 37, scope: !5891)
+!5911 = distinct !{!5911, !26}
+!5912 = !DILocation(line: 10233, column: 35, scope: !5891)
+!5913 = distinct !DISubprogram(name: "kernel_256", scope: !2, file: !2, line: 10250, type: !11, scopeLine: 10250, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!5914 = !DILocation(line: 10252, column: 12, scope: !5913)
+!5915 = !DILocation(line: 10253, column: 14, scope: !5913)
+!5916 = !DILocation(line: 10254, column: 3, scope: !5913)
+!5917 = !DILocation(line: 10255, column: 37, scope: !5913)
+!5918 = !DILocation(line: 10257, column: 29, scope: !5913)
+!5919 = !DILocation(line: 10258, column: 10, scope: !5913)
+!5920 = !DILocation(line: 10259, column: 3, scope: !5913)
+!5921 = !DILocation(line: 10260, column: 32, scope: !5913)
+!5922 = !DILocation(line: 10262, column: 15, scope: !5913)
+!5923 = !DILocation(line: 10263, column: 38, scope: !5913)
+!5924 = !DILocation(line: 10264, column: 25, scope: !5913)
+!5925 = !DILocation(line: 10264, column: 38, scope: !5913)
+!5926 = !DILocation(line: 10265, column: 16, scope: !5913)
+!5927 = !DILocation(line: 10265, column: 21, scope: !5913)
+!5928 = !DILocation(line: 10267, column: 37, scope: !5913)
+!5929 = !DILocation(line: 10269, column: 29, scope: !5913)
+!5930 = !DILocation(line: 10270, column: 34, scope: !5913)
+!5931 = !DILocation(line: 10270, column: 5, scope: !5913)
+!5932 = !DILocation(line: 10271, column: 31, scope: !5913)
+!5933 = !DILocation(line: 10273, column: 15, scope: !5913)
+!5934 = distinct !DISubprogram(name: "kernel_257", scope: !3, file: !3, line: 10290, type: !11, scopeLine: 10290, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!5935 = !DILocation(line: 10292, column: 8, scope: !5934)
+!5936 = !DILocation(line: 10292, column: 8, scope: !5934)
+!5937 = !DILocation(line: 10293, column: 37, scope: !5934)
+!5938 = !DILocation(line: 10295, column: 20, scope: !5934)
+!5939 = !DILocation(line: 10296, column: 19, scope: !5934)
+!5940 = !DILocation(line: 10297, column: 3, scope: !5934)
+!5941 = !DILocation(line: 10298, column: 27, scope: !5934)
+!5942 = !DILocation(line: 10299, column: 15, scope: !5934)
+!5943 = !DILocation(line: 10300, column: 26, scope: !5934)
+!5944 = !DILocation(line: 10301, column: 28, scope: !5934)
+!5945 = !DILocation(line: 10303, column: 4, scope: !5934)
+!5946 = !DILocation(line: 10305, column: 14, scope: !5934)
+!5947 = !DILocation(line: 10306, column: 35, scope: !5934)
+!5948 = !DILocation(line: 10307, column: 13, scope: !5934)
+!5949 = !DILocation(line: 10308, column: 9, scope: !5934)
+!5950 = !DILocation(line: 10309, column: 5, scope: !5934)
+!5951 = !DILocation(line: 10311, column: 23, scope: !5934)
+!5952 = !DILocation(line: 10312, column: 4, scope: !5934)
+!5953 = distinct !DISubprogram(name: "kernel_258", scope: !4, file: !4, line: 10330, type: !11, scopeLine: 10330, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!5954 = !DILocation(line: 10331, column: 38, scope: !5953)
+!5955 = !DILocation(line: 10331, column: 24, scope: !5953)
+!5956 = !DILocation(line: 10332, column: 38, scope: !5953)
+!5957 = !DILocation(line: 10333, column: 39, scope: !5953)
+!5958 = !DILocation(line: 10334, column: 9, scope: !5953)
+!5959 = !DILocation(line: 10334, column: 34, scope: !5953)
+!5960 = !DILocation(line: 10335, column: 9, scope: !5953)
+!5961 = !DILocation(line: 10336, column: 33, scope: !5953)
+!5962 = !DILocation(line: 10337, column: 23, scope: !5953)
+!5963 = !DILocation(line: 10338, column: 29, scope: !5953)
+!5964 = !DILocation(line: 10339, column: 27, scope: !5953)
+!5965 = !DILocation(line: 10340, column: 16, scope: !5953)
+!5966 = !DILocation(line: 10341, column: 37, scope: !5953)
+!5967 = !DILocation(line: 10343, column: 15, scope: !5953)
+!5968 = !DILocation(line: 10344, column: 9, scope: !5953)
+!5969 = !DILocation(line: 10344, column: 25, scope: !5953)
+!5970 = !DILocation(line: 10346, column: 20, scope: !5953)
+!5971 = !DILocation(line: 10347, column: 23, scope: !5953)
+!5972 = !DILocation(line: 10349, column: 20, scope: !5953)
+!5973 = !DILocation(line: 10351, column: 9, scope: !5953)
+!5974 = !DILocation(line: 10351, column: 34, scope: !5953)
+!5975 = !DILocation(line: 10353, column: 17, scope: !5953)
+!5976 = !DILocation(line: 10354, column: 24, scope: !5953)
+!5977 = !DILocation(line: 10355, column: 29, scope: !5953)
+!5978 = !DILocation(line: 10355, column: 27, scope: !5953)
+!5979 = !DILocation(line: 10356, column: 26, scope: !5953)
+!5980 = !DILocation(line: 10357, column: 34, scope: !5953)
+!5981 = !DILocation(line: 10359, column: 30, scope: !5953)
+!5982 = !DILocation(line: 10361, column: 22, scope: !5953)
+!5983 = !DILocation(line: 10362, column: 28, scope: !5953)
+!5984 = !DILocation(line: 10363, column: 28, scope: !5953)
+!5985 = !DILocation(line: 10363, column: 18, scope: !5953)
+!5986 = !DILocation(line: 10365, column: 23, scope: !5953)
+!5987 = !DILocation(line: 10367, column: 4, scope: !5953)
+!5988 = !DILocation(line: 10369, column: 20, scope: !5953)
+!5989 = distinct !DISubprogram(name: "kernel_259", scope: !5, file: !5, line: 10370, type: !11, scopeLine: 10370, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!5990 = !DILocation(line: 10370, column: 18, scope: !5989)
+!5991 = !DILocation(line: 10370, column: 33, scope: !5989)
+!5992 = !DILocation(line: 10371, column: 11, scope: !5989)
+!5993 = !DILocation(line: 10371, column: 19, scope: !5989)
+!5994 = !DILocation(line: 10373, column: 4, scope: !5989)
+!5995 = !DILocation(line: 10373, column: 26, scope: !5989)
+!5996 = !DILocation(line: 10373, column: 5, scope: !5989)
+!5997 = !DILocation(line: 10375, column: 6, scope: !5989)
+!5998 = !DILocation(line: 10377, column: 10, scope: !5989)
+!5999 = !DILocation(line: 10377, column: 14, scope: !5989)
+!6000 = !DILocation(line: 10378, column: 8, scope: !5989)
+!6001 = !DILocation(line: 10378, column: 35, scope: !5989)
+!6002 = !DILocation(line: 10378, column: 40, scope: !5989)
+!6003 = !DILocation(line: 10379, column: 5, scope: !5989)
+!6004 = !DILocation(line: 10381, column: 37, scope: !5989)
+!6005 = !DILocation(line: 10383, column: 13, scope: !5989)
+!6006 = distinct !DISubprogram(name: "kernel_260", scope: !6, file: !6, line: 10410, type: !11, scopeLine: 10410, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!6007 = !DILocation(line: 10411, column: 15, scope: !6006)
+!6008 = !DILocation(line: 10411, column: 21, scope: !6006)
+!6009 = !DILocation(line: 10413, column: 19, scope: !6006)
+!6010 = !DILocation(line: 10413, column: 3, scope: !6006)
+!6011 = !DILocation(line: 10414, column: 5, scope: !6006)
+!6012 = !DILocation(line: 10416, column: 29, scope: !6006)
+!6013 = !DILocation(line: 10417, column: 40, scope: !6006)
+!6014 = !DILocation(line: 10418, column: 17, scope: !6006)
+!6015 = !DILocation(line: 10420, column: 31, scope: !6006)
+!6016 = !DILocation(line: 10421, column: 27, scope: !6006)
+!6017 = !DILocation(line: 10422, column: 27, scope: !6006)
+!6018 = !DILocation(line: 10424, column: 21, scope: !6006)
+!6019 = !DILocation(line: 10425, column: 26, scope: !6006)
+!6020 = !DILocation(line: 10425, column: 8, scope: !6006)
+!6021 = !DILocation(line: 10426, column: 35, scope: !6006)
+!6022 = !DILocation(line: 10428, column: 9, scope: !6006)
+!6023 = !DILocation(line: 10430, column: 7, scope: !6006)
+!6024 = !DILocation(line: 10431, column: 25, scope: !6006)
+!6025 = !DILocation(line: 10432, column: 4, scope: !6006)
+!6026 = distinct !{!6026, !26}
+!6027 = !DILocation(line: 10432, column: 17, scope: !6006)
+!6028 = distinct !DISubprogram(name: "kernel_261", scope: !7, file: !7, line: 10450, type: !11, scopeLine: 10450, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!6029 = !DILocation(line: 10451, column: 34, scope: !6028)
+!6030 = !DILocation(line: 10452, column: 8, scope: !6028)
+!6031 = !DILocation(line: 10454, column: 7, scope: !6028)
+!6032 = !DILocation(line: 10456, column: 30, scope: !6028)
+!6033 = !DILocation(line: 10456, column: 27, scope: !6028)
+!6034 = !DILocation(line: 10457, column: 18, scope: !6028)
+!6035 = !DILocation(line: 10457, column: 16, scope: !6028)
+!6036 = !DILocation(line: 10457, column: 10, scope: !6028)
+!6037 = !DILocation(line: 10458, column: 27, scope: !6028)
+!6038 = !DILocation(line: 10458, column: 19, scope: !6028)
+!6039 = !DILocation(line: 10459, column: 35, scope: !6028)
+!6040 = !DILocation(line: 10460, column: 7, scope: !6028)
+!6041 = !DILocation(line: 10461, column: 38, scope: !6028)
+!6042 = !DILocation(line: 10462, column: 38, scope: !6028)
+!6043 = !DILocation(line: 10464, column: 16, scope: !6028)
+!6044 = !DILocation(line: 10465, column: 3, scope: !6028)
+!6045 = !DILocation(line: 10466, column: 11, scope: !6028)
+!6046 = !DILocation(line: 10466, column: 27, scope: !6028)
+!6047 = !DILocation(line: 10467, column: 31, scope: !6028)
+!6048 = !DILocation(line: 10467, column: 13, scope: !6028)
+!6049 = distinct !DISubprogram(name: "kernel_262", scope: !8, file: !8, line: 10490, type: !11, scopeLine: 10490, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!6050 = !DILocation(line: 10491, column: 11, scope: !6049)
+!6051 = !DILocation(line: 10493, column: 38, scope: !6049)
+!6052 = !DILocation(line: 10493, column: 9, scope: !6049)
+!6053 = !DILocation(line: 10494, column: 33, scope: !6049)
+!6054 = !DILocation(line: 10496, column: 17, scope: !6049)
+!6055 = !DILocation(line: 10497, column: 16, scope: !6049)
+!6056 = !DILocation(line: 10497, column: 13, scope: !6049)
+!6057 = !DILocation(line: 10499, column: 18, scope: !6049)
+!6058 = !DILocation(line: 10501, column: 4, scope: !6049)
+!6059 = !DILocation(line: 10503, column: 5, scope: !6049)
+!6060 = !DILocation(line: 10505, column: 32, scope: !6049)
+!6061 = !DILocation(line: 10506, column: 31, scope: !6049)
+!6062 = !DILocation(line: 10507, column: 39, scope: !6049)
+!6063 = !DILocation(line: 10507, column: 36, scope: !6049)
+!6064 = !DILocation(line: 10508, column: 33, scope: !6049)
+!6065 = !DILocation(line: 10510, column: 38, scope: !6049)
+!6066 = distinct !DISubprogram(name: "kernel_263", scope: !9, file: !9, line: 10530, type: !11, scopeLine: 10530, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!6067 = !DILocation(line: 10532, column: 18, scope: !6066)
+!6068 = !DILocation(line: 10533, column: 5, scope: !6066)
+!6069 = !DILocation(line: 10535, column: 23, scope: !6066)
+!6070 = !DILocation(line: 10536, column: 17, scope: !6066)
+!6071 = !DILocation(line: 10538, column: 23, scope: !6066)
+!6072 = !DILocation(line: 10540, column: 18, scope: !6066)
+!6073 = !DILocation(line: 10541, column: 29, scope: !6066)
+!6074 = !DILocation(line: 10541, column: 12, scope: !6066)
+!6075 = !DILocation(line: 10542, column: 40, scope: !6066)
+!6076 = !DILocation(line: 10542, column: 29, scope: !6066)
+!6077 = !DILocation(line: 10543, column: 34, scope: !6066)
+!6078 = !DILocation(line: 10545, column: 24, scope: !6066)
+!6079 = !DILocation(line: 10546, column: 31, scope: !6066)
+!6080 = !DILocation(line: 10547, column: 25, scope: !6066)
+!6081 = !DILocation(line: 10547, column: 8, scope: !6066)
+!6082 = !DILocation(line: 10548, column: 10, scope: !6066)
+!6083 = !DILocation(line: 10549, column: 17, scope: !6066)
+!6084 = !DILocation(line: 10550, column: 8, scope: !6066)
+!6085 = !DILocation(line: 10550, column: 21, scope: !6066)
+!6086 = !DILocation(line: 10552, column: 32, scope: !6066)
+!6087 = !DILocation(line: 10554, column: 32, scope: !6066)
+!6088 = !DILocation(line: 10555, column: 26, scope: !6066)
+!6089 = !DILocation(line: 10557, column: 9, scope: !6066)
+!6090 = !DILocation(line: 10558, column: 34, scope: !6066)
+!6091 = !DILocation(line: 10560, column: 14, scope: !6066)
+!6092 = !DILocation(line: 10562, column: 25, scope: !6066)
+!6093 = !DILocation(line: 10563, column: 25, scope: !6066)
+!6094 = !DILocation(line: 10563, column: 10, scope: !6066)
+!6095 = !DILocation(line: 10564, column: 17, scope: !6066)
+!6096 = !DILocation(line: 10565, column: 38, scope: !6066)
+!6097 = !DILocation(line: 10566, column: 40, scope: !6066)
+!6098 = !DILocation(line: 10567, column: 14, scope: !6066)
+!6099 = !DILocation(line: 10567, column: 29, scope: !6066)
+!6100 = !DILocation(line: 10569, column: 19, scope: !6066)
+!6101 = !DILocation(line: 10571, column: 38, scope: !6066)
+!6102 = !DILocation(line: 10573, column: 26, scope: !6066)
+!6103 = !DILocation(line: 10575, column: 35, scope: !6066)
+!6104 = !DILocation(line: 10575, column: 36, scope: !6066)
+!6105 = distinct !DISubprogram(name: "kernel_264", scope: !2, file: !2, line: 10570, type: !11, scopeLine: 10570, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!6106 = !DILocation(line: 10571, column: 39, scope: !6105)
+!6107 = !DILocation(line: 10573, column: 40, scope: !6105)
+!6108 = !DILocation(line: 10574, column: 11, scope: !6105)
+!6109 = !DILocation(line: 10575, column: 26, scope: !6105)
+!6110 = !DILocation(line: 10576, column: 24, scope: !6105)
+!6111 = !DILocation(line: 10578, column: 6, scope: !6105)
+!6112 = !DILocation(line: 10578, column: 16, scope: !6105)
+!6113 = !DILocation(line: 10580, column: 3, scope: !6105)
+!6114 = !DILocation(line: 10581, column: 20, scope: !6105)
+!6115 = !DILocation(line: 10582, column: 35, scope: !6105)
+!6116 = !DILocation(line: 10582, column: 7, scope: !6105)
+!6117 = !DILocation(line: 10582, column: 20, scope: !6105)
+!6118 = !DILocation(line: 10583, column: 31, scope: !6105)
+!6119 = !DILocation(line: 10584, column: 30, scope: !6105)
+!6120 = !DILocation(line: 10585, column: 28, scope: !6105)
+!6121 = !DILocation(line: 10586, column: 4, scope: !6105)
+!6122 = !DILocation(line: 10588, column: 39, scope: !6105)
+!6123 = distinct !DISubprogram(name: "kernel_265", scope: !3, file: !3, line: 10610, type: !11, scopeLine: 10610, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!6124 = !DILocation(line: 10610, column: 20, scope: !6123)
+!6125 = !DILocation(line: 10611, column: 33, scope: !6123)
+!6126 = !DILocation(line: 10613, column: 25, scope: !6123)
+!6127 = !DILocation(line: 10614, column: 10, scope: !6123)
+!6128 = !DILocation(line: 10615, column: 30, scope: !6123)
+!6129 = !DILocation(line: 10617, column: 35, scope: !6123)
+!6130 = !DILocation(line: 10619, column: 18, scope: !6123)
+!6131 = !DILocation(line: 10620, column: 31, scope: !6123)
+!6132 = !DILocation(line: 10622, column: 39, scope: !6123)
+!6133 = !DILocation(line: 10623, column: 4, scope: !6123)
+!6134 = !DILocation(line: 10624, column: 3, scope: !6123)
+!6135 = !DILocation(line: 10626, column: 22, scope: !6123)
+!6136 = !DILocation(line: 10627, column: 26, scope: !6123)
+!6137 = !DILocation(line: 10628, column: 9, scope: !6123)
+!6138 = !DILocation(line: 10630, column: 40, scope: !6123)
+!6139 = !DILocation(line: 10630, column: 12, scope: !6123)
+!6140 = !DILocation(line: 10632, column: 5, scope: !6123)
+!6141 = !DILocation(line: 10633, column: 10, scope: !6123)
+!6142 = !DILocation(line: 10633, column: 22, scope: !6123)
+!6143 = distinct !{!6143, !26}
+!6144 = !DILocation(line: 10634, column: 32, scope: !6123)
+!6145 = distinct !DISubprogram(name: "kernel_266", scope: !4, file: !4, line: 10650, type: !11, scopeLine: 10650, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!6146 = !DILocation(line: 10651, column: 11, scope: !6145)
+!6147 = !DILocation(line: 10652, column: 9, scope: !6145)
+!6148 = !DILocation(line: 10652, column: 19, scope: !6145)
+!6149 = !DILocation(line: 10654, column: 18, scope: !6145)
+!6150 = !DILocation(line: 10654, column: 23, scope: !6145)
+!6151 = !DILocation(line: 10654, column: 7, scope: !6145)
+!6152 = !DILocation(line: 10655, column: 17, scope: !6145)
+!6153 = !DILocation(line: 10657, column: 37, scope: !6145)
+!6154 = !DILocation(line: 10657, column: 36, scope: !6145)
+!6155 = !DILocation(line: 10658, column: 31, scope: !6145)
+!6156 = !DILocation(line: 10659, column: 26, scope: !6145)
+!6157 = !DILocation(line: 10660, column: 17, scope: !6145)
+!6158 = !DILocation(line: 10660, column: 12, scope: !6145)
+!6159 = !DILocation(line: 10660, column: 20, scope: !6145)
+!6160 = !DILocation(line: 10661, column: 12, scope: !6145)
+!6161 = !DILocation(line: 10663, column: 16, scope: !6145)
+!6162 = !DILocation(line: 10664, column: 35, scope: !6145)
+!6163 = !DILocation(line: 10666, column: 3, scope: !6145)
+!6164 = !DILocation(line: 10667, column: 24, scope: !6145)
+!6165 = !DILocation(line: 10669, column: 36, scope: !6145)
+!6166 = distinct !DISubprogram(name: "kernel_267", scope: !5, file: !5, line: 10690, type: !11, scopeLine: 10690, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!6167 = !DILocation(line: 10690, column: 3, scope: !6166)
+!6168 = !DILocation(line: 10691, column: 39, scope: !6166)
+!6169 = !DILocation(line: 10692, column: 39, scope: !6166)
+!6170 = !DILocation(line: 10692, column: 27, scope: !6166)
+!6171 = !DILocation(line: 10693, column: 16, scope: !6166)
+!6172 = !DILocation(line: 10694, column: 15, scope: !6166)
+!6173 = !DILocation(line: 10695, column: 3, scope: !6166)
+!6174 = !DILocation(line: 10697, column: 15, scope: !6166)
+!6175 = !DILocation(line: 10699, column: 25, scope: !6166)
+!6176 = !DILocation(line: 10701, column: 34, scope: !6166)
+!6177 = !DILocation(line: 10703, column: 35, scope: !6166)
+!6178 = !DILocation(line: 10703, column: 22, scope: !6166)
+!6179 = !DILocation(line: 10704, column: 18, scope: !6166)
+!6180 = !DILocation(line: 10704, column: 35, scope: !6166)
+!6181 = !DILocation(line: 10706, column: 37, scope: !6166)
+!6182 = !DILocation(line: 10707, column: 38, scope: !6166)
+!6183 = !DILocation(line: 10708, column: 30, scope: !6166)
+!6184 = !DILocation(line: 10709, column: 40, scope: !6166)
+!6185 = distinct !DISubprogram(name: "kernel_268", scope: !6, file: !6, line: 10730, type: !11, scopeLine: 10730, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!6186 = !DILocation(line: 10731, column: 9, scope: !6185)
+!6187 = !DILocation(line: 10732, column: 10, scope: !6185)
+!6188 = !DILocation(line: 10733, column: 28, scope: !6185)
+!6189 = !DILocation(line: 10733, column: 26, scope: !6185)
+!6190 = !DILocation(line: 10735, column: 11, scope: !6185)
+!6191 = !DILocation(line: 10735, column: 18, scope: !6185)
+!6192 = !DILocation(line: 10736, column: 34, scope: !6185)
+!6193 = !DILocation(line: 10736, column: 30, scope: !6185)
+!6194 = !DILocation(line: 10736, column: 21, scope: !6185)
+!6195 = !DILocation(line: 10737, column: 5, scope: !6185)
+!6196 = !DILocation(line: 10738, column: 25, scope: !6185)
+!6197 = !DILocation(line: 10738, column: 14, scope: !6185)
+!6198 = !DILocation(line: 10738, column: 39, scope: !6185)
+!6199 = !DILocation(line: 10739, column: 23, scope: !6185)
+!6200 = !DILocation(line: 10741, column: 5, scope: !6185)
+!6201 = !DILocation(line: 10742, column: 26, scope: !6185)
+!6202 = !DILocation(line: 10744, column: 34, scope: !6185)
+!6203 = !DILocation(line: 10745, column: 9, scope: !6185)
+!6204 = !DILocation(line: 10746, column: 20, scope: !6185)
+!6205 = !DILocation(line: 10746, column: 6, scope: !6185)
+!6206 = !DILocation(line: 10748, column: 7, scope: !6185)
+!6207 = !DILocation(line: 10748, column: 34, scope: !6185)
+!6208 = !DILocation(line: 10749, column: 37, scope: !6185)
+!6209 = !DILocation(line: 10749, column: 14, scope: !6185)
+!6210 = !DILocation(line: 10750, column: 9, scope: !6185)
+!6211 = !DILocation(line: 10751, column: 12, scope: !6185)
+!6212 = distinct !DISubprogram(name: "kernel_269", scope: !7, file: !7, line: 10770, type: !11, scopeLine: 10770, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!6213 = !DILocation(line: 10770, column: 5, scope: !6212)
+!6214 = !DILocation(line: 10771, column: 27, scope: !6212)
+!6215 = !DILocation(line: 10772, column: 20, scope: !6212)
+!6216 = !DILocation(line: 10773, column: 25, scope: !6212)
+!6217 = !DILocation(line: 10775, column: 6, scope: !6212)
+!6218 = !DILocation(line: 10776, column: 38, scope: !6212)
+!6219 = !DILocation(line: 10777, column: 31, scope: !6212)
+!6220 = !DILocation(line: 10778, column: 4, scope: !6212)
+!6221 = !DILocation(line: 10779, column: 34, scope: !6212)
+!6222 = !DILocation(line: 10781, column: 19, scope: !6212)
+!6223 = !DILocation(line: 10782, column: 25, scope: !6212)
+!6224 = !DILocation(line: 10784, column: 11, scope: !6212)
+!6225 = !DILocation(line: 10784, column: 16, scope: !6212)
+!6226 = !DILocation(line: 10785, column: 13, scope: !6212)
+!6227 = !DILocation(line: 10787, column: 10, scope: !6212)
+!6228 = !DILocation(line: 10787, column: 35, scope: !6212)
+!6229 = distinct !DISubprogram(name: "kernel_270", scope: !8, file: !8, line: 10810, type: !11, scopeLine: 10810, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!6230 = !DILocation(line: 10810, column: 29, scope: !6229)
+!6231 = !DILocation(line: 10810, column: 22, scope: !6229)
+!6232 = !DILocation(line: 10810, column: 7, scope: !6229)
+!6233 = !DILocation(line: 10811, column: 8, scope: !6229)
+!6234 = !DILocation(line: 10813, column: 19, scope: !6229)
+!6235 = !DILocation(line: 10813, column: 3, scope: !6229)
+!6236 = !DILocation(line: 10814, column: 25, scope: !6229)
+!6237 = !DILocation(line: 10815, column: 40, scope: !6229)
+!6238 = !DILocation(line: 10817, column: 32, scope: !6229)
+!6239 = !DILocation(line: 10818, column: 37, scope: !6229)
+!6240 = !DILocation(line: 10820, column: 32, scope: !6229)
+!6241 = !DILocation(line: 10820, column: 16, scope: !6229)
+!6242 = !DILocation(line: 10821, column: 9, scope: !6229)
+!6243 = !DILocation(line: 10823, column: 36, scope: !6229)
+!6244 = !DILocation(line: 10824, column: 8, scope: !6229)
+!6245 = !DILocation(line: 10826, column: 26, scope: !6229)
+!6246 = !DILocation(line: 10827, column: 11, scope: !6229)
+!6247 = !DILocation(line: 10828, column: 33, scope: !6229)
+!6248 = !DILocation(line: 10830, column: 21, scope: !6229)
+!6249 = distinct !{!6249, !26}
+!6250 = !DILocation(line: 10831, column: 5, scope: !6229)
+!6251 = distinct !DISubprogram(name: "kernel_271", scope: !9, file: !9, line: 10850, type: !11, scopeLine: 10850, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!6252 = !DILocation(line: 10850, column: 34, scope: !6251)
+!6253 = !DILocation(line: 10852, column: 4, scope: !6251)
+!6254 = !DILocation(line: 10852, column: 8, scope: !6251)
+!6255 = !DILocation(line: 10854, column: 7, scope: !6251)
+!6256 = !DILocation(line: 10856, column: 28, scope: !6251)
+!6257 = !DILocation(line: 10857, column: 33, scope: !6251)
+!6258 = !DILocation(line: 10857, column: 16, scope: !6251)
+!6259 = !DILocation(line: 10857, column: 16, scope: !6251)
+!6260 = !DILocation(line: 10859, column: 20, scope: !6251)
+!6261 = !DILocation(line: 10860, column: 16, scope: !6251)
+!6262 = !DILocation(line: 10861, column: 29, scope: !6251)
+!6263 = !DILocation(line: 10862, column: 29, scope: !6251)
+!6264 = !DILocation(line: 10863, column: 15, scope: !6251)
+!6265 = !DILocation(line: 10864, column: 15, scope: !6251)
+!6266 = !DILocation(line: 10865, column: 5, scope: !6251)
+!6267 = !DILocation(line: 10867, column: 31, scope: !6251)
+!6268 = !DILocation(line: 10867, column: 35, scope: !6251)
+!6269 = !DILocation(line: 10868, column: 24, scope: !6251)
+!6270 = !DILocation(line: 10869, column: 28, scope: !6251)
+!6271 = !DILocation(line: 10870, column: 14, scope: !6251)
+!6272 = distinct !DISubprogram(name: "kernel_272", scope: !2, file: !2, line: 10890, type: !11, scopeLine: 10890, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!6273 = !DILocation(line: 10891, column: 5, scope: !6272)
+!6274 = !DILocation(line: 10891, column: 36, scope: !6272)
+!6275 = !DILocation(line: 10893, column: 35, scope: !6272)
+!6276 = !DILocation(line: 10895, column: 4, scope: !6272)
+!6277 = !DILocation(line: 10897, column: 32, scope: !6272)
+!6278 = !DILocation(line: 10899, column: 10, scope: !6272)
+!6279 = !DILocation(line: 10900, column: 9, scope: !6272)
+!6280 = !DILocation(line: 10901, column: 31, scope: !6272)
+!6281 = !DILocation(line: 10902, column: 14, scope: !6272)
+!6282 = !DILocation(line: 10903, column: 33, scope: !6272)
+!6283 = !DILocation(line: 10905, column: 20, scope: !6272)
+!6284 = !DILocation(line: 10907, column: 12, scope: !6272)
+!6285 = !DILocation(line: 10909, column: 3, scope: !6272)
+!6286 = !DILocation(line: 10910, column: 6, scope: !6272)
+!6287 = !DILocation(line: 10910, column: 11, scope: !6272)
+!6288 = !DILocation(line: 10911, column: 31, scope: !6272)
+!6289 = !DILocation(line: 10912, column: 10, scope: !6272)
+!6290 = !DILocation(line: 10913, column: 19, scope: !6272)
+!6291 = !DILocation(line: 10913, column: 12, scope: !6272)
+!6292 = !DILocation(line: 10915, column: 17, scope: !6272)
+!6293 = distinct !DISubprogram(name: "kernel_273", scope: !3, file: !3, line: 10930, type: !11, scopeLine: 10930, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!6294 = !DILocation(line: 10931, column: 12, scope: !6293)
+!6295 = !DILocation(line: 10933, column: 40, scope: !6293)
+!6296 = !DILocation(line: 10934, column: 4, scope: !6293)
+!6297 = !DILocation(line: 10934, column: 14, scope: !6293)
+!6298 = !DILocation(line: 10935, column: 24, scope: !6293)
+!6299 = !DILocation(line: 10935, column: 25, scope: !6293)
+!6300 = !DILocation(line: 10935, column: 36, scope: !6293)
+!6301 = !DILocation(line: 10936, column: 39, scope: !6293)
+!6302 = !DILocation(line: 10936, column: 21, scope: !6293)
+!6303 = !DILocation(line: 10937, column: 7, scope: !6293)
+!6304 = !DILocation(line: 10939, column: 24, scope: !6293)
+!6305 = !DILocation(line: 10940, column: 21, scope: !6293)
+!6306 = !DILocation(line: 10941, column: 8, scope: !6293)
+!6307 = !DILocation(line: 10942, column: 8, scope: !6293)
+!6308 = !DILocation(line: 10944, column: 18, scope: !6293)
+!6309 = !DILocation(line: 10946, column: 34, scope: !6293)
+!6310 = !DILocation(line: 10948, column: 3, scope: !6293)
+!6311 = !DILocation(line: 10950, column: 11, scope: !6293)
+!6312 = !DILocation(line: 10952, column: 20, scope: !6293)
+!6313 = !DILocation(line: 10952, column: 18, scope: !6293)
+!6314 = !DILocation(line: 10952, column: 37, scope: !6293)
+!6315 = !DILocation(line: 10953, column: 5, scope: !6293)
+!6316 = !DILocation(line: 10954, column: 13, scope: !6293)
+!6317 = !DILocation(line: 10954, column: 10, scope: !6293)
+!6318 = !DILocation(line: 10955, column: 36, scope: !6293)
+!6319 = !DILocation(line: 10956, column: 28, scope: !6293)
+!6320 = !DILocation(line: 10957, column: 23, scope: !6293)
+!6321 = !DILocation(line: 10958, column: 14, scope: !6293)
+!6322 = !DILocation(line: 10958, column: 40, scope: !6293)
+!6323 = distinct !DISubprogram(name: "kernel_274", scope: !4, file: !4, line: 10970, type: !11, scopeLine: 10970, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!6324 = !DILocation(line: 10971, column: 25, scope: !6323)
+!6325 = !DILocation(line: 10972, column: 22, scope: !6323)
+!6326 = !DILocation(line: 10973, column: 36, scope: !6323)
+!6327 = !DILocation(line: 10974, column: 16, scope: !6323)
+!6328 = !DILocation(line: 10976, column: 18, scope: !6323)
+!6329 = !DILocation(line: 10976, column: 27, scope: !6323)
+!6330 = !DILocation(line: 10976, column: 10, scope: !6323)
+!6331 = !DILocation(line: 10976, column: 23, scope: !6323)
+!6332 = !DILocation(line: 10976, column: 13, scope: !6323)
+!6333 = !DILocation(line: 10977, column: 36, scope: !6323)
+!6334 = !DILocation(line: 10978, column: 36, scope: !6323)
+!6335 = !DILocation(line: 10980, column: 14, scope: !6323)
+!6336 = !DILocation(line: 10982, column: 20, scope: !6323)
+!6337 = !DILocation(line: 10983, column: 20, scope: !6323)
+!6338 = !DILocation(line: 10984, column: 15, scope: !6323)
+!6339 = !DILocation(line: 10986, column: 32, scope: !6323)
+!6340 = !DILocation(line: 10988, column: 34, scope: !6323)
+!6341 = distinct !DISubprogram(name: "kernel_275", scope: !5, file: !5, line: 11010, type: !11, scopeLine: 11010, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!6342 = !DILocation(line: 11011, column: 17, scope: !6341)
+!6343 = !DILocation(line: 11013, column: 39, scope: !6341)
+!6344 = !DILocation(line: 11013, column: 5, scope: !6341)
+!6345 = !DILocation(line: 11014, column: 38, scope: !6341)
+!6346 = !DILocation(line: 11016, column: 28, scope: !6341)
+!6347 = !DILocation(line: 11018, column: 35, scope: !6341)
+!6348 = !DILocation(line: 11019, column: 24, scope: !6341)
+!6349 = !DILocation(line: 11021, column: 23, scope: !6341)
+!6350 = !DILocation(line: 11022, column: 29, scope: !6341)
+!6351 = !DILocation(line: 11023, column: 21, scope: !6341)
+!6352 = !DILocation(line: 11025, column: 16, scope: !6341)
+!6353 = !DILocation(line: 11027, column: 25, scope: !6341)
+!6354 = !DILocation(line: 11029, column: 9, scope: !6341)
+!6355 = !DILocation(line: 11031, column: 22, scope: !6341)
+!6356 = !DILocation(line: 11032, column: 37, scope: !6341)
+!6357 = !DILocation(line: 11032, column: 22, scope: !6341)
+!6358 = !DILocation(line: 11032, column: 8, scope: !6341)
+!6359 = !DILocation(line: 11032, column: 31, scope: !6341)
+!6360 = !DILocation(line: 11032, column: 29, scope: !6341)
+!6361 = distinct !{!6361, !26}
+!6362 = !DILocation(line: 11034, column: 30, scope: !6341)
+!6363 = distinct !DISubprogram(name: "kernel_276", scope: !6, file: !6, line: 11050, type: !11, scopeLine: 11050, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!6364 = !DILocation(line: 11052, column: 23, scope: !6363)
+!6365 = !DILocation(line: 11052, column: 12, scope: !6363)
+!6366 = !DILocation(line: 11052, column: 25, scope: !6363)
+!6367 = !DILocation(line: 11052, column: 24, scope: !6363)
+!6368 = !DILocation(line: 11053, column: 33, scope: !6363)
+!6369 = !DILocation(line: 11054, column: 6, scope: !6363)
+!6370 = !DILocation(line: 11055, column: 6, scope: !6363)
+!6371 = !DILocation(line: 11057, column: 35, scope: !6363)
+!6372 = !DILocation(line: 11059, column: 21, scope: !6363)
+!6373 = !DILocation(line: 11061, column: 36, scope: !6363)
+!6374 = !DILocation(line: 11061, column: 38, scope: !6363)
+!6375 = !DILocation(line: 11061, column: 4, scope: !6363)
+!6376 = !DILocation(line: 11061, column: 25, scope: !6363)
+!6377 = !DILocation(line: 11062, column: 4, scope: !6363)
+!6378 = !DILocation(line: 11064, column: 33, scope: !6363)
+!6379 = !DILocation(line: 11065, column: 29, scope: !6363)
+!6380 = !DILocation(line: 11066, column: 35, scope: !6363)
+!6381 = !DILocation(line: 11067, column: 15, scope: !6363)
+!6382 = !DILocation(line: 11068, column: 36, scope: !6363)
+!6383 = !DILocation(line: 11068, column: 4, scope: !6363)
+!6384 = distinct !DISubprogram(name: "kernel_277", scope: !7, file: !7, line: 11090, type: !11, scopeLine: 11090, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!6385 = !DILocation(line: 11092, column: 20, scope: !6384)
+!6386 = !DILocation(line: 11093, column: 36, scope: !6384)
+!6387 = !DILocation(line: 11095, column: 40, scope: !6384)
+!6388 = !DILocation(line: 11096, column: 24, scope: !6384)
+!6389 = !DILocation(line: 11098, column: 7, scope: !6384)
+!6390 = !DILocation(line: 11100, column: 31, scope: !6384)
+!6391 = !DILocation(line: 11102, column: 16, scope: !6384)
+!6392 = !DILocation(line: 11103, column: 30, scope: !6384)
+!6393 = !DILocation(line: 11103, column: 37, scope: !6384)
+!6394 = !DILocation(line: 11105, column: 3, scope: !6384)
+!6395 = !DILocation(line: 11106, column: 38, scope: !6384)
+!6396 = !DILocation(line: 11106, column: 36, scope: !6384)
+!6397 = !DILocation(line: 11107, column: 14, scope: !6384)
+!6398 = !DILocation(line: 11109, column: 24, scope: !6384)
+!6399 = !DILocation(line: 11111, column: 33, scope: !6384)
+!6400 = !DILocation(line: 11111, column: 27, scope: !6384)
+!6401 = distinct !DISubprogram(name: "kernel_278", scope: !8, file: !8, line: 11130, type: !11, scopeLine: 11130, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!6402 = !DILocation(line: 11132, column: 33, scope: !6401)
+!6403 = !DILocation(line: 11133, column: 16, scope: !6401)
+!6404 = !DILocation(line: 11134, column: 20, scope: !6401)
+!6405 = !DILocation(line: 11135, column: 29, scope: !6401)
+!6406 = !DILocation(line: 11135, column: 29, scope: !6401)
+!6407 = !DILocation(line: 11136, column: 21, scope: !6401)
+!6408 = !DILocation(line: 11136, column: 11, scope: !6401)
+!6409 = !DILocation(line: 11137, column: 12, scope: !6401)
+!6410 = !DILocation(line: 11139, column: 29, scope: !6401)
+!6411 = !DILocation(line: 11140, column: 27, scope: !6401)
+!6412 = !DILocation(line: 11141, column: 26, scope: !6401)
+!6413 = !DILocation(line: 11143, column: 4, scope: !6401)
+!6414 = !DILocation(line: 11145, column: 15, scope: !6401)
+!6415 = !DILocation(line: 11146, column: 3, scope: !6401)
+!6416 = !DILocation(line: 11148, column: 10, scope: !6401)
+!6417 = !DILocation(line: 11149, column: 23, scope: !6401)
+!6418 = !DILocation(line: 11150, column: 23, scope: !6401)
+!6419 = !DILocation(line: 11152, column: 24, scope: !6401)
+!6420 = !DILocation(line: 11152, column: 9, scope: !6401)
+!6421 = !DILocation(line: 11153, column: 7, scope: !6401)
+!6422 = !DILocation(line: 11155, column: 23, scope: !6401)
+!6423 = !DILocation(line: 11155, column: 27, scope: !6401)
+!6424 = !DILocation(line: 11157, column: 39, scope: !6401)
+!6425 = !DILocation(line: 11157, column: 32, scope: !6401)
+!6426 = !DILocation(line: 11158, column: 33, scope: !6401)
+!6427 = !DILocation(line: 11160, column: 40, scope: !6401)
+!6428 = !DILocation(line: 11161, column: 18, scope: !6401)
+!6429 = !DILocation(line: 11161, column: 4, scope: !6401)
+!6430 = !DILocation(line: 11162, column: 3, scope: !6401)
+!6431 = !DILocation(line: 11162, column: 7, scope: !6401)
+!6432 = !DILocation(line: 11164, column: 20, scope: !6401)
+!6433 = !DILocation(line: 11165, column: 30, scope: !6401)
+!6434 = !DILocation(line: 11166, column: 25, scope: !6401)
+!6435 = !DILocation(line: 11168, column: 4, scope: !6401)
+!6436 = !DILocation(line: 11169, column: 10, scope: !6401)
+!6437 = !DILocation(line: 11169, column: 11, scope: !6401)
+!6438 = !DILocation(line: 11170, column: 34, scope: !6401)
+!6439 = !DILocation(line: 11170, column: 24, scope: !6401)
+!6440 = !DILocation(line: 11171, column: 25, scope: !6401)
+!6441 = !DILocation(line: 11172, column: 35, scope: !6401)
+!6442 = !DILocation(line: 11174, column: 21, scope: !6401)
+!6443 = !DILocation(line: 11174, column: 36, scope: !6401)
+!6444 = !DILocation(line: 11175, column: 33, scope: !6401)
+!6445 = !DILocation(line: 11176, column: 25, scope: !6401)
+!6446 = !DILocation(line: 11177, column: 39, scope: !6401)
+!6447 = !DILocation(line: 11178, column: 5, scope: !6401)
+!6448 = !DILocation(line: 11178, column: 13, scope: !6401)
+!6449 = distinct !DISubprogram(name: "kernel_279", scope: !9, file: !9, line: 11170, type: !11, scopeLine: 11170, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!6450 = !DILocation(line: 11172, column: 8, scope: !6449)
+!6451 = !DILocation(line: 11173, column: 13, scope: !6449)
+!6452 = !DILocation(line: 11174, column: 34, scope: !6449)
+!6453 = !DILocation(line: 11176, column: 12, scope: !6449)
+!6454 = !DILocation(line: 11177, column: 35, scope: !6449)
+!6455 = !DILocation(line: 11178, column: 19, scope: !6449)
+!6456 = !DILocation(line: 11180, column: 38, scope: !6449)
+!6457 = !DILocation(line: 11181, column: 34, scope: !6449)
+!6458 = !DILocation(line: 11182, column: 31, scope: !6449)
+!6459 = !DILocation(line: 11183, column: 18, scope: !6449)
+!6460 = !DILocation(line: 11184, column: 11, scope: !6449)
+!6461 = !DILocation(line: 11185, column: 36, scope: !6449)
+!6462 = !DILocation(line: 11187, column: 10, scope: !6449)
+!6463 = !DILocation(line: 11189, column: 38, scope: !6449)
+!6464 = !DILocation(line: 11190, column: 6, scope: !6449)
+!6465 = !DILocation(line: 11191, column: 16, scope: !6449)
+!6466 = distinct !DISubprogram(name: "kernel_280", scope: !2, file: !2, line: 11210, type: !11, scopeLine: 11210, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!6467 = !DILocation(line: 11210, column: 8, scope: !6466)
+!6468 = !DILocation(line: 11211, column: 36, scope: !6466)
+!6469 = !DILocation(line: 11212, column: 11, scope: !6466)
+!6470 = !DILocation(line: 11214, column: 17, scope: !6466)
+!6471 = !DILocation(line: 11215, column: 31, scope: !6466)
+!6472 = !DILocation(line: 11216, column: 34, scope: !6466)
+!6473 = !DILocation(line: 11218, column: 15, scope: !6466)
+!6474 = !DILocation(line: 11219, column: 18, scope: !6466)
+!6475 = !DILocation(line: 11221, column: 39, scope: !6466)
+!6476 = !DILocation(line: 11221, column: 24, scope: !6466)
+!6477 = !DILocation(line: 11222, column: 35, scope: !6466)
+!6478 = !DILocation(line: 11223, column: 12, scope: !6466)
+!6479 = !DILocation(line: 11224, column: 24, scope: !6466)
+!6480 = !DILocation(line: 11225, column: 17, scope: !6466)
+!6481 = !DILocation(line: 11226, column: 12, scope: !6466)
+!6482 = !DILocation(line: 11228, column: 32, scope: !6466)
+!6483 = !DILocation(line: 11229, column: 4, scope: !6466)
+!6484 = !DILocation(line: 11230, column: 33, scope: !6466)
+!6485 = !DILocation(line: 11230, column: 31, scope: !6466)
+!6486 = distinct !{!6486, !26}
+!6487 = !DILocation(line: 11231, column: 4, scope: !6466)
+!6488 = distinct !DISubprogram(name: "kernel_281", scope: !3, file: !3, line: 11250, type: !11, scopeLine: 11250, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!6489 = !DILocation(line: 11251, column: 31, scope: !6488)
+!6490 = !DILocation(line: 11252, column: 26, scope: !6488)
+!6491 = !DILocation(line: 11253, column: 36, scope: !6488)
+!6492 = !DILocation(line: 11255, column: 31, scope: !6488)
+!6493 = !DILocation(line: 11256, column: 39, scope: !6488)
+!6494 = !DILocation(line: 11257, column: 24, scope: !6488)
+!6495 = !DILocation(line: 11257, column: 27, scope: !6488)
+!6496 = !DILocation(line: 11257, column: 15, scope: !6488)
+!6497 = !DILocation(line: 11257, column: 39, scope: !6488)
+!6498 = !DILocation(line: 11259, column: 21, scope: !6488)
+!6499 = !DILocation(line: 11259, column: 35, scope: !6488)
+!6500 = !DILocation(line: 11260, column: 21, scope: !6488)
+!6501 = !DILocation(line: 11261, column: 28, scope: !6488)
+!6502 = !DILocation(line: 11262, column: 12, scope: !6488)
+!6503 = !DILocation(line: 11262, column: 7, scope: !6488)
+!6504 = !DILocation(line: 11263, column: 9, scope: !6488)
+!6505 = !DILocation(line: 11264, column: 34, scope: !6488)
+!6506 = !DILocation(line: 11265, column: 34, scope: !6488)
+!6507 = !DILocation(line: 11266, column: 4, scope: !6488)
+!6508 = !DILocation(line: 11266, column: 38, scope: !6488)
+!6509 = distinct !DISubprogram(name: "kernel_282", scope: !4, file: !4, line: 11290, type: !11, scopeLine: 11290, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!6510 = !DILocation(line: 11291, column: 31, scope: !6509)
+!6511 = !DILocation(line: 11291, column: 35, scope: !6509)
+!6512 = !DILocation(line: 11292, column: 13, scope: !6509)
+!6513 = !DILocation(line: 11293, column: 39, scope: !6509)
+!6514 = !DILocation(line: 11294, column: 39, scope: !6509)
+!6515 = !DILocation(line: 11295, column: 7, scope: !6509)
+!6516 = !DILocation(line: 11297, column: 23, scope: !6509)
+!6517 = !DILocation(line: 11297, column: 29, scope: !6509)
+!6518 = !DILocation(line: 11299, column: 16, scope: !6509)
+!6519 = !DILocation(line: 11300, column: 30, scope: !6509)
+!6520 = !DILocation(line: 11301, column: 4, scope: !6509)
+!6521 = !DILocation(line: 11302, column: 9, scope: !6509)
+!6522 = !DILocation(line: 11302, column: 23, scope: !6509)
+!6523 = !DILocation(line: 11304, column: 34, scope: !6509)
+!6524 = !DILocation(line: 11305, column: 12, scope: !6509)
+!6525 = !DILocation(line: 11306, column: 20, scope: !6509)
+!6526 = !DILocation(line: 11307, column: 25, scope: !6509)
+!6527 = !DILocation(line: 11308, column: 10, scope: !6509)
+!6528 = distinct !DISubprogram(name: "kernel_283", scope: !5, file: !5, line: 11330, type: !11, scopeLine: 11330, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!6529 = !DILocation(line: 11331, column: 14, scope: !6528)
+!6530 = !DILocation(line: 11333, column: 18, scope: !6528)
+!6531 = !DILocation(line: 11335, column: 29, scope: !6528)
+!6532 = !DILocation(line: 11336, column: 22, scope: !6528)
+!6533 = !DILocation(line: 11337, column: 34, scope: !6528)
+!6534 = !DILocation(line: 11339, column: 23, scope: !6528)
+!6535 = !DILocation(line: 11340, column: 4, scope: !6528)
+!6536 = !DILocation(line: 11342, column: 40, scope: !6528)
+!6537 = !DILocation(line: 11342, column: 14, scope: !6528)
+!6538 = !DILocation(line: 11343, column: 37, scope: !6528)
+!6539 = !DILocation(line: 11344, column: 23, scope: !6528)
+!6540 = !DILocation(line: 11345, column: 29, scope: !6528)
+!6541 = !DILocation(line: 11345, column: 9, scope: !6528)
+!6542 = !DILocation(line: 11346, column: 16, scope: !6528)
+!6543 = !DILocation(line: 11346, column: 11, scope: !6528)
+!6544 = !DILocation(line: 11347, column: 34, scope: !6528)
+!6545 = !DILocation(line: 11347, column: 28, scope: !6528)
+!6546 = !DILocation(line: 11349, column: 17, scope: !6528)
+!6547 = !DILocation(line: 11350, column: 10, scope: !6528)
+!6548 = !DILocation(line: 11351, column: 21, scope: !6528)
+!6549 = !DILocation(line: 11352, column: 25, scope: !6528)
+!6550 = !DILocation(line: 11354, column: 32, scope: !6528)
+!6551 = !DILocation(line: 11356, column: 15, scope: !6528)
+!6552 = !DILocation(line: 11356, column: 40, scope: !6528)
+!6553 = !DILocation(line: 11358, column: 40, scope: !6528)
+!6554 = !DILocation(line: 11360, column: 13, scope: !6528)
+!6555 = distinct !DISubprogram(name: "kernel_284", scope: !6, file: !6, line: 11370, type: !11, scopeLine: 11370, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!6556 = !DILocation(line: 11372, column: 40, scope: !6555)
+!6557 = !DILocation(line: 11373, column: 40, scope: !6555)
+!6558 = !DILocation(line: 11374, column: 15, scope: !6555)
+!6559 = !DILocation(line: 11375, column: 31, scope: !6555)
+!6560 = !DILocation(line: 11377, column: 25, scope: !6555)
+!6561 = !DILocation(line: 11379, column: 8, scope: !6555)
+!6562 = !DILocation(line: 11380, column: 14, scope: !6555)
+!6563 = !DILocation(line: 11381, column: 8, scope: !6555)
+!6564 = !DILocation(line: 11382, column: 9, scope: !6555)
+!6565 = !DILocation(line: 11382, column: 39, scope: !6555)
+!6566 = !DILocation(line: 11382, column: 24, scope: !6555)
+!6567 = !DILocation(line: 11383, column: 18, scope: !6555)
+!6568 = !DILocation(line: 11383, column: 10, scope: !6555)
+!6569 = !DILocation(line: 11384, column: 26, scope: !6555)
+!6570 = !DILocation(line: 11384, column: 20, scope: !6555)
+!6571 = !DILocation(line: 11386, column: 30, scope: !6555)
+!6572 = !DILocation(line: 11386, column: 17, scope: !6555)
+!6573 = distinct !DISubprogram(name: "kernel_285", scope: !7, file: !7, line: 11410, type: !11, scopeLine: 11410, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!6574 = !DILocation(line: 11411, column: 6, scope: !6573)
+!6575 = !DILocation(line: 11412, column: 9, scope: !6573)
+!6576 = !DILocation(line: 11413, column: 32, scope: !6573)
+!6577 = !DILocation(line: 11414, column: 35, scope: !6573)
+!6578 = !DILocation(line: 11415, column: 40, scope: !6573)
+!6579 = !DILocation(line: 11416, column: 30, scope: !6573)
+!6580 = !DILocation(line: 11416, column: 4, scope: !6573)
+!6581 = !DILocation(line: 11418, column: 38, scope: !6573)
+!6582 = !DILocation(line: 11419, column: 11, scope: !6573)
+!6583 = !DILocation(line: 11419, column: 19, scope: !6573)
+!6584 = !DILocation(line: 11421, column: 11, scope: !6573)
+!6585 = !DILocation(line: 11422, column: 39, scope: !6573)
+!6586 = !DILocation(line: 11423, column: 9, scope: !6573)
+!6587 = !DILocation(line: 11423, column: 19, scope: !6573)
+!6588 = !DILocation(line: 11425, column: 18, scope: !6573)
+!6589 = !DILocation(line: 11426, column: 37, scope: !6573)
+!6590 = !DILocation(line: 11428, column: 21, scope: !6573)
+!6591 = !DILocation(line: 11429, column: 32, scope: !6573)
+!6592 = !DILocation(line: 11430, column: 8, scope: !6573)
+!6593 = distinct !{!6593, !26}
+!6594 = !DILocation(line: 11431, column: 20, scope: !6573)
+!6595 = distinct !DISubprogram(name: "kernel_286", scope: !8, file: !8, line: 11450, type: !11, scopeLine: 11450, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!6596 = !DILocation(line: 11450, column: 18, scope: !6595)
+!6597 = !DILocation(line: 11451, column: 28, scope: !6595)
+!6598 = !DILocation(line: 11452, column: 22, scope: !6595)
+!6599 = !DILocation(line: 11454, column: 31, scope: !6595)
+!6600 = !DILocation(line: 11454, column: 12, scope: !6595)
+!6601 = !DILocation(line: 11456, column: 16, scope: !6595)
+!6602 = !DILocation(line: 11457, column: 26, scope: !6595)
+!6603 = !DILocation(line: 11457, column: 14, scope: !6595)
+!6604 = !DILocation(line: 11458, column: 40, scope: !6595)
+!6605 = !DILocation(line: 11459, column: 13, scope: !6595)
+!6606 = !DILocation(line: 11459, column: 23, scope: !6595)
+!6607 = !DILocation(line: 11460, column: 20, scope: !6595)
+!6608 = !DILocation(line: 11461, column: 27, scope: !6595)
+!6609 = !DILocation(line: 11461, column: 15, scope: !6595)
+!6610 = !DILocation(line: 11463, column: 29, scope: !6595)
+!6611 = !DILocation(line: 11464, column: 34, scope: !6595)
+!6612 = !DILocation(line: 11466, column: 16, scope: !6595)
+!6613 = !DILocation(line: 11467, column: 22, scope: !6595)
+!6614 = !DILocation(line: 11468, column: 20, scope: !6595)
+!6615 = !DILocation(line: 11470, column: 4, scope: !6595)
+!6616 = distinct !DISubprogram(name: "kernel_287", scope: !9, file: !9, line: 11490, type: !11, scopeLine: 11490, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!6617 = !DILocation(line: 11490, column: 16, scope: !6616)
+!6618 = !DILocation(line: 11490, column: 39, scope: !6616)
+!6619 = !DILocation(line: 11491, column: 28, scope: !6616)
+!6620 = !DILocation(line: 11493, column: 11, scope: !6616)
+!6621 = !DILocation(line: 11494, column: 19, scope: !6616)
+!6622 = !DILocation(line: 11496, column: 17, scope: !6616)
+!6623 = !DILocation(line: 11498, column: 37, scope: !6616)
+!6624 = !DILocation(line: 11499, column: 34, scope: !6616)
+!6625 = !DILocation(line: 11499, column: 19, scope: !6616)
+!6626 = !DILocation(line: 11499, column: 23, scope: !6616)
+!6627 = !DILocation(line: 11501, column: 16, scope: !6616)
+!6628 = !DILocation(line: 11503, column: 35, scope: !6616)
+!6629 = !DILocation(line: 11505, column: 21, scope: !6616)
+!6630 = !DILocation(line: 11507, column: 40, scope: !6616)
+!6631 = !DILocation(line: 11508, column: 30, scope: !6616)
+!6632 = !DILocation(line: 11508, column: 18, scope: !6616)
+!6633 = !DILocation(line: 11508, column: 15, scope: !6616)
+!6634 = !DILocation(line: 11509, column: 6, scope: !6616)
+!6635 = distinct !DISubprogram(name: "kernel_288", scope: !2, file: !2, line: 11530, type: !11, scopeLine: 11530, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!6636 = !DILocation(line: 11531, column: 3, scope: !6635)
+!6637 = !DILocation(line: 11533, column: 25, scope: !6635)
+!6638 = !DILocation(line: 11533, column: 19, scope: !6635)
+!6639 = !DILocation(line: 11534, column: 7, scope: !6635)
+!6640 = !DILocation(line: 11534, column: 9, scope: !6635)
+!6641 = !DILocation(line: 11535, column: 37, scope: !6635)
+!6642 = !DILocation(line: 11535, column: 12, scope: !6635)
+!6643 = !DILocation(line: 11536, column: 7, scope: !6635)
+!6644 = !DILocation(line: 11538, column: 9, scope: !6635)
+!6645 = !DILocation(line: 11538, column: 15, scope: !6635)
+!6646 = !DILocation(line: 11539, column: 13, scope: !6635)
+!6647 = !DILocation(line: 11541, column: 32, scope: !6635)
+!6648 = !DILocation(line: 11543, column: 16, scope: !6635)
+!6649 = !DILocation(line: 11543, column: 12, scope: !6635)
+!6650 = !DILocation(line: 11543, column: 17, scope: !6635)
+!6651 = !DILocation(line: 11545, column: 36, scope: !6635)
+!6652 = !DILocation(line: 11545, column: 37, scope: !6635)
+!6653 = !DILocation(line: 11545, column: 35, scope: !6635)
+!6654 = !DILocation(line: 11547, column: 13, scope: !6635)
+!6655 = !DILocation(line: 11549, column: 9, scope: !6635)
+!6656 = !DILocation(line: 11549, column: 28, scope: !6635)
+!6657 = !DILocation(line: 11550, column: 31, scope: !6635)
+!6658 = !DILocation(line: 11551, column: 36, scope: !6635)
+!6659 = !DILocation(line: 11553, column: 4, scope: !6635)
+!6660 = !DILocation(line: 11553, column: 23, scope: !6635)
+!6661 = !DILocation(line: 11555, column: 31, scope: !6635)
+!6662 = !DILocation(line: 11557, column: 26, scope: !6635)
+!6663 = !DILocation(line: 11559, column: 17, scope: !6635)
+!6664 = !DILocation(line: 11560, column: 15, scope: !6635)
+!6665 = !DILocation(line: 11561, column: 9, scope: !6635)
+!6666 = !DILocation(line: 11562, column: 29, scope: !6635)
+!6667 = !DILocation(line: 11562, column: 14, scope: !6635)
+!6668 = !DILocation(line: 11563, column: 24, scope: !6635)
+!6669 = !DILocation(line: 11563, column: 23, scope: !6635)
+!6670 = !DILocation(line: 11564, column: 28, scope: !6635)
+!6671 = !DILocation(line: 11565, column: 14, scope: !6635)
+!6672 = !DILocation(line: 11566, column: 7, scope: !6635)
+!6673 = !DILocation(line: 11568, column: 33, scope: !6635)
+!6674 = !DILocation(line: 11569, column: 8, scope: !6635)
+!6675 = !DILocation(line: 11569, column: 16, scope: !6635)
+!6676 = !DILocation(line: 11571, column: 21, scope: !6635)
+!6677 = !DILocation(line: 11571, column: 9, scope: !6635)
+!6678 = !DILocation(line: 11572, column: 3, scope: !6635)
+!6679 = !DILocation(line: 11572, column: 20, scope: !6635)
+!6680 = !DILocation(line: 11573, column: 39, scope: !6635)
+!6681 = !DILocation(line: 11575, column: 11, scope: !6635)
+!6682 = !DILocation(line: 11575, column: 30, scope: !6635)
+!6683 = distinct !DISubprogram(name: "kernel_289", scope: !3, file: !3, line: 11570, type: !11, scopeLine: 11570, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!6684 = !DILocation(line: 11572, column: 10, scope: !6683)
+!6685 = !DILocation(line: 11574, column: 6, scope: !6683)
+!6686 = !DILocation(line: 11575, column: 17, scope: !6683)
+!6687 = !DILocation(line: 11576, column: 36, scope: !6683)
+!6688 = !DILocation(line: 11578, column: 38, scope: !6683)
+!6689 = !DILocation(line: 11579, column: 34, scope: !6683)
+!6690 = !DILocation(line: 11580, column: 29, scope: !6683)
+!6691 = !DILocation(line: 11581, column: 19, scope: !6683)
+!6692 = !DILocation(line: 11582, column: 20, scope: !6683)
+!6693 = !DILocation(line: 11583, column: 33, scope: !6683)
+!6694 = !DILocation(line: 11584, column: 8, scope: !6683)
+!6695 = !DILocation(line: 11586, column: 26, scope: !6683)
+!6696 = !DILocation(line: 11587, column: 33, scope: !6683)
+!6697 = !DILocation(line: 11588, column: 35, scope: !6683)
+!6698 = !DILocation(line: 11590, column: 9, scope: !6683)
+!6699 = !DILocation(line: 11592, column: 7, scope: !6683)
+!6700 = distinct !DISubprogram(name: "kernel_290", scope: !4, file: !4, line: 11610, type: !11, scopeLine: 11610, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!6701 = !DILocation(line: 11611, column: 38, scope: !6700)
+!6702 = !DILocation(line: 11611, column: 26, scope: !6700)
+!6703 = !DILocation(line: 11612, column: 3, scope: !6700)
+!6704 = !DILocation(line: 11613, column: 38, scope: !6700)
+!6705 = !DILocation(line: 11614, column: 13, scope: !6700)
+!6706 = !DILocation(line: 11615, column: 20, scope: !6700)
+!6707 = !DILocation(line: 11617, column: 32, scope: !6700)
+!6708 = !DILocation(line: 11617, column: 14, scope: !6700)
+!6709 = !DILocation(line: 11619, column: 39, scope: !6700)
+!6710 = !DILocation(line: 11619, column: 35, scope: !6700)
+!6711 = !DILocation(line: 11620, column: 38, scope: !6700)
+!6712 = !DILocation(line: 11622, column: 4, scope: !6700)
+!6713 = !DILocation(line: 11623, column: 3, scope: !6700)
+!6714 = !DILocation(line: 11625, column: 6, scope: !6700)
+!6715 = !DILocation(line: 11625, column: 6, scope: !6700)
+!6716 = !DILocation(line: 11626, column: 19, scope: !6700)
+!6717 = !DILocation(line: 11628, column: 29, scope: !6700)
+!6718 = !DILocation(line: 11630, column: 14, scope: !6700)
+!6719 = !DILocation(line: 11630, column: 35, scope: !6700)
+!6720 = distinct !{!6720, !26}
+!6721 = !DILocation(line: 11631, column: 8, scope: !6700)
+!6722 = distinct !DISubprogram(name: "kernel_291", scope: !5, file: !5, line: 11650, type: !11, scopeLine: 11650, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!6723 = !DILocation(line: 11651, column: 30, scope: !6722)
+!6724 = !DILocation(line: 11653, column: 39, scope: !6722)
+!6725 = !DILocation(line: 11653, column: 32, scope: !6722)
+!6726 = !DILocation(line: 11654, column: 26, scope: !6722)
+!6727 = !DILocation(line: 11655, column: 29, scope: !6722)
+!6728 = !DILocation(line: 11657, column: 13, scope: !6722)
+!6729 = !DILocation(line: 11659, column: 38, scope: !6722)
+!6730 = !DILocation(line: 11661, column: 39, scope: !6722)
+!6731 = !DILocation(line: 11663, column: 35, scope: !6722)
+!6732 = !DILocation(line: 11663, column: 12, scope: !6722)
+!6733 = !DILocation(line: 11663, column: 31, scope: !6722)
+!6734 = !DILocation(line: 11665, column: 14, scope: !6722)
+!6735 = !DILocation(line: 11666, column: 37, scope: !6722)
+!6736 = !DILocation(line: 11666, column: 39, scope: !6722)
+!6737 = !DILocation(line: 11667, column: 5, scope: !6722)
+!6738 = !DILocation(line: 11668, column: 37, scope: !6722)
+!6739 = !DILocation(line: 11669, column: 24, scope: !6722)
+!6740 = !DILocation(line: 11670, column: 12, scope: !6722)
+!6741 = !DILocation(line: 11670, column: 6, scope: !6722)
+!6742 = !DILocation(line: 11670, column: 32, scope: !6722)
+!6743 = distinct !DISubprogram(name: "kernel_292", scope: !6, file: !6, line: 11690, type: !11, scopeLine: 11690, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!6744 = !DILocation(line: 11692, column: 7, scope: !6743)
+!6745 = !DILocation(line: 11692, column: 32, scope: !6743)
+!6746 = !DILocation(line: 11693, column: 13, scope: !6743)
+!6747 = !DILocation(line: 11693, column: 28, scope: !6743)
+!6748 = !DILocation(line: 11695, column: 13, scope: !6743)
+!6749 = !DILocation(line: 11697, column: 26, scope: !6743)
+!6750 = !DILocation(line: 11698, column: 10, scope: !6743)
+!6751 = !DILocation(line: 11700, column: 25, scope: !6743)
+!6752 = !DILocation(line: 11701, column: 4, scope: !6743)
+!6753 = !DILocation(line: 11702, column: 13, scope: !6743)
+!6754 = !DILocation(line: 11703, column: 29, scope: !6743)
+!6755 = !DILocation(line: 11704, column: 40, scope: !6743)
+!6756 = !DILocation(line: 11706, column: 11, scope: !6743)
+!6757 = !DILocation(line: 11708, column: 22, scope: !6743)
+!6758 = !DILocation(line: 11708, column: 24, scope: !6743)
+!6759 = !DILocation(line: 11710, column: 12, scope: !6743)
+!6760 = !DILocation(line: 11712, column: 40, scope: !6743)
+!6761 = !DILocation(line: 11714, column: 38, scope: !6743)
+!6762 = distinct !DISubprogram(name: "kernel_293", scope: !7, file: !7, line: 11730, type: !11, scopeLine: 11730, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!6763 = !DILocation(line: 11732, column: 4, scope: !6762)
+!6764 = !DILocation(line: 11733, column: 11, scope: !6762)
+!6765 = !DILocation(line: 11735, column: 21, scope: !6762)
+!6766 = !DILocation(line: 11737, column: 25, scope: !6762)
+!6767 = !DILocation(line: 11737, column: 32, scope: !6762)
+!6768 = !DILocation(line: 11739, column: 39, scope: !6762)
+!6769 = !DILocation(line: 11739, column: 4, scope: !6762)
+!6770 = !DILocation(line: 11739, column: 24, scope: !6762)
+!6771 = !DILocation(line: 11740, column: 18, scope: !6762)
+!6772 = !DILocation(line: 11741, column: 32, scope: !6762)
+!6773 = !DILocation(line: 11742, column: 14, scope: !6762)
+!6774 = !DILocation(line: 11742, column: 7, scope: !6762)
+!6775 = !DILocation(line: 11743, column: 22, scope: !6762)
+!6776 = !DILocation(line: 11745, column: 22, scope: !6762)
+!6777 = !DILocation(line: 11745, column: 23, scope: !6762)
+!6778 = !DILocation(line: 11746, column: 21, scope: !6762)
+!6779 = !DILocation(line: 11748, column: 19, scope: !6762)
+!6780 = !DILocation(line: 11748, column: 13, scope: !6762)
+!6781 = !DILocation(line: 11750, column: 32, scope: !6762)
+!6782 = !DILocation(line: 11751, column: 14, scope: !6762)
+!6783 = !DILocation(line: 11753, column: 22, scope: !6762)
+!6784 = !DILocation(line: 11754, column: 7, scope: !6762)
+!6785 = !DILocation(line: 11754, column: 6, scope: !6762)
+!6786 = !DILocation(line: 11755, column: 21, scope: !6762)
+!6787 = !DILocation(line: 11756, column: 36, scope: !6762)
+!6788 = !DILocation(line: 11756, column: 33, scope: !6762)
+!6789 = !DILocation(line: 11757, column: 11, scope: !6762)
+!6790 = !DILocation(line: 11757, column: 18, scope: !6762)
+!6791 = !DILocation(line: 11759, column: 28, scope: !6762)
+!6792 = !DILocation(line: 11761, column: 24, scope: !6762)
+!6793 = !DILocation(line: 11761, column: 17, scope: !6762)
+!6794 = !DILocation(line: 11762, column: 9, scope: !6762)
+!6795 = !DILocation(line: 11763, column: 32, scope: !6762)
+!6796 = !DILocation(line: 11764, column: 28, scope: !6762)
+!6797 = !DILocation(line: 11764, column: 22, scope: !6762)
+!6798 = !DILocation(line: 11764, column: 8, scope: !6762)
+!6799 = !DILocation(line: 11764, column: 27, scope: !6762)
+!6800 = !DILocation(line: 11764, column: 34, scope: !6762)
+!6801 = !DILocation(line: 11765, column: 22, scope: !6762)
+!6802 = !DILocation(line: 11766, column: 38, scope: !6762)
+!6803 = !DILocation(line: 11766, column: 11, scope: !6762)
+!6804 = !DILocation(line: 11767, column: 15, scope: !6762)
+!6805 = !DILocation(line: 11767, column: 20, scope: !6762)
+!6806 = !DILocation(line: 11768, column: 23, scope: !6762)
+!6807 = !DILocation(line: 11768, column: 4, scope: !6762)
+!6808 = !DILocation(line: 11769, column: 3, scope: !6762)
+!6809 = !DILocation(line: 11770, column: 12, scope: !6762)
+!6810 = distinct !DISubprogram(name: "kernel_294", scope: !8, file: !8, line: 11770, type: !11, scopeLine: 11770, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!6811 = !DILocation(line: 11771, column: 34, scope: !6810)
+!6812 = !DILocation(line: 11773, column: 24, scope: !6810)
+!6813 = !DILocation(line: 11773, column: 30, scope: !6810)
+!6814 = !DILocation(line: 11774, column: 16, scope: !6810)
+!6815 = !DILocation(line: 11775, column: 16, scope: !6810)
+!6816 = !DILocation(line: 11777, column: 20, scope: !6810)
+!6817 = !DILocation(line: 11779, column: 3, scope: !6810)
+!6818 = !DILocation(line: 11780, column: 12, scope: !6810)
+!6819 = !DILocation(line: 11782, column: 31, scope: !6810)
+!6820 = !DILocation(line: 11782, column: 15, scope: !6810)
+!6821 = !DILocation(line: 11782, column: 14, scope: !6810)
+!6822 = !DILocation(line: 11784, column: 19, scope: !6810)
+!6823 = !DILocation(line: 11785, column: 39, scope: !6810)
+!6824 = !DILocation(line: 11786, column: 15, scope: !6810)
+!6825 = !DILocation(line: 11786, column: 25, scope: !6810)
+!6826 = !DILocation(line: 11786, column: 30, scope: !6810)
+!6827 = !DILocation(line: 11786, column: 27, scope: !6810)
+!6828 = distinct !DISubprogram(name: "kernel_295", scope: !9, file: !9, line: 11810, type: !11, scopeLine: 11810, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!6829 = !DILocation(line: 11811, column: 30, scope: !6828)
+!6830 = !DILocation(line: 11812, column: 9, scope: !6828)
+!6831 = !DILocation(line: 11812, column: 16, scope: !6828)
+!6832 = !DILocation(line: 11814, column: 15, scope: !6828)
+!6833 = !DILocation(line: 11814, column: 29, scope: !6828)
+!6834 = !DILocation(line: 11814, column: 26, scope: !6828)
+!6835 = !DILocation(line: 11815, column: 40, scope: !6828)
+!6836 = !DILocation(line: 11817, column: 15, scope: !6828)
+!6837 = !DILocation(line: 11818, column: 23, scope: !6828)
+!6838 = !DILocation(line: 11818, column: 15, scope: !6828)
+!6839 = !DILocation(line: 11820, column: 13, scope: !6828)
+!6840 = !DILocation(line: 11821, column: 36, scope: !6828)
+!6841 = !DILocation(line: 11822, column: 25, scope: !6828)
+!6842 = !DILocation(line: 11822, column: 26, scope: !6828)
+!6843 = !DILocation(line: 11824, column: 23, scope: !6828)
+!6844 = !DILocation(line: 11824, column: 14, scope: !6828)
+!6845 = !DILocation(line: 11824, column: 3, scope: !6828)
+!6846 = !DILocation(line: 11824, column: 16, scope: !6828)
+!6847 = !DILocation(line: 11826, column: 39, scope: !6828)
+!6848 = distinct !{!6848, !26}
+!6849 = !DILocation(line: 11828, column: 27, scope: !6828)
+!6850 = distinct !DISubprogram(name: "kernel_296", scope: !2, file: !2, line: 11850, type: !11, scopeLine: 11850, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!6851 = !DILocation(line: 11852, column: 21, scope: !6850)
+!6852 = !DILocation(line: 11852, column: 4, scope: !6850)
+!6853 = !DILocation(line: 11853, column: 24, scope: !6850)
+!6854 = !DILocation(line: 11854, column: 16, scope: !6850)
+!6855 = !DILocation(line: 11855, column: 35, scope: !6850)
+!6856 = !DILocation(line: 11856, column: 36, scope: !6850)
+!6857 = !DILocation(line: 11858, column: 23, scope: !6850)
+!6858 = !DILocation(line: 11859, column: 15, scope: !6850)
+!6859 = !DILocation(line: 11861, column: 17, scope: !6850)
+!6860 = !DILocation(line: 11863, column: 11, scope: !6850)
+!6861 = !DILocation(line: 11864, column: 28, scope: !6850)
+!6862 = !DILocation(line: 11864, column: 38, scope: !6850)
+!6863 = !DILocation(line: 11864, column: 38, scope: !6850)
+!6864 = !DILocation(line: 11865, column: 12, scope: !6850)
+!6865 = !DILocation(line: 11866, column: 30, scope: !6850)
+!6866 = !DILocation(line: 11866, column: 32, scope: !6850)
+!6867 = !DILocation(line: 11868, column: 28, scope: !6850)
+!6868 = !DILocation(line: 11869, column: 19, scope: !6850)
+!6869 = !DILocation(line: 11871, column: 7, scope: !6850)
+!6870 = !DILocation(line: 11871, column: 18, scope: !6850)
+!6871 = distinct !DISubprogram(name: "kernel_297", scope: !3, file: !3, line: 11890, type: !11, scopeLine: 11890, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!6872 = !DILocation(line: 11892, column: 14, scope: !6871)
+!6873 = !DILocation(line: 11892, column: 17, scope: !6871)
+!6874 = !DILocation(line: 11894, column: 23, scope: !6871)
+!6875 = !DILocation(line: 11894, column: 22, scope: !6871)
+!6876 = !DILocation(line: 11895, column: 33, scope: !6871)
+!6877 = !DILocation(line: 11896, column: 23, scope: !6871)
+!6878 = !DILocation(line: 11897, column: 10, scope: !6871)
+!6879 = !DILocation(line: 11899, column: 8, scope: !6871)
+!6880 = !DILocation(line: 11900, column: 23, scope: !6871)
+!6881 = !DILocation(line: 11902, column: 14, scope: !6871)
+!6882 = !DILocation(line: 11903, column: 22, scope: !6871)
+!6883 = !DILocation(line: 11903, column: 6, scope: !6871)
+!6884 = !DILocation(line: 11903, column: 25, scope: !6871)
+!6885 = !DILocation(line: 11904, column: 27, scope: !6871)
+!6886 = !DILocation(line: 11904, column: 15, scope: !6871)
+!6887 = !DILocation(line: 11905, column: 30, scope: !6871)
+!6888 = distinct !DISubprogram(name: "kernel_298", scope: !4, file: !4, line: 11930, type: !11, scopeLine: 11930, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!6889 = !DILocation(line: 11930, column: 14, scope: !6888)
+!6890 = !DILocation(line: 11931, column: 38, scope: !6888)
+!6891 = !DILocation(line: 11932, column: 32, scope: !6888)
+!6892 = !DILocation(line: 11933, column: 3, scope: !6888)
+!6893 = !DILocation(line: 11934, column: 34, scope: !6888)
+!6894 = !DILocation(line: 11934, column: 19, scope: !6888)
+!6895 = !DILocation(line: 11936, column: 40, scope: !6888)
+!6896 = !DILocation(line: 11938, column: 19, scope: !6888)
+!6897 = !DILocation(line: 11939, column: 34, scope: !6888)
+!6898 = !DILocation(line: 11940, column: 35, scope: !6888)
+!6899 = !DILocation(line: 11942, column: 38, scope: !6888)
+!6900 = !DILocation(line: 11943, column: 17, scope: !6888)
+!6901 = !DILocation(line: 11944, column: 39, scope: !6888)
+!6902 = !DILocation(line: 11945, column: 6, scope: !6888)
+!6903 = !DILocation(line: 11946, column: 34, scope: !6888)
+!6904 = !DILocation(line: 11948, column: 8, scope: !6888)
+!6905 = !DILocation(line: 11949, column: 35, scope: !6888)
+!6906 = !DILocation(line: 11950, column: 34, scope: !6888)
+!6907 = !DILocation(line: 11952, column: 40, scope: !6888)
+!6908 = !DILocation(line: 11953, column: 19, scope: !6888)
+!6909 = !DILocation(line: 11953, column: 4, scope: !6888)
+!6910 = !DILocation(line: 11954, column: 39, scope: !6888)
+!6911 = !DILocation(line: 11954, column: 20, scope: !6888)
+!6912 = !DILocation(line: 11956, column: 11, scope: !6888)
+!6913 = !DILocation(line: 11958, column: 8, scope: !6888)
+!6914 = !DILocation(line: 11959, column: 37, scope: !6888)
+!6915 = !DILocation(line: 11961, column: 26, scope: !6888)
+!6916 = !DILocation(line: 11962, column: 25, scope: !6888)
+!6917 = !DILocation(line: 11963, column: 16, scope: !6888)
+!6918 = !DILocation(line: 11965, column: 38, scope: !6888)
+!6919 = !DILocation(line: 11966, column: 29, scope: !6888)
+!6920 = !DILocation(line: 11966, column: 14, scope: !6888)
+!6921 = distinct !DISubprogram(name: "kernel_299", scope: !5, file: !5, line: 11970, type: !11, scopeLine: 11970, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !10)
+!6922 = !DILocation(line: 11972, column: 3, scope: !6921)
+!6923 = !DILocation(line: 11974, column: 14, scope: !6921)
+!6924 = !DILocation(line: 11974, column: 40, scope: !6921)
+!6925 = !DILocation(line: 11976, column: 32, scope: !6921)
+!6926 = !DILocation(line: 11978, column: 16, scope: !6921)
+!6927 = !DILocation(line: 11980, column: 25, scope: !6921)
+!6928 = !DILocation(line: 11982, column: 5, scope: !6921)
+!6929 = !DILocation(line: 11982, column: 35, scope: !6921)
+!6930 = !DILocation(line: 11983, column: 36, scope: !6921)
+!6931 = !DILocation(line: 11985, column: 22, scope: !6921)
+!6932 = !DILocation(line: 11987, column: 13, scope: !6921)
+!6933 = !DILocation(line: 11988, column: 22, scope: !6921)
+!6934 = !DILocation(line: 11988, column: 25, scope: !6921)
+!6935 = !DILocation(line: 11989, column: 6, scope: !6921)
+!6936 = !DILocation(line: 11990, column: 34, scope: !6921)
+!6937 = !DILocation(line: 11992, column: 4, scope: !6921)
@@ -0,0 +1,151 @@
+; A small module touching most kinds of values, types and instructions,
+; where per-module setup dominates the cost of serialization.
+
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-unknown-linux-gnu"
+
+%struct.node = type { i32, ptr, [4 x i8] }
+%struct.pair = type { i64, double }
+%union.any = type { i64 }
+
+@.str = private unnamed_addr constant [14 x i8] c"sum = %d (%s)\00", align 1
+@.ok = private unnamed_addr constant [3 x i8] c"ok\00", align 1
+@table = internal global [8 x i32] [i32 1, i32 2, i32 3, i32 5, i32 8, i32 13, i32 21, i32 34], align 16
+@head = global %struct.node { i32 0, ptr null, [4 x i8] zeroinitializer }, align 8
+@pairs = global [2 x %struct.pair] [%struct.pair { i64 1, double 1.500000e+00 }, %struct.pair { i64 2, double -2.500000e+00 }], align 16
+@counter = common global i64 0, align 8
+@handler = global ptr @apply, align 8
+@table_end = global ptr getelementptr inbounds ([8 x i32], ptr @table, i64 1, i64 0), align 8
+
+declare i32 @printf(ptr noundef, ...)
+declare void @llvm.memcpy.p0.p0.i64(ptr noalias nocapture writeonly, ptr noalias nocapture readonly, i64, i1 immarg)
+declare i32 @llvm.smax.i32(i32, i32)
+declare void @may_throw(i32)
+declare i32 @__gxx_personality_v0(...)
+
+define i32 @sum(ptr nocapture readonly %arr, i32 %n) {
+entry:
+  %cmp = icmp sgt i32 %n, 0
+  br i1 %cmp, label %loop, label %exit
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %loop ]
+  %acc = phi i32 [ 0, %entry ], [ %acc.next, %loop ]
+  %ptr = getelementptr inbounds i32, ptr %arr, i64 %i
+  %val = load i32, ptr %ptr, align 4
+  %acc.next = add nsw i32 %acc, %val
+  %i.next = add nuw nsw i64 %i, 1
+  %n.wide = zext i32 %n to i64
+  %done = icmp eq i64 %i.next, %n.wide
+  br i1 %done, label %exit, label %loop
+
+exit:
+  %res = phi i32 [ 0, %entry ], [ %acc.next, %loop ]
+  ret i32 %res
+}
+
+define i32 @classify(i32 %x) {
+entry:
+  switch i32 %x, label %other [
+    i32 0, label %zero
+    i32 1, label %one
+    i32 2, label %one
+  ]
+
+zero:
+  br label %done
+
+one:
+  %neg = sub i32 0, %x
+  br label %done
+
+other:
+  %big = icmp ugt i32 %x, 100
+  %sel = select i1 %big, i32 100, i32 %x
+  %max = call i32 @llvm.smax.i32(i32 %sel, i32 3)
+  br label %done
+
+done:
+  %r = phi i32 [ 0, %zero ], [ %neg, %one ], [ %max, %other ]
+  ret i32 %r
+}
+
+define i64 @fib(i64 %n) {
+entry:
+  %small = icmp ult i64 %n, 2
+  br i1 %small, label %base, label %rec
+
+base:
+  ret i64 %n
+
+rec:
+  %n1 = sub i64 %n, 1
+  %n2 = sub i64 %n, 2
+  %f1 = call i64 @fib(i64 %n1)
+  %f2 = call i64 @fib(i64 %n2)
+  %f = add i64 %f1, %f2
+  ret i64 %f
+}
+
+define double @mix(ptr %p, <4 x float> %v, float %s) {
+entry:
+  %q = getelementptr inbounds %struct.pair, ptr %p, i64 1, i32 1
+  %d = load double, ptr %q, align 8
+  %lane = extractelement <4 x float> %v, i32 2
+  %ins = insertelement <4 x float> %v, float %s, i32 0
+  %shuf = shufflevector <4 x float> %ins, <4 x float> poison, <4 x i32> <i32 3, i32 2, i32 1, i32 0>
+  %first = extractelement <4 x float> %shuf, i64 0
+  %sum = fadd fast float %lane, %first
+  %ext = fpext float %sum to double
+  %lt = fcmp olt double %ext, %d
+  %min = select i1 %lt, double %ext, double %d
+  %agg = insertvalue %struct.pair undef, double %min, 1
+  %out = extractvalue %struct.pair %agg, 1
+  ret double %out
+}
+
+define void @copy(ptr %dst, ptr %src) {
+entry:
+  %buf = alloca [16 x i8], align 16
+  %tmp = alloca %union.any, align 8
+  call void @llvm.memcpy.p0.p0.i64(ptr align 16 %buf, ptr align 1 %src, i64 16, i1 false)
+  call void @llvm.memcpy.p0.p0.i64(ptr align 1 %dst, ptr align 16 %buf, i64 16, i1 false)
+  store i64 42, ptr %tmp, align 8
+  %old = atomicrmw add ptr @counter, i64 1 seq_cst, align 8
+  %pair = cmpxchg ptr @counter, i64 %old, i64 0 acq_rel monotonic, align 8
+  fence release
+  ret void
+}
+
+define i32 @apply(ptr %fn, i32 %x) {
+entry:
+  %r = call i32 %fn(i32 %x)
+  ret i32 %r
+}
+
+define i32 @guarded(i32 %x) personality ptr @__gxx_personality_v0 {
+entry:
+  invoke void @may_throw(i32 %x)
+          to label %cont unwind label %lpad
+
+cont:
+  ret i32 0
+
+lpad:
+  %lp = landingpad { ptr, i32 }
+          cleanup
+  %sel = extractvalue { ptr, i32 } %lp, 1
+  ret i32 %sel
+}
+
+define i32 @main() {
+entry:
+  %s = call i32 @sum(ptr @table, i32 8)
+  %c = call i32 @classify(i32 %s)
+  %f = call i64 @fib(i64 10)
+  %t = trunc i64 %f to i32
+  %a = call i32 @apply(ptr @classify, i32 %t)
+  %p = call i32 (ptr, ...) @printf(ptr @.str, i32 %c, ptr @.ok)
+  %r = add i32 %a, %p
+  ret i32 %r
+}
@@ -0,0 +1,29 @@
+#include "Analysis.h"
+#include "Serializer.h"
+
+namespace libra {
+
+ModuleAnalysisManager *MAM = nullptr;
+FunctionAnalysisManager *FAM = nullptr;
+
+void init_analyses(Module &module, ModuleAnalysisManager &mam) {
+  assert(MAM == nullptr && FAM == nullptr);
+  MAM = &mam;
+  // shared by the function order, summaries, and the call graph output
+  mam.registerPass([] { return BottomUpSCCAnalysis(); });
+  FAM = &mam.getResult<FunctionAnalysisManagerModuleProxy>(module).getManager();
+}
+
+void destroy_analyses() {
+  assert(MAM != nullptr && FAM != nullptr);
+  MAM = nullptr;
+  FAM = nullptr;
+}
+
+void release_analyses(const Function &func) {
+  assert(FAM != nullptr);
+  // results are only cached, the function itself is left unchanged
+  FAM->clear(const_cast<Function &>(func), func.getName());
+}
+
+} // namespace libra
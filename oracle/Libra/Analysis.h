@@ -0,0 +1,41 @@
+#ifndef LIBRA_ANALYSIS_H
+#define LIBRA_ANALYSIS_H
+
+#include "Deps.h"
+
+namespace libra {
+
+/// Manager of module analyses for the module being serialized
+extern ModuleAnalysisManager *MAM;
+
+/// Manager of function analyses for the module being serialized
+extern FunctionAnalysisManager *FAM;
+
+/// Keep the module analysis manager and take the function one out of it
+void init_analyses(Module &module, ModuleAnalysisManager &mam);
+
+/// Forget the analysis managers
+void destroy_analyses();
+
+/// Get (and cache) the result of an analysis on the module
+template <typename T>
+[[nodiscard]] typename T::Result &get_module_analysis(const Module &module) {
+  assert(MAM != nullptr);
+  // analyses only read the module, the interface is just not const
+  return MAM->getResult<T>(const_cast<Module &>(module));
+}
+
+/// Get (and cache) the result of an analysis on a function
+template <typename T>
+[[nodiscard]] typename T::Result &get_analysis(const Function &func) {
+  assert(FAM != nullptr);
+  // analyses only read the function, the interface is just not const
+  return FAM->getResult<T>(const_cast<Function &>(func));
+}
+
+/// Drop the cached analysis results of a function that is fully serialized
+void release_analyses(const Function &func);
+
+} // namespace libra
+
+#endif // LIBRA_ANALYSIS_H
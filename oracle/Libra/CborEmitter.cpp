@@ -0,0 +1,134 @@
+#include "CborEmitter.h"
+
+namespace {
+
+/// Buffered bytes are pushed to the stream once they grow beyond this size
+constexpr size_t FLUSH_THRESHOLD = 1 << 16;
+
+// major types
+constexpr uint8_t MAJOR_UINT = 0;
+constexpr uint8_t MAJOR_NINT = 1;
+constexpr uint8_t MAJOR_TEXT = 3;
+
+// initial bytes with fixed meanings
+constexpr uint8_t ARRAY_INDEFINITE = 0x9F;
+constexpr uint8_t MAP_INDEFINITE = 0xBF;
+constexpr uint8_t SIMPLE_FALSE = 0xF4;
+constexpr uint8_t SIMPLE_TRUE = 0xF5;
+constexpr uint8_t SIMPLE_NULL = 0xF6;
+constexpr uint8_t FLOAT_64 = 0xFB;
+constexpr uint8_t BREAK = 0xFF;
+
+} // namespace
+
+namespace libra {
+
+CborEmitter::CborEmitter(raw_ostream &stm) : stm_(stm) {
+  buffer_.reserve(FLUSH_THRESHOLD * 2);
+}
+
+CborEmitter::~CborEmitter() { flush(); }
+
+void CborEmitter::value(const DocValue &val) {
+  write_document(*this, val);
+  maybe_flush();
+}
+
+void CborEmitter::object_begin() { append(MAP_INDEFINITE); }
+
+void CborEmitter::object_key(StringRef key) { write_text(key); }
+
+void CborEmitter::object_end() {
+  append(BREAK);
+  maybe_flush();
+}
+
+void CborEmitter::array_begin() { append(ARRAY_INDEFINITE); }
+
+void CborEmitter::array_end() {
+  append(BREAK);
+  maybe_flush();
+}
+
+void CborEmitter::scalar(const DocValue &val) {
+  switch (val.kind()) {
+  case DocValue::Null:
+    append(SIMPLE_NULL);
+    break;
+  case DocValue::Boolean:
+    append(val.as_bool() ? SIMPLE_TRUE : SIMPLE_FALSE);
+    break;
+  case DocValue::Int: {
+    const auto num = val.as_int();
+    if (num < 0) {
+      // negative integers are encoded as -1 - n
+      write_head(MAJOR_NINT, static_cast<uint64_t>(-(num + 1)));
+    } else {
+      write_head(MAJOR_UINT, static_cast<uint64_t>(num));
+    }
+    break;
+  }
+  case DocValue::UInt:
+    write_head(MAJOR_UINT, val.as_uint());
+    break;
+  case DocValue::Double: {
+    append(FLOAT_64);
+    const auto bits = bit_cast<uint64_t>(val.as_double());
+    for (int shift = 56; shift >= 0; shift -= 8) {
+      append(static_cast<uint8_t>(bits >> shift));
+    }
+    break;
+  }
+  case DocValue::String:
+    write_text(val.as_string());
+    break;
+  case DocValue::Array:
+  case DocValue::Object:
+    llvm_unreachable("containers are not scalars");
+  }
+}
+
+void CborEmitter::flush() {
+  stm_.write(buffer_.data(), buffer_.size());
+  buffer_.clear();
+}
+
+void CborEmitter::maybe_flush() {
+  if (buffer_.size() >= FLUSH_THRESHOLD) {
+    flush();
+  }
+}
+
+void CborEmitter::write_head(uint8_t major, uint64_t arg) {
+  const uint8_t prefix = major << 5;
+  if (arg < 24) {
+    append(prefix | static_cast<uint8_t>(arg));
+    return;
+  }
+
+  // the argument follows in the smallest big-endian form that holds it
+  unsigned width;
+  if (arg <= UINT8_MAX) {
+    append(prefix | 24);
+    width = 1;
+  } else if (arg <= UINT16_MAX) {
+    append(prefix | 25);
+    width = 2;
+  } else if (arg <= UINT32_MAX) {
+    append(prefix | 26);
+    width = 4;
+  } else {
+    append(prefix | 27);
+    width = 8;
+  }
+  for (unsigned i = width; i > 0; i--) {
+    append(static_cast<uint8_t>(arg >> ((i - 1) * 8)));
+  }
+}
+
+void CborEmitter::write_text(StringRef str) {
+  write_head(MAJOR_TEXT, str.size());
+  buffer_.append(str.begin(), str.end());
+}
+
+} // namespace libra
@@ -0,0 +1,49 @@
+#ifndef LIBRA_CBOR_EMITTER_H
+#define LIBRA_CBOR_EMITTER_H
+
+#include "Deps.h"
+#include "Document.h"
+#include "Sink.h"
+
+namespace libra {
+
+/// A sink (see Sink.h) that writes the serialized IR as CBOR (RFC 8949).
+///
+/// The document model maps onto CBOR directly: objects become maps with
+/// text keys, strings become text strings, and integers keep their sign.
+/// Objects and arrays are encoded with indefinite lengths, so the output
+/// can be streamed without knowing the number of members up front.
+class CborEmitter {
+private:
+  raw_ostream &stm_;
+  SmallVector<char, 0> buffer_;
+
+public:
+  explicit CborEmitter(raw_ostream &stm);
+  ~CborEmitter();
+
+public:
+  /// Write one complete value
+  void value(const DocValue &val);
+
+  void object_begin();
+  void object_key(StringRef key);
+  void object_end();
+  void array_begin();
+  void array_end();
+  void scalar(const DocValue &val);
+
+  /// Push all buffered bytes to the underlying stream
+  void flush();
+
+private:
+  void write_head(uint8_t major, uint64_t arg);
+  void write_text(StringRef str);
+
+  void append(uint8_t byte) { buffer_.push_back(static_cast<char>(byte)); }
+  void maybe_flush();
+};
+
+} // namespace libra
+
+#endif // LIBRA_CBOR_EMITTER_H
@@ -0,0 +1,50 @@
+#include "CensusSink.h"
+
+namespace libra {
+
+CensusSink::CensusSink()
+    : objects_(0), arrays_(0), nulls_(0), booleans_(0), numbers_(0),
+      strings_(0), string_bytes_(0) {}
+
+void CensusSink::scalar(const DocValue &val) {
+  switch (val.kind()) {
+  case DocValue::Null:
+    nulls_++;
+    break;
+  case DocValue::Boolean:
+    booleans_++;
+    break;
+  case DocValue::Int:
+  case DocValue::UInt:
+  case DocValue::Double:
+    numbers_++;
+    break;
+  case DocValue::String:
+    strings_++;
+    string_bytes_ += val.as_string().size();
+    break;
+  case DocValue::Array:
+  case DocValue::Object:
+    llvm_unreachable("containers are not scalars");
+  }
+}
+
+DocObject CensusSink::report() const {
+  DocObject result;
+  result["objects"] = objects_;
+  result["arrays"] = arrays_;
+  result["nulls"] = nulls_;
+  result["booleans"] = booleans_;
+  result["numbers"] = numbers_;
+  result["strings"] = strings_;
+  result["string_bytes"] = string_bytes_;
+
+  DocObject keys;
+  for (const auto &entry : keys_) {
+    keys[entry.getKey()] = entry.getValue();
+  }
+  result["keys"] = std::move(keys);
+  return result;
+}
+
+} // namespace libra
@@ -0,0 +1,47 @@
+#ifndef LIBRA_CENSUS_SINK_H
+#define LIBRA_CENSUS_SINK_H
+
+#include "Deps.h"
+#include "Document.h"
+#include "Sink.h"
+
+namespace libra {
+
+/// A sink (see Sink.h) that only counts what would have been written.
+///
+/// Besides the number of nodes of each kind, it keeps a histogram of object
+/// keys. As instructions, constants, and types are tagged by keys (e.g.,
+/// `Load` or `Struct`), the histogram doubles as a census of the module.
+class CensusSink {
+private:
+  uint64_t objects_;
+  uint64_t arrays_;
+  uint64_t nulls_;
+  uint64_t booleans_;
+  uint64_t numbers_;
+  uint64_t strings_;
+  uint64_t string_bytes_;
+  StringMap<uint64_t> keys_;
+
+public:
+  CensusSink();
+
+public:
+  /// Count one complete value
+  void value(const DocValue &val) { write_document(*this, val); }
+
+  void object_begin() { objects_++; }
+  void object_key(StringRef key) { keys_[key]++; }
+  void object_end() {}
+  void array_begin() { arrays_++; }
+  void array_end() {}
+  void scalar(const DocValue &val);
+
+public:
+  /// Summarize the counts, the result refers to keys owned by this sink
+  [[nodiscard]] DocObject report() const;
+};
+
+} // namespace libra
+
+#endif // LIBRA_CENSUS_SINK_H
@@ -0,0 +1,253 @@
+#include "Dictionary.h"
+#include "Serializer.h"
+
+namespace {
+using namespace libra;
+
+void write_signature(raw_ostream &stm, const Type &type) {
+  if (isa<StructType>(type)) {
+    const auto &struct_ty = cast<StructType>(type);
+    if (struct_ty.hasName()) {
+      stm << "%" << struct_ty.getName() << " = ";
+    }
+    if (struct_ty.isOpaque()) {
+      stm << "opaque";
+      return;
+    }
+    stm << (struct_ty.isPacked() ? "<{" : "{");
+    for (unsigned i = 0; i < struct_ty.getNumElements(); i++) {
+      stm << (i == 0 ? " " : ", ");
+      write_signature(stm, *struct_ty.getElementType(i));
+    }
+    stm << (struct_ty.isPacked() ? " }>" : " }");
+  } else if (isa<ArrayType>(type)) {
+    const auto &array_ty = cast<ArrayType>(type);
+    stm << "[" << array_ty.getNumElements() << " x ";
+    write_signature(stm, *array_ty.getElementType());
+    stm << "]";
+  } else if (isa<VectorType>(type)) {
+    const auto &vector_ty = cast<VectorType>(type);
+    stm << "<" << (isa<ScalableVectorType>(vector_ty) ? "vscale x " : "")
+        << vector_ty.getElementCount().getKnownMinValue() << " x ";
+    write_signature(stm, *vector_ty.getElementType());
+    stm << ">";
+  } else {
+    type.print(stm);
+  }
+}
+
+} // namespace
+
+namespace libra {
+
+cl::opt<std::string>
+    OptDictionary("libra-dict",
+                  cl::desc("Reference common strings and struct types in "
+                           "the given dictionary file instead of repeating "
+                           "them in the output"));
+
+cl::opt<std::string>
+    OptDictionaryBuild("libra-dict-build",
+                       cl::desc("Create or extend the given dictionary file "
+                                "with the common strings and struct types "
+                                "found in this module"));
+
+std::unique_ptr<Dictionary> Dictionary::load(StringRef path,
+                                             bool allow_missing) {
+  auto dict = std::make_unique<Dictionary>();
+
+  auto buffer = MemoryBuffer::getFile(path);
+  if (!buffer) {
+    if (allow_missing &&
+        buffer.getError() == std::errc::no_such_file_or_directory) {
+      return dict;
+    }
+    LOG->fatal("unable to read dictionary {0}: {1}", path,
+               buffer.getError().message());
+  }
+  const auto content = buffer.get()->getBuffer();
+  dict->digest_ = xxHash64(content);
+
+  auto parsed = json::parse(content);
+  if (!parsed) {
+    LOG->fatal("malformed dictionary {0}: {1}", path,
+               toString(parsed.takeError()));
+  }
+  const auto *root = parsed->getAsObject();
+  if (root == nullptr) {
+    LOG->fatal("malformed dictionary {0}: expect an object", path);
+  }
+
+  // strings
+  const auto *strings = root->getArray("strings");
+  if (strings == nullptr) {
+    LOG->fatal("malformed dictionary {0}: missing strings", path);
+  }
+  for (const auto &item : *strings) {
+    const auto str = item.getAsString();
+    if (!str) {
+      LOG->fatal("malformed dictionary {0}: non-string entry", path);
+    }
+    dict->add_string(*str);
+  }
+
+  // structs
+  const auto *structs = root->getArray("structs");
+  if (structs == nullptr) {
+    LOG->fatal("malformed dictionary {0}: missing structs", path);
+  }
+  for (const auto &item : *structs) {
+    const auto *entry = item.getAsObject();
+    if (entry == nullptr || !entry->getString("signature")) {
+      LOG->fatal("malformed dictionary {0}: invalid struct entry", path);
+    }
+    const auto sig = *entry->getString("signature");
+    if (dict->struct_ids_.count(sig) != 0) {
+      LOG->fatal("malformed dictionary {0}: duplicated struct {1}", path, sig);
+    }
+    dict->struct_ids_.try_emplace(sig, dict->structs_.size());
+    dict->structs_.push_back(*entry);
+  }
+
+  return dict;
+}
+
+void Dictionary::save(StringRef path) const {
+  json::Object result;
+
+  json::Array strings;
+  for (const auto &str : strings_) {
+    strings.push_back(str);
+  }
+  result["strings"] = std::move(strings);
+
+  json::Array structs;
+  for (const auto &entry : structs_) {
+    structs.push_back(json::Object(entry));
+  }
+  result["structs"] = std::move(structs);
+
+  std::error_code ec;
+  raw_fd_ostream stm(path, ec);
+  if (ec) {
+    LOG->fatal("unable to write dictionary {0}: {1}", path, ec.message());
+  }
+  stm << formatv("{0:2}", json::Value(std::move(result)));
+  stm.close();
+}
+
+void Dictionary::collect(const Module &module) {
+  // only externally visible symbols are shared among translation units
+  for (const auto &func : module.functions()) {
+    if (func.hasName() && !func.hasLocalLinkage() && !is_debug_function(func)) {
+      add_string(func.getName());
+    }
+  }
+  for (const auto &gvar : module.globals()) {
+    if (gvar.hasName() && !gvar.hasLocalLinkage()) {
+      add_string(gvar.getName());
+    }
+  }
+
+  // named struct types are commonly defined in shared headers
+  for (const auto *ty_def : module.getIdentifiedStructTypes()) {
+    if (!ty_def->hasName() || ty_def->isOpaque()) {
+      continue;
+    }
+    add_string(ty_def->getName());
+    add_struct(*ty_def);
+  }
+}
+
+std::optional<uint64_t> Dictionary::lookup_string(StringRef str) const {
+  const auto iter = string_ids_.find(str);
+  if (iter == string_ids_.end()) {
+    return std::nullopt;
+  }
+  return iter->second;
+}
+
+std::optional<uint64_t>
+Dictionary::lookup_struct(const StructType &type) const {
+  if (!type.hasName() || type.isOpaque()) {
+    return std::nullopt;
+  }
+  const auto [cached, inserted] = struct_cache_.try_emplace(&type);
+  if (inserted) {
+    const auto iter = struct_ids_.find(signature(type));
+    if (iter != struct_ids_.end()) {
+      cached->second = iter->second;
+    }
+  }
+  return cached->second;
+}
+
+DocObject Dictionary::serialize_header() const {
+  DocObject result;
+  result["digest"] = utohexstr(digest_, /* LowerCase */ true);
+  result["strings"] = strings_.size();
+  result["structs"] = structs_.size();
+  return result;
+}
+
+void Dictionary::add_string(StringRef str) {
+  if (string_ids_.count(str) != 0) {
+    return;
+  }
+  string_ids_.try_emplace(str, strings_.size());
+  strings_.push_back(str.str());
+}
+
+void Dictionary::add_struct(const StructType &type) {
+  auto sig = signature(type);
+  if (struct_ids_.count(sig) != 0) {
+    return;
+  }
+
+  json::Object entry;
+  entry["signature"] = sig;
+  entry["def"] = DocValue(serialize_type_struct(type)).to_json();
+
+  struct_ids_.try_emplace(sig, structs_.size());
+  structs_.push_back(std::move(entry));
+  // types that were not found may be found now
+  struct_cache_.clear();
+}
+
+std::string Dictionary::signature(const StructType &type) {
+  std::string sig;
+  raw_string_ostream stm(sig);
+  write_signature(stm, type);
+  return stm.str();
+}
+
+std::unique_ptr<Dictionary> DICT = nullptr;
+
+void init_dictionary() {
+  assert(DICT == nullptr);
+  if (!OptDictionary.empty() && !OptDictionaryBuild.empty()) {
+    LOG->fatal("cannot use and build a dictionary at the same time");
+  }
+  if (!OptDictionary.empty()) {
+    DICT = Dictionary::load(OptDictionary, false);
+  }
+}
+
+void update_dictionary(const Module &module) {
+  if (OptDictionaryBuild.empty()) {
+    return;
+  }
+  // NOTE: there is no locking on the file, modules sharing a dictionary are
+  // expected to go through this step one after another
+  auto dict = Dictionary::load(OptDictionaryBuild, true);
+  DocArena arena;
+  // entries are shared by other modules, which cannot resolve indices into
+  // the string table of this one
+  ModuleIndependentScope scope;
+  dict->collect(module);
+  dict->save(OptDictionaryBuild);
+}
+
+void destroy_dictionary() { DICT = nullptr; }
+
+} // namespace libra
@@ -0,0 +1,81 @@
+#ifndef LIBRA_DICTIONARY_H
+#define LIBRA_DICTIONARY_H
+
+#include "Deps.h"
+#include "Document.h"
+#include "Logger.h"
+
+namespace libra {
+
+/// Dictionary file to be referenced by the output (read-only)
+extern cl::opt<std::string> OptDictionary;
+
+/// Dictionary file to be created or extended with this module (read-write)
+extern cl::opt<std::string> OptDictionaryBuild;
+
+/// A project-wide collection of common strings and struct types, shared by
+/// the outputs of many translation units. Entries are append-only so that
+/// an identifier, once assigned, stays valid as the dictionary grows.
+class Dictionary {
+private:
+  std::vector<std::string> strings_;
+  StringMap<uint64_t> string_ids_;
+
+  std::vector<json::Object> structs_;
+  StringMap<uint64_t> struct_ids_;
+
+  /// results of `lookup_struct`, which would otherwise rebuild the signature
+  /// of a type at each of its uses
+  mutable DenseMap<const StructType *, std::optional<uint64_t>> struct_cache_;
+
+  /// digest of the dictionary file this dictionary is loaded from
+  uint64_t digest_;
+
+public:
+  Dictionary() : digest_(0) {}
+
+public:
+  /// Load a dictionary from a file, an absent file yields an empty one
+  [[nodiscard]] static std::unique_ptr<Dictionary> load(StringRef path,
+                                                        bool allow_missing);
+
+  /// Write the dictionary to a file, replacing existing content
+  void save(StringRef path) const;
+
+  /// Add the common strings and struct types of this module
+  void collect(const Module &module);
+
+public:
+  /// Find the identifier of a string
+  [[nodiscard]] std::optional<uint64_t> lookup_string(StringRef str) const;
+
+  /// Find the identifier of a struct type with an identical definition
+  [[nodiscard]] std::optional<uint64_t>
+  lookup_struct(const StructType &type) const;
+
+  /// Summary of this dictionary to be embedded in the output
+  [[nodiscard]] DocObject serialize_header() const;
+
+private:
+  void add_string(StringRef str);
+  void add_struct(const StructType &type);
+
+  /// A textual signature that identifies a struct definition
+  [[nodiscard]] static std::string signature(const StructType &type);
+};
+
+/// The dictionary in use, if any
+extern std::unique_ptr<Dictionary> DICT;
+
+/// Prepare the dictionary according to command-line options
+void init_dictionary();
+
+/// Update the dictionary file with this module, if requested
+void update_dictionary(const Module &module);
+
+/// Release the dictionary
+void destroy_dictionary();
+
+} // namespace libra
+
+#endif // LIBRA_DICTIONARY_H
@@ -0,0 +1,64 @@
+#include "DigestSink.h"
+
+namespace libra {
+
+void DigestSink::object_key(StringRef key) {
+  update_tag(':');
+  update_str(key);
+}
+
+void DigestSink::scalar(const DocValue &val) {
+  switch (val.kind()) {
+  case DocValue::Null:
+    update_tag('n');
+    break;
+  case DocValue::Boolean:
+    update_tag(val.as_bool() ? 't' : 'f');
+    break;
+  case DocValue::Int:
+    update_tag('i');
+    update_u64(static_cast<uint64_t>(val.as_int()));
+    break;
+  case DocValue::UInt:
+    update_tag('u');
+    update_u64(val.as_uint());
+    break;
+  case DocValue::Double:
+    update_tag('d');
+    update_u64(bit_cast<uint64_t>(val.as_double()));
+    break;
+  case DocValue::String:
+    update_tag('s');
+    update_str(val.as_string());
+    break;
+  case DocValue::Array:
+  case DocValue::Object:
+    llvm_unreachable("containers are not scalars");
+  }
+}
+
+std::string DigestSink::result() {
+  MD5::MD5Result digest;
+  hasher_.final(digest);
+  return digest.digest().str().str();
+}
+
+void DigestSink::update_tag(char tag) {
+  hasher_.update(ArrayRef<uint8_t>(static_cast<uint8_t>(tag)));
+}
+
+void DigestSink::update_u64(uint64_t num) {
+  uint8_t bytes[8];
+  for (unsigned i = 0; i < 8; i++) {
+    bytes[i] = static_cast<uint8_t>(num >> (i * 8));
+  }
+  hasher_.update(bytes);
+}
+
+void DigestSink::update_str(StringRef str) {
+  // length-prefixed to keep adjacent strings apart
+  update_u64(str.size());
+  hasher_.update(str);
+}
+
+} // namespace libra
@@ -0,0 +1,47 @@
+#ifndef LIBRA_DIGEST_SINK_H
+#define LIBRA_DIGEST_SINK_H
+
+#include "Deps.h"
+#include "Document.h"
+#include "Sink.h"
+
+namespace libra {
+
+/// A sink (see Sink.h) that hashes the output instead of writing it.
+///
+/// The digest covers the structure and content of the document but not its
+/// textual form, so it is the same whichever sink the document would have
+/// been written to (e.g., JSON indented or compact, or CBOR). Options that
+/// change the document itself, such as the columnar layout, numeric codes,
+/// or interned names, change the digest as well.
+class DigestSink {
+private:
+  MD5 hasher_;
+
+public:
+  DigestSink() = default;
+
+public:
+  /// Hash one complete value
+  void value(const DocValue &val) { write_document(*this, val); }
+
+  void object_begin() { update_tag('{'); }
+  void object_key(StringRef key);
+  void object_end() { update_tag('}'); }
+  void array_begin() { update_tag('['); }
+  void array_end() { update_tag(']'); }
+  void scalar(const DocValue &val);
+
+public:
+  /// Finalize the hash and get its hex form
+  [[nodiscard]] std::string result();
+
+private:
+  void update_tag(char tag);
+  void update_u64(uint64_t num);
+  void update_str(StringRef str);
+};
+
+} // namespace libra
+
+#endif // LIBRA_DIGEST_SINK_H
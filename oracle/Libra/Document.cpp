@@ -0,0 +1,163 @@
+#include "Document.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace {
+using namespace libra;
+
+/// The innermost arena alive
+DocArena *current_arena = nullptr;
+
+/// Number of times nodes have been released
+uint64_t arena_generation = 0;
+
+/// Check UTF-8 validity with a fast path for pure ASCII strings
+bool is_utf8(StringRef str) {
+  const auto *data = reinterpret_cast<const unsigned char *>(str.data());
+  const size_t size = str.size();
+  size_t pos = 0;
+
+#if defined(__SSE2__)
+  for (; pos + 16 <= size; pos += 16) {
+    const auto chunk =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + pos));
+    if (_mm_movemask_epi8(chunk) != 0) {
+      break;
+    }
+  }
+#endif
+
+  for (; pos < size; pos++) {
+    if (data[pos] >= 0x80) {
+      // leave non-ASCII sequences to the complete check
+      return json::isUTF8(str.drop_front(pos));
+    }
+  }
+  return true;
+}
+
+} // namespace
+
+namespace libra {
+
+DocArena::DocArena() : prev_(current_arena) { current_arena = this; }
+
+DocArena::~DocArena() {
+  assert(current_arena == this);
+  current_arena = prev_;
+  arena_generation++;
+}
+
+void DocArena::reset() {
+  alloc_.Reset();
+  arena_generation++;
+}
+
+BumpPtrAllocator &DocArena::current() {
+  assert(current_arena != nullptr);
+  return current_arena->alloc_;
+}
+
+uint64_t DocArena::generation() { return arena_generation; }
+
+DocValue &DocObject::operator[](StringRef key) {
+  if (rep_ == nullptr) {
+    rep_ = new (DocArena::current().Allocate<Rep>()) Rep{nullptr, nullptr, 0};
+  }
+
+  // objects are small, a linear scan is cheaper than any index
+  for (auto *member = rep_->head; member != nullptr; member = member->next) {
+    if (member->key == key) {
+      return member->value;
+    }
+  }
+
+  auto *member = new (DocArena::current().Allocate<Member>())
+      Member{key, DocValue(), nullptr};
+  if (rep_->tail == nullptr) {
+    rep_->head = member;
+  } else {
+    rep_->tail->next = member;
+  }
+  rep_->tail = member;
+  rep_->size++;
+  return member->value;
+}
+
+void DocArray::push_back(DocValue val) {
+  if (rep_ == nullptr) {
+    rep_ = new (DocArena::current().Allocate<Rep>()) Rep{nullptr, 0, 0};
+  }
+
+  // grow by doubling, the old storage is reclaimed with the arena
+  if (rep_->size == rep_->capacity) {
+    const auto capacity = rep_->capacity == 0 ? 4 : rep_->capacity * 2;
+    auto *data = DocArena::current().Allocate<DocValue>(capacity);
+    if (rep_->size != 0) {
+      std::memcpy(static_cast<void *>(data), rep_->data,
+                  rep_->size * sizeof(DocValue));
+    }
+    rep_->data = data;
+    rep_->capacity = capacity;
+  }
+  new (rep_->data + rep_->size) DocValue(val);
+  rep_->size++;
+}
+
+const DocValue *DocArray::begin() const {
+  return rep_ == nullptr ? nullptr : rep_->data;
+}
+
+const DocValue *DocArray::end() const {
+  return rep_ == nullptr ? nullptr : rep_->data + rep_->size;
+}
+
+DocValue::DocValue(StringRef val) : kind_(String) {
+  std::string fixed;
+  if (LLVM_UNLIKELY(!is_utf8(val))) {
+    fixed = json::fixUTF8(val);
+    val = fixed;
+  }
+  auto *data = DocArena::current().Allocate<char>(val.size());
+  if (!val.empty()) {
+    std::memcpy(data, val.data(), val.size());
+  }
+  str_.data = data;
+  str_.size = val.size();
+}
+
+json::Value DocValue::to_json() const {
+  switch (kind_) {
+  case Null:
+    return nullptr;
+  case Boolean:
+    return bool_;
+  case Int:
+    return int_;
+  case UInt:
+    return uint_;
+  case Double:
+    return double_;
+  case String:
+    return as_string().str();
+  case Array: {
+    json::Array result;
+    for (const auto &item : arr_) {
+      result.push_back(item.to_json());
+    }
+    return result;
+  }
+  case Object: {
+    json::Object result;
+    for (const auto &member : obj_) {
+      result[member.key.str()] = member.value.to_json();
+    }
+    return result;
+  }
+  }
+  llvm_unreachable("invalid document value kind");
+}
+
+} // namespace libra
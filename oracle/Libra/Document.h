@@ -0,0 +1,206 @@
+#ifndef LIBRA_DOCUMENT_H
+#define LIBRA_DOCUMENT_H
+
+#include "Deps.h"
+
+namespace libra {
+
+/// An arena where document nodes are allocated from.
+///
+/// Arenas are stacked: creating one makes it the current arena for all new
+/// nodes until it is destroyed. Nodes are never freed individually, instead
+/// the whole arena is released in bulk with `reset()` or on destruction.
+class DocArena {
+private:
+  BumpPtrAllocator alloc_;
+  DocArena *prev_;
+
+public:
+  DocArena();
+  ~DocArena();
+
+  DocArena(const DocArena &) = delete;
+  DocArena &operator=(const DocArena &) = delete;
+
+public:
+  /// Release all nodes allocated in this arena
+  void reset();
+
+  /// Number of bytes allocated in this arena
+  [[nodiscard]] size_t bytes_allocated() const {
+    return alloc_.getBytesAllocated();
+  }
+
+  /// Allocator of the current arena
+  [[nodiscard]] static BumpPtrAllocator &current();
+
+  /// Changes whenever nodes of any arena are released, after which their
+  /// addresses may be reused by new nodes
+  [[nodiscard]] static uint64_t generation();
+};
+
+class DocValue;
+
+/// An object in the document, with members kept in insertion order.
+///
+/// This is a handle to arena-allocated storage: copies share the same
+/// members. Keys are not copied and are expected to be string literals.
+class DocObject {
+public:
+  struct Member;
+
+private:
+  struct Rep {
+    Member *head;
+    Member *tail;
+    size_t size;
+  };
+  Rep *rep_;
+
+public:
+  DocObject() : rep_(nullptr) {}
+
+public:
+  /// Get the member with this key, creating a null one if not present
+  DocValue &operator[](StringRef key);
+
+  [[nodiscard]] bool empty() const { return size() == 0; }
+  [[nodiscard]] size_t size() const {
+    return rep_ == nullptr ? 0 : rep_->size;
+  }
+
+public:
+  class iterator {
+  private:
+    const Member *cur_;
+
+  public:
+    explicit iterator(const Member *cur) : cur_(cur) {}
+    const Member &operator*() const { return *cur_; }
+    const Member *operator->() const { return cur_; }
+    iterator &operator++();
+    bool operator!=(const iterator &other) const { return cur_ != other.cur_; }
+  };
+
+  [[nodiscard]] iterator begin() const {
+    return iterator(rep_ == nullptr ? nullptr : rep_->head);
+  }
+  [[nodiscard]] iterator end() const { return iterator(nullptr); }
+};
+
+/// An array in the document, a handle to arena-allocated storage.
+class DocArray {
+private:
+  struct Rep {
+    DocValue *data;
+    size_t size;
+    size_t capacity;
+  };
+  Rep *rep_;
+
+public:
+  DocArray() : rep_(nullptr) {}
+
+public:
+  /// Append an element, growing the storage within the arena
+  void push_back(DocValue val);
+
+  [[nodiscard]] bool empty() const { return size() == 0; }
+  [[nodiscard]] size_t size() const {
+    return rep_ == nullptr ? 0 : rep_->size;
+  }
+
+  [[nodiscard]] const DocValue *begin() const;
+  [[nodiscard]] const DocValue *end() const;
+};
+
+/// A value in the document, cheap to copy.
+class DocValue {
+public:
+  enum Kind : unsigned char {
+    Null,
+    Boolean,
+    Int,
+    UInt,
+    Double,
+    String,
+    Array,
+    Object
+  };
+
+private:
+  Kind kind_;
+  union {
+    bool bool_;
+    int64_t int_;
+    uint64_t uint_;
+    double double_;
+    struct {
+      const char *data;
+      size_t size;
+    } str_;
+    DocArray arr_;
+    DocObject obj_;
+  };
+
+public:
+  DocValue() : kind_(Null), uint_(0) {}
+  DocValue(std::nullptr_t) : kind_(Null), uint_(0) {}
+  DocValue(bool val) : kind_(Boolean), bool_(val) {}
+  DocValue(double val) : kind_(Double), double_(val) {}
+
+  /// Integers are kept signed or unsigned as provided
+  template <typename T,
+            typename = std::enable_if_t<std::is_integral<T>::value>,
+            typename = std::enable_if_t<!std::is_same<T, bool>::value>>
+  DocValue(T val) {
+    if constexpr (std::is_signed<T>::value) {
+      kind_ = Int;
+      int_ = val;
+    } else {
+      kind_ = UInt;
+      uint_ = val;
+    }
+  }
+
+  /// Strings are copied into the arena and fixed up if not valid UTF-8
+  DocValue(StringRef val);
+  DocValue(const char *val) : DocValue(StringRef(val)) {}
+  DocValue(const std::string &val) : DocValue(StringRef(val)) {}
+  DocValue(const SmallVectorImpl<char> &val)
+      : DocValue(StringRef(val.data(), val.size())) {}
+
+  DocValue(DocArray val) : kind_(Array), arr_(val) {}
+  DocValue(DocObject val) : kind_(Object), obj_(val) {}
+
+public:
+  [[nodiscard]] Kind kind() const { return kind_; }
+
+  [[nodiscard]] bool as_bool() const { return bool_; }
+  [[nodiscard]] int64_t as_int() const { return int_; }
+  [[nodiscard]] uint64_t as_uint() const { return uint_; }
+  [[nodiscard]] double as_double() const { return double_; }
+  [[nodiscard]] StringRef as_string() const {
+    return {str_.data, str_.size};
+  }
+  [[nodiscard]] const DocArray &as_array() const { return arr_; }
+  [[nodiscard]] const DocObject &as_object() const { return obj_; }
+
+  /// Deep-copy this value into an independent llvm::json value
+  [[nodiscard]] json::Value to_json() const;
+};
+
+struct DocObject::Member {
+  StringRef key;
+  DocValue value;
+  Member *next;
+};
+
+inline DocObject::iterator &DocObject::iterator::operator++() {
+  cur_ = cur_->next;
+  return *this;
+}
+
+} // namespace libra
+
+#endif // LIBRA_DOCUMENT_H
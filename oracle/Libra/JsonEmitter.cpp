@@ -0,0 +1,244 @@
+#include "JsonEmitter.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+/// Buffered text is pushed to the stream once it grows beyond this size
+constexpr size_t FLUSH_THRESHOLD = 1 << 16;
+
+/// Whether a byte needs escaping inside a JSON string
+inline bool needs_escape(unsigned char c) {
+  return c < 0x20 || c == '"' || c == '\\';
+}
+
+/// Length of the longest prefix that can be copied verbatim
+size_t count_verbatim(StringRef str) {
+  const auto *data = reinterpret_cast<const unsigned char *>(str.data());
+  const size_t size = str.size();
+  size_t pos = 0;
+
+#if defined(__SSE2__)
+  const auto v_ctrl = _mm_set1_epi8(0x1F);
+  const auto v_quote = _mm_set1_epi8('"');
+  const auto v_slash = _mm_set1_epi8('\\');
+  for (; pos + 16 <= size; pos += 16) {
+    const auto chunk =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + pos));
+    // unsigned (c <= 0x1F) is equivalent to max(c, 0x1F) == 0x1F
+    const auto is_ctrl = _mm_cmpeq_epi8(_mm_max_epu8(chunk, v_ctrl), v_ctrl);
+    const auto is_quote = _mm_cmpeq_epi8(chunk, v_quote);
+    const auto is_slash = _mm_cmpeq_epi8(chunk, v_slash);
+    const auto mask = _mm_movemask_epi8(
+        _mm_or_si128(is_ctrl, _mm_or_si128(is_quote, is_slash)));
+    if (mask != 0) {
+      return pos + llvm::countr_zero(static_cast<unsigned>(mask));
+    }
+  }
+#endif
+
+  for (; pos < size; pos++) {
+    if (needs_escape(data[pos])) {
+      break;
+    }
+  }
+  return pos;
+}
+
+} // namespace
+
+namespace libra {
+
+JsonEmitter::JsonEmitter(raw_ostream &stm, unsigned indent_size)
+    : stm_(stm), indent_size_(indent_size), indent_(0) {
+  buffer_.reserve(FLUSH_THRESHOLD * 2);
+}
+
+JsonEmitter::~JsonEmitter() {
+  assert(scopes_.empty());
+  flush();
+}
+
+void JsonEmitter::value(const DocValue &val) {
+  write_document(*this, val);
+  maybe_flush();
+}
+
+void JsonEmitter::object_begin() {
+  value_begin();
+  append('{');
+  scopes_.push_back({false, false});
+  indent_ += indent_size_;
+}
+
+void JsonEmitter::object_key(StringRef key) {
+  assert(!scopes_.empty() && !scopes_.back().is_array);
+  auto &scope = scopes_.back();
+  if (scope.has_value) {
+    append(',');
+  }
+  scope.has_value = true;
+  newline();
+  write_string(key);
+  append(':');
+  if (indent_size_ != 0) {
+    append(' ');
+  }
+}
+
+void JsonEmitter::object_end() {
+  assert(!scopes_.empty() && !scopes_.back().is_array);
+  indent_ -= indent_size_;
+  if (scopes_.back().has_value) {
+    newline();
+  }
+  scopes_.pop_back();
+  append('}');
+  maybe_flush();
+}
+
+void JsonEmitter::array_begin() {
+  value_begin();
+  append('[');
+  scopes_.push_back({true, false});
+  indent_ += indent_size_;
+}
+
+void JsonEmitter::array_end() {
+  assert(!scopes_.empty() && scopes_.back().is_array);
+  indent_ -= indent_size_;
+  if (scopes_.back().has_value) {
+    newline();
+  }
+  scopes_.pop_back();
+  append(']');
+  maybe_flush();
+}
+
+void JsonEmitter::flush() {
+  stm_.write(buffer_.data(), buffer_.size());
+  buffer_.clear();
+}
+
+void JsonEmitter::maybe_flush() {
+  if (buffer_.size() >= FLUSH_THRESHOLD) {
+    flush();
+  }
+}
+
+void JsonEmitter::value_begin() {
+  // values in an object are placed by their keys
+  if (scopes_.empty() || !scopes_.back().is_array) {
+    return;
+  }
+  auto &scope = scopes_.back();
+  if (scope.has_value) {
+    append(',');
+  }
+  scope.has_value = true;
+  newline();
+}
+
+void JsonEmitter::scalar(const DocValue &val) {
+  value_begin();
+  switch (val.kind()) {
+  case DocValue::Null:
+    append("null");
+    break;
+  case DocValue::Boolean:
+    append(val.as_bool() ? "true" : "false");
+    break;
+  case DocValue::Int:
+    write_int(val.as_int());
+    break;
+  case DocValue::UInt:
+    write_uint(val.as_uint());
+    break;
+  case DocValue::Double:
+    write_double(val.as_double());
+    break;
+  case DocValue::String:
+    write_string(val.as_string());
+    break;
+  case DocValue::Array:
+  case DocValue::Object:
+    llvm_unreachable("containers are not scalars");
+  }
+}
+
+void JsonEmitter::write_string(StringRef str) {
+  append('"');
+  while (!str.empty()) {
+    // copy over the verbatim part in bulk
+    const auto verbatim = count_verbatim(str);
+    append(str.take_front(verbatim));
+    str = str.drop_front(verbatim);
+    if (str.empty()) {
+      break;
+    }
+
+    // escape one character, in the same way as llvm::json
+    const auto c = static_cast<unsigned char>(str.front());
+    str = str.drop_front();
+    append('\\');
+    switch (c) {
+    case '"':
+    case '\\':
+      append(static_cast<char>(c));
+      break;
+    case '\t':
+      append('t');
+      break;
+    case '\n':
+      append('n');
+      break;
+    case '\r':
+      append('r');
+      break;
+    default:
+      append("u00");
+      append(hexdigit(c >> 4, /* LowerCase */ true));
+      append(hexdigit(c & 0xF, /* LowerCase */ true));
+      break;
+    }
+  }
+  append('"');
+}
+
+void JsonEmitter::write_uint(uint64_t num) {
+  char digits[20];
+  char *end = digits + sizeof(digits);
+  char *cur = end;
+  do {
+    *--cur = static_cast<char>('0' + num % 10);
+    num /= 10;
+  } while (num != 0);
+  buffer_.append(cur, end);
+}
+
+void JsonEmitter::write_int(int64_t num) {
+  if (num < 0) {
+    append('-');
+    // negate in unsigned arithmetic to cover the minimum value
+    write_uint(0 - static_cast<uint64_t>(num));
+  } else {
+    write_uint(static_cast<uint64_t>(num));
+  }
+}
+
+void JsonEmitter::write_double(double num) {
+  raw_svector_ostream stm(buffer_);
+  stm << format("%.*g", std::numeric_limits<double>::max_digits10, num);
+}
+
+void JsonEmitter::newline() {
+  if (indent_size_ == 0) {
+    return;
+  }
+  append('\n');
+  buffer_.append(indent_, ' ');
+}
+
+} // namespace libra
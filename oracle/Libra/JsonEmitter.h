@@ -0,0 +1,78 @@
+#ifndef LIBRA_JSON_EMITTER_H
+#define LIBRA_JSON_EMITTER_H
+
+#include "Deps.h"
+#include "Document.h"
+#include "Sink.h"
+
+namespace libra {
+
+/// A dedicated JSON writer for the serialized IR.
+///
+/// The output is byte-identical to what `llvm::json` prints for the same
+/// value (keys sorted, the same escaping and number formatting), either in
+/// compact form or pretty-printed with the given indentation. Unlike the
+/// `formatv` route, text is appended to an internal buffer directly and
+/// written to the stream in large chunks.
+///
+/// Besides complete values, objects and arrays can also be written piece by
+/// piece, so that large parts of the output never need to be held in memory
+/// at the same time. In that case, keys are written in the order given.
+///
+/// This is the default sink (see Sink.h) of the serializer.
+class JsonEmitter {
+private:
+  struct Scope {
+    bool is_array;
+    bool has_value;
+  };
+
+  raw_ostream &stm_;
+  const unsigned indent_size_;
+  unsigned indent_;
+  SmallVector<Scope, 16> scopes_;
+  SmallVector<char, 0> buffer_;
+
+public:
+  /// Create an emitter, an indent size of 0 produces compact output
+  explicit JsonEmitter(raw_ostream &stm, unsigned indent_size = 0);
+  ~JsonEmitter();
+
+public:
+  /// Write one complete value
+  void value(const DocValue &val);
+
+  /// Write a value that is neither an object nor an array
+  void scalar(const DocValue &val);
+
+  /// Start an object, to be filled with keys and values
+  void object_begin();
+  /// Write the key of the next member, to be followed by its value
+  void object_key(StringRef key);
+  /// Finish the current object
+  void object_end();
+
+  /// Start an array, to be filled with values
+  void array_begin();
+  /// Finish the current array
+  void array_end();
+
+  /// Push all buffered text to the underlying stream
+  void flush();
+
+private:
+  void value_begin();
+  void write_string(StringRef str);
+  void write_uint(uint64_t num);
+  void write_int(int64_t num);
+  void write_double(double num);
+  void newline();
+
+  void append(char c) { buffer_.push_back(c); }
+  void append(StringRef str) { buffer_.append(str.begin(), str.end()); }
+  void maybe_flush();
+};
+
+} // namespace libra
+
+#endif // LIBRA_JSON_EMITTER_H
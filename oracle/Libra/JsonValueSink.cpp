@@ -0,0 +1,32 @@
+#include "JsonValueSink.h"
+
+namespace libra {
+
+json::Value *JsonValueSink::place(json::Value val) {
+  // an open container is never moved, as nothing is added to its parent
+  // until it is finished
+  if (scopes_.empty()) {
+    assert(!root_.has_value());
+    root_.emplace(std::move(val));
+    return &*root_;
+  }
+  auto *scope = scopes_.back();
+  if (auto *arr = scope->getAsArray()) {
+    arr->push_back(std::move(val));
+    return &arr->back();
+  }
+  auto *obj = scope->getAsObject();
+  assert(obj != nullptr);
+  auto &member = (*obj)[std::move(key_)];
+  member = std::move(val);
+  return &member;
+}
+
+void JsonValueSink::print(raw_ostream &stm, unsigned indent_size) const {
+  assert(root_.has_value() && scopes_.empty());
+  // the style of a json::Value is its indent size, 0 prints it compact
+  const auto style = "{0:" + std::to_string(indent_size) + "}";
+  stm << formatv(style.c_str(), *root_);
+}
+
+} // namespace libra
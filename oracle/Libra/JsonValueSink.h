@@ -0,0 +1,47 @@
+#ifndef LIBRA_JSON_VALUE_SINK_H
+#define LIBRA_JSON_VALUE_SINK_H
+
+#include "Deps.h"
+#include "Document.h"
+#include "Sink.h"
+
+namespace libra {
+
+/// A sink (see Sink.h) that builds an `llvm::json::Value` of the output.
+///
+/// This is the route the serializer took before JsonEmitter: the complete
+/// document is held as a `json::Value` and printed with `formatv`. It is kept
+/// as the baseline that JsonEmitter is measured and checked against.
+class JsonValueSink {
+private:
+  std::optional<json::Value> root_;
+  SmallVector<json::Value *, 16> scopes_;
+  std::string key_;
+
+public:
+  JsonValueSink() = default;
+
+public:
+  /// Add one complete value
+  void value(const DocValue &val) { write_document(*this, val); }
+
+  void object_begin() { scopes_.push_back(place(json::Object())); }
+  void object_key(StringRef key) { key_ = key.str(); }
+  void object_end() { scopes_.pop_back(); }
+  void array_begin() { scopes_.push_back(place(json::Array())); }
+  void array_end() { scopes_.pop_back(); }
+  void scalar(const DocValue &val) { place(val.to_json()); }
+
+public:
+  /// Print the value with `formatv`, an indent size of 0 prints it compact
+  void print(raw_ostream &stm, unsigned indent_size = 0) const;
+
+private:
+  /// Put a value at the current position, i.e., as the root, the next item
+  /// of an array, or the member of an object under the last key
+  json::Value *place(json::Value val);
+};
+
+} // namespace libra
+
+#endif // LIBRA_JSON_VALUE_SINK_H
@@ -0,0 +1,83 @@
+#include "MetadataTable.h"
+#include "Serializer.h"
+
+namespace libra {
+
+cl::opt<bool> OptAliasMetadata(
+    "libra-alias-metadata", cl::init(false),
+    cl::desc("Emit TBAA and alias-scope metadata of memory accesses"));
+
+uint64_t MetadataTable::intern(const MDNode &node) {
+  auto res = ids_.try_emplace(&node, entries_.size());
+  if (res.second) {
+    entries_.push_back(&node);
+  }
+  return res.first->second;
+}
+
+DocArray MetadataTable::serialize() {
+  // the table grows as operands are interned, and cycles (e.g., self-
+  // referencing scope domains) end at nodes that already have an index
+  DocArray result;
+  for (size_t i = 0; i < entries_.size(); i++) {
+    DocArray operands;
+    for (const auto &operand : entries_[i]->operands()) {
+      operands.push_back(serialize_operand(operand.get()));
+    }
+    result.push_back(std::move(operands));
+  }
+  return result;
+}
+
+DocValue MetadataTable::serialize_operand(const Metadata *operand) {
+  if (operand == nullptr) {
+    return DocValue(nullptr);
+  }
+
+  DocObject result;
+  if (isa<MDNode>(operand)) {
+    result["Node"] = intern(*cast<MDNode>(operand));
+  } else if (isa<MDString>(operand)) {
+    result["String"] = cast<MDString>(operand)->getString();
+  } else if (isa<ConstantAsMetadata>(operand)) {
+    result["Constant"] =
+        serialize_constant(*cast<ConstantAsMetadata>(operand)->getValue());
+  } else {
+    LOG->fatal("unexpected operand in alias metadata: {0}", *operand);
+  }
+  return result;
+}
+
+DocValue serialize_alias_metadata(const Instruction &inst) {
+  const auto *tbaa = inst.getMetadata(LLVMContext::MD_tbaa);
+  const auto *scope = inst.getMetadata(LLVMContext::MD_alias_scope);
+  const auto *noalias = inst.getMetadata(LLVMContext::MD_noalias);
+  if (tbaa == nullptr && scope == nullptr && noalias == nullptr) {
+    return DocValue(nullptr);
+  }
+
+  DocObject result;
+  if (tbaa != nullptr) {
+    result["tbaa"] = METADATA->intern(*tbaa);
+  }
+  if (scope != nullptr) {
+    result["scope"] = METADATA->intern(*scope);
+  }
+  if (noalias != nullptr) {
+    result["noalias"] = METADATA->intern(*noalias);
+  }
+  return result;
+}
+
+std::unique_ptr<MetadataTable> METADATA = nullptr;
+
+void init_metadata_table() {
+  assert(METADATA == nullptr);
+  if (OptAliasMetadata) {
+    METADATA = std::make_unique<MetadataTable>();
+  }
+}
+
+void destroy_metadata_table() { METADATA = nullptr; }
+
+} // namespace libra
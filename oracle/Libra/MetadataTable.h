@@ -0,0 +1,45 @@
+#ifndef LIBRA_METADATA_TABLE_H
+#define LIBRA_METADATA_TABLE_H
+
+#include "Deps.h"
+#include "Document.h"
+#include "Logger.h"
+
+namespace libra {
+
+/// Flag to emit alias-analysis metadata (!tbaa, !alias.scope, !noalias)
+extern cl::opt<bool> OptAliasMetadata;
+
+/// A module-level table of metadata nodes, each distinct node is emitted
+/// only once and nodes refer to each other by index
+class MetadataTable {
+private:
+  DenseMap<const MDNode *, uint64_t> ids_;
+  std::vector<const MDNode *> entries_;
+
+public:
+  MetadataTable() = default;
+
+public:
+  /// Get the index of the node, adding it to the table if not present
+  [[nodiscard]] uint64_t intern(const MDNode &node);
+
+  /// Dump the table in index order, interning nodes reachable from operands
+  [[nodiscard]] DocArray serialize();
+
+private:
+  [[nodiscard]] DocValue serialize_operand(const Metadata *operand);
+};
+
+/// The metadata table in use, if any
+extern std::unique_ptr<MetadataTable> METADATA;
+
+/// Prepare the metadata table according to command-line options
+void init_metadata_table();
+
+/// Release the metadata table
+void destroy_metadata_table();
+
+} // namespace libra
+
+#endif // LIBRA_METADATA_TABLE_H
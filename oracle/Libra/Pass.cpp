@@ -1,59 +1,191 @@
+#include "CborEmitter.h"
+#include "CensusSink.h"
 #include "Deps.h"
+#include "DigestSink.h"
+#include "JsonEmitter.h"
+#include "JsonValueSink.h"
 #include "Logger.h"
+#include "Pass.h"
 #include "Serializer.h"
+#include "Stats.h"
 
 using namespace libra;
 
 namespace {
 
-/// Output of the result
+/// Time trace of the pass, in the format of `-time-trace`
+cl::opt<std::string>
+    OptTimeTrace("libra-time-trace",
+                 cl::desc("Write a Chrome trace of the serialization to the "
+                          "given file, unless opt is already tracing"));
+
+cl::opt<unsigned> OptTimeTraceGranularity(
+    "libra-time-trace-granularity", cl::init(500),
+    cl::desc("Minimum duration (in microseconds) of a traced event"));
+
+constexpr const char *PASS_NAME = "Libra";
+
+} // namespace
+
+namespace libra {
+
 cl::opt<std::string> OptOutput("libra-output",
                                cl::desc("The output file name"));
 
-constexpr const char *PASS_NAME = "Libra";
+cl::opt<OutputFormat> OptFormat(
+    "libra-format", cl::init(OutputFormat::Json),
+    cl::desc("The output format"),
+    cl::values(clEnumValN(OutputFormat::Json, "json", "JSON document"),
+               clEnumValN(OutputFormat::JsonFormatv, "json-formatv",
+                          "JSON document, built as a json::Value and "
+                          "printed with formatv (baseline)"),
+               clEnumValN(OutputFormat::Cbor, "cbor", "CBOR document"),
+               clEnumValN(OutputFormat::Census, "census",
+                          "Counts of values and keys, in JSON"),
+               clEnumValN(OutputFormat::Digest, "digest",
+                          "MD5 digest of the document")));
 
-struct LibraPass : PassInfoMixin<LibraPass> {
-  // pass entrypoint
-  static PreservedAnalyses run(Module &module, ModuleAnalysisManager &) {
-    // start of execution
-    auto level = Logger::Level::Info;
-    if (OptVerbose) {
-      level = Logger::Level::Debug;
-    }
-    init_default_logger(level, OptVerbose);
+cl::opt<bool> OptCompact("libra-compact", cl::init(false),
+                         cl::desc("Emit compact JSON without indentation"));
 
-    // initialization
+PreservedAnalyses LibraPass::run(Module &module, ModuleAnalysisManager &mam) {
+  // start of execution
+  auto level = Logger::Level::Info;
+  if (OptVerbose) {
+    level = Logger::Level::Debug;
+  }
+  init_default_logger(level, OptVerbose);
+  init_dictionary();
+  init_string_table();
+  init_metadata_table();
+  init_stats();
+  // contexts of an earlier run refer to functions that may be freed by now,
+  // whose addresses can be reused by functions of this module
+  contexts.clear();
+
+  // when opt runs with -time-trace, scopes go to its trace instead, which
+  // also covers parsing the input before this pass
+  const auto own_trace = !OptTimeTrace.empty() && !timeTraceProfilerEnabled();
+  if (own_trace) {
+    timeTraceProfilerInitialize(OptTimeTraceGranularity, PASS_NAME);
+  }
+
+  // initialization
+  auto start = std::chrono::steady_clock::now();
+  {
+    TimeTraceScope scope("Materialize");
     if (auto e = module.materializeAll()) {
       LOG->fatal("unable to materialize module: {0}", e);
     }
     if (auto e = module.materializeMetadata()) {
       LOG->fatal("unable to materialize metadata: {0}", e);
     }
+  }
+  if (STATS != nullptr) {
+    STATS->add_phase("materialize", seconds_since(start));
+  }
 
-    // TODO: hack for constant expressions
+  // TODO: hack for constant expressions
+  start = std::chrono::steady_clock::now();
+  {
+    TimeTraceScope scope("Prepare");
     prepare_for_serialization(module);
+    init_analyses(module, mam);
+  }
+  if (STATS != nullptr) {
+    STATS->add_phase("prepare", seconds_since(start));
+  }
 
-    // serialize and dump to file
-    auto data = serialize_module(module);
-    std::error_code ec;
-    raw_fd_ostream stm(OptOutput, ec,
-                       sys::fs::CreationDisposition::CD_CreateNew);
-    if (ec) {
-      LOG->fatal("unable to create output file: {0}", OptOutput);
-    }
-    stm << formatv("{0:2}", json::Value(std::move(data)));
-    stm.close();
+  // serialize and dump to file
+  start = std::chrono::steady_clock::now();
+  std::error_code ec;
+  raw_fd_ostream stm(OptOutput, ec,
+                     sys::fs::CreationDisposition::CD_CreateNew);
+  if (ec) {
+    LOG->fatal("unable to create output file: {0}", OptOutput);
+  }
+  switch (OptFormat) {
+  case OutputFormat::Json: {
+    JsonEmitter emitter(stm, OptCompact ? 0 : 2);
+    serialize_module(module, emitter);
+    break;
+  }
+  case OutputFormat::JsonFormatv: {
+    JsonValueSink sink;
+    serialize_module(module, sink);
+    sink.print(stm, OptCompact ? 0 : 2);
+    break;
+  }
+  case OutputFormat::Cbor: {
+    CborEmitter emitter(stm);
+    serialize_module(module, emitter);
+    break;
+  }
+  case OutputFormat::Census: {
+    CensusSink census;
+    serialize_module(module, census);
+    DocArena arena;
+    JsonEmitter emitter(stm, OptCompact ? 0 : 2);
+    emitter.value(census.report());
+    break;
+  }
+  case OutputFormat::Digest: {
+    DigestSink digest;
+    serialize_module(module, digest);
+    stm << digest.result() << "\n";
+    break;
+  }
+  }
+  stm.close();
+  if (STATS != nullptr) {
+    STATS->add_phase("serialize", seconds_since(start));
+  }
 
-    // end of execution
-    destroy_default_logger();
+  // collect shared strings and types for other modules
+  update_dictionary(module);
 
-    // mark that all analysis results are invalidated
-    return PreservedAnalyses::none();
+  // end of execution
+  if (own_trace) {
+    if (auto e = timeTraceProfilerWrite(OptTimeTrace, OptOutput)) {
+      LOG->fatal("unable to write time trace: {0}", e);
+    }
+    timeTraceProfilerCleanup();
   }
+  save_stats();
+  destroy_stats();
+  destroy_analyses();
+  destroy_metadata_table();
+  destroy_string_table();
+  destroy_dictionary();
+  destroy_default_logger();
 
-  // force every module to go through this pass.
-  static bool isRequired() { return true; }
-};
+  // mark that all analysis results are invalidated
+  return PreservedAnalyses::none();
+}
+
+void run_standalone(Module &module) {
+  LoopAnalysisManager lam;
+  FunctionAnalysisManager fam;
+  CGSCCAnalysisManager cgam;
+  ModuleAnalysisManager mam;
+  PassBuilder builder;
+
+  // same as opt, the default alias analyses are registered first
+  fam.registerPass([&] { return builder.buildDefaultAAPipeline(); });
+  builder.registerModuleAnalyses(mam);
+  builder.registerCGSCCAnalyses(cgam);
+  builder.registerFunctionAnalyses(fam);
+  builder.registerLoopAnalyses(lam);
+  builder.crossRegisterProxies(lam, fam, cgam, mam);
+
+  ModulePassManager mpm;
+  mpm.addPass(LibraPass());
+  mpm.run(module, mam);
+}
+
+} // namespace libra
+
+namespace {
 
 //-----------------------------------------------------------------------------
 // Pass Registration
@@ -0,0 +1,34 @@
+#ifndef LIBRA_PASS_H
+#define LIBRA_PASS_H
+
+#include "Deps.h"
+
+namespace libra {
+
+/// Output of the result
+extern cl::opt<std::string> OptOutput;
+
+/// Format of the output
+enum class OutputFormat { Json, JsonFormatv, Cbor, Census, Digest };
+
+extern cl::opt<OutputFormat> OptFormat;
+
+/// Flag to emit compact JSON without indentation
+extern cl::opt<bool> OptCompact;
+
+/// The serialization pass, run by `opt` through the plugin interface or
+/// directly by other hosts (e.g., the benchmarks)
+struct LibraPass : PassInfoMixin<LibraPass> {
+  // pass entrypoint
+  static PreservedAnalyses run(Module &module, ModuleAnalysisManager &mam);
+
+  // force every module to go through this pass.
+  static bool isRequired() { return true; }
+};
+
+/// Run the pass on a module outside of opt, with the analyses opt provides
+void run_standalone(Module &module);
+
+} // namespace libra
+
+#endif // LIBRA_PASS_H
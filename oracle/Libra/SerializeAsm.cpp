@@ -2,8 +2,8 @@
 
 namespace libra {
 
-json::Object serialize_inline_asm(const InlineAsm &assembly) {
-  json::Object result;
+DocObject serialize_inline_asm(const InlineAsm &assembly) {
+  DocObject result;
   result["asm"] = assembly.getAsmString();
   result["constraint"] = assembly.getConstraintString();
   return result;
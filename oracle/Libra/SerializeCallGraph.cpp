@@ -0,0 +1,147 @@
+#include "Serializer.h"
+
+namespace {
+using namespace libra;
+
+/// Functions that appear in the output, i.e., nodes of the call graph
+bool is_call_graph_node(const Function &func) {
+  return &func != dummy_function && !is_debug_function(func);
+}
+
+} // namespace
+
+namespace libra {
+
+cl::opt<bool> OptCallGraph("libra-call-graph", cl::init(false),
+                           cl::desc("Emit the module call graph with its "
+                                    "strongly connected components"));
+
+AnalysisKey BottomUpSCCAnalysis::Key;
+
+BottomUpSCCAnalysis::Result
+BottomUpSCCAnalysis::run(Module &module, ModuleAnalysisManager &mam) {
+  auto &graph = mam.getResult<CallGraphAnalysis>(module);
+
+  Result result;
+  DenseSet<const Function *> visited;
+  const auto collect = [&](auto begin) {
+    for (auto iter = begin; !iter.isAtEnd(); ++iter) {
+      std::vector<const Function *> scc;
+      for (const auto *node : *iter) {
+        const auto *func = node->getFunction();
+        // skip the external nodes and functions from earlier traversals,
+        // SCCs are found whole so either all members are new or none is
+        if (func == nullptr || !is_call_graph_node(*func) ||
+            !visited.insert(func).second) {
+          continue;
+        }
+        scc.push_back(func);
+      }
+      if (!scc.empty()) {
+        result.push_back(std::move(scc));
+      }
+    }
+  };
+
+  // everything reachable from outside the module, then the leftovers (e.g.,
+  // internal functions that are never called), in module order
+  collect(scc_begin(&graph));
+  for (const auto &func : module.functions()) {
+    if (is_call_graph_node(func) && !visited.contains(&func)) {
+      collect(scc_begin(graph[&func]));
+    }
+  }
+  return result;
+}
+
+const BottomUpSCCAnalysis::Result &bottom_up_sccs(const Module &module) {
+  return get_module_analysis<BottomUpSCCAnalysis>(module);
+}
+
+DocObject serialize_call_graph(const Module &module) {
+  // nodes, in module order
+  DenseMap<const Function *, uint64_t> nodes;
+  DocArray names;
+  for (const auto &func : module.functions()) {
+    if (!is_call_graph_node(func)) {
+      continue;
+    }
+    const auto index = nodes.size();
+    nodes.try_emplace(&func, index);
+    if (func.hasName()) {
+      names.push_back(serialize_name(func.getName()));
+    } else {
+      names.push_back(DocValue(nullptr));
+    }
+  }
+
+  // edges, per caller
+  DocArray direct_calls;
+  DocArray indirect_calls;
+  DocArray address_taken;
+  for (const auto &func : module.functions()) {
+    if (!is_call_graph_node(func)) {
+      continue;
+    }
+    const auto &ctxt = contexts.at(&func);
+
+    SmallVector<uint64_t, 16> callees;
+    DocArray sites;
+    for (const auto &inst : instructions(func)) {
+      if (!isa<CallBase>(inst) || is_debug_instruction(inst)) {
+        continue;
+      }
+      const auto &call = cast<CallBase>(inst);
+      if (call.isInlineAsm()) {
+        continue;
+      }
+
+      // same notion of direct calls as the instruction serializer
+      const auto *target = call.getCalledOperand();
+      if (isa<Function>(target)) {
+        const auto iter = nodes.find(cast<Function>(target));
+        if (iter != nodes.end()) {
+          callees.push_back(iter->second);
+        }
+      } else {
+        DocObject site;
+        site["inst"] = ctxt.get_instruction(inst);
+        site["target_type"] = serialize_type(*call.getFunctionType());
+        sites.push_back(std::move(site));
+      }
+    }
+
+    llvm::sort(callees);
+    callees.erase(std::unique(callees.begin(), callees.end()), callees.end());
+    DocArray edges;
+    for (const auto callee : callees) {
+      edges.push_back(callee);
+    }
+    direct_calls.push_back(std::move(edges));
+    indirect_calls.push_back(std::move(sites));
+
+    if (func.hasAddressTaken()) {
+      address_taken.push_back(nodes.lookup(&func));
+    }
+  }
+
+  // components, callees before callers
+  DocArray sccs;
+  for (const auto &scc : bottom_up_sccs(module)) {
+    DocArray members;
+    for (const auto *func : scc) {
+      members.push_back(nodes.lookup(func));
+    }
+    sccs.push_back(std::move(members));
+  }
+
+  DocObject result;
+  result["functions"] = std::move(names);
+  result["direct_calls"] = std::move(direct_calls);
+  result["indirect_calls"] = std::move(indirect_calls);
+  result["address_taken"] = std::move(address_taken);
+  result["sccs"] = std::move(sccs);
+  return result;
+}
+
+} // namespace libra
@@ -0,0 +1,57 @@
+#include "Serializer.h"
+
+namespace libra {
+
+cl::opt<bool> OptNumericCodes("libra-numeric-codes", cl::init(false),
+                              cl::desc("Emit opcodes, predicates, and "
+                                       "intrinsics as numeric codes"));
+
+DocObject serialize_code_tables(const Module &module) {
+  DocObject result;
+
+  // opcode names indexed by opcode, 0 is not a valid opcode, spelled the
+  // same as in the string mode
+  DocArray opcodes;
+  opcodes.push_back(DocValue(nullptr));
+  for (unsigned code = 1; code < Instruction::OtherOpsEnd; code++) {
+    opcodes.push_back(get_opcode_name(code));
+  }
+  result["opcodes"] = std::move(opcodes);
+
+  // predicate names indexed by predicate, with gaps between fcmp and icmp
+  DocArray predicates;
+  for (unsigned code = 0; code <= CmpInst::LAST_ICMP_PREDICATE; code++) {
+    const auto pred = static_cast<CmpInst::Predicate>(code);
+    if (CmpInst::isFPPredicate(pred) || CmpInst::isIntPredicate(pred)) {
+      predicates.push_back(get_predicate_name(pred));
+    } else {
+      predicates.push_back(DocValue(nullptr));
+    }
+  }
+  result["predicates"] = std::move(predicates);
+
+  // intrinsics declared in this module, as intrinsic IDs are not stable
+  // across LLVM versions (overloads of an intrinsic share the same ID)
+  SmallVector<Intrinsic::ID, 32> ids;
+  for (const auto &func : module.functions()) {
+    const auto id = func.getIntrinsicID();
+    if (id != Intrinsic::not_intrinsic && !is_debug_function(func)) {
+      ids.push_back(id);
+    }
+  }
+  llvm::sort(ids);
+  ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+
+  DocArray intrinsics;
+  for (const auto id : ids) {
+    DocObject item;
+    item["id"] = static_cast<uint64_t>(id);
+    item["name"] = Intrinsic::getBaseName(id);
+    intrinsics.push_back(std::move(item));
+  }
+  result["intrinsics"] = std::move(intrinsics);
+
+  return result;
+}
+
+} // namespace libra
@@ -0,0 +1,293 @@
+#include "Serializer.h"
+
+namespace {
+using namespace libra;
+
+/// How an entry in the flat operand column is to be interpreted
+enum class OperandKind : uint8_t {
+  Argument = 0,
+  Instruction = 1,
+  Label = 2,
+  Constant = 3,
+  Metadata = 4,
+  Asm = 5,
+};
+
+/// A table of distinct items, indexed by first appearance
+template <typename T> class ItemTable {
+private:
+  DenseMap<const T *, uint64_t> ids_;
+  DocArray entries_;
+
+public:
+  template <typename F> uint64_t lookup(const T &item, F serialize) {
+    const auto iter = ids_.find(&item);
+    if (iter != ids_.end()) {
+      return iter->second;
+    }
+    const auto index = ids_.size();
+    ids_.try_emplace(&item, index);
+    entries_.push_back(serialize(item));
+    return index;
+  }
+
+  [[nodiscard]] DocArray entries() const { return entries_; }
+};
+
+} // namespace
+
+namespace libra {
+
+cl::opt<bool>
+    OptColumnar("libra-columnar", cl::init(false),
+                cl::desc("Emit function bodies as columns of instructions "
+                         "instead of nested blocks"));
+
+DocObject
+FunctionSerializationContext::serialize_columns(const Function &func) const {
+  const auto &layout = func.getParent()->getDataLayout();
+  const auto serialize_type_entry = [&](const Type &type) {
+    auto entry = serialize_type(type);
+    if (OptLayout && type.isSized()) {
+      entry["layout"] = serialize_type_layout(type, layout);
+    }
+    return entry;
+  };
+
+  ItemTable<Type> types;
+  ItemTable<Constant> consts;
+  ItemTable<InlineAsm> asms;
+
+  // one row per instruction, debug instructions are left out as in the
+  // nested layout, so rows map to instruction indices through `index`
+  DocArray indices;
+  DocArray opcodes;
+  DocArray result_types;
+  DocArray operand_start;
+  DocArray operand_kinds;
+  DocArray operand_ids;
+  DocArray alias_mds;
+
+  // per-row fields of some opcodes only, null for the others
+  DocArray predicates;
+  DocArray type_operands;
+  DocArray orderings;
+  DocArray failure_orderings;
+  DocArray scopes;
+  DocArray rmw_ops;
+  DocArray shuffle_masks;
+  DocArray cleanups;
+
+  // incoming blocks of phi nodes, row i spans [start[i], start[i + 1]) and
+  // lines up with the operands of the row
+  DocArray incoming_start;
+  DocArray incoming_blocks;
+
+  // indices of extractvalue and insertvalue, in the same form
+  DocArray agg_index_start;
+  DocArray agg_indices;
+
+  // one row per block
+  DocArray block_start;
+  DocArray succ_start;
+  DocArray succs;
+
+  uint64_t num_insts = 0;
+  uint64_t num_operands = 0;
+  uint64_t num_incomings = 0;
+  uint64_t num_agg_indices = 0;
+  uint64_t num_succs = 0;
+
+  const auto add_operand = [&](OperandKind kind, uint64_t id) {
+    operand_kinds.push_back(static_cast<uint64_t>(kind));
+    operand_ids.push_back(id);
+    num_operands++;
+  };
+
+  for (const auto &block : func) {
+    block_start.push_back(num_insts);
+    for (const auto &inst : block) {
+      // handle debug instructions separately
+      if (is_debug_instruction(inst)) {
+        continue;
+      }
+      indices.push_back(get_instruction(inst));
+      opcodes.push_back(inst.getOpcode());
+      result_types.push_back(
+          types.lookup(*inst.getType(), serialize_type_entry));
+      operand_start.push_back(num_operands);
+      incoming_start.push_back(num_incomings);
+      agg_index_start.push_back(num_agg_indices);
+      if (METADATA != nullptr) {
+        alias_mds.push_back(serialize_alias_metadata(inst));
+      }
+
+      // opcode-specific fields
+      DocValue predicate(nullptr);
+      DocValue type_operand(nullptr);
+      DocValue ordering(nullptr);
+      DocValue failure_ordering(nullptr);
+      DocValue scope(nullptr);
+      DocValue rmw_op(nullptr);
+      DocValue shuffle_mask(nullptr);
+      DocValue cleanup(nullptr);
+      const auto add_agg_indices = [&](ArrayRef<unsigned> idxs) {
+        for (const auto idx : idxs) {
+          agg_indices.push_back(idx);
+          num_agg_indices++;
+        }
+      };
+      switch (inst.getOpcode()) {
+      case Instruction::ICmp:
+      case Instruction::FCmp:
+        predicate = static_cast<uint64_t>(cast<CmpInst>(inst).getPredicate());
+        break;
+      case Instruction::Alloca:
+        type_operand = types.lookup(*cast<AllocaInst>(inst).getAllocatedType(),
+                                    serialize_type_entry);
+        break;
+      case Instruction::GetElementPtr:
+        type_operand =
+            types.lookup(*cast<GetElementPtrInst>(inst).getSourceElementType(),
+                         serialize_type_entry);
+        break;
+      case Instruction::Call:
+      case Instruction::Invoke:
+      case Instruction::CallBr:
+        type_operand = types.lookup(*cast<CallBase>(inst).getFunctionType(),
+                                    serialize_type_entry);
+        break;
+      case Instruction::Load:
+        ordering = toIRString(cast<LoadInst>(inst).getOrdering());
+        break;
+      case Instruction::Store:
+        ordering = toIRString(cast<StoreInst>(inst).getOrdering());
+        break;
+      case Instruction::Fence: {
+        const auto &fence = cast<FenceInst>(inst);
+        ordering = toIRString(fence.getOrdering());
+        scope = get_sync_scope_name(fence.getSyncScopeID());
+        break;
+      }
+      case Instruction::AtomicCmpXchg: {
+        const auto &cmpxchg = cast<AtomicCmpXchgInst>(inst);
+        ordering = toIRString(cmpxchg.getSuccessOrdering());
+        failure_ordering = toIRString(cmpxchg.getFailureOrdering());
+        scope = get_sync_scope_name(cmpxchg.getSyncScopeID());
+        break;
+      }
+      case Instruction::AtomicRMW: {
+        const auto &rmw = cast<AtomicRMWInst>(inst);
+        ordering = toIRString(rmw.getOrdering());
+        scope = get_sync_scope_name(rmw.getSyncScopeID());
+        rmw_op = get_rmw_op_name(rmw.getOperation());
+        break;
+      }
+      case Instruction::ExtractValue:
+        add_agg_indices(cast<ExtractValueInst>(inst).getIndices());
+        break;
+      case Instruction::InsertValue:
+        add_agg_indices(cast<InsertValueInst>(inst).getIndices());
+        break;
+      case Instruction::ShuffleVector: {
+        DocArray mask;
+        for (const auto val : cast<ShuffleVectorInst>(inst).getShuffleMask()) {
+          mask.push_back(val);
+        }
+        shuffle_mask = std::move(mask);
+        break;
+      }
+      case Instruction::LandingPad:
+        cleanup = cast<LandingPadInst>(inst).isCleanup();
+        break;
+      case Instruction::PHI:
+        for (const auto *incoming : cast<PHINode>(inst).blocks()) {
+          incoming_blocks.push_back(get_block(*incoming));
+          num_incomings++;
+        }
+        break;
+      default:
+        break;
+      }
+      predicates.push_back(predicate);
+      type_operands.push_back(type_operand);
+      orderings.push_back(ordering);
+      failure_orderings.push_back(failure_ordering);
+      scopes.push_back(scope);
+      rmw_ops.push_back(rmw_op);
+      shuffle_masks.push_back(shuffle_mask);
+      cleanups.push_back(cleanup);
+
+      for (const auto &use : inst.operands()) {
+        const auto &val = *use.get();
+        if (isa<Argument>(val)) {
+          add_operand(OperandKind::Argument,
+                      get_argument(cast<Argument>(val)));
+        } else if (isa<Instruction>(val)) {
+          add_operand(OperandKind::Instruction,
+                      get_instruction(cast<Instruction>(val)));
+        } else if (isa<BasicBlock>(val)) {
+          add_operand(OperandKind::Label, get_block(cast<BasicBlock>(val)));
+        } else if (isa<Constant>(val)) {
+          add_operand(OperandKind::Constant,
+                      consts.lookup(cast<Constant>(val), serialize_constant));
+        } else if (isa<MetadataAsValue>(val)) {
+          // TODO: metadata system is not ready
+          add_operand(OperandKind::Metadata, 0);
+        } else if (isa<InlineAsm>(val)) {
+          add_operand(OperandKind::Asm,
+                      asms.lookup(cast<InlineAsm>(val), serialize_inline_asm));
+        } else {
+          LOG->fatal("unknown operand type: {0}", val);
+        }
+      }
+      num_insts++;
+    }
+
+    // terminator targets
+    succ_start.push_back(num_succs);
+    for (const auto *succ : successors(&block)) {
+      succs.push_back(get_block(*succ));
+      num_succs++;
+    }
+  }
+
+  // sentinels, so that row i spans [start[i], start[i + 1])
+  operand_start.push_back(num_operands);
+  incoming_start.push_back(num_incomings);
+  agg_index_start.push_back(num_agg_indices);
+  block_start.push_back(num_insts);
+  succ_start.push_back(num_succs);
+
+  DocObject result;
+  result["types"] = types.entries();
+  result["constants"] = consts.entries();
+  result["asms"] = asms.entries();
+  result["index"] = std::move(indices);
+  result["opcode"] = std::move(opcodes);
+  result["ty"] = std::move(result_types);
+  result["operand_start"] = std::move(operand_start);
+  result["operand_kind"] = std::move(operand_kinds);
+  result["operand_id"] = std::move(operand_ids);
+  if (METADATA != nullptr) {
+    result["alias_md"] = std::move(alias_mds);
+  }
+  result["predicate"] = std::move(predicates);
+  result["type_operand"] = std::move(type_operands);
+  result["ordering"] = std::move(orderings);
+  result["failure_ordering"] = std::move(failure_orderings);
+  result["scope"] = std::move(scopes);
+  result["rmw_op"] = std::move(rmw_ops);
+  result["shuffle_mask"] = std::move(shuffle_masks);
+  result["cleanup"] = std::move(cleanups);
+  result["incoming_start"] = std::move(incoming_start);
+  result["incoming_block"] = std::move(incoming_blocks);
+  result["agg_index_start"] = std::move(agg_index_start);
+  result["agg_indices"] = std::move(agg_indices);
+  result["block_start"] = std::move(block_start);
+  result["succ_start"] = std::move(succ_start);
+  result["succ"] = std::move(succs);
+  return result;
+}
+
+} // namespace libra
@@ -3,9 +3,9 @@
 namespace {
 using namespace libra;
 
-json::Object serialize_const_data_sequence(const ConstantDataSequential &val) {
-  json::Object result;
-  json::Array elements;
+DocObject serialize_const_data_sequence(const ConstantDataSequential &val) {
+  DocObject result;
+  DocArray elements;
   for (unsigned i = 0; i < val.getNumElements(); i++) {
     elements.push_back(serialize_constant(*val.getElementAsConstant(i)));
   }
@@ -13,9 +13,9 @@ json::Object serialize_const_data_sequence(const ConstantDataSequential &val) {
   return result;
 }
 
-json::Object serialize_const_pack_aggregate(const ConstantAggregate &val) {
-  json::Object result;
-  json::Array elements;
+DocObject serialize_const_pack_aggregate(const ConstantAggregate &val) {
+  DocObject result;
+  DocArray elements;
   for (unsigned i = 0; i < val.getNumOperands(); i++) {
     elements.push_back(serialize_constant(*val.getOperand(i)));
   }
@@ -23,10 +23,10 @@ json::Object serialize_const_pack_aggregate(const ConstantAggregate &val) {
   return result;
 }
 
-json::Object serialize_const_ref_global(const GlobalValue &val) {
-  json::Object result;
+DocObject serialize_const_ref_global(const GlobalValue &val) {
+  DocObject result;
   if (val.hasName()) {
-    result["name"] = val.getName();
+    result["name"] = serialize_name(val.getName());
   }
   return result;
 }
@@ -35,160 +35,167 @@ json::Object serialize_const_ref_global(const GlobalValue &val) {
 
 namespace libra {
 
-json::Object serialize_constant(const Constant &val) {
-  json::Object result;
+DocObject serialize_constant(const Constant &val) {
+  DocObject result;
   result["ty"] = serialize_type(*val.getType());
-  result["repr"] = serialize_const(val);
+  const auto repr = serialize_const(val);
+  result["repr"] = repr;
+
+  if (STATS != nullptr) {
+    STATS->add_bytes("constant", repr, result);
+  }
   return result;
 }
 
-json::Object serialize_const(const Constant &val) {
-  json::Object result;
+DocObject serialize_const(const Constant &val) {
+  DocObject result;
 
+  // dispatch on the value ID, which is a single jump table lookup
+  switch (val.getValueID()) {
   // markers
-  if (isa<DSOLocalEquivalent>(val)) {
+  case Value::DSOLocalEquivalentVal:
     result["Marker"] =
         serialize_const_marker(*cast<DSOLocalEquivalent>(val).getGlobalValue());
-  } else if (isa<NoCFIValue>(val)) {
+    break;
+  case Value::NoCFIValueVal:
     result["Marker"] =
         serialize_const_marker(*cast<NoCFIValue>(val).getGlobalValue());
-  }
+    break;
 
   // constant data
-  else if (isa<ConstantData>(val)) {
-    if (isa<ConstantInt>(val)) {
-      result["Int"] = serialize_const_data_int(cast<ConstantInt>(val));
-    } else if (isa<ConstantFP>(val)) {
-      result["Float"] = serialize_const_data_float(cast<ConstantFP>(val));
-    } else if (isa<ConstantPointerNull>(val)) {
-      result["Null"] = json::Value(nullptr);
-    } else if (isa<ConstantTokenNone>(val)) {
-      result["None"] = json::Value(nullptr);
-    } else if (isa<ConstantTargetNone>(val)) {
-      result["Extension"] = json::Value(nullptr);
-    } else if (isa<UndefValue>(val)) {
-      result["Undef"] = json::Value(nullptr);
-    } else if (isa<ConstantAggregateZero>(val)) {
-      result["Default"] = json::Value(nullptr);
-    } else if (isa<ConstantDataVector>(val)) {
-      result["Vector"] =
-          serialize_const_data_vector(cast<ConstantDataVector>(val));
-    } else if (isa<ConstantDataArray>(val)) {
-      result["Array"] =
-          serialize_const_data_array(cast<ConstantDataArray>(val));
-    } else {
-      LOG->fatal("unknown constant data: {0}", val);
-    }
-  }
+  case Value::ConstantIntVal:
+    result["Int"] = serialize_const_data_int(cast<ConstantInt>(val));
+    break;
+  case Value::ConstantFPVal:
+    result["Float"] = serialize_const_data_float(cast<ConstantFP>(val));
+    break;
+  case Value::ConstantPointerNullVal:
+    result["Null"] = DocValue(nullptr);
+    break;
+  case Value::ConstantTokenNoneVal:
+    result["None"] = DocValue(nullptr);
+    break;
+  case Value::ConstantTargetNoneVal:
+    result["Extension"] = DocValue(nullptr);
+    break;
+  case Value::UndefValueVal:
+  case Value::PoisonValueVal:
+    result["Undef"] = DocValue(nullptr);
+    break;
+  case Value::ConstantAggregateZeroVal:
+    result["Default"] = DocValue(nullptr);
+    break;
+  case Value::ConstantDataVectorVal:
+    result["Vector"] =
+        serialize_const_data_vector(cast<ConstantDataVector>(val));
+    break;
+  case Value::ConstantDataArrayVal:
+    result["Array"] = serialize_const_data_array(cast<ConstantDataArray>(val));
+    break;
 
   // constant aggregate
-  else if (isa<ConstantAggregate>(val)) {
-    if (isa<ConstantVector>(val)) {
-      result["Vector"] = serialize_const_pack_vector(cast<ConstantVector>(val));
-    } else if (isa<ConstantArray>(val)) {
-      result["Array"] = serialize_const_pack_array(cast<ConstantArray>(val));
-    } else if (isa<ConstantStruct>(val)) {
-      result["Struct"] = serialize_const_pack_struct(cast<ConstantStruct>(val));
-    } else {
-      LOG->fatal("unknown constant aggregate: {0}", val);
-    }
-  }
+  case Value::ConstantVectorVal:
+    result["Vector"] = serialize_const_pack_vector(cast<ConstantVector>(val));
+    break;
+  case Value::ConstantArrayVal:
+    result["Array"] = serialize_const_pack_array(cast<ConstantArray>(val));
+    break;
+  case Value::ConstantStructVal:
+    result["Struct"] = serialize_const_pack_struct(cast<ConstantStruct>(val));
+    break;
 
   // reference to global declarations
-  else if (isa<GlobalValue>(val)) {
-    if (isa<GlobalVariable>(val)) {
-      result["Variable"] =
-          serialize_const_ref_global_variable(cast<GlobalVariable>(val));
-    } else if (isa<Function>(val)) {
-      result["Function"] = serialize_const_ref_function(cast<Function>(val));
-    } else if (isa<GlobalAlias>(val)) {
-      result["Alias"] =
-          serialize_const_ref_global_alias(cast<GlobalAlias>(val));
-    } else if (isa<GlobalIFunc>(val)) {
-      result["Interface"] =
-          serialize_const_ref_interface(cast<GlobalIFunc>(val));
-    } else {
-      LOG->fatal("unknown constant reference to global value: {0}", val);
-    }
-  }
+  case Value::GlobalVariableVal:
+    result["Variable"] =
+        serialize_const_ref_global_variable(cast<GlobalVariable>(val));
+    break;
+  case Value::FunctionVal:
+    result["Function"] = serialize_const_ref_function(cast<Function>(val));
+    break;
+  case Value::GlobalAliasVal:
+    result["Alias"] = serialize_const_ref_global_alias(cast<GlobalAlias>(val));
+    break;
+  case Value::GlobalIFuncVal:
+    result["Interface"] = serialize_const_ref_interface(cast<GlobalIFunc>(val));
+    break;
 
   // constant block address
-  else if (isa<BlockAddress>(val)) {
+  case Value::BlockAddressVal:
     result["Label"] = serialize_block_address(cast<BlockAddress>(val));
-  }
+    break;
 
   // constant expression
-  else if (isa<ConstantExpr>(val)) {
+  case Value::ConstantExprVal:
     result["Expr"] = serialize_const_expr(cast<ConstantExpr>(val));
-  }
+    break;
 
   // should have exhausted all types of constant
-  else {
+  default:
     LOG->fatal("unknown constant: {0}", val);
   }
 
   return result;
 }
 
-json::Object serialize_const_data_int(const ConstantInt &val) {
-  json::Object result;
+DocObject serialize_const_data_int(const ConstantInt &val) {
+  DocObject result;
   SmallString<1024> dump;
   val.getValue().toStringUnsigned(dump);
   result["value"] = dump;
   return result;
 }
 
-json::Object serialize_const_data_float(const ConstantFP &val) {
-  json::Object result;
+DocObject serialize_const_data_float(const ConstantFP &val) {
+  DocObject result;
   SmallString<1024> dump;
   val.getValue().toString(dump);
   result["value"] = dump;
   return result;
 }
 
-json::Object serialize_const_data_array(const ConstantDataArray &val) {
+DocObject serialize_const_data_array(const ConstantDataArray &val) {
   return serialize_const_data_sequence(val);
 }
 
-json::Object serialize_const_data_vector(const ConstantDataVector &val) {
+DocObject serialize_const_data_vector(const ConstantDataVector &val) {
   return serialize_const_data_sequence(val);
 }
 
-json::Object serialize_const_pack_array(const ConstantArray &val) {
+DocObject serialize_const_pack_array(const ConstantArray &val) {
   return serialize_const_pack_aggregate(val);
 }
 
-json::Object serialize_const_pack_struct(const ConstantStruct &val) {
+DocObject serialize_const_pack_struct(const ConstantStruct &val) {
   return serialize_const_pack_aggregate(val);
 }
 
-json::Object serialize_const_pack_vector(const ConstantVector &val) {
+DocObject serialize_const_pack_vector(const ConstantVector &val) {
   return serialize_const_pack_aggregate(val);
 }
 
-json::Object serialize_const_marker(const GlobalValue &val) {
-  json::Object result;
+DocObject serialize_const_marker(const GlobalValue &val) {
+  DocObject result;
   result["wrap"] = serialize_constant(val);
   return result;
 }
 
-json::Object serialize_const_ref_global_variable(const GlobalVariable &val) {
+DocObject serialize_const_ref_global_variable(const GlobalVariable &val) {
   return serialize_const_ref_global(val);
 }
 
-json::Object serialize_const_ref_function(const Function &val) {
+DocObject serialize_const_ref_function(const Function &val) {
   return serialize_const_ref_global(val);
 }
 
-json::Object serialize_const_ref_global_alias(const GlobalAlias &val) {
+DocObject serialize_const_ref_global_alias(const GlobalAlias &val) {
   return serialize_const_ref_global(val);
 }
 
-json::Object serialize_const_ref_interface(const GlobalIFunc &val) {
+DocObject serialize_const_ref_interface(const GlobalIFunc &val) {
   return serialize_const_ref_global(val);
 }
 
-json::Object serialize_block_address(const BlockAddress &addr) {
+DocObject serialize_block_address(const BlockAddress &addr) {
   // sanity checks
   const auto *func = addr.getFunction();
   if (!func->hasName()) {
@@ -203,14 +210,15 @@ json::Object serialize_block_address(const BlockAddress &addr) {
   const auto &ctxt = iter->second;
 
   // dump the result
-  json::Object result;
-  result["func"] = func->getName();
+  DocObject result;
+  result["func"] = serialize_name(func->getName());
   result["block"] = ctxt.get_block(*addr.getBasicBlock());
   return result;
 }
 
-json::Object serialize_const_expr(const ConstantExpr &expr) {
-  json::Object result;
+DocObject serialize_const_expr(const ConstantExpr &expr) {
+  TimeTraceScope scope("SerializeConstExpr", expr.getOpcodeName());
+  DocObject result;
 
   FunctionSerializationContext ctxt;
   const auto *inst = expr.getAsInstruction(dummy_instruction);
@@ -0,0 +1,166 @@
+#include "Serializer.h"
+
+namespace {
+using namespace libra;
+
+/// A table of distinct items, indexed by first appearance
+template <typename T> class IdTable {
+private:
+  DenseMap<const T *, uint64_t> ids_;
+
+public:
+  /// Get the index of the item, with `added` set if it is new
+  uint64_t intern(const T &item, bool &added) {
+    const auto index = ids_.size();
+    auto res = ids_.try_emplace(&item, index);
+    added = res.second;
+    return res.first->second;
+  }
+};
+
+/// Module-wide tables of source locations, with the columns of each table
+/// filled as entries are added
+class DebugLocTable {
+private:
+  IdTable<DIFile> files_;
+  DocArray file_dirs_;
+  DocArray file_names_;
+
+  IdTable<DIScope> scopes_;
+  DocArray scope_files_;
+  DocArray scope_names_;
+
+  IdTable<DILocation> locs_;
+  DocArray loc_lines_;
+  DocArray loc_columns_;
+  DocArray loc_scopes_;
+  DocArray loc_inlined_at_;
+  int64_t last_line_ = 0;
+
+public:
+  uint64_t add_file(const DIFile &file) {
+    bool added = false;
+    const auto id = files_.intern(file, added);
+    if (added) {
+      file_dirs_.push_back(file.getDirectory());
+      file_names_.push_back(file.getFilename());
+    }
+    return id;
+  }
+
+  uint64_t add_scope(const DIScope &scope) {
+    bool added = false;
+    const auto id = scopes_.intern(scope, added);
+    if (added) {
+      const auto *file = scope.getFile();
+      if (file == nullptr) {
+        scope_files_.push_back(DocValue(nullptr));
+      } else {
+        scope_files_.push_back(add_file(*file));
+      }
+      const auto *subprogram =
+          isa<DILocalScope>(scope)
+              ? cast<DILocalScope>(scope).getSubprogram()
+              : nullptr;
+      if (subprogram == nullptr) {
+        scope_names_.push_back(DocValue(nullptr));
+      } else {
+        scope_names_.push_back(subprogram->getName());
+      }
+    }
+    return id;
+  }
+
+  uint64_t add_loc(const DILocation &loc) {
+    // the inlined-at location comes first, so that references point back
+    std::optional<uint64_t> inlined_at;
+    if (const auto *outer = loc.getInlinedAt()) {
+      inlined_at = add_loc(*outer);
+    }
+
+    bool added = false;
+    const auto id = locs_.intern(loc, added);
+    if (added) {
+      // lines are delta-encoded against the previous entry
+      const auto line = static_cast<int64_t>(loc.getLine());
+      loc_lines_.push_back(line - last_line_);
+      last_line_ = line;
+      loc_columns_.push_back(loc.getColumn());
+      loc_scopes_.push_back(add_scope(*loc.getScope()));
+      if (inlined_at) {
+        loc_inlined_at_.push_back(*inlined_at);
+      } else {
+        loc_inlined_at_.push_back(DocValue(nullptr));
+      }
+    }
+    return id;
+  }
+
+  [[nodiscard]] DocObject serialize() const {
+    DocObject files;
+    files["dir"] = file_dirs_;
+    files["name"] = file_names_;
+
+    DocObject scopes;
+    scopes["file"] = scope_files_;
+    scopes["function"] = scope_names_;
+
+    DocObject locs;
+    locs["line_delta"] = loc_lines_;
+    locs["column"] = loc_columns_;
+    locs["scope"] = loc_scopes_;
+    locs["inlined_at"] = loc_inlined_at_;
+
+    DocObject result;
+    result["files"] = std::move(files);
+    result["scopes"] = std::move(scopes);
+    result["locs"] = std::move(locs);
+    return result;
+  }
+};
+
+} // namespace
+
+namespace libra {
+
+cl::opt<bool> OptDebugLocs("libra-debug-locs", cl::init(false),
+                           cl::desc("Emit a side table mapping instructions "
+                                    "to source locations"));
+
+DocObject serialize_debug_locs(const Module &module) {
+  DebugLocTable table;
+
+  // per function, the location of each instruction index as (id + 1), or 0
+  // if it has none, delta-encoded against the previous instruction
+  DocArray functions;
+  for (const auto &func : module.functions()) {
+    if (&func == dummy_function || is_debug_function(func) ||
+        func.isDeclaration()) {
+      continue;
+    }
+
+    DocArray deltas;
+    int64_t last = 0;
+    for (const auto &inst : instructions(func)) {
+      int64_t current = 0;
+      if (const auto *loc = inst.getDebugLoc().get()) {
+        current = static_cast<int64_t>(table.add_loc(*loc)) + 1;
+      }
+      deltas.push_back(current - last);
+      last = current;
+    }
+
+    DocObject item;
+    if (func.hasName()) {
+      item["name"] = serialize_name(func.getName());
+    }
+    item["loc_delta"] = std::move(deltas);
+    functions.push_back(std::move(item));
+  }
+
+  auto result = table.serialize();
+  result["functions"] = std::move(functions);
+  return result;
+}
+
+} // namespace libra
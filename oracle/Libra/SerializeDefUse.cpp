@@ -0,0 +1,89 @@
+#include "Serializer.h"
+
+namespace {
+using namespace libra;
+
+/// Users of a value as (instruction, operand number), sorted
+DocArray serialize_users(const FunctionSerializationContext &ctxt,
+                         const Value &val) {
+  SmallVector<std::pair<uint64_t, unsigned>, 8> users;
+  for (const auto &use : val.uses()) {
+    const auto *user = dyn_cast<Instruction>(use.getUser());
+    if (user == nullptr || is_debug_instruction(*user)) {
+      continue;
+    }
+    users.emplace_back(ctxt.get_instruction(*user), use.getOperandNo());
+  }
+  llvm::sort(users);
+
+  DocArray result;
+  for (const auto &[inst, operand] : users) {
+    DocObject item;
+    item["inst"] = inst;
+    item["operand"] = operand;
+    result.push_back(std::move(item));
+  }
+  return result;
+}
+
+} // namespace
+
+namespace libra {
+
+cl::opt<bool> OptDefUse("libra-def-use", cl::init(false),
+                        cl::desc("Emit users of values and predecessors of "
+                                 "blocks in defined functions"));
+
+DocObject
+FunctionSerializationContext::serialize_def_use(const Function &func) const {
+  // users, indexed by argument and instruction index
+  DocArray arg_users;
+  for (const auto &arg : func.args()) {
+    arg_users.push_back(serialize_users(*this, arg));
+  }
+  DocArray inst_users;
+  for (const auto &inst : instructions(func)) {
+    inst_users.push_back(serialize_users(*this, inst));
+  }
+
+  // predecessors, indexed by block label, without duplicated edges
+  DocArray preds;
+  for (const auto &block : func) {
+    SmallVector<uint64_t, 8> labels;
+    for (const auto *pred : predecessors(&block)) {
+      labels.push_back(get_block(*pred));
+    }
+    llvm::sort(labels);
+    labels.erase(std::unique(labels.begin(), labels.end()), labels.end());
+
+    DocArray items;
+    for (const auto label : labels) {
+      items.push_back(label);
+    }
+    preds.push_back(std::move(items));
+  }
+
+  // reverse post-order numbers, null for unreachable blocks
+  std::vector<std::optional<uint64_t>> numbers(func.size());
+  uint64_t counter = 0;
+  for (const auto *block : ReversePostOrderTraversal<const Function *>(&func)) {
+    numbers[get_block(*block)] = counter++;
+  }
+  DocArray rpo;
+  for (const auto &number : numbers) {
+    if (number) {
+      rpo.push_back(*number);
+    } else {
+      rpo.push_back(DocValue(nullptr));
+    }
+  }
+
+  DocObject result;
+  result["arg_users"] = std::move(arg_users);
+  result["inst_users"] = std::move(inst_users);
+  result["preds"] = std::move(preds);
+  result["rpo"] = std::move(rpo);
+  return result;
+}
+
+} // namespace libra
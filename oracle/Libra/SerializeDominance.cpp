@@ -0,0 +1,63 @@
+#include "Serializer.h"
+
+namespace {
+using namespace libra;
+
+/// Immediate dominators and DFS numbers of each block, indexed by label.
+///
+/// Block `a` dominates block `b` iff `in[a] <= in[b] && out[b] <= out[a]`.
+/// Blocks absent from the tree (unreachable ones) have null entries, and so
+/// do blocks whose immediate post-dominator is the virtual exit.
+template <typename Tree>
+DocObject serialize_dom_tree(const FunctionSerializationContext &ctxt,
+                             const Function &func, const Tree &tree) {
+  tree.updateDFSNumbers();
+
+  DocArray idoms;
+  DocArray dfs_in;
+  DocArray dfs_out;
+  for (const auto &block : func) {
+    const auto *node = tree.getNode(&block);
+    if (node == nullptr) {
+      idoms.push_back(DocValue(nullptr));
+      dfs_in.push_back(DocValue(nullptr));
+      dfs_out.push_back(DocValue(nullptr));
+      continue;
+    }
+
+    const auto *idom = node->getIDom();
+    if (idom == nullptr || idom->getBlock() == nullptr) {
+      idoms.push_back(DocValue(nullptr));
+    } else {
+      idoms.push_back(ctxt.get_block(*idom->getBlock()));
+    }
+    dfs_in.push_back(node->getDFSNumIn());
+    dfs_out.push_back(node->getDFSNumOut());
+  }
+
+  DocObject result;
+  result["idom"] = std::move(idoms);
+  result["dfs_in"] = std::move(dfs_in);
+  result["dfs_out"] = std::move(dfs_out);
+  return result;
+}
+
+} // namespace
+
+namespace libra {
+
+cl::opt<bool> OptDominance("libra-dominance", cl::init(false),
+                           cl::desc("Emit dominator and post-dominator "
+                                    "trees of defined functions"));
+
+DocObject
+FunctionSerializationContext::serialize_dominance(const Function &func) const {
+  DocObject result;
+  result["dom"] = serialize_dom_tree(
+      *this, func, get_analysis<DominatorTreeAnalysis>(func));
+  result["post_dom"] = serialize_dom_tree(
+      *this, func, get_analysis<PostDominatorTreeAnalysis>(func));
+  return result;
+}
+
+} // namespace libra
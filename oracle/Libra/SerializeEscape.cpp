@@ -0,0 +1,96 @@
+#include "Serializer.h"
+
+namespace {
+using namespace libra;
+
+/// Whether the object is only accessed through loads and stores at constant
+/// offsets from its base, i.e., its accessed bytes are statically known
+bool is_accessed_at_constant_offsets(const Value &base) {
+  SmallVector<const Value *, 16> worklist;
+  SmallPtrSet<const Value *, 16> visited;
+  worklist.push_back(&base);
+  visited.insert(&base);
+
+  while (!worklist.empty()) {
+    const auto *ptr = worklist.pop_back_val();
+    for (const auto &use : ptr->uses()) {
+      const auto *user = use.getUser();
+
+      // derived pointers at constant offsets
+      if (isa<BitCastInst>(user) || isa<AddrSpaceCastInst>(user) ||
+          (isa<GetElementPtrInst>(user) &&
+           cast<GetElementPtrInst>(user)->hasAllConstantIndices())) {
+        if (visited.insert(user).second) {
+          worklist.push_back(user);
+        }
+        continue;
+      }
+
+      // accesses through the pointer, but not of the pointer itself
+      if (isa<LoadInst>(user) && !cast<LoadInst>(user)->isVolatile()) {
+        continue;
+      }
+      if (isa<StoreInst>(user) && !cast<StoreInst>(user)->isVolatile() &&
+          use.getOperandNo() == StoreInst::getPointerOperandIndex()) {
+        continue;
+      }
+
+      // markers that do not access the object
+      if (isa<IntrinsicInst>(user) &&
+          (cast<IntrinsicInst>(user)->isLifetimeStartOrEnd() ||
+           is_debug_instruction(*cast<IntrinsicInst>(user)))) {
+        continue;
+      }
+
+      return false;
+    }
+  }
+  return true;
+}
+
+DocObject serialize_escape_info(const Value &ptr) {
+  DocObject result;
+  result["captured"] = PointerMayBeCaptured(&ptr, /* ReturnCaptures */ true,
+                                            /* StoreCaptures */ true);
+  result["constant_offsets"] = is_accessed_at_constant_offsets(ptr);
+  return result;
+}
+
+} // namespace
+
+namespace libra {
+
+cl::opt<bool> OptEscape("libra-escape", cl::init(false),
+                        cl::desc("Emit capture and access facts of allocas "
+                                 "and pointer arguments"));
+
+DocObject
+FunctionSerializationContext::serialize_escape(const Function &func) const {
+  // pointer arguments, null for other arguments
+  DocArray args;
+  for (const auto &arg : func.args()) {
+    if (arg.getType()->isPointerTy()) {
+      args.push_back(serialize_escape_info(arg));
+    } else {
+      args.push_back(DocValue(nullptr));
+    }
+  }
+
+  // stack objects, each tagged with its instruction index
+  DocArray allocas;
+  for (const auto &inst : instructions(func)) {
+    if (!isa<AllocaInst>(inst)) {
+      continue;
+    }
+    auto item = serialize_escape_info(inst);
+    item["inst"] = get_instruction(inst);
+    allocas.push_back(std::move(item));
+  }
+
+  DocObject result;
+  result["args"] = std::move(args);
+  result["allocas"] = std::move(allocas);
+  return result;
+}
+
+} // namespace libra
@@ -0,0 +1,58 @@
+#include "Serializer.h"
+
+namespace libra {
+
+cl::opt<bool> OptFrequency("libra-frequency", cl::init(false),
+                           cl::desc("Emit block frequencies and branch "
+                                    "probabilities of defined functions"));
+
+DocObject
+FunctionSerializationContext::serialize_frequency(const Function &func) const {
+  const auto &bfi = get_analysis<BlockFrequencyAnalysis>(func);
+  const auto &bpi = get_analysis<BranchProbabilityAnalysis>(func);
+
+  // relative frequencies, indexed by block label
+  DocArray block_freq;
+  for (const auto &block : func) {
+    block_freq.push_back(bfi.getBlockFreq(&block).getFrequency());
+  }
+
+  // edge probabilities in successor order, as numerators over a fixed
+  // denominator, and the profile weights of the terminator if present
+  DocArray edge_prob;
+  DocArray branch_weights;
+  for (const auto &block : func) {
+    const auto *term = block.getTerminator();
+
+    DocArray probs;
+    for (unsigned i = 0; i < term->getNumSuccessors(); i++) {
+      probs.push_back(bpi.getEdgeProbability(&block, i).getNumerator());
+    }
+    edge_prob.push_back(std::move(probs));
+
+    SmallVector<uint32_t, 8> weights;
+    if (extractBranchWeights(*term, weights)) {
+      DocArray items;
+      for (const auto weight : weights) {
+        items.push_back(weight);
+      }
+      branch_weights.push_back(std::move(items));
+    } else {
+      branch_weights.push_back(DocValue(nullptr));
+    }
+  }
+
+  DocObject result;
+  result["entry_freq"] =
+      bfi.getBlockFreq(&func.getEntryBlock()).getFrequency();
+  result["block_freq"] = std::move(block_freq);
+  result["prob_denominator"] = BranchProbability::getDenominator();
+  result["edge_prob"] = std::move(edge_prob);
+  result["branch_weights"] = std::move(branch_weights);
+  if (const auto count = func.getEntryCount()) {
+    result["entry_count"] = count->getCount();
+  }
+  return result;
+}
+
+} // namespace libra
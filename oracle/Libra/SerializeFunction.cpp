@@ -2,8 +2,10 @@
 
 namespace libra {
 
-json::Object serialize_function(const Function &func) {
-  json::Object result;
+DocObject serialize_function(const Function &func) {
+  TimeTraceScope scope("SerializeFunction",
+                       [&] { return func.getName().str(); });
+  DocObject result;
 
   // retrieve the context
   const auto iter = contexts.find(&func);
@@ -14,7 +16,7 @@ json::Object serialize_function(const Function &func) {
 
   // basics
   if (func.hasName()) {
-    result["name"] = func.getName();
+    result["name"] = serialize_name(func.getName());
   } else {
     LOG->error("unnamed function: {0}", func);
   }
@@ -24,32 +26,63 @@ json::Object serialize_function(const Function &func) {
   result["is_defined"] = !func.isDeclaration();
   result["is_exact"] = func.isDefinitionExact();
   result["is_intrinsic"] = is_intrinsic_function(func);
-  // TODO: additional attributes or metadata?
+  if (OptSummaries) {
+    result["summary"] = serialize_summary(func);
+  }
 
   // parameters
-  json::Array params;
+  DocArray params;
   for (const auto &param : func.args()) {
     params.push_back(serialize_parameter(param));
   }
   result["params"] = std::move(params);
 
   // deserialize the block
-  json::Array blocks;
-  for (const auto &block : func) {
-    blocks.push_back(ctxt.serialize_block(block));
+  if (OptColumnar) {
+    result["columns"] = ctxt.serialize_columns(func);
+  } else {
+    DocArray blocks;
+    for (const auto &block : func) {
+      blocks.push_back(ctxt.serialize_block(block));
+    }
+    result["blocks"] = std::move(blocks);
+  }
+
+  // analyses, on function bodies only
+  if (!func.isDeclaration()) {
+    if (OptDominance) {
+      result["dominance"] = ctxt.serialize_dominance(func);
+    }
+    if (OptLoops) {
+      result["loops"] = ctxt.serialize_loops(func);
+    }
+    if (OptMemorySSA) {
+      result["memory_ssa"] = ctxt.serialize_memory_ssa(func);
+    }
+    if (OptDefUse) {
+      result["def_use"] = ctxt.serialize_def_use(func);
+    }
+    if (OptValueFacts) {
+      result["value_facts"] = ctxt.serialize_value_facts(func);
+    }
+    if (OptEscape) {
+      result["escape"] = ctxt.serialize_escape(func);
+    }
+    if (OptFrequency) {
+      result["frequency"] = ctxt.serialize_frequency(func);
+    }
   }
-  result["blocks"] = std::move(blocks);
 
   return result;
 }
 
-json::Object serialize_parameter(const Argument &param) {
-  json::Object result;
+DocObject serialize_parameter(const Argument &param) {
+  DocObject result;
 
   // basics
   result["ty"] = serialize_type(*param.getType());
   if (param.hasName()) {
-    result["name"] = param.getName();
+    result["name"] = serialize_name(param.getName());
   }
 
   // argument-specific attrs
@@ -79,20 +112,21 @@ json::Object serialize_parameter(const Argument &param) {
   return result;
 }
 
-json::Object
+DocObject
 FunctionSerializationContext::serialize_block(const BasicBlock &block) const {
-  json::Object result;
+  TimeTraceScope scope("SerializeBlock");
+  DocObject result;
 
   // basics
   result["label"] = get_block(block);
   if (block.hasName()) {
-    result["name"] = block.getName();
+    result["name"] = serialize_name(block.getName());
   }
 
   // body
   const auto *term = block.getTerminator();
 
-  json::Array body;
+  DocArray body;
   for (const auto &inst : block) {
     // handle terminator separately
     if (term == &inst) {
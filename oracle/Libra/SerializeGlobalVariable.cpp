@@ -2,12 +2,12 @@
 
 namespace libra {
 
-json::Object serialize_global_variable(const GlobalVariable &gvar) {
-  json::Object result;
+DocObject serialize_global_variable(const GlobalVariable &gvar) {
+  DocObject result;
 
   // basics
   if (gvar.hasName()) {
-    result["name"] = gvar.getName();
+    result["name"] = serialize_name(gvar.getName());
   } else {
     LOG->error("unnamed global variable: {0}", gvar);
   }
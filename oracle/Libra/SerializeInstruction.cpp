@@ -15,39 +15,235 @@ std::string get_sync_scope_name(SyncScope::ID scope) {
   }
 }
 
+const char *get_opcode_name(unsigned opcode) {
+  switch (opcode) {
+  // unary
+  case Instruction::FNeg:
+    return "fneg";
+
+  // binary
+  case Instruction::Add:
+    return "add";
+  case Instruction::FAdd:
+    return "fadd";
+  case Instruction::Sub:
+    return "sub";
+  case Instruction::FSub:
+    return "fsub";
+  case Instruction::Mul:
+    return "mul";
+  case Instruction::FMul:
+    return "fmul";
+  case Instruction::UDiv:
+    return "udiv";
+  case Instruction::SDiv:
+    return "sdiv";
+  case Instruction::FDiv:
+    return "fdiv";
+  case Instruction::URem:
+    return "urem";
+  case Instruction::SRem:
+    return "srem";
+  case Instruction::FRem:
+    return "frem";
+  case Instruction::Shl:
+    return "shl";
+  case Instruction::LShr:
+    return "lshr";
+  case Instruction::AShr:
+    return "ashr";
+  case Instruction::And:
+    return "and";
+  case Instruction::Or:
+    return "or";
+  case Instruction::Xor:
+    return "xor";
+
+  // cast
+  case Instruction::Trunc:
+    return "trunc";
+  case Instruction::ZExt:
+    return "zext";
+  case Instruction::SExt:
+    return "sext";
+  case Instruction::FPToUI:
+    return "fp_to_ui";
+  case Instruction::FPToSI:
+    return "fp_to_si";
+  case Instruction::UIToFP:
+    return "ui_to_fp";
+  case Instruction::SIToFP:
+    return "si_to_fp";
+  case Instruction::FPTrunc:
+    return "fp_trunc";
+  case Instruction::FPExt:
+    return "fp_ext";
+  case Instruction::PtrToInt:
+    return "ptr_to_int";
+  case Instruction::IntToPtr:
+    return "int_to_ptr";
+  case Instruction::BitCast:
+    return "bitcast";
+  case Instruction::AddrSpaceCast:
+    return "address_space_cast";
+
+  // the others are told apart by the key of their entry instead
+  default:
+    return Instruction::getOpcodeName(opcode);
+  }
+}
+
+const char *get_predicate_name(CmpInst::Predicate pred) {
+  switch (pred) {
+  case CmpInst::FCMP_FALSE:
+    return "f_false";
+  case CmpInst::FCMP_OEQ:
+    return "f_oeq";
+  case CmpInst::FCMP_OGT:
+    return "f_ogt";
+  case CmpInst::FCMP_OGE:
+    return "f_oge";
+  case CmpInst::FCMP_OLT:
+    return "f_olt";
+  case CmpInst::FCMP_OLE:
+    return "f_ole";
+  case CmpInst::FCMP_ONE:
+    return "f_one";
+  case CmpInst::FCMP_ORD:
+    return "f_ord";
+  case CmpInst::FCMP_UNO:
+    return "f_uno";
+  case CmpInst::FCMP_UEQ:
+    return "f_ueq";
+  case CmpInst::FCMP_UGT:
+    return "f_ugt";
+  case CmpInst::FCMP_UGE:
+    return "f_uge";
+  case CmpInst::FCMP_ULT:
+    return "f_ult";
+  case CmpInst::FCMP_ULE:
+    return "f_ule";
+  case CmpInst::FCMP_UNE:
+    return "f_une";
+  case CmpInst::FCMP_TRUE:
+    return "f_true";
+  case CmpInst::ICMP_EQ:
+    return "i_eq";
+  case CmpInst::ICMP_NE:
+    return "i_ne";
+  case CmpInst::ICMP_UGT:
+    return "i_ugt";
+  case CmpInst::ICMP_UGE:
+    return "i_uge";
+  case CmpInst::ICMP_ULT:
+    return "i_ult";
+  case CmpInst::ICMP_ULE:
+    return "i_ule";
+  case CmpInst::ICMP_SGT:
+    return "i_sgt";
+  case CmpInst::ICMP_SGE:
+    return "i_sge";
+  case CmpInst::ICMP_SLT:
+    return "i_slt";
+  case CmpInst::ICMP_SLE:
+    return "i_sle";
+  case CmpInst::BAD_FCMP_PREDICATE:
+  case CmpInst::BAD_ICMP_PREDICATE:
+    break;
+  }
+  LOG->fatal("unexpected bad compare predicate");
+}
+
+const char *get_rmw_op_name(AtomicRMWInst::BinOp op) {
+  switch (op) {
+  case AtomicRMWInst::Xchg:
+    return "xchg";
+  case AtomicRMWInst::Add:
+    return "add";
+  case AtomicRMWInst::FAdd:
+    return "fadd";
+  case AtomicRMWInst::Sub:
+    return "sub";
+  case AtomicRMWInst::FSub:
+    return "fsub";
+  case AtomicRMWInst::UIncWrap:
+    return "uinc";
+  case AtomicRMWInst::UDecWrap:
+    return "udec";
+  case AtomicRMWInst::Max:
+    return "max";
+  case AtomicRMWInst::UMax:
+    return "umax";
+  case AtomicRMWInst::FMax:
+    return "fmax";
+  case AtomicRMWInst::Min:
+    return "min";
+  case AtomicRMWInst::UMin:
+    return "umin";
+  case AtomicRMWInst::FMin:
+    return "fmin";
+  case AtomicRMWInst::And:
+    return "and";
+  case AtomicRMWInst::Or:
+    return "or";
+  case AtomicRMWInst::Xor:
+    return "xor";
+  case AtomicRMWInst::Nand:
+    return "nand";
+  case AtomicRMWInst::BAD_BINOP:
+    break;
+  }
+  LOG->fatal("unexpected bad atomic-rmw operator");
+}
+
 } // namespace libra
 
 namespace libra {
 
-json::Object FunctionSerializationContext::serialize_instruction(
+cl::opt<bool> OptGepOffsets("libra-gep-offsets", cl::init(false),
+                            cl::desc("Emit byte offsets of GEPs folded "
+                                     "against the data layout"));
+
+DocObject FunctionSerializationContext::serialize_instruction(
     const Instruction &inst) const {
-  json::Object result;
+  DocObject result;
   result["ty"] = serialize_type(*inst.getType());
   result["index"] = get_instruction(inst);
   if (inst.hasName()) {
-    result["name"] = inst.getName();
+    result["name"] = serialize_name(inst.getName());
   }
   result["repr"] = serialize_inst(inst);
+  if (METADATA != nullptr) {
+    const auto alias_md = serialize_alias_metadata(inst);
+    if (alias_md.kind() != DocValue::Null) {
+      result["alias_md"] = alias_md;
+    }
+  }
   return result;
 }
 
-json::Object
+DocObject
 FunctionSerializationContext::serialize_inst(const Instruction &inst) const {
-  json::Object result;
+  DocObject result;
 
+  // dispatch on the opcode, which is a single jump table lookup
+  switch (inst.getOpcode()) {
   // memory
-  if (isa<AllocaInst>(inst)) {
+  case Instruction::Alloca:
     result["Alloca"] = serialize_inst_alloca(cast<AllocaInst>(inst));
-  } else if (isa<LoadInst>(inst)) {
+    break;
+  case Instruction::Load:
     result["Load"] = serialize_inst_load(cast<LoadInst>(inst));
-  } else if (isa<StoreInst>(inst)) {
+    break;
+  case Instruction::Store:
     result["Store"] = serialize_inst_store(cast<StoreInst>(inst));
-  } else if (isa<VAArgInst>(inst)) {
+    break;
+  case Instruction::VAArg:
     result["VAArg"] = serialize_inst_va_arg(cast<VAArgInst>(inst));
-  }
+    break;
 
   // call
-  else if (isa<CallInst>(inst)) {
+  case Instruction::Call: {
     const auto &call_inst = cast<CallInst>(inst);
     if (isa<IntrinsicInst>(call_inst)) {
       result["Intrinsic"] =
@@ -59,83 +255,131 @@ FunctionSerializationContext::serialize_inst(const Instruction &inst) const {
     } else {
       result["CallIndirect"] = serialize_inst_call_indirect(call_inst);
     }
+    break;
   }
 
   // unary, binary, comparison, and cast
-  else if (isa<UnaryOperator>(inst)) {
+  case Instruction::FNeg:
     result["Unary"] = serialize_inst_unary_operator(cast<UnaryOperator>(inst));
-  } else if (isa<BinaryOperator>(inst)) {
+    break;
+  case Instruction::Add:
+  case Instruction::FAdd:
+  case Instruction::Sub:
+  case Instruction::FSub:
+  case Instruction::Mul:
+  case Instruction::FMul:
+  case Instruction::UDiv:
+  case Instruction::SDiv:
+  case Instruction::FDiv:
+  case Instruction::URem:
+  case Instruction::SRem:
+  case Instruction::FRem:
+  case Instruction::Shl:
+  case Instruction::LShr:
+  case Instruction::AShr:
+  case Instruction::And:
+  case Instruction::Or:
+  case Instruction::Xor:
     result["Binary"] =
         serialize_inst_binary_operator(cast<BinaryOperator>(inst));
-  } else if (isa<CmpInst>(inst)) {
+    break;
+  case Instruction::ICmp:
+  case Instruction::FCmp:
     result["Compare"] = serialize_inst_compare(cast<CmpInst>(inst));
-  } else if (isa<CastInst>(inst)) {
+    break;
+  case Instruction::Trunc:
+  case Instruction::ZExt:
+  case Instruction::SExt:
+  case Instruction::FPToUI:
+  case Instruction::FPToSI:
+  case Instruction::UIToFP:
+  case Instruction::SIToFP:
+  case Instruction::FPTrunc:
+  case Instruction::FPExt:
+  case Instruction::PtrToInt:
+  case Instruction::IntToPtr:
+  case Instruction::BitCast:
+  case Instruction::AddrSpaceCast:
     result["Cast"] = serialize_inst_cast(cast<CastInst>(inst));
-  } else if (isa<FreezeInst>(inst)) {
+    break;
+  case Instruction::Freeze:
     result["Freeze"] = serialize_inst_freeze(cast<FreezeInst>(inst));
-  }
+    break;
 
   // pointer arithmetic
-  else if (isa<GetElementPtrInst>(inst)) {
+  case Instruction::GetElementPtr:
     result["GEP"] = serialize_inst_gep(cast<GetElementPtrInst>(inst));
-  }
+    break;
 
   // choice
-  else if (isa<PHINode>(inst)) {
+  case Instruction::PHI:
     result["Phi"] = serialize_inst_phi(cast<PHINode>(inst));
-  } else if (isa<SelectInst>(inst)) {
+    break;
+  case Instruction::Select:
     result["ITE"] = serialize_inst_ite(cast<SelectInst>(inst));
-  }
+    break;
 
   // aggregates
-  else if (isa<ExtractValueInst>(inst)) {
+  case Instruction::ExtractValue:
     result["GetValue"] = serialize_inst_get_value(cast<ExtractValueInst>(inst));
-  } else if (isa<InsertValueInst>(inst)) {
+    break;
+  case Instruction::InsertValue:
     result["SetValue"] = serialize_inst_set_value(cast<InsertValueInst>(inst));
-  } else if (isa<ExtractElementInst>(inst)) {
+    break;
+  case Instruction::ExtractElement:
     result["GetElement"] =
         serialize_inst_get_element(cast<ExtractElementInst>(inst));
-  } else if (isa<InsertElementInst>(inst)) {
+    break;
+  case Instruction::InsertElement:
     result["SetElement"] =
         serialize_inst_set_element(cast<InsertElementInst>(inst));
-  } else if (isa<ShuffleVectorInst>(inst)) {
+    break;
+  case Instruction::ShuffleVector:
     result["ShuffleVector"] =
         serialize_inst_shuffle_vector(cast<ShuffleVectorInst>(inst));
-  }
+    break;
 
   // concurrency instructions
-  else if (isa<FenceInst>(inst)) {
+  case Instruction::Fence:
     result["Fence"] = serialize_inst_fence(cast<FenceInst>(inst));
-  } else if (isa<AtomicCmpXchgInst>(inst)) {
+    break;
+  case Instruction::AtomicCmpXchg:
     result["AtomicCmpXchg"] =
         serialize_inst_atomic_cmpxchg(cast<AtomicCmpXchgInst>(inst));
-  } else if (isa<AtomicRMWInst>(inst)) {
+    break;
+  case Instruction::AtomicRMW:
     result["AtomicRMW"] = serialize_inst_atomic_rmw(cast<AtomicRMWInst>(inst));
-  }
+    break;
 
   // exception handling (non-terminator)
-  else if (isa<LandingPadInst>(inst)) {
+  case Instruction::LandingPad:
     result["LandingPad"] =
         serialize_inst_landing_pad(cast<LandingPadInst>(inst));
-  } else if (isa<CatchPadInst>(inst)) {
+    break;
+  case Instruction::CatchPad:
     // TODO: (Windows EH) give details on the CatchPadInst
-    result["CatchPad"] = json::Value(nullptr);
-  } else if (isa<CleanupPadInst>(inst)) {
+    result["CatchPad"] = DocValue(nullptr);
+    break;
+  case Instruction::CleanupPad:
     // TODO: (Windows EH) give details on the CleanupPadInst
-    result["CleanupPad"] = json::Value(nullptr);
-  }
+    result["CleanupPad"] = DocValue(nullptr);
+    break;
 
   // terminators
-  else if (isa<ReturnInst>(inst)) {
+  case Instruction::Ret:
     result["Return"] = serialize_inst_return(cast<ReturnInst>(inst));
-  } else if (isa<BranchInst>(inst)) {
+    break;
+  case Instruction::Br:
     result["Branch"] = serialize_inst_branch(cast<BranchInst>(inst));
-  } else if (isa<SwitchInst>(inst)) {
+    break;
+  case Instruction::Switch:
     result["Switch"] = serialize_inst_switch(cast<SwitchInst>(inst));
-  } else if (isa<IndirectBrInst>(inst)) {
+    break;
+  case Instruction::IndirectBr:
     result["IndirectJump"] =
         serialize_inst_jump_indirect(cast<IndirectBrInst>(inst));
-  } else if (isa<InvokeInst>(inst)) {
+    break;
+  case Instruction::Invoke: {
     const auto &invoke_inst = cast<InvokeInst>(inst);
     if (invoke_inst.isInlineAsm()) {
       result["InvokeAsm"] = serialize_inst_invoke_asm(invoke_inst);
@@ -144,43 +388,48 @@ FunctionSerializationContext::serialize_inst(const Instruction &inst) const {
     } else {
       result["InvokeIndirect"] = serialize_inst_invoke_indirect(invoke_inst);
     }
-  } else if (isa<ResumeInst>(inst)) {
-    result["Resume"] = serialize_inst_resume(cast<ResumeInst>(inst));
-  } else if (isa<UnreachableInst>(inst)) {
-    result["Unreachable"] = json::Value(nullptr);
+    break;
   }
+  case Instruction::Resume:
+    result["Resume"] = serialize_inst_resume(cast<ResumeInst>(inst));
+    break;
+  case Instruction::Unreachable:
+    result["Unreachable"] = DocValue(nullptr);
+    break;
 
   // exception handling (terminator)
-  else if (isa<CatchSwitchInst>(inst)) {
+  case Instruction::CatchSwitch:
     // TODO: (Windows EH) give details on the CatchSwitchInst
-    result["CatchSwitch"] = json::Value(nullptr);
-  } else if (isa<CatchReturnInst>(inst)) {
+    result["CatchSwitch"] = DocValue(nullptr);
+    break;
+  case Instruction::CatchRet:
     // TODO: (Windows EH) give details on the CatchReturnInst
-    result["CatchReturn"] = json::Value(nullptr);
-  } else if (isa<CleanupReturnInst>(inst)) {
+    result["CatchReturn"] = DocValue(nullptr);
+    break;
+  case Instruction::CleanupRet:
     // TODO: (Windows EH) give details on the CleanupReturnInst
-    result["CleanupReturn"] = json::Value(nullptr);
-  }
+    result["CleanupReturn"] = DocValue(nullptr);
+    break;
 
   // very rare cases (terminator)
-  else if (isa<CallBrInst>(inst)) {
+  case Instruction::CallBr:
     // TODO: not handled due to rarity, as noted from LLVM reference,
     //   "This instruction should only be used to implement the `goto` feature
     //   of gcc style inline assembly."
-    result["CallBranch"] = json::Value(nullptr);
-  }
+    result["CallBranch"] = DocValue(nullptr);
+    break;
 
   // should have exhausted all valid cases
-  else {
+  default:
     LOG->fatal("unknown instruction: {0}", inst);
   }
 
   return result;
 }
 
-json::Object FunctionSerializationContext::serialize_inst_alloca(
+DocObject FunctionSerializationContext::serialize_inst_alloca(
     const AllocaInst &inst) const {
-  json::Object result;
+  DocObject result;
   result["allocated_type"] = serialize_type(*inst.getAllocatedType());
   if (inst.isArrayAllocation()) {
     result["size"] = serialize_value(*inst.getArraySize());
@@ -189,9 +438,9 @@ json::Object FunctionSerializationContext::serialize_inst_alloca(
   return result;
 }
 
-json::Object
+DocObject
 FunctionSerializationContext::serialize_inst_load(const LoadInst &inst) const {
-  json::Object result;
+  DocObject result;
   result["pointee_type"] = serialize_type(*inst.getType());
   result["pointer"] = serialize_value(*inst.getPointerOperand());
   result["ordering"] = toIRString(inst.getOrdering());
@@ -199,9 +448,9 @@ FunctionSerializationContext::serialize_inst_load(const LoadInst &inst) const {
   return result;
 }
 
-json::Object FunctionSerializationContext::serialize_inst_store(
+DocObject FunctionSerializationContext::serialize_inst_store(
     const StoreInst &inst) const {
-  json::Object result;
+  DocObject result;
   result["pointee_type"] = serialize_type(*inst.getValueOperand()->getType());
   result["pointer"] = serialize_value(*inst.getPointerOperand());
   result["value"] = serialize_value(*inst.getValueOperand());
@@ -210,21 +459,20 @@ json::Object FunctionSerializationContext::serialize_inst_store(
   return result;
 }
 
-json::Object FunctionSerializationContext::serialize_inst_va_arg(
+DocObject FunctionSerializationContext::serialize_inst_va_arg(
     const VAArgInst &inst) const {
-  json::Object result;
+  DocObject result;
   result["pointer"] = serialize_value(*inst.getPointerOperand());
   return result;
 }
 
-[[nodiscard]] json::Object
-FunctionSerializationContext::serialize_inst_call_asm(
+[[nodiscard]] DocObject FunctionSerializationContext::serialize_inst_call_asm(
     const CallInst &inst) const {
-  json::Object result;
+  DocObject result;
   result["asm"] =
       serialize_inline_asm(*cast<InlineAsm>(inst.getCalledOperand()));
 
-  json::Array args;
+  DocArray args;
   for (const auto &arg : inst.args()) {
     args.push_back(serialize_value(*arg.get()));
   }
@@ -232,14 +480,14 @@ FunctionSerializationContext::serialize_inst_call_asm(
   return result;
 }
 
-[[nodiscard]] json::Object
+[[nodiscard]] DocObject
 FunctionSerializationContext::serialize_inst_call_direct(
     const CallInst &inst) const {
-  json::Object result;
+  DocObject result;
   result["callee"] = serialize_value(*inst.getCalledOperand());
   result["target_type"] = serialize_type(*inst.getFunctionType());
 
-  json::Array args;
+  DocArray args;
   for (const auto &arg : inst.args()) {
     args.push_back(serialize_value(*arg.get()));
   }
@@ -247,14 +495,14 @@ FunctionSerializationContext::serialize_inst_call_direct(
   return result;
 }
 
-[[nodiscard]] json::Object
+[[nodiscard]] DocObject
 FunctionSerializationContext::serialize_inst_call_indirect(
     const CallInst &inst) const {
-  json::Object result;
+  DocObject result;
   result["callee"] = serialize_value(*inst.getCalledOperand());
   result["target_type"] = serialize_type(*inst.getFunctionType());
 
-  json::Array args;
+  DocArray args;
   for (const auto &arg : inst.args()) {
     args.push_back(serialize_value(*arg.get()));
   }
@@ -262,14 +510,21 @@ FunctionSerializationContext::serialize_inst_call_indirect(
   return result;
 }
 
-[[nodiscard]] json::Object
+[[nodiscard]] DocObject
 FunctionSerializationContext::serialize_inst_call_intrinsic(
     const IntrinsicInst &inst) const {
-  json::Object result;
-  result["callee"] = serialize_value(*inst.getCalledOperand());
+  DocObject result;
+  // the overload is told by the target type, llvm.* functions that LLVM
+  // does not recognize have no intrinsic ID and keep their callee
+  const auto id = inst.getIntrinsicID();
+  if (OptNumericCodes && id != Intrinsic::not_intrinsic) {
+    result["intrinsic"] = static_cast<uint64_t>(id);
+  } else {
+    result["callee"] = serialize_value(*inst.getCalledOperand());
+  }
   result["target_type"] = serialize_type(*inst.getFunctionType());
 
-  json::Array args;
+  DocArray args;
   for (const auto &arg : inst.args()) {
     args.push_back(serialize_value(*arg.get()));
   }
@@ -277,106 +532,30 @@ FunctionSerializationContext::serialize_inst_call_intrinsic(
   return result;
 }
 
-[[nodiscard]] json::Object
+[[nodiscard]] DocObject
 FunctionSerializationContext::serialize_inst_unary_operator(
     const UnaryOperator &inst) const {
-  json::Object result;
+  DocObject result;
 
-  switch (inst.getOpcode()) {
-  case Instruction::UnaryOps::FNeg: {
-    result["opcode"] = "fneg";
-    break;
-  }
-  case Instruction::UnaryOpsEnd: {
-    LOG->fatal("unexpected end of unary ops");
-  }
+  if (OptNumericCodes) {
+    result["opcode"] = static_cast<uint64_t>(inst.getOpcode());
+  } else {
+    result["opcode"] = get_opcode_name(inst.getOpcode());
   }
 
   result["operand"] = serialize_value(*inst.getOperand(0));
   return result;
 }
 
-[[nodiscard]] json::Object
+[[nodiscard]] DocObject
 FunctionSerializationContext::serialize_inst_binary_operator(
     const BinaryOperator &inst) const {
-  json::Object result;
+  DocObject result;
 
-  switch (inst.getOpcode()) {
-  case Instruction::BinaryOps::Add: {
-    result["opcode"] = "add";
-    break;
-  }
-  case Instruction::BinaryOps::FAdd: {
-    result["opcode"] = "fadd";
-    break;
-  }
-  case Instruction::BinaryOps::Sub: {
-    result["opcode"] = "sub";
-    break;
-  }
-  case Instruction::BinaryOps::FSub: {
-    result["opcode"] = "fsub";
-    break;
-  }
-  case Instruction::BinaryOps::Mul: {
-    result["opcode"] = "mul";
-    break;
-  }
-  case Instruction::BinaryOps::FMul: {
-    result["opcode"] = "fmul";
-    break;
-  }
-  case Instruction::BinaryOps::UDiv: {
-    result["opcode"] = "udiv";
-    break;
-  }
-  case Instruction::BinaryOps::SDiv: {
-    result["opcode"] = "sdiv";
-    break;
-  }
-  case Instruction::BinaryOps::FDiv: {
-    result["opcode"] = "fdiv";
-    break;
-  }
-  case Instruction::BinaryOps::URem: {
-    result["opcode"] = "urem";
-    break;
-  }
-  case Instruction::BinaryOps::SRem: {
-    result["opcode"] = "srem";
-    break;
-  }
-  case Instruction::BinaryOps::FRem: {
-    result["opcode"] = "frem";
-    break;
-  }
-  case Instruction::BinaryOps::Shl: {
-    result["opcode"] = "shl";
-    break;
-  }
-  case Instruction::BinaryOps::LShr: {
-    result["opcode"] = "lshr";
-    break;
-  }
-  case Instruction::BinaryOps::AShr: {
-    result["opcode"] = "ashr";
-    break;
-  }
-  case Instruction::BinaryOps::And: {
-    result["opcode"] = "and";
-    break;
-  }
-  case Instruction::BinaryOps::Or: {
-    result["opcode"] = "or";
-    break;
-  }
-  case Instruction::BinaryOps::Xor: {
-    result["opcode"] = "xor";
-    break;
-  }
-  case Instruction::BinaryOpsEnd: {
-    LOG->fatal("unexpected end of binary ops");
-  }
+  if (OptNumericCodes) {
+    result["opcode"] = static_cast<uint64_t>(inst.getOpcode());
+  } else {
+    result["opcode"] = get_opcode_name(inst.getOpcode());
   }
   // TODO: flags (NSW, NUW, Exact)? maybe not needed?
   result["lhs"] = serialize_value(*inst.getOperand(0));
@@ -384,119 +563,14 @@ FunctionSerializationContext::serialize_inst_binary_operator(
   return result;
 }
 
-[[nodiscard]] json::Object FunctionSerializationContext::serialize_inst_compare(
+[[nodiscard]] DocObject FunctionSerializationContext::serialize_inst_compare(
     const CmpInst &inst) const {
-  json::Object result;
+  DocObject result;
 
-  switch (inst.getPredicate()) {
-  case CmpInst::Predicate::FCMP_FALSE: {
-    result["predicate"] = "f_false";
-    break;
-  }
-  case CmpInst::Predicate::FCMP_OEQ: {
-    result["predicate"] = "f_oeq";
-    break;
-  }
-  case CmpInst::Predicate::FCMP_OGT: {
-    result["predicate"] = "f_ogt";
-    break;
-  }
-  case CmpInst::Predicate::FCMP_OGE: {
-    result["predicate"] = "f_oge";
-    break;
-  }
-  case CmpInst::Predicate::FCMP_OLT: {
-    result["predicate"] = "f_olt";
-    break;
-  }
-  case CmpInst::Predicate::FCMP_OLE: {
-    result["predicate"] = "f_ole";
-    break;
-  }
-  case CmpInst::Predicate::FCMP_ONE: {
-    result["predicate"] = "f_one";
-    break;
-  }
-  case CmpInst::Predicate::FCMP_ORD: {
-    result["predicate"] = "f_ord";
-    break;
-  }
-  case CmpInst::Predicate::FCMP_UNO: {
-    result["predicate"] = "f_uno";
-    break;
-  }
-  case CmpInst::Predicate::FCMP_UEQ: {
-    result["predicate"] = "f_ueq";
-    break;
-  }
-  case CmpInst::Predicate::FCMP_UGT: {
-    result["predicate"] = "f_ugt";
-    break;
-  }
-  case CmpInst::Predicate::FCMP_UGE: {
-    result["predicate"] = "f_uge";
-    break;
-  }
-  case CmpInst::Predicate::FCMP_ULT: {
-    result["predicate"] = "f_ult";
-    break;
-  }
-  case CmpInst::Predicate::FCMP_ULE: {
-    result["predicate"] = "f_ule";
-    break;
-  }
-  case CmpInst::Predicate::FCMP_UNE: {
-    result["predicate"] = "f_une";
-    break;
-  }
-  case CmpInst::Predicate::FCMP_TRUE: {
-    result["predicate"] = "f_true";
-    break;
-  }
-  case CmpInst::Predicate::ICMP_EQ: {
-    result["predicate"] = "i_eq";
-    break;
-  }
-  case CmpInst::Predicate::ICMP_NE: {
-    result["predicate"] = "i_ne";
-    break;
-  }
-  case CmpInst::Predicate::ICMP_UGT: {
-    result["predicate"] = "i_ugt";
-    break;
-  }
-  case CmpInst::Predicate::ICMP_UGE: {
-    result["predicate"] = "i_uge";
-    break;
-  }
-  case CmpInst::Predicate::ICMP_ULT: {
-    result["predicate"] = "i_ult";
-    break;
-  }
-  case CmpInst::Predicate::ICMP_ULE: {
-    result["predicate"] = "i_ule";
-    break;
-  }
-  case CmpInst::Predicate::ICMP_SGT: {
-    result["predicate"] = "i_sgt";
-    break;
-  }
-  case CmpInst::Predicate::ICMP_SGE: {
-    result["predicate"] = "i_sge";
-    break;
-  }
-  case CmpInst::Predicate::ICMP_SLT: {
-    result["predicate"] = "i_slt";
-    break;
-  }
-  case CmpInst::Predicate::ICMP_SLE: {
-    result["predicate"] = "i_sle";
-    break;
-  }
-  case CmpInst::Predicate::BAD_FCMP_PREDICATE:
-  case CmpInst::Predicate::BAD_ICMP_PREDICATE: {
-    LOG->fatal("unexpected bad compare predicate");
-  }
+  if (OptNumericCodes) {
+    result["predicate"] = static_cast<uint64_t>(inst.getPredicate());
+  } else {
+    result["predicate"] = get_predicate_name(inst.getPredicate());
   }
 
   result["operand_type"] = serialize_type(*inst.getOperand(0)->getType());
@@ -505,73 +579,31 @@ FunctionSerializationContext::serialize_inst_binary_operator(
   return result;
 }
 
-[[nodiscard]] json::Object
+[[nodiscard]] DocObject
 FunctionSerializationContext::serialize_inst_cast(const CastInst &inst) const {
-  json::Object result;
+  DocObject result;
 
-  switch (inst.getOpcode()) {
-  case Instruction::CastOps::Trunc: {
-    result["opcode"] = "trunc";
-    break;
-  }
-  case Instruction::CastOps::ZExt: {
-    result["opcode"] = "zext";
-    break;
-  }
-  case Instruction::CastOps::SExt: {
-    result["opcode"] = "sext";
-    break;
-  }
-  case Instruction::CastOps::FPToUI: {
-    result["opcode"] = "fp_to_ui";
-    break;
-  }
-  case Instruction::CastOps::FPToSI: {
-    result["opcode"] = "fp_to_si";
-    break;
-  }
-  case Instruction::CastOps::UIToFP: {
-    result["opcode"] = "ui_to_fp";
-    break;
-  }
-  case Instruction::CastOps::SIToFP: {
-    result["opcode"] = "si_to_fp";
-    break;
-  }
-  case Instruction::CastOps::FPTrunc: {
-    result["opcode"] = "fp_trunc";
-    break;
+  if (OptNumericCodes) {
+    result["opcode"] = static_cast<uint64_t>(inst.getOpcode());
+  } else {
+    result["opcode"] = get_opcode_name(inst.getOpcode());
   }
-  case Instruction::CastOps::FPExt: {
-    result["opcode"] = "fp_ext";
-    break;
-  }
-  case Instruction::CastOps::PtrToInt: {
-    result["opcode"] = "ptr_to_int";
+  switch (inst.getOpcode()) {
+  case Instruction::PtrToInt:
     result["src_address_space"] =
         cast<PtrToIntInst>(inst).getPointerAddressSpace();
     break;
-  }
-  case Instruction::CastOps::IntToPtr: {
-    result["opcode"] = "int_to_ptr";
+  case Instruction::IntToPtr:
     result["dst_address_space"] = cast<IntToPtrInst>(inst).getAddressSpace();
     break;
-  }
-  case Instruction::CastOps::BitCast: {
-    result["opcode"] = "bitcast";
-    break;
-  }
-  case Instruction::CastOps::AddrSpaceCast: {
-    result["opcode"] = "address_space_cast";
+  case Instruction::AddrSpaceCast:
     result["src_address_space"] =
         cast<AddrSpaceCastInst>(inst).getSrcAddressSpace();
     result["dst_address_space"] =
         cast<AddrSpaceCastInst>(inst).getDestAddressSpace();
     break;
-  }
-  case Instruction::CastOpsEnd: {
-    LOG->fatal("unexpected end of cast ops");
-  }
+  default:
+    break;
   }
 
   result["src_ty"] = serialize_type(*inst.getSrcTy());
@@ -580,37 +612,73 @@ FunctionSerializationContext::serialize_inst_cast(const CastInst &inst) const {
   return result;
 }
 
-[[nodiscard]] json::Object FunctionSerializationContext::serialize_inst_freeze(
+[[nodiscard]] DocObject FunctionSerializationContext::serialize_inst_freeze(
     const FreezeInst &inst) const {
-  json::Object result;
+  DocObject result;
   result["operand"] = serialize_value(*inst.getOperand(0));
   return result;
 }
 
-json::Object FunctionSerializationContext::serialize_inst_gep(
+DocObject FunctionSerializationContext::serialize_inst_gep(
     const GetElementPtrInst &inst) const {
-  json::Object result;
+  DocObject result;
   result["src_pointee_ty"] = serialize_type(*inst.getSourceElementType());
   result["dst_pointee_ty"] = serialize_type(*inst.getResultElementType());
 
   result["pointer"] = serialize_value(*inst.getPointerOperand());
-  json::Array indices;
+  DocArray indices;
   for (const auto &idx : inst.indices()) {
     indices.push_back(serialize_value(*idx.get()));
   }
   result["indices"] = std::move(indices);
 
   result["address_space"] = inst.getAddressSpace();
+
+  if (OptGepOffsets) {
+    result["offset"] = serialize_gep_offset(inst);
+  }
   return result;
 }
 
-json::Object
+DocValue FunctionSerializationContext::serialize_gep_offset(
+    const GetElementPtrInst &inst) const {
+  // constant expressions are also serialized as instructions in the module
+  const auto &layout = inst.getModule()->getDataLayout();
+  const auto &gep = cast<GEPOperator>(inst);
+  const auto width = layout.getIndexTypeSizeInBits(gep.getType());
+
+  // offset = constant + sum(index * scale), null if it cannot be decomposed
+  MapVector<Value *, APInt> var_offsets;
+  APInt const_offset(width, 0);
+  if (!gep.collectOffset(layout, width, var_offsets, const_offset) ||
+      !const_offset.isSignedIntN(64)) {
+    return DocValue(nullptr);
+  }
+
+  DocArray variables;
+  for (const auto &[index, scale] : var_offsets) {
+    if (!scale.isSignedIntN(64)) {
+      return DocValue(nullptr);
+    }
+    DocObject item;
+    item["index"] = serialize_value(*index);
+    item["scale"] = scale.getSExtValue();
+    variables.push_back(std::move(item));
+  }
+
+  DocObject result;
+  result["constant"] = const_offset.getSExtValue();
+  result["variables"] = std::move(variables);
+  return result;
+}
+
+DocObject
 FunctionSerializationContext::serialize_inst_phi(const PHINode &inst) const {
-  json::Object result;
+  DocObject result;
 
-  json::Array blocks;
+  DocArray blocks;
   for (const auto *block : inst.blocks()) {
-    json::Object item;
+    DocObject item;
     item["block"] = get_block(*block);
     item["value"] = serialize_value(*inst.getIncomingValueForBlock(block));
     blocks.push_back(std::move(item));
@@ -620,21 +688,21 @@ FunctionSerializationContext::serialize_inst_phi(const PHINode &inst) const {
   return result;
 }
 
-json::Object
+DocObject
 FunctionSerializationContext::serialize_inst_ite(const SelectInst &inst) const {
-  json::Object result;
+  DocObject result;
   result["cond"] = serialize_value(*inst.getCondition());
   result["then_value"] = serialize_value(*inst.getTrueValue());
   result["else_value"] = serialize_value(*inst.getFalseValue());
   return result;
 }
 
-json::Object FunctionSerializationContext::serialize_inst_get_value(
+DocObject FunctionSerializationContext::serialize_inst_get_value(
     const ExtractValueInst &inst) const {
-  json::Object result;
+  DocObject result;
   result["from_ty"] = serialize_type(*inst.getAggregateOperand()->getType());
   result["aggregate"] = serialize_value(*inst.getAggregateOperand());
-  json::Array indices;
+  DocArray indices;
   for (const auto idx : inst.indices()) {
     indices.push_back(idx);
   }
@@ -642,12 +710,12 @@ json::Object FunctionSerializationContext::serialize_inst_get_value(
   return result;
 }
 
-json::Object FunctionSerializationContext::serialize_inst_set_value(
+DocObject FunctionSerializationContext::serialize_inst_set_value(
     const InsertValueInst &inst) const {
-  json::Object result;
+  DocObject result;
   result["aggregate"] = serialize_value(*inst.getAggregateOperand());
   result["value"] = serialize_value(*inst.getInsertedValueOperand());
-  json::Array indices;
+  DocArray indices;
   for (const auto idx : inst.indices()) {
     indices.push_back(idx);
   }
@@ -655,30 +723,30 @@ json::Object FunctionSerializationContext::serialize_inst_set_value(
   return result;
 }
 
-json::Object FunctionSerializationContext::serialize_inst_get_element(
+DocObject FunctionSerializationContext::serialize_inst_get_element(
     const ExtractElementInst &inst) const {
-  json::Object result;
+  DocObject result;
   result["vec_ty"] = serialize_type(*inst.getVectorOperandType());
   result["vector"] = serialize_value(*inst.getVectorOperand());
   result["slot"] = serialize_value(*inst.getIndexOperand());
   return result;
 }
 
-json::Object FunctionSerializationContext::serialize_inst_set_element(
+DocObject FunctionSerializationContext::serialize_inst_set_element(
     const InsertElementInst &inst) const {
-  json::Object result;
+  DocObject result;
   result["vector"] = serialize_value(*inst.getOperand(0));
   result["value"] = serialize_value(*inst.getOperand(1));
   result["slot"] = serialize_value(*inst.getOperand(2));
   return result;
 }
 
-json::Object FunctionSerializationContext::serialize_inst_shuffle_vector(
+DocObject FunctionSerializationContext::serialize_inst_shuffle_vector(
     const ShuffleVectorInst &inst) const {
-  json::Object result;
+  DocObject result;
   result["lhs"] = serialize_value(*inst.getOperand(0));
   result["rhs"] = serialize_value(*inst.getOperand(1));
-  json::Array mask;
+  DocArray mask;
   for (const auto val : inst.getShuffleMask()) {
     mask.push_back(val);
   }
@@ -686,17 +754,17 @@ json::Object FunctionSerializationContext::serialize_inst_shuffle_vector(
   return result;
 }
 
-json::Object FunctionSerializationContext::serialize_inst_fence(
+DocObject FunctionSerializationContext::serialize_inst_fence(
     const FenceInst &inst) const {
-  json::Object result;
+  DocObject result;
   result["ordering"] = toIRString(inst.getOrdering());
   result["scope"] = get_sync_scope_name(inst.getSyncScopeID());
   return result;
 }
 
-json::Object FunctionSerializationContext::serialize_inst_atomic_cmpxchg(
+DocObject FunctionSerializationContext::serialize_inst_atomic_cmpxchg(
     const AtomicCmpXchgInst &inst) const {
-  json::Object result;
+  DocObject result;
 
   // basics
   result["pointee_type"] = serialize_type(*inst.getType());
@@ -713,9 +781,9 @@ json::Object FunctionSerializationContext::serialize_inst_atomic_cmpxchg(
   return result;
 }
 
-json::Object FunctionSerializationContext::serialize_inst_atomic_rmw(
+DocObject FunctionSerializationContext::serialize_inst_atomic_rmw(
     const AtomicRMWInst &inst) const {
-  json::Object result;
+  DocObject result;
 
   // basics
   result["pointee_type"] = serialize_type(*inst.getType());
@@ -724,61 +792,7 @@ json::Object FunctionSerializationContext::serialize_inst_atomic_rmw(
   result["address_space"] = inst.getPointerAddressSpace();
 
   // operand
-  switch (inst.getOperation()) {
-  case AtomicRMWInst::BinOp::Xchg:
-    result["opcode"] = "xchg";
-    break;
-  case AtomicRMWInst::BinOp::Add:
-    result["opcode"] = "add";
-    break;
-  case AtomicRMWInst::BinOp::FAdd:
-    result["opcode"] = "fadd";
-    break;
-  case AtomicRMWInst::BinOp::Sub:
-    result["opcode"] = "sub";
-    break;
-  case AtomicRMWInst::BinOp::FSub:
-    result["opcode"] = "fsub";
-    break;
-  case AtomicRMWInst::BinOp::UIncWrap:
-    result["opcode"] = "uinc";
-    break;
-  case AtomicRMWInst::BinOp::UDecWrap:
-    result["opcode"] = "udec";
-    break;
-  case AtomicRMWInst::BinOp::Max:
-    result["opcode"] = "max";
-    break;
-  case AtomicRMWInst::BinOp::UMax:
-    result["opcode"] = "umax";
-    break;
-  case AtomicRMWInst::BinOp::FMax:
-    result["opcode"] = "fmax";
-    break;
-  case AtomicRMWInst::BinOp::Min:
-    result["opcode"] = "min";
-    break;
-  case AtomicRMWInst::BinOp::UMin:
-    result["opcode"] = "umin";
-    break;
-  case AtomicRMWInst::BinOp::FMin:
-    result["opcode"] = "fmin";
-    break;
-  case AtomicRMWInst::BinOp::And:
-    result["opcode"] = "and";
-    break;
-  case AtomicRMWInst::BinOp::Or:
-    result["opcode"] = "or";
-    break;
-  case AtomicRMWInst::BinOp::Xor:
-    result["opcode"] = "xor";
-    break;
-  case AtomicRMWInst::BinOp::Nand:
-    result["opcode"] = "nand";
-    break;
-  case AtomicRMWInst::BinOp::BAD_BINOP:
-    LOG->fatal("unexpected bad atomic-rmw operator");
-  }
+  result["opcode"] = get_rmw_op_name(inst.getOperation());
 
   // atomicity
   result["ordering"] = toIRString(inst.getOrdering());
@@ -787,19 +801,19 @@ json::Object FunctionSerializationContext::serialize_inst_atomic_rmw(
   return result;
 }
 
-json::Object FunctionSerializationContext::serialize_inst_landing_pad(
+DocObject FunctionSerializationContext::serialize_inst_landing_pad(
     const LandingPadInst &inst) const {
-  json::Object result;
+  DocObject result;
 
-  json::Array clauses;
+  DocArray clauses;
   for (unsigned i = 0; i < inst.getNumClauses(); i++) {
-    json::Object item;
+    DocObject item;
 
     const auto *clause = inst.getClause(i);
     if (inst.isCatch(i)) {
       // If @ExcType is null, any exception matches
       if (isa<ConstantPointerNull>(clause)) {
-        item["CatchAll"] = json::Value(nullptr);
+        item["CatchAll"] = DocValue(nullptr);
       }
       // otherwise, this should be a global variable
       else if (isa<GlobalValue>(clause)) {
@@ -807,7 +821,7 @@ json::Object FunctionSerializationContext::serialize_inst_landing_pad(
         if (!handler->hasName()) {
           LOG->fatal("catch clause does not refer to a named global");
         }
-        item["CatchOne"] = handler->getName();
+        item["CatchOne"] = serialize_name(handler->getName());
       }
       // no other cases are allowed
       else {
@@ -816,11 +830,11 @@ json::Object FunctionSerializationContext::serialize_inst_landing_pad(
     } else if (inst.isFilter(i)) {
       // "[0 x ptr] undef" represents for a filter which cannot throw
       if (isa<UndefValue>(clause) || isa<ConstantAggregateZero>(clause)) {
-        item["FilterAll"] = json::Value(nullptr);
+        item["FilterAll"] = DocValue(nullptr);
       }
       // otherwise it should be a constant array
       else if (isa<ConstantArray>(clause)) {
-        json::Array elements;
+        DocArray elements;
 
         bool shortcut = false;
         const auto *entries = cast<ConstantArray>(clause);
@@ -841,11 +855,11 @@ json::Object FunctionSerializationContext::serialize_inst_landing_pad(
           if (!handler->hasName()) {
             LOG->fatal("filter clause does not refer to a named global");
           }
-          elements.push_back(handler->getName());
+          elements.push_back(serialize_name(handler->getName()));
         }
 
         if (shortcut) {
-          item["FilterAll"] = json::Value(nullptr);
+          item["FilterAll"] = DocValue(nullptr);
         } else {
           item["FilterOne"] = std::move(elements);
         }
@@ -867,9 +881,9 @@ json::Object FunctionSerializationContext::serialize_inst_landing_pad(
   return result;
 }
 
-json::Object FunctionSerializationContext::serialize_inst_return(
+DocObject FunctionSerializationContext::serialize_inst_return(
     const ReturnInst &inst) const {
-  json::Object result;
+  DocObject result;
   const auto *rv = inst.getReturnValue();
   if (rv != nullptr) {
     result["value"] = serialize_value(*inst.getReturnValue());
@@ -877,13 +891,13 @@ json::Object FunctionSerializationContext::serialize_inst_return(
   return result;
 }
 
-json::Object FunctionSerializationContext::serialize_inst_branch(
+DocObject FunctionSerializationContext::serialize_inst_branch(
     const BranchInst &inst) const {
-  json::Object result;
+  DocObject result;
   if (inst.isConditional()) {
     result["cond"] = serialize_value(*inst.getCondition());
   }
-  json::Array targets;
+  DocArray targets;
   for (unsigned i = 0; i < inst.getNumSuccessors(); i++) {
     targets.push_back(get_block(*inst.getSuccessor(i)));
   }
@@ -891,11 +905,11 @@ json::Object FunctionSerializationContext::serialize_inst_branch(
   return result;
 }
 
-json::Object FunctionSerializationContext::serialize_inst_jump_indirect(
+DocObject FunctionSerializationContext::serialize_inst_jump_indirect(
     const IndirectBrInst &inst) const {
-  json::Object result;
+  DocObject result;
   result["address"] = serialize_value(*inst.getAddress());
-  json::Array targets;
+  DocArray targets;
   for (unsigned i = 0; i < inst.getNumDestinations(); i++) {
     targets.push_back(get_block(*inst.getDestination(i)));
   }
@@ -903,20 +917,20 @@ json::Object FunctionSerializationContext::serialize_inst_jump_indirect(
   return result;
 }
 
-json::Object FunctionSerializationContext::serialize_inst_switch(
+DocObject FunctionSerializationContext::serialize_inst_switch(
     const SwitchInst &inst) const {
-  json::Object result;
+  DocObject result;
   result["cond_ty"] = serialize_type(*inst.getCondition()->getType());
   result["cond"] = serialize_value(*inst.getCondition());
 
   const auto &default_case = inst.case_default();
-  json::Array targets;
+  DocArray targets;
   for (const auto &succ : inst.cases()) {
     if (default_case != inst.case_end() &&
         succ.getCaseIndex() == default_case->getCaseIndex()) {
       continue;
     }
-    json::Object item;
+    DocObject item;
     item["block"] = get_block(*succ.getCaseSuccessor());
     item["value"] = serialize_constant(*succ.getCaseValue());
     targets.push_back(std::move(item));
@@ -928,13 +942,13 @@ json::Object FunctionSerializationContext::serialize_inst_switch(
   return result;
 }
 
-json::Object FunctionSerializationContext::serialize_inst_invoke_asm(
+DocObject FunctionSerializationContext::serialize_inst_invoke_asm(
     const InvokeInst &inst) const {
-  json::Object result;
+  DocObject result;
   result["asm"] =
       serialize_inline_asm(*cast<InlineAsm>(inst.getCalledOperand()));
 
-  json::Array args;
+  DocArray args;
   for (const auto &arg : inst.args()) {
     args.push_back(serialize_value(*arg.get()));
   }
@@ -945,13 +959,13 @@ json::Object FunctionSerializationContext::serialize_inst_invoke_asm(
   return result;
 }
 
-json::Object FunctionSerializationContext::serialize_inst_invoke_direct(
+DocObject FunctionSerializationContext::serialize_inst_invoke_direct(
     const InvokeInst &inst) const {
-  json::Object result;
+  DocObject result;
   result["callee"] = serialize_value(*inst.getCalledOperand());
   result["target_type"] = serialize_type(*inst.getFunctionType());
 
-  json::Array args;
+  DocArray args;
   for (const auto &arg : inst.args()) {
     args.push_back(serialize_value(*arg.get()));
   }
@@ -962,13 +976,13 @@ json::Object FunctionSerializationContext::serialize_inst_invoke_direct(
   return result;
 }
 
-json::Object FunctionSerializationContext::serialize_inst_invoke_indirect(
+DocObject FunctionSerializationContext::serialize_inst_invoke_indirect(
     const InvokeInst &inst) const {
-  json::Object result;
+  DocObject result;
   result["callee"] = serialize_value(*inst.getCalledOperand());
   result["target_type"] = serialize_type(*inst.getFunctionType());
 
-  json::Array args;
+  DocArray args;
   for (const auto &arg : inst.args()) {
     args.push_back(serialize_value(*arg.get()));
   }
@@ -979,9 +993,9 @@ json::Object FunctionSerializationContext::serialize_inst_invoke_indirect(
   return result;
 }
 
-json::Object FunctionSerializationContext::serialize_inst_resume(
+DocObject FunctionSerializationContext::serialize_inst_resume(
     const ResumeInst &inst) const {
-  json::Object result;
+  DocObject result;
   result["value"] = serialize_value(*inst.getValue());
   return result;
 }
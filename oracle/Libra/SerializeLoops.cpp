@@ -0,0 +1,201 @@
+#include "Serializer.h"
+
+namespace {
+using namespace libra;
+
+/// The constant of an expression, if it is one that fits in 64 bits
+std::optional<int64_t> get_signed_const(const SCEV &expr) {
+  const auto *expr_const = dyn_cast<SCEVConstant>(&expr);
+  if (expr_const == nullptr || !expr_const->getAPInt().isSignedIntN(64)) {
+    return std::nullopt;
+  }
+  return expr_const->getAPInt().getSExtValue();
+}
+
+/// A count that is a compile-time constant, a value of the IR in the form
+/// `scale * value + offset` (wrapping at the width of the count), or null
+/// otherwise
+DocValue serialize_count(const FunctionSerializationContext &ctxt,
+                         const SCEV *count) {
+  if (count == nullptr || isa<SCEVCouldNotCompute>(count)) {
+    return DocValue(nullptr);
+  }
+  if (const auto *count_const = dyn_cast<SCEVConstant>(count)) {
+    if (!count_const->getAPInt().isIntN(64)) {
+      return DocValue(nullptr);
+    }
+    return count_const->getAPInt().getZExtValue();
+  }
+
+  // constants come first in the operands of adds and multiplications
+  const SCEV *term = count;
+  int64_t offset = 0;
+  if (const auto *add = dyn_cast<SCEVAddExpr>(term)) {
+    const auto add_const = get_signed_const(*add->getOperand(0));
+    if (add->getNumOperands() != 2 || !add_const) {
+      return DocValue(nullptr);
+    }
+    offset = *add_const;
+    term = add->getOperand(1);
+  }
+  int64_t scale = 1;
+  if (const auto *mul = dyn_cast<SCEVMulExpr>(term)) {
+    const auto mul_const = get_signed_const(*mul->getOperand(0));
+    if (mul->getNumOperands() != 2 || !mul_const) {
+      return DocValue(nullptr);
+    }
+    scale = *mul_const;
+    term = mul->getOperand(1);
+  }
+  const auto *unknown = dyn_cast<SCEVUnknown>(term);
+  if (unknown == nullptr) {
+    return DocValue(nullptr);
+  }
+
+  DocObject result;
+  result["value"] = ctxt.serialize_value(*unknown->getValue());
+  result["scale"] = scale;
+  result["offset"] = offset;
+  return result;
+}
+
+/// A reference to the value an expression stands for, or null if it is not
+/// a single value in the IR
+DocValue serialize_expr_value(const FunctionSerializationContext &ctxt,
+                              const SCEV &expr) {
+  if (const auto *expr_const = dyn_cast<SCEVConstant>(&expr)) {
+    return ctxt.serialize_value(*expr_const->getValue());
+  }
+  if (const auto *expr_unknown = dyn_cast<SCEVUnknown>(&expr)) {
+    return ctxt.serialize_value(*expr_unknown->getValue());
+  }
+  return DocValue(nullptr);
+}
+
+/// Header phis that are recognized as inductions of this loop
+DocArray serialize_inductions(const FunctionSerializationContext &ctxt,
+                              const Loop &loop, ScalarEvolution &scev) {
+  DocArray result;
+  // the start of an induction is its incoming value from the preheader
+  if (loop.getLoopPreheader() == nullptr) {
+    return result;
+  }
+  for (const auto &phi : loop.getHeader()->phis()) {
+    InductionDescriptor desc;
+    if (!InductionDescriptor::isInductionPHI(const_cast<PHINode *>(&phi),
+                                             &loop, &scev, desc)) {
+      continue;
+    }
+
+    DocObject item;
+    item["phi"] = ctxt.get_instruction(phi);
+    item["start"] = ctxt.serialize_value(*desc.getStartValue());
+    item["step"] = serialize_expr_value(ctxt, *desc.getStep());
+    const auto *step_const = desc.getConstIntStepValue();
+    if (step_const != nullptr && step_const->getValue().isSignedIntN(64)) {
+      item["step_const"] = step_const->getSExtValue();
+    } else {
+      item["step_const"] = DocValue(nullptr);
+    }
+    result.push_back(std::move(item));
+  }
+  return result;
+}
+
+DocArray serialize_block_set(const FunctionSerializationContext &ctxt,
+                             ArrayRef<BasicBlock *> blocks) {
+  SmallVector<uint64_t, 16> labels;
+  for (const auto *block : blocks) {
+    labels.push_back(ctxt.get_block(*block));
+  }
+  llvm::sort(labels);
+
+  DocArray result;
+  for (const auto label : labels) {
+    result.push_back(label);
+  }
+  return result;
+}
+
+DocArray serialize_loop_forest(const FunctionSerializationContext &ctxt,
+                               ArrayRef<Loop *> loops, ScalarEvolution &scev);
+
+DocObject serialize_loop(const FunctionSerializationContext &ctxt,
+                         const Loop &loop, ScalarEvolution &scev) {
+  DocObject result;
+
+  // structure
+  result["header"] = ctxt.get_block(*loop.getHeader());
+  result["depth"] = loop.getLoopDepth();
+
+  SmallVector<BasicBlock *, 4> latches;
+  loop.getLoopLatches(latches);
+  result["latches"] = serialize_block_set(ctxt, latches);
+
+  SmallVector<BasicBlock *, 4> exits;
+  loop.getUniqueExitBlocks(exits);
+  result["exits"] = serialize_block_set(ctxt, exits);
+
+  result["blocks"] = serialize_block_set(ctxt, loop.getBlocks());
+
+  // trip counts, only when constant (a small constant count of zero means
+  // unknown)
+  const auto trip_count = scev.getSmallConstantTripCount(&loop);
+  if (trip_count == 0) {
+    result["trip_count"] = DocValue(nullptr);
+  } else {
+    result["trip_count"] = trip_count;
+  }
+  const auto max_trip_count = scev.getSmallConstantMaxTripCount(&loop);
+  if (max_trip_count == 0) {
+    result["max_trip_count"] = DocValue(nullptr);
+  } else {
+    result["max_trip_count"] = max_trip_count;
+  }
+  result["backedge_taken"] =
+      serialize_count(ctxt, scev.getBackedgeTakenCount(&loop));
+  result["max_backedge_taken"] =
+      serialize_count(ctxt, scev.getSymbolicMaxBackedgeTakenCount(&loop));
+
+  // induction variables
+  result["inductions"] = serialize_inductions(ctxt, loop, scev);
+
+  // nested loops
+  result["subloops"] = serialize_loop_forest(ctxt, loop.getSubLoops(), scev);
+  return result;
+}
+
+DocArray serialize_loop_forest(const FunctionSerializationContext &ctxt,
+                               ArrayRef<Loop *> loops, ScalarEvolution &scev) {
+  // order sibling loops by header for a stable output
+  SmallVector<const Loop *, 8> sorted(loops.begin(), loops.end());
+  llvm::sort(sorted, [&](const Loop *lhs, const Loop *rhs) {
+    return ctxt.get_block(*lhs->getHeader()) <
+           ctxt.get_block(*rhs->getHeader());
+  });
+
+  DocArray result;
+  for (const auto *loop : sorted) {
+    result.push_back(serialize_loop(ctxt, *loop, scev));
+  }
+  return result;
+}
+
+} // namespace
+
+namespace libra {
+
+cl::opt<bool> OptLoops("libra-loops", cl::init(false),
+                       cl::desc("Emit loop nests of defined functions, with "
+                                "trip counts and induction variables"));
+
+DocArray
+FunctionSerializationContext::serialize_loops(const Function &func) const {
+  const auto &loop_info = get_analysis<LoopAnalysis>(func);
+  auto &scev = get_analysis<ScalarEvolutionAnalysis>(func);
+
+  SmallVector<Loop *, 8> top_levels(loop_info.begin(), loop_info.end());
+  return serialize_loop_forest(*this, top_levels, scev);
+}
+
+} // namespace libra
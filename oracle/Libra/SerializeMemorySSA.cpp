@@ -0,0 +1,113 @@
+#include "Serializer.h"
+
+namespace {
+using namespace libra;
+
+/// Accesses are numbered with 0 as live-on-entry, followed by the accesses
+/// of each block in order (the phi, if any, comes first in its block)
+class AccessNumbering {
+private:
+  DenseMap<const MemoryAccess *, uint64_t> ids_;
+
+public:
+  AccessNumbering(const Function &func, const MemorySSA &mssa) {
+    ids_.try_emplace(mssa.getLiveOnEntryDef(), 0);
+    for (const auto &block : func) {
+      const auto *accesses = mssa.getBlockAccesses(&block);
+      if (accesses == nullptr) {
+        continue;
+      }
+      for (const auto &access : *accesses) {
+        const auto index = ids_.size();
+        ids_.try_emplace(&access, index);
+      }
+    }
+  }
+
+  [[nodiscard]] uint64_t get(const MemoryAccess &access) const {
+    const auto iter = ids_.find(&access);
+    assert(iter != ids_.end());
+    return iter->second;
+  }
+};
+
+DocObject serialize_access(const FunctionSerializationContext &ctxt,
+                           const AccessNumbering &numbering,
+                           const MemoryAccess &access) {
+  DocObject result;
+  result["block"] = ctxt.get_block(*access.getBlock());
+
+  if (isa<MemoryPhi>(access)) {
+    const auto &phi = cast<MemoryPhi>(access);
+    DocArray incoming;
+    for (unsigned i = 0; i < phi.getNumIncomingValues(); i++) {
+      DocObject item;
+      item["block"] = ctxt.get_block(*phi.getIncomingBlock(i));
+      item["access"] = numbering.get(*phi.getIncomingValue(i));
+      incoming.push_back(std::move(item));
+    }
+    result["Phi"] = std::move(incoming);
+    return result;
+  }
+
+  const auto &use_or_def = cast<MemoryUseOrDef>(access);
+  DocObject item;
+  item["inst"] = ctxt.get_instruction(*use_or_def.getMemoryInst());
+  item["defining"] = numbering.get(*use_or_def.getDefiningAccess());
+  if (isa<MemoryDef>(access)) {
+    result["Def"] = std::move(item);
+  } else {
+    result["Use"] = std::move(item);
+  }
+  return result;
+}
+
+} // namespace
+
+namespace libra {
+
+cl::opt<bool> OptMemorySSA("libra-memory-ssa", cl::init(false),
+                           cl::desc("Emit the memory SSA form of defined "
+                                    "functions"));
+
+DocObject
+FunctionSerializationContext::serialize_memory_ssa(const Function &func) const {
+  auto &mssa = get_analysis<MemorySSAAnalysis>(func).getMSSA();
+
+  // uses then point to their clobbering access, while defs keep pointing to
+  // the nearest preceding def; this only updates the cached analysis
+  mssa.ensureOptimizedUses();
+  const AccessNumbering numbering(func, mssa);
+
+  // one entry per access except live-on-entry, i.e., entry i is access i + 1
+  DocArray accesses;
+  for (const auto &block : func) {
+    const auto *block_accesses = mssa.getBlockAccesses(&block);
+    if (block_accesses == nullptr) {
+      continue;
+    }
+    for (const auto &access : *block_accesses) {
+      accesses.push_back(serialize_access(*this, numbering, access));
+    }
+  }
+
+  // memory access of each instruction, null if it does not touch memory
+  DocArray inst_access;
+  for (const auto &block : func) {
+    for (const auto &inst : block) {
+      const auto *access = mssa.getMemoryAccess(&inst);
+      if (access == nullptr) {
+        inst_access.push_back(DocValue(nullptr));
+      } else {
+        inst_access.push_back(numbering.get(*access));
+      }
+    }
+  }
+
+  DocObject result;
+  result["accesses"] = std::move(accesses);
+  result["inst_access"] = std::move(inst_access);
+  return result;
+}
+
+} // namespace libra
@@ -1,48 +1,189 @@
+#include "Analysis.h"
+#include "CborEmitter.h"
+#include "CensusSink.h"
+#include "DigestSink.h"
+#include "JsonEmitter.h"
+#include "JsonValueSink.h"
 #include "Serializer.h"
+#include "Sink.h"
+
+namespace {
+using namespace libra;
+
+/// Order in which functions are emitted
+enum class FunctionOrder { Module, BottomUp };
+
+cl::opt<FunctionOrder> OptFunctionOrder(
+    "libra-function-order", cl::init(FunctionOrder::Module),
+    cl::desc("The order in which functions are emitted"),
+    cl::values(clEnumValN(FunctionOrder::Module, "module",
+                          "As they appear in the module"),
+               clEnumValN(FunctionOrder::BottomUp, "bottom-up",
+                          "Callees before callers, by call-graph SCCs")));
+
+/// Functions to be emitted, in the requested order
+std::vector<const Function *> ordered_functions(const Module &module) {
+  std::vector<const Function *> result;
+  switch (OptFunctionOrder) {
+  case FunctionOrder::Module:
+    for (const auto &func : module.functions()) {
+      result.push_back(&func);
+    }
+    break;
+  case FunctionOrder::BottomUp:
+    for (const auto &scc : bottom_up_sccs(module)) {
+      result.insert(result.end(), scc.begin(), scc.end());
+    }
+    break;
+  }
+  return result;
+}
+
+} // namespace
 
 namespace libra {
 
-json::Object serialize_module(const Module &module) {
-  json::Object result;
+template <typename Sink>
+void serialize_module(const Module &module, Sink &sink) {
+  TimeTraceScope scope("SerializeModule", module.getModuleIdentifier());
+  DocArena arena;
+  DocObject result;
 
   // module level info
   result["name"] = module.getModuleIdentifier();
   result["asm"] = module.getModuleInlineAsm();
+  result["data_layout"] = module.getDataLayoutStr();
+  result["target_triple"] = module.getTargetTriple();
+  if (OptNumericCodes) {
+    result["codes"] = serialize_code_tables(module);
+  }
+  if (DICT != nullptr) {
+    result["dictionary"] = DICT->serialize_header();
+  }
 
-  // user-defined struct types
-  json::Array structs;
+  // user-defined struct types, built up front although written last, as
+  // their names must be in the string table before it is written
+  DocArray structs;
   for (const auto *ty_def : module.getIdentifiedStructTypes()) {
-    structs.push_back(serialize_type_struct(*ty_def));
+    auto entry = serialize_type_struct(*ty_def);
+    if (OptLayout && ty_def->isSized()) {
+      entry["layout"] = serialize_type_layout(*ty_def, module.getDataLayout());
+    }
+    structs.push_back(std::move(entry));
   }
   result["structs"] = std::move(structs);
 
-  // globals
-  json::Array global_vars;
-  for (const auto &global_var : module.globals()) {
-    global_vars.push_back(serialize_global_variable(global_var));
+  // module-wide facts needed by function summaries
+  if (OptSummaries) {
+    prepare_summaries(module);
   }
-  result["global_variables"] = std::move(global_vars);
 
   // TODO: alias
   // TODO: ifunc
 
-  // functions
-  json::Array functions;
-  for (const auto &func : module.functions()) {
-    // filter out the dummy function
-    if (&func == dummy_function) {
-      continue;
+  // members are written in sorted order, the same as a complete object, and
+  // large sections are built only when their turn comes
+  const auto members = sorted_members(result);
+  auto cursor = members.begin();
+  const auto write_members_before = [&](std::optional<StringRef> bound) {
+    for (; cursor != members.end(); ++cursor) {
+      if (bound && (*cursor)->key >= *bound) {
+        break;
+      }
+      sink.object_key((*cursor)->key);
+      write_document(sink, (*cursor)->value);
+    }
+  };
+
+  sink.object_begin();
+
+  // call graph, ahead of the functions it refers to
+  write_members_before("call_graph");
+  if (OptCallGraph) {
+    DocArena section_arena;
+    sink.object_key("call_graph");
+    write_document(sink, serialize_call_graph(module));
+  }
+
+  // source locations, in their own section
+  write_members_before("debug_locs");
+  if (OptDebugLocs) {
+    DocArena section_arena;
+    sink.object_key("debug_locs");
+    write_document(sink, serialize_debug_locs(module));
+  }
+
+  // functions, each is written out and released before the next one
+  write_members_before("functions");
+  sink.object_key("functions");
+  sink.array_begin();
+  {
+    DocArena func_arena;
+    for (const auto *func : ordered_functions(module)) {
+      // filter out the dummy function
+      if (func == dummy_function) {
+        continue;
+      }
+      // filter out debug functions
+      if (is_debug_function(*func)) {
+        continue;
+      }
+      const auto start = std::chrono::steady_clock::now();
+      const auto entry = serialize_function(*func);
+      write_document(sink, entry);
+      // timed before the entry is measured again for the statistics
+      const auto seconds = seconds_since(start);
+      if (STATS != nullptr) {
+        STATS->add_function(*func, seconds, encoded_size(entry));
+      }
+      release_analyses(*func);
+      func_arena.reset();
     }
-    // filter out debug functions
-    if (is_debug_function(func)) {
-      continue;
+  }
+  sink.array_end();
+
+  // globals, in the same way as functions
+  write_members_before("global_variables");
+  sink.object_key("global_variables");
+  sink.array_begin();
+  {
+    DocArena global_arena;
+    for (const auto &global_var : module.globals()) {
+      const auto start = std::chrono::steady_clock::now();
+      const auto entry = serialize_global_variable(global_var);
+      write_document(sink, entry);
+      const auto seconds = seconds_since(start);
+      if (STATS != nullptr) {
+        STATS->add_global(global_var, seconds, encoded_size(entry));
+      }
+      global_arena.reset();
     }
-    functions.push_back(serialize_function(func));
   }
-  result["functions"] = std::move(functions);
+  sink.array_end();
+
+  // metadata table, only complete after functions are serialized
+  write_members_before("metadata");
+  if (METADATA != nullptr) {
+    sink.object_key("metadata");
+    write_document(sink, METADATA->serialize());
+  }
+
+  // string table, only complete after everything else is serialized
+  write_members_before("strings");
+  if (STRINGS != nullptr) {
+    sink.object_key("strings");
+    write_document(sink, STRINGS->serialize());
+  }
 
   // done
-  return result;
+  write_members_before(std::nullopt);
+  sink.object_end();
 }
 
-} // namespace libra
\ No newline at end of file
+template void serialize_module(const Module &, JsonEmitter &);
+template void serialize_module(const Module &, JsonValueSink &);
+template void serialize_module(const Module &, CborEmitter &);
+template void serialize_module(const Module &, CensusSink &);
+template void serialize_module(const Module &, DigestSink &);
+
+} // namespace libra
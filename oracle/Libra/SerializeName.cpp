@@ -0,0 +1,19 @@
+#include "Serializer.h"
+
+namespace libra {
+
+DocValue serialize_name(StringRef name) {
+  if (DICT != nullptr) {
+    if (const auto id = DICT->lookup_string(name)) {
+      DocObject result;
+      result["dict"] = *id;
+      return result;
+    }
+  }
+  if (STRINGS != nullptr) {
+    return STRINGS->intern(name);
+  }
+  return name;
+}
+
+} // namespace libra
@@ -0,0 +1,288 @@
+#include "Serializer.h"
+
+namespace {
+using namespace libra;
+
+/// Global variables a function may read or write, directly or via callees
+struct GlobalAccesses {
+  SmallSetVector<const GlobalVariable *, 8> reads;
+  SmallSetVector<const GlobalVariable *, 8> writes;
+  /// accesses through pointer arguments, which callers map to what they pass
+  std::map<const Argument *, ModRefInfo> args;
+  /// set when an access or a callee cannot be analyzed, the sets are then
+  /// incomplete
+  bool unknown = false;
+
+  void add(const GlobalVariable &gvar, ModRefInfo mod_ref) {
+    if (isRefSet(mod_ref)) {
+      reads.insert(&gvar);
+    }
+    if (isModSet(mod_ref)) {
+      writes.insert(&gvar);
+    }
+  }
+
+  /// Merge the global accesses of a callee, its argument accesses are mapped
+  /// separately by the caller
+  void merge(const GlobalAccesses &other) {
+    reads.insert(other.reads.begin(), other.reads.end());
+    writes.insert(other.writes.begin(), other.writes.end());
+    unknown |= other.unknown;
+  }
+
+  /// Grows with every access added, to tell when an SCC is done
+  [[nodiscard]] size_t weight() const {
+    size_t result = reads.size() + writes.size() + (unknown ? 1 : 0);
+    for (const auto &[arg, mod_ref] : args) {
+      result += (isRefSet(mod_ref) ? 1 : 0) + (isModSet(mod_ref) ? 1 : 0);
+    }
+    return result;
+  }
+};
+
+/// Module-level results, filled by `prepare_summaries`
+std::map<const Function *, GlobalAccesses> global_accesses;
+DenseMap<const GlobalVariable *, uint64_t> global_indices;
+
+/// Record an access through a pointer, which is either based on a global
+/// variable, on an argument, on memory local to the function, or on anything
+/// else
+void add_access(GlobalAccesses &result, const Value &ptr, ModRefInfo mod_ref) {
+  if (!isModOrRefSet(mod_ref)) {
+    return;
+  }
+  const auto *base = getUnderlyingObject(&ptr);
+  if (const auto *gvar = dyn_cast<GlobalVariable>(base)) {
+    result.add(*gvar, mod_ref);
+    return;
+  }
+  if (const auto *arg = dyn_cast<Argument>(base)) {
+    result.args[arg] |= mod_ref;
+    return;
+  }
+  // e.g., loaded pointers, or phis and selects of globals
+  if (!isa<AllocaInst>(base) && !isNoAliasCall(base)) {
+    result.unknown = true;
+  }
+}
+
+/// Accesses of a call to a defined function, with the accesses through its
+/// arguments mapped to the actual arguments
+void add_call(GlobalAccesses &result, const CallBase &call,
+              const GlobalAccesses &callee_accesses) {
+  // a callee in the same SCC shares the record of its caller
+  if (&callee_accesses != &result) {
+    result.merge(callee_accesses);
+  }
+
+  // copied, as mapping may add to the same record
+  const auto callee_args = callee_accesses.args;
+  for (const auto &[arg, mod_ref] : callee_args) {
+    if (arg->getParent() == call.getCalledFunction() &&
+        arg->getArgNo() < call.arg_size()) {
+      add_access(result, *call.getArgOperand(arg->getArgNo()), mod_ref);
+    }
+  }
+}
+
+/// Accesses of one function, with callees looked up in `global_accesses` or,
+/// for members of the same SCC, in `result`, returns whether there were any
+/// of the latter
+bool collect_accesses(const Function &func, GlobalAccesses &result) {
+  bool recursive = false;
+  for (const auto &inst : instructions(func)) {
+    if (is_debug_instruction(inst) || !inst.mayReadOrWriteMemory()) {
+      continue;
+    }
+
+    // loads, stores, and atomics
+    if (!isa<CallBase>(inst)) {
+      const auto loc = MemoryLocation::getOrNone(&inst);
+      if (!loc) {
+        result.unknown = true;
+        continue;
+      }
+      auto mod_ref = ModRefInfo::NoModRef;
+      if (inst.mayReadFromMemory()) {
+        mod_ref |= ModRefInfo::Ref;
+      }
+      if (inst.mayWriteToMemory()) {
+        mod_ref |= ModRefInfo::Mod;
+      }
+      add_access(result, *loc->Ptr, mod_ref);
+      continue;
+    }
+
+    // calls of defined functions, with their own accesses, unless these
+    // are unknown and the attributes of the call may tell more
+    const auto &call = cast<CallBase>(inst);
+    const auto *callee = call.getCalledFunction();
+    if (callee != nullptr && !callee->isDeclaration()) {
+      const auto iter = global_accesses.find(callee);
+      recursive |= iter == global_accesses.end();
+      const auto &callee_accesses =
+          iter != global_accesses.end() ? iter->second : result;
+      if (!callee_accesses.unknown) {
+        add_call(result, call, callee_accesses);
+        continue;
+      }
+    }
+
+    // other calls, memory passed as arguments may be accessed by the callee
+    const auto effects = call.getMemoryEffects();
+    for (const auto &arg : call.args()) {
+      if (arg->getType()->isPointerTy()) {
+        add_access(result, *arg.get(),
+                   effects.getModRef(IRMemLocation::ArgMem));
+      }
+    }
+
+    // and those that may access memory beyond their arguments are unknown
+    if (!effects.getWithoutLoc(IRMemLocation::ArgMem)
+             .getWithoutLoc(IRMemLocation::InaccessibleMem)
+             .doesNotAccessMemory()) {
+      result.unknown = true;
+    }
+  }
+  return recursive;
+}
+
+const char *mod_ref_name(ModRefInfo mod_ref) {
+  switch (mod_ref) {
+  case ModRefInfo::NoModRef:
+    return "none";
+  case ModRefInfo::Ref:
+    return "ref";
+  case ModRefInfo::Mod:
+    return "mod";
+  case ModRefInfo::ModRef:
+    return "mod_ref";
+  }
+  llvm_unreachable("invalid mod-ref info");
+}
+
+DocObject serialize_memory_effects(MemoryEffects effects) {
+  DocObject result;
+  result["mod_ref"] = mod_ref_name(effects.getModRef());
+  result["arg_mem"] = mod_ref_name(effects.getModRef(IRMemLocation::ArgMem));
+  result["inaccessible_mem"] =
+      mod_ref_name(effects.getModRef(IRMemLocation::InaccessibleMem));
+  result["other_mem"] = mod_ref_name(effects.getModRef(IRMemLocation::Other));
+  return result;
+}
+
+DocValue
+serialize_global_set(const SmallSetVector<const GlobalVariable *, 8> &gvars) {
+  SmallVector<uint64_t, 8> indices;
+  for (const auto *gvar : gvars) {
+    indices.push_back(global_indices.lookup(gvar));
+  }
+  llvm::sort(indices);
+
+  DocArray result;
+  for (const auto index : indices) {
+    result.push_back(index);
+  }
+  return result;
+}
+
+} // namespace
+
+namespace libra {
+
+cl::opt<bool> OptSummaries("libra-summaries", cl::init(false),
+                           cl::desc("Emit memory effects and other "
+                                    "summaries of functions"));
+
+void prepare_summaries(const Module &module) {
+  global_accesses.clear();
+  global_indices.clear();
+
+  // globals are referred to by their index in the "global_variables" list
+  for (const auto &gvar : module.globals()) {
+    const auto index = global_indices.size();
+    global_indices.try_emplace(&gvar, index);
+  }
+
+  // callees are visited first, and members of an SCC share the same result,
+  // collected until calls among them add nothing more
+  for (const auto &scc : bottom_up_sccs(module)) {
+    GlobalAccesses accesses;
+    bool recursive = false;
+    size_t weight = 0;
+    do {
+      weight = accesses.weight();
+      recursive = false;
+      for (const auto *func : scc) {
+        recursive |= collect_accesses(*func, accesses);
+      }
+    } while (recursive && accesses.weight() != weight);
+    for (const auto *func : scc) {
+      global_accesses[func] = accesses;
+    }
+  }
+}
+
+DocObject serialize_summary(const Function &func) {
+  DocObject result;
+
+  // memory effects, refined with what GlobalsModRef knows about the module
+  auto effects = func.getMemoryEffects();
+  if (!func.isDeclaration()) {
+    auto &globals_aa = get_module_analysis<GlobalsAA>(*func.getParent());
+    effects &= globals_aa.getMemoryEffects(&func);
+  }
+  result["memory"] = serialize_memory_effects(effects);
+
+  // function attributes
+  result["no_unwind"] = func.doesNotThrow();
+  result["will_return"] = func.willReturn();
+  result["no_recurse"] = func.doesNotRecurse();
+
+  // globals accessed other than through the arguments, and accesses through
+  // each pointer argument, null when not known
+  const auto iter = global_accesses.find(&func);
+  const auto known = iter != global_accesses.end() && !iter->second.unknown &&
+                     !func.isDeclaration();
+  if (!known) {
+    result["global_reads"] = DocValue(nullptr);
+    result["global_writes"] = DocValue(nullptr);
+  } else {
+    result["global_reads"] = serialize_global_set(iter->second.reads);
+    result["global_writes"] = serialize_global_set(iter->second.writes);
+  }
+  DocArray arg_accesses;
+  for (const auto &param : func.args()) {
+    if (!known || !param.getType()->isPointerTy()) {
+      arg_accesses.push_back(DocValue(nullptr));
+      continue;
+    }
+    const auto arg_iter = iter->second.args.find(&param);
+    arg_accesses.push_back(mod_ref_name(arg_iter != iter->second.args.end()
+                                            ? arg_iter->second
+                                            : ModRefInfo::NoModRef));
+  }
+  result["arg_accesses"] = std::move(arg_accesses);
+
+  // whether each pointer argument may be captured, from the body when there
+  // is one, null for non-pointers
+  DocArray captures;
+  for (const auto &param : func.args()) {
+    if (!param.getType()->isPointerTy()) {
+      captures.push_back(DocValue(nullptr));
+    } else if (param.hasNoCaptureAttr()) {
+      captures.push_back(false);
+    } else if (func.isDeclaration()) {
+      captures.push_back(true);
+    } else {
+      captures.push_back(PointerMayBeCaptured(&param,
+                                              /* ReturnCaptures */ true,
+                                              /* StoreCaptures */ true));
+    }
+  }
+  result["may_capture_args"] = std::move(captures);
+
+  return result;
+}
+
+} // namespace libra
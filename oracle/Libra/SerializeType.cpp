@@ -1,24 +1,32 @@
 #include "Serializer.h"
 
 namespace {
+using namespace libra;
 
-json::Object mk_float(uint64_t width, const char *name) {
-  json::Object result;
+DocObject mk_float(uint64_t width, const char *name) {
+  DocObject result;
   result["width"] = width;
   result["name"] = name;
   return result;
 }
 
+/// Size in bytes, scalable sizes are given as their known minimum
+DocValue mk_size(TypeSize size) { return size.getKnownMinValue(); }
+
 } // namespace
 
 namespace libra {
 
-json::Object serialize_type(const Type &type) {
-  json::Object result;
+cl::opt<bool> OptLayout("libra-layout", cl::init(false),
+                        cl::desc("Emit sizes, alignments, and field offsets "
+                                 "of types in the type tables"));
+
+DocObject serialize_type(const Type &type) {
+  DocObject result;
 
   switch (type.getTypeID()) {
   case Type::TypeID::VoidTyID:
-    result["Void"] = json::Value(nullptr);
+    result["Void"] = DocValue(nullptr);
     break;
   case Type::TypeID::IntegerTyID:
     result["Int"] = serialize_type_int(cast<IntegerType>(type));
@@ -76,41 +84,53 @@ json::Object serialize_type(const Type &type) {
         serialize_type_typed_pointer(cast<TypedPointerType>(type));
     break;
   case Type::LabelTyID:
-    result["Label"] = json::Value(nullptr);
+    result["Label"] = DocValue(nullptr);
     break;
   case Type::TokenTyID:
-    result["Token"] = json::Value(nullptr);
+    result["Token"] = DocValue(nullptr);
     break;
   case Type::MetadataTyID:
-    result["Metadata"] = json::Value(nullptr);
+    result["Metadata"] = DocValue(nullptr);
     break;
   }
+
+  if (STATS != nullptr) {
+    STATS->add_bytes("type", result, result);
+  }
   return result;
 }
 
-json::Object serialize_type_int(const IntegerType &type) {
-  json::Object result;
+DocObject serialize_type_int(const IntegerType &type) {
+  DocObject result;
   result["width"] = type.getBitWidth();
   return result;
 }
 
-json::Object serialize_type_array(const ArrayType &type) {
-  json::Object result;
+DocObject serialize_type_array(const ArrayType &type) {
+  DocObject result;
   result["element"] = serialize_type(*type.getElementType());
   result["length"] = type.getNumElements();
   return result;
 }
 
-json::Object serialize_type_struct(const StructType &type) {
-  json::Object result;
+DocObject serialize_type_struct(const StructType &type) {
+  DocObject result;
+
+  // refer to the dictionary when the same definition is there
+  if (DICT != nullptr) {
+    if (const auto id = DICT->lookup_struct(type)) {
+      result["dict"] = *id;
+      return result;
+    }
+  }
 
   if (type.hasName()) {
-    result["name"] = type.getName();
+    result["name"] = serialize_name(type.getName());
   }
 
   // collect fields only when non-opaque
   if (!type.isOpaque()) {
-    json::Array fields;
+    DocArray fields;
     for (const auto *field : type.elements()) {
       fields.push_back(serialize_type(*field));
     }
@@ -120,10 +140,10 @@ json::Object serialize_type_struct(const StructType &type) {
   return result;
 }
 
-json::Object serialize_type_function(const FunctionType &type) {
-  json::Object result;
+DocObject serialize_type_function(const FunctionType &type) {
+  DocObject result;
 
-  json::Array params;
+  DocArray params;
   for (const auto *param : type.params()) {
     params.push_back(serialize_type(*param));
   }
@@ -134,14 +154,14 @@ json::Object serialize_type_function(const FunctionType &type) {
   return result;
 }
 
-json::Object serialize_type_pointer(const PointerType &type) {
-  json::Object result;
+DocObject serialize_type_pointer(const PointerType &type) {
+  DocObject result;
   result["address_space"] = type.getAddressSpace();
   return result;
 }
 
-json::Object serialize_type_vector(const VectorType &type) {
-  json::Object result;
+DocObject serialize_type_vector(const VectorType &type) {
+  DocObject result;
 
   result["element"] = serialize_type(*type.getElementType());
   if (isa<FixedVectorType>(type)) {
@@ -157,12 +177,12 @@ json::Object serialize_type_vector(const VectorType &type) {
   return result;
 }
 
-json::Object serialize_type_extension(const TargetExtType &type) {
-  json::Object result;
+DocObject serialize_type_extension(const TargetExtType &type) {
+  DocObject result;
 
   result["name"] = type.getName();
 
-  json::Array params;
+  DocArray params;
   for (const auto *param : type.type_params()) {
     params.push_back(serialize_type(*param));
   }
@@ -171,11 +191,37 @@ json::Object serialize_type_extension(const TargetExtType &type) {
   return result;
 }
 
-json::Object serialize_type_typed_pointer(const TypedPointerType &type) {
-  json::Object result;
+DocObject serialize_type_typed_pointer(const TypedPointerType &type) {
+  DocObject result;
   result["pointee"] = serialize_type(*type.getElementType());
   result["address_space"] = type.getAddressSpace();
   return result;
 }
 
-} // namespace libra
\ No newline at end of file
+DocObject serialize_type_layout(const Type &type, const DataLayout &layout) {
+  DocObject result;
+
+  // the layout interface is not const, but it only reads the type
+  auto *ty = const_cast<Type *>(&type);
+  const auto alloc_size = layout.getTypeAllocSize(ty);
+  result["alloc_size"] = mk_size(alloc_size);
+  result["store_size"] = mk_size(layout.getTypeStoreSize(ty));
+  if (alloc_size.isScalable()) {
+    result["scalable"] = true;
+  }
+  result["abi_align"] = layout.getABITypeAlign(ty).value();
+  result["pref_align"] = layout.getPrefTypeAlign(ty).value();
+
+  // field offsets of structs
+  if (isa<StructType>(type)) {
+    const auto *struct_layout = layout.getStructLayout(cast<StructType>(ty));
+    DocArray offsets;
+    for (unsigned i = 0; i < cast<StructType>(type).getNumElements(); i++) {
+      offsets.push_back(mk_size(struct_layout->getElementOffset(i)));
+    }
+    result["field_offsets"] = std::move(offsets);
+  }
+  return result;
+}
+
+} // namespace libra
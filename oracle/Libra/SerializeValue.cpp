@@ -2,9 +2,9 @@
 
 namespace libra {
 
-json::Object
+DocObject
 FunctionSerializationContext::serialize_value(const Value &val) const {
-  json::Object result;
+  DocObject result;
   if (isa<Argument>(val)) {
     result["Argument"] = serialize_value_argument(cast<Argument>(val));
   } else if (isa<Constant>(val)) {
@@ -15,7 +15,7 @@ FunctionSerializationContext::serialize_value(const Value &val) const {
     result["Label"] = serialize_value_block(cast<BasicBlock>(val));
   } else if (isa<MetadataAsValue>(val)) {
     // TODO: metadata system is not ready
-    result["Metadata"] = json::Value(nullptr);
+    result["Metadata"] = DocValue(nullptr);
   } else if (isa<InlineAsm>(val)) {
     LOG->fatal("unexpected asm as value");
   } else if (isa<Operator>(val)) {
@@ -25,18 +25,22 @@ FunctionSerializationContext::serialize_value(const Value &val) const {
   } else {
     LOG->fatal("unknown value type: {0}", val);
   }
+
+  if (STATS != nullptr) {
+    STATS->add_bytes("operand", result, result);
+  }
   return result;
 }
 
-json::Object FunctionSerializationContext::serialize_value_argument(
+DocObject FunctionSerializationContext::serialize_value_argument(
     const Argument &arg) const {
-  json::Object result;
+  DocObject result;
   result["ty"] = serialize_type(*arg.getType());
   result["index"] = get_argument(arg);
   return result;
 }
 
-json::Object FunctionSerializationContext::serialize_value_block(
+DocObject FunctionSerializationContext::serialize_value_block(
     const BasicBlock &block) const {
   // sanity checks
   const auto *func = block.getParent();
@@ -52,15 +56,15 @@ json::Object FunctionSerializationContext::serialize_value_block(
   const auto &ctxt = iter->second;
 
   // dump the result
-  json::Object result;
-  result["func"] = func->getName();
+  DocObject result;
+  result["func"] = serialize_name(func->getName());
   result["block"] = ctxt.get_block(block);
   return result;
 }
 
-json::Object FunctionSerializationContext::serialize_value_instruction(
+DocObject FunctionSerializationContext::serialize_value_instruction(
     const Instruction &inst) const {
-  json::Object result;
+  DocObject result;
   result["ty"] = serialize_type(*inst.getType());
   result["index"] = get_instruction(inst);
   return result;
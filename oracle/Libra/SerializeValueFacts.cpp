@@ -0,0 +1,92 @@
+#include "Serializer.h"
+
+namespace {
+using namespace libra;
+
+DocValue serialize_apint(const APInt &val) {
+  SmallString<64> dump;
+  val.toStringUnsigned(dump);
+  return dump;
+}
+
+/// Known bits and range of an integer value, null if nothing is known.
+///
+/// The range is half-open, i.e., [lower, upper), and wraps around when
+/// lower > upper, following the convention of `ConstantRange`.
+DocValue serialize_facts(const Value &val, const Instruction &cxt,
+                         const DataLayout &layout, AssumptionCache &assumptions,
+                         const DominatorTree &dom_tree, LazyValueInfo &lvi) {
+  if (!val.getType()->isIntegerTy()) {
+    return DocValue(nullptr);
+  }
+
+  // the analyses only read the IR, the interfaces are just not const
+  auto *val_mut = const_cast<Value *>(&val);
+  auto *cxt_mut = const_cast<Instruction *>(&cxt);
+
+  auto known =
+      computeKnownBits(&val, layout, 0, &assumptions, &cxt, &dom_tree);
+  // conflicting bits come from code that cannot execute (e.g., under an
+  // assumption that never holds), they say nothing and cannot make a range
+  if (known.hasConflict()) {
+    known.resetAll();
+  }
+  const auto range =
+      lvi.getConstantRange(val_mut, cxt_mut, /* UndefAllowed */ false)
+          .intersectWith(ConstantRange::fromKnownBits(known, false));
+
+  if (known.isUnknown() && range.isFullSet()) {
+    return DocValue(nullptr);
+  }
+
+  DocObject result;
+  if (!known.isUnknown()) {
+    result["known_zero"] = serialize_apint(known.Zero);
+    result["known_one"] = serialize_apint(known.One);
+  }
+  if (!range.isFullSet()) {
+    DocObject bounds;
+    bounds["lower"] = serialize_apint(range.getLower());
+    bounds["upper"] = serialize_apint(range.getUpper());
+    result["range"] = std::move(bounds);
+  }
+  return result;
+}
+
+} // namespace
+
+namespace libra {
+
+cl::opt<bool> OptValueFacts("libra-value-facts", cl::init(false),
+                            cl::desc("Emit known bits and constant ranges of "
+                                     "integer values in defined functions"));
+
+DocObject FunctionSerializationContext::serialize_value_facts(
+    const Function &func) const {
+  const auto &layout = func.getParent()->getDataLayout();
+  auto &assumptions = get_analysis<AssumptionAnalysis>(func);
+  const auto &dom_tree = get_analysis<DominatorTreeAnalysis>(func);
+  auto &lvi = get_analysis<LazyValueAnalysis>(func);
+
+  // arguments are considered at the start of the function
+  const auto &entry = *func.getEntryBlock().getFirstNonPHIOrDbg();
+  DocArray args;
+  for (const auto &arg : func.args()) {
+    args.push_back(
+        serialize_facts(arg, entry, layout, assumptions, dom_tree, lvi));
+  }
+
+  // instructions are considered where they are defined
+  DocArray insts;
+  for (const auto &inst : instructions(func)) {
+    insts.push_back(
+        serialize_facts(inst, inst, layout, assumptions, dom_tree, lvi));
+  }
+
+  DocObject result;
+  result["args"] = std::move(args);
+  result["insts"] = std::move(insts);
+  return result;
+}
+
+} // namespace libra
@@ -1,62 +1,178 @@
 #ifndef LIBRA_SERIALIZER_H
 #define LIBRA_SERIALIZER_H
 
+#include "Analysis.h"
 #include "Deps.h"
+#include "Dictionary.h"
+#include "Document.h"
+#include "JsonEmitter.h"
 #include "Logger.h"
 #include "Metadata.h"
+#include "MetadataTable.h"
+#include "Stats.h"
+#include "StringTable.h"
 
 namespace libra {
 
+/// Flag to emit function bodies as instruction columns
+extern cl::opt<bool> OptColumnar;
+
+/// Flag to emit dominator and post-dominator trees
+extern cl::opt<bool> OptDominance;
+
+/// Flag to emit loop nests with trip counts
+extern cl::opt<bool> OptLoops;
+
+/// Flag to emit memory SSA def/use graphs
+extern cl::opt<bool> OptMemorySSA;
+
+/// Flag to emit the module call graph
+extern cl::opt<bool> OptCallGraph;
+
+/// Flag to emit memory effects and attribute summaries of functions
+extern cl::opt<bool> OptSummaries;
+
+/// Flag to emit data layout facts of types
+extern cl::opt<bool> OptLayout;
+
+/// Flag to emit folded byte offsets of GEPs
+extern cl::opt<bool> OptGepOffsets;
+
+/// Flag to emit numeric codes in place of opcode and predicate names
+extern cl::opt<bool> OptNumericCodes;
+
+/// Flag to emit def-use chains and block predecessors
+extern cl::opt<bool> OptDefUse;
+
+/// Flag to emit known bits and ranges of integer values
+extern cl::opt<bool> OptValueFacts;
+
+/// Flag to emit capture facts of allocas and pointer arguments
+extern cl::opt<bool> OptEscape;
+
+/// Flag to emit block frequencies and branch probabilities
+extern cl::opt<bool> OptFrequency;
+
+/// Flag to emit the side table of source locations
+extern cl::opt<bool> OptDebugLocs;
+
 // TODO: need to create a dummy set to host instructions from constant expr
 extern BasicBlock *dummy_block;
 extern Function *dummy_function;
 extern Instruction *dummy_instruction;
 void prepare_for_serialization(Module &module);
 
-[[nodiscard]] json::Object serialize_module(const Module &module);
-
-[[nodiscard]] json::Object serialize_type(const Type &type);
-[[nodiscard]] json::Object serialize_type_int(const IntegerType &type);
-[[nodiscard]] json::Object serialize_type_array(const ArrayType &type);
-[[nodiscard]] json::Object serialize_type_struct(const StructType &type);
-[[nodiscard]] json::Object serialize_type_function(const FunctionType &type);
-[[nodiscard]] json::Object serialize_type_pointer(const PointerType &type);
-[[nodiscard]] json::Object serialize_type_vector(const VectorType &type);
-[[nodiscard]] json::Object serialize_type_extension(const TargetExtType &type);
-[[nodiscard]] json::Object
+/// Serialize the module into a sink (see Sink.h), instantiated for the sinks
+/// in SerializeModule.cpp
+template <typename Sink>
+void serialize_module(const Module &module, Sink &sink);
+
+[[nodiscard]] DocValue serialize_name(StringRef name);
+
+/// While alive, names are emitted verbatim and serialization is not counted
+/// in the statistics, for documents that outlive the module (e.g., entries
+/// of the shared dictionary)
+class ModuleIndependentScope {
+private:
+  std::unique_ptr<StringTable> strings_;
+  std::unique_ptr<SerializationStats> stats_;
+
+public:
+  ModuleIndependentScope()
+      : strings_(std::move(STRINGS)), stats_(std::move(STATS)) {}
+  ~ModuleIndependentScope() {
+    STRINGS = std::move(strings_);
+    STATS = std::move(stats_);
+  }
+
+  ModuleIndependentScope(const ModuleIndependentScope &) = delete;
+  ModuleIndependentScope &operator=(const ModuleIndependentScope &) = delete;
+};
+
+[[nodiscard]] DocObject serialize_type(const Type &type);
+[[nodiscard]] DocObject serialize_type_int(const IntegerType &type);
+[[nodiscard]] DocObject serialize_type_array(const ArrayType &type);
+[[nodiscard]] DocObject serialize_type_struct(const StructType &type);
+[[nodiscard]] DocObject serialize_type_function(const FunctionType &type);
+[[nodiscard]] DocObject serialize_type_pointer(const PointerType &type);
+[[nodiscard]] DocObject serialize_type_vector(const VectorType &type);
+[[nodiscard]] DocObject serialize_type_extension(const TargetExtType &type);
+[[nodiscard]] DocObject
 serialize_type_typed_pointer(const TypedPointerType &type);
+/// Sizes and alignments of a sized type, plus field offsets for structs
+[[nodiscard]] DocObject serialize_type_layout(const Type &type,
+                                              const DataLayout &layout);
 
-[[nodiscard]] json::Object serialize_constant(const Constant &val);
-[[nodiscard]] json::Object serialize_const(const Constant &val);
-[[nodiscard]] json::Object serialize_const_data_int(const ConstantInt &val);
-[[nodiscard]] json::Object serialize_const_data_float(const ConstantFP &val);
-[[nodiscard]] json::Object
+[[nodiscard]] DocObject serialize_constant(const Constant &val);
+[[nodiscard]] DocObject serialize_const(const Constant &val);
+[[nodiscard]] DocObject serialize_const_data_int(const ConstantInt &val);
+[[nodiscard]] DocObject serialize_const_data_float(const ConstantFP &val);
+[[nodiscard]] DocObject
 serialize_const_data_array(const ConstantDataArray &val);
-[[nodiscard]] json::Object
+[[nodiscard]] DocObject
 serialize_const_data_vector(const ConstantDataVector &val);
-[[nodiscard]] json::Object serialize_const_pack_array(const ConstantArray &val);
-[[nodiscard]] json::Object
-serialize_const_pack_struct(const ConstantStruct &val);
-[[nodiscard]] json::Object
-serialize_const_pack_vector(const ConstantVector &val);
-[[nodiscard]] json::Object serialize_const_marker(const GlobalValue &gval);
-[[nodiscard]] json::Object
+[[nodiscard]] DocObject serialize_const_pack_array(const ConstantArray &val);
+[[nodiscard]] DocObject serialize_const_pack_struct(const ConstantStruct &val);
+[[nodiscard]] DocObject serialize_const_pack_vector(const ConstantVector &val);
+[[nodiscard]] DocObject serialize_const_marker(const GlobalValue &gval);
+[[nodiscard]] DocObject
 serialize_const_ref_global_variable(const GlobalVariable &val);
-[[nodiscard]] json::Object serialize_const_ref_function(const Function &val);
-[[nodiscard]] json::Object
+[[nodiscard]] DocObject serialize_const_ref_function(const Function &val);
+[[nodiscard]] DocObject
 serialize_const_ref_global_alias(const GlobalAlias &val);
-[[nodiscard]] json::Object
-serialize_const_ref_interface(const GlobalIFunc &val);
-[[nodiscard]] json::Object serialize_block_address(const BlockAddress &addr);
-[[nodiscard]] json::Object serialize_const_expr(const ConstantExpr &expr);
+[[nodiscard]] DocObject serialize_const_ref_interface(const GlobalIFunc &val);
+[[nodiscard]] DocObject serialize_block_address(const BlockAddress &addr);
+[[nodiscard]] DocObject serialize_const_expr(const ConstantExpr &expr);
+
+[[nodiscard]] DocObject serialize_global_variable(const GlobalVariable &gvar);
+
+[[nodiscard]] DocObject serialize_function(const Function &func);
+[[nodiscard]] DocObject serialize_parameter(const Argument &param);
+
+/// Compute the module-wide facts that function summaries depend on
+void prepare_summaries(const Module &module);
+[[nodiscard]] DocObject serialize_summary(const Function &func);
+
+[[nodiscard]] DocObject serialize_inline_asm(const InlineAsm &assembly);
+
+/// Name of a synchronization scope, as in the `scope` of atomic instructions
+[[nodiscard]] std::string get_sync_scope_name(SyncScope::ID scope);
+
+/// Name of an opcode, as in the `opcode` of instructions and the code tables
+[[nodiscard]] const char *get_opcode_name(unsigned opcode);
+
+/// Name of a compare predicate, as in the `predicate` of comparisons and the
+/// code tables
+[[nodiscard]] const char *get_predicate_name(CmpInst::Predicate pred);
 
-[[nodiscard]] json::Object
-serialize_global_variable(const GlobalVariable &gvar);
+/// Name of an atomic read-modify-write operation, as in the `opcode` of
+/// AtomicRMW instructions
+[[nodiscard]] const char *get_rmw_op_name(AtomicRMWInst::BinOp op);
 
-[[nodiscard]] json::Object serialize_function(const Function &func);
-[[nodiscard]] json::Object serialize_parameter(const Argument &param);
+/// References into the metadata table, null if the instruction has none
+[[nodiscard]] DocValue serialize_alias_metadata(const Instruction &inst);
 
-[[nodiscard]] json::Object serialize_inline_asm(const InlineAsm &assembly);
+/// Names of the numeric codes, to be referred to in the numeric mode
+[[nodiscard]] DocObject serialize_code_tables(const Module &module);
+
+/// Strongly connected components of the call graph, callees before callers,
+/// computed once per module from the call graph of the analysis manager
+class BottomUpSCCAnalysis : public AnalysisInfoMixin<BottomUpSCCAnalysis> {
+private:
+  friend AnalysisInfoMixin<BottomUpSCCAnalysis>;
+  static AnalysisKey Key;
+
+public:
+  using Result = std::vector<std::vector<const Function *>>;
+  Result run(Module &module, ModuleAnalysisManager &mam);
+};
+
+[[nodiscard]] const BottomUpSCCAnalysis::Result &
+bottom_up_sccs(const Module &module);
+[[nodiscard]] DocObject serialize_call_graph(const Module &module);
+
+/// Source locations of instructions in defined functions, as a side table
+[[nodiscard]] DocObject serialize_debug_locs(const Module &module);
 
 class FunctionSerializationContext {
 private:
@@ -78,76 +194,76 @@ public:
   [[nodiscard]] uint64_t get_argument(const Argument &arg) const;
 
 public:
-  [[nodiscard]] json::Object serialize_block(const BasicBlock &block) const;
-
-  [[nodiscard]] json::Object
-  serialize_instruction(const Instruction &inst) const;
-  [[nodiscard]] json::Object serialize_inst(const Instruction &inst) const;
-  [[nodiscard]] json::Object
-  serialize_inst_alloca(const AllocaInst &inst) const;
-  [[nodiscard]] json::Object serialize_inst_load(const LoadInst &inst) const;
-  [[nodiscard]] json::Object serialize_inst_store(const StoreInst &inst) const;
-  [[nodiscard]] json::Object serialize_inst_va_arg(const VAArgInst &inst) const;
-  [[nodiscard]] json::Object
-  serialize_inst_call_asm(const CallInst &inst) const;
-  [[nodiscard]] json::Object
+  [[nodiscard]] DocObject serialize_block(const BasicBlock &block) const;
+  [[nodiscard]] DocObject serialize_columns(const Function &func) const;
+  [[nodiscard]] DocObject serialize_dominance(const Function &func) const;
+  [[nodiscard]] DocArray serialize_loops(const Function &func) const;
+  [[nodiscard]] DocObject serialize_memory_ssa(const Function &func) const;
+  [[nodiscard]] DocObject serialize_def_use(const Function &func) const;
+  [[nodiscard]] DocObject serialize_value_facts(const Function &func) const;
+  [[nodiscard]] DocObject serialize_escape(const Function &func) const;
+  [[nodiscard]] DocObject serialize_frequency(const Function &func) const;
+
+  [[nodiscard]] DocObject serialize_instruction(const Instruction &inst) const;
+  [[nodiscard]] DocObject serialize_inst(const Instruction &inst) const;
+  [[nodiscard]] DocObject serialize_inst_alloca(const AllocaInst &inst) const;
+  [[nodiscard]] DocObject serialize_inst_load(const LoadInst &inst) const;
+  [[nodiscard]] DocObject serialize_inst_store(const StoreInst &inst) const;
+  [[nodiscard]] DocObject serialize_inst_va_arg(const VAArgInst &inst) const;
+  [[nodiscard]] DocObject serialize_inst_call_asm(const CallInst &inst) const;
+  [[nodiscard]] DocObject
   serialize_inst_call_direct(const CallInst &inst) const;
-  [[nodiscard]] json::Object
+  [[nodiscard]] DocObject
   serialize_inst_call_indirect(const CallInst &inst) const;
-  [[nodiscard]] json::Object
+  [[nodiscard]] DocObject
   serialize_inst_call_intrinsic(const IntrinsicInst &inst) const;
-  [[nodiscard]] json::Object
+  [[nodiscard]] DocObject
   serialize_inst_unary_operator(const UnaryOperator &inst) const;
-  [[nodiscard]] json::Object
+  [[nodiscard]] DocObject
   serialize_inst_binary_operator(const BinaryOperator &inst) const;
-  [[nodiscard]] json::Object serialize_inst_compare(const CmpInst &inst) const;
-  [[nodiscard]] json::Object serialize_inst_cast(const CastInst &inst) const;
-  [[nodiscard]] json::Object
-  serialize_inst_freeze(const FreezeInst &inst) const;
-  [[nodiscard]] json::Object
+  [[nodiscard]] DocObject serialize_inst_compare(const CmpInst &inst) const;
+  [[nodiscard]] DocObject serialize_inst_cast(const CastInst &inst) const;
+  [[nodiscard]] DocObject serialize_inst_freeze(const FreezeInst &inst) const;
+  [[nodiscard]] DocObject
   serialize_inst_gep(const GetElementPtrInst &inst) const;
-  [[nodiscard]] json::Object serialize_inst_phi(const PHINode &inst) const;
-  [[nodiscard]] json::Object serialize_inst_ite(const SelectInst &inst) const;
-  [[nodiscard]] json::Object
+  [[nodiscard]] DocValue
+  serialize_gep_offset(const GetElementPtrInst &inst) const;
+  [[nodiscard]] DocObject serialize_inst_phi(const PHINode &inst) const;
+  [[nodiscard]] DocObject serialize_inst_ite(const SelectInst &inst) const;
+  [[nodiscard]] DocObject
   serialize_inst_get_value(const ExtractValueInst &inst) const;
-  [[nodiscard]] json::Object
+  [[nodiscard]] DocObject
   serialize_inst_set_value(const InsertValueInst &inst) const;
-  [[nodiscard]] json::Object
+  [[nodiscard]] DocObject
   serialize_inst_get_element(const ExtractElementInst &inst) const;
-  [[nodiscard]] json::Object
+  [[nodiscard]] DocObject
   serialize_inst_set_element(const InsertElementInst &inst) const;
-  [[nodiscard]] json::Object
+  [[nodiscard]] DocObject
   serialize_inst_shuffle_vector(const ShuffleVectorInst &inst) const;
-  [[nodiscard]] json::Object serialize_inst_fence(const FenceInst &inst) const;
-  [[nodiscard]] json::Object
+  [[nodiscard]] DocObject serialize_inst_fence(const FenceInst &inst) const;
+  [[nodiscard]] DocObject
   serialize_inst_atomic_cmpxchg(const AtomicCmpXchgInst &inst) const;
-  [[nodiscard]] json::Object
+  [[nodiscard]] DocObject
   serialize_inst_atomic_rmw(const AtomicRMWInst &inst) const;
-  [[nodiscard]] json::Object
+  [[nodiscard]] DocObject
   serialize_inst_landing_pad(const LandingPadInst &inst) const;
-  [[nodiscard]] json::Object
-  serialize_inst_return(const ReturnInst &inst) const;
-  [[nodiscard]] json::Object
-  serialize_inst_branch(const BranchInst &inst) const;
-  [[nodiscard]] json::Object
+  [[nodiscard]] DocObject serialize_inst_return(const ReturnInst &inst) const;
+  [[nodiscard]] DocObject serialize_inst_branch(const BranchInst &inst) const;
+  [[nodiscard]] DocObject
   serialize_inst_jump_indirect(const IndirectBrInst &inst) const;
-  [[nodiscard]] json::Object
-  serialize_inst_switch(const SwitchInst &inst) const;
-  [[nodiscard]] json::Object
+  [[nodiscard]] DocObject serialize_inst_switch(const SwitchInst &inst) const;
+  [[nodiscard]] DocObject
   serialize_inst_invoke_asm(const InvokeInst &inst) const;
-  [[nodiscard]] json::Object
+  [[nodiscard]] DocObject
   serialize_inst_invoke_direct(const InvokeInst &inst) const;
-  [[nodiscard]] json::Object
+  [[nodiscard]] DocObject
   serialize_inst_invoke_indirect(const InvokeInst &inst) const;
-  [[nodiscard]] json::Object
-  serialize_inst_resume(const ResumeInst &inst) const;
-
-  [[nodiscard]] json::Object serialize_value(const Value &val) const;
-  [[nodiscard]] json::Object
-  serialize_value_argument(const Argument &arg) const;
-  [[nodiscard]] json::Object
-  serialize_value_block(const BasicBlock &block) const;
-  [[nodiscard]] json::Object
+  [[nodiscard]] DocObject serialize_inst_resume(const ResumeInst &inst) const;
+
+  [[nodiscard]] DocObject serialize_value(const Value &val) const;
+  [[nodiscard]] DocObject serialize_value_argument(const Argument &arg) const;
+  [[nodiscard]] DocObject serialize_value_block(const BasicBlock &block) const;
+  [[nodiscard]] DocObject
   serialize_value_instruction(const Instruction &inst) const;
 };
 
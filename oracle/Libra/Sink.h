@@ -0,0 +1,56 @@
+#ifndef LIBRA_SINK_H
+#define LIBRA_SINK_H
+
+#include "Deps.h"
+#include "Document.h"
+
+namespace libra {
+
+/// Members of an object in the canonical (sorted by key) order
+[[nodiscard]] inline SmallVector<const DocObject::Member *, 16>
+sorted_members(const DocObject &obj) {
+  SmallVector<const DocObject::Member *, 16> members;
+  for (const auto &member : obj) {
+    members.push_back(&member);
+  }
+  llvm::sort(members, [](const auto *lhs, const auto *rhs) {
+    return lhs->key < rhs->key;
+  });
+  return members;
+}
+
+/// Drive a sink with the events that describe a document value.
+///
+/// A sink is any type that provides the following operations:
+/// - `object_begin()`, `object_key(StringRef)`, `object_end()`
+/// - `array_begin()`, `array_end()`
+/// - `scalar(const DocValue &)` for null, boolean, number, and string values
+///
+/// Members of an object are visited in sorted key order, so every sink sees
+/// the same sequence of events for the same document.
+template <typename Sink> void write_document(Sink &sink, const DocValue &val) {
+  switch (val.kind()) {
+  case DocValue::Array:
+    sink.array_begin();
+    for (const auto &item : val.as_array()) {
+      write_document(sink, item);
+    }
+    sink.array_end();
+    break;
+  case DocValue::Object:
+    sink.object_begin();
+    for (const auto *member : sorted_members(val.as_object())) {
+      sink.object_key(member->key);
+      write_document(sink, member->value);
+    }
+    sink.object_end();
+    break;
+  default:
+    sink.scalar(val);
+    break;
+  }
+}
+
+} // namespace libra
+
+#endif // LIBRA_SINK_H
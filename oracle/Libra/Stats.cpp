@@ -0,0 +1,306 @@
+#include "Stats.h"
+#include "JsonEmitter.h"
+#include "Sink.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+namespace {
+using namespace libra;
+
+/// Size of a string once quoted and escaped in the same way as JsonEmitter
+uint64_t string_size(StringRef str) {
+  uint64_t size = 2 + str.size();
+  for (const auto c : str.bytes()) {
+    if (c == '"' || c == '\\' || c == '\t' || c == '\n' || c == '\r') {
+      size += 1;
+    } else if (c < 0x20) {
+      size += 5;
+    }
+  }
+  return size;
+}
+
+uint64_t digits(uint64_t num) {
+  uint64_t count = 1;
+  for (; num >= 10; num /= 10) {
+    count++;
+  }
+  return count;
+}
+
+/// Size of a scalar in the same form as JsonEmitter writes it
+uint64_t scalar_size(const DocValue &val) {
+  switch (val.kind()) {
+  case DocValue::Null:
+    return 4;
+  case DocValue::Boolean:
+    return val.as_bool() ? 4 : 5;
+  case DocValue::Int:
+    if (val.as_int() < 0) {
+      return 1 + digits(0 - static_cast<uint64_t>(val.as_int()));
+    }
+    return digits(static_cast<uint64_t>(val.as_int()));
+  case DocValue::UInt:
+    return digits(val.as_uint());
+  case DocValue::Double: {
+    char buffer[32];
+    return std::snprintf(buffer, sizeof(buffer), "%.*g",
+                         std::numeric_limits<double>::max_digits10,
+                         val.as_double());
+  }
+  case DocValue::String:
+    return string_size(val.as_string());
+  case DocValue::Array:
+  case DocValue::Object:
+    break;
+  }
+  llvm_unreachable("containers are not scalars");
+}
+
+/// A sink (see Sink.h) that counts the bytes JsonEmitter would write in
+/// compact form, without writing or buffering any of them
+class JsonSizeCounter {
+private:
+  struct Scope {
+    bool is_array;
+    bool has_value;
+  };
+
+  uint64_t size_;
+  SmallVector<Scope, 16> scopes_;
+
+public:
+  JsonSizeCounter() : size_(0) {}
+
+public:
+  [[nodiscard]] uint64_t size() const { return size_; }
+
+  void object_begin() { container_begin(false); }
+  void object_key(StringRef key) {
+    separate();
+    size_ += string_size(key) + 1;
+  }
+  void object_end() { container_end(); }
+  void array_begin() { container_begin(true); }
+  void array_end() { container_end(); }
+
+  void scalar(const DocValue &val) {
+    value_begin();
+    size_ += scalar_size(val);
+  }
+
+private:
+  void container_begin(bool is_array) {
+    value_begin();
+    size_++;
+    scopes_.push_back({is_array, false});
+  }
+
+  void container_end() {
+    scopes_.pop_back();
+    size_++;
+  }
+
+  /// Count the comma before a member, unless it is the first one
+  void separate() {
+    auto &scope = scopes_.back();
+    if (scope.has_value) {
+      size_++;
+    }
+    scope.has_value = true;
+  }
+
+  /// Values in an object are placed by their keys
+  void value_begin() {
+    if (!scopes_.empty() && scopes_.back().is_array) {
+      separate();
+    }
+  }
+};
+
+DocObject serialize_counts(const StringMap<uint64_t> &counts) {
+  DocObject result;
+  for (const auto &entry : counts) {
+    result[entry.getKey()] = entry.getValue();
+  }
+  return result;
+}
+
+} // namespace
+
+namespace libra {
+
+cl::opt<std::string>
+    OptStats("libra-stats",
+             cl::desc("Write serialization time and size statistics to the "
+                      "given file, in JSON"));
+
+std::optional<uint64_t> peak_rss() {
+#if defined(__unix__) || defined(__APPLE__)
+  struct rusage usage {};
+  if (getrusage(RUSAGE_SELF, &usage) != 0) {
+    return std::nullopt;
+  }
+#if defined(__APPLE__)
+  return static_cast<uint64_t>(usage.ru_maxrss);
+#else
+  return static_cast<uint64_t>(usage.ru_maxrss) * 1024;
+#endif
+#else
+  return std::nullopt;
+#endif
+}
+
+double seconds_since(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                       start)
+      .count();
+}
+
+uint64_t encoded_size(const DocValue &val) {
+  JsonSizeCounter counter;
+  write_document(counter, val);
+  return counter.size();
+}
+
+void SerializationStats::add_phase(StringRef name, double seconds) {
+  phases_.emplace_back(name.str(), seconds);
+}
+
+void SerializationStats::add_function(const Function &func, double seconds,
+                                      uint64_t bytes) {
+  functions_.push_back({func.getName().str(), seconds, bytes});
+  for (const auto &inst : instructions(func)) {
+    opcodes_[inst.getOpcodeName()]++;
+  }
+}
+
+void SerializationStats::add_global(const GlobalVariable &gvar, double seconds,
+                                    uint64_t bytes) {
+  globals_.push_back({gvar.getName().str(), seconds, bytes});
+}
+
+void SerializationStats::add_bytes(StringRef category, const DocObject &tagged,
+                                   const DocValue &doc) {
+  const auto iter = tagged.begin();
+  const auto kind = iter != tagged.end() ? iter->key : StringRef("?");
+  const auto key = (category + "." + kind).str();
+  category_counts_[key]++;
+
+  // nodes of earlier calls are often nested in this one, e.g., the type of
+  // a constant, and are not measured again
+  if (sizes_generation_ != DocArena::generation()) {
+    sizes_.clear();
+    sizes_generation_ = DocArena::generation();
+  }
+  const auto size = measure(doc);
+  if (const auto *storage = node_storage(doc)) {
+    sizes_.try_emplace(storage, size);
+  }
+  category_bytes_[key] += size;
+}
+
+const void *SerializationStats::node_storage(const DocValue &doc) {
+  if (doc.kind() == DocValue::Object && !doc.as_object().empty()) {
+    return &*doc.as_object().begin();
+  }
+  if (doc.kind() == DocValue::Array && !doc.as_array().empty()) {
+    return doc.as_array().begin();
+  }
+  return nullptr;
+}
+
+uint64_t SerializationStats::measure(const DocValue &doc) const {
+  if (const auto *storage = node_storage(doc)) {
+    const auto iter = sizes_.find(storage);
+    if (iter != sizes_.end()) {
+      return iter->second;
+    }
+  }
+
+  // brackets, and commas between members or elements
+  switch (doc.kind()) {
+  case DocValue::Object: {
+    const auto &obj = doc.as_object();
+    uint64_t size = obj.empty() ? 2 : 1 + obj.size();
+    for (const auto &member : obj) {
+      size += string_size(member.key) + 1 + measure(member.value);
+    }
+    return size;
+  }
+  case DocValue::Array: {
+    const auto &arr = doc.as_array();
+    uint64_t size = arr.empty() ? 2 : 1 + arr.size();
+    for (const auto &elem : arr) {
+      size += measure(elem);
+    }
+    return size;
+  }
+  default:
+    return scalar_size(doc);
+  }
+}
+
+void SerializationStats::save(StringRef path) const {
+  DocArena arena;
+  DocObject result;
+
+  DocObject phases;
+  for (const auto &[name, seconds] : phases_) {
+    phases[name] = seconds;
+  }
+  result["phases"] = std::move(phases);
+
+  const auto serialize_items = [](const std::vector<Item> &items) {
+    DocArray entries;
+    for (const auto &item : items) {
+      DocObject entry;
+      entry["name"] = item.name;
+      entry["seconds"] = item.seconds;
+      entry["bytes"] = item.bytes;
+      entries.push_back(std::move(entry));
+    }
+    return entries;
+  };
+  result["functions"] = serialize_items(functions_);
+  result["global_variables"] = serialize_items(globals_);
+
+  result["category_counts"] = serialize_counts(category_counts_);
+  result["category_bytes"] = serialize_counts(category_bytes_);
+  result["opcodes"] = serialize_counts(opcodes_);
+
+  if (const auto rss = peak_rss()) {
+    result["peak_rss"] = *rss;
+  } else {
+    result["peak_rss"] = DocValue(nullptr);
+  }
+
+  std::error_code ec;
+  raw_fd_ostream stm(path, ec);
+  if (ec) {
+    LOG->fatal("unable to write statistics {0}: {1}", path, ec.message());
+  }
+  JsonEmitter emitter(stm, 2);
+  emitter.value(result);
+}
+
+std::unique_ptr<SerializationStats> STATS = nullptr;
+
+void init_stats() {
+  assert(STATS == nullptr);
+  if (!OptStats.empty()) {
+    STATS = std::make_unique<SerializationStats>();
+  }
+}
+
+void save_stats() {
+  if (STATS != nullptr) {
+    STATS->save(OptStats);
+  }
+}
+
+void destroy_stats() { STATS = nullptr; }
+
+} // namespace libra
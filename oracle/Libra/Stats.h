@@ -0,0 +1,92 @@
+#ifndef LIBRA_STATS_H
+#define LIBRA_STATS_H
+
+#include "Deps.h"
+#include "Document.h"
+#include "Logger.h"
+
+namespace libra {
+
+/// Statistics file to be written alongside the output
+extern cl::opt<std::string> OptStats;
+
+/// Seconds elapsed since a point in time
+[[nodiscard]] double
+seconds_since(std::chrono::steady_clock::time_point start);
+
+/// Peak resident set size of the process in bytes, if available
+[[nodiscard]] std::optional<uint64_t> peak_rss();
+
+/// Number of bytes of a value in compact JSON, as a format-neutral measure,
+/// counted without writing the text
+[[nodiscard]] uint64_t encoded_size(const DocValue &val);
+
+/// Where serialization time and output bytes go, for one module.
+///
+/// Bytes of types, constants, and operands are inclusive, e.g., the bytes of
+/// a constant also count towards the type it carries.
+class SerializationStats {
+private:
+  struct Item {
+    std::string name;
+    double seconds;
+    uint64_t bytes;
+  };
+
+  std::vector<std::pair<std::string, double>> phases_;
+  std::vector<Item> functions_;
+  std::vector<Item> globals_;
+  StringMap<uint64_t> category_counts_;
+  StringMap<uint64_t> category_bytes_;
+  StringMap<uint64_t> opcodes_;
+
+  /// sizes of the nodes recorded by `add_bytes`, keyed by their storage and
+  /// dropped once any arena releases its nodes
+  DenseMap<const void *, uint64_t> sizes_;
+  uint64_t sizes_generation_;
+
+public:
+  SerializationStats() : sizes_generation_(DocArena::generation()) {}
+
+public:
+  /// Record the time spent in one phase of the pass
+  void add_phase(StringRef name, double seconds);
+
+  /// Record one function, including its instruction kinds
+  void add_function(const Function &func, double seconds, uint64_t bytes);
+
+  /// Record one global variable
+  void add_global(const GlobalVariable &gvar, double seconds, uint64_t bytes);
+
+  /// Record one serialized node of a category (e.g., "type"), where the kind
+  /// is the tag of the `tagged` object (e.g., "Struct"). The node is expected
+  /// to be complete, as its size is reused when it is nested in later ones.
+  void add_bytes(StringRef category, const DocObject &tagged,
+                 const DocValue &doc);
+
+  /// Write the statistics as JSON, replacing existing content
+  void save(StringRef path) const;
+
+private:
+  /// Identity of a non-empty container, null for anything else
+  [[nodiscard]] static const void *node_storage(const DocValue &doc);
+
+  /// Same as `encoded_size`, without descending into recorded nodes
+  [[nodiscard]] uint64_t measure(const DocValue &doc) const;
+};
+
+/// The statistics in use, if any
+extern std::unique_ptr<SerializationStats> STATS;
+
+/// Prepare the statistics according to command-line options
+void init_stats();
+
+/// Write the statistics file, if requested
+void save_stats();
+
+/// Release the statistics
+void destroy_stats();
+
+} // namespace libra
+
+#endif // LIBRA_STATS_H
@@ -0,0 +1,37 @@
+#include "StringTable.h"
+
+namespace libra {
+
+cl::opt<bool> OptInternNames(
+    "libra-intern-names", cl::init(false),
+    cl::desc("Emit names as indices into a module-level string table"));
+
+uint64_t StringTable::intern(StringRef str) {
+  auto res = ids_.try_emplace(str, entries_.size());
+  if (res.second) {
+    // keys owned by the map are stable, refer to them directly
+    entries_.push_back(res.first->getKey());
+  }
+  return res.first->second;
+}
+
+DocArray StringTable::serialize() const {
+  DocArray result;
+  for (const auto &str : entries_) {
+    result.push_back(str);
+  }
+  return result;
+}
+
+std::unique_ptr<StringTable> STRINGS = nullptr;
+
+void init_string_table() {
+  assert(STRINGS == nullptr);
+  if (OptInternNames) {
+    STRINGS = std::make_unique<StringTable>();
+  }
+}
+
+void destroy_string_table() { STRINGS = nullptr; }
+
+} // namespace libra
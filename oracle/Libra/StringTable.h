@@ -0,0 +1,41 @@
+#ifndef LIBRA_STRING_TABLE_H
+#define LIBRA_STRING_TABLE_H
+
+#include "Deps.h"
+#include "Document.h"
+#include "Logger.h"
+
+namespace libra {
+
+/// Flag to replace names in the output with indices into a string table
+extern cl::opt<bool> OptInternNames;
+
+/// A module-level table of names, each distinct name is emitted only once
+class StringTable {
+private:
+  StringMap<uint64_t> ids_;
+  std::vector<StringRef> entries_;
+
+public:
+  StringTable() = default;
+
+public:
+  /// Get the index of the string, adding it to the table if not present
+  [[nodiscard]] uint64_t intern(StringRef str);
+
+  /// Dump the table in index order
+  [[nodiscard]] DocArray serialize() const;
+};
+
+/// The string table in use, if any
+extern std::unique_ptr<StringTable> STRINGS;
+
+/// Prepare the string table according to command-line options
+void init_string_table();
+
+/// Release the string table
+void destroy_string_table();
+
+} // namespace libra
+
+#endif // LIBRA_STRING_TABLE_H
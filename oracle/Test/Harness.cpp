@@ -0,0 +1,105 @@
+#include "Test/Harness.h"
+#include "Libra/Pass.h"
+
+#include <llvm/AsmParser/Parser.h>
+#include <llvm/Support/InitLLVM.h>
+#include <llvm/Support/SourceMgr.h>
+
+using namespace libra;
+using namespace libra::test;
+
+namespace {
+
+cl::list<std::string> OptCases(cl::Positional,
+                               cl::desc("<test cases> (default: all)"));
+
+/// All test cases, in registration order
+std::vector<std::pair<const char *, void (*)()>> &registry() {
+  static std::vector<std::pair<const char *, void (*)()>> cases;
+  return cases;
+}
+
+} // namespace
+
+namespace libra::test {
+
+TestCase::TestCase(const char *name, void (*body)()) {
+  registry().emplace_back(name, body);
+}
+
+void fail(const char *file, unsigned line, const Twine &message) {
+  errs() << formatv("{0}:{1}: check failed: {2}\n", file, line,
+                    message.str());
+  exit(1);
+}
+
+TempFile::TempFile(StringRef suffix) {
+  if (auto ec = sys::fs::createTemporaryFile("libra-test", suffix, path_)) {
+    fail(__FILE__, __LINE__, "unable to create temporary file");
+  }
+}
+
+TempFile::~TempFile() { remove(); }
+
+void TempFile::remove() const { sys::fs::remove(path_); }
+
+std::string TempFile::read() const {
+  auto buffer = MemoryBuffer::getFile(path_);
+  if (!buffer) {
+    fail(__FILE__, __LINE__, "unable to read " + path_);
+  }
+  return buffer.get()->getBuffer().str();
+}
+
+std::unique_ptr<Module> parse_module(StringRef ir, LLVMContext &context) {
+  SMDiagnostic diag;
+  auto module = parseAssemblyString(ir, diag, context);
+  if (module == nullptr) {
+    diag.print("LibraTest", errs());
+    fail(__FILE__, __LINE__, "invalid test module");
+  }
+  return module;
+}
+
+std::string run_pass(StringRef ir) {
+  LLVMContext context;
+  auto module = parse_module(ir, context);
+
+  TempFile output("out");
+  output.remove();
+  OptOutput = output.path().str();
+  run_standalone(*module);
+  return output.read();
+}
+
+json::Value parse_json(StringRef text) {
+  auto parsed = json::parse(text);
+  if (!parsed) {
+    fail(__FILE__, __LINE__,
+         "malformed JSON: " + toString(parsed.takeError()));
+  }
+  return std::move(*parsed);
+}
+
+} // namespace libra::test
+
+int main(int argc, char **argv) {
+  InitLLVM init(argc, argv);
+  cl::ParseCommandLineOptions(argc, argv, "Tests of the serializer\n");
+
+  unsigned count = 0;
+  for (const auto &[name, body] : registry()) {
+    if (!OptCases.empty() && !is_contained(OptCases, name)) {
+      continue;
+    }
+    outs() << formatv("[ RUN  ] {0}\n", name);
+    body();
+    outs() << formatv("[  OK  ] {0}\n", name);
+    count++;
+  }
+  if (count == 0) {
+    errs() << "no test case selected\n";
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,64 @@
+#ifndef LIBRA_TEST_HARNESS_H
+#define LIBRA_TEST_HARNESS_H
+
+#include "Libra/Deps.h"
+
+namespace libra::test {
+
+/// A test case, registered by name during static initialization
+class TestCase {
+public:
+  TestCase(const char *name, void (*body)());
+};
+
+/// Report a failed check and terminate the test
+[[noreturn]] void fail(const char *file, unsigned line, const Twine &message);
+
+/// A temporary file, removed when released
+class TempFile {
+private:
+  SmallString<128> path_;
+
+public:
+  explicit TempFile(StringRef suffix);
+  ~TempFile();
+
+  TempFile(const TempFile &) = delete;
+  TempFile &operator=(const TempFile &) = delete;
+
+public:
+  [[nodiscard]] StringRef path() const { return path_; }
+
+  /// Remove the file, e.g., so that the pass can create it again
+  void remove() const;
+
+  /// Content of the file, failing the test if unreadable
+  [[nodiscard]] std::string read() const;
+};
+
+/// Parse a module from textual IR, failing the test on errors
+[[nodiscard]] std::unique_ptr<Module> parse_module(StringRef ir,
+                                                   LLVMContext &context);
+
+/// Run the pass on textual IR with the current options, and return what it
+/// writes to the output file
+[[nodiscard]] std::string run_pass(StringRef ir);
+
+/// Parse JSON output, failing the test on errors
+[[nodiscard]] json::Value parse_json(StringRef text);
+
+} // namespace libra::test
+
+#define LIBRA_TEST(name)                                                       \
+  static void test_##name();                                                   \
+  static const ::libra::test::TestCase case_##name(#name, test_##name);        \
+  static void test_##name()
+
+#define CHECK(cond)                                                            \
+  do {                                                                         \
+    if (!(cond)) {                                                             \
+      ::libra::test::fail(__FILE__, __LINE__, #cond);                          \
+    }                                                                          \
+  } while (false)
+
+#endif // LIBRA_TEST_HARNESS_H
@@ -0,0 +1,224 @@
+#include "Libra/Serializer.h"
+#include "Test/Harness.h"
+
+using namespace libra;
+using namespace libra::test;
+
+namespace {
+
+/// One function with every opcode that has a column of its own, and a debug
+/// intrinsic that both layouts leave out
+constexpr const char *MODULE = R"IR(
+%struct.pair = type { i32, i64 }
+
+declare i32 @callee(i32)
+declare void @may_throw()
+declare i32 @personality(...)
+
+define i32 @body(i32 %n, ptr %p, <4 x i32> %vec) personality ptr @personality !dbg !6 {
+entry:
+  %slot = alloca %struct.pair
+  %field = getelementptr %struct.pair, ptr %slot, i32 0, i32 1
+  call void @llvm.dbg.value(metadata i32 %n, metadata !9, metadata !DIExpression()), !dbg !10
+  %r = call i32 @callee(i32 %n)
+  %agg = insertvalue { i32, [2 x i32] } poison, i32 %r, 1, 0
+  %elem = extractvalue { i32, [2 x i32] } %agg, 1, 0
+  %shuf = shufflevector <4 x i32> %vec, <4 x i32> poison, <2 x i32> <i32 3, i32 poison>
+  %cmp = icmp slt i32 %elem, 7
+  br i1 %cmp, label %then, label %done
+
+then:
+  %v = load atomic i32, ptr %p acquire, align 4
+  store i32 %v, ptr %field, align 4
+  fence syncscope("singlethread") release
+  %pair = cmpxchg ptr %p, i32 %v, i32 0 acq_rel monotonic
+  %old = atomicrmw add ptr %p, i32 1 seq_cst
+  invoke void @may_throw() to label %done unwind label %pad
+
+pad:
+  %lp = landingpad { ptr, i32 } cleanup
+  resume { ptr, i32 } %lp
+
+done:
+  %x = phi i32 [ %old, %then ], [ 3, %entry ]
+  ret i32 %x
+}
+
+declare void @llvm.dbg.value(metadata, metadata, metadata)
+
+!llvm.dbg.cu = !{!0}
+!llvm.module.flags = !{!3, !4}
+
+!0 = distinct !DICompileUnit(language: DW_LANG_C99, file: !1, emissionKind: FullDebug)
+!1 = !DIFile(filename: "body.c", directory: "/")
+!3 = !{i32 2, !"Debug Info Version", i32 3}
+!4 = !{i32 2, !"Dwarf Version", i32 5}
+!6 = distinct !DISubprogram(name: "body", scope: !1, file: !1, line: 1, type: !7, unit: !0, spFlags: DISPFlagDefinition)
+!7 = !DISubroutineType(types: !8)
+!8 = !{null}
+!9 = !DILocalVariable(name: "n", arg: 1, scope: !6, file: !1, line: 1)
+!10 = !DILocation(line: 1, scope: !6)
+)IR";
+
+/// Output of the module in one of the layouts, with predicates as numbers
+/// on both sides
+const json::Object &serialize_body(bool columnar, json::Value &storage) {
+  OptColumnar = columnar;
+  OptNumericCodes = true;
+  storage = parse_json(run_pass(MODULE));
+  OptNumericCodes = false;
+  OptColumnar = false;
+
+  for (const auto &item : *storage.getAsObject()->getArray("functions")) {
+    const auto &func = *item.getAsObject();
+    if (func.getString("name") == StringRef("body")) {
+      return func;
+    }
+  }
+  fail(__FILE__, __LINE__, "function not serialized");
+}
+
+/// Column of the given name
+const json::Array &column(const json::Object &columns, StringRef name) {
+  const auto *result = columns.getArray(name);
+  if (result == nullptr) {
+    fail(__FILE__, __LINE__, "missing column " + name);
+  }
+  return *result;
+}
+
+/// Entry of a column, as an index into another column or a table
+size_t at(const json::Array &col, size_t row) {
+  return static_cast<size_t>(*col[row].getAsInteger());
+}
+
+/// The operand an entry of the flat operand columns refers to, in the form of
+/// a value in the nested layout
+json::Value operand(const json::Object &columns, size_t pos) {
+  const auto kind = at(column(columns, "operand_kind"), pos);
+  const auto id = *column(columns, "operand_id")[pos].getAsInteger();
+  switch (kind) {
+  case 0:
+    return json::Object{{"Argument", json::Object{{"index", id}}}};
+  case 1:
+    return json::Object{{"Instruction", json::Object{{"index", id}}}};
+  case 3:
+    return json::Object{
+        {"Constant", column(columns, "constants")[static_cast<size_t>(id)]}};
+  default:
+    fail(__FILE__, __LINE__, "unexpected operand kind");
+  }
+}
+
+/// A value of the nested layout, without the type of an argument or
+/// instruction, which the columns keep in the rows they refer to
+json::Value untyped(const json::Value &val) {
+  json::Object result = *val.getAsObject();
+  for (const auto *kind : {"Argument", "Instruction"}) {
+    if (auto *ref = result.getObject(kind)) {
+      ref->erase("ty");
+    }
+  }
+  return result;
+}
+
+} // namespace
+
+LIBRA_TEST(columns_match_nested_layout) {
+  json::Value nested_storage(nullptr);
+  json::Value columnar_storage(nullptr);
+  const auto &nested = serialize_body(false, nested_storage);
+  const auto &func = serialize_body(true, columnar_storage);
+  const auto &columns = *func.getObject("columns");
+  const auto &types = column(columns, "types");
+
+  // instructions of the nested layout, by index
+  std::map<int64_t, const json::Object *> insts;
+  for (const auto &block : *nested.getArray("blocks")) {
+    const auto &obj = *block.getAsObject();
+    for (const auto &inst : *obj.getArray("body")) {
+      insts.emplace(*inst.getAsObject()->getInteger("index"),
+                    inst.getAsObject());
+    }
+    const auto *term = obj.getObject("terminator");
+    insts.emplace(*term->getInteger("index"), term);
+  }
+
+  // the same instructions, the debug intrinsic left out by both
+  const auto &indices = column(columns, "index");
+  CHECK(indices.size() == insts.size());
+  CHECK(insts.count(2) == 0);
+
+  for (size_t row = 0; row < indices.size(); row++) {
+    const auto iter = insts.find(*indices[row].getAsInteger());
+    CHECK(iter != insts.end());
+    const auto &inst = *iter->second;
+    CHECK(types[at(column(columns, "ty"), row)] == *inst.get("ty"));
+
+    const auto &repr = *inst.getObject("repr");
+    const auto &kind = repr.begin()->first;
+    const auto &fields = *repr.begin()->second.getAsObject();
+    const auto type_operand = [&] {
+      return types[at(column(columns, "type_operand"), row)];
+    };
+    const auto &ordering = column(columns, "ordering")[row];
+    if (kind != "AtomicRMW") {
+      CHECK(column(columns, "rmw_op")[row] == json::Value(nullptr));
+    }
+    if (kind != "ShuffleVector") {
+      CHECK(column(columns, "shuffle_mask")[row] == json::Value(nullptr));
+    }
+    if (kind != "LandingPad") {
+      CHECK(column(columns, "cleanup")[row] == json::Value(nullptr));
+    }
+    const auto &scope = column(columns, "scope")[row];
+
+    if (kind == "Compare") {
+      CHECK(column(columns, "predicate")[row] == *fields.get("predicate"));
+    } else if (kind == "Alloca") {
+      CHECK(type_operand() == *fields.get("allocated_type"));
+    } else if (kind == "GEP") {
+      CHECK(type_operand() == *fields.get("src_pointee_ty"));
+    } else if (kind == "CallDirect") {
+      CHECK(type_operand() == *fields.get("target_type"));
+    } else if (kind == "Load" || kind == "Store") {
+      CHECK(ordering == *fields.get("ordering"));
+    } else if (kind == "Fence") {
+      CHECK(ordering == *fields.get("ordering"));
+      CHECK(scope == *fields.get("scope"));
+    } else if (kind == "AtomicRMW") {
+      CHECK(ordering == *fields.get("ordering"));
+      CHECK(scope == *fields.get("scope"));
+      CHECK(column(columns, "rmw_op")[row] == *fields.get("opcode"));
+    } else if (kind == "AtomicCmpXchg") {
+      CHECK(ordering == *fields.get("ordering_success"));
+      CHECK(column(columns, "failure_ordering")[row] ==
+            *fields.get("ordering_failure"));
+      CHECK(scope == *fields.get("scope"));
+    } else if (kind == "GetValue" || kind == "SetValue") {
+      const auto &expected = *fields.getArray("indices");
+      const auto first = at(column(columns, "agg_index_start"), row);
+      CHECK(at(column(columns, "agg_index_start"), row + 1) - first ==
+            expected.size());
+      for (size_t k = 0; k < expected.size(); k++) {
+        CHECK(column(columns, "agg_indices")[first + k] == expected[k]);
+      }
+    } else if (kind == "ShuffleVector") {
+      CHECK(column(columns, "shuffle_mask")[row] == *fields.get("mask"));
+    } else if (kind == "LandingPad") {
+      CHECK(column(columns, "cleanup")[row] == *fields.get("is_cleanup"));
+    } else if (kind == "Phi") {
+      const auto &options = *fields.getArray("options");
+      const auto incoming = at(column(columns, "incoming_start"), row);
+      const auto first = at(column(columns, "operand_start"), row);
+      CHECK(at(column(columns, "incoming_start"), row + 1) - incoming ==
+            options.size());
+      for (size_t k = 0; k < options.size(); k++) {
+        const auto &option = *options[k].getAsObject();
+        CHECK(column(columns, "incoming_block")[incoming + k] ==
+              *option.get("block"));
+        CHECK(operand(columns, first + k) == untyped(*option.get("value")));
+      }
+    }
+  }
+}
@@ -0,0 +1,116 @@
+#include "Libra/Dictionary.h"
+#include "Libra/StringTable.h"
+#include "Test/Harness.h"
+
+using namespace libra;
+using namespace libra::test;
+
+namespace {
+
+constexpr const char *MODULE_A = R"IR(
+%struct.shared = type { i32, ptr }
+
+@a = global %struct.shared zeroinitializer
+
+define void @use_a(ptr %p) {
+  ret void
+}
+)IR";
+
+constexpr const char *MODULE_B = R"IR(
+%struct.shared = type { i32, ptr }
+%struct.outer = type { i64, %struct.shared }
+
+@b = global %struct.outer zeroinitializer
+
+define void @use_b(ptr %p) {
+  ret void
+}
+)IR";
+
+/// Index of the struct definition in the dictionary with the given name
+std::optional<size_t> find_struct_id(const json::Object &dict, StringRef name) {
+  const auto &structs = *dict.getArray("structs");
+  for (size_t i = 0; i < structs.size(); i++) {
+    const auto *def = structs[i].getAsObject()->getObject("def");
+    if (def != nullptr && def->getString("name") == name) {
+      return i;
+    }
+  }
+  return std::nullopt;
+}
+
+/// The struct definition in the dictionary with the given name
+const json::Object *find_struct(const json::Object &dict, StringRef name) {
+  const auto id = find_struct_id(dict, name);
+  if (!id) {
+    return nullptr;
+  }
+  return (*dict.getArray("structs"))[*id].getAsObject()->getObject("def");
+}
+
+/// A reference into the dictionary
+json::Value dict_ref(size_t id) {
+  return json::Object{{"dict", static_cast<int64_t>(id)}};
+}
+
+} // namespace
+
+LIBRA_TEST(dictionary_interned_names) {
+  TempFile dict_file("json");
+  dict_file.remove();
+
+  // names in the modules are interned, the dictionary is built by both
+  OptInternNames = true;
+  OptDictionaryBuild = dict_file.path().str();
+  (void)run_pass(MODULE_A);
+  (void)run_pass(MODULE_B);
+  OptDictionaryBuild = "";
+
+  const auto dict = parse_json(dict_file.read());
+  const auto &root = *dict.getAsObject();
+
+  // names in definitions are verbatim, not indices of either module
+  const auto *shared = find_struct(root, "struct.shared");
+  CHECK(shared != nullptr);
+  const auto *outer = find_struct(root, "struct.outer");
+  CHECK(outer != nullptr);
+
+  const auto *fields = outer->getArray("fields");
+  CHECK(fields != nullptr && fields->size() == 2);
+  const auto *nested = (*fields)[1].getAsObject()->getObject("Struct");
+  CHECK(nested != nullptr);
+  CHECK(nested->getString("name") == StringRef("struct.shared"));
+
+  // the output referring to the dictionary still interns its own names
+  const auto content = dict_file.read();
+  OptDictionary = dict_file.path().str();
+  const auto output = parse_json(run_pass(MODULE_B));
+  OptDictionary = "";
+  OptInternNames = false;
+  const auto &module = *output.getAsObject();
+  CHECK(module.getArray("strings") != nullptr);
+
+  // and names the dictionary it refers to
+  const auto *header = module.getObject("dictionary");
+  CHECK(header != nullptr);
+  CHECK(header->getString("digest") ==
+        StringRef(utohexstr(xxHash64(content), /* LowerCase */ true)));
+
+  // struct types found in the dictionary are references to its entries
+  const auto shared_id = find_struct_id(root, "struct.shared");
+  const auto outer_id = find_struct_id(root, "struct.outer");
+  std::vector<json::Value> refs;
+  for (const auto &item : *module.getArray("structs")) {
+    refs.push_back(item);
+  }
+  CHECK(refs.size() == 2);
+  CHECK(std::count(refs.begin(), refs.end(), dict_ref(*shared_id)) == 1);
+  CHECK(std::count(refs.begin(), refs.end(), dict_ref(*outer_id)) == 1);
+
+  const auto &gvars = *module.getArray("global_variables");
+  CHECK(gvars.size() == 1);
+  const auto &gvar = *gvars.front().getAsObject();
+  CHECK(*gvar.get("ty") ==
+        json::Value(json::Object{{"Struct", dict_ref(*outer_id)}}));
+}
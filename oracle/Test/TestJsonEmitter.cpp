@@ -0,0 +1,53 @@
+#include "Libra/Pass.h"
+#include "Test/Harness.h"
+
+using namespace libra;
+using namespace libra::test;
+
+namespace {
+
+/// Strings that need escaping, and numbers of all kinds
+constexpr const char *MODULE = R"IR(
+%struct.pair = type { i64, double }
+
+@message = constant [12 x i8] c"a\09\22b\\\0Ac\01\7F\C3\A9\00"
+@pair = global %struct.pair { i64 -9223372036854775808, double 0.1 }
+@empty = global {} zeroinitializer
+
+define i64 @"quoted \22name\22"(i64 %x) {
+entry:
+  %cmp = icmp ult i64 %x, 18446744073709551615
+  br i1 %cmp, label %then, label %done
+
+then:
+  %y = mul i64 %x, -3
+  br label %done
+
+done:
+  %r = phi i64 [ %y, %then ], [ 0, %entry ]
+  ret i64 %r
+}
+
+declare void @external()
+)IR";
+
+/// Output of the module with the given format
+std::string serialize(OutputFormat format, bool compact) {
+  OptFormat = format;
+  OptCompact = compact;
+  auto result = run_pass(MODULE);
+  OptFormat = OutputFormat::Json;
+  OptCompact = false;
+  return result;
+}
+
+} // namespace
+
+LIBRA_TEST(json_emitter_matches_formatv) {
+  for (const bool compact : {false, true}) {
+    const auto emitted = serialize(OutputFormat::Json, compact);
+    const auto baseline = serialize(OutputFormat::JsonFormatv, compact);
+    CHECK(!emitted.empty());
+    CHECK(emitted == baseline);
+  }
+}
@@ -0,0 +1,90 @@
+#include "Libra/Serializer.h"
+#include "Test/Harness.h"
+
+using namespace libra;
+using namespace libra::test;
+
+namespace {
+
+constexpr const char *MODULE = R"IR(
+@g = global i32 0
+
+define void @through_arg(ptr %p) {
+  store i32 1, ptr %p
+  ret void
+}
+
+define void @passes_global() {
+  call void @through_arg(ptr @g)
+  ret void
+}
+
+define void @through_loaded(ptr %pp) {
+  %q = load ptr, ptr %pp
+  store i32 4, ptr %q
+  ret void
+}
+
+define void @passes_loaded(ptr %pp) {
+  call void @through_loaded(ptr %pp)
+  ret void
+}
+
+define void @direct_and_local() {
+  %slot = alloca i32
+  store i32 2, ptr %slot
+  store i32 3, ptr @g
+  ret void
+}
+)IR";
+
+/// The summary of each function, by name
+std::map<std::string, json::Object> summaries(const json::Value &output) {
+  std::map<std::string, json::Object> result;
+  for (const auto &item : *output.getAsObject()->getArray("functions")) {
+    const auto &func = *item.getAsObject();
+    result.emplace(func.getString("name")->str(), *func.getObject("summary"));
+  }
+  return result;
+}
+
+} // namespace
+
+LIBRA_TEST(summary_unknown_base) {
+  OptSummaries = true;
+  const auto output = parse_json(run_pass(MODULE));
+  OptSummaries = false;
+  const auto funcs = summaries(output);
+
+  // a store through an argument is kept apart from the globals
+  const auto &through_arg = funcs.at("through_arg");
+  const auto *arg_writes = through_arg.getArray("global_writes");
+  CHECK(arg_writes != nullptr && arg_writes->empty());
+  const auto *arg_accesses = through_arg.getArray("arg_accesses");
+  CHECK(arg_accesses != nullptr && arg_accesses->size() == 1);
+  CHECK((*arg_accesses)[0] == json::Value("mod"));
+  const auto *captures = through_arg.getArray("may_capture_args");
+  CHECK(captures != nullptr && (*captures)[0] == json::Value(false));
+
+  // and callers write what they pass
+  const auto &passes_global = funcs.at("passes_global");
+  const auto *passed_writes = passes_global.getArray("global_writes");
+  CHECK(passed_writes != nullptr && passed_writes->size() == 1);
+  CHECK((*passed_writes)[0] == json::Value(0));
+  const auto *passed_reads = passes_global.getArray("global_reads");
+  CHECK(passed_reads != nullptr && passed_reads->empty());
+
+  // a store through a loaded pointer may write any global, and so may callers
+  CHECK(*funcs.at("through_loaded").get("global_writes") ==
+        json::Value(nullptr));
+  CHECK(*funcs.at("passes_loaded").get("global_writes") ==
+        json::Value(nullptr));
+
+  // accesses to globals and to local memory only are known exactly
+  const auto &direct = funcs.at("direct_and_local");
+  const auto *writes = direct.getArray("global_writes");
+  CHECK(writes != nullptr && writes->size() == 1);
+  CHECK((*writes)[0] == json::Value(0));
+  const auto *reads = direct.getArray("global_reads");
+  CHECK(reads != nullptr && reads->empty());
+}